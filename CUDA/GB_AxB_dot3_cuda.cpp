@@ -433,23 +433,65 @@ GrB_Info GB_AxB_dot3_cuda           // C<M> = A'*B using dot product method
         // phase3: do the numerical work
         //----------------------------------------------------------------------
 
-        for ( int bucket = 1 ; bucket < NBUCKETS; ++bucket)
+        // Hybrid CPU+GPU execution: if A and B are both sparse/hyper and both
+        // of their buckets have work, the mergepath bucket (the large dot
+        // products) is launched on the GPU without synchronizing, and the
+        // vsvs bucket (the many tiny dot products) is done on the CPU while
+        // the GPU works.  The two buckets touch disjoint entries of C, and
+        // the CPU zombie count is folded into C->nzombies only after the
+        // stream sync, since the GPU kernel updates it atomically.
+
+        int64_t vsvs_start = Bucketp [GB_BUCKET_VSVS] ;
+        int64_t vsvs_end   = Bucketp [GB_BUCKET_VSVS + 1] ;
+        int64_t mp_start   = Bucketp [GB_BUCKET_MERGEPATH] ;
+        int64_t mp_end     = Bucketp [GB_BUCKET_MERGEPATH + 1] ;
+
+        bool hybrid = A_is_sparse_or_hyper && B_is_sparse_or_hyper
+            && (vsvs_end > vsvs_start) && (mp_end > mp_start)
+            && GB_cuda_dot3_cpu_bucket_ok (A, B, semiring, flipxy) ;
+
+        if (hybrid)
         {
-            int64_t start = Bucketp[bucket];
-            int64_t end   = Bucketp[bucket + 1 ];
-            if (end - start > 0)
+            // launch the mergepath bucket on the GPU, with no sync
+            phase3launchFactory p3lf(my_mxm_spec, GB_BUCKET_MERGEPATH);
+            GBURBLE ("(GPU+CPU hybrid dot3 launch ) ") ;
+            kernel_timer.Start();
+            p3lf.jitGridBlockLaunch(mp_start, mp_end, Bucketp, Bucket,
+                C, M, A, B, stream);
+
+            // do the vsvs bucket on the CPU while the GPU works
+            int64_t cpu_nzombies = 0 ;
+            GB_OK (GB_cuda_dot3_cpu_bucket (vsvs_start, vsvs_end, Bucket,
+                C, M, A, B, semiring, flipxy, &cpu_nzombies)) ;
+
+            CU_OK (cudaStreamSynchronize(stream));
+            kernel_timer.Stop();
+            C->nzombies += cpu_nzombies ;
+            GBURBLE ("(GPU+CPU hybrid dot3 done %12.6g ms, rate=%12.6g)\n",
+                kernel_timer.Elapsed(),
+                (mp_end-mp_start)/(1000*kernel_timer.Elapsed())) ;
+        }
+        else
+        {
+            for ( int bucket = 1 ; bucket < NBUCKETS; ++bucket)
             {
-                // TODO: Use stream pool
-                phase3launchFactory p3lf(my_mxm_spec, (GB_bucket_code)bucket);
-                GBURBLE ("(GPU phase3 bucket %d launch ) ", bucket) ;
-                kernel_timer.Start();
-                p3lf.jitGridBlockLaunch(start, end, Bucketp, Bucket,
-                    C, M, A, B, stream);
-                CU_OK (cudaStreamSynchronize(stream));  // only for timing
-                kernel_timer.Stop();
-                GBURBLE ("(GPU phase3 bucket %d done %12.6g ms, rate=%12.6g)\n",
-                    bucket, kernel_timer.Elapsed(),
-                    (end-start)/(1000*kernel_timer.Elapsed())) ; 
+                int64_t start = Bucketp[bucket];
+                int64_t end   = Bucketp[bucket + 1 ];
+                if (end - start > 0)
+                {
+                    // TODO: Use stream pool
+                    phase3launchFactory p3lf(my_mxm_spec,
+                        (GB_bucket_code)bucket);
+                    GBURBLE ("(GPU phase3 bucket %d launch ) ", bucket) ;
+                    kernel_timer.Start();
+                    p3lf.jitGridBlockLaunch(start, end, Bucketp, Bucket,
+                        C, M, A, B, stream);
+                    CU_OK (cudaStreamSynchronize(stream));  // only for timing
+                    kernel_timer.Stop();
+                    GBURBLE ("(GPU phase3 bucket %d done %12.6g ms, "
+                        "rate=%12.6g)\n", bucket, kernel_timer.Elapsed(),
+                        (end-start)/(1000*kernel_timer.Elapsed())) ;
+                }
             }
         }
     }
@@ -0,0 +1,334 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_cuda: compute C = A*B in parallel, on the GPU(s)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// This function computes C=A*B on the GPUs, saxpy style (push-based, one
+// vector of C per vector of B), the GPU counterpart of the CPU
+// GB_AxB_saxpy3 Gustavson/Hash method.  There is no mask; masked cases stay
+// on the CPU (FIXME: port the masked saxpy3 cases).  A and B must be sparse
+// or hypersparse.  C is computed as sparse or hypersparse, with the same
+// hyperlist as B when hypersparse, and is left jumbled (its vectors are
+// unordered).
+
+// phase1 computes nnz (C (:,j)) for each vector of B, with one Gustavson
+// scatter slab per threadblock.  The cumulative sum of those counts gives
+// C->p.  phase3 does the numeric work, with each vector assigned to one of
+// two buckets: a shared-memory hash table when nnz (C (:,j)) is small, or a
+// global Gustavson slab otherwise.
+
+#include "GB_cuda.h"
+extern "C"
+{
+    #include "GB_mxm.h"
+}
+
+#include "GB_jit_cache.h"
+#include "GB_cuda_common_jitFactory.hpp"
+#include "GB_cuda_mxm_saxpy3_jitFactory.hpp"
+#include "GB_cuda_type_wrap.hpp"
+#include "test/GpuTimer.h"
+
+#undef  GB_FREE_WORKSPACE
+#define GB_FREE_WORKSPACE                                               \
+{                                                                       \
+    /* FIXME: use a stream pool instead */                              \
+    CU_OK (cudaStreamSynchronize(stream));                              \
+    CU_OK (cudaStreamDestroy(stream));                                  \
+    GB_FREE_WORK (&Cwork, Cwork_size) ;                                 \
+    GB_FREE_WORK (&Wf, Wf_size) ;                                       \
+    GB_FREE_WORK (&Wx, Wx_size) ;                                       \
+    GB_FREE_WORK (&Bucketp, Bup_size) ;                                 \
+    GB_FREE_WORK (&Bucket, Bu_size) ;                                   \
+}
+
+#undef  GB_FREE_ALL
+#define GB_FREE_ALL                                                     \
+{                                                                       \
+    GB_FREE_WORKSPACE ;                                                 \
+    GB_phybix_free (C) ;                                                \
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_cuda
+//------------------------------------------------------------------------------
+
+GrB_Info GB_AxB_saxpy3_cuda         // C = A*B using the saxpy3 method
+(
+    GrB_Matrix C,                   // output matrix, sparse or hypersparse
+    int C_sparsity,                 // construct C as sparse or hypersparse
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy               // if true, do z=fmult(b,a) vs fmult(a,b)
+)
+{
+
+    // FIXME: pass in a stream instead, or checkout a stream
+    cudaStream_t stream = NULL ;
+    CU_OK (cudaStreamCreate(&stream));
+
+    GpuTimer kernel_timer;
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    // when CUDA is enabled, no static headers are used in all of GraphBLAS
+    GrB_Info info ;
+    ASSERT (C != NULL && !(C->static_header)) ;
+    ASSERT (A != NULL && !(A->static_header)) ;
+    ASSERT (B != NULL && !(B->static_header)) ;
+
+    ASSERT_MATRIX_OK (A, "A for saxpy3 cuda A*B", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for saxpy3 cuda A*B", GB0) ;
+
+    ASSERT (!GB_PENDING (A)) ;
+    ASSERT (!GB_JUMBLED (A)) ;
+    ASSERT (!GB_ZOMBIES (A)) ;
+
+    ASSERT (!GB_PENDING (B)) ;
+    ASSERT (!GB_JUMBLED (B)) ;
+    ASSERT (!GB_ZOMBIES (B)) ;
+
+    ASSERT (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) ;
+    ASSERT (GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)) ;
+
+    ASSERT_SEMIRING_OK (semiring, "semiring for saxpy3 numeric A*B", GB0) ;
+
+    ASSERT (A->vdim == B->vlen) ;
+    GBURBLE ("(GPU saxpy3) ") ;
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    int64_t *Cwork = NULL   ; size_t Cwork_size = 0 ;
+    int64_t *Wf = NULL      ; size_t Wf_size  = 0 ;
+    GB_void *Wx = NULL      ; size_t Wx_size  = 0 ;
+    int64_t *Bucketp = NULL ; size_t Bup_size = 0 ;
+    int64_t *Bucket = NULL  ; size_t Bu_size  = 0 ;
+
+    int device = -1;
+
+    // FIXME: control the GPU to use via the descriptor
+    CU_OK (cudaSetDevice( 0 ));
+    CU_OK (cudaGetDevice(&device));
+
+    //--------------------------------------------------------------------------
+    // get A and B
+    //--------------------------------------------------------------------------
+
+    const int64_t cvlen = A->vlen ;
+    const int64_t cvdim = B->vdim ;
+    const int64_t bnvec = B->nvec ;
+    const bool B_is_hyper = GB_IS_HYPERSPARSE( B ) ;
+
+    // FUTURE: ctype need not be the op->ztype
+    GrB_Type ctype = semiring->add->op->ztype ;
+    const size_t zsize = ctype->size ;
+
+    //--------------------------------------------------------------------------
+    // allocate the workspace
+    //--------------------------------------------------------------------------
+
+    // one Gustavson slab (tags and accumulators, each of size cvlen) per
+    // resident threadblock
+    int number_of_sms = GB_Global_gpu_sm_get (0) ;
+    int nslabs = (int) GB_IMIN ((int64_t) (8 * number_of_sms),
+        GB_IMAX (bnvec, 1)) ;
+
+    Cwork = GB_MALLOC_WORK (bnvec+1, int64_t, &Cwork_size) ;
+    Wf = GB_MALLOC_WORK (nslabs * cvlen, int64_t, &Wf_size) ;
+    Wx = (GB_void *) GB_MALLOC_WORK (nslabs * cvlen * zsize, GB_void,
+        &Wx_size) ;
+    Bucketp = GB_MALLOC_WORK (NBUCKETS_SAXPY3+1, int64_t, &Bup_size) ;
+    Bucket = GB_MALLOC_WORK (GB_IMAX (bnvec, 1), int64_t, &Bu_size) ;
+
+    if (Cwork == NULL || Wf == NULL || Wx == NULL || Bucketp == NULL
+        || Bucket == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    // all slab tags start empty
+    CU_OK (cudaMemsetAsync (Wf, 0xFF, nslabs * cvlen * sizeof (int64_t),
+        stream)) ;
+
+    //--------------------------------------------------------------------------
+    // stringify the semiring
+    //--------------------------------------------------------------------------
+
+    GB_cuda_mxm_factory my_mxm_spec = GB_cuda_mxm_factory ( ) ;
+
+    // (1) create the mxm code and name; there is no mask
+    my_mxm_spec.mxm_factory ( false, false, C_sparsity, ctype,
+        NULL, false, false, semiring, flipxy, A, B) ;
+
+    // (2) ensure the jitifier has "GB_mxm_[my_mxm_spec.sr_code].h"
+    jit::GBJitCache filecache = jit::GBJitCache::Instance() ;
+    filecache.getFile (my_mxm_spec) ;
+
+    GBURBLE ("(GPU stringified srcode = %lu)\n", my_mxm_spec.sr_code) ;
+
+    //--------------------------------------------------------------------------
+    // prefetch A and B
+    //--------------------------------------------------------------------------
+
+    // FIXME: add acode, bcode to the GB_cuda_mxm_factory object
+    int acode = GB_RSHIFT (my_mxm_spec.sr_code, 12, 4) ;   // if 0: A is pattern
+    int bcode = GB_RSHIFT (my_mxm_spec.sr_code,  8, 4) ;   // if 0: B is pattern
+
+    bool A_is_pattern = (acode == 0) ;
+    bool B_is_pattern = (bcode == 0) ;
+
+    // prefetch A (if A hypersparse: using A->Y)
+    GB_OK (GB_cuda_matrix_prefetch (A, GB_PREFETCH_PYI +
+        (A_is_pattern ? 0 : GB_PREFETCH_X), device, stream)) ;
+
+    // prefetch B (if B hypersparse: using B->h, for the C hyperlist)
+    GB_OK (GB_cuda_matrix_prefetch (B, GB_PREFETCH_P + GB_PREFETCH_H +
+        GB_PREFETCH_I + (B_is_pattern ? 0 : GB_PREFETCH_X), device, stream)) ;
+
+    //--------------------------------------------------------------------------
+    // phase1: compute Cwork [kk] = nnz (C (:,j)) for each vector of B
+    //--------------------------------------------------------------------------
+
+    saxpy3_phase1launchFactory p1lf(my_mxm_spec);
+
+    GBURBLE ("(GPU phase1 start nblk = %d) ", nslabs) ;
+    kernel_timer.Start();
+    p1lf.jitGridBlockLaunch(Cwork, Wf, nslabs, A, B, stream);
+    CU_OK (cudaStreamSynchronize(stream));
+    kernel_timer.Stop();
+    GBURBLE ("(GPU phase1 done %12.6g ms )\n", kernel_timer.Elapsed()) ;
+
+    //--------------------------------------------------------------------------
+    // phase2: cumulative sum of Cwork to obtain C->p
+    //--------------------------------------------------------------------------
+
+    Cwork [bnvec] = 0 ;
+    GB_OK (GB_cuda_cumsum (Cwork, bnvec+1)) ;
+    CU_OK (cudaDeviceSynchronize ( )) ;
+    int64_t cnz = Cwork [bnvec] ;
+
+    GBURBLE ("(GPU phase2 done; cnz = %g) ", (double) cnz) ;
+
+    //--------------------------------------------------------------------------
+    // allocate C
+    //--------------------------------------------------------------------------
+
+    bool C_iso = false ;    // FIXME: pass in C_iso and cscalar
+    info = GB_new_bix (&C, // sparse or hyper (from B), existing header
+        ctype, cvlen, cvdim, GB_Ap_malloc, true,
+        C_sparsity, false, B->hyper_switch, bnvec,
+        GB_IMAX (cnz, 1), true, C_iso) ;
+
+    if (info != GrB_SUCCESS)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (info) ;
+    }
+
+    // copy the vector pointers (and hyperlist, if any, from B) into C
+    CU_OK (cudaMemcpyAsync (C->p, Cwork, (bnvec+1) * sizeof (int64_t),
+        cudaMemcpyDefault, stream)) ;
+    if (B_is_hyper)
+    {
+        CU_OK (cudaMemcpyAsync (C->h, B->h, bnvec * sizeof (int64_t),
+            cudaMemcpyDefault, stream)) ;
+    }
+
+    C->nvals = cnz ;
+    C->magic = GB_MAGIC ;
+    C->nvec_nonempty = -1 ;     // not yet known
+    C->jumbled = true ;         // the vectors of C are unordered
+
+    //--------------------------------------------------------------------------
+    // assign each vector of C to a bucket, by its entry count
+    //--------------------------------------------------------------------------
+
+    // Bucket [Bucketp [b] : Bucketp [b+1]-1] lists the vectors of bucket b,
+    // in ascending order (the phase3 kernels rely on the tags increasing
+    // within each slab)
+
+    int64_t nbucket [NBUCKETS_SAXPY3] = { 0, 0 } ;
+    for (int64_t kk = 0 ; kk < bnvec ; kk++)
+    {
+        int64_t cjnz = Cwork [kk+1] - Cwork [kk] ;
+        if (cjnz > 0)
+        {
+            nbucket [(cjnz <= GB_CUDA_SAXPY3_HASH_LIMIT) ?
+                GB_BUCKET_SAXPY3_HASH : GB_BUCKET_SAXPY3_GUSTAVSON]++ ;
+        }
+    }
+    Bucketp [0] = 0 ;
+    for (int b = 0 ; b < NBUCKETS_SAXPY3 ; b++)
+    {
+        Bucketp [b+1] = Bucketp [b] + nbucket [b] ;
+        nbucket [b] = Bucketp [b] ;
+    }
+    for (int64_t kk = 0 ; kk < bnvec ; kk++)
+    {
+        int64_t cjnz = Cwork [kk+1] - Cwork [kk] ;
+        if (cjnz > 0)
+        {
+            int b = (cjnz <= GB_CUDA_SAXPY3_HASH_LIMIT) ?
+                GB_BUCKET_SAXPY3_HASH : GB_BUCKET_SAXPY3_GUSTAVSON ;
+            Bucket [nbucket [b]++] = kk ;
+        }
+    }
+
+    // the slab tags from phase1 must not collide with the phase3 tags
+    CU_OK (cudaMemsetAsync (Wf, 0xFF, nslabs * cvlen * sizeof (int64_t),
+        stream)) ;
+
+    //--------------------------------------------------------------------------
+    // phase3: do the numerical work
+    //--------------------------------------------------------------------------
+
+    int64_t start = Bucketp [GB_BUCKET_SAXPY3_HASH] ;
+    int64_t end   = Bucketp [GB_BUCKET_SAXPY3_HASH + 1] ;
+    if (end - start > 0)
+    {
+        saxpy3_phase3_hash_launchFactory hlf(my_mxm_spec);
+        GBURBLE ("(GPU phase3 hash launch ) ") ;
+        kernel_timer.Start();
+        hlf.jitGridBlockLaunch(start, end, Bucket, C, A, B, stream);
+        CU_OK (cudaStreamSynchronize(stream));  // only for timing
+        kernel_timer.Stop();
+        GBURBLE ("(GPU phase3 hash done %12.6g ms, rate=%12.6g)\n",
+            kernel_timer.Elapsed(),
+            (end-start)/(1000*kernel_timer.Elapsed())) ;
+    }
+
+    start = Bucketp [GB_BUCKET_SAXPY3_GUSTAVSON] ;
+    end   = Bucketp [GB_BUCKET_SAXPY3_GUSTAVSON + 1] ;
+    if (end - start > 0)
+    {
+        saxpy3_phase3_gus_launchFactory glf(my_mxm_spec);
+        GBURBLE ("(GPU phase3 gustavson launch ) ") ;
+        kernel_timer.Start();
+        glf.jitGridBlockLaunch(start, end, Bucket, Wf, Wx, nslabs,
+            C, A, B, stream);
+        CU_OK (cudaStreamSynchronize(stream));  // only for timing
+        kernel_timer.Stop();
+        GBURBLE ("(GPU phase3 gustavson done %12.6g ms, rate=%12.6g)\n",
+            kernel_timer.Elapsed(),
+            (end-start)/(1000*kernel_timer.Elapsed())) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    return GrB_SUCCESS;
+}
@@ -0,0 +1,56 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_cuda_branch: decide if GPU should be used for saxpy3 mxm
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Decide branch direction for GPU use for the saxpy-style MxM, C=A*B with
+// no mask.  The GPU kernels handle only sparse or hypersparse A and B.
+
+#include "GraphBLAS.h"
+#undef I
+extern "C"
+{
+  #include "GB_mxm.h"
+}
+#include "GB_cuda.h"
+#include <cuda_runtime.h>
+
+bool GB_AxB_saxpy3_cuda_branch
+(
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy               // if true, do z=fmult(b,a) vs fmult(a,b)
+)
+{
+
+    if (!(GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) ||
+        !(GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)))
+    {
+        // the saxpy3 GPU kernels require A and B sparse or hypersparse
+        return (false) ;
+    }
+
+    if (!GB_cuda_type_branch (A->type) ||
+        !GB_cuda_type_branch (B->type) ||
+        !GB_cuda_type_branch (semiring->multiply->xtype) ||
+        !GB_cuda_type_branch (semiring->multiply->ytype) ||
+        !GB_cuda_type_branch (semiring->multiply->ztype))
+    {
+        // one or more types are not yet supported on the GPU
+        return (false) ;
+    }
+
+    // very rough estimate of the work to do: the flop count is about
+    // nnz(B) times the average degree of A
+    double adeg = ((double) GB_nnz (A)) / ((double) GB_IMAX (1, A->nvec)) ;
+    double work = ((double) GB_nnz (B)) * adeg ;
+
+    int ngpus_to_use = GB_ngpus_to_use (work) ;
+    GBURBLE (" work:%g GPUs:%d ", work, ngpus_to_use) ;
+    return (ngpus_to_use > 0) ;
+}
@@ -0,0 +1,58 @@
+//------------------------------------------------------------------------------
+// GB_apply_unop_cuda.cpp: Cx = op (A) on the GPU
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Apply a unary operator to the values of a matrix, Cx = op (A), entirely on
+// the GPU, where A is held as-if-full or bitmap and the operator does not
+// depend on the row or column index.  Only the values are computed; the
+// caller transplants the pattern of A into C.  Cx and A->x may be aliased.
+
+#include "GraphBLAS.h"
+#undef I
+extern "C"
+{
+    #include "GB_apply.h"
+}
+
+#include "GB_cuda.h"
+#include "GB_jit_cache.h"
+#include "GB_cuda_common_jitFactory.hpp"
+#include "GB_cuda_apply_jitFactory.hpp"
+#include "GB_cuda_type_wrap.hpp"
+
+GrB_Info GB_apply_unop_cuda     // Cx = op (A)
+(
+    // output:
+    GB_void *Cx,                // output array, of type op->ztype
+    // input:
+    const GrB_Type ctype,       // type of Cx
+    const GB_Operator op,       // unary operator to apply
+    const GrB_Matrix A          // input matrix, as-if-full or bitmap
+)
+{
+
+    // FIXME: use the stream pool
+    cudaStream_t stream ;
+    CHECK_CUDA (cudaStreamCreate (&stream)) ;
+
+    //--------------------------------------------------------------------------
+    // Cx = op (A)
+    //--------------------------------------------------------------------------
+
+    // FIXME: check error conditions (out of memory, etc)
+    GB_cuda_apply_factory myapplyfactory ;
+    myapplyfactory.apply_factory (ctype, op, A) ;
+
+    // FIXME: get GrB_Info result from GB_cuda_apply_unop
+    GB_cuda_apply_unop (myapplyfactory, Cx, A, stream) ;
+
+    CHECK_CUDA (cudaStreamSynchronize (stream)) ;
+    CHECK_CUDA (cudaStreamDestroy (stream)) ;
+
+    return (GrB_SUCCESS) ;
+}
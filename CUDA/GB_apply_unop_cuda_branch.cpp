@@ -0,0 +1,55 @@
+//------------------------------------------------------------------------------
+// GB_apply_unop_cuda_branch: when to use GPU for Cx = op (A)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Decide branch direction for GPU use when applying a unary operator to the
+// values of a matrix.
+
+#include "GB_cuda.h"
+
+bool GB_apply_unop_cuda_branch  // return true to use the GPU
+(
+    const GrB_Type ctype,       // type of the output array Cx
+    const GB_Operator op,       // operator to apply
+    const GrB_Matrix A          // input matrix
+)
+{
+
+    if (op == NULL || !GB_IS_UNARYOP_CODE (op->opcode))
+    {
+        // only plain unary operators are handled on the GPU; index-unary and
+        // bound binary operators are done on the CPU
+        return (false) ;
+    }
+
+    if (GB_OPCODE_IS_POSITIONAL (op->opcode))
+    {
+        // the kernel does not compute row/column indices; do it on the CPU
+        return (false) ;
+    }
+
+    if (!GB_cuda_type_branch (ctype) ||
+        !GB_cuda_type_branch (A->type) ||
+        !GB_cuda_type_branch (op->ztype))
+    {
+        // one or more types are not yet supported on the GPU
+        return (false) ;
+    }
+
+    if (A->iso)
+    {
+        // applying the op to an iso matrix takes O(1) time; use the CPU
+        return (false) ;
+    }
+
+    // see if there is enough work to do on the GPU
+    double work = GB_nnz_held (A) ;
+    int ngpus_to_use = GB_ngpus_to_use (work) ;
+    GBURBLE (" work:%g gpus:%d ", work, ngpus_to_use) ;
+    return (ngpus_to_use > 0) ;
+}
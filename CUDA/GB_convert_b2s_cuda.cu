@@ -0,0 +1,183 @@
+//------------------------------------------------------------------------------
+// GB_convert_b2s_cuda: convert bitmap to sparse on the GPU
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Gathers the entries of a bitmap matrix A into the sparse arrays Ap, Ai, and
+// Ax_new allocated by GB_convert_bitmap_to_sparse, entirely on the GPU.  The
+// method is deterministic: an exclusive scan (GB_cuda_cumsum) over the bitmap
+// gives each present entry its final position, so the rows within each vector
+// come out sorted, exactly as the CPU worker produces them.  The values are
+// moved as opaque blocks of asize bytes; if Ax_new is NULL (A is iso), only
+// the pattern is gathered.
+
+#include "GB_cuda.h"
+
+//------------------------------------------------------------------------------
+// device kernels
+//------------------------------------------------------------------------------
+
+// T [p] = (Ab [p] != 0), the flag array to be scanned
+__global__ void GB_b2s_flag_kernel
+(
+    int64_t *T,             // output, size anzmax+1
+    const int8_t *Ab,       // bitmap of A
+    int64_t anzmax
+)
+{
+    for (int64_t p = blockIdx.x * (int64_t) blockDim.x + threadIdx.x ;
+         p < anzmax ; p += (int64_t) gridDim.x * blockDim.x)
+    {
+        T [p] = (Ab [p] != 0) ;
+    }
+}
+
+// gather the row indices and values of the present entries
+__global__ void GB_b2s_gather_kernel
+(
+    int64_t *Ai,            // output row indices
+    GB_void *Ax_new,        // output values, or NULL if not moved
+    const int64_t *T,       // scanned flags: position of each entry
+    const int8_t *Ab,       // bitmap of A
+    const GB_void *Ax,      // values of A
+    int64_t anzmax,
+    int64_t avlen,
+    size_t asize
+)
+{
+    for (int64_t p = blockIdx.x * (int64_t) blockDim.x + threadIdx.x ;
+         p < anzmax ; p += (int64_t) gridDim.x * blockDim.x)
+    {
+        if (Ab [p])
+        {
+            int64_t pnew = T [p] ;
+            Ai [pnew] = p % avlen ;
+            if (Ax_new != NULL)
+            {
+                memcpy (Ax_new + pnew * asize, Ax + p * asize, asize) ;
+            }
+        }
+    }
+}
+
+// Ap [k] = T [k*avlen], and count the non-empty vectors
+__global__ void GB_b2s_pointers_kernel
+(
+    int64_t *Ap,            // output vector pointers, size avdim+1
+    int64_t *nonempty,      // # of non-empty vectors (a single value)
+    const int64_t *T,       // scanned flags, size anzmax+1
+    int64_t avdim,
+    int64_t avlen
+)
+{
+    for (int64_t k = blockIdx.x * (int64_t) blockDim.x + threadIdx.x ;
+         k <= avdim ; k += (int64_t) gridDim.x * blockDim.x)
+    {
+        Ap [k] = T [k * avlen] ;
+        if (k < avdim && T [k * avlen] < T [(k+1) * avlen])
+        {
+            atomicAdd ((unsigned long long *) nonempty, 1) ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_convert_b2s_cuda: gateway, called from GB_convert_bitmap_to_sparse
+//------------------------------------------------------------------------------
+
+GrB_Info GB_convert_b2s_cuda    // gather A into sparse form, on the GPU
+(
+    // output:
+    int64_t *Ap,            // vector pointers, size avdim+1
+    int64_t *Ai,            // row indices, size >= nvals(A)
+    GB_void *Ax_new,        // values, size >= nvals(A)*asize, or NULL if the
+                            // values are not moved (A iso)
+    int64_t *anvec_nonempty,    // # of non-empty vectors
+    // input:
+    const GrB_Matrix A      // matrix to convert; bitmap
+)
+{
+
+    ASSERT (Ap != NULL && Ai != NULL && anvec_nonempty != NULL) ;
+    ASSERT (GB_IS_BITMAP (A)) ;
+
+    const int64_t avdim = A->vdim ;
+    const int64_t avlen = A->vlen ;
+    const int64_t anzmax = avdim * avlen ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace: the flag/position array and the non-empty counter
+    //--------------------------------------------------------------------------
+
+    size_t T_size = 0, cnt_size = 0 ;
+    int64_t *T = (int64_t *) GB_malloc_memory (anzmax + 1, sizeof (int64_t),
+        &T_size) ;
+    int64_t *cnt = (int64_t *) GB_malloc_memory (1, sizeof (int64_t),
+        &cnt_size) ;
+    if (T == NULL || cnt == NULL)
+    {
+        GB_free_memory ((void **) &T, T_size) ;
+        GB_free_memory ((void **) &cnt, cnt_size) ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    (*cnt) = 0 ;
+    T [0] = 0 ;     // so an empty matrix yields Ap all zero
+
+    // FIXME: use the stream pool
+    cudaStream_t stream ;
+    CU_OK (cudaStreamCreate (&stream)) ;
+
+    int blocksz = 256 ;
+    int gridsz = (int) GB_IMIN ((anzmax + blocksz - 1) / blocksz, 65536) ;
+    gridsz = GB_IMAX (gridsz, 1) ;
+
+    //--------------------------------------------------------------------------
+    // T = cumsum (Ab != 0), the position of each present entry
+    //--------------------------------------------------------------------------
+
+    if (anzmax > 0)
+    {
+        GB_b2s_flag_kernel <<<gridsz, blocksz, 0, stream>>>
+            (T, A->b, anzmax) ;
+        CU_OK (cudaStreamSynchronize (stream)) ;
+    }
+
+    GrB_Info info = GB_cuda_cumsum (T, anzmax) ;
+    if (info != GrB_SUCCESS)
+    {
+        GB_free_memory ((void **) &T, T_size) ;
+        GB_free_memory ((void **) &cnt, cnt_size) ;
+        CU_OK (cudaStreamDestroy (stream)) ;
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // gather the entries and build the vector pointers
+    //--------------------------------------------------------------------------
+
+    if (anzmax > 0)
+    {
+        GB_b2s_gather_kernel <<<gridsz, blocksz, 0, stream>>>
+            (Ai, Ax_new, T, A->b, (const GB_void *) A->x, anzmax, avlen,
+             A->type->size) ;
+    }
+
+    int gridsz_p = (int) GB_IMIN ((avdim + blocksz) / blocksz, 65536) ;
+    gridsz_p = GB_IMAX (gridsz_p, 1) ;
+    GB_b2s_pointers_kernel <<<gridsz_p, blocksz, 0, stream>>>
+        (Ap, cnt, T, avdim, avlen) ;
+
+    CU_OK (cudaStreamSynchronize (stream)) ;
+    CU_OK (cudaStreamDestroy (stream)) ;
+
+    (*anvec_nonempty) = (*cnt) ;
+
+    GB_free_memory ((void **) &T, T_size) ;
+    GB_free_memory ((void **) &cnt, cnt_size) ;
+
+    return (GrB_SUCCESS) ;
+}
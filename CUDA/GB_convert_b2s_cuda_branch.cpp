@@ -0,0 +1,28 @@
+//------------------------------------------------------------------------------
+// GB_convert_b2s_cuda_branch: when to use the GPU to convert bitmap to sparse
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Decide branch direction for GPU use when converting a bitmap matrix to
+// sparse.  The gather applies no operator and moves values as opaque bytes,
+// so any type is handled.  The work is proportional to the whole bitmap
+// (every position is scanned, present or not), so that is the work measure.
+
+#include "GB_cuda.h"
+
+bool GB_convert_b2s_cuda_branch // return true to use the GPU
+(
+    const GrB_Matrix A          // bitmap matrix being converted to sparse
+)
+{
+
+    // see if there is enough work to do on the GPU
+    double work = ((double) A->vlen) * ((double) A->vdim) ;
+    int ngpus_to_use = GB_ngpus_to_use (work) ;
+    GBURBLE (" work:%g gpus:%d ", work, ngpus_to_use) ;
+    return (ngpus_to_use > 0) ;
+}
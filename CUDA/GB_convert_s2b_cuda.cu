@@ -0,0 +1,104 @@
+//------------------------------------------------------------------------------
+// GB_convert_s2b_cuda: convert sparse/hypersparse to bitmap on the GPU
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Scatters the pattern and values of a sparse or hypersparse matrix A into
+// the bitmap Ab and value array Ax_new allocated by GB_convert_s2b, entirely
+// on the GPU, so that a device-resident matrix is converted without migrating
+// its arrays to the host and back.  The values are moved as opaque blocks of
+// asize bytes, so any type (including user-defined) is handled; no typecast
+// or operator is applied.  If Ax_new is NULL (A is iso), only the pattern is
+// scattered.  Zombies are skipped; the caller adjusts A->nvals.
+
+#include "GB_cuda.h"
+
+//------------------------------------------------------------------------------
+// GB_convert_s2b_kernel: one thread per entry of A
+//------------------------------------------------------------------------------
+
+__global__ void GB_convert_s2b_kernel
+(
+    int8_t *Ab,             // output bitmap, already cleared
+    GB_void *Ax_new,        // output values, or NULL if A is iso
+    const GB_void *Ax,      // input values of A
+    const int64_t *Ap,      // vector pointers of A, size anvec+1
+    const int64_t *Ah,      // vector names of A, or NULL if A is sparse
+    const int64_t *Ai,      // row indices of A
+    int64_t anvec,          // # of vectors of A
+    int64_t avlen,          // vector length of A
+    int64_t anz,            // # of entries held in A, including zombies
+    size_t asize,           // size of each value, in bytes
+    bool has_zombies        // true if A has zombies
+)
+{
+    for (int64_t p = blockIdx.x * (int64_t) blockDim.x + threadIdx.x ;
+         p < anz ; p += (int64_t) gridDim.x * blockDim.x)
+    {
+        int64_t i = Ai [p] ;
+        if (has_zombies && i < 0)
+        {
+            // skip the zombie
+            continue ;
+        }
+        // binary search for the vector k containing the entry at position p
+        int64_t klo = 0, khi = anvec ;
+        while (khi - klo > 1)
+        {
+            int64_t kmid = (klo + khi) / 2 ;
+            if (Ap [kmid] <= p) { klo = kmid ; } else { khi = kmid ; }
+        }
+        int64_t j = (Ah == NULL) ? klo : Ah [klo] ;
+        int64_t pnew = i + j * avlen ;
+        Ab [pnew] = 1 ;
+        if (Ax_new != NULL)
+        {
+            memcpy (Ax_new + pnew * asize, Ax + p * asize, asize) ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_convert_s2b_cuda: gateway, called from GB_convert_s2b
+//------------------------------------------------------------------------------
+
+GrB_Info GB_convert_s2b_cuda    // scatter A into the bitmap, on the GPU
+(
+    // output:
+    GB_void *Ax_new,        // values of the bitmap, already cleared, or NULL
+                            // if A is iso and the values do not move
+    int8_t *Ab,             // bitmap, already cleared
+    // input:
+    const GrB_Matrix A      // matrix to convert; sparse or hypersparse
+)
+{
+
+    ASSERT (Ab != NULL) ;
+    ASSERT (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) ;
+
+    int64_t anz = GB_nnz_held (A) ;
+    if (anz == 0)
+    {
+        // nothing to scatter
+        return (GrB_SUCCESS) ;
+    }
+
+    // FIXME: use the stream pool
+    cudaStream_t stream ;
+    CU_OK (cudaStreamCreate (&stream)) ;
+
+    int blocksz = 256 ;
+    int gridsz = (int) GB_IMIN ((anz + blocksz - 1) / blocksz, 65536) ;
+    GB_convert_s2b_kernel <<<gridsz, blocksz, 0, stream>>>
+        (Ab, Ax_new, (const GB_void *) A->x, A->p, A->h, A->i,
+         A->nvec, A->vlen, anz, A->type->size, A->nzombies > 0) ;
+
+    CU_OK (cudaStreamSynchronize (stream)) ;
+    CU_OK (cudaStreamDestroy (stream)) ;
+
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,29 @@
+//------------------------------------------------------------------------------
+// GB_convert_s2b_cuda_branch: when to use the GPU to convert sparse to bitmap
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Decide branch direction for GPU use when converting a sparse or hypersparse
+// matrix to bitmap.  The conversion moves values as opaque bytes and applies
+// no operator, so any type is handled; the only question is whether there is
+// enough work to be worth launching a kernel, which keeps a device-resident
+// matrix on the device instead of migrating it to the host for the scatter.
+
+#include "GB_cuda.h"
+
+bool GB_convert_s2b_cuda_branch // return true to use the GPU
+(
+    const GrB_Matrix A          // matrix being converted to bitmap
+)
+{
+
+    // see if there is enough work to do on the GPU
+    double work = GB_nnz_held (A) ;
+    int ngpus_to_use = GB_ngpus_to_use (work) ;
+    GBURBLE (" work:%g gpus:%d ", work, ngpus_to_use) ;
+    return (ngpus_to_use > 0) ;
+}
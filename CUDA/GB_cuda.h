@@ -109,6 +109,7 @@ extern "C"
 #define GB_PREFETCH_PHI   (GB_PREFETCH_P + GB_PREFETCH_H + GB_PREFETCH_I)
 #define GB_PREFETCH_PHBI  (GB_PREFETCH_PHI + GB_PREFETCH_B)
 #define GB_PREFETCH_PHBIX (GB_PREFETCH_PHBI + GB_PREFETCH_X)
+#define GB_PREFETCH_ALL   (GB_PREFETCH_PHBIX + GB_PREFETCH_Y)
 
 GrB_Info GB_cuda_matrix_prefetch
 (
@@ -133,6 +134,32 @@ GrB_Info GB_cuda_matrix_advise
 ) ;
 #endif
 
+//------------------------------------------------------------------------------
+// hybrid CPU+GPU dot3: CPU worker for one bucket of C<M>=A'*B
+//------------------------------------------------------------------------------
+
+bool GB_cuda_dot3_cpu_bucket_ok
+(
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy               // if true, do z=fmult(b,a) vs fmult(a,b)
+) ;
+
+GrB_Info GB_cuda_dot3_cpu_bucket
+(
+    int64_t start,                  // first pair_id in the bucket
+    int64_t end,                    // one past the last pair_id in the bucket
+    const int64_t *Bucket,          // do the work in Bucket [start:end-1]
+    GrB_Matrix C,                   // output matrix, Cp and Ci pre-filled
+    const GrB_Matrix M,             // mask matrix
+    const GrB_Matrix A,             // input matrix, sparse or hypersparse
+    const GrB_Matrix B,             // input matrix, sparse or hypersparse
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    int64_t *cpu_nzombies           // # of zombies made by this worker
+) ;
+
 void GB_cuda_upscale_identity
 (
     GB_void *identity_upscaled,     // output: at least sizeof (uint16_t)
@@ -0,0 +1,111 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/CUDA/GB_cuda_apply_factory
+//------------------------------------------------------------------------------
+
+// Class to manage the stringify functions for a GrB_apply problem, writing
+// the problem-specific macros to a header file.
+
+// (c) Nvidia Corp. 2020 All rights reserved
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Implementations of string callbacks
+#pragma once
+
+#include <iostream>
+#include <cstdint>
+#include "GB_jit_cache.h"
+
+extern "C"
+{
+    #include "GB.h"
+    #include "GB_stringify.h"
+}
+
+//------------------------------------------------------------------------------
+// GB_cuda_apply_factory: construct code and header file for apply jit kernel
+//------------------------------------------------------------------------------
+
+class GB_cuda_apply_factory: public jit::File_Desc {
+
+public:
+
+    uint64_t acode ;        // unique encoding from GB_enumify_apply
+    GB_Operator op ;        // unary operator to apply
+    GrB_Type ctype ;        // output data type
+    GrB_Type atype ;        // input matrix data type
+    FILE *fp ;              // file pointer for GB_apply_*.h header file
+
+    //--------------------------------------------------------------------------
+    // open/close: access the GB_apply_*.h header file for a specific instance
+    //--------------------------------------------------------------------------
+
+    void open (const char *path_and_file, const char *mode)
+    {
+        fp = fopen (path_and_file, mode) ;
+    }
+
+    void close( )
+    {
+        fclose (fp) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // apply_factory: encode the apply problem into a scalar acode
+    //--------------------------------------------------------------------------
+
+    void apply_factory
+    (
+        GrB_Type ctype,     // type of the output array Cx
+        GB_Operator op,     // unary operator to apply
+        GrB_Matrix A        // input matrix
+    )
+    {
+        uint64_t acode ;
+
+        GB_enumify_apply
+        (
+                // output:
+                &acode,     // unique encoding of the entire operation
+                // input:
+                GxB_FULL,   // Cx = op (A), where Cx is just C->x
+                false,      // C_is_matrix is false: Cx = op (A)
+                ctype,      // type of the output array Cx
+                op,         // unary operator to apply; not a binaryop
+                false,      // do not flip i and j
+                A           // input matrix
+        ) ;
+
+        this->acode = acode ;
+        this->op = op ;
+        this->ctype = ctype ;
+        this->atype = A->type ;
+
+        // FIXME: use same name scheme as the CPU jit
+        std::stringstream ss ;
+        ss << "GB_apply_" << this->acode << ".h";
+
+        std::string new_filename = ss.str() ;
+        filename.resize(new_filename.size()) ;
+        strcpy(filename.data(), new_filename.data()) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // macrofy: construct a header file from the acode and data types
+    //--------------------------------------------------------------------------
+
+    void macrofy ( ) override
+    {
+        GB_macrofy_apply (
+            // output to file :
+            fp,
+            // input:
+            this->acode,
+            this->op,
+            this->ctype,
+            this->atype
+        ) ;
+    }
+
+} ; // GB_cuda_apply_factory
@@ -0,0 +1,150 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/CUDA/GB_cuda_apply_jitFactory.hpp: kernel for GrB_apply
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Constructs an instance of the template/GB_jit_apply_unop.cuh kernel to
+// compute Cx = op (A) for a unary operator that does not depend on the row or
+// column index, where A is held as-if-full or bitmap.  The pattern of C is
+// transplanted from A by the caller, so only the values are computed here.
+
+#ifndef GB_APPLY_JITFACTORY_H
+#define GB_APPLY_JITFACTORY_H
+
+#pragma once
+#include "GB_cuda_apply_factory.hpp"
+
+// Kernel jitifiers
+class applyUnopFactory ;
+
+//------------------------------------------------------------------------------
+// applyUnopFactory
+//------------------------------------------------------------------------------
+
+class applyUnopFactory
+{
+
+    //--------------------------------------------------------------------------
+    // class properties
+    //--------------------------------------------------------------------------
+
+    std::string base_name = "GB_jit";
+    std::string kernel_name = "apply_unop";
+
+    int threads_per_block = 256 ;
+    int work_per_thread = 8 ;
+
+    GB_cuda_apply_factory &apply_factory_ ;
+
+    public:
+
+    //--------------------------------------------------------------------------
+    // class constructor
+    //--------------------------------------------------------------------------
+
+    applyUnopFactory (GB_cuda_apply_factory &myapplyfactory) :
+        apply_factory_(myapplyfactory) {}
+
+    //--------------------------------------------------------------------------
+    // GB_get_threads_per_block: determine # of threads in a threadBlock
+    //--------------------------------------------------------------------------
+
+    int GB_get_threads_per_block ( )
+    {
+        return threads_per_block ;
+    }
+
+    //--------------------------------------------------------------------------
+    // GB_get_number_of_blocks: determine # of threadBlocks to use
+    //--------------------------------------------------------------------------
+
+    int GB_get_number_of_blocks
+    (
+        int64_t anz     // # of entries held in input matrix
+    )
+    {
+        // cap the number of blocks at 64K; the kernel loop is grid-strided
+        int64_t nblks = (anz + work_per_thread*threads_per_block - 1) /
+               (work_per_thread*threads_per_block) ;
+        return ((int) GB_IMIN (nblks, 64*1024)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // jitGridBlockLaunch:  construct and launch the GB_jit_apply_unop kernel
+    //--------------------------------------------------------------------------
+
+    bool jitGridBlockLaunch     // FIXME: return GrB_Info
+    (
+        GB_void *Cx,            // output array, of size anz * ctype->size
+        GrB_Matrix A,           // input matrix, as-if-full or bitmap
+        cudaStream_t stream = 0 // stream to use, default stream 0
+    )
+    {
+        GBURBLE ("\n(launch apply unop factory) \n") ;
+
+        jit::GBJitCache filecache = jit::GBJitCache::Instance() ;
+        filecache.getFile (apply_factory_) ;
+
+        auto acode = std::to_string(apply_factory_.acode);
+
+        std::string hashable_name = base_name + "_" + kernel_name;
+        std::stringstream string_to_be_jitted ;
+        string_to_be_jitted <<
+        hashable_name << std::endl <<
+        R"(#include "GB_cuda_kernel.h")" << std::endl <<
+        R"(#include ")" << jit::get_user_home_cache_dir() << "/"
+        << apply_factory_.filename << R"(")" << std::endl <<
+        R"(#include ")" << hashable_name << R"(.cuh")" << std::endl;
+
+        int64_t anz = GB_nnz_held (A) ;
+
+        // determine kernel launch geometry
+        int blocksz = GB_get_threads_per_block ( ) ;
+        int gridsz = GB_get_number_of_blocks (anz) ;
+        dim3 grid (gridsz) ;
+        dim3 block (blocksz) ;
+
+        GBURBLE ("(cuda apply launch %d threads in %d blocks)",
+            blocksz, gridsz ) ;
+
+        // construct and launch the kernel
+        jit::launcher(hashable_name + "_" + acode,
+                string_to_be_jitted.str(),
+                header_names,
+                GB_jit_cuda_compiler_flags,
+                file_callback)
+           .set_kernel_inst(  hashable_name ,
+                { apply_factory_.ctype->name, A->type->name })
+           .configure(grid, block, SMEM, stream)
+           .launch ((void *) Cx, A, anz) ;
+
+        CHECK_CUDA (cudaStreamSynchronize (stream)) ;
+
+        return (GrB_SUCCESS) ;
+    }
+} ;
+
+//------------------------------------------------------------------------------
+// GB_cuda_apply_unop
+//------------------------------------------------------------------------------
+
+inline bool GB_cuda_apply_unop      // FIXME: return GrB_Info, not bool
+(
+    GB_cuda_apply_factory &myapplyfactory,  // apply JIT factory
+    GB_void *Cx,                // output array
+    GrB_Matrix A,               // input matrix, as-if-full or bitmap
+    cudaStream_t stream = 0     // stream to use
+)
+{
+    applyUnopFactory af(myapplyfactory);
+    GBURBLE ("(starting cuda apply unop)" ) ;
+    bool result = af.jitGridBlockLaunch (Cx, A, stream) ;
+    GBURBLE ("(ending cuda apply unop)" ) ;
+    return (result) ;
+}
+
+#endif
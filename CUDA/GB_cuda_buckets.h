@@ -35,6 +35,26 @@ typedef enum
 }
 GB_bucket_code ;
 
+// saxpy3:  C=A*B, no mask; A and B are sparse or hyper, C is sparse or hyper
+// 2 buckets, one kernel launch each, decided per vector C(:,j) after the
+// symbolic phase1 has computed nnz (C (:,j)):
+
+#define NBUCKETS_SAXPY3 2
+
+// size of the shared-memory hash table in AxB_saxpy3_phase3_hash, and the
+// largest nnz (C (:,j)) it can hold (the load factor is kept at 1/2 or less)
+#define GB_CUDA_SAXPY3_HASH_SIZE  1024
+#define GB_CUDA_SAXPY3_HASH_LIMIT (GB_CUDA_SAXPY3_HASH_SIZE / 2)
+
+typedef enum
+{
+    // C(:,j) fits in the shared-memory hash table:
+    GB_BUCKET_SAXPY3_HASH = 0,
+    // C(:,j) needs a Gustavson slab of size cvlen in global memory:
+    GB_BUCKET_SAXPY3_GUSTAVSON = 1,
+}
+GB_saxpy3_bucket_code ;
+
 // These may use another bucket enum:
 
     // two full/(sparse,hyper) kernels:
@@ -0,0 +1,244 @@
+//------------------------------------------------------------------------------
+// GB_cuda_dot3_cpu_bucket: do one dot3 bucket on the CPU, hybrid with the GPU
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// CPU counterpart of the phase3 GPU kernels, used to overlap CPU and GPU
+// execution of C<M>=A'*B: while the GPU works on one bucket, the CPU computes
+// the entries of another bucket of the same C.  The protocol is the same as
+// the phase3 kernels: for each pair_id in Bucket [start:end-1], the row index
+// is i = Mi [pair_id] and the vector is k = Ci [pair_id] >> 4 (encoded by
+// phase2end); on output Ci [pair_id] = i with Cx [pair_id] = A(:,i)'*B(:,j),
+// or Ci [pair_id] = GB_FLIP (i) if the dot product has no entries.
+
+// The bucket entries touch disjoint positions of C, so the CPU and the GPU
+// kernel can run concurrently; the only shared scalar is C->nzombies, which
+// the GPU updates atomically.  The CPU zombie count is thus returned in
+// cpu_nzombies, for the caller to fold into C->nzombies after the stream has
+// been synchronized.
+
+// This worker is generic (function pointers, no type-specific kernels), so it
+// is only used for the vsvs bucket, where each dot product is very small and
+// the call overhead is negligible.  GB_cuda_dot3_cpu_bucket_ok checks the
+// cases it can handle: A and B sparse or hypersparse, no typecasting, no iso
+// inputs, and no positional multiply operator.
+
+#include "GB_cuda.h"
+extern "C"
+{
+    #include "GB_mxm.h"
+}
+
+//------------------------------------------------------------------------------
+// GB_cuda_dot3_cpu_bucket_ok: can the CPU worker handle this semiring?
+//------------------------------------------------------------------------------
+
+bool GB_cuda_dot3_cpu_bucket_ok
+(
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy               // if true, do z=fmult(b,a) vs fmult(a,b)
+)
+{
+    GrB_BinaryOp mult = semiring->multiply ;
+    if (GB_OPCODE_IS_POSITIONAL (mult->opcode))
+    {
+        // the generic worker does not handle positional operators
+        return (false) ;
+    }
+    if (A->iso || B->iso)
+    {
+        // no iso inputs
+        return (false) ;
+    }
+    if (!(GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) ||
+        !(GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)))
+    {
+        // both A and B must be sparse or hypersparse (the vsvs bucket)
+        return (false) ;
+    }
+    // no typecasting of the inputs or the result
+    return ((A->type == (flipxy ? mult->ytype : mult->xtype)) &&
+            (B->type == (flipxy ? mult->xtype : mult->ytype))) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_cuda_dot3_cpu_bucket: compute the entries of one bucket on the CPU
+//------------------------------------------------------------------------------
+
+GrB_Info GB_cuda_dot3_cpu_bucket
+(
+    int64_t start,                  // first pair_id in the bucket
+    int64_t end,                    // one past the last pair_id in the bucket
+    const int64_t *Bucket,          // do the work in Bucket [start:end-1]
+    GrB_Matrix C,                   // output matrix, Cp and Ci pre-filled
+    const GrB_Matrix M,             // mask matrix
+    const GrB_Matrix A,             // input matrix, sparse or hypersparse
+    const GrB_Matrix B,             // input matrix, sparse or hypersparse
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    int64_t *cpu_nzombies           // # of zombies made by this worker
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (GB_cuda_dot3_cpu_bucket_ok (A, B, semiring, flipxy)) ;
+    ASSERT (!GB_JUMBLED (A)) ;
+    ASSERT (!GB_JUMBLED (B)) ;
+
+    //--------------------------------------------------------------------------
+    // get the semiring operators
+    //--------------------------------------------------------------------------
+
+    GrB_BinaryOp mult = semiring->multiply ;
+    GrB_Monoid add = semiring->add ;
+    GxB_binary_function fmult = mult->binop_function ;
+    GxB_binary_function fadd  = add->op->binop_function ;
+    GB_void *identity = (GB_void *) add->identity ;
+    size_t asize = A->type->size ;
+    size_t bsize = B->type->size ;
+    size_t zsize = mult->ztype->size ;
+
+    //--------------------------------------------------------------------------
+    // get M, C, A, and B
+    //--------------------------------------------------------------------------
+
+    const int64_t *__restrict__ Mi = M->i ;
+    const int64_t *__restrict__ Mh = M->h ;
+          int64_t *__restrict__ Ci = C->i ;
+          GB_void *__restrict__ Cx = (GB_void *) C->x ;
+
+    const int64_t *__restrict__ Ap = A->p ;
+    const int64_t *__restrict__ Ai = A->i ;
+    const GB_void *__restrict__ Ax = (GB_void *) A->x ;
+    const bool A_is_hyper = GB_IS_HYPERSPARSE (A) ;
+
+    const int64_t *__restrict__ Bp = B->p ;
+    const int64_t *__restrict__ Bi = B->i ;
+    const GB_void *__restrict__ Bx = (GB_void *) B->x ;
+    const bool B_is_hyper = GB_IS_HYPERSPARSE (B) ;
+
+    const int64_t *__restrict__ A_Yp = (A_is_hyper) ? A->Y->p : NULL ;
+    const int64_t *__restrict__ A_Yi = (A_is_hyper) ? A->Y->i : NULL ;
+    const int64_t *__restrict__ A_Yx = (A_is_hyper) ?
+        (int64_t *) A->Y->x : NULL ;
+    const int64_t A_hash_bits = (A_is_hyper) ? (A->Y->vdim - 1) : 0 ;
+
+    const int64_t *__restrict__ B_Yp = (B_is_hyper) ? B->Y->p : NULL ;
+    const int64_t *__restrict__ B_Yi = (B_is_hyper) ? B->Y->i : NULL ;
+    const int64_t *__restrict__ B_Yx = (B_is_hyper) ?
+        (int64_t *) B->Y->x : NULL ;
+    const int64_t B_hash_bits = (B_is_hyper) ? (B->Y->vdim - 1) : 0 ;
+
+    //--------------------------------------------------------------------------
+    // determine the # of threads to use
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (end - start, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // compute each entry in the bucket
+    //--------------------------------------------------------------------------
+
+    int64_t nzombies = 0 ;
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1024) \
+        reduction(+:nzombies)
+    for (int64_t kk = start ; kk < end ; kk++)
+    {
+        int64_t pair_id = Bucket [kk] ;
+        int64_t i = Mi [pair_id] ;
+        int64_t k = Ci [pair_id] >> 4 ;
+
+        // j = k or j = Mh [k] if M is hypersparse
+        int64_t j = GBH (Mh, k) ;
+
+        // find A(:,i)
+        int64_t pA, pA_end ;
+        if (A_is_hyper)
+        {
+            GB_hyper_hash_lookup (Ap, A_Yp, A_Yi, A_Yx, A_hash_bits,
+                i, &pA, &pA_end) ;
+        }
+        else
+        {
+            pA     = Ap [i] ;
+            pA_end = Ap [i+1] ;
+        }
+
+        // find B(:,j)
+        int64_t pB, pB_end ;
+        if (B_is_hyper)
+        {
+            GB_hyper_hash_lookup (Bp, B_Yp, B_Yi, B_Yx, B_hash_bits,
+                j, &pB, &pB_end) ;
+        }
+        else
+        {
+            pB     = Bp [j] ;
+            pB_end = Bp [j+1] ;
+        }
+
+        // cij = A(:,i)'*B(:,j), via a merge of the two sorted index lists
+        GB_void cij [GB_VLA(zsize)] ;
+        GB_void t   [GB_VLA(zsize)] ;
+        memcpy (cij, identity, zsize) ;
+        bool cij_exists = false ;
+
+        while (pA < pA_end && pB < pB_end)
+        {
+            int64_t ia = Ai [pA] ;
+            int64_t ib = Bi [pB] ;
+            if (ia < ib)
+            {
+                pA++ ;
+            }
+            else if (ia > ib)
+            {
+                pB++ ;
+            }
+            else
+            {
+                // t = A(ia,i) * B(ia,j), and cij += t
+                if (flipxy)
+                {
+                    fmult (t, Bx + pB*bsize, Ax + pA*asize) ;
+                }
+                else
+                {
+                    fmult (t, Ax + pA*asize, Bx + pB*bsize) ;
+                }
+                fadd (cij, cij, t) ;
+                cij_exists = true ;
+                pA++ ;
+                pB++ ;
+            }
+        }
+
+        if (cij_exists)
+        {
+            // C(i,j) = cij
+            memcpy (Cx + pair_id*zsize, cij, zsize) ;
+            Ci [pair_id] = i ;
+        }
+        else
+        {
+            // C(i,j) is a zombie
+            Ci [pair_id] = GB_FLIP (i) ;
+            nzombies++ ;
+        }
+    }
+
+    (*cpu_nzombies) = nzombies ;
+    return (GrB_SUCCESS) ;
+}
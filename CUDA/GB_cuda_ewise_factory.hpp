@@ -0,0 +1,122 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/CUDA/GB_cuda_ewise_factory
+//------------------------------------------------------------------------------
+
+// Class to manage the stringify functions for an eWiseAdd/eWiseMult problem,
+// writing the problem-specific macros to a header file.
+
+// (c) Nvidia Corp. 2020 All rights reserved
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Implementations of string callbacks
+#pragma once
+
+#include <iostream>
+#include <cstdint>
+#include "GB_jit_cache.h"
+
+extern "C"
+{
+    #include "GB.h"
+    #include "GB_stringify.h"
+}
+
+//------------------------------------------------------------------------------
+// GB_cuda_ewise_factory: construct code and header file for ewise jit kernel
+//------------------------------------------------------------------------------
+
+class GB_cuda_ewise_factory: public jit::File_Desc {
+
+public:
+
+    uint64_t ecode ;        // unique encoding from GB_enumify_ewise
+    GrB_BinaryOp binaryop ; // binary operator to apply
+    GrB_Type ctype ;        // output matrix data type
+    GrB_Type atype ;        // first input matrix data type
+    GrB_Type btype ;        // second input matrix data type
+    FILE *fp ;              // file pointer for GB_ewise_*.h header file
+
+    //--------------------------------------------------------------------------
+    // open/close: access the GB_ewise_*.h header file for a specific instance
+    //--------------------------------------------------------------------------
+
+    void open (const char *path_and_file, const char *mode)
+    {
+        fp = fopen (path_and_file, mode) ;
+    }
+
+    void close( )
+    {
+        fclose (fp) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // ewise_factory: encode the ewise problem into a scalar ecode
+    //--------------------------------------------------------------------------
+
+    void ewise_factory
+    (
+        bool is_eWiseMult,      // if true, method is emult
+        GrB_Matrix C,           // output matrix
+        GrB_BinaryOp binaryop,  // binary operator to apply
+        GrB_Matrix A,           // first input matrix
+        GrB_Matrix B            // second input matrix
+    )
+    {
+        uint64_t ecode ;
+
+        GB_enumify_ewise
+        (
+                // output:
+                &ecode,         // unique encoding of the entire operation
+                // input:
+                is_eWiseMult,   // if true, method is emult
+                false,          // not eWiseUnion
+                false,          // C(i,j) = A(i,j) cannot bypass the op
+                false,          // C is not iso on output
+                false,          // C is not iso on input
+                GB_sparsity (C),
+                C->type,        // type of C
+                NULL,           // no mask
+                false, false,   // no mask, so struct/comp do not apply
+                binaryop,       // operator to apply
+                false,          // do not flip x and y
+                A, B
+        ) ;
+
+        this->ecode = ecode ;
+        this->binaryop = binaryop ;
+        this->ctype = C->type ;
+        this->atype = A->type ;
+        this->btype = B->type ;
+
+        // FIXME: use same name scheme as the CPU jit
+        std::stringstream ss ;
+        ss << "GB_ewise_" << this->ecode << ".h";
+
+        std::string new_filename = ss.str() ;
+        filename.resize(new_filename.size()) ;
+        strcpy(filename.data(), new_filename.data()) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // macrofy: construct a header file from the ecode and data types
+    //--------------------------------------------------------------------------
+
+    void macrofy ( ) override
+    {
+        GB_macrofy_ewise (
+            // output to file :
+            fp,
+            // input:
+            this->ecode,
+            this->binaryop,
+            this->ctype,
+            this->atype,
+            this->btype
+        ) ;
+    }
+
+} ; // GB_cuda_ewise_factory
@@ -0,0 +1,153 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/CUDA/GB_cuda_ewise_jitFactory.hpp: kernels for eWiseAdd/eWiseMult
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Constructs an instance of the template/GB_jit_ewise_dense.cuh kernel to
+// compute C = A (op) B where C, A, and B are all full.  When both inputs are
+// full, eWiseAdd and eWiseMult compute the same thing, so a single kernel
+// covers both families; the sparse/hypersparse cases (whose output pattern is
+// computed on the CPU) remain CPU-only for now.
+
+#ifndef GB_EWISE_JITFACTORY_H
+#define GB_EWISE_JITFACTORY_H
+
+#pragma once
+#include "GB_cuda_ewise_factory.hpp"
+
+// Kernel jitifiers
+class ewiseDenseFactory ;
+
+//------------------------------------------------------------------------------
+// ewiseDenseFactory
+//------------------------------------------------------------------------------
+
+class ewiseDenseFactory
+{
+
+    //--------------------------------------------------------------------------
+    // class properties
+    //--------------------------------------------------------------------------
+
+    std::string base_name = "GB_jit";
+    std::string kernel_name = "ewise_dense";
+
+    int threads_per_block = 256 ;
+    int work_per_thread = 8 ;
+
+    GB_cuda_ewise_factory &ewise_factory_ ;
+
+    public:
+
+    //--------------------------------------------------------------------------
+    // class constructor
+    //--------------------------------------------------------------------------
+
+    ewiseDenseFactory (GB_cuda_ewise_factory &myewisefactory) :
+        ewise_factory_(myewisefactory) {}
+
+    //--------------------------------------------------------------------------
+    // GB_get_threads_per_block: determine # of threads in a threadBlock
+    //--------------------------------------------------------------------------
+
+    int GB_get_threads_per_block ( )
+    {
+        return threads_per_block ;
+    }
+
+    //--------------------------------------------------------------------------
+    // GB_get_number_of_blocks: determine # of threadBlocks to use
+    //--------------------------------------------------------------------------
+
+    int GB_get_number_of_blocks
+    (
+        int64_t cnz     // # of entries in output matrix
+    )
+    {
+        // cap the number of blocks at 64K; the kernel loop is grid-strided
+        int64_t nblks = (cnz + work_per_thread*threads_per_block - 1) /
+               (work_per_thread*threads_per_block) ;
+        return ((int) GB_IMIN (nblks, 64*1024)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // jitGridBlockLaunch:  construct and launch the GB_jit_ewise_dense kernel
+    //--------------------------------------------------------------------------
+
+    bool jitGridBlockLaunch     // FIXME: return GrB_Info
+    (
+        GrB_Matrix C,           // output matrix, full
+        GrB_Matrix A,           // first input matrix, full
+        GrB_Matrix B,           // second input matrix, full
+        cudaStream_t stream = 0 // stream to use, default stream 0
+    )
+    {
+        GBURBLE ("\n(launch ewise dense factory) \n") ;
+
+        jit::GBJitCache filecache = jit::GBJitCache::Instance() ;
+        filecache.getFile (ewise_factory_) ;
+
+        auto ecode = std::to_string(ewise_factory_.ecode);
+
+        std::string hashable_name = base_name + "_" + kernel_name;
+        std::stringstream string_to_be_jitted ;
+        string_to_be_jitted <<
+        hashable_name << std::endl <<
+        R"(#include "GB_cuda_kernel.h")" << std::endl <<
+        R"(#include ")" << jit::get_user_home_cache_dir() << "/"
+        << ewise_factory_.filename << R"(")" << std::endl <<
+        R"(#include ")" << hashable_name << R"(.cuh")" << std::endl;
+
+        int64_t cnz = GB_nnz_held (C) ;
+
+        // determine kernel launch geometry
+        int blocksz = GB_get_threads_per_block ( ) ;
+        int gridsz = GB_get_number_of_blocks (cnz) ;
+        dim3 grid (gridsz) ;
+        dim3 block (blocksz) ;
+
+        GBURBLE ("(cuda ewise launch %d threads in %d blocks)",
+            blocksz, gridsz ) ;
+
+        // construct and launch the kernel
+        jit::launcher(hashable_name + "_" + ecode,
+                string_to_be_jitted.str(),
+                header_names,
+                GB_jit_cuda_compiler_flags,
+                file_callback)
+           .set_kernel_inst(  hashable_name ,
+                { C->type->name, A->type->name, B->type->name })
+           .configure(grid, block, SMEM, stream)
+           .launch (C, A, B, cnz) ;
+
+        CHECK_CUDA (cudaStreamSynchronize (stream)) ;
+
+        return (GrB_SUCCESS) ;
+    }
+} ;
+
+//------------------------------------------------------------------------------
+// GB_cuda_ewise_dense
+//------------------------------------------------------------------------------
+
+inline bool GB_cuda_ewise_dense     // FIXME: return GrB_Info, not bool
+(
+    GB_cuda_ewise_factory &myewisefactory,  // ewise JIT factory
+    GrB_Matrix C,               // output matrix, full
+    GrB_Matrix A,               // first input matrix, full
+    GrB_Matrix B,               // second input matrix, full
+    cudaStream_t stream = 0     // stream to use
+)
+{
+    ewiseDenseFactory ef(myewisefactory);
+    GBURBLE ("(starting cuda ewise dense)" ) ;
+    bool result = ef.jitGridBlockLaunch (C, A, B, stream) ;
+    GBURBLE ("(ending cuda ewise dense)" ) ;
+    return (result) ;
+}
+
+#endif
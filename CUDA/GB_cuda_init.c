@@ -33,15 +33,23 @@ GrB_Info GB_cuda_init (void)
     // initialize RMM if necessary
     if (!rmm_wrap_is_initialized ())
     {
+        // The pool starts small and grows on demand, so it need not be
+        // oversized up front to avoid mid-run failure: the initial size is
+        // 1/16 of the device memory (at least 256 MB) and the maximum is
+        // half the device memory, leaving room for other processes.  The
+        // GRAPHBLAS_POOL_INIT_SIZE and GRAPHBLAS_POOL_MAX_SIZE environment
+        // variables (in bytes) override these defaults, and the cap can be
+        // changed at run time with rmm_wrap_set_limit.
+        size_t gpu_memory = GB_Global_gpu_memorysize_get (0) ;
+        size_t init_pool_size = GB_IMAX (gpu_memory / 16, 256 * 1000000L) ;
+        size_t max_pool_size = gpu_memory / 2 ;
+        char *env = getenv ("GRAPHBLAS_POOL_INIT_SIZE") ;
+        if (env != NULL) init_pool_size = (size_t) strtoull (env, NULL, 10) ;
+        env = getenv ("GRAPHBLAS_POOL_MAX_SIZE") ;
+        if (env != NULL) max_pool_size = (size_t) strtoull (env, NULL, 10) ;
+        init_pool_size = GB_IMIN (init_pool_size, max_pool_size) ;
         rmm_wrap_initialize_all_same (rmm_wrap_managed,
-            // FIXME ask the GPU(s) for good default values.  This might be
-            // found by GB_cuda_init.  Perhaps GB_cuda_init needs to be split
-            // into 2 methods: one to query the sizes(s) of the GPU(s) then
-            // call rmm_wrap_initialize_all_same, and the other for the rest
-            // of the work.  Alternatively, move GB_cuda_init here (if so,
-            // ensure that it doesn't depend on any other initializations
-            // below).
-            256 * 1000000L, 256 * 100000000L, 1) ;
+            init_pool_size, max_pool_size, 1) ;
     }
 
     // warm up the GPUs
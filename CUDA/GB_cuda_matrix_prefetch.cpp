@@ -58,3 +58,96 @@ GrB_Info GB_cuda_matrix_prefetch
     return (GrB_SUCCESS) ;
 }
 
+
+//------------------------------------------------------------------------------
+// GB_cuda_matrix_prefetch_all: gateway for GxB_Matrix_prefetch
+//------------------------------------------------------------------------------
+
+// Prefetch every array the matrix holds, on a user-provided stream.  The
+// prefetch is asynchronous: it is ordered on the stream and this function
+// does not synchronize, so the migration of one matrix can overlap kernels
+// on another stream, or computation on the CPU.
+
+GrB_Info GB_cuda_matrix_prefetch_all    // async prefetch all arrays of A
+(
+    GrB_Matrix A,                   // matrix to prefetch
+    int device,                     // GPU id to prefetch to, or < 0 for CPU
+    void *stream                    // cudaStream_t, or NULL for the default
+)
+{
+    if (device < 0)
+    {
+        device = cudaCpuDeviceId ;
+    }
+    return (GB_cuda_matrix_prefetch (A, GB_PREFETCH_ALL, device,
+        (cudaStream_t) stream)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_cuda_matrix_pin_device: pin the arrays of a matrix on a GPU
+//------------------------------------------------------------------------------
+
+// Gateway for GxB_Matrix_Option_set (A, GxB_MATRIX_GPU_ID, device): advise
+// the unified-memory driver to keep the arrays of A resident on the given
+// GPU, and map (rather than migrate) the pages when the CPU touches them.
+// This avoids the per-call page-fault migration storms that otherwise occur
+// when a matrix is used by thousands of consecutive kernel launches with
+// occasional CPU access in between.  A device < 0 removes the advice, so the
+// pages migrate freely again (the default policy for managed memory).
+
+static GrB_Info GB_pin_array
+(
+    void *p,                // array to pin or unpin; may be NULL
+    size_t size,            // size of the array, in bytes
+    int device,             // GPU device id, if pinning
+    bool pin                // if true, pin the array; if false, unpin it
+)
+{
+    if (p == NULL || size == 0)
+    {
+        return (GrB_SUCCESS) ;
+    }
+    if (pin)
+    {
+        CU_OK (cudaMemAdvise (p, size,
+            cudaMemAdviseSetPreferredLocation, device)) ;
+        CU_OK (cudaMemAdvise (p, size,
+            cudaMemAdviseSetAccessedBy, cudaCpuDeviceId)) ;
+        // migrate the array now, so the kernels that follow start warm
+        CU_OK (cudaMemPrefetchAsync (p, size, device, NULL)) ;
+    }
+    else
+    {
+        CU_OK (cudaMemAdvise (p, size,
+            cudaMemAdviseUnsetPreferredLocation, device)) ;
+        CU_OK (cudaMemAdvise (p, size,
+            cudaMemAdviseUnsetAccessedBy, cudaCpuDeviceId)) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+GrB_Info GB_cuda_matrix_pin_device      // pin the arrays of A on a GPU
+(
+    GrB_Matrix A,                   // matrix to pin (or unpin, if device < 0)
+    int device                      // GPU id, or < 0 to let A migrate freely
+)
+{
+    GrB_Info info ;
+    const bool pin = (device >= 0) ;
+    const int64_t anvec = A->nvec ;
+    const int64_t anz = GB_nnz_held (A) ;
+
+    GB_OK (GB_pin_array (A->p, (anvec+1) * sizeof (int64_t), device, pin)) ;
+    GB_OK (GB_pin_array (A->h, anvec * sizeof (int64_t), device, pin)) ;
+    if (A->Y != NULL)
+    {
+        // pin the hyper_hash: A->Y->p, A->Y->i, and A->Y->x
+        GB_OK (GB_cuda_matrix_pin_device (A->Y, device)) ;
+    }
+    GB_OK (GB_pin_array (A->b, anz * sizeof (int8_t), device, pin)) ;
+    GB_OK (GB_pin_array (A->i, anz * sizeof (int64_t), device, pin)) ;
+    GB_OK (GB_pin_array (A->x, (A->iso ? 1 : anz) * A->type->size,
+        device, pin)) ;
+
+    return (GrB_SUCCESS) ;
+}
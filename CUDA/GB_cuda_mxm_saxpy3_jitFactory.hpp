@@ -0,0 +1,209 @@
+//------------------------------------------------------------------------------
+// GB_cuda_mxm_saxpy3_jitFactory
+//------------------------------------------------------------------------------
+
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Launch factories for the saxpy-style C=A*B on the GPU, with no mask.  The
+// kernels are the push-style counterpart of the dot3 factories in
+// GB_cuda_mxm_dot3_jitFactory.hpp: phase1 computes nnz (C (:,j)) for each
+// vector of B with a Gustavson scatter slab per threadblock, and phase3 does
+// the numeric work, with one kernel per bucket (shared-memory hash table for
+// small vectors, global Gustavson slab for large ones).
+
+#ifndef GB_MXM_SAXPY3_JITFACTORY_H
+#define GB_MXM_SAXPY3_JITFACTORY_H
+
+#pragma once
+
+#include "GB_cuda_buckets.h"
+
+//------------------------------------------------------------------------------
+// saxpy3: saxpy3_phase1launchFactory
+//------------------------------------------------------------------------------
+
+class saxpy3_phase1launchFactory
+{
+  std::string kernel_name = "GB_jit_AxB_saxpy3_phase1";
+
+  GB_cuda_mxm_factory &mxm_factory_;
+
+public:
+
+  int get_threads_per_block() {
+      return 128;
+  }
+
+  // This assumes the needed state on the GB_cuda_mxm_factory
+  // has already been populated
+  saxpy3_phase1launchFactory(GB_cuda_mxm_factory &mxm_factory):
+      mxm_factory_(mxm_factory){}
+
+  bool jitGridBlockLaunch(int64_t *Cwork, int64_t *Wf, int nslabs,
+                          GrB_Matrix A, GrB_Matrix B, cudaStream_t stream = 0) {
+
+    // one Gustavson scatter slab per threadblock, so the grid size is the
+    // slab count chosen by the caller
+    jit::GBJitCache filecache = jit::GBJitCache::Instance() ;
+    filecache.getFile (mxm_factory_) ;
+
+    auto sr_code_str = std::to_string(mxm_factory_.sr_code) ;
+    std::vector<std::string> template_types = { sr_code_str };
+
+    std::stringstream string_to_be_jitted ;
+    string_to_be_jitted << kernel_name << std::endl <<
+    R"(#include "GB_cuda_kernel.h")" << std::endl <<
+    R"(#include ")" << jit::get_user_home_cache_dir() << "/" << mxm_factory_.filename << R"(")" << std::endl <<
+    R"(#include "templates/)" << kernel_name << R"(.cuh")" << std::endl;
+
+    bool result = false;
+
+    dim3 grid(nslabs);
+    dim3 block(get_threads_per_block());
+
+    jit::launcher( kernel_name + "_" + sr_code_str + ".jtfy",
+                   string_to_be_jitted.str(),
+                   header_names,
+                   GB_jit_cuda_compiler_flags,
+                   file_callback)
+                 .set_kernel_inst(  kernel_name, template_types)
+                 .configure(grid, block, SMEM, stream)
+                 .launch( Cwork, Wf, A, B);
+
+      result = true;
+
+      return result;
+     }
+};
+
+//------------------------------------------------------------------------------
+// saxpy3: saxpy3_phase3_hash_launchFactory
+//------------------------------------------------------------------------------
+
+class saxpy3_phase3_hash_launchFactory
+{
+  std::string kernel_name = "GB_jit_AxB_saxpy3_phase3_hash";
+
+  GB_cuda_mxm_factory &mxm_factory_;
+
+public:
+
+  int get_threads_per_block() {
+      return 128;
+  }
+
+  int get_number_of_blocks(int64_t nvectors) {
+      int number_of_sms = GB_Global_gpu_sm_get (0);
+      return GB_IMIN ((int64_t) (8 * number_of_sms), nvectors) ;
+  }
+
+  saxpy3_phase3_hash_launchFactory(GB_cuda_mxm_factory &mxm_factory):
+      mxm_factory_(mxm_factory){}
+
+  bool jitGridBlockLaunch(int64_t start, int64_t end, int64_t *Bucket,
+                          GrB_Matrix C, GrB_Matrix A, GrB_Matrix B,
+                          cudaStream_t stream = 0) {
+
+    jit::GBJitCache filecache = jit::GBJitCache::Instance() ;
+    filecache.getFile (mxm_factory_) ;
+
+    auto sr_code_str = std::to_string(mxm_factory_.sr_code) ;
+    GrB_BinaryOp mult = mxm_factory_.semiring->multiply ;
+    std::vector<std::string> template_types =
+    {
+        C->type->name, A->type->name, B->type->name,
+        mult->ztype->name, sr_code_str
+    };
+
+    std::stringstream string_to_be_jitted ;
+    string_to_be_jitted << kernel_name << std::endl <<
+    R"(#include "GB_cuda_kernel.h")" << std::endl <<
+    R"(#include ")" << jit::get_user_home_cache_dir() << "/" << mxm_factory_.filename << R"(")" << std::endl <<
+    R"(#include "templates/)" << kernel_name << R"(.cuh")" << std::endl;
+
+    bool result = false;
+
+    dim3 grid(get_number_of_blocks(end - start));
+    dim3 block(get_threads_per_block());
+
+    jit::launcher( kernel_name + "_" + sr_code_str + ".jtfy",
+                   string_to_be_jitted.str(),
+                   header_names,
+                   GB_jit_cuda_compiler_flags,
+                   file_callback)
+                 .set_kernel_inst(  kernel_name, template_types)
+                 .configure(grid, block, SMEM, stream)
+                 .launch( start, end, Bucket, C, A, B);
+
+      result = true;
+
+      return result;
+     }
+};
+
+//------------------------------------------------------------------------------
+// saxpy3: saxpy3_phase3_gus_launchFactory
+//------------------------------------------------------------------------------
+
+class saxpy3_phase3_gus_launchFactory
+{
+  std::string kernel_name = "GB_jit_AxB_saxpy3_phase3_gus";
+
+  GB_cuda_mxm_factory &mxm_factory_;
+
+public:
+
+  int get_threads_per_block() {
+      return 128;
+  }
+
+  saxpy3_phase3_gus_launchFactory(GB_cuda_mxm_factory &mxm_factory):
+      mxm_factory_(mxm_factory){}
+
+  bool jitGridBlockLaunch(int64_t start, int64_t end, int64_t *Bucket,
+                          int64_t *Wf, void *Wx, int nslabs,
+                          GrB_Matrix C, GrB_Matrix A, GrB_Matrix B,
+                          cudaStream_t stream = 0) {
+
+    // one Gustavson slab per threadblock, so the grid size is the slab
+    // count chosen by the caller
+    jit::GBJitCache filecache = jit::GBJitCache::Instance() ;
+    filecache.getFile (mxm_factory_) ;
+
+    auto sr_code_str = std::to_string(mxm_factory_.sr_code) ;
+    GrB_BinaryOp mult = mxm_factory_.semiring->multiply ;
+    std::vector<std::string> template_types =
+    {
+        C->type->name, A->type->name, B->type->name,
+        mult->ztype->name, sr_code_str
+    };
+
+    std::stringstream string_to_be_jitted ;
+    string_to_be_jitted << kernel_name << std::endl <<
+    R"(#include "GB_cuda_kernel.h")" << std::endl <<
+    R"(#include ")" << jit::get_user_home_cache_dir() << "/" << mxm_factory_.filename << R"(")" << std::endl <<
+    R"(#include "templates/)" << kernel_name << R"(.cuh")" << std::endl;
+
+    bool result = false;
+
+    dim3 grid(GB_IMIN ((int64_t) nslabs, end - start));
+    dim3 block(get_threads_per_block());
+
+    jit::launcher( kernel_name + "_" + sr_code_str + ".jtfy",
+                   string_to_be_jitted.str(),
+                   header_names,
+                   GB_jit_cuda_compiler_flags,
+                   file_callback)
+                 .set_kernel_inst(  kernel_name, template_types)
+                 .configure(grid, block, SMEM, stream)
+                 .launch( start, end, Bucket, Wf, Wx, C, A, B);
+
+      result = true;
+
+      return result;
+     }
+};
+
+#endif
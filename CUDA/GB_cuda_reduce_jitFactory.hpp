@@ -166,7 +166,6 @@ class reduceFactory
             // the kernel launch can reduce A to zscalar all by itself
             // allocate and initialize zscalar (upscaling it to at least 32 bits)
             size_t zscalar_size = GB_IMAX (zsize, sizeof (uint32_t)) ;
-            (GB_void *) rmm_wrap_malloc (zscalar_size) ;
             zscalar = (GB_void *) rmm_wrap_malloc (zscalar_size) ;
             if (zscalar == NULL)
             {
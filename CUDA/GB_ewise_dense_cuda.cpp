@@ -0,0 +1,59 @@
+//------------------------------------------------------------------------------
+// GB_ewise_dense_cuda.cpp: C = A (op) B on the GPU, all matrices full
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Compute C = A (op) B entirely on the GPU, where C, A, and B are all full
+// and no typecasting is needed.  When both inputs are full, eWiseAdd and
+// eWiseMult compute the same result, so this single gateway serves both
+// families.  The kernel is a grid-stride elementwise loop; no pattern
+// computation is needed, so device-resident data never migrates to the CPU.
+
+#include "GraphBLAS.h"
+#undef I
+extern "C"
+{
+    #include "GB_ewise.h"
+}
+
+#include "GB_cuda.h"
+#include "GB_jit_cache.h"
+#include "GB_cuda_common_jitFactory.hpp"
+#include "GB_cuda_ewise_jitFactory.hpp"
+#include "GB_cuda_type_wrap.hpp"
+
+GrB_Info GB_ewise_dense_cuda    // C = A (op) B, all 3 matrices full
+(
+    // input/output:
+    GrB_Matrix C,               // output matrix, full, not iso
+    // input:
+    const GrB_BinaryOp op,      // binary operator to apply
+    const GrB_Matrix A,         // first input matrix, full
+    const GrB_Matrix B          // second input matrix, full
+)
+{
+
+    // FIXME: use the stream pool
+    cudaStream_t stream ;
+    CHECK_CUDA (cudaStreamCreate (&stream)) ;
+
+    //--------------------------------------------------------------------------
+    // C = A (op) B
+    //--------------------------------------------------------------------------
+
+    // FIXME: check error conditions (out of memory, etc)
+    GB_cuda_ewise_factory myewisefactory ;
+    myewisefactory.ewise_factory (false, C, op, A, B) ;
+
+    // FIXME: get GrB_Info result from GB_cuda_ewise_dense
+    GB_cuda_ewise_dense (myewisefactory, C, A, B, stream) ;
+
+    CHECK_CUDA (cudaStreamSynchronize (stream)) ;
+    CHECK_CUDA (cudaStreamDestroy (stream)) ;
+
+    return (GrB_SUCCESS) ;
+}
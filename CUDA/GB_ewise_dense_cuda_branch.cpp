@@ -0,0 +1,45 @@
+//------------------------------------------------------------------------------
+// GB_ewise_dense_cuda_branch: when to use GPU for dense C = A (op) B
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Decide branch direction for GPU use for C = A (op) B where all three
+// matrices are full.  The caller has already ruled out masks, typecasting,
+// iso inputs, and bitmap matrices.
+
+#include "GB_cuda.h"
+
+bool GB_ewise_dense_cuda_branch // return true to use the GPU
+(
+    const GrB_Matrix C,         // output matrix, full
+    const GrB_BinaryOp op,      // binary operator to apply
+    const GrB_Matrix A,         // first input matrix, full
+    const GrB_Matrix B          // second input matrix, full
+)
+{
+
+    if (!GB_cuda_type_branch (C->type) ||
+        !GB_cuda_type_branch (A->type) ||
+        !GB_cuda_type_branch (B->type) ||
+        !GB_cuda_type_branch (op->ztype))
+    {
+        // one or more types are not yet supported on the GPU
+        return (false) ;
+    }
+
+    if (GB_OPCODE_IS_POSITIONAL (op->opcode))
+    {
+        // the kernel does not compute row/column indices; do it on the CPU
+        return (false) ;
+    }
+
+    // see if there is enough work to do on the GPU
+    double work = GB_nnz_held (C) ;
+    int ngpus_to_use = GB_ngpus_to_use (work) ;
+    GBURBLE (" work:%g gpus:%d ", work, ngpus_to_use) ;
+    return (ngpus_to_use > 0) ;
+}
@@ -7,12 +7,17 @@
 
 //------------------------------------------------------------------------------
 
-// Reduce a matrix A to a scalar s, or to a smaller matrix V if the GPU was
-// only able to do a partial reduction.  This case occurs if the GPU does not
-// cannot do an atomic update for the monoid.  To handle this case, the GPU
-// returns a full GrB_Matrix V, of size gridsize-by-1, with one entry per
-// threadblock.  Then GB_reduce_to_scalar on the CPU sees this V as the result,
-// and calls itself recursively to continue the reduction.
+// Reduce a matrix A to a scalar s, entirely on the GPU.  Each threadblock of
+// the GB_jit_reduce kernel reduces its part of the matrix to a single scalar
+// with a warp-shuffle tree reduction, and the per-block results are combined
+// with a device-wide atomic when the monoid has one.  If the monoid cannot be
+// done with an atomic update, the kernel instead returns a full GrB_Matrix V,
+// of size gridsize-by-1, with one entry per threadblock; the same kernel is
+// then cascaded on V, each launch shrinking it by the block reduction factor,
+// until a single entry remains.  The cascade keeps every intermediate result
+// on the device, so monoids without an atomic (including the MIN, MAX, and
+// ANY monoids on types with no native atomic) no longer fall back to a CPU
+// reduction of the partial result.
 
 #include "GraphBLAS.h"
 #undef I
@@ -53,7 +58,37 @@ GrB_Info GB_reduce_to_scalar_cuda
     myreducefactory.reduce_factory (monoid, A) ;
 
     // FIXME: get GrB_Info result from GB_cuda_reduce
-    GB_cuda_reduce (myreducefactory, A, s, V_handle, monoid, stream) ;
+    GrB_Matrix V = NULL ;
+    GB_cuda_reduce (myreducefactory, A, s, &V, monoid, stream) ;
+
+    //--------------------------------------------------------------------------
+    // cascade the reduction on the partial result, if any
+    //--------------------------------------------------------------------------
+
+    // If the monoid has no CUDA atomic, the kernel returns the per-block
+    // partial results in V.  Reduce V with the same kernel until a single
+    // entry remains; V is full with no zombies and of type ztype, so each
+    // cascaded launch shrinks it by the block reduction factor.
+
+    while (V != NULL)
+    {
+        if (GB_nnz_held (V) == 1)
+        {
+            // the reduction is complete; the scalar is the single entry of V
+            CHECK_CUDA (cudaStreamSynchronize (stream)) ;
+            memcpy (s, V->x, monoid->op->ztype->size) ;
+            GB_Matrix_free (&V) ;
+            break ;
+        }
+        GrB_Matrix Vnext = NULL ;
+        GB_cuda_reduce_factory vreducefactory ;
+        vreducefactory.reduce_factory (monoid, V) ;
+        GB_cuda_reduce (vreducefactory, V, s, &Vnext, monoid, stream) ;
+        GB_Matrix_free (&V) ;
+        V = Vnext ;
+    }
+
+    (*V_handle) = NULL ;
 
     CHECK_CUDA (cudaStreamSynchronize (stream)) ;
     CHECK_CUDA (cudaStreamDestroy (stream)) ;
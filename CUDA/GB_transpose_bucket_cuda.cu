@@ -0,0 +1,209 @@
+//------------------------------------------------------------------------------
+// GB_transpose_bucket_cuda: bucket transpose on the GPU
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C = A' where A is sparse or hypersparse and C is sparse, entirely on the
+// GPU: an atomic histogram of the row indices of A, an exclusive scan
+// (GB_cuda_cumsum) to build C->p, and an atomic scatter of the entries into
+// their buckets.  This is the device analogue of the atomic method of
+// GB_transpose_bucket, and shares its contract: the entries within each
+// vector of C land in nondeterministic order, so C is left jumbled, to be
+// sorted later only if some method needs it.  No typecast or operator is
+// applied, and the values move as opaque blocks of asize bytes; the caller's
+// branch function enforces those restrictions.
+
+#include "GB_cuda.h"
+
+// nothing is allocated when GB_new_bix fails, the only use of GB_OK below
+#define GB_FREE_ALL ;
+
+//------------------------------------------------------------------------------
+// device kernels
+//------------------------------------------------------------------------------
+
+// workspace [Ai [p]]++, atomically, skipping nothing (A has no zombies)
+__global__ void GB_transpose_count_kernel
+(
+    int64_t *workspace,     // size vlen+1, already cleared
+    const int64_t *Ai,      // row indices of A
+    int64_t anz
+)
+{
+    for (int64_t p = blockIdx.x * (int64_t) blockDim.x + threadIdx.x ;
+         p < anz ; p += (int64_t) gridDim.x * blockDim.x)
+    {
+        atomicAdd ((unsigned long long *) (workspace + Ai [p]), 1) ;
+    }
+}
+
+// scatter each entry of A into its bucket of C
+__global__ void GB_transpose_scatter_kernel
+(
+    int64_t *Ci,            // column indices of C
+    GB_void *Cx,            // values of C, or NULL if not moved
+    int64_t *workspace,     // size vlen+1; next position in each bucket
+    const GB_void *Ax,      // values of A
+    const int64_t *Ap,      // vector pointers of A, size anvec+1
+    const int64_t *Ah,      // vector names of A, or NULL if A is sparse
+    const int64_t *Ai,      // row indices of A
+    int64_t anvec,
+    int64_t anz,
+    size_t asize
+)
+{
+    for (int64_t p = blockIdx.x * (int64_t) blockDim.x + threadIdx.x ;
+         p < anz ; p += (int64_t) gridDim.x * blockDim.x)
+    {
+        int64_t i = Ai [p] ;
+        // binary search for the vector k containing the entry at position p
+        int64_t klo = 0, khi = anvec ;
+        while (khi - klo > 1)
+        {
+            int64_t kmid = (klo + khi) / 2 ;
+            if (Ap [kmid] <= p) { klo = kmid ; } else { khi = kmid ; }
+        }
+        int64_t j = (Ah == NULL) ? klo : Ah [klo] ;
+        // claim the next position in bucket i of C
+        int64_t pC = (int64_t) atomicAdd
+            ((unsigned long long *) (workspace + i), 1) ;
+        Ci [pC] = j ;
+        if (Cx != NULL)
+        {
+            memcpy (Cx + pC * asize, Ax + p * asize, asize) ;
+        }
+    }
+}
+
+// count the non-empty vectors of C
+__global__ void GB_transpose_nonempty_kernel
+(
+    int64_t *nonempty,      // # of non-empty vectors (a single value)
+    const int64_t *Cp,      // vector pointers of C, size vlen+1
+    int64_t vlen
+)
+{
+    for (int64_t k = blockIdx.x * (int64_t) blockDim.x + threadIdx.x ;
+         k < vlen ; k += (int64_t) gridDim.x * blockDim.x)
+    {
+        if (Cp [k] < Cp [k+1])
+        {
+            atomicAdd ((unsigned long long *) nonempty, 1) ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_transpose_bucket_cuda: gateway, called from GB_transpose_bucket
+//------------------------------------------------------------------------------
+
+GrB_Info GB_transpose_bucket_cuda   // C = A', on the GPU; C left jumbled
+(
+    GrB_Matrix C,               // output matrix (static header)
+    const GrB_Type ctype,       // type of C; same size as the type of A
+    const bool C_is_csc,        // format of C
+    const GrB_Matrix A          // input matrix; sparse or hypersparse
+)
+{
+
+    ASSERT (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) ;
+    ASSERT (!GB_ZOMBIES (A)) ;
+
+    GrB_Info info ;
+    int64_t anz = GB_nnz (A) ;
+    int64_t vlen = A->vlen ;
+
+    //--------------------------------------------------------------------------
+    // allocate C and the workspace
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_new_bix (&C, // sparse, existing header
+        ctype, A->vdim, vlen, GB_Ap_malloc, C_is_csc,
+        GxB_SPARSE, true, A->hyper_switch, vlen, anz, true, false)) ;
+    C->nvals = anz ;
+
+    size_t workspace_size = 0, cnt_size = 0 ;
+    int64_t *workspace = (int64_t *) GB_malloc_memory (vlen + 1,
+        sizeof (int64_t), &workspace_size) ;
+    int64_t *cnt = (int64_t *) GB_malloc_memory (1, sizeof (int64_t),
+        &cnt_size) ;
+    if (workspace == NULL || cnt == NULL)
+    {
+        GB_free_memory ((void **) &workspace, workspace_size) ;
+        GB_free_memory ((void **) &cnt, cnt_size) ;
+        GB_phybix_free (C) ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    (*cnt) = 0 ;
+
+    // FIXME: use the stream pool
+    cudaStream_t stream ;
+    CU_OK (cudaStreamCreate (&stream)) ;
+
+    int blocksz = 256 ;
+    int gridsz = (int) GB_IMIN ((anz + blocksz - 1) / blocksz, 65536) ;
+    gridsz = GB_IMAX (gridsz, 1) ;
+    int gridsz_v = (int) GB_IMIN ((vlen + blocksz) / blocksz, 65536) ;
+    gridsz_v = GB_IMAX (gridsz_v, 1) ;
+
+    //--------------------------------------------------------------------------
+    // phase 1: count the entries in each bucket and build C->p
+    //--------------------------------------------------------------------------
+
+    CU_OK (cudaMemsetAsync (workspace, 0, (vlen + 1) * sizeof (int64_t),
+        stream)) ;
+    if (anz > 0)
+    {
+        GB_transpose_count_kernel <<<gridsz, blocksz, 0, stream>>>
+            (workspace, A->i, anz) ;
+    }
+    CU_OK (cudaStreamSynchronize (stream)) ;
+
+    info = GB_cuda_cumsum (workspace, vlen) ;
+    if (info != GrB_SUCCESS)
+    {
+        GB_free_memory ((void **) &workspace, workspace_size) ;
+        GB_free_memory ((void **) &cnt, cnt_size) ;
+        CU_OK (cudaStreamDestroy (stream)) ;
+        GB_phybix_free (C) ;
+        return (info) ;
+    }
+
+    CU_OK (cudaMemcpyAsync (C->p, workspace, (vlen + 1) * sizeof (int64_t),
+        cudaMemcpyDefault, stream)) ;
+
+    GB_transpose_nonempty_kernel <<<gridsz_v, blocksz, 0, stream>>>
+        (cnt, workspace, vlen) ;
+
+    //--------------------------------------------------------------------------
+    // phase 2: scatter the entries of A into the buckets of C
+    //--------------------------------------------------------------------------
+
+    // the scatter consumes the workspace, advancing each bucket pointer past
+    // the entries it claims; C->p keeps the pristine copy made above
+
+    if (anz > 0)
+    {
+        GB_transpose_scatter_kernel <<<gridsz, blocksz, 0, stream>>>
+            (C->i, C->iso ? NULL : (GB_void *) C->x, workspace,
+             (const GB_void *) A->x, A->p, A->h, A->i,
+             A->nvec, anz, A->type->size) ;
+    }
+
+    CU_OK (cudaStreamSynchronize (stream)) ;
+    CU_OK (cudaStreamDestroy (stream)) ;
+
+    C->nvec_nonempty = (*cnt) ;
+    C->jumbled = true ;     // atomic transpose leaves C jumbled
+    C->magic = GB_MAGIC ;
+
+    GB_free_memory ((void **) &workspace, workspace_size) ;
+    GB_free_memory ((void **) &cnt, cnt_size) ;
+
+    ASSERT_MATRIX_OK (C, "C = A' from GB_transpose_bucket_cuda", GB0) ;
+    return (GrB_SUCCESS) ;
+}
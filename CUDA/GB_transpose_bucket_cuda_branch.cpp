@@ -0,0 +1,37 @@
+//------------------------------------------------------------------------------
+// GB_transpose_bucket_cuda_branch: when to use the GPU for C = A'
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Decide branch direction for GPU use in the bucket transpose.  The GPU
+// kernel moves values as opaque bytes and leaves C jumbled, so it is used
+// only for the plain transpose: no operator, no typecast, and no iso result.
+
+#include "GB_cuda.h"
+
+bool GB_transpose_bucket_cuda_branch    // return true to use the GPU
+(
+    const GB_iso_code C_code_iso,   // iso code for C
+    const GrB_Type ctype,           // type of the output matrix C
+    const GB_Operator op,           // operator to apply, or NULL if none
+    const GrB_Matrix A              // input matrix
+)
+{
+
+    if (op != NULL || ctype != A->type || C_code_iso != GB_NON_ISO)
+    {
+        // the kernel is a pure byte-level scatter; any typecast, operator,
+        // or iso expansion is done on the CPU
+        return (false) ;
+    }
+
+    // see if there is enough work to do on the GPU
+    double work = GB_nnz (A) + A->vlen ;
+    int ngpus_to_use = GB_ngpus_to_use (work) ;
+    GBURBLE (" work:%g gpus:%d ", work, ngpus_to_use) ;
+    return (ngpus_to_use > 0) ;
+}
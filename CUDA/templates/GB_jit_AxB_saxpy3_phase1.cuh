@@ -0,0 +1,128 @@
+//------------------------------------------------------------------------------
+// template/GB_jit_AxB_saxpy3_phase1.cuh: symbolic count of C=A*B, saxpy style
+//------------------------------------------------------------------------------
+
+// saxpy3, phase1: symbolic analysis
+
+// This kernel computes Cwork [kk] = nnz (C (:,j)) for each vector j = kk of
+// B, where C=A*B with no mask, and A and B are both sparse or hypersparse.
+// Each threadblock owns one Gustavson scatter slab Hf of size cvlen in global
+// memory, and walks its vectors with a grid-stride loop.  The slab entries
+// are tags: Hf [i] == kk means row i of C (:,j) has already been seen while
+// computing vector kk, so the slab never needs to be cleared between vectors
+// handled by the same threadblock.  The host initializes all of Hf to -1.
+
+// The vectors B (:,j) are processed one entry k at a time, with all threads
+// of the block cooperating on the pattern of A (:,k).  The row indices of
+// A (:,k) are all distinct, so no atomics are needed to update the slab;
+// the block synchronizes between successive values of k.
+
+#pragma once
+
+#include <limits>
+#include <cstdint>
+#include <cooperative_groups.h>
+#include "GB_cuda_kernel.h"
+#include "GB_mxm_shared_definitions.h"
+#include "GB_hyper_hash_lookup.h"
+#include "GB_cuda_buckets.h"
+
+using namespace cooperative_groups;
+
+template<uint64_t srcode>
+__global__ void AxB_saxpy3_phase1
+(
+    int64_t *__restrict__ Cwork,    // size bnvec+1; Cwork [kk] = nnz (C(:,j))
+    int64_t *__restrict__ Wf,       // size gridDim.x * cvlen, all set to -1
+    GrB_Matrix A,                   // input matrix A, sparse or hypersparse
+    GrB_Matrix B                    // input matrix B, sparse or hypersparse
+)
+{
+
+    // A and B are either sparse or hypersparse
+    const int64_t *__restrict__ Ap = A->p ;
+    const int64_t *__restrict__ Ai = A->i ;
+    const int64_t *__restrict__ Bp = B->p ;
+    const int64_t *__restrict__ Bi = B->i ;
+    ASSERT (GB_A_IS_HYPER || GB_A_IS_SPARSE) ;
+    ASSERT (GB_B_IS_HYPER || GB_B_IS_SPARSE) ;
+
+    #if GB_A_IS_HYPER
+    const int64_t *__restrict__ A_Yp = A->Y->p ;
+    const int64_t *__restrict__ A_Yi = A->Y->i ;
+    const int64_t *__restrict__ A_Yx = (int64_t *) A->Y->x ;
+    const int64_t A_hash_bits = A->Y->vdim - 1 ;
+    #endif
+
+    const int64_t cvlen = A->vlen ;
+    const int64_t bnvec = B->nvec ;
+
+    // this threadblock owns one scatter slab
+    int64_t *__restrict__ Hf = Wf + blockIdx.x * cvlen ;
+
+    __shared__ unsigned long long cjnz_block ;
+
+    //--------------------------------------------------------------------------
+    // count the entries of each C(:,j) owned by this threadblock
+    //--------------------------------------------------------------------------
+
+    for (int64_t kk = blockIdx.x ; kk < bnvec ; kk += gridDim.x)
+    {
+
+        if (threadIdx.x == 0)
+        {
+            cjnz_block = 0 ;
+        }
+        this_thread_block().sync() ;
+
+        int64_t my_cjnz = 0 ;
+
+        //----------------------------------------------------------------------
+        // scatter the pattern of A(:,k) for each entry B(k,j)
+        //----------------------------------------------------------------------
+
+        for (int64_t pB = Bp [kk] ; pB < Bp [kk+1] ; pB++)
+        {
+            int64_t k = Bi [pB] ;
+
+            // find A(:,k)
+            int64_t pA_start, pA_end ;
+            #if GB_A_IS_HYPER
+            GB_hyper_hash_lookup (Ap, A_Yp, A_Yi, A_Yx, A_hash_bits,
+                k, &pA_start, &pA_end) ;
+            #else
+            pA_start = Ap [k] ;
+            pA_end   = Ap [k+1] ;
+            #endif
+
+            // the row indices of A(:,k) are all distinct, so no atomics are
+            // needed; the slab is in a consistent state at each sync point
+            for (int64_t pA = pA_start + threadIdx.x ; pA < pA_end ;
+                pA += blockDim.x)
+            {
+                int64_t i = Ai [pA] ;
+                if (Hf [i] != kk)
+                {
+                    // row index i appears in C(:,j) for the first time
+                    Hf [i] = kk ;
+                    my_cjnz++ ;
+                }
+            }
+            this_thread_block().sync() ;
+        }
+
+        //----------------------------------------------------------------------
+        // reduce the per-thread counts to Cwork [kk]
+        //----------------------------------------------------------------------
+
+        if (my_cjnz > 0)
+        {
+            atomicAdd (&cjnz_block, (unsigned long long) my_cjnz) ;
+        }
+        this_thread_block().sync() ;
+        if (threadIdx.x == 0)
+        {
+            Cwork [kk] = (int64_t) cjnz_block ;
+        }
+    }
+}
@@ -0,0 +1,163 @@
+//------------------------------------------------------------------------------
+// template/GB_jit_AxB_saxpy3_phase3_gus.cuh: numeric C=A*B, Gustavson method
+//------------------------------------------------------------------------------
+
+// saxpy3, phase3, Gustavson bucket: numeric work for vectors C(:,j) with too
+// many entries for the shared-memory hash table.  Each threadblock owns one
+// Gustavson slab of size cvlen in global memory: Hf holds tags and Hx holds
+// the monoid accumulators.  Hf [i] == kk means row i of C(:,j) has already
+// been seen while computing vector kk, so the slab never needs to be cleared
+// between vectors handled by the same threadblock; the host re-initializes
+// all of Hf to -1 before this kernel is launched (phase1 left its own tags
+// behind).
+
+// Each threadblock computes one vector C(:,j) at a time, taken from
+// Bucket [start:end-1] with a grid-stride loop.  The entries of B(:,j) are
+// processed one k at a time, with all threads cooperating on A(:,k); the row
+// indices of A(:,k) are distinct, so the slab updates need no atomics.  After
+// the last k, the slab is swept and the entries are appended to C(:,j),
+// unordered, so the result matrix is jumbled.
+
+// Template on <T_C, T_A, T_B, T_Z>
+
+#pragma once
+
+#include <limits>
+#include <cstdint>
+#include <cooperative_groups.h>
+#include "GB_cuda_kernel.h"
+#include "GB_mxm_shared_definitions.h"
+#include "GB_hyper_hash_lookup.h"
+#include "GB_cuda_buckets.h"
+
+using namespace cooperative_groups;
+
+template<
+    typename T_C, typename T_A, typename T_B, typename T_Z,
+    uint64_t srcode>
+__global__ void AxB_saxpy3_phase3_gus
+(
+    int64_t start,                  // first vector in the Gustavson bucket
+    int64_t end,                    // one past the last vector in the bucket
+    int64_t *__restrict__ Bucket,   // do the work in Bucket [start:end-1]
+    int64_t *__restrict__ Wf,       // size gridDim.x * cvlen, all set to -1
+    void *Wx_slabs,                 // gridDim.x accumulator slabs, size cvlen
+    GrB_Matrix C,                   // output matrix, Cp already computed
+    GrB_Matrix A,                   // input matrix A, sparse or hypersparse
+    GrB_Matrix B                    // input matrix B, sparse or hypersparse
+)
+{
+
+    const T_A *__restrict__ Ax = (T_A *) A->x ;
+    const T_B *__restrict__ Bx = (T_B *) B->x ;
+          T_C *__restrict__ Cx = (T_C *) C->x ;
+    const int64_t *__restrict__ Cp = C->p ;
+          int64_t *__restrict__ Ci = C->i ;
+
+    // A and B are either sparse or hypersparse
+    const int64_t *__restrict__ Ap = A->p ;
+    const int64_t *__restrict__ Ai = A->i ;
+    const int64_t *__restrict__ Bp = B->p ;
+    const int64_t *__restrict__ Bi = B->i ;
+    ASSERT (GB_A_IS_HYPER || GB_A_IS_SPARSE) ;
+    ASSERT (GB_B_IS_HYPER || GB_B_IS_SPARSE) ;
+
+    #if GB_A_IS_HYPER
+    const int64_t *__restrict__ A_Yp = A->Y->p ;
+    const int64_t *__restrict__ A_Yi = A->Y->i ;
+    const int64_t *__restrict__ A_Yx = (int64_t *) A->Y->x ;
+    const int64_t A_hash_bits = A->Y->vdim - 1 ;
+    #endif
+
+    #if GB_B_IS_HYPER
+    const int64_t *__restrict__ Bh = B->h ;
+    #endif
+
+    const int64_t cvlen = A->vlen ;
+
+    // this threadblock owns one Gustavson slab
+    int64_t *__restrict__ Hf = Wf + blockIdx.x * cvlen ;
+    T_Z     *__restrict__ Hx = ((T_Z *) Wx_slabs) + blockIdx.x * cvlen ;
+
+    __shared__ unsigned long long cj_count ;
+
+    //--------------------------------------------------------------------------
+    // compute each vector C(:,j) in this bucket
+    //--------------------------------------------------------------------------
+
+    for (int64_t kkk = start + blockIdx.x ; kkk < end ; kkk += gridDim.x)
+    {
+        int64_t kk = Bucket [kkk] ;
+
+        // j = kk or j = Bh [kk] if B is hypersparse
+        int64_t j = GBH_B (Bh, kk) ;
+
+        if (threadIdx.x == 0)
+        {
+            cj_count = 0 ;
+        }
+        this_thread_block().sync() ;
+
+        //----------------------------------------------------------------------
+        // C(:,j) += A(:,k) * B(k,j) for each entry B(k,j)
+        //----------------------------------------------------------------------
+
+        for (int64_t pB = Bp [kk] ; pB < Bp [kk+1] ; pB++)
+        {
+            int64_t k = Bi [pB] ;
+            GB_DECLAREB (bkj) ;
+            GB_GETB (bkj, Bx, pB, ) ;               // bkj = B(k,j)
+
+            // find A(:,k)
+            int64_t pA_start, pA_end ;
+            #if GB_A_IS_HYPER
+            GB_hyper_hash_lookup (Ap, A_Yp, A_Yi, A_Yx, A_hash_bits,
+                k, &pA_start, &pA_end) ;
+            #else
+            pA_start = Ap [k] ;
+            pA_end   = Ap [k+1] ;
+            #endif
+
+            // the row indices of A(:,k) are all distinct, so no atomics are
+            // needed; the slab is in a consistent state at each sync point
+            for (int64_t pA = pA_start + threadIdx.x ; pA < pA_end ;
+                pA += blockDim.x)
+            {
+                int64_t i = Ai [pA] ;
+                GB_DECLAREA (aik) ;
+                GB_GETA (aik, Ax, pA, ) ;           // aik = A(i,k)
+                GB_Z_TYPE t ;
+                GB_MULT (t, aik, bkj, i, k, j) ;    // t = aik * bkj
+                if (Hf [i] != kk)
+                {
+                    // row index i appears in C(:,j) for the first time
+                    Hf [i] = kk ;
+                    GB_HX_WRITE (i, t) ;            // Hx [i] = t
+                }
+                else
+                {
+                    GB_HX_UPDATE (i, t) ;           // Hx [i] += t
+                }
+            }
+            this_thread_block().sync() ;
+        }
+
+        //----------------------------------------------------------------------
+        // sweep the slab and append the entries to C(:,j)
+        //----------------------------------------------------------------------
+
+        int64_t pC = Cp [kk] ;
+        for (int64_t i = threadIdx.x ; i < cvlen ; i += blockDim.x)
+        {
+            if (Hf [i] == kk)
+            {
+                int64_t p = pC +
+                    (int64_t) atomicAdd (&cj_count, (unsigned long long) 1) ;
+                Ci [p] = i ;                        // C(:,j) is left unordered
+                GB_Z_TYPE t = Hx [i] ;
+                GB_PUTC (t, Cx, p) ;                // Cx [p] = (T_C) t
+            }
+        }
+        this_thread_block().sync() ;
+    }
+}
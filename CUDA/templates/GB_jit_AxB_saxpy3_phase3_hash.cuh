@@ -0,0 +1,180 @@
+//------------------------------------------------------------------------------
+// template/GB_jit_AxB_saxpy3_phase3_hash.cuh: numeric C=A*B via shared hash
+//------------------------------------------------------------------------------
+
+// saxpy3, phase3, hash bucket: numeric work for vectors C(:,j) with few
+// entries (nnz (C (:,j)) <= GB_CUDA_SAXPY3_HASH_LIMIT, at most half the hash
+// table), computed with a hash table held entirely in shared memory.
+
+// Each threadblock computes one vector C(:,j) at a time, taken from
+// Bucket [start:end-1].  The hash table Hi/Hx has GB_CUDA_SAXPY3_HASH_SIZE
+// slots; Hi [hash] is the row index claimed by that slot (or -1 if empty),
+// and Hx [hash] is the monoid accumulator for that row.  Slots are claimed
+// with atomicCAS.  The entries of B(:,j) are processed one k at a time, with
+// all threads cooperating on A(:,k); the row indices of A(:,k) are distinct,
+// so Hx updates need no atomics once a slot is owned.  After the last k, the
+// table is swept and the entries are appended to C(:,j), unordered, so the
+// result matrix is jumbled.
+
+// Template on <T_C, T_A, T_B, T_Z>
+
+#pragma once
+
+#include <limits>
+#include <cstdint>
+#include <cooperative_groups.h>
+#include "GB_cuda_kernel.h"
+#include "GB_mxm_shared_definitions.h"
+#include "GB_hash.h"
+#include "GB_hyper_hash_lookup.h"
+#include "GB_cuda_buckets.h"
+
+using namespace cooperative_groups;
+
+template<
+    typename T_C, typename T_A, typename T_B, typename T_Z,
+    uint64_t srcode>
+__global__ void AxB_saxpy3_phase3_hash
+(
+    int64_t start,                  // first vector in the hash bucket
+    int64_t end,                    // one past the last vector in the bucket
+    int64_t *__restrict__ Bucket,   // do the work in Bucket [start:end-1]
+    GrB_Matrix C,                   // output matrix, Cp already computed
+    GrB_Matrix A,                   // input matrix A, sparse or hypersparse
+    GrB_Matrix B                    // input matrix B, sparse or hypersparse
+)
+{
+
+    const T_A *__restrict__ Ax = (T_A *) A->x ;
+    const T_B *__restrict__ Bx = (T_B *) B->x ;
+          T_C *__restrict__ Cx = (T_C *) C->x ;
+    const int64_t *__restrict__ Cp = C->p ;
+          int64_t *__restrict__ Ci = C->i ;
+
+    // A and B are either sparse or hypersparse
+    const int64_t *__restrict__ Ap = A->p ;
+    const int64_t *__restrict__ Ai = A->i ;
+    const int64_t *__restrict__ Bp = B->p ;
+    const int64_t *__restrict__ Bi = B->i ;
+    ASSERT (GB_A_IS_HYPER || GB_A_IS_SPARSE) ;
+    ASSERT (GB_B_IS_HYPER || GB_B_IS_SPARSE) ;
+
+    #if GB_A_IS_HYPER
+    const int64_t *__restrict__ A_Yp = A->Y->p ;
+    const int64_t *__restrict__ A_Yi = A->Y->i ;
+    const int64_t *__restrict__ A_Yx = (int64_t *) A->Y->x ;
+    const int64_t A_hash_bits = A->Y->vdim - 1 ;
+    #endif
+
+    #if GB_B_IS_HYPER
+    const int64_t *__restrict__ Bh = B->h ;
+    #endif
+
+    // shared-memory hash table, one per threadblock
+    const int64_t hash_bits = GB_CUDA_SAXPY3_HASH_SIZE - 1 ;
+    __shared__ int64_t Hi [GB_CUDA_SAXPY3_HASH_SIZE] ;
+    __shared__ T_Z     Hx [GB_CUDA_SAXPY3_HASH_SIZE] ;
+    __shared__ int     cj_count ;
+
+    //--------------------------------------------------------------------------
+    // compute each vector C(:,j) in this bucket
+    //--------------------------------------------------------------------------
+
+    for (int64_t kkk = start + blockIdx.x ; kkk < end ; kkk += gridDim.x)
+    {
+        int64_t kk = Bucket [kkk] ;
+
+        // j = kk or j = Bh [kk] if B is hypersparse
+        int64_t j = GBH_B (Bh, kk) ;
+
+        // clear the hash table
+        for (int h = threadIdx.x ; h < GB_CUDA_SAXPY3_HASH_SIZE ;
+            h += blockDim.x)
+        {
+            Hi [h] = -1 ;
+        }
+        if (threadIdx.x == 0)
+        {
+            cj_count = 0 ;
+        }
+        this_thread_block().sync() ;
+
+        //----------------------------------------------------------------------
+        // C(:,j) += A(:,k) * B(k,j) for each entry B(k,j)
+        //----------------------------------------------------------------------
+
+        for (int64_t pB = Bp [kk] ; pB < Bp [kk+1] ; pB++)
+        {
+            int64_t k = Bi [pB] ;
+            GB_DECLAREB (bkj) ;
+            GB_GETB (bkj, Bx, pB, ) ;               // bkj = B(k,j)
+
+            // find A(:,k)
+            int64_t pA_start, pA_end ;
+            #if GB_A_IS_HYPER
+            GB_hyper_hash_lookup (Ap, A_Yp, A_Yi, A_Yx, A_hash_bits,
+                k, &pA_start, &pA_end) ;
+            #else
+            pA_start = Ap [k] ;
+            pA_end   = Ap [k+1] ;
+            #endif
+
+            for (int64_t pA = pA_start + threadIdx.x ; pA < pA_end ;
+                pA += blockDim.x)
+            {
+                int64_t i = Ai [pA] ;
+                GB_DECLAREA (aik) ;
+                GB_GETA (aik, Ax, pA, ) ;           // aik = A(i,k)
+                GB_Z_TYPE t ;
+                GB_MULT (t, aik, bkj, i, k, j) ;    // t = aik * bkj
+
+                // find or claim the hash slot for row index i.  The row
+                // indices of A(:,k) are distinct, so the only contention is
+                // between different row indices probing the same slot.
+                int64_t h = GB_HASHF (i, hash_bits) ;
+                while (true)
+                {
+                    int64_t slot = (int64_t) atomicCAS (
+                        (unsigned long long *) (&Hi [h]),
+                        (unsigned long long) (-1),
+                        (unsigned long long) i) ;
+                    if (slot == -1)
+                    {
+                        // claimed an empty slot: Hx [h] = t
+                        GB_HX_WRITE (h, t) ;
+                        break ;
+                    }
+                    else if (slot == i)
+                    {
+                        // row i already has a slot, from a prior k:
+                        // Hx [h] += t, with no atomics needed
+                        GB_HX_UPDATE (h, t) ;
+                        break ;
+                    }
+                    // collision: try the next slot
+                    h = (h + 1) & (hash_bits) ;
+                }
+            }
+            this_thread_block().sync() ;
+        }
+
+        //----------------------------------------------------------------------
+        // sweep the hash table and append the entries to C(:,j)
+        //----------------------------------------------------------------------
+
+        int64_t pC = Cp [kk] ;
+        for (int h = threadIdx.x ; h < GB_CUDA_SAXPY3_HASH_SIZE ;
+            h += blockDim.x)
+        {
+            int64_t i = Hi [h] ;
+            if (i != -1)
+            {
+                int64_t p = pC + (int64_t) atomicAdd (&cj_count, 1) ;
+                Ci [p] = i ;                        // C(:,j) is left unordered
+                GB_Z_TYPE t = Hx [h] ;
+                GB_PUTC (t, Cx, p) ;                // Cx [p] = (T_C) t
+            }
+        }
+        this_thread_block().sync() ;
+    }
+}
@@ -0,0 +1,58 @@
+//------------------------------------------------------------------------------
+// template/GB_jit_apply_unop.cuh
+//------------------------------------------------------------------------------
+
+// The GB_jit_apply_unop CUDA kernel computes Cx = op (A) for a unary operator
+// that does not depend on the row or column index, where A is held as-if-full
+// or bitmap.  Cx has the same entry positions as A->x, so only the values are
+// computed; the caller transplants the pattern of A into C.  Cx and A->x may
+// be aliased (the operator applied in place).
+
+// Both the grid and block are 1D.  Each thread owns a strided set of entries,
+// so all global memory accesses are coalesced.  If A is bitmap, entries with
+// Ab [p] == 0 are skipped; the caller copies A->b into C->b.
+
+#include "GB_cuda_kernel.h"
+#include "GB_apply_shared_definitions.h"
+#include <cstdint>
+
+#if GB_C_ISO
+#error "kernel undefined for C iso"
+#endif
+
+//------------------------------------------------------------------------------
+// GB_jit_apply_unop: Cx = op (A) where A is as-if-full or bitmap
+//------------------------------------------------------------------------------
+
+template< typename T_C, typename T_A>
+__global__ void GB_jit_apply_unop
+(
+    void *Cx_out,   // output array, of type T_C and size anz
+    GrB_Matrix A,   // input matrix, as-if-full or bitmap, not iso
+    int64_t anz     // # of entries held in A: anz = GB_nnz_held (A)
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get C and A
+    //--------------------------------------------------------------------------
+
+    const T_A *__restrict__ Ax = (T_A *) A->x ;
+    const int8_t *__restrict__ Ab = A->b ;      // NULL if A is not bitmap
+          T_C *__restrict__ Cx = (T_C *) Cx_out ;
+
+    //--------------------------------------------------------------------------
+    // Cx = op (A), a grid-stride loop over the entries of A
+    //--------------------------------------------------------------------------
+
+    int64_t nthreads = blockDim.x * gridDim.x ;
+    int64_t pfirst = blockIdx.x * blockDim.x + threadIdx.x ;
+
+    for (int64_t p = pfirst ; p < anz ; p += nthreads)
+    {
+        if (Ab != NULL && !Ab [p]) continue ;   // skip if not in bitmap
+        // Cx [p] = op (Ax [p]) ; the op does not depend on i, j, or y, so
+        // those macro arguments are unused and discarded on expansion
+        GB_UNOP (Cx, p, Ax, p, false, 0, 0, 0) ;
+    }
+}
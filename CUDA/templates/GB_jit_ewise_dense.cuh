@@ -0,0 +1,60 @@
+//------------------------------------------------------------------------------
+// template/GB_jit_ewise_dense.cuh
+//------------------------------------------------------------------------------
+
+// The GB_jit_ewise_dense CUDA kernel computes C = A (op) B where all three
+// matrices are full, with no mask and no typecasting.  When A and B are both
+// full, eWiseAdd and eWiseMult coincide: every entry of C is op (aij, bij).
+// Any matrix may be aliased to any other (C==A, C==B, and/or A==B).
+
+// Both the grid and block are 1D.  Each thread owns a strided set of entries
+// of Cx, so all global memory accesses are coalesced.  The operator is not
+// positional (the branch predicate excludes positional ops), so the i and j
+// arguments of GB_EWISEOP are not used.
+
+#include "GB_cuda_kernel.h"
+#include "GB_ewise_shared_definitions.h"
+#include <cstdint>
+
+#if GB_C_ISO
+#error "kernel undefined for C iso"
+#endif
+
+//------------------------------------------------------------------------------
+// GB_jit_ewise_dense: C = A (op) B where C, A, and B are full
+//------------------------------------------------------------------------------
+
+template< typename T_C, typename T_A, typename T_B>
+__global__ void GB_jit_ewise_dense
+(
+    GrB_Matrix C,   // output matrix, full, not iso
+    GrB_Matrix A,   // first input matrix, full, not iso
+    GrB_Matrix B,   // second input matrix, full, not iso
+    int64_t cnz     // # of entries in C: cnz = GB_nnz_held (C)
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get C, A, and B
+    //--------------------------------------------------------------------------
+
+    const T_A *__restrict__ Ax = (T_A *) A->x ;
+    const T_B *__restrict__ Bx = (T_B *) B->x ;
+          T_C *__restrict__ Cx = (T_C *) C->x ;
+
+    //--------------------------------------------------------------------------
+    // C = A (op) B, a grid-stride loop over the entries of C
+    //--------------------------------------------------------------------------
+
+    int64_t nthreads = blockDim.x * gridDim.x ;
+    int64_t pfirst = blockIdx.x * blockDim.x + threadIdx.x ;
+
+    for (int64_t p = pfirst ; p < cnz ; p += nthreads)
+    {
+        GB_DECLAREA (aij) ;
+        GB_GETA (aij, Ax, p, false) ;           // aij = Ax [p]
+        GB_DECLAREB (bij) ;
+        GB_GETB (bij, Bx, p, false) ;           // bij = Bx [p]
+        GB_EWISEOP (Cx, p, aij, bij, 0, 0) ;    // Cx [p] = op (aij, bij)
+    }
+}
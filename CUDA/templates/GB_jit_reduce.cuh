@@ -218,8 +218,8 @@ __global__ void GB_jit_reduce
         #else
 
             // save my result in V
-            GB_Z_TYPE *Vx = (GB_Z_TYPE) V->x ;
-            Vx [blockIdx.x] = zscalar ;
+            GB_Z_TYPE *Vx = (GB_Z_TYPE *) V->x ;
+            Vx [blockIdx.x] = zmine ;
 
         #endif
     }
@@ -134,6 +134,43 @@ GrB_Info isequal            // return GrB_SUCCESS if successful
 
 GrB_Info import_test (GrB_Matrix *C_handle, int format, bool dump) ;
 
+//------------------------------------------------------------------------------
+// out-of-core tiled C=A*B over serialized tiles (see oocmxm.c)
+//------------------------------------------------------------------------------
+
+GrB_Info oocmxm             // C=A*B via serialized tiles of A
+(
+    GrB_Matrix *C_output,   // newly created output matrix C, in GrB_FP64
+    GrB_Matrix *A_handle,   // input matrix A, consumed and set to NULL
+    GrB_Matrix B,           // input matrix B; must have nrows(B) = ncols(A)
+    int64_t ntiles,         // A is split into an ntiles-by-ntiles grid
+    bool pr                 // if true, print status to stdout
+) ;
+
+//------------------------------------------------------------------------------
+// high-throughput loaders: Matrix Market and raw binary (see load_matrix.c)
+//------------------------------------------------------------------------------
+
+GrB_Info mm_read_matrix     // read a GrB_FP64 matrix in Matrix Market form
+(
+    GrB_Matrix *A_output,   // handle of matrix to create
+    FILE *f,                // file to read, already open
+    bool pr                 // if true, print status to stdout
+) ;
+
+GrB_Info bin_write_matrix   // write a matrix in the raw binary format
+(
+    GrB_Matrix A,           // matrix to write; typecast to GrB_FP64
+    FILE *f                 // file to write, already open
+) ;
+
+GrB_Info bin_read_matrix    // read a GrB_FP64 matrix in the raw binary format
+(
+    GrB_Matrix *A_output,   // handle of matrix to create
+    FILE *f,                // file to read, already open
+    bool pr                 // if true, print status to stdout
+) ;
+
 //------------------------------------------------------------------------------
 // CHECK: expr must be true; if not, return an error condition
 //------------------------------------------------------------------------------
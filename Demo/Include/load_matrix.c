@@ -0,0 +1,409 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Include/load_matrix.c: high-throughput matrix file loaders
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Loaders intended for benchmarking, where reading the input file often
+// dominates the total wall clock time.  Two file formats are supported:
+//
+// (1) mm_read_matrix reads a Matrix Market coordinate file.  The header must
+//      have the form
+//
+//          %%MatrixMarket matrix coordinate type symmetry
+//
+//      where type is real, integer, or pattern, and symmetry is general,
+//      symmetric, or skew-symmetric.  The matrix is returned as GrB_FP64
+//      (pattern entries are given the value 1).  Unlike read_matrix, which
+//      parses one tuple per fscanf call with a single thread, this method
+//      reads the file into memory in large chunks, splits it at line
+//      boundaries into one span per thread, and parses all spans in
+//      parallel; the tuples of a symmetric file are mirrored in parallel as
+//      well.  The assembled tuples are passed to GrB_Matrix_build, which
+//      sorts and assembles them with all available threads.
+//
+// (2) bin_write_matrix and bin_read_matrix write and read a raw binary file
+//      that bypasses text parsing entirely.  The format is:
+//
+//          bytes 0..7:     the 8 ASCII characters "GBDEMO1\n"
+//          bytes 8..31:    nrows, ncols, nvals as native uint64_t
+//          then:           nvals row indices, as native uint64_t (0-based)
+//          then:           nvals column indices, as native uint64_t (0-based)
+//          then:           nvals values, as native double
+//
+//      The file is not portable across machines with different endianness
+//      or a different size of double; it is a benchmarking cache, not an
+//      interchange format.
+
+#include "GraphBLAS.h"
+#undef I
+#include <string.h>
+#include <ctype.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// free all workspace; this used by the OK(...) macro if an error occurs
+#undef  FREE_ALL
+#define FREE_ALL                    \
+    if (buf != NULL) free (buf) ;   \
+    if (I != NULL) free (I) ;       \
+    if (J != NULL) free (J) ;       \
+    if (X != NULL) free (X) ;       \
+    GrB_Matrix_free (&T) ;
+
+#include "graphblas_demos.h"
+
+// at most this many parallel parsing spans (also bounds the stack arrays)
+#define LOAD_MAX_CHUNKS 256
+
+// the binary file signature
+#define BIN_MAGIC "GBDEMO1\n"
+
+//------------------------------------------------------------------------------
+// mm_read_matrix: read a Matrix Market coordinate file in parallel
+//------------------------------------------------------------------------------
+
+GrB_Info mm_read_matrix     // read a GrB_FP64 matrix in Matrix Market form
+(
+    GrB_Matrix *A_output,   // handle of matrix to create
+    FILE *f,                // file to read, already open
+    bool pr                 // if true, print status to stdout
+)
+{
+
+    //--------------------------------------------------------------------------
+    // parse the header and the size line
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    char *buf = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    GrB_Matrix T = NULL ;
+
+    char line [1024] ;
+    char object [64], format [64], type [64], symmetry [64] ;
+    CHECK (fgets (line, sizeof (line), f) != NULL, GrB_INVALID_VALUE) ;
+    CHECK (sscanf (line, "%%%%MatrixMarket %63s %63s %63s %63s",
+        object, format, type, symmetry) == 4, GrB_INVALID_VALUE) ;
+    CHECK (strcmp (object, "matrix") == 0, GrB_INVALID_VALUE) ;
+    CHECK (strcmp (format, "coordinate") == 0, GrB_INVALID_VALUE) ;
+    bool pattern = (strcmp (type, "pattern") == 0) ;
+    CHECK (pattern || strcmp (type, "real") == 0
+        || strcmp (type, "integer") == 0, GrB_INVALID_VALUE) ;
+    bool skew = (strcmp (symmetry, "skew-symmetric") == 0) ;
+    bool symmetric = skew || (strcmp (symmetry, "symmetric") == 0) ;
+    CHECK (symmetric || strcmp (symmetry, "general") == 0, GrB_INVALID_VALUE) ;
+
+    // skip any comment lines, then read "nrows ncols ntuples"
+    uint64_t nrows = 0, ncols = 0, ntuples = 0 ;
+    while (true)
+    {
+        CHECK (fgets (line, sizeof (line), f) != NULL, GrB_INVALID_VALUE) ;
+        if (line [0] == '%') continue ;
+        CHECK (sscanf (line, "%" SCNu64 " %" SCNu64 " %" SCNu64,
+            &nrows, &ncols, &ntuples) == 3, GrB_INVALID_VALUE) ;
+        break ;
+    }
+
+    //--------------------------------------------------------------------------
+    // read the rest of the file into memory, in large chunks
+    //--------------------------------------------------------------------------
+
+    size_t len = 0, bufsize = 1 << 26 ;
+    buf = malloc (bufsize + 1) ;
+    CHECK (buf != NULL, GrB_OUT_OF_MEMORY) ;
+    while (true)
+    {
+        if (len == bufsize)
+        {
+            bufsize *= 2 ;
+            char *newbuf = realloc (buf, bufsize + 1) ;
+            CHECK (newbuf != NULL, GrB_OUT_OF_MEMORY) ;
+            buf = newbuf ;
+        }
+        size_t nread = fread (buf + len, 1, bufsize - len, f) ;
+        if (nread == 0) break ;
+        len += nread ;
+    }
+    buf [len] = '\0' ;      // so strtoull/strtod never run off the end
+
+    //--------------------------------------------------------------------------
+    // split the buffer into one span per thread, at line boundaries
+    //--------------------------------------------------------------------------
+
+    int nchunks = 1 ;
+    #ifdef _OPENMP
+    nchunks = omp_get_max_threads ( ) ;
+    #endif
+    nchunks = MAX (nchunks, 1) ;
+    nchunks = MIN (nchunks, LOAD_MAX_CHUNKS) ;
+
+    size_t    cstart [LOAD_MAX_CHUNKS+1] ;
+    GrB_Index koff   [LOAD_MAX_CHUNKS+1] ;
+    GrB_Index eoff   [LOAD_MAX_CHUNKS+1] ;
+    cstart [0] = 0 ;
+    for (int c = 1 ; c < nchunks ; c++)
+    {
+        // start the span at the first line break at or after c*len/nchunks
+        size_t pos = (c * len) / nchunks ;
+        pos = MAX (pos, cstart [c-1]) ;
+        while (pos < len && buf [pos-1] != '\n') pos++ ;
+        cstart [c] = pos ;
+    }
+    cstart [nchunks] = len ;
+
+    //--------------------------------------------------------------------------
+    // pass 1: count the tuples in each span
+    //--------------------------------------------------------------------------
+
+    int c ;
+    #ifdef _OPENMP
+    #pragma omp parallel for num_threads(nchunks) schedule(static)
+    #endif
+    for (c = 0 ; c < nchunks ; c++)
+    {
+        const char *s = buf + cstart [c] ;
+        const char *send = buf + cstart [c+1] ;
+        GrB_Index cnt = 0 ;
+        while (s < send)
+        {
+            const char *eol = memchr (s, '\n', send - s) ;
+            if (eol == NULL) eol = send ;
+            while (s < eol && isspace ((int) *s)) s++ ;
+            if (s < eol && *s != '%') cnt++ ;
+            s = eol + 1 ;
+        }
+        koff [c] = cnt ;
+    }
+
+    // replace the counts with cumulative offsets
+    GrB_Index k = 0 ;
+    for (int c = 0 ; c < nchunks ; c++)
+    {
+        GrB_Index cnt = koff [c] ;
+        koff [c] = k ;
+        k += cnt ;
+    }
+    koff [nchunks] = k ;
+    CHECK (k == ntuples, GrB_INVALID_VALUE) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the tuples
+    //--------------------------------------------------------------------------
+
+    GrB_Index nmax = symmetric ? (2 * ntuples) : ntuples ;
+    nmax = MAX (nmax, 1) ;
+    I = malloc (nmax * sizeof (GrB_Index)) ;
+    J = malloc (nmax * sizeof (GrB_Index)) ;
+    X = malloc (nmax * sizeof (double)) ;
+    CHECK (I != NULL && J != NULL && X != NULL, GrB_OUT_OF_MEMORY) ;
+
+    //--------------------------------------------------------------------------
+    // pass 2: parse each span into its slice of the tuple arrays
+    //--------------------------------------------------------------------------
+
+    #ifdef _OPENMP
+    #pragma omp parallel for num_threads(nchunks) schedule(static)
+    #endif
+    for (c = 0 ; c < nchunks ; c++)
+    {
+        char *s = buf + cstart [c] ;
+        char *send = buf + cstart [c+1] ;
+        GrB_Index my_k = koff [c] ;
+        while (s < send)
+        {
+            char *eol = memchr (s, '\n', send - s) ;
+            if (eol == NULL) eol = send ;
+            while (s < eol && isspace ((int) *s)) s++ ;
+            if (s < eol && *s != '%')
+            {
+                // parse "i j" or "i j x"; Matrix Market files are 1-based
+                char *q ;
+                I [my_k] = strtoull (s, &q, 10) - 1 ;
+                J [my_k] = strtoull (q, &q, 10) - 1 ;
+                X [my_k] = pattern ? 1.0 : strtod (q, &q) ;
+                my_k++ ;
+            }
+            s = eol + 1 ;
+        }
+    }
+
+    free (buf) ;
+    buf = NULL ;
+
+    //--------------------------------------------------------------------------
+    // mirror the off-diagonal tuples of a symmetric matrix
+    //--------------------------------------------------------------------------
+
+    GrB_Index nvals = ntuples ;
+    if (symmetric)
+    {
+        // count the off-diagonal tuples in each span
+        #ifdef _OPENMP
+        #pragma omp parallel for num_threads(nchunks) schedule(static)
+        #endif
+        for (c = 0 ; c < nchunks ; c++)
+        {
+            GrB_Index cnt = 0 ;
+            for (GrB_Index p = koff [c] ; p < koff [c+1] ; p++)
+            {
+                if (I [p] != J [p]) cnt++ ;
+            }
+            eoff [c] = cnt ;
+        }
+
+        GrB_Index e = ntuples ;
+        for (int c = 0 ; c < nchunks ; c++)
+        {
+            GrB_Index cnt = eoff [c] ;
+            eoff [c] = e ;
+            e += cnt ;
+        }
+        eoff [nchunks] = e ;
+        nvals = e ;
+
+        // append the transposed copy of each off-diagonal tuple
+        #ifdef _OPENMP
+        #pragma omp parallel for num_threads(nchunks) schedule(static)
+        #endif
+        for (c = 0 ; c < nchunks ; c++)
+        {
+            GrB_Index my_e = eoff [c] ;
+            for (GrB_Index p = koff [c] ; p < koff [c+1] ; p++)
+            {
+                if (I [p] != J [p])
+                {
+                    I [my_e] = J [p] ;
+                    J [my_e] = I [p] ;
+                    X [my_e] = skew ? (-X [p]) : X [p] ;
+                    my_e++ ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // build the matrix and free the tuples
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&T, GrB_FP64, nrows, ncols)) ;
+    OK (GrB_Matrix_build_FP64 (T, I, J, X, nvals, GrB_PLUS_FP64)) ;
+    free (I) ; I = NULL ;
+    free (J) ; J = NULL ;
+    free (X) ; X = NULL ;
+
+    if (pr)
+    {
+        printf ("matrix %.16g by %.16g, %.16g entries (%s %s), from "
+            "Matrix Market file\n", (double) nrows, (double) ncols,
+            (double) nvals, type, symmetry) ;
+    }
+
+    *A_output = T ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// bin_write_matrix: write a matrix to a raw binary file
+//------------------------------------------------------------------------------
+
+GrB_Info bin_write_matrix   // write a matrix in the raw binary format
+(
+    GrB_Matrix A,           // matrix to write; typecast to GrB_FP64
+    FILE *f                 // file to write, already open
+)
+{
+    GrB_Info info ;
+    char *buf = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    GrB_Matrix T = NULL ;
+
+    GrB_Index nrows, ncols, nvals ;
+    OK (GrB_Matrix_nrows (&nrows, A)) ;
+    OK (GrB_Matrix_ncols (&ncols, A)) ;
+    OK (GrB_Matrix_nvals (&nvals, A)) ;
+
+    GrB_Index nmax = MAX (nvals, 1) ;
+    I = malloc (nmax * sizeof (GrB_Index)) ;
+    J = malloc (nmax * sizeof (GrB_Index)) ;
+    X = malloc (nmax * sizeof (double)) ;
+    CHECK (I != NULL && J != NULL && X != NULL, GrB_OUT_OF_MEMORY) ;
+    GrB_Index nvals2 = nvals ;
+    OK (GrB_Matrix_extractTuples_FP64 (I, J, X, &nvals2, A)) ;
+
+    uint64_t header [3] ;
+    header [0] = nrows ;
+    header [1] = ncols ;
+    header [2] = nvals ;
+    CHECK (fwrite (BIN_MAGIC, 1, 8, f) == 8, GrB_INVALID_VALUE) ;
+    CHECK (fwrite (header, sizeof (uint64_t), 3, f) == 3, GrB_INVALID_VALUE) ;
+    CHECK (fwrite (I, sizeof (GrB_Index), nvals, f) == nvals,
+        GrB_INVALID_VALUE) ;
+    CHECK (fwrite (J, sizeof (GrB_Index), nvals, f) == nvals,
+        GrB_INVALID_VALUE) ;
+    CHECK (fwrite (X, sizeof (double), nvals, f) == nvals, GrB_INVALID_VALUE) ;
+
+    free (I) ; I = NULL ;
+    free (J) ; J = NULL ;
+    free (X) ; X = NULL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// bin_read_matrix: read a matrix from a raw binary file
+//------------------------------------------------------------------------------
+
+GrB_Info bin_read_matrix    // read a GrB_FP64 matrix in the raw binary format
+(
+    GrB_Matrix *A_output,   // handle of matrix to create
+    FILE *f,                // file to read, already open
+    bool pr                 // if true, print status to stdout
+)
+{
+    GrB_Info info ;
+    char *buf = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    GrB_Matrix T = NULL ;
+
+    char magic [8] ;
+    uint64_t header [3] ;
+    CHECK (fread (magic, 1, 8, f) == 8, GrB_INVALID_VALUE) ;
+    CHECK (memcmp (magic, BIN_MAGIC, 8) == 0, GrB_INVALID_VALUE) ;
+    CHECK (fread (header, sizeof (uint64_t), 3, f) == 3, GrB_INVALID_VALUE) ;
+    GrB_Index nrows = header [0] ;
+    GrB_Index ncols = header [1] ;
+    GrB_Index nvals = header [2] ;
+
+    GrB_Index nmax = MAX (nvals, 1) ;
+    I = malloc (nmax * sizeof (GrB_Index)) ;
+    J = malloc (nmax * sizeof (GrB_Index)) ;
+    X = malloc (nmax * sizeof (double)) ;
+    CHECK (I != NULL && J != NULL && X != NULL, GrB_OUT_OF_MEMORY) ;
+    CHECK (fread (I, sizeof (GrB_Index), nvals, f) == nvals,
+        GrB_INVALID_VALUE) ;
+    CHECK (fread (J, sizeof (GrB_Index), nvals, f) == nvals,
+        GrB_INVALID_VALUE) ;
+    CHECK (fread (X, sizeof (double), nvals, f) == nvals, GrB_INVALID_VALUE) ;
+
+    OK (GrB_Matrix_new (&T, GrB_FP64, nrows, ncols)) ;
+    OK (GrB_Matrix_build_FP64 (T, I, J, X, nvals, GrB_PLUS_FP64)) ;
+    free (I) ; I = NULL ;
+    free (J) ; J = NULL ;
+    free (X) ; X = NULL ;
+
+    if (pr)
+    {
+        printf ("matrix %.16g by %.16g, %.16g entries, from binary file\n",
+            (double) nrows, (double) ncols, (double) nvals) ;
+    }
+
+    *A_output = T ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,208 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Include/oocmxm.c: out-of-core tiled C=A*B
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Computes C=A*B with the plus-times semiring in GrB_FP64, for a matrix A
+// that is too large to hold in memory in unserialized form.  A is split into
+// an ntiles-by-ntiles grid with GxB_Matrix_split, each tile is serialized
+// into its own compressed blob with GxB_Matrix_serialize, and the tile
+// matrices are freed; only the compressed blobs (and one or two working
+// tiles) are held at any point of the multiply.  An application with a
+// matrix that does not fit in memory at all would write the blobs to files
+// and read them back in the same order; the driver below is unchanged.
+//
+// The multiply then streams the tiles in row-major order.  For each tile
+// A(i,k), C(i) += A(i,k)*B(k) is accumulated into one strip of C per tile
+// row, where B(k) is the k-th horizontal strip of B.  While one tile
+// multiplies, the blob of the next tile in the stream is deserialized by a
+// second thread, so the decompression runs in the shadow of the multiply.
+// The finished strips are reassembled with GxB_Matrix_concat.
+
+#include "GraphBLAS.h"
+#undef I
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// free all workspace; this used by the OK(...) macro if an error occurs
+#undef  FREE_ALL
+#define FREE_ALL                                                \
+{                                                               \
+    for (int64_t t = 0 ; t < ntiles * ntiles ; t++)             \
+    {                                                           \
+        if (Tiles != NULL) GrB_Matrix_free (&(Tiles [t])) ;     \
+        if (Blobs != NULL && Blobs [t] != NULL)                 \
+        {                                                       \
+            free (Blobs [t]) ;                                  \
+            Blobs [t] = NULL ;                                  \
+        }                                                       \
+    }                                                           \
+    for (int64_t t = 0 ; t < ntiles ; t++)                      \
+    {                                                           \
+        if (Btiles != NULL) GrB_Matrix_free (&(Btiles [t])) ;   \
+        if (Ctiles != NULL) GrB_Matrix_free (&(Ctiles [t])) ;   \
+    }                                                           \
+    if (Tiles  != NULL) free (Tiles ) ;                         \
+    if (Blobs  != NULL) free (Blobs ) ;                         \
+    if (Bsizes != NULL) free (Bsizes) ;                         \
+    if (Btiles != NULL) free (Btiles) ;                         \
+    if (Ctiles != NULL) free (Ctiles) ;                         \
+    if (Tile_rows != NULL) free (Tile_rows) ;                   \
+    if (Tile_cols != NULL) free (Tile_cols) ;                   \
+    GrB_Matrix_free (&Cur) ;                                    \
+    GrB_Matrix_free (&Next) ;                                   \
+    GrB_Matrix_free (&C) ;                                      \
+}
+
+#include "graphblas_demos.h"
+
+GrB_Info oocmxm             // C=A*B via serialized tiles of A
+(
+    GrB_Matrix *C_output,   // newly created output matrix C, in GrB_FP64
+    GrB_Matrix *A_handle,   // input matrix A, consumed and set to NULL
+    GrB_Matrix B,           // input matrix B; must have nrows(B) = ncols(A)
+    int64_t ntiles,         // A is split into an ntiles-by-ntiles grid
+    bool pr                 // if true, print status to stdout
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get inputs and allocate workspace
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GrB_Matrix *Tiles = NULL, *Btiles = NULL, *Ctiles = NULL ;
+    GrB_Matrix Cur = NULL, Next = NULL, C = NULL ;
+    void **Blobs = NULL ;
+    GrB_Index *Bsizes = NULL, *Tile_rows = NULL, *Tile_cols = NULL ;
+
+    GrB_Index anrows, ancols, bnrows, bncols ;
+    GrB_Matrix A = (*A_handle) ;
+    OK (GrB_Matrix_nrows (&anrows, A)) ;
+    OK (GrB_Matrix_ncols (&ancols, A)) ;
+    OK (GrB_Matrix_nrows (&bnrows, B)) ;
+    OK (GrB_Matrix_ncols (&bncols, B)) ;
+    CHECK (ancols == bnrows, GrB_DIMENSION_MISMATCH) ;
+    CHECK (ntiles >= 1 && (GrB_Index) ntiles <= anrows
+        && (GrB_Index) ntiles <= ancols, GrB_INVALID_VALUE) ;
+
+    Tiles  = calloc (ntiles * ntiles, sizeof (GrB_Matrix)) ;
+    Blobs  = calloc (ntiles * ntiles, sizeof (void *)) ;
+    Bsizes = calloc (ntiles * ntiles, sizeof (GrB_Index)) ;
+    Btiles = calloc (ntiles, sizeof (GrB_Matrix)) ;
+    Ctiles = calloc (ntiles, sizeof (GrB_Matrix)) ;
+    Tile_rows = malloc (ntiles * sizeof (GrB_Index)) ;
+    Tile_cols = malloc (ntiles * sizeof (GrB_Index)) ;
+    CHECK (Tiles != NULL && Blobs != NULL && Bsizes != NULL && Btiles != NULL
+        && Ctiles != NULL && Tile_rows != NULL && Tile_cols != NULL,
+        GrB_OUT_OF_MEMORY) ;
+
+    // tile i gets rows i*anrows/ntiles to (i+1)*anrows/ntiles - 1, and
+    // likewise for the columns
+    for (int64_t i = 0 ; i < ntiles ; i++)
+    {
+        Tile_rows [i] = ((i+1) * anrows) / ntiles - (i * anrows) / ntiles ;
+        Tile_cols [i] = ((i+1) * ancols) / ntiles - (i * ancols) / ntiles ;
+    }
+
+    //--------------------------------------------------------------------------
+    // split A into tiles and serialize each tile; free A and the tiles
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Matrix_split (Tiles, ntiles, ntiles, Tile_rows, Tile_cols,
+        A, NULL)) ;
+    GrB_Matrix_free (A_handle) ;
+
+    GrB_Index blob_total = 0 ;
+    for (int64_t t = 0 ; t < ntiles * ntiles ; t++)
+    {
+        OK (GxB_Matrix_serialize (&(Blobs [t]), &(Bsizes [t]), Tiles [t],
+            NULL)) ;
+        GrB_Matrix_free (&(Tiles [t])) ;
+        blob_total += Bsizes [t] ;
+    }
+    if (pr)
+    {
+        printf ("oocmxm: %.16g tiles, %.16g bytes of serialized tiles\n",
+            (double) (ntiles * ntiles), (double) blob_total) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // split B into ntiles horizontal strips, and create the strips of C
+    //--------------------------------------------------------------------------
+
+    GrB_Index one_col = bncols ;
+    OK (GxB_Matrix_split (Btiles, ntiles, 1, Tile_cols, &one_col, B, NULL)) ;
+    for (int64_t i = 0 ; i < ntiles ; i++)
+    {
+        OK (GrB_Matrix_new (&(Ctiles [i]), GrB_FP64, Tile_rows [i], bncols)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // stream the tiles: C(i) += A(i,k)*B(k), prefetching the next tile
+    //--------------------------------------------------------------------------
+
+    // deserialize the first tile, then overlap each multiply with the
+    // deserialization of the next tile in the stream
+
+    OK (GxB_Matrix_deserialize (&Cur, GrB_FP64, Blobs [0], Bsizes [0],
+        NULL)) ;
+
+    for (int64_t t = 0 ; t < ntiles * ntiles ; t++)
+    {
+        int64_t i = t / ntiles ;
+        int64_t k = t % ntiles ;
+        GrB_Info minfo = GrB_SUCCESS, dinfo = GrB_SUCCESS ;
+
+        #ifdef _OPENMP
+        #pragma omp parallel sections num_threads(2)
+        #endif
+        {
+            #ifdef _OPENMP
+            #pragma omp section
+            #endif
+            {
+                // multiply the current tile into its strip of C
+                minfo = GrB_mxm (Ctiles [i], NULL, GrB_PLUS_FP64,
+                    GrB_PLUS_TIMES_SEMIRING_FP64, Cur, Btiles [k], NULL) ;
+            }
+            #ifdef _OPENMP
+            #pragma omp section
+            #endif
+            {
+                // prefetch: deserialize the next tile in the stream
+                if (t+1 < ntiles * ntiles)
+                {
+                    dinfo = GxB_Matrix_deserialize (&Next, GrB_FP64,
+                        Blobs [t+1], Bsizes [t+1], NULL) ;
+                }
+            }
+        }
+        OK (minfo) ;
+        OK (dinfo) ;
+
+        // the blob and tile of this step are no longer needed
+        free (Blobs [t]) ;
+        Blobs [t] = NULL ;
+        GrB_Matrix_free (&Cur) ;
+        Cur = Next ;
+        Next = NULL ;
+    }
+
+    //--------------------------------------------------------------------------
+    // reassemble C from its strips, and free all workspace
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&C, GrB_FP64, anrows, bncols)) ;
+    OK (GxB_Matrix_concat (C, Ctiles, ntiles, 1, NULL)) ;
+
+    (*C_output) = C ;
+    C = NULL ;
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,324 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/algo_bench_demo.c: reference algorithm benchmarks
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Runs three reference algorithm pipelines on a random symmetric graph, with
+// per-phase timings, so that a kernel change can be judged by how it composes
+// into full algorithms, not just by isolated kernel timings:
+//
+//      bfs:  direction-optimized breadth-first search.  The push direction is
+//            a masked GrB_vxm with the ANY_PAIR semiring and a complemented
+//            structural mask; the pull direction is the same product with the
+//            frontier as a dense bitmap.  The switch uses the standard
+//            frontier-size heuristic.
+//
+//      pr:   PageRank.  Each iteration is an importance sweep (vxm with
+//            PLUS_TIMES on a dense rank vector, the dot4/saxpy5 pipelines),
+//            followed by the teleport apply and a convergence reduce.
+//
+//      cc:   connected components by label propagation.  Each iteration is a
+//            MIN_SECOND mxv, a MIN eWiseAdd into the labels, and a
+//            convergence check; the min-reduction assign pattern.
+//
+// Output is one line per algorithm with the total time and a breakdown by
+// phase, plus a result summary (levels reached, iterations, components) that
+// can be checked against a previous release.
+//
+// Usage:
+//
+//      algo_bench_demo n edge_factor trials [nthreads]
+//
+// All arguments are optional; the defaults are n = 100000, edge_factor = 8
+// (so the graph has about 8*n edges), trials = 3, and the default number of
+// threads.
+
+#include "graphblas_demos.h"
+#include "simple_rand.h"
+#include "simple_rand.c"
+#include "usercomplex.h"
+#include "usercomplex.c"
+#include "random_matrix.c"
+#include <time.h>
+
+// macro used by OK(...) to free workspace if an error occurs
+#undef  FREE_ALL
+#define FREE_ALL                    \
+    GrB_Matrix_free (&A) ;          \
+    GrB_Matrix_free (&AB) ;         \
+    GrB_Vector_free (&q) ;          \
+    GrB_Vector_free (&level) ;      \
+    GrB_Vector_free (&r) ;          \
+    GrB_Vector_free (&t) ;          \
+    GrB_Vector_free (&d) ;          \
+    GrB_Vector_free (&labels) ;     \
+    GrB_Vector_free (&lnew) ;       \
+    GrB_Vector_free (&same) ;
+
+//------------------------------------------------------------------------------
+// wallclock: high-resolution wall clock time, in seconds
+//------------------------------------------------------------------------------
+
+static double wallclock (void)
+{
+    struct timespec ts ;
+    timespec_get (&ts, TIME_UTC) ;
+    return ((double) ts.tv_sec + 1e-9 * (double) ts.tv_nsec) ;
+}
+
+//------------------------------------------------------------------------------
+// algo_bench_demo main program
+//------------------------------------------------------------------------------
+
+int main (int argc, char **argv)
+{
+    GrB_Matrix A = NULL, AB = NULL ;
+    GrB_Vector q = NULL, level = NULL, r = NULL, t = NULL, d = NULL,
+        labels = NULL, lnew = NULL, same = NULL ;
+    GrB_Info info ;
+    OK (GrB_init (GrB_NONBLOCKING)) ;
+
+    //--------------------------------------------------------------------------
+    // get inputs
+    //--------------------------------------------------------------------------
+
+    int64_t n = 100000 ;
+    int64_t edge_factor = 8 ;
+    int trials = 3 ;
+    if (argc > 1) n = strtol (argv [1], NULL, 0) ;
+    if (argc > 2) edge_factor = strtol (argv [2], NULL, 0) ;
+    if (argc > 3) trials = (int) strtol (argv [3], NULL, 0) ;
+    if (argc > 4)
+    {
+        int nthreads = (int) strtol (argv [4], NULL, 0) ;
+        OK (GxB_Global_Option_set (GxB_GLOBAL_NTHREADS, nthreads)) ;
+    }
+    int nthreads_default ;
+    OK (GxB_Global_Option_get (GxB_GLOBAL_NTHREADS, &nthreads_default)) ;
+    fprintf (stderr, "algo_bench_demo: n %g edge_factor %g trials %d"
+        " threads %d\n", (double) n, (double) edge_factor, trials,
+        nthreads_default) ;
+
+    //--------------------------------------------------------------------------
+    // create a random symmetric graph, with no self edges
+    //--------------------------------------------------------------------------
+
+    double tic = wallclock ( ) ;
+    simple_rand_seed (1) ;
+    OK (random_matrix (&A, true, true, n, n, edge_factor * n, 0, false)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+    // AB = spones (A), boolean, for BFS and CC
+    OK (GrB_Matrix_new (&AB, GrB_BOOL, n, n)) ;
+    OK (GrB_Matrix_apply (AB, NULL, NULL, GxB_ONE_BOOL, A, NULL)) ;
+    OK (GrB_Matrix_wait (AB, GrB_MATERIALIZE)) ;
+
+    GrB_Index nedges ;
+    OK (GrB_Matrix_nvals (&nedges, A)) ;
+    fprintf (stderr, "graph: n %g edges %g build time %g sec\n",
+        (double) n, (double) nedges, wallclock ( ) - tic) ;
+
+    //--------------------------------------------------------------------------
+    // BFS: direction-optimized, masked vxm, ANY_PAIR semiring
+    //--------------------------------------------------------------------------
+
+    for (int trial = 0 ; trial < trials ; trial++)
+    {
+        double t_push = 0, t_pull = 0, t_assign = 0 ;
+        double t_total = wallclock ( ) ;
+
+        OK (GrB_Vector_new (&q, GrB_BOOL, n)) ;
+        OK (GrB_Vector_new (&level, GrB_INT32, n)) ;
+        OK (GrB_Vector_setElement_BOOL (q, true, 0)) ;      // source vertex 0
+
+        int32_t depth ;
+        GrB_Index nq = 1, nvisited = 0 ;
+        for (depth = 0 ; nq > 0 && depth < (int32_t) n ; depth++)
+        {
+            // level<q> = depth
+            tic = wallclock ( ) ;
+            OK (GrB_Vector_assign_INT32 (level, q, NULL, depth, GrB_ALL, n,
+                GrB_DESC_S)) ;
+            nvisited += nq ;
+            t_assign += wallclock ( ) - tic ;
+
+            // direction heuristic: pull when the frontier is large
+            bool pull = (nq > n / 16) ;
+            tic = wallclock ( ) ;
+            if (pull)
+            {
+                // make the frontier dense (bitmap) for the pull direction
+                OK (GxB_Vector_Option_set (q, GxB_SPARSITY_CONTROL,
+                    GxB_BITMAP)) ;
+            }
+            else
+            {
+                OK (GxB_Vector_Option_set (q, GxB_SPARSITY_CONTROL,
+                    GxB_SPARSE)) ;
+            }
+            // q<!level,replace> = q'*AB, structural complement mask
+            OK (GrB_vxm (q, level, NULL, GxB_ANY_PAIR_BOOL, q, AB,
+                GrB_DESC_RSC)) ;
+            if (pull)
+            {
+                t_pull += wallclock ( ) - tic ;
+            }
+            else
+            {
+                t_push += wallclock ( ) - tic ;
+            }
+            OK (GrB_Vector_nvals (&nq, q)) ;
+        }
+
+        t_total = wallclock ( ) - t_total ;
+        printf ("bfs: trial %d n %g visited %g levels %d total %g sec"
+            " (push %g pull %g assign %g)\n", trial, (double) n,
+            (double) nvisited, depth, t_total, t_push, t_pull, t_assign) ;
+
+        OK (GrB_Vector_free (&q)) ;
+        OK (GrB_Vector_free (&level)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // PageRank: dense rank vector, PLUS_TIMES vxm, teleport apply
+    //--------------------------------------------------------------------------
+
+    #define DAMPING 0.85
+    #define PR_ITERS 20
+
+    // d = out-degree of each vertex, as FP64, with zero degrees kept at 1
+    OK (GrB_Vector_new (&d, GrB_FP64, n)) ;
+    OK (GrB_Matrix_reduce_Monoid (d, NULL, NULL, GrB_PLUS_MONOID_FP64, A,
+        NULL)) ;
+    OK (GrB_Vector_assign_FP64 (d, NULL, GrB_MAX_FP64, 1, GrB_ALL, n, NULL)) ;
+
+    for (int trial = 0 ; trial < trials ; trial++)
+    {
+        double t_mxv = 0, t_scale = 0, t_reduce = 0 ;
+        double t_total = wallclock ( ) ;
+
+        // r = 1/n, dense
+        OK (GrB_Vector_new (&r, GrB_FP64, n)) ;
+        OK (GrB_Vector_new (&t, GrB_FP64, n)) ;
+        OK (GrB_Vector_assign_FP64 (r, NULL, NULL, 1.0 / (double) n,
+            GrB_ALL, n, NULL)) ;
+
+        double delta = 1 ;
+        int iters = 0 ;
+        for ( ; iters < PR_ITERS ; iters++)
+        {
+            // t = r ./ d (importance per outgoing edge)
+            tic = wallclock ( ) ;
+            OK (GrB_eWiseMult (t, NULL, NULL, GrB_DIV_FP64, r, d, NULL)) ;
+            t_scale += wallclock ( ) - tic ;
+
+            // r = damping * (t'*A) + (1-damping)/n, on a dense rank vector
+            tic = wallclock ( ) ;
+            OK (GrB_vxm (r, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, t, A,
+                NULL)) ;
+            t_mxv += wallclock ( ) - tic ;
+
+            tic = wallclock ( ) ;
+            OK (GrB_Vector_apply_BinaryOp2nd_FP64 (r, NULL, NULL,
+                GrB_TIMES_FP64, r, DAMPING, NULL)) ;
+            OK (GrB_Vector_assign_FP64 (r, NULL, GrB_PLUS_FP64,
+                (1 - DAMPING) / (double) n, GrB_ALL, n, NULL)) ;
+            t_scale += wallclock ( ) - tic ;
+
+            // delta = sum (r), to keep the pipeline honest; a full PageRank
+            // would compute the 1-norm of the change instead
+            tic = wallclock ( ) ;
+            OK (GrB_Vector_reduce_FP64 (&delta, NULL, GrB_PLUS_MONOID_FP64,
+                r, NULL)) ;
+            t_reduce += wallclock ( ) - tic ;
+        }
+
+        t_total = wallclock ( ) - t_total ;
+        printf ("pr:  trial %d n %g iters %d sum %g total %g sec"
+            " (mxv %g scale %g reduce %g)\n", trial, (double) n, iters,
+            delta, t_total, t_mxv, t_scale, t_reduce) ;
+
+        OK (GrB_Vector_free (&r)) ;
+        OK (GrB_Vector_free (&t)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // connected components: label propagation, MIN_SECOND mxv, MIN eWiseAdd
+    //--------------------------------------------------------------------------
+
+    for (int trial = 0 ; trial < trials ; trial++)
+    {
+        double t_mxv = 0, t_min = 0, t_check = 0 ;
+        double t_total = wallclock ( ) ;
+
+        // labels = 0:n-1, dense
+        OK (GrB_Vector_new (&labels, GrB_INT64, n)) ;
+        OK (GrB_Vector_new (&lnew, GrB_INT64, n)) ;
+        OK (GrB_Vector_new (&same, GrB_BOOL, n)) ;
+        OK (GrB_Vector_assign_INT64 (labels, NULL, NULL, 0, GrB_ALL, n,
+            NULL)) ;
+        OK (GrB_Vector_apply_IndexOp_INT64 (labels, NULL, NULL,
+            GrB_ROWINDEX_INT64, labels, 0, NULL)) ;
+
+        int iters = 0 ;
+        bool done = false ;
+        while (!done)
+        {
+            iters++ ;
+
+            // lnew = min (labels of the neighbors of each vertex)
+            tic = wallclock ( ) ;
+            OK (GrB_mxv (lnew, NULL, NULL, GrB_MIN_SECOND_SEMIRING_INT64,
+                AB, labels, NULL)) ;
+            t_mxv += wallclock ( ) - tic ;
+
+            // lnew = min (lnew, labels): the min-reduction assign
+            tic = wallclock ( ) ;
+            OK (GrB_eWiseAdd (lnew, NULL, NULL, GrB_MIN_INT64, lnew, labels,
+                NULL)) ;
+            t_min += wallclock ( ) - tic ;
+
+            // done if no label changed
+            tic = wallclock ( ) ;
+            OK (GrB_eWiseMult (same, NULL, NULL, GrB_EQ_INT64, lnew, labels,
+                NULL)) ;
+            OK (GrB_Vector_reduce_BOOL (&done, NULL, GrB_LAND_MONOID_BOOL,
+                same, NULL)) ;
+            t_check += wallclock ( ) - tic ;
+
+            // labels = lnew, by swapping the two vectors
+            GrB_Vector tmp = labels ; labels = lnew ; lnew = tmp ;
+        }
+
+        // count the components: entries whose label equals their index
+        GrB_Index ncomponents = 0 ;
+        OK (GrB_Vector_apply_IndexOp_INT64 (lnew, NULL, NULL,
+            GrB_ROWINDEX_INT64, labels, 0, NULL)) ;
+        OK (GrB_eWiseMult (same, NULL, NULL, GrB_EQ_INT64, labels, lnew,
+            NULL)) ;
+        OK (GrB_Vector_select_BOOL (same, NULL, NULL, GrB_VALUEEQ_BOOL,
+            same, true, NULL)) ;
+        OK (GrB_Vector_nvals (&ncomponents, same)) ;
+
+        t_total = wallclock ( ) - t_total ;
+        printf ("cc:  trial %d n %g iters %d components %g total %g sec"
+            " (mxv %g min %g check %g)\n", trial, (double) n, iters,
+            (double) ncomponents, t_total, t_mxv, t_min, t_check) ;
+
+        OK (GrB_Vector_free (&labels)) ;
+        OK (GrB_Vector_free (&lnew)) ;
+        OK (GrB_Vector_free (&same)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and finalize
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GrB_finalize ( ) ;
+    return (0) ;
+}
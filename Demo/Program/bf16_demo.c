@@ -0,0 +1,274 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/bf16_demo: bfloat16 storage with float32 compute
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A bfloat16 value is the top 16 bits of an IEEE float32: same exponent
+// range, 8 explicit bits of significand.  Matrices that tolerate the reduced
+// precision (embeddings, iterative methods with refinement) can then be
+// stored in half the memory of FP32, doubling the effective bandwidth of
+// memory-bound kernels such as the dot-product and saxpy matrix multiplies.
+
+// GraphBLAS has no built-in bfloat16 type, but none is needed: this demo
+// defines bf16 as a 2-byte user-defined type whose operators widen to
+// float32, compute in float32, and round the result back to bf16.  With the
+// JIT enabled the operator definitions below are compiled into the kernels,
+// so the widening is a shift in a register, not a function call; the values
+// array Ax holds 2 bytes per entry throughout.
+
+// The demo builds a random FP32 matrix, stores it both as GrB_FP32 and as
+// bf16, multiplies each representation with the PLUS_TIMES semiring, and
+// reports the relative error and the memory used by each representation.
+
+#include "GraphBLAS.h"
+#undef I
+#include "simple_rand.h"
+#include "simple_rand.c"
+
+#if defined __GNUC__
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+
+//------------------------------------------------------------------------------
+// the bf16 type
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    uint16_t bits ;             // the top 16 bits of a float32
+}
+bf16 ;
+
+// repeat the typedef as a string, to give to GraphBLAS
+#define BF16_DEFN               \
+"typedef struct "               \
+"{ "                            \
+   "uint16_t bits ; "           \
+"} "                            \
+"bf16 ;"
+
+GrB_Type BF16 = NULL ;          // GraphBLAS version of bf16
+
+//------------------------------------------------------------------------------
+// bf16 <-> float32 conversions
+//------------------------------------------------------------------------------
+
+// Widening is a 16-bit shift.  Narrowing rounds to nearest, ties to even, by
+// adding 0x7FFF plus the lowest kept bit before truncating; NaN payloads are
+// preserved well enough for this demo (a NaN stays a NaN).
+
+float bf16_to_fp32 (bf16 x)
+{
+    uint32_t u = ((uint32_t) x.bits) << 16 ;
+    float f ;
+    memcpy (&f, &u, sizeof (f)) ;
+    return (f) ;
+}
+
+bf16 fp32_to_bf16 (float f)
+{
+    uint32_t u ;
+    memcpy (&u, &f, sizeof (u)) ;
+    u += 0x7FFF + ((u >> 16) & 1) ;
+    bf16 z ;
+    z.bits = (uint16_t) (u >> 16) ;
+    return (z) ;
+}
+
+//------------------------------------------------------------------------------
+// bf16 operators: widen, compute in float32, round back
+//------------------------------------------------------------------------------
+
+void bf16_add (bf16 *z, const bf16 *x, const bf16 *y)
+{
+    *z = fp32_to_bf16 (bf16_to_fp32 (*x) + bf16_to_fp32 (*y)) ;
+}
+
+#define BF16_ADD_DEFN                                                       \
+"void bf16_add (bf16 *z, const bf16 *x, const bf16 *y)                  \n" \
+"{                                                                      \n" \
+"    uint32_t xu = ((uint32_t) x->bits) << 16 ;                         \n" \
+"    uint32_t yu = ((uint32_t) y->bits) << 16 ;                         \n" \
+"    float xf, yf ;                                                     \n" \
+"    memcpy (&xf, &xu, sizeof (xf)) ;                                   \n" \
+"    memcpy (&yf, &yu, sizeof (yf)) ;                                   \n" \
+"    float zf = xf + yf ;                                               \n" \
+"    uint32_t zu ;                                                      \n" \
+"    memcpy (&zu, &zf, sizeof (zu)) ;                                   \n" \
+"    zu += 0x7FFF + ((zu >> 16) & 1) ;                                  \n" \
+"    z->bits = (uint16_t) (zu >> 16) ;                                  \n" \
+"}"
+
+void bf16_mult (bf16 *z, const bf16 *x, const bf16 *y)
+{
+    *z = fp32_to_bf16 (bf16_to_fp32 (*x) * bf16_to_fp32 (*y)) ;
+}
+
+#define BF16_MULT_DEFN                                                      \
+"void bf16_mult (bf16 *z, const bf16 *x, const bf16 *y)                 \n" \
+"{                                                                      \n" \
+"    uint32_t xu = ((uint32_t) x->bits) << 16 ;                         \n" \
+"    uint32_t yu = ((uint32_t) y->bits) << 16 ;                         \n" \
+"    float xf, yf ;                                                     \n" \
+"    memcpy (&xf, &xu, sizeof (xf)) ;                                   \n" \
+"    memcpy (&yf, &yu, sizeof (yf)) ;                                   \n" \
+"    float zf = xf * yf ;                                               \n" \
+"    uint32_t zu ;                                                      \n" \
+"    memcpy (&zu, &zf, sizeof (zu)) ;                                   \n" \
+"    zu += 0x7FFF + ((zu >> 16) & 1) ;                                  \n" \
+"    z->bits = (uint16_t) (zu >> 16) ;                                  \n" \
+"}"
+
+//------------------------------------------------------------------------------
+// error handling: the same approach as the other demos
+//------------------------------------------------------------------------------
+
+#define OK(x)                                                   \
+{                                                               \
+    if (!(x))                                                   \
+    {                                                           \
+        printf ("info: %d error! File %s, Line %d\n",           \
+            info, __FILE__, __LINE__)  ;                        \
+        fflush (stdout) ;                                       \
+        abort ( ) ;                                             \
+    }                                                           \
+}
+
+#define TRY(method)             \
+{                               \
+    info = (method) ;           \
+    OK (info == GrB_SUCCESS) ;  \
+}
+
+//------------------------------------------------------------------------------
+// bf16 main program
+//------------------------------------------------------------------------------
+
+int main (int argc, char **argv)
+{
+
+    //--------------------------------------------------------------------------
+    // start GraphBLAS, and create the bf16 type and its PLUS_TIMES semiring
+    //--------------------------------------------------------------------------
+
+    GrB_Info info = GrB_SUCCESS ;
+    TRY (GrB_init (GrB_NONBLOCKING)) ;
+    printf ("bf16 demo: bfloat16 storage, float32 compute\n") ;
+
+    GrB_BinaryOp AddBF16 = NULL, MultBF16 = NULL ;
+    GrB_Monoid AddMonoid = NULL ;
+    GrB_Semiring PlusTimesBF16 = NULL ;
+
+    TRY (GxB_Type_new (&BF16, sizeof (bf16), "bf16", BF16_DEFN)) ;
+    TRY (GxB_BinaryOp_new (&AddBF16, (void *) bf16_add,
+        BF16, BF16, BF16, "bf16_add", BF16_ADD_DEFN)) ;
+    TRY (GxB_BinaryOp_new (&MultBF16, (void *) bf16_mult,
+        BF16, BF16, BF16, "bf16_mult", BF16_MULT_DEFN)) ;
+
+    bf16 zero ;
+    zero.bits = 0 ;
+    TRY (GrB_Monoid_new_UDT (&AddMonoid, AddBF16, &zero)) ;
+    TRY (GrB_Semiring_new (&PlusTimesBF16, AddMonoid, MultBF16)) ;
+
+    //--------------------------------------------------------------------------
+    // create a random n-by-n FP32 matrix and its bf16 representation
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = 200 ;
+    if (argc > 1)
+    {
+        n = (GrB_Index) atoll (argv [1]) ;
+    }
+
+    GrB_Matrix A = NULL, Ab = NULL, C = NULL, Cb = NULL ;
+    TRY (GrB_Matrix_new (&A,  GrB_FP32, n, n)) ;
+    TRY (GrB_Matrix_new (&Ab, BF16,     n, n)) ;
+
+    simple_rand_seed (1) ;
+    for (GrB_Index i = 0 ; i < n ; i++)
+    {
+        for (GrB_Index j = 0 ; j < n ; j++)
+        {
+            // about 25% dense, with values in [-1,1]
+            if (simple_rand ( ) % 4 != 0) continue ;
+            float aij = 2 * ((float) simple_rand_x ( )) - 1 ;
+            bf16 bij = fp32_to_bf16 (aij) ;
+            // store the same (rounded) value in both representations
+            TRY (GrB_Matrix_setElement_FP32 (A, bf16_to_fp32 (bij), i, j)) ;
+            TRY (GrB_Matrix_setElement_UDT (Ab, &bij, i, j)) ;
+        }
+    }
+
+    GrB_Index nvals ;
+    TRY (GrB_Matrix_nvals (&nvals, A)) ;
+    TRY (GrB_Matrix_wait (Ab, GrB_MATERIALIZE)) ;
+
+    size_t size32, size16 ;
+    TRY (GxB_Matrix_memoryUsage (&size32, A)) ;
+    TRY (GxB_Matrix_memoryUsage (&size16, Ab)) ;
+    printf ("n %g, nvals %g\n", (double) n, (double) nvals) ;
+    printf ("memory for A as FP32: %g bytes\n", (double) size32) ;
+    printf ("memory for A as bf16: %g bytes\n", (double) size16) ;
+
+    //--------------------------------------------------------------------------
+    // C = A*A in FP32, Cb = Ab*Ab in bf16
+    //--------------------------------------------------------------------------
+
+    TRY (GrB_Matrix_new (&C,  GrB_FP32, n, n)) ;
+    TRY (GrB_Matrix_new (&Cb, BF16,     n, n)) ;
+    TRY (GrB_mxm (C,  NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP32, A,  A,
+        NULL)) ;
+    TRY (GrB_mxm (Cb, NULL, NULL, PlusTimesBF16, Ab, Ab, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // compare: the bf16 result has about 2 to 3 digits of accuracy
+    //--------------------------------------------------------------------------
+
+    double anorm = 0, enorm = 0 ;
+    for (GrB_Index i = 0 ; i < n ; i++)
+    {
+        for (GrB_Index j = 0 ; j < n ; j++)
+        {
+            float cij ;
+            bf16 bij ;
+            info = GrB_Matrix_extractElement_FP32 (&cij, C, i, j) ;
+            if (info == GrB_NO_VALUE) continue ;
+            OK (info == GrB_SUCCESS) ;
+            TRY (GrB_Matrix_extractElement_UDT (&bij, Cb, i, j)) ;
+            double e = fabs ((double) (bf16_to_fp32 (bij) - cij)) ;
+            double a = fabs ((double) cij) ;
+            anorm = (a > anorm) ? a : anorm ;
+            enorm = (e > enorm) ? e : enorm ;
+        }
+    }
+
+    double relerr = (anorm > 0) ? (enorm / anorm) : enorm ;
+    printf ("max norm of FP32 result: %g\n", anorm) ;
+    printf ("max norm of bf16 error:  %g\n", enorm) ;
+    printf ("relative error: %g\n", relerr) ;
+
+    // bf16 has an 8-bit significand; anything better than 2^-6 relative
+    // error on this mildly ill-conditioned product is a pass
+    OK (relerr < 0.015625) ;
+    printf ("bf16 demo: all tests passed\n") ;
+
+    //--------------------------------------------------------------------------
+    // free everything and finish
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&Ab) ;
+    GrB_Matrix_free (&C) ;
+    GrB_Matrix_free (&Cb) ;
+    GrB_Semiring_free (&PlusTimesBF16) ;
+    GrB_Monoid_free (&AddMonoid) ;
+    GrB_BinaryOp_free (&AddBF16) ;
+    GrB_BinaryOp_free (&MultBF16) ;
+    GrB_Type_free (&BF16) ;
+    GrB_finalize ( ) ;
+    return (0) ;
+}
@@ -0,0 +1,143 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/context_scale_demo: multi-Context mxv scaling
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// context_demo measures nested parallelism: a few user threads, each building
+// its own matrix with an inner thread team.  This benchmark measures the
+// orthogonal axis: many user threads, each engaging its own GxB_Context and
+// each running a long stream of serial GrB_mxv calls over one shared
+// read-only matrix.  Per-call work is deliberately small and the matrix is
+// never modified, so the aggregate throughput is limited only by the shared
+// library state touched on every call: the global option reads in
+// GB_Global.c, and the jitifyer lock taken on each kernel lookup.  A flat
+// throughput curve as the user-thread count doubles means those paths scale;
+// a drooping one shows the contention a many-tenant server sees.
+
+#include "GraphBLAS.h"
+#undef I
+#include "simple_rand.h"
+#include "simple_rand.c"
+#define MIN(x,y) ((x) < (y)) ? (x) : (y)
+#ifdef _OPENMP
+#include <omp.h>
+#define TIMER omp_get_wtime ( )
+#else
+#define TIMER 0
+#endif
+
+#undef  OK
+#define OK(method)                                                      \
+{                                                                       \
+    GrB_Info info = (method) ;                                          \
+    if (info != GrB_SUCCESS)                                            \
+    {                                                                   \
+        printf ("abort at line: %d, info: %d\n", __LINE__, info) ;      \
+        abort ( ) ;                                                     \
+    }                                                                   \
+}
+
+int main (int argc, char **argv)
+{
+#if defined ( _MSC_VER ) || !defined ( _OPENMP )
+    printf ("context_scale_demo: requires OpenMP\n") ;
+#else
+
+    // start GraphBLAS
+    OK (GrB_init (GrB_NONBLOCKING)) ;
+
+    int nthreads_max = 0 ;
+    OK (GxB_Global_Option_get (GxB_GLOBAL_NTHREADS, &nthreads_max)) ;
+    nthreads_max = MIN (nthreads_max, 256) ;
+    printf ("context_scale_demo: nthreads_max %d\n", nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // build one shared read-only matrix and input vector
+    //--------------------------------------------------------------------------
+
+    // small enough that one mxv is a short call (the per-call overhead is
+    // what is being measured), large enough not to sit entirely in L1
+    GrB_Index n = 10000 ;
+    GrB_Index nvals = 200000 ;
+    int iters = 2000 ;          // mxv calls per user thread per trial
+    if (argc > 1) iters = atoi (argv [1]) ;
+
+    simple_rand_seed (1) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector x = NULL ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    for (GrB_Index k = 0 ; k < nvals ; k++)
+    {
+        GrB_Index i = simple_rand_i ( ) % n ;
+        GrB_Index j = simple_rand_i ( ) % n ;
+        OK (GrB_Matrix_setElement_FP64 (A, simple_rand_x ( ), i, j)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Vector_new (&x, GrB_FP64, n)) ;
+    OK (GrB_Vector_assign_FP64 (x, NULL, NULL, 1.0, GrB_ALL, n, NULL)) ;
+    OK (GrB_Vector_wait (x, GrB_MATERIALIZE)) ;
+
+    OK (GrB_Matrix_nvals (&nvals, A)) ;
+    printf ("n %g, nvals %g, %d mxv calls per thread per trial\n",
+        (double) n, (double) nvals, iters) ;
+
+    //--------------------------------------------------------------------------
+    // aggregate serial-mxv throughput vs # of user threads
+    //--------------------------------------------------------------------------
+
+    printf ("\n  user threads        time    mxv/sec  efficiency\n") ;
+    double rate1 = 0 ;
+
+    for (int nusers = 1 ; nusers <= nthreads_max ; nusers *= 2)
+    {
+        double t = TIMER ;
+
+        #pragma omp parallel num_threads (nusers)
+        {
+            // each user thread engages its own serial Context
+            GxB_Context Context = NULL ;
+            OK (GxB_Context_new (&Context)) ;
+            OK (GxB_Context_set (Context, GxB_NTHREADS, 1)) ;
+            OK (GxB_Context_engage (Context)) ;
+
+            // a stream of serial y = A*x calls over the shared matrix
+            GrB_Vector y = NULL ;
+            OK (GrB_Vector_new (&y, GrB_FP64, n)) ;
+            for (int k = 0 ; k < iters ; k++)
+            {
+                OK (GrB_mxv (y, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+                    A, x, NULL)) ;
+            }
+
+            // keep the result alive so the calls cannot be elided
+            double check = 0 ;
+            OK (GrB_Vector_reduce_FP64 (&check, NULL, GrB_PLUS_MONOID_FP64,
+                y, NULL)) ;
+            if (check < 0) printf ("unexpected: %g\n", check) ;
+
+            OK (GrB_Vector_free (&y)) ;
+            OK (GxB_Context_disengage (Context)) ;
+            OK (GxB_Context_free (&Context)) ;
+        }
+
+        t = TIMER - t ;
+        double rate = ((double) nusers) * ((double) iters) / t ;
+        if (nusers == 1) rate1 = rate ;
+        printf ("      %8d    %8.4f   %8.0f    %8.3f\n",
+            nusers, t, rate, rate / (rate1 * nusers)) ;
+    }
+
+    printf ("\nefficiency is aggregate throughput relative to perfect\n"
+        "scaling of the single-thread rate; a droop as the user-thread\n"
+        "count grows is contention on shared library state\n") ;
+
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Vector_free (&x)) ;
+    OK (GrB_finalize ( )) ;
+#endif
+    return (0) ;
+}
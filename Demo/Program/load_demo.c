@@ -0,0 +1,118 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/load_demo.c: benchmark the parallel matrix loaders
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Reads a Matrix Market file with the parallel loader in load_matrix.c and
+// reports the wall clock time.  If a second filename is given, the matrix is
+// also written to that file in the raw binary format, read back, checked
+// against the original, and the binary read time is reported as well.
+//
+// Usage:
+//
+//      load_demo file.mtx [file.grb]
+
+#include "graphblas_demos.h"
+#include "load_matrix.c"
+#include "isequal.c"
+#include <time.h>
+
+// macro used by OK(...) to free workspace if an error occurs
+#undef  FREE_ALL
+#define FREE_ALL                    \
+    GrB_Matrix_free (&A) ;          \
+    GrB_Matrix_free (&B) ;          \
+    if (f != NULL) fclose (f) ;
+
+// isequal.c redefines OK for its own use; restore the standard version
+#undef  OK
+#define OK(method)                                                      \
+{                                                                       \
+    info = method ;                                                     \
+    if (!(info == GrB_SUCCESS || info == GrB_NO_VALUE))                 \
+    {                                                                   \
+        printf ("GraphBLAS error: %d\n", info) ;                        \
+        CHECK (false, info) ;                                           \
+    }                                                                   \
+}
+
+//------------------------------------------------------------------------------
+// wallclock: high-resolution wall clock time, in seconds
+//------------------------------------------------------------------------------
+
+static double wallclock (void)
+{
+    struct timespec t ;
+    timespec_get (&t, TIME_UTC) ;
+    return ((double) t.tv_sec + 1e-9 * (double) t.tv_nsec) ;
+}
+
+//------------------------------------------------------------------------------
+// load_demo main program
+//------------------------------------------------------------------------------
+
+int main (int argc, char **argv)
+{
+    GrB_Matrix A = NULL, B = NULL ;
+    FILE *f = NULL ;
+    GrB_Info info ;
+    OK (GrB_init (GrB_NONBLOCKING)) ;
+
+    if (argc < 2)
+    {
+        fprintf (stderr, "usage: load_demo file.mtx [file.grb]\n") ;
+        GrB_finalize ( ) ;
+        return (1) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // read the Matrix Market file
+    //--------------------------------------------------------------------------
+
+    f = fopen (argv [1], "r") ;
+    CHECK (f != NULL, GrB_INVALID_VALUE) ;
+    double t = wallclock ( ) ;
+    OK (mm_read_matrix (&A, f, true)) ;
+    t = wallclock ( ) - t ;
+    fclose (f) ;
+    f = NULL ;
+    printf ("Matrix Market read time: %g sec\n", t) ;
+
+    //--------------------------------------------------------------------------
+    // round-trip through the binary format, if requested
+    //--------------------------------------------------------------------------
+
+    if (argc > 2)
+    {
+        f = fopen (argv [2], "wb") ;
+        CHECK (f != NULL, GrB_INVALID_VALUE) ;
+        t = wallclock ( ) ;
+        OK (bin_write_matrix (A, f)) ;
+        t = wallclock ( ) - t ;
+        fclose (f) ;
+        f = NULL ;
+        printf ("binary write time:       %g sec\n", t) ;
+
+        f = fopen (argv [2], "rb") ;
+        CHECK (f != NULL, GrB_INVALID_VALUE) ;
+        t = wallclock ( ) ;
+        OK (bin_read_matrix (&B, f, true)) ;
+        t = wallclock ( ) - t ;
+        fclose (f) ;
+        f = NULL ;
+        printf ("binary read time:        %g sec\n", t) ;
+
+        bool same = false ;
+        OK (isequal (&same, A, B, NULL)) ;
+        CHECK (same, GrB_INVALID_VALUE) ;
+        printf ("binary round-trip: ok\n") ;
+    }
+
+    FREE_ALL ;
+    GrB_finalize ( ) ;
+    return (0) ;
+}
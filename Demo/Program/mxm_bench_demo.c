@@ -0,0 +1,227 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/mxm_bench_demo.c: benchmark all C=A*B methods
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Systematically sweeps GrB_mxm across the methods that select the internal
+// kernels (dot2, dot3, dot4, saxpy3, saxpy4, saxpy5, and saxbit), across a
+// range of densities, with and without a mask, with and without accumulation
+// into a dense matrix, and across a set of thread counts.  The results are
+// written to stdout as CSV, one row per trial, so that successive releases
+// can be compared mechanically:
+//
+//      case,method,masked,accum,tran,n,da,db,nthreads,trial,time,cnvals
+//
+// Usage:
+//
+//      mxm_bench_demo n trials nthreads1 nthreads2 ...
+//
+// All arguments are optional; the defaults are n = 1000, trials = 3, and the
+// current default number of threads.  Status is printed to stderr so stdout
+// remains pure CSV.
+
+#include "graphblas_demos.h"
+#include "simple_rand.h"
+#include "simple_rand.c"
+#include "usercomplex.h"
+#include "usercomplex.c"
+#include "random_matrix.c"
+#include <time.h>
+
+// macro used by OK(...) to free workspace if an error occurs
+#undef  FREE_ALL
+#define FREE_ALL                    \
+    GrB_Matrix_free (&A) ;          \
+    GrB_Matrix_free (&B) ;          \
+    GrB_Matrix_free (&C) ;          \
+    GrB_Matrix_free (&F) ;          \
+    GrB_Matrix_free (&M) ;          \
+    GrB_Descriptor_free (&desc) ;
+
+//------------------------------------------------------------------------------
+// wallclock: high-resolution wall clock time, in seconds
+//------------------------------------------------------------------------------
+
+static double wallclock (void)
+{
+    struct timespec t ;
+    timespec_get (&t, TIME_UTC) ;
+    return ((double) t.tv_sec + 1e-9 * (double) t.tv_nsec) ;
+}
+
+//------------------------------------------------------------------------------
+// mxm_bench_demo main program
+//------------------------------------------------------------------------------
+
+int main (int argc, char **argv)
+{
+    GrB_Matrix A = NULL, B = NULL, C = NULL, F = NULL, M = NULL ;
+    GrB_Descriptor desc = NULL ;
+    GrB_Info info ;
+    OK (GrB_init (GrB_NONBLOCKING)) ;
+
+    //--------------------------------------------------------------------------
+    // get inputs
+    //--------------------------------------------------------------------------
+
+    int64_t n = 1000 ;
+    int trials = 3 ;
+    if (argc > 1) n = strtol (argv [1], NULL, 0) ;
+    if (argc > 2) trials = (int) strtol (argv [2], NULL, 0) ;
+
+    #define NTHREADS_MAX 64
+    int Nthreads [NTHREADS_MAX] ;
+    int nthreads_sets = 0 ;
+    for (int k = 3 ; k < argc && nthreads_sets < NTHREADS_MAX ; k++)
+    {
+        Nthreads [nthreads_sets++] = (int) strtol (argv [k], NULL, 0) ;
+    }
+    if (nthreads_sets == 0)
+    {
+        // default: just the current default number of threads
+        OK (GxB_Global_Option_get (GxB_GLOBAL_NTHREADS,
+            &(Nthreads [0]))) ;
+        nthreads_sets = 1 ;
+    }
+
+    fprintf (stderr, "mxm_bench: n %g trials %d thread sets %d\n",
+        (double) n, trials, nthreads_sets) ;
+
+    // the density sweep for the input matrices A and B
+    double Density [4] = { 0.001, 0.01, 0.1, 0.5 } ;
+
+    // the descriptor-selectable methods
+    GrB_Desc_Value Method [4] =
+        { GxB_DEFAULT, GxB_AxB_GUSTAVSON, GxB_AxB_HASH, GxB_AxB_DOT } ;
+    const char *Method_name [4] =
+        { "default", "gustavson", "hash", "dot" } ;
+
+    printf ("case,method,masked,accum,tran,n,da,db,nthreads,trial,"
+        "time,cnvals\n") ;
+
+    //--------------------------------------------------------------------------
+    // sweep over thread counts and densities
+    //--------------------------------------------------------------------------
+
+    for (int t = 0 ; t < nthreads_sets ; t++)
+    {
+        int nthreads = Nthreads [t] ;
+        OK (GxB_Global_Option_set (GxB_GLOBAL_NTHREADS, nthreads)) ;
+
+        for (int d = 0 ; d < 4 ; d++)
+        {
+            double density = Density [d] ;
+            int64_t ntuples = (int64_t) (density * ((double) n) *
+                ((double) n)) ;
+
+            // A and B: random n-by-n matrices with about ntuples entries
+            simple_rand_seed (1) ;
+            OK (random_matrix (&A, false, false, n, n, ntuples, 0, false)) ;
+            OK (random_matrix (&B, false, false, n, n, ntuples, 0, false)) ;
+            // M: a coarse random mask, about 1% dense
+            OK (random_matrix (&M, false, false, n, n,
+                (int64_t) (0.01 * ((double) n) * ((double) n)), 0, false)) ;
+            // F: a dense n-by-n matrix, the target of C+=A*B
+            OK (GrB_Matrix_new (&F, GrB_FP64, n, n)) ;
+            OK (GrB_Matrix_assign_FP64 (F, NULL, NULL, (double) 1,
+                GrB_ALL, n, GrB_ALL, n, NULL)) ;
+            OK (GrB_Matrix_wait (F, GrB_MATERIALIZE)) ;
+
+            //------------------------------------------------------------------
+            // C=A*B and C<M>=A*B, for each descriptor-selectable method
+            //------------------------------------------------------------------
+
+            for (int masked = 0 ; masked <= 1 ; masked++)
+            {
+                for (int m = 0 ; m < 4 ; m++)
+                {
+                    OK (GrB_Descriptor_new (&desc)) ;
+                    OK (GxB_Desc_set (desc, GxB_AxB_METHOD, Method [m])) ;
+                    for (int trial = 0 ; trial < trials ; trial++)
+                    {
+                        OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+                        double tstart = wallclock ( ) ;
+                        OK (GrB_mxm (C, masked ? M : NULL, NULL,
+                            GrB_PLUS_TIMES_SEMIRING_FP64, A, B, desc)) ;
+                        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+                        double ttot = wallclock ( ) - tstart ;
+                        GrB_Index cnvals ;
+                        OK (GrB_Matrix_nvals (&cnvals, C)) ;
+                        printf ("mxm,%s,%d,0,0,%g,%g,%g,%d,%d,%.6g,%g\n",
+                            Method_name [m], masked, (double) n, density,
+                            density, nthreads, trial, ttot,
+                            (double) cnvals) ;
+                        GrB_Matrix_free (&C) ;
+                    }
+                    GrB_Descriptor_free (&desc) ;
+                }
+            }
+
+            //------------------------------------------------------------------
+            // F+=A'*B and F+=A*B: accumulation into a dense matrix
+            //------------------------------------------------------------------
+
+            // F+=A'*B selects the dot4 kernel; F+=A*B selects saxpy4 (or
+            // saxpy5 when A is bitmap/full), with no copy of F per trial
+            // since the result stays dense
+
+            for (int tran = 0 ; tran <= 1 ; tran++)
+            {
+                OK (GrB_Descriptor_new (&desc)) ;
+                if (tran)
+                {
+                    OK (GxB_Desc_set (desc, GrB_INP0, GrB_TRAN)) ;
+                }
+                for (int trial = 0 ; trial < trials ; trial++)
+                {
+                    double tstart = wallclock ( ) ;
+                    OK (GrB_mxm (F, NULL, GrB_PLUS_FP64,
+                        GrB_PLUS_TIMES_SEMIRING_FP64, A, B, desc)) ;
+                    OK (GrB_Matrix_wait (F, GrB_MATERIALIZE)) ;
+                    double ttot = wallclock ( ) - tstart ;
+                    GrB_Index cnvals ;
+                    OK (GrB_Matrix_nvals (&cnvals, F)) ;
+                    printf ("mxm_accum,default,0,1,%d,%g,%g,%g,%d,%d,"
+                        "%.6g,%g\n", tran, (double) n, density, density,
+                        nthreads, trial, ttot, (double) cnvals) ;
+                }
+                GrB_Descriptor_free (&desc) ;
+            }
+
+            //------------------------------------------------------------------
+            // C=A*F: a bitmap/full B selects the saxbit kernel
+            //------------------------------------------------------------------
+
+            for (int trial = 0 ; trial < trials ; trial++)
+            {
+                OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+                double tstart = wallclock ( ) ;
+                OK (GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+                    A, F, NULL)) ;
+                OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+                double ttot = wallclock ( ) - tstart ;
+                GrB_Index cnvals ;
+                OK (GrB_Matrix_nvals (&cnvals, C)) ;
+                printf ("mxm_dense_b,default,0,0,0,%g,%g,1,%d,%d,%.6g,%g\n",
+                    (double) n, density, nthreads, trial, ttot,
+                    (double) cnvals) ;
+                GrB_Matrix_free (&C) ;
+            }
+
+            GrB_Matrix_free (&A) ;
+            GrB_Matrix_free (&B) ;
+            GrB_Matrix_free (&M) ;
+            GrB_Matrix_free (&F) ;
+        }
+    }
+
+    FREE_ALL ;
+    OK (GrB_finalize ( )) ;
+    fprintf (stderr, "mxm_bench: all tests passed\n") ;
+    return (0) ;
+}
+
@@ -0,0 +1,135 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/oocmxm_demo.c: test the out-of-core tiled C=A*B
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Computes C=A*B for a random matrix twice: with a single in-memory GrB_mxm,
+// and with the out-of-core tiled engine in oocmxm.c, which holds A only as a
+// grid of serialized tiles.  The two results are compared (the sums are
+// associated differently, so they agree only to roundoff), and the times of
+// both methods are reported.
+//
+// Usage:
+//
+//      oocmxm_demo n ntiles nedges
+//
+// All arguments are optional; the defaults are n = 10000, ntiles = 4, and
+// nedges = 100*n.
+
+#include "graphblas_demos.h"
+#include "simple_rand.h"
+#include "simple_rand.c"
+#include "usercomplex.h"
+#include "usercomplex.c"
+#include "random_matrix.c"
+#include "oocmxm.c"
+#include <time.h>
+
+// macro used by OK(...) to free workspace if an error occurs
+#undef  FREE_ALL
+#define FREE_ALL                    \
+    GrB_Matrix_free (&A) ;          \
+    GrB_Matrix_free (&A2) ;         \
+    GrB_Matrix_free (&B) ;          \
+    GrB_Matrix_free (&C1) ;         \
+    GrB_Matrix_free (&C2) ;         \
+    GrB_Matrix_free (&E) ;
+
+// oocmxm.c and random_matrix.c redefine OK for their own use; restore it
+#undef  OK
+#define OK(method)                                                      \
+{                                                                       \
+    info = method ;                                                     \
+    if (!(info == GrB_SUCCESS || info == GrB_NO_VALUE))                 \
+    {                                                                   \
+        printf ("GraphBLAS error: %d\n", info) ;                        \
+        CHECK (false, info) ;                                           \
+    }                                                                   \
+}
+
+//------------------------------------------------------------------------------
+// wallclock: high-resolution wall clock time, in seconds
+//------------------------------------------------------------------------------
+
+static double wallclock (void)
+{
+    struct timespec t ;
+    timespec_get (&t, TIME_UTC) ;
+    return ((double) t.tv_sec + 1e-9 * (double) t.tv_nsec) ;
+}
+
+//------------------------------------------------------------------------------
+// oocmxm_demo main program
+//------------------------------------------------------------------------------
+
+int main (int argc, char **argv)
+{
+    GrB_Matrix A = NULL, A2 = NULL, B = NULL, C1 = NULL, C2 = NULL, E = NULL ;
+    GrB_Info info ;
+    OK (GrB_init (GrB_NONBLOCKING)) ;
+
+    int64_t n = 10000 ;
+    int64_t ntiles = 4 ;
+    int64_t nedges = 0 ;
+    if (argc > 1) n      = strtol (argv [1], NULL, 0) ;
+    if (argc > 2) ntiles = strtol (argv [2], NULL, 0) ;
+    if (argc > 3) nedges = strtol (argv [3], NULL, 0) ;
+    if (nedges <= 0) nedges = 100 * n ;
+    printf ("oocmxm_demo: n %.16g ntiles %.16g nedges %.16g\n",
+        (double) n, (double) ntiles, (double) nedges) ;
+
+    //--------------------------------------------------------------------------
+    // create the problem: A and B random, and A2 a copy of A
+    //--------------------------------------------------------------------------
+
+    OK (random_matrix (&A, false, false, n, n, nedges, 1, false)) ;
+    OK (random_matrix (&B, false, false, n, n, nedges, 1, false)) ;
+    OK (GrB_Matrix_dup (&A2, A)) ;
+
+    //--------------------------------------------------------------------------
+    // C1 = A*B in memory, and C2 = A*B out of core
+    //--------------------------------------------------------------------------
+
+    double t1 = wallclock ( ) ;
+    OK (GrB_Matrix_new (&C1, GrB_FP64, n, n)) ;
+    OK (GrB_mxm (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B, NULL)) ;
+    GrB_Index ignore ;
+    OK (GrB_Matrix_nvals (&ignore, C1)) ;
+    t1 = wallclock ( ) - t1 ;
+    printf ("in-memory   mxm time: %g sec\n", t1) ;
+
+    double t2 = wallclock ( ) ;
+    OK (oocmxm (&C2, &A2, B, ntiles, true)) ;
+    OK (GrB_Matrix_nvals (&ignore, C2)) ;
+    t2 = wallclock ( ) - t2 ;
+    printf ("out-of-core mxm time: %g sec (including serialization)\n", t2) ;
+
+    //--------------------------------------------------------------------------
+    // check the result: the two C's must agree to roundoff
+    //--------------------------------------------------------------------------
+
+    GrB_Index nvals1, nvals2 ;
+    OK (GrB_Matrix_nvals (&nvals1, C1)) ;
+    OK (GrB_Matrix_nvals (&nvals2, C2)) ;
+    CHECK (nvals1 == nvals2, GrB_INVALID_VALUE) ;
+
+    OK (GrB_Matrix_new (&E, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_eWiseAdd_BinaryOp (E, NULL, NULL, GrB_MINUS_FP64,
+        C1, C2, NULL)) ;
+    OK (GrB_Matrix_apply (E, NULL, NULL, GrB_ABS_FP64, E, NULL)) ;
+    double err = 0, cmax = 0 ;
+    OK (GrB_Matrix_reduce_FP64 (&err, NULL, GrB_MAX_MONOID_FP64, E, NULL)) ;
+    OK (GrB_Matrix_apply (E, NULL, NULL, GrB_ABS_FP64, C1, NULL)) ;
+    OK (GrB_Matrix_reduce_FP64 (&cmax, NULL, GrB_MAX_MONOID_FP64, E, NULL)) ;
+    printf ("max abs difference: %g (max |C|: %g)\n", err, cmax) ;
+    CHECK (err <= 1e-10 * (cmax + 1), GrB_INVALID_VALUE) ;
+    printf ("oocmxm_demo: all tests passed\n") ;
+
+    FREE_ALL ;
+    GrB_finalize ( ) ;
+    return (0) ;
+}
@@ -0,0 +1,141 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/pending_demo.c: benchmark pending-tuple assembly
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Benchmark for streaming ingest: appends random batches of entries to a
+// matrix via GrB_Matrix_setElement and then assembles them with GrB_Matrix
+// _wait, timing the two steps separately.  The append time covers the growth
+// of the internal pending-tuple list; the wait time covers the builder sort
+// of the batch and the merge of the assembled batch into the matrix.  The
+// first batch waits on an empty matrix, so its wait time is the builder sort
+// alone; later batches add the merge on top, so the difference between the
+// first row and the steady state isolates the add-merge cost.  The results
+// are written to stdout as CSV, one row per batch:
+//
+//      batch,batchsize,locality,nthreads,append_time,wait_time,nvals
+//
+// Usage:
+//
+//      pending_demo n batches batchsize locality nthreads
+//
+// All arguments are optional; the defaults are n = 1 million, batches = 10,
+// batchsize = 1 million, and locality = 1.  The locality knob (0 < locality
+// <= 1) is the fraction of the row range spanned by each batch: 1 scatters
+// each batch across the whole matrix, and small values cluster each batch
+// into a narrow band of rows, which sorts and merges more cheaply.
+
+#include "graphblas_demos.h"
+#include "simple_rand.h"
+#include "simple_rand.c"
+#include <time.h>
+
+// macro used by OK(...) to free workspace if an error occurs
+#undef  FREE_ALL
+#define FREE_ALL            \
+    GrB_Matrix_free (&A) ;
+
+//------------------------------------------------------------------------------
+// wallclock: high-resolution wall clock time, in seconds
+//------------------------------------------------------------------------------
+
+static double wallclock (void)
+{
+    struct timespec t ;
+    timespec_get (&t, TIME_UTC) ;
+    return ((double) t.tv_sec + 1e-9 * (double) t.tv_nsec) ;
+}
+
+//------------------------------------------------------------------------------
+// pending_demo main program
+//------------------------------------------------------------------------------
+
+int main (int argc, char **argv)
+{
+    GrB_Matrix A = NULL ;
+    GrB_Info info ;
+    OK (GrB_init (GrB_NONBLOCKING)) ;
+
+    //--------------------------------------------------------------------------
+    // get inputs
+    //--------------------------------------------------------------------------
+
+    int64_t n = 1000000 ;
+    int batches = 10 ;
+    int64_t batchsize = 1000000 ;
+    double locality = 1 ;
+    int nthreads ;
+    if (argc > 1) n = strtol (argv [1], NULL, 0) ;
+    if (argc > 2) batches = (int) strtol (argv [2], NULL, 0) ;
+    if (argc > 3) batchsize = strtol (argv [3], NULL, 0) ;
+    if (argc > 4) locality = strtod (argv [4], NULL) ;
+    if (argc > 5)
+    {
+        nthreads = (int) strtol (argv [5], NULL, 0) ;
+        OK (GxB_Global_Option_set (GxB_GLOBAL_NTHREADS, nthreads)) ;
+    }
+    OK (GxB_Global_Option_get (GxB_GLOBAL_NTHREADS, &nthreads)) ;
+
+    if (locality <= 0 || locality > 1) locality = 1 ;
+    int64_t span = (int64_t) (locality * ((double) n)) ;
+    if (span < 1) span = 1 ;
+
+    fprintf (stderr, "pending: n %g batches %d batchsize %g locality %g"
+        " nthreads %d\n", (double) n, batches, (double) batchsize,
+        locality, nthreads) ;
+
+    printf ("batch,batchsize,locality,nthreads,append_time,wait_time,"
+        "nvals\n") ;
+
+    //--------------------------------------------------------------------------
+    // append and assemble each batch
+    //--------------------------------------------------------------------------
+
+    simple_rand_seed (1) ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+
+    for (int batch = 0 ; batch < batches ; batch++)
+    {
+        // each batch is clustered into a band of rows starting at base
+        int64_t base = (int64_t) (simple_rand_i ( ) % ((uint64_t) n)) ;
+        if (base + span > n) base = n - span ;
+
+        //----------------------------------------------------------------------
+        // append one batch of random entries (pending-tuple growth)
+        //----------------------------------------------------------------------
+
+        double tstart = wallclock ( ) ;
+        for (int64_t k = 0 ; k < batchsize ; k++)
+        {
+            GrB_Index i = (GrB_Index)
+                (base + (int64_t) (simple_rand_i ( ) % ((uint64_t) span))) ;
+            GrB_Index j = (GrB_Index)
+                (simple_rand_i ( ) % ((uint64_t) n)) ;
+            OK (GrB_Matrix_setElement_FP64 (A, simple_rand_x ( ), i, j)) ;
+        }
+        double tappend = wallclock ( ) - tstart ;
+
+        //----------------------------------------------------------------------
+        // assemble the batch (builder sort, and merge into the matrix)
+        //----------------------------------------------------------------------
+
+        tstart = wallclock ( ) ;
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+        double twait = wallclock ( ) - tstart ;
+
+        GrB_Index nvals ;
+        OK (GrB_Matrix_nvals (&nvals, A)) ;
+        printf ("%d,%g,%g,%d,%.6g,%.6g,%g\n", batch, (double) batchsize,
+            locality, nthreads, tappend, twait, (double) nvals) ;
+    }
+
+    FREE_ALL ;
+    OK (GrB_finalize ( )) ;
+    fprintf (stderr, "pending: all tests passed\n") ;
+    return (0) ;
+}
+
@@ -335,7 +335,9 @@ typedef enum
     GrB_INSUFFICIENT_SPACE = -103,  // output array not large enough
     GrB_INVALID_OBJECT = -104,      // object is corrupted
     GrB_INDEX_OUT_OF_BOUNDS = -105, // row or col index out of bounds
-    GrB_EMPTY_OBJECT = -106         // an object does not contain a value
+    GrB_EMPTY_OBJECT = -106,        // an object does not contain a value
+    GxB_CANCELLED = -7001           // operation cancelled via the engaged
+                                    // GxB_Context (see GxB_CONTEXT_CANCEL)
 
 }
 GrB_Info ;
@@ -491,6 +493,7 @@ typedef enum
     GxB_SORT = 7091,          // control sort in GrB_mxm
     GxB_COMPRESSION = 7092,   // select compression for serialize
     GxB_IMPORT = 7093,        // secure vs fast import
+    GxB_MXM_PATTERN_REUSE = 7094, // reuse C's pattern in GrB_mxm
 }
 GrB_Desc_Field ;
 
@@ -1320,6 +1323,16 @@ GB_GLOBAL GrB_BinaryOp
     GxB_CMPLX_FP32,
     GxB_CMPLX_FP64 ;
 
+//------------------------------------------------------------------------------
+// z=f(x,y) where z is wider than the type of x and y
+//------------------------------------------------------------------------------
+
+// GxB_TIMES_FP64_FP32 computes z = (double) (x*y) for float x and y.  It is
+// the multiplicative operator of the mixed-precision semiring
+// GxB_PLUS_FP64_TIMES_FP32: see below.
+
+GB_GLOBAL GrB_BinaryOp GxB_TIMES_FP64_FP32 ;
+
 //==============================================================================
 // positional GrB_UnaryOp and GrB_BinaryOp operators
 //==============================================================================
@@ -2574,6 +2587,26 @@ GrB_Info GxB_Vector_build_Scalar    // build a vector from (i,scalar) tuples
     GrB_Index nvals                 // number of tuples
 ) ;
 
+// GxB_Vector_append is the vector analog of GxB_Matrix_append (see below):
+// it appends a batch of (i,x) tuples to w as pending tuples, in time
+// O(batch size), and defers the single sort and assembly of all batches
+// until the vector is finalized by GrB_Vector_wait, or by any operation
+// that requires the completed vector.  It replaces a loop of
+// GrB_Vector_setElement calls, skipping the per-element searches.
+// Duplicates, within or across batches or with entries already in w, are
+// assembled with the dup operator at that point (dup == NULL acts as the
+// implied SECOND operator: the newest value wins, as with setElement).
+
+GrB_Info GxB_Vector_append      // append a batch of tuples to a vector
+(
+    GrB_Vector w,                   // vector to append to
+    const GrB_Index *Ilist,         // array of indices of tuples
+    const void *X,                  // array of values of tuples
+    GrB_Index nvals,                // number of tuples
+    const GrB_BinaryOp dup,         // op to assemble duplicates, or NULL
+    GrB_Type xtype                  // type of the X array
+) ;
+
 // Type-generic version:  X can be a pointer to any supported C type or void *
 // for a user-defined type.
 
@@ -3065,11 +3098,37 @@ GrB_Info GrB_Matrix_dup     // make an exact copy of a matrix
     const GrB_Matrix A      // input matrix to copy
 ) ;
 
+// GxB_Matrix_dup_format makes a deep copy of A conformed to a requested
+// sparsity format and (optionally) typecast to a requested type, in one
+// step; copying a sparse matrix into a bitmap C is a single scatter pass,
+// with no transient second copy.
+GrB_Info GxB_Matrix_dup_format  // C = A, conformed to a sparsity and type
+(
+    GrB_Matrix *C,              // handle of output matrix to create
+    GrB_Type ctype,             // type of C, or NULL to keep the type of A
+    int sparsity,               // target sparsity: GxB_HYPERSPARSE,
+                                // GxB_SPARSE, GxB_BITMAP, GxB_FULL, or any
+                                // combination (see GxB_SPARSITY_CONTROL)
+    const GrB_Matrix A          // input matrix to copy
+) ;
+
 GrB_Info GrB_Matrix_clear   // clear a matrix of all entries;
 (                           // type and dimensions remain unchanged
     GrB_Matrix A            // matrix to clear
 ) ;
 
+// GxB_Matrix_clear_keep removes all entries from A, like GrB_Matrix_clear,
+// but retains its internal allocations at their current capacity instead of
+// freeing them, so a scratch matrix that is filled, used, and cleared in a
+// loop frees and re-mallocs nothing between iterations (see also
+// GxB_Matrix_reserve).  The dimensions, type, and format of A are unchanged.
+// It may be called on a GrB_Vector, typecast to a GrB_Matrix.
+
+GrB_Info GxB_Matrix_clear_keep  // clear a matrix, but keep its allocations
+(
+    GrB_Matrix A            // matrix to clear
+) ;
+
 GrB_Info GrB_Matrix_nrows   // get the number of rows of a matrix
 (
     GrB_Index *nrows,       // matrix has nrows rows
@@ -3088,6 +3147,18 @@ GrB_Info GrB_Matrix_nvals   // get the number of entries in a matrix
     const GrB_Matrix A      // matrix to query
 ) ;
 
+// GxB_Matrix_nvals_estimate returns bounds [lower,upper] on the number of
+// entries in A, in O(1) time, without assembling any pending work (which
+// GrB_Matrix_nvals must do to report an exact count).  The bounds are exact
+// (lower == upper) when the matrix has no pending tuples.
+
+GrB_Info GxB_Matrix_nvals_estimate  // get bounds on the # of entries
+(
+    GrB_Index *lower,       // lower bound on the # of entries in A
+    GrB_Index *upper,       // upper bound on the # of entries in A
+    const GrB_Matrix A      // matrix to query
+) ;
+
 // NOTE: GxB_Matrix_type is historical.  Use GxB_Matrix_type_name instead.
 GrB_Info GxB_Matrix_type    // get the type of a matrix
 (
@@ -3107,12 +3178,86 @@ GrB_Info GxB_Matrix_memoryUsage  // return # of bytes used for a matrix
     const GrB_Matrix A      // matrix to query
 ) ;
 
+// GxB_Matrix_memoryUsage_breakdown reports the same total as
+// GxB_Matrix_memoryUsage, along with an array giving the deep (owned) bytes
+// held by each component of the matrix.  Shallow components (owned by another
+// matrix) are not counted.  The entries of the component array are:
+
+#define GxB_MEMORY_USAGE_HEADER      0   // the opaque matrix header
+#define GxB_MEMORY_USAGE_P           1   // A->p: vector pointers
+#define GxB_MEMORY_USAGE_H           2   // A->h: hyperlist
+#define GxB_MEMORY_USAGE_B           3   // A->b: bitmap
+#define GxB_MEMORY_USAGE_I           4   // A->i: indices
+#define GxB_MEMORY_USAGE_X           5   // A->x: values
+#define GxB_MEMORY_USAGE_PENDING     6   // pending tuples
+#define GxB_MEMORY_USAGE_HYPER_HASH  7   // A->Y: the hyper_hash matrix
+#define GxB_MEMORY_USAGE_NCOMPONENTS 8   // size of the component array
+
+GrB_Info GxB_Matrix_memoryUsage_breakdown   // # of bytes used for a matrix
+(
+    size_t *size,           // # of bytes used by the matrix A
+    // output array of size GxB_MEMORY_USAGE_NCOMPONENTS:
+    size_t component [GxB_MEMORY_USAGE_NCOMPONENTS],
+    const GrB_Matrix A      // matrix to query
+) ;
+
 GrB_Info GxB_Matrix_iso     // return iso status of a matrix
 (
     bool *iso,              // true if the matrix is iso-valued
     const GrB_Matrix A      // matrix to query
 ) ;
 
+// GxB_Matrix_prefetch asynchronously migrates the unified-memory arrays of a
+// matrix to a given GPU, or back to the CPU if device is negative.  The
+// prefetch is ordered on the given CUDA stream (a cudaStream_t cast to
+// void *; NULL uses the default stream) and does not synchronize, so the
+// migration of one matrix can be overlapped with kernels on another stream
+// or with computation on the CPU.  Pending work on the matrix is not
+// finished; the arrays it currently holds are migrated as-is.  If GraphBLAS
+// is compiled without CUDA, GrB_NOT_IMPLEMENTED is returned.
+
+GrB_Info GxB_Matrix_prefetch    // prefetch a matrix to a GPU or the CPU
+(
+    GrB_Matrix A,               // matrix to prefetch
+    int device,                 // GPU id to prefetch to, or < 0 for the CPU
+    void *stream                // cudaStream_t, or NULL for default stream
+) ;
+
+// GxB_Matrix_snapshot creates a snapshot S of a matrix A, in O(1) time and
+// memory: S shares the internal arrays of A, and each shared array is freed
+// only by its last owner.  A and S can then be used, modified, and freed
+// independently, from different user threads: an operation that replaces the
+// arrays of one of them leaves the other holding the originals, so readers
+// of the snapshot need no locks while writers update A.  Any pending work on
+// A is finished first.  Caveat: an update that modifies the values of an
+// existing array in place without reallocating it (such as GrB_setElement of
+// an entry already present, with no pending work) is visible through the
+// snapshot; take a fresh snapshot after such updates if a strict frozen view
+// is required.
+
+GrB_Info GxB_Matrix_snapshot    // create an O(1) snapshot of a matrix
+(
+    GrB_Matrix *S,              // handle of the snapshot to create
+    GrB_Matrix A                // matrix to snapshot
+) ;
+
+// GxB_Matrix_new_from_pattern creates a matrix C with the same pattern as A
+// and the given type.  C shares the pattern arrays of A as
+// GxB_Matrix_snapshot does, but has its own newly allocated values, with
+// every entry present and initialized to zero (all bits zero, for a
+// user-defined type).  A family of matrices over one immutable pattern --
+// as in a Jacobi-style iteration that rewrites the values every step --
+// thus costs one pattern plus one value array per member, instead of a full
+// dup per value-set.  C and A remain independent: each can be modified and
+// freed in any order.  Any pending work on A is finished first.
+
+GrB_Info GxB_Matrix_new_from_pattern    // C = pattern of A, new values
+(
+    GrB_Matrix *C,              // handle of matrix to create
+    GrB_Matrix A,               // matrix whose pattern C shares
+    GrB_Type type               // type of the values of C
+) ;
+
 GrB_Info GrB_Matrix_free    // free a matrix
 (
     GrB_Matrix *A           // handle of matrix to free
@@ -3274,6 +3419,187 @@ GrB_Info GxB_Matrix_build_Scalar    // build a matrix from (I,J,scalar) tuples
     GrB_Index nvals                 // number of tuples
 ) ;
 
+// GxB_Matrix_build_Sorted is identical in result to GrB_Matrix_build_* with a
+// NULL dup operator, but the caller guarantees that the tuples are already
+// sorted with no duplicates: ascending by column index with ties broken by
+// row index if C is held by column (GrB_COLMAJOR, the default), or by row
+// with ties broken by column if C is held by row.  The guarantee lets the
+// sort and the duplicate detection be skipped entirely, so the matrix is
+// assembled with a single parallel pass over the tuples.  Indices are still
+// checked against the dimensions of C, but the sorted order is trusted: if
+// the guarantee is broken the result is undefined.  The values are passed as
+// a void pointer with their type given by xtype.
+
+GrB_Info GxB_Matrix_build_Sorted    // build from sorted duplicate-free tuples
+(
+    GrB_Matrix C,                   // matrix to build
+    const GrB_Index *Ilist,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const void *X,                  // array of values of tuples
+    GrB_Index nvals,                // number of tuples
+    GrB_Type xtype                  // type of the X array
+) ;
+
+// GxB_Matrix_append appends a batch of (i,j,x) tuples to C as pending
+// tuples, in time O(batch size), without sorting or assembling them.  The
+// tuples become part of the matrix when it is finalized by GrB_Matrix_wait,
+// or by any operation that requires the completed matrix.  This supports
+// streaming ingestion: batches of tuples can be handed to GraphBLAS as they
+// arrive, and the single sort and assembly of all batches is deferred until
+// the matrix is first used.  Duplicates, within or across batches or with
+// entries already in C, are assembled with the dup operator at that point
+// (dup == NULL acts as the implied SECOND operator: the newest value wins,
+// as with GrB_Matrix_setElement).  Unlike GrB_Matrix_build, C need not be
+// empty.  The xtype and dup operator should be the same for all batches; a
+// batch with a different xtype or dup forces the prior pending tuples to be
+// assembled first.
+
+GrB_Info GxB_Matrix_append      // append a batch of tuples to a matrix
+(
+    GrB_Matrix C,                   // matrix to append to
+    const GrB_Index *Ilist,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const void *X,                  // array of values of tuples
+    GrB_Index nvals,                // number of tuples
+    const GrB_BinaryOp dup,         // op to assemble duplicates, or NULL
+    GrB_Type xtype                  // type of the X array
+) ;
+
+// GxB_Matrix_reserve pre-allocates space in A for at least nvals_hint
+// entries, so that an append-heavy workload that knows its eventual size can
+// grow to it through any number of batches without a single reallocation of
+// the index and value arrays.  The entries and pattern of A are unchanged.
+// The space is never shrunk: a hint at or below the current capacity does
+// nothing, so the method is idempotent.  A bitmap or full matrix is left
+// unchanged.  It may be called on a GrB_Vector, typecast to a GrB_Matrix.
+
+GrB_Info GxB_Matrix_reserve     // pre-allocate space in A
+(
+    GrB_Matrix A,                   // matrix to reserve space in
+    GrB_Index nvals_hint            // # of entries A should be able to hold
+) ;
+
+// GxB_Matrix_trim is the inverse of GxB_Matrix_reserve: it reallocates all
+// arrays of A to their exact required size, releasing the headroom that
+// accumulates from growth doubling, heavy deletion, or an earlier reserve.
+// Any pending work is finished first; the entries, type, dimensions, and
+// format of A are unchanged.  It may be called on a GrB_Vector, typecast to
+// a GrB_Matrix.
+
+GrB_Info GxB_Matrix_trim        // release the slack space in A
+(
+    GrB_Matrix A                    // matrix to trim
+) ;
+
+// GxB_Matrix_random and GxB_Vector_random create a new random matrix or
+// vector with nvals generated tuples.  The tuples are generated in parallel
+// with counter-based RNG streams, so the result is a pure function of the
+// arguments (including the seed) and is identical for any number of threads.
+// Two models are available for a matrix:
+//
+//      GxB_RANDOM_UNIFORM: indices uniform over nrows-by-ncols
+//      GxB_RANDOM_RMAT:    the Graph500 RMAT model, with quadrant
+//                          probabilities (a,b,c,d) = (.57,.19,.19,.05)
+//
+// A vector always uses the uniform model.  The values are uniform in [0,1),
+// typecast to the given type.  Duplicate tuples are discarded, so the result
+// can have slightly fewer than nvals entries (noticeably fewer for RMAT,
+// which is skewed by design).
+
+#define GxB_RANDOM_UNIFORM 0
+#define GxB_RANDOM_RMAT 1
+
+GrB_Info GxB_Matrix_random      // create a random matrix
+(
+    GrB_Matrix *A,              // handle of matrix to create
+    GrB_Type type,              // type of matrix to create
+    GrB_Index nrows,            // number of rows
+    GrB_Index ncols,            // number of columns
+    GrB_Index nvals,            // # of tuples to generate, before duplicates
+    int method,                 // GxB_RANDOM_UNIFORM or GxB_RANDOM_RMAT
+    uint64_t seed               // RNG seed
+) ;
+
+GrB_Info GxB_Vector_random      // create a random vector
+(
+    GrB_Vector *w,              // handle of vector to create
+    GrB_Type type,              // type of vector to create
+    GrB_Index n,                // vector length
+    GrB_Index nvals,            // # of tuples to generate, before duplicates
+    uint64_t seed               // RNG seed
+) ;
+
+// GxB_Matrix_rowScale and GxB_Matrix_colScale scale a matrix in place:
+// each entry C(i,j) is overwritten with op (D(i,i), C(i,j)) (rowScale) or
+// op (C(i,j), D(j,j)) (colScale), where D is a square diagonal matrix with
+// all diagonal entries present.  The pattern of C does not change and no
+// new matrix is allocated, unlike C = GrB_mxm (D, C), so iterated scaling
+// steps (normalizing each row of a matrix by its degree, say) touch each
+// value just once.  The ztype of op must match the type of C exactly, since
+// the result replaces the values of C; the inputs of op may be typecast.
+// Positional ops are not supported (use GrB_apply instead).
+
+GrB_Info GxB_Matrix_rowScale    // C = D*C, scale the rows of C in place
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_BinaryOp op,          // scaling operator; ztype must match C
+    const GrB_Matrix D,             // diagonal matrix of scale factors
+    const GrB_Descriptor desc       // currently unused
+) ;
+
+GrB_Info GxB_Matrix_colScale    // C = C*D, scale the columns of C in place
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_BinaryOp op,          // scaling operator; ztype must match C
+    const GrB_Matrix D,             // diagonal matrix of scale factors
+    const GrB_Descriptor desc       // currently unused
+) ;
+
+//------------------------------------------------------------------------------
+// GxB_IndexList: a reusable, pre-analyzed index list for extraction
+//------------------------------------------------------------------------------
+
+// A GxB_IndexList holds a private copy of an explicit index list together
+// with the analysis that GrB_Matrix_extract would otherwise redo on every
+// call with the same list: the index properties (min, max, sorted,
+// duplicates) and, when the list is not a contiguous range or stride, the
+// index-inverse buckets, whose construction is sequential and takes time
+// proportional to the dimension of the indexed axis.  Build the list once
+// with GxB_IndexList_new, use it in any number of calls to
+// GxB_Matrix_extract_IndexList, and free it with GxB_IndexList_free.
+
+// All indices in the list must be smaller than the limit given to
+// GxB_IndexList_new.  The cached analysis is used when extracting along an
+// axis whose dimension matches that limit; for other dimensions the list
+// still works, but is re-analyzed as a plain index array.
+
+typedef struct GB_IndexList_opaque *GxB_IndexList ;
+
+GrB_Info GxB_IndexList_new      // create a pre-analyzed index list
+(
+    GxB_IndexList *list,            // handle of index list to create
+    const GrB_Index *Ilist,         // index list to copy and analyze
+    GrB_Index ni,                   // number of indices in the list
+    GrB_Index limit                 // dimension of the axis being indexed;
+                                    // all indices must be < limit
+) ;
+
+GrB_Info GxB_IndexList_free     // free an index list
+(
+    GxB_IndexList *list             // handle of index list to free
+) ;
+
+GrB_Info GxB_Matrix_extract_IndexList   // C<M> = accum (C, A(I,J))
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_Matrix M,             // optional mask for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Matrix A,             // first input:  matrix A
+    const GxB_IndexList I_list,     // row indices; NULL means all rows
+    const GxB_IndexList J_list,     // column indices; NULL means all columns
+    const GrB_Descriptor desc       // descriptor for C, M, and A
+) ;
+
 // Type-generic version:  X can be a pointer to any supported C type or void *
 // for a user-defined type.
 
@@ -3618,6 +3944,58 @@ GrB_Info GxB_Matrix_isStoredElement // determine if A(i,j) is a stored element
     GrB_Index j                         // column index
 ) ;
 
+// GxB_Matrix_lookup_build builds a hash index over the entries of a sparse
+// or hypersparse matrix, after which GrB_Matrix_extractElement and
+// GxB_Matrix_isStoredElement find any entry (or determine its absence) in
+// O(1) expected time, instead of a binary search of its vector.  The index
+// is intended for workloads that make many random point reads of a matrix
+// that is not being modified; it is discarded whenever the pattern of the
+// matrix changes, and point reads then fall back to the binary search until
+// the index is built again.  For a bitmap or full matrix, point reads are
+// already O(1) and this method does nothing.  It may be called on a
+// GrB_Vector, typecast to a GrB_Matrix.
+
+GrB_Info GxB_Matrix_lookup_build    // build the point-lookup index of A
+(
+    GrB_Matrix A,                   // matrix to index
+    const GrB_Descriptor desc       // unused, except threading control
+) ;
+
+// GxB_Matrix_fingerprint returns a 64-bit hash of the content of the matrix,
+// for fast change detection: two queries of a matrix that was not modified
+// in between return the same fingerprint, and any modification changes it
+// (up to hash collisions).  Pending work is finished first, so matrices with
+// equal content in the same sparsity format have equal fingerprints
+// regardless of how they were constructed.  The hash is cached on the matrix
+// and invalidated by any modification, so querying an unchanged matrix is
+// O(1).  The method may be called on a GrB_Vector, typecast to GrB_Matrix.
+
+GrB_Info GxB_Matrix_fingerprint     // fingerprint of the content of A
+(
+    uint64_t *fingerprint,          // fingerprint of A
+    GrB_Matrix A                    // matrix to query
+) ;
+
+// GxB_Matrix_isStoredElements is the batch form of the above: found [k] is
+// set true iff A(Ilist[k],J[k]) is a stored element, for each of the nvals
+// probes.  If the probes are sorted by (vector, index) in the storage
+// orientation of A (by column for a CSC matrix, by row for CSR), each
+// touched vector is answered with a single merged galloping sweep instead of
+// one independent binary search per probe, which is how the probe lists of
+// an edge-existence join should be presented.  Unsorted probes are answered
+// independently in parallel, using the point-lookup index of
+// GxB_Matrix_lookup_build when it is present.
+
+GrB_Info GxB_Matrix_isStoredElements    // batched membership query on A
+(
+    bool *found,                // size nvals; found [k] = (A(I[k],J[k]) found)
+    GrB_Matrix A,               // matrix to check
+    const GrB_Index *Ilist,     // row indices of the probes, size nvals
+    const GrB_Index *J,         // column indices of the probes, size nvals
+    GrB_Index nvals,            // number of probes
+    const GrB_Descriptor desc   // unused, except threading control
+) ;
+
 //------------------------------------------------------------------------------
 // GrB_Matrix_removeElement
 //------------------------------------------------------------------------------
@@ -3853,6 +4231,145 @@ GrB_Info GxB_Matrix_split           // split a matrix into 2D array of matrices
     const GrB_Descriptor desc       // unused, except threading control
 ) ;
 
+// GxB_Matrix_merge computes C = Tiles [0] + ... + Tiles [ntiles-1], where
+// entries that appear in more than one input are assembled with the dup
+// operator.  The inputs may overlap arbitrarily, unlike GxB_Matrix_concat,
+// whose tiles must be disjoint.  All the Tiles must have the same dimensions
+// as C, and types that can be typecast to the type of C; the prior content
+// of C is discarded.  The tuples of all the inputs are assembled with a
+// single parallel sort (the engine of GrB_Matrix_build), so merging n
+// matrices makes one pass over the data instead of the n-1 passes of
+// repeated GrB_eWiseAdd.  This is the merge step of an owner-computes
+// distributed algorithm: each rank combines the partial results received
+// from its peers with its own in one call.
+
+GrB_Info GxB_Matrix_merge       // C = sum of all Tiles, in one pass
+(
+    GrB_Matrix C,               // output; prior content is discarded
+    const GrB_BinaryOp dup,     // operator to assemble duplicate entries
+    const GrB_Matrix *Tiles,    // array of size ntiles
+    GrB_Index ntiles,           // number of input matrices
+    const GrB_Descriptor desc   // unused, except threading control
+) ;
+
+// GxB_Matrix_window constructs V as a lightweight read-only view of a
+// contiguous window of A, without copying any entries.  Creating the view
+// takes time and memory proportional to the # of rows (or columns) in the
+// window, not the # of entries it covers, unlike GxB_Matrix_split, which
+// copies each tile.  The window must span whole vectors of A as it is stored:
+// if A is held by row, it selects rows row_begin:row_end-1 and the column
+// range must be all of 0:ncols-1; if A is held by column, it selects columns
+// col_begin:col_end-1 and the row range must be all of 0:nrows-1.  Otherwise,
+// GrB_INVALID_VALUE is returned.  Windows of a hypersparse matrix are not
+// supported (GrB_NOT_IMPLEMENTED); convert the parent to sparse first.
+
+// The view shares the index and value arrays of its parent A.  Freeing V
+// never frees the parent's arrays, but GraphBLAS does not reference-count
+// them: the application must treat V as read-only, and must not modify or
+// free A while any view of it is in use.  This is intended for sharding a
+// large matrix across user threads, where each thread gets a window of A in
+// O(1) space instead of a copy.
+
+GrB_Info GxB_Matrix_window      // construct a shallow window view of a matrix
+(
+    GrB_Matrix *V,              // handle of output matrix to create
+    const GrB_Matrix A,         // input matrix to view
+    GrB_Index row_begin,        // first row of the window
+    GrB_Index row_end,          // last row of the window, plus one
+    GrB_Index col_begin,        // first column of the window
+    GrB_Index col_end,          // last column of the window, plus one
+    const GrB_Descriptor desc   // unused, except threading control
+) ;
+
+// GxB_Matrix_degree computes degree(i) = # of entries in A(i,:), returned as
+// a new dense GrB_INT64 vector of length nrows(A).  The degrees are cached
+// inside A and invalidated when its pattern changes, so repeated queries on
+// an unmodified matrix cost only the copy into the output vector.  To obtain
+// column degrees, apply it to the transpose of A.
+
+GrB_Info GxB_Matrix_degree      // compute the row degrees of a matrix
+(
+    GrB_Vector *degree,         // output vector of row degrees
+    GrB_Matrix A,               // input matrix to query
+    const GrB_Descriptor desc   // unused, except threading control
+) ;
+
+// GxB_Matrix_split_iso splits A into B and E, where B is an iso matrix with
+// the same pattern as A and the single value alpha, and E holds the entries
+// of A whose value differs from alpha.  Since the pattern of E is a subset
+// of the pattern of B, the original matrix is recovered as
+// A = eWiseAdd (B, E, GrB_SECOND_T).  When nearly all entries of A share one
+// value (uniform edge weights with a few exceptions, say), keeping B and E
+// instead of A shrinks the value storage to the exception list, and
+// operations on B use the iso kernels, which read no value array at all.
+// The types of A and alpha must be compatible.  alpha must have an entry
+// (GrB_EMPTY_OBJECT otherwise), and user-defined types are not supported
+// (GrB_NOT_IMPLEMENTED), since no value-inequality operator exists for them.
+
+GrB_Info GxB_Matrix_split_iso   // split A into an iso part and exceptions
+(
+    GrB_Matrix *B,              // output iso matrix: pattern of A, value alpha
+    GrB_Matrix *E,              // output matrix of exceptions
+    const GrB_Scalar alpha,     // the dominant value of A
+    const GrB_Matrix A,         // input matrix to split
+    const GrB_Descriptor desc   // unused, except threading control
+) ;
+
+// GxB_Matrix_as_iso converts A in place to an iso matrix whose every entry
+// has the given value, typecast to the type of A.  The pattern of A is not
+// changed.  The iso format is the structure-only representation in
+// GraphBLAS: the value array shrinks to a single entry regardless of nnz(A),
+// and all kernels handle iso inputs without streaming any values.  An
+// unweighted graph held as a boolean iso matrix thus stores its pattern
+// alone, and structural semirings (LOR_LAND_BOOL, ANY_PAIR) read no value
+// memory at all.  The types of A and value must be compatible, and value
+// must have an entry (GrB_EMPTY_OBJECT otherwise).
+
+GrB_Info GxB_Matrix_as_iso      // discard the values; A becomes iso
+(
+    GrB_Matrix A,               // input/output matrix to modify in place
+    const GrB_Scalar value,     // the single value, typecast to the type of A
+    const GrB_Descriptor desc   // unused, except threading control
+) ;
+
+// GxB_Vector_gather computes y (k) = x (I (k)) for k = 0 to ni-1, where x is
+// a dense vector and I is an index list of length ni.  It is the same
+// computation as y = x (I) via GrB_extract, specialized to skip the general
+// extract machinery: a single parallel pass gathers the entries.  y is
+// rebuilt as a full vector; its length must equal ni, and its type must
+// match the type of x exactly (no typecasting).  If x is not dense,
+// GrB_INVALID_VALUE is returned; use GrB_extract instead.
+
+GrB_Info GxB_Vector_gather      // y (k) = x (I (k))
+(
+    GrB_Vector y,               // output vector, rebuilt as full
+    const GrB_Vector x,         // input vector; must be dense
+    const GrB_Index *Ilist,     // index list of length ni
+    const GrB_Index ni,         // number of indices to gather
+    const GrB_Descriptor desc   // unused, except threading control
+) ;
+
+// GxB_Vector_scatter computes y (I (k)) = x (k), or
+// y (I (k)) = accum (y (I (k)), x (k)) if accum is present, for k = 0 to
+// ni-1, where y is a dense vector and x is a dense vector of length ni.  It
+// is the same computation as y (I) = x or y (I) += x via GrB_assign,
+// specialized to a single parallel pass.  With accum, duplicate indices in I
+// are accumulated atomically, in arbitrary order; without accum, duplicate
+// indices must not appear in I (the result is undefined if they do, as with
+// GrB_assign).  The types must match the operator and vectors exactly (no
+// typecasting).  If y or x is not dense, GrB_INVALID_VALUE is returned; use
+// GrB_assign instead.
+
+GrB_Info GxB_Vector_scatter     // y (I (k)) = accum (y (I (k)), x (k))
+(
+    GrB_Vector y,               // input/output vector; must be dense
+    const GrB_BinaryOp accum,   // optional accum op, or NULL for y(I(k))=x(k)
+    const GrB_Vector x,         // input vector of length ni; must be dense
+    const GrB_Index *Ilist,     // index list of length ni
+    const GrB_Index ni,         // number of indices to scatter
+    const GrB_Descriptor desc   // unused, except threading control
+) ;
+
 //------------------------------------------------------------------------------
 // GxB_Matrix_diag, GxB_Vector_diag, GrB_Matrix_diag
 //------------------------------------------------------------------------------
@@ -3975,6 +4492,64 @@ typedef enum            // for global options or matrix options
     GxB_FLUSH = 7021,                // flush function diagnostic output
     GxB_MEMORY_POOL = 7022,          // no longer used
     GxB_PRINT_1BASED = 7023,         // print matrices as 0-based or 1-based
+    GxB_MXM_PLAN_CACHE = 7100,       // cache saxpy3 symbolic plans (bool *)
+    GxB_JIT_ASYNC = 7102,            // CPU JIT: compile in the background
+    GxB_JIT_TRACE = 7103,            // CPU JIT: kernel trace file (char *)
+    GxB_JIT_CACHE_REMOTE = 7114,     // CPU JIT: optional read-only remote
+                                     // cache folder (char *); kernels not in
+                                     // the local cache are copied from here
+                                     // before being compiled
+    GxB_HUGEPAGE_THRESHOLD = 7107,   // memory blocks of this size (in bytes)
+                                     // or larger are backed by huge pages,
+                                     // where supported (double); if zero (the
+                                     // default), huge pages are not requested
+    GxB_MEMORY_PRESSURE_FUNCTION = 7108, // called when an allocation fails,
+                                     // so the application can release memory;
+                                     // the allocation is retried if the
+                                     // callback returns true
+    GxB_SPILL_THRESHOLD = 7109,      // memory blocks of this size (in bytes)
+                                     // or larger are backed by file mappings
+                                     // in the system temporary directory, so
+                                     // the OS can page them out under memory
+                                     // pressure (double); also used as a last
+                                     // resort for any failed allocation; if
+                                     // zero (the default), no file mappings
+                                     // are used
+    GxB_DUP_SHARING = 7111,          // if true, GrB_Matrix_dup (and the
+                                     // GrB_Vector and GrB_Scalar variants)
+                                     // returns an O(1) duplicate that shares
+                                     // its arrays with the original, copying
+                                     // an array only when one of its owners
+                                     // first modifies it in place (bool);
+                                     // false by default
+    GxB_PROFILING = 7112,            // if true, profiled kernels capture one
+                                     // GxB_Profile record per call, in a ring
+                                     // buffer drained by GxB_Profile_get
+                                     // (bool); false by default
+    GxB_CHUNK_AUTOTUNE = 7113,       // if true, the chunk parameter of each
+                                     // kernel family is adapted online from
+                                     // measured run times, reducing thread
+                                     // counts for operations too small to
+                                     // amortize their fork-join overhead
+                                     // (bool); false by default
+
+    //------------------------------------------------------------------
+    // JIT kernel telemetry (GxB_Global_Option_get only):
+    //------------------------------------------------------------------
+
+    // Each option reads an int64_t array of size 10: entry 0 is the total,
+    // and entries 1 to 9 give the count for each JIT kernel family (reduce,
+    // mxm, ewise, apply, build, select, user op, user type, and assign,
+    // in that order).  A "miss" is an operation that fell back to a generic
+    // kernel because no PreJIT, JIT, or factory kernel could be used.
+
+    GxB_JIT_KERNEL_HITS = 7104,      // CPU JIT: kernel hit counts (int64_t *)
+    GxB_JIT_KERNEL_MISSES = 7105,    // CPU JIT: generic fallbacks (int64_t *)
+    GxB_JIT_KERNEL_COMPILES = 7106,  // CPU JIT: kernels compiled (int64_t *)
+
+    GxB_MEMORY_IN_USE = 7110,        // # of bytes in all memory blocks
+                                     // currently allocated by GraphBLAS
+                                     // (double; GxB_Global_Option_get only)
 
     GxB_JIT_C_COMPILER_NAME = 7024,  // CPU JIT C compiler name
     GxB_JIT_C_COMPILER_FLAGS = 7025, // CPU JIT C compiler flags
@@ -3999,6 +4574,12 @@ typedef enum            // for global options or matrix options
     //------------------------------------------------------------
 
     GxB_SPARSITY_CONTROL = 7036,    // sparsity control: 0 to 15; see below
+    GxB_MATRIX_GPU_ID = GxB_GPU_ID, // GPU on which to pin the matrix arrays
+                                    // on-device, or -1 (the default) to let
+                                    // unified memory migrate them freely;
+                                    // CPU access to a pinned matrix maps the
+                                    // pages instead of migrating them back
+                                    // (DRAFT: in progress, do not use)
 
     //------------------------------------------------------------
     // memory functions (GxB_Global_Option_get only):
@@ -4155,6 +4736,20 @@ GrB_Info GxB_Matrix_Option_get_FP64     // gets the current option of a matrix
     double *value                   // return value of the matrix option
 ) ;
 
+// GxB_Matrix_advise recommends a sparsity control and hyper_switch setting
+// for a matrix, from the format conversions and hyper_hash rebuilds the
+// matrix has undergone so far.  Run the workload, ask each long-lived matrix
+// for its advice, and apply it with GxB_Matrix_Option_set; a matrix with too
+// little history gets its current settings back.  The matrix is not
+// modified.
+
+GrB_Info GxB_Matrix_advise      // recommend format settings for a matrix
+(
+    int32_t *sparsity_control,  // recommended GxB_SPARSITY_CONTROL for A
+    double *hyper_switch,       // recommended hyper_switch for A
+    const GrB_Matrix A          // matrix to advise on; not modified
+) ;
+
 GrB_Info GxB_Vector_Option_set      // set an option in a vector
 (
     GrB_Vector A,                   // vector to modify
@@ -4218,6 +4813,11 @@ GrB_Info GxB_Global_Option_set      // set a global default option
     ...                             // value to change it to
 ) ;
 
+// memory-pressure callback, for GxB_MEMORY_PRESSURE_FUNCTION: called when a
+// memory allocation of size_needed bytes fails; returns true if the
+// application has released memory and the allocation should be retried
+typedef bool (*GxB_memory_pressure_function) (size_t size_needed) ;
+
 GrB_Info GxB_Global_Option_set_INT32      // set a global default option
 (
     GxB_Option_Field field,         // option to change
@@ -4290,6 +4890,59 @@ GrB_Info GxB_Global_Option_get_FUNCTION // gets the current global option
     void **value                    // return value of the global option
 ) ;
 
+//==============================================================================
+// GxB_Profile: structured operation profiler
+//==============================================================================
+
+// When profiling is enabled, via GxB_Global_Option_set (GxB_PROFILING, true),
+// each profiled kernel captures one GxB_Profile record per call, into an
+// internal ring buffer holding the most recent 1024 records.  The records are
+// structured and cheap to capture (unlike the burble, which prints free-form
+// text), so profiling can remain enabled in production.
+
+// GxB_Profile_get drains records from the ring buffer in FIFO order, into a
+// user-provided array.  On input, (*nrecords) is the size of the records
+// array; on output it is the number of records returned, which is zero when
+// the ring buffer is empty.  Records drained once are not returned again.
+
+// maximum length of GxB_Profile method names, including the nul terminator
+#define GxB_PROFILE_METHOD_LEN 16
+
+typedef struct
+{
+    char method [GxB_PROFILE_METHOD_LEN] ;  // kernel and method name, such as
+                            // "saxpy3" or "dot3" for C=A*B
+    double symbolic_time ;  // time in the symbolic (analysis) phase, in
+                            // seconds, or zero if the kernel has no separate
+                            // symbolic phase
+    double numeric_time ;   // time in the numeric phase, in seconds
+    int64_t ntasks ;        // # of parallel tasks used by the kernel
+    int32_t nthreads ;      // # of threads used by the kernel
+    int64_t bytes_allocated ;   // # of bytes allocated during the call
+    int64_t peak_bytes ;    // high-water mark of workspace held live during
+                            // the call, in bytes: allocations minus frees on
+                            // the calling thread, at their highest point
+                            // (zero if thread-local storage is unavailable)
+    int64_t cache_refs ;    // hardware cache references during the call,
+                            // counted on the calling thread (Linux perf_event
+                            // only; zero if unavailable)
+    int64_t cache_misses ;  // hardware cache misses during the call, counted
+                            // on the calling thread (Linux perf_event only;
+                            // zero if unavailable)
+    int64_t nrows ;         // # of rows of the output of the call
+    int64_t ncols ;         // # of columns of the output of the call
+    int64_t nvals ;         // # of entries in the output when the record was
+                            // captured; pending updates are not counted
+}
+GxB_Profile ;
+
+GrB_Info GxB_Profile_get        // drain profile records (FIFO)
+(
+    GxB_Profile *records,       // array of size (*nrecords) on input
+    GrB_Index *nrecords         // input: size of records array;
+                                // output: # of records returned
+) ;
+
 //==============================================================================
 // GxB_Context: for managing computational resources
 //==============================================================================
@@ -4309,6 +4962,46 @@ typedef enum
 
     // GPU control (DRAFT: in progress, do not use)
     GxB_CONTEXT_GPU_ID      = GxB_GPU_ID,
+
+    GxB_CONTEXT_NUMA = 7101,    // if nonzero, first-touch large internal
+                    // workspaces in parallel so their pages are spread
+                    // across the memory nodes of the executing threads.
+
+    GxB_CONTEXT_ARENA_SIZE = 7102,  // size (in bytes) of an arena held by
+                    // this Context for internal workspaces, so that a
+                    // sequence of operations can reuse a single allocation.
+                    // Zero (the default) means no arena.  The arena is only
+                    // used while the Context is engaged to a user thread;
+                    // GxB_CONTEXT_WORLD cannot have an arena.
+
+    GxB_CONTEXT_CONCURRENCY = 7103,     // work-queue mode: if > 0, at most
+                    // this many of the user threads sharing this Context may
+                    // run a parallel kernel at once (max 64); the others run
+                    // their kernels serially on the calling thread, with no
+                    // parallel-region startup at all.  Intended for many
+                    // concurrent small operations, where the startup and
+                    // teardown of an OpenMP parallel region per call would
+                    // otherwise dominate.  Zero (the default) disables the
+                    // mode and every call may use a full thread team.
+
+    GxB_CONTEXT_CANCEL = 7104,  // if set nonzero, cooperative cancellation
+                    // is requested: long-running kernels poll the flag at
+                    // coarse task boundaries, stop, and return
+                    // GxB_CANCELLED.  It may be set from any user thread,
+                    // typically one other than the thread the Context is
+                    // engaged to, to bound the latency of a runaway call.
+                    // The request is consumed by the kernel that observes
+                    // it; setting the field to zero clears a pending
+                    // request.  Reading it returns nonzero if a request is
+                    // pending.
+
+    GxB_CONTEXT_STREAM_THRESHOLD = 7105,    // if > 0: internal memset and
+                    // memcpy writes of at least this many bytes use
+                    // non-temporal (streaming) stores, which bypass the
+                    // cache hierarchy.  A multi-gigabyte output will not be
+                    // re-read soon, so caching it only evicts data that
+                    // will be.  A sensible setting is the last-level cache
+                    // size.  Zero (the default) disables streaming stores.
 }
 GxB_Context_Field ;
 
@@ -4374,6 +5067,42 @@ GrB_Info GxB_Context_disengage      // disengage a Context
     GxB_Context Context             // Context to disengage
 ) ;
 
+// A Context can be given its own memory allocator, overriding the global
+// malloc/free functions passed to GxB_init for all allocations made while the
+// Context is engaged to a user thread.  This allows each Context (each tenant
+// of a shared process, for example) to be backed by its own allocator arena,
+// with per-Context memory accounting.  The alloc function is given the size
+// of the block and the user-provided state pointer; the dealloc function is
+// additionally given the size of the block being freed, in the style of
+// sized deallocation (jemalloc sdallocx, for example).
+
+// All Context allocators in a process, and the global malloc/free functions
+// of GxB_init, must share a single underlying heap: a block allocated by one
+// of them must be safe to pass to the dealloc function of another, since a
+// block may be allocated and freed under different engaged Contexts (or
+// none).  Allocators that partition one heap into arenas (such as jemalloc
+// arenas) satisfy this requirement.  GxB_CONTEXT_WORLD cannot be given an
+// allocator; use GxB_init for the global functions.
+
+typedef void *(*GxB_alloc_function)   (size_t size, void *state) ;
+typedef void  (*GxB_dealloc_function) (void *p, size_t size, void *state) ;
+
+GrB_Info GxB_Context_allocator_set  // set the allocator of a Context
+(
+    GxB_Context Context,            // Context to modify
+    GxB_alloc_function alloc_func,      // allocation function
+    GxB_dealloc_function dealloc_func,  // deallocation function
+    void *allocator_state           // passed to alloc_func/dealloc_func
+) ;
+
+GrB_Info GxB_Context_allocator_get  // get the allocator of a Context
+(
+    GxB_Context Context,            // Context to query
+    GxB_alloc_function *alloc_func,     // allocation function
+    GxB_dealloc_function *dealloc_func, // deallocation function
+    void **allocator_state          // state of the allocator
+) ;
+
 //==============================================================================
 // GxB_set and GxB_get
 //==============================================================================
@@ -4427,6 +5156,8 @@ GrB_Info GxB_Context_disengage      // disengage a Context
 //      GxB_get (GxB_JIT_C_LINKER_FLAGS, const char **flags) ;
 //      GxB_set (GxB_JIT_CACHE_PATH, const char *cache_path) ;
 //      GxB_get (GxB_JIT_CACHE_PATH, const char **cache_path) ;
+//      GxB_set (GxB_JIT_CACHE_REMOTE, const char *remote_path) ;
+//      GxB_get (GxB_JIT_CACHE_REMOTE, const char **remote_path) ;
 //      GxB_set (GxB_JIT_C_CONTROL, int control) ;
 //      GxB_get (GxB_JIT_C_CONTROL, int *control) ;
 
@@ -4604,6 +5335,17 @@ GrB_Info GrB_Vector_wait       (GrB_Vector     v       , GrB_WaitMode waitmode);
 GrB_Info GrB_Matrix_wait       (GrB_Matrix     A       , GrB_WaitMode waitmode);
 GrB_Info GxB_Context_wait      (GxB_Context    Context , GrB_WaitMode waitmode);
 
+// GxB_waitAll finishes all pending work on an array of distinct matrices in
+// a single pass: the matrices with enough pending work to use more than one
+// thread on their own are finished one at a time with all threads, and the
+// remaining small matrices are finished concurrently, one thread per matrix.
+GrB_Info GxB_waitAll        // finish all work on a set of matrices
+(
+    GrB_Matrix *As,         // array of nmatrices matrices to finish
+    GrB_Index nmatrices,    // # of matrices
+    GrB_WaitMode waitmode   // GrB_COMPLETE or GrB_MATERIALIZE
+) ;
+
 // GrB_wait (object,waitmode) polymorphic function:
 #if GxB_STDC_VERSION >= 201112L
 #define GrB_wait(object,waitmode)                       \
@@ -4710,6 +5452,95 @@ GrB_Info GrB_mxv                    // w<Mask> = accum (w, A*u)
     const GrB_Descriptor desc       // descriptor for w, mask, and A
 ) ;
 
+// GxB_mxv_axpby computes the classic fused axpby update of iterative
+// solvers, y = alpha*(A*x) + beta*y, in one operation: the scaling passes
+// touch only the vectors, and A*x is accumulated into y with the monoid of
+// the semiring, using the in-place dense-accumulate kernels when y is full,
+// so A is read exactly once and no matrix-sized temporary is created.
+// alpha is folded into x before the multiply (computing A*(alpha*x), the
+// same value for the conventional arithmetic semirings), and both scale
+// factors use the multiplicative operator of the semiring.  Entries of y
+// with no corresponding entry in A*x keep the value beta*y(i).
+
+GrB_Info GxB_mxv_axpby          // y = alpha*(A*x) + beta*y
+(
+    GrB_Vector y,               // input/output vector
+    const GrB_Semiring semiring,// defines '+' and '*' for A*x
+    const GrB_Scalar alpha,     // scale factor for A*x
+    const GrB_Matrix A,         // input matrix
+    const GrB_Vector x,         // input vector
+    const GrB_Scalar beta,      // scale factor for the input y
+    const GrB_Descriptor desc   // descriptor for A (to use A' for example)
+) ;
+
+GrB_Info GxB_mxm_reduce             // s = accum (s, reduce (A*B))
+(
+    GrB_Scalar s,                   // result scalar
+    const GrB_BinaryOp accum,       // optional accum for s = accum(s,t)
+    const GrB_Monoid monoid,        // monoid for the reduction
+    const GrB_Semiring semiring,    // defines '+' and '*' for A*B
+    const GrB_Matrix Mask,          // optional mask for A*B, unused if NULL
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Descriptor desc       // descriptor for Mask, A, and B
+) ;
+
+GrB_Info GxB_mxm_select             // C<Mask> = accum (C, select (A*B, Thunk))
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_Matrix Mask,          // optional mask for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Semiring semiring,    // defines '+' and '*' for A*B
+    const GrB_IndexUnaryOp op,      // operator to select the entries to keep
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Scalar Thunk,         // scalar input for the select operator
+    const GrB_Descriptor desc       // descriptor for C, Mask, A, and B
+) ;
+
+// GxB_mxm_estimate predicts the cost of a GrB_mxm with the same arguments,
+// without executing it: the method GrB_mxm would select, an estimate of the
+// flop count (exact for the common saxpy case, a density-based estimate
+// otherwise), and an upper bound on the memory the multiply would need,
+// counting both workspace and the output.  A scheduler can use the estimates
+// to route oversized multiplies to a larger machine, instead of discovering
+// the problem via an out-of-memory failure mid-computation.  Pending work on
+// Mask, A, and B is finished, just as GrB_mxm would; C is not modified.
+
+// values returned in the method output of GxB_mxm_estimate:
+#define GxB_MXM_ROWSCALE 0      // C=D*B where D=A is diagonal
+#define GxB_MXM_COLSCALE 1      // C=A*D where D=B is diagonal
+#define GxB_MXM_DOT      2      // dot products, good for masked C<M>=A'*B
+#define GxB_MXM_SAXPY    3      // saxpy (Gustavson/hash), the general method
+
+GrB_Info GxB_mxm_estimate           // estimate the cost of C<Mask>=A*B
+(
+    // output:
+    double *flops,                  // estimated # of multiply-add pairs
+    GrB_Index *peak_bytes,          // upper bound on workspace + output bytes
+    int *method,                    // method GrB_mxm would use: GxB_MXM_*
+    // input: the same arguments as GrB_mxm
+    const GrB_Matrix C,             // output matrix (not modified)
+    const GrB_Matrix Mask,          // optional mask for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Semiring semiring,    // defines '+' and '*' for A*B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Descriptor desc       // descriptor for C, Mask, A, and B
+) ;
+
+GrB_Info GxB_vxm_batch              // w(k)'<M(k)> = accum (w(k)', u(k)'*A)
+(
+    GrB_Vector *w,                  // input/output vectors for results
+    const GrB_Vector *Masks,        // optional masks, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_Semiring semiring,    // defines '+' and '*' for u'*A
+    const GrB_Vector *u,            // first inputs: vectors u
+    const GrB_Matrix A,             // second input: matrix A
+    GrB_Index nbatch,               // # of vectors in the batch
+    const GrB_Descriptor desc       // descriptor for w, Masks, and A
+) ;
+
 //==============================================================================
 // GrB_eWiseMult: element-wise matrix and vector operations, set intersection
 //==============================================================================
@@ -4973,6 +5804,30 @@ GrB_Info GxB_Matrix_eWiseUnion      // C<M> = accum (C, A+B)
     (C, Mask, accum, op, A, alpha, B, beta, desc)
 #endif
 
+//------------------------------------------------------------------------------
+// GxB_Matrix_eWiseMult3: fused chained element-wise multiplication
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_eWiseMult3 computes C<M> = accum (C, (A.*B).*D), where op1
+// defines the first '.*' and op2 the second.  When A, B, and D are all full,
+// with no transpose, no typecasting, and no positional operators, the chain
+// is evaluated in a single pass with no intermediate matrix; otherwise it is
+// computed as two ordinary element-wise multiplications.  The descriptor
+// settings GrB_INP0 and GrB_INP1 apply to A and B; D is never transposed.
+
+GrB_Info GxB_Matrix_eWiseMult3       // C<M> = accum (C, (A.*B).*D)
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_Matrix Mask,          // optional mask for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_BinaryOp op1,         // defines '.*' for T1=A.*B
+    const GrB_BinaryOp op2,         // defines '.*' for T=T1.*D
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Matrix D,             // third input:  matrix D
+    const GrB_Descriptor desc       // descriptor for C, M, A, and B
+) ;
+
 //==============================================================================
 // GrB_extract: extract a submatrix or subvector
 //==============================================================================
@@ -5151,6 +6006,27 @@ GrB_Info GxB_Matrix_subassign       // C(I,J)<Mask> = accum (C(I,J),A)
     const GrB_Descriptor desc       // descriptor for C(I,J), Mask, and A
 ) ;
 
+// GxB_Matrix_subassign_batch applies ngroups submatrix assignments to C in
+// one call, C (Rows_groups [k], Cols_groups [k]) += A [k] for k = 0 to
+// ngroups-1, with a single accum and descriptor, and no mask.  The result is
+// as if GxB_Matrix_subassign were called once per group, in order, followed
+// by GrB_Matrix_wait (C, GrB_MATERIALIZE); if the regions of the groups are
+// disjoint the order has no effect.  The batched form amortizes the per-call
+// overhead and assembles all pending updates from the whole batch at once.
+
+GrB_Info GxB_Matrix_subassign_batch // C(R_k,C_k) += A_k, for each group k
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_BinaryOp accum,       // accum for Z=accum(C(R_k,C_k),T)
+    const GrB_Matrix *A,            // array of ngroups input matrices
+    const GrB_Index *const *Rows_groups,    // Rows_groups [k]: row indices
+    const GrB_Index *nRows_groups,  // nRows_groups [k]: # of row indices
+    const GrB_Index *const *Cols_groups,    // Cols_groups [k]: column indices
+    const GrB_Index *nCols_groups,  // nCols_groups [k]: # of column indices
+    GrB_Index ngroups,              // number of assignment groups
+    const GrB_Descriptor desc       // descriptor for C and all A [k]
+) ;
+
 GrB_Info GxB_Col_subassign          // C(I,j)<mask> = accum (C(I,j),u)
 (
     GrB_Matrix C,                   // input/output matrix for results
@@ -7977,6 +8853,16 @@ GrB_Info GrB_Matrix_reduce_BinaryOp_Scalar
     const GrB_Descriptor desc
 ) ;
 
+GrB_Info GxB_Matrix_reduce_multi    // c [k] = reduce (monoids [k], A)
+(
+    void *c [ ],                    // array of nmonoids result scalars; each
+                                    // c [k] has the ztype of monoids [k]
+    const GrB_Monoid monoids [ ],   // monoids for the reductions
+    GrB_Index nmonoids,             // # of monoids and result scalars
+    const GrB_Matrix A,             // matrix to reduce
+    const GrB_Descriptor desc       // currently unused
+) ;
+
 //------------------------------------------------------------------------------
 // GrB_reduce: generic matrix/vector reduction to a vector or scalar
 //------------------------------------------------------------------------------
@@ -8099,6 +8985,32 @@ GrB_Info GrB_Matrix_kronecker_Semiring  // C<M> = accum (C, kron(A,B))
 #endif
 
 
+// GxB_kron_mxv computes w<M> = accum (w, kron(A,B)*u) without forming the
+// Kronecker product, via the identity kron(A,B)*vec(X) = vec(B*X*A'), where
+// vec(X) stacks the columns of X.  The vector u is reshaped into a matrix,
+// multiplied on the left by B and on the right by A', and the result is
+// reshaped back into w, so only two small matrix multiplies are performed no
+// matter how large kron(A,B) would be.  The multiplicative operator of the
+// semiring is applied as mult(aij,mult(bij,x)); this equals the explicit
+// mult(mult(aij,bij),x) of GrB_mxv on the materialized product when the op is
+// associative (TIMES, PLUS, MIN, MAX, ANY, FIRST, SECOND, PAIR, LAND, LOR,
+// ...), but can differ for non-associative ops such as MINUS or DIV.
+// Positional multiply operators are not supported, since their indices would
+// refer to the unformed Kronecker product; they return GrB_NOT_IMPLEMENTED.
+
+GrB_Info GxB_kron_mxv               // w<M> = accum (w, kron(A,B)*u)
+(
+    GrB_Vector w,                   // input/output vector for results
+    const GrB_Vector M,             // optional mask for w, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_Semiring semiring,    // defines '+' and '*' for kron(A,B)*u
+    const GrB_Matrix A,             // first input:  matrix A of kron(A,B)
+    const GrB_Matrix B,             // second input: matrix B of kron(A,B)
+    const GrB_Vector u,             // third input:  vector u
+    const GrB_Descriptor desc       // descriptor for w, M, A, and B
+) ;
+
+
 //==============================================================================
 // GrB_Monoid: built-in monoids
 //==============================================================================
@@ -8850,6 +9762,17 @@ GB_GLOBAL GrB_Semiring
     GxB_PLUS_SECONDJ1_INT32,  GxB_PLUS_SECONDJ1_INT64,
     GxB_TIMES_SECONDJ1_INT32, GxB_TIMES_SECONDJ1_INT64 ;
 
+//------------------------------------------------------------------------------
+// 1 mixed-precision semiring
+//------------------------------------------------------------------------------
+
+// GxB_PLUS_FP64_TIMES_FP32 multiplies FP32 matrices with the FP64 PLUS
+// monoid: the float inputs are streamed at FP32 bandwidth while the products
+// are summed in double, where the rounding error of a long dot product
+// accumulates.  The result is FP64, or typecast on assignment to C.
+
+GB_GLOBAL GrB_Semiring GxB_PLUS_FP64_TIMES_FP32 ;
+
 //------------------------------------------------------------------------------
 // GrB_* semirings
 //------------------------------------------------------------------------------
@@ -9405,6 +10328,25 @@ GrB_Info GxB_Matrix_pack_CSR      // pack a CSR matrix
     //      zero, then the Aj and Ax arrays need not be present and can be
     //      NULL.
 
+// GxB_Matrix_pack_CSR_int32 is identical to GxB_Matrix_pack_CSR, except that
+// Ap and Aj are arrays of int32_t (the Arrow sparse tensor layout); they are
+// widened to the internal 64-bit indices in a single parallel pass, and freed
+// on success.  The values Ax are taken as-is, with no copy.
+GrB_Info GxB_Matrix_pack_CSR_int32      // pack a CSR matrix, int32 indices
+(
+    GrB_Matrix A,       // matrix to create (type, nrows, ncols unchanged)
+    int32_t **Ap,       // row "pointers", Ap_size >= (nrows+1)*sizeof(int32_t)
+    int32_t **Aj,       // column indices, Aj_size >= nvals(A)*sizeof(int32_t)
+    void **Ax,          // values, Ax_size >= nvals(A) * (type size)
+                        // or Ax_size >= (type size), if iso is true
+    GrB_Index Ap_size,  // size of Ap in bytes
+    GrB_Index Aj_size,  // size of Aj in bytes
+    GrB_Index Ax_size,  // size of Ax in bytes
+    bool iso,           // if true, A is iso
+    bool jumbled,       // if true, indices in each row may be unsorted
+    const GrB_Descriptor desc
+) ;
+
 //------------------------------------------------------------------------------
 // GxB_Matrix_pack_CSC: pack a CSC matrix
 //------------------------------------------------------------------------------
@@ -9458,6 +10400,23 @@ GrB_Info GxB_Matrix_pack_CSC      // pack a CSC matrix
     //      zero, then the Ai and Ax arrays need not be present and can be
     //      NULL.
 
+// GxB_Matrix_pack_CSC_int32 is identical to GxB_Matrix_pack_CSC, except that
+// Ap and Ai are arrays of int32_t; see GxB_Matrix_pack_CSR_int32.
+GrB_Info GxB_Matrix_pack_CSC_int32      // pack a CSC matrix, int32 indices
+(
+    GrB_Matrix A,       // matrix to create (type, nrows, ncols unchanged)
+    int32_t **Ap,       // col "pointers", Ap_size >= (ncols+1)*sizeof(int32_t)
+    int32_t **Ai,       // row indices, Ai_size >= nvals(A)*sizeof(int32_t)
+    void **Ax,          // values, Ax_size >= nvals(A) * (type size)
+                        // or Ax_size >= (type size), if iso is true
+    GrB_Index Ap_size,  // size of Ap in bytes
+    GrB_Index Ai_size,  // size of Ai in bytes
+    GrB_Index Ax_size,  // size of Ax in bytes
+    bool iso,           // if true, A is iso
+    bool jumbled,       // if true, indices in each column may be unsorted
+    const GrB_Descriptor desc
+) ;
+
 //------------------------------------------------------------------------------
 // GxB_Matrix_pack_HyperCSR: pack a hypersparse CSR matrix
 //------------------------------------------------------------------------------
@@ -9745,6 +10704,39 @@ GrB_Info GxB_Matrix_pack_FullC  // pack a full matrix, held by column
     //      Ax is an array of size nrows*ncols, where A(i,j) is held in
     //      Ax [i+j*nrows].  All entries in A are present.
 
+//------------------------------------------------------------------------------
+// GxB_Matrix_pack_COO: pack a matrix from (I,J,X) tuples, deferring the build
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_pack_COO moves three user arrays of (I,J,X) tuples directly
+// into the matrix A as its list of pending tuples, in O(1) time and memory,
+// taking ownership of the arrays.  The prior content of A is cleared; its
+// type and dimensions are unchanged.  The tuples may be unsorted and may
+// contain duplicates, which are assembled with the dup operator (if dup is
+// NULL, the last duplicate takes precedence).  X must have the same type as
+// A; no typecasting is done.  In nonblocking mode the sort and assembly of
+// the tuples is deferred until the matrix is first used or GrB_wait is
+// called, so a loader can overlap further reads with the assembly, and a
+// matrix freed before first use skips the assembly entirely.  With a fast
+// import (the default), out-of-bound indices are detected only when the
+// tuples are assembled; a secure import (GxB_SECURE_IMPORT) checks the
+// bounds immediately, in parallel.
+
+GrB_Info GxB_Matrix_pack_COO    // pack a matrix from (I,J,X) tuples
+(
+    GrB_Matrix A,       // matrix to create (type, nrows, ncols unchanged)
+    GrB_Index **Ilist,  // row indices, I_size >= nvals*sizeof(GrB_Index)
+    GrB_Index **J,      // col indices, J_size >= nvals*sizeof(GrB_Index)
+    void **X,           // values, X_size >= nvals * (type size)
+    GrB_Index I_size,   // size of Ilist in bytes
+    GrB_Index J_size,   // size of J in bytes
+    GrB_Index X_size,   // size of X in bytes
+    const GrB_BinaryOp dup,     // operator to assemble duplicates, or NULL
+    GrB_Index nvals,    // number of tuples
+    const GrB_Descriptor desc
+) ;
+
+
 //------------------------------------------------------------------------------
 // GxB_Vector_pack_CSC: import/pack a vector in CSC format
 //------------------------------------------------------------------------------
@@ -10841,6 +11833,8 @@ GrB_Info GrB_Matrix_exportHint  // suggest the best export format
 #define GxB_COMPRESSION_LZ4   1000  // LZ4
 #define GxB_COMPRESSION_LZ4HC 2000  // LZ4HC, with default level 9
 #define GxB_COMPRESSION_ZSTD  3000  // ZSTD, with default level 1
+#define GxB_COMPRESSION_AUTO  4000  // pick a method per array (see below)
+#define GxB_COMPRESSION_CHECKSUM 8000  // add a checksum per block (see below)
 
 // Most of the above methods have a level parameter that controls the tradeoff
 // between run time and the amount of compression obtained.  Higher levels
@@ -10859,6 +11853,24 @@ GrB_Info GrB_Matrix_exportHint  // suggest the best export format
 // positive but unrecognized, the default is used (GxB_COMPRESSION_ZSTD,
 // level 1).
 
+// GxB_COMPRESSION_AUTO picks a method for each array of the matrix
+// independently, by trial compression of a few sampled regions of the array:
+// an array that barely compresses is stored uncompressed, a highly
+// compressible array is compressed with a higher ZSTD level, and anything in
+// between uses ZSTD level 1.  The level setting is ignored.
+
+// GxB_COMPRESSION_CHECKSUM may be added to any of the above methods (for
+// example, GxB_COMPRESSION_ZSTD + 1 + GxB_COMPRESSION_CHECKSUM).  Each
+// compressed block in the blob is then followed by its own 8-byte xxHash64
+// digest, computed when the matrix is serialized.  When the blob is
+// deserialized, the digest of each block is verified (in parallel, with the
+// decompression) before the block is decompressed, and a corrupted blob is
+// reported as GrB_INVALID_OBJECT.  The digests add 8 bytes per block to the
+// blob and a negligible amount of time, so an application that stores blobs
+// in a file or object store need not checksum them separately.  The flag has
+// no effect on parts of the blob that are not compressed (in particular, it
+// is ignored if the method itself is GxB_COMPRESSION_NONE).
+
 GrB_Info GxB_Matrix_serialize       // serialize a GrB_Matrix to a blob
 (
     // output:
@@ -10870,6 +11882,94 @@ GrB_Info GxB_Matrix_serialize       // serialize a GrB_Matrix to a blob
                                     // and to control # of threads used
 ) ;
 
+// GxB_Matrix_serialize_range serializes a contiguous range of whole vectors
+// of A, as stored: columns begin:end-1 if A is held by column, or rows
+// begin:end-1 if A is held by row.  The blob holds the range as a matrix of
+// its own, reduced dimension, which any deserialize method reconstructs.
+// The range is taken through a shallow window view (GxB_Matrix_window), so
+// nothing is copied except the compressed blob itself.  A process that owns
+// one slab of a distributed matrix can thus ship any sub-range of it to a
+// peer without extracting a submatrix first.  Like GxB_Matrix_window, a
+// hypersparse A is not supported.
+
+GrB_Info GxB_Matrix_serialize_range // serialize a range of vectors of A
+(
+    // output:
+    void **blob_handle,             // the blob, allocated on output
+    GrB_Index *blob_size_handle,    // size of the blob on output
+    // input:
+    GrB_Matrix A,                   // matrix to serialize a range of
+    GrB_Index begin,                // first vector of the range
+    GrB_Index end,                  // last vector of the range, plus one
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+) ;
+
+// GxB_Matrix_serialize_stream is identical to GxB_Matrix_serialize, except
+// that the blob is never held in memory as a single allocation.  The pieces
+// of the blob are passed, in order, to a user-provided write callback, and
+// each piece is freed as soon as it has been written, so the peak memory
+// usage is the matrix plus its compressed copy; no blob-sized buffer is
+// allocated.  Concatenating all the pieces gives the same blob that
+// GxB_Matrix_serialize constructs, so a file written this way can be read
+// back with GxB_Matrix_deserialize.  The callback returns true if the write
+// succeeded, and false on failure, in which case GxB_Matrix_serialize_stream
+// returns GrB_INVALID_VALUE and the contents of the stream are undefined.
+
+typedef bool (*GxB_serialize_callback)  // return true if write succeeded
+(
+    void *stream,                   // opaque stream handle from the caller
+    const void *data,               // data to write
+    size_t size                     // # of bytes to write
+) ;
+
+GrB_Info GxB_Matrix_serialize_stream    // serialize a GrB_Matrix to a stream
+(
+    // output:
+    GrB_Index *blob_size_handle,    // # of bytes written to the stream
+    // input:
+    GxB_serialize_callback write,   // user write callback
+    void *stream,                   // opaque stream handle passed to write
+    GrB_Matrix A,                   // matrix to serialize
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+) ;
+
+// GxB_checkpoint serializes an array of matrices through a single write
+// callback, as one checkpoint blob: a manifest (magic number, version, matrix
+// count, and the blob size of each matrix) followed by the per-matrix blobs,
+// each identical to what GxB_Matrix_serialize would produce.  All the
+// matrices share one thread pool: the large matrices are compressed one at a
+// time with all threads, and the small ones concurrently, one thread per
+// matrix.  The checkpoint is read back with GxB_restore, which deserializes
+// the matrices concurrently.  Types is optional: if non-NULL, it gives the
+// expected type of each matrix, which is required when a matrix has a
+// user-defined type (just as for GxB_Matrix_deserialize).  nmatrices must
+// match the count recorded in the checkpoint.
+
+GrB_Info GxB_checkpoint         // serialize a set of matrices to a stream
+(
+    // output:
+    GrB_Index *blob_size_handle,    // total # of bytes written to the stream
+    // input:
+    GxB_serialize_callback write,   // user write callback
+    void *stream,                   // opaque stream handle passed to write
+    GrB_Matrix *As,                 // array of matrices to serialize
+    GrB_Index nmatrices,            // # of matrices
+    const GrB_Descriptor desc       // descriptor to select compression method
+) ;
+
+GrB_Info GxB_restore            // deserialize a set of matrices from a blob
+(
+    // output:
+    GrB_Matrix *As,                 // array of nmatrices matrices, created
+    // input:
+    const GrB_Type *Types,          // expected type of each matrix, or NULL
+    GrB_Index nmatrices,            // # of matrices in the checkpoint
+    const void *blob,               // the checkpoint blob
+    GrB_Index blob_size             // size of the blob
+) ;
+
 GrB_Info GrB_Matrix_serialize       // serialize a GrB_Matrix to a blob
 (
     // output:
@@ -10912,8 +12012,11 @@ GrB_Info GxB_Matrix_deserialize     // deserialize blob into a GrB_Matrix
     // input:
     GrB_Type type,      // type of the matrix C.  Required if the blob holds a
                         // matrix of user-defined type.  May be NULL if blob
-                        // holds a built-in type; otherwise must match the
-                        // type of C.
+                        // holds a built-in type.  If it is another built-in
+                        // type, the values are typecast to it as they are
+                        // loaded, fused with the decompression: storing FP64
+                        // snapshots and computing in FP32 needs no transient
+                        // FP64 matrix and no separate GrB_apply pass.
     const void *blob,       // the blob
     GrB_Index blob_size,    // size of the blob
     const GrB_Descriptor desc       // to control # of threads used
@@ -10932,6 +12035,78 @@ GrB_Info GrB_Matrix_deserialize     // deserialize blob into a GrB_Matrix
     GrB_Index blob_size     // size of the blob
 ) ;
 
+// GxB_Matrix_serialize_delta and GxB_Matrix_deserialize_delta provide an
+// incremental serialization format for periodic checkpoints of a
+// slowly-changing matrix.  Each array of the matrix is split into fixed-size
+// chunks with a checksum per chunk; a delta blob stores compressed data only
+// for the chunks that differ from the base blob it was serialized against,
+// and records the rest by checksum alone.  Every delta blob carries the full
+// checksum table, so it serves as the base for the next delta in turn.  A
+// delta blob serialized with a NULL base contains all chunks ("full"), and
+// starts a snapshot chain.  To reconstruct, deserialize the full blob first
+// (with a NULL base matrix), then apply each delta in order, passing the
+// previously reconstructed matrix as the base.  Chunks taken from the base
+// are checksum-verified, so a wrong or stale base is reported as
+// GrB_INVALID_OBJECT rather than silently corrupting the result.  Delta
+// blobs use their own format and cannot be read by GxB_Matrix_deserialize.
+
+GrB_Info GxB_Matrix_serialize_delta     // delta-serialize a GrB_Matrix
+(
+    // output:
+    void **blob_handle,             // the delta blob, allocated on output
+    GrB_Index *blob_size_handle,    // size of the delta blob on output
+    // input:
+    GrB_Matrix A,                   // matrix to serialize
+    const void *base_blob,          // prior delta blob, or NULL to write a
+                                    // full delta blob with all chunks present
+    GrB_Index base_blob_size,       // size of the prior delta blob
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+) ;
+
+GrB_Info GxB_Matrix_deserialize_delta   // deserialize a delta blob
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the blob
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the blob holds a
+                        // matrix of user-defined type.  May be NULL if blob
+                        // holds a built-in type; otherwise must match the
+                        // type of C.
+    const void *blob,       // the delta blob
+    GrB_Index blob_size,    // size of the delta blob
+    GrB_Matrix base,        // base matrix holding the unchanged chunks, or
+                            // NULL if the delta blob is full
+    const GrB_Descriptor desc       // to control # of threads used
+) ;
+
+// GxB_Matrix_deserialize_shallow is identical to GxB_Matrix_deserialize,
+// except that any array held uncompressed in the blob (serialized with
+// GxB_COMPRESSION_NONE) is not copied: the matrix points directly into the
+// blob itself.  If the entire blob is uncompressed, a matrix of any size is
+// created in O(1) time and memory.  This is intended for blobs held in
+// memory-mapped files: many processes can then share one read-only blob, with
+// the kernel paging it in on demand.  All arrays in the blob are 8-byte
+// aligned, provided the blob itself is 8-byte aligned (mmap returns
+// page-aligned memory).  The caller must preserve the blob, unmodified, for
+// the entire lifetime of the matrix C, and must free (or munmap) the blob
+// only after C has been freed.  The matrix should be treated as read-only.
+// Arrays compressed in the blob are deep copies, as usual.
+
+GrB_Info GxB_Matrix_deserialize_shallow  // deserialize blob into a GrB_Matrix
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the blob
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the blob holds a
+                        // matrix of user-defined type.  May be NULL if blob
+                        // holds a built-in type; otherwise must match the
+                        // type of C.
+    const void *blob,       // the blob
+    GrB_Index blob_size,    // size of the blob
+    const GrB_Descriptor desc       // to control # of threads used
+) ;
+
 GrB_Info GxB_Vector_deserialize     // deserialize blob into a GrB_Vector
 (
     // output:
@@ -10990,6 +12165,43 @@ GrB_Info GxB_Matrix_sort
     const GrB_Descriptor desc
 ) ;
 
+// GxB_Matrix_sort_limit is identical to GxB_Matrix_sort, except that at most
+// k entries are kept in each row of C and P (each column, with the GrB_INP0
+// transpose descriptor): the first k entries of each sorted vector.  For
+// small k (a top-k query) this is much faster than a full sort followed by
+// pruning.  k must be at least 1.
+
+GrB_Info GxB_Matrix_sort_limit
+(
+    // output:
+    GrB_Matrix C,           // matrix of sorted values
+    GrB_Matrix P,           // matrix containing the permutations
+    // input
+    GrB_BinaryOp op,        // comparator op
+    GrB_Matrix A,           // matrix to sort
+    GrB_Index k,            // max # of sorted entries to keep per vector
+    const GrB_Descriptor desc
+) ;
+
+// GxB_Matrix_select_topk computes C as A with all but the k best entries of
+// each row removed (each column, with the GrB_INP0 transpose descriptor),
+// where "best" means first in the sort order of the comparator op.  Unlike
+// GxB_Matrix_sort_limit, the surviving entries keep their original indices:
+// the pattern of C is a subset of the pattern of A.  No vector is fully
+// sorted, so for small k this is much faster than sorting.  Ties are broken
+// by smallest index.  k must be at least 1.
+
+GrB_Info GxB_Matrix_select_topk
+(
+    // output:
+    GrB_Matrix C,           // matrix with at most k entries per vector
+    // input
+    GrB_BinaryOp op,        // comparator op
+    GrB_Matrix A,           // matrix to select from
+    GrB_Index k,            // max # of entries to keep per vector
+    const GrB_Descriptor desc
+) ;
+
 #define GxB_sort(arg1,...)                                  \
     _Generic                                                \
     (                                                       \
@@ -11166,6 +12378,12 @@ struct GB_Iterator_opaque
     const int8_t  *GB_restrict Ab ;      // bitmap
     const int64_t *GB_restrict Ai ;      // indices for sparse and hypersparse
     const void    *GB_restrict Ax ;      // values for all 4 data structures
+    const int64_t *GB_restrict Yp ;      // A->Y->p: hyper_hash buckets of A,
+                                         // or NULL if A has no hyper_hash
+    const int64_t *GB_restrict Yi ;      // A->Y->i: hashed vector names
+    const int64_t *GB_restrict Yx ;      // A->Y->x: positions in Ah
+    int64_t hash_bits ;         // A->Y->vdim-1, the hyper_hash table size
+                                // minus one
     size_t type_size ;          // size of the type of A
     int A_sparsity ;            // sparse, hyper, bitmap, or full
     bool iso ;                  // true if A is iso-valued, false otherwise
@@ -11180,6 +12398,20 @@ GrB_Info GxB_Iterator_new (GxB_Iterator *iterator) ;
 // GxB_Iterator_free: free an iterator
 GrB_Info GxB_Iterator_free (GxB_Iterator *iterator) ;
 
+// GxB_Matrix_iteratorSlice: partition a matrix for parallel iteration.  The
+// vectors of A (rows if A is held by row, columns if held by column) are
+// split into nranges contiguous ranges holding roughly equal numbers of
+// entries.  On output, range t consists of vectors Slice [t] to Slice
+// [t+1]-1, in the sense of GxB_rowIterator_kseek or GxB_colIterator_kseek,
+// suitable for passing to GxB_rowIterator_attachRange or
+// GxB_colIterator_attachRange (one range per user thread).
+GrB_Info GxB_Matrix_iteratorSlice
+(
+    GrB_Index *Slice,       // array of size nranges+1
+    int nranges,            // # of ranges to create
+    GrB_Matrix A            // matrix to slice
+) ;
+
 //==============================================================================
 // GB_Iterator_*: implements user-callable GxB_*Iterator_* methods
 //==============================================================================
@@ -11199,6 +12431,20 @@ GrB_Info GB_Iterator_attach
     GrB_Descriptor desc
 ) ;
 
+//------------------------------------------------------------------------------
+// GB_Iterator_attach_range: attach a row/col iterator to a range of vectors
+//------------------------------------------------------------------------------
+
+GrB_Info GB_Iterator_attach_range
+(
+    GxB_Iterator iterator,      // iterator to attach to the matrix A
+    GrB_Matrix A,               // matrix to attach
+    GxB_Format_Value format,    // by row or by col
+    GrB_Index k0,               // first vector in the range of the iterator
+    GrB_Index k1,               // one past the last vector in the range
+    GrB_Descriptor desc
+) ;
+
 //------------------------------------------------------------------------------
 // GB_Iterator_rc_seek: seek a row/col iterator to a particular vector
 //------------------------------------------------------------------------------
@@ -11216,6 +12462,40 @@ GrB_Info GB_Iterator_rc_seek
 
 GrB_Info GB_Iterator_rc_bitmap_next (GxB_Iterator iterator) ;
 
+//------------------------------------------------------------------------------
+// GB_Iterator_rc_prefetch: software prefetch of upcoming iterator content
+//------------------------------------------------------------------------------
+
+// Hint to the processor that the indices and values at position pnext of the
+// matrix attached to the iterator will be read soon, to hide memory latency
+// when streaming through a large matrix.  A no-op on compilers that do not
+// support __builtin_prefetch.
+
+#if defined ( __GNUC__ ) || defined ( __clang__ ) ||                        \
+    defined ( __INTEL_COMPILER )
+#define GB_Iterator_prefetch_hint(addr) __builtin_prefetch (addr)
+#else
+#define GB_Iterator_prefetch_hint(addr) ((void) 0)
+#endif
+
+// how far ahead of the current entry GB_Iterator_rc_inext prefetches
+#define GB_ITERATOR_PREFETCH_DISTANCE 16
+
+#define GB_Iterator_rc_prefetch(iterator,pnext)                             \
+(                                                                           \
+    ((pnext) < iterator->pend) ?                                            \
+    (                                                                       \
+        /* prefetch the value at position pnext */                          \
+        GB_Iterator_prefetch_hint (((const char *) iterator->Ax) +          \
+            ((iterator->iso) ? 0 : ((pnext) * iterator->type_size))),       \
+        /* prefetch the index at position pnext, if present */              \
+        ((iterator->Ai != NULL) ?                                           \
+            GB_Iterator_prefetch_hint (&(iterator->Ai [(pnext)]))           \
+            : ((void) 0))                                                   \
+    )                                                                       \
+    : ((void) 0)                                                            \
+)
+
 //------------------------------------------------------------------------------
 // GB_Iterator_rc_knext: move a row/col iterator to the next vector
 //------------------------------------------------------------------------------
@@ -11241,6 +12521,8 @@ GrB_Info GB_Iterator_rc_bitmap_next (GxB_Iterator iterator) ;
             iterator->pstart = iterator->Ap [iterator->k],                  \
             iterator->pend = iterator->Ap [iterator->k+1],                  \
             iterator->p = iterator->pstart,                                 \
+            /* prefetch the start of the new vector */                      \
+            GB_Iterator_rc_prefetch (iterator, iterator->p),                \
             ((iterator->p >= iterator->pend) ? GrB_NO_VALUE : GrB_SUCCESS)  \
         )                                                                   \
         :                                                                   \
@@ -11284,6 +12566,9 @@ GrB_Info GB_Iterator_rc_bitmap_next (GxB_Iterator iterator) ;
         )                                                                   \
         :                                                                   \
         (                                                                   \
+            /* prefetch ahead of the current entry */                       \
+            GB_Iterator_rc_prefetch (iterator,                              \
+                iterator->p + GB_ITERATOR_PREFETCH_DISTANCE),               \
             GrB_SUCCESS                                                     \
         )                                                                   \
     )                                                                       \
@@ -11337,6 +12622,7 @@ GrB_Info GB_Iterator_rc_bitmap_next (GxB_Iterator iterator) ;
 //==============================================================================
 
 #undef GxB_rowIterator_attach
+#undef GxB_rowIterator_attachRange
 #undef GxB_rowIterator_kount
 #undef GxB_rowIterator_seekRow
 #undef GxB_rowIterator_kseek
@@ -11377,6 +12663,37 @@ GrB_Info GxB_rowIterator_attach
     GB_Iterator_attach (iterator, A, GxB_BY_ROW, desc)                      \
 )
 
+//------------------------------------------------------------------------------
+// GxB_rowIterator_attachRange: attach a row iterator to a range of rows
+//------------------------------------------------------------------------------
+
+// GxB_rowIterator_attachRange is identical to GxB_rowIterator_attach, except
+// that the iterator visits only rows k0 to k1-1 of A, in the sense of
+// GxB_rowIterator_kseek: for a hypersparse matrix, k0 and k1 are positions in
+// the list of non-empty rows, not row indices.  The value k1 is clamped to
+// the kount of the matrix, and GrB_INVALID_INDEX is returned if k0 > k1.
+// On success, the iterator is also moved to the first row of its range, and
+// the method returns GrB_SUCCESS if that row has at least one entry,
+// GrB_NO_VALUE if it is empty, or GxB_EXHAUSTED if the range itself is empty.
+
+// Together with GxB_Matrix_iteratorSlice, this allows the iteration of a
+// whole matrix to be partitioned across multiple user threads, each with its
+// own iterator attached to its own range of rows.
+
+GrB_Info GxB_rowIterator_attachRange
+(
+    GxB_Iterator iterator,
+    GrB_Matrix A,
+    GrB_Index k0,
+    GrB_Index k1,
+    GrB_Descriptor desc
+) ;
+
+#define GxB_rowIterator_attachRange(iterator, A, k0, k1, desc)              \
+(                                                                           \
+    GB_Iterator_attach_range (iterator, A, GxB_BY_ROW, k0, k1, desc)        \
+)
+
 //------------------------------------------------------------------------------
 // GxB_rowIterator_kount: upper bound on the # of nonempty rows of a matrix
 //------------------------------------------------------------------------------
@@ -11543,6 +12860,7 @@ GrB_Index GxB_rowIterator_getColIndex (GxB_Iterator iterator) ;
 // The column iterator is analoguous to the row iterator.
 
 #undef GxB_colIterator_attach
+#undef GxB_colIterator_attachRange
 #undef GxB_colIterator_kount
 #undef GxB_colIterator_seekCol
 #undef GxB_colIterator_kseek
@@ -11563,6 +12881,20 @@ GrB_Info GxB_colIterator_attach
     GB_Iterator_attach (iterator, A, GxB_BY_COL, desc)                      \
 )
 
+// GxB_colIterator_attachRange: attach a column iterator to columns k0 to k1-1
+GrB_Info GxB_colIterator_attachRange
+(
+    GxB_Iterator iterator,
+    GrB_Matrix A,
+    GrB_Index k0,
+    GrB_Index k1,
+    GrB_Descriptor desc
+) ;
+#define GxB_colIterator_attachRange(iterator, A, k0, k1, desc)              \
+(                                                                           \
+    GB_Iterator_attach_range (iterator, A, GxB_BY_COL, k0, k1, desc)        \
+)
+
 // GxB_colIterator_kount: return # of nonempty columns of the matrix
 GrB_Index GxB_colIterator_kount (GxB_Iterator iterator) ;
 #define GxB_colIterator_kount(iterator)                                     \
@@ -11744,6 +13076,42 @@ void GxB_Matrix_Iterator_getIndex
     GrB_Index *col
 ) ;
 
+//==============================================================================
+// GxB_Iterator_getSlice: zero-copy access to the current vector
+//==============================================================================
+
+// GxB_Iterator_getSlice provides bulk zero-copy access to the vector at which
+// a row/col iterator is positioned: the id of the vector (its row index for a
+// row iterator, its column index for a col iterator), a pointer to its
+// indices, a pointer to its values, and the # of entries it holds.  The
+// pointers alias the internal arrays of the matrix, so the entire vector can
+// be consumed without any per-entry iterator calls.  Position the iterator
+// with GxB_rowIterator_seekRow, GxB_rowIterator_kseek, or
+// GxB_rowIterator_nextRow (or the col or attachRange variants), then call
+// GxB_Iterator_getSlice once per vector.
+
+// If the matrix is full, indices is returned as NULL, and the implicit
+// indices of the vector are 0 to len-1.  If the matrix is iso-valued (see
+// GxB_Matrix_iso), values points to the single iso value, shared by all
+// entries.  GrB_NOT_IMPLEMENTED is returned if the matrix is in bitmap form,
+// since its entries are not held contiguously; convert it to sparse first
+// (via GxB_Matrix_Option_set and GxB_SPARSITY_CONTROL) to stream it in bulk.
+
+// The returned pointers remain valid only until the matrix is modified or
+// freed; as with all iterator methods, no other user thread may modify the
+// matrix while it is being iterated.
+
+GrB_Info GxB_Iterator_getSlice  // zero-copy view of the current vector
+(
+    // input:
+    GxB_Iterator iterator,
+    // output:
+    GrB_Index *jvec,            // id of the current vector (row or column)
+    const GrB_Index **indices,  // indices of the entries, or NULL if full
+    const void **values,        // values of the entries
+    GrB_Index *len              // # of entries in the vector
+) ;
+
 //==============================================================================
 // GxB_Vector_Iterator_*: iterate over the entries of a vector
 //==============================================================================
@@ -142,6 +142,14 @@
                         return (GrB_SUCCESS) ;
                     }
                     #endif
+                    #if GB_COMPILER_SUPPORTS_NEON && GB_V4_256
+                    {
+                        // ARM64 with NEON
+                        GB_AxB_saxpy5_unrolled_neon (C, A, B,
+                            ntasks, nthreads, B_slice) ;
+                        return (GrB_SUCCESS) ;
+                    }
+                    #endif
                 #endif
                 // any architecture and any built-in semiring
                 GB_AxB_saxpy5_unrolled_vanilla (C, A, B,
@@ -46,7 +46,7 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
     // tuples exist, wait and then extractElement again.
 
     // delete any lingering zombies, assemble any pending tuples, and unjumble
-    if (A->Pending != NULL || A->nzombies > 0 || A->jumbled)
+    if (GB_ANY_PENDING_WORK (A))
     { 
         GrB_Info info ;
         GB_WHERE1 (GB_WHERE_STRING) ;
@@ -137,12 +137,35 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
         }
 
         // vector j has been found, now look for index i
-        pleft = pA_start ;
-        int64_t pright = pA_end - 1 ;
-
-        // Time taken for this step is at most O(log(nnz(A(:,j))).
         const int64_t *restrict Ai = A->i ;
-        GB_BINARY_SEARCH (i, Ai, pleft, pright, found) ;
+
+        if (A->lookup_p != NULL)
+        {
+            // O(1) probe of the point-lookup index (see GB_lookup_cache.c):
+            // scan the bucket of (i,j) for a position that lies in vector j
+            // and holds index i; the bucket has one entry on average
+            const int64_t *restrict Bp = A->lookup_p ;
+            const int64_t *restrict Be = A->lookup_e ;
+            const int64_t b = GB_HASHF_POINT (i, j, A->lookup_nbuckets - 1) ;
+            found = false ;
+            pleft = -1 ;
+            for (int64_t s = Bp [b] ; s < Bp [b+1] && !found ; s++)
+            { 
+                const int64_t p = Be [s] ;
+                found = (p >= pA_start && p < pA_end && Ai [p] == i) ;
+                if (found)
+                { 
+                    pleft = p ;
+                }
+            }
+        }
+        else
+        { 
+            // Time taken for this step is at most O(log(nnz(A(:,j))).
+            pleft = pA_start ;
+            int64_t pright = pA_end - 1 ;
+            GB_BINARY_SEARCH (i, Ai, pleft, pright, found) ;
+        }
 
     }
     else
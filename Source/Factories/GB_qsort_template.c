@@ -16,6 +16,107 @@
 // variant of GB_qsort*, and given unique names via #define's in the
 // #include'ing file.
 
+#define GB_sortnet  GB_EVAL2 (GB_quicksort, _sortnet)
+#define GB_heapsort GB_EVAL2 (GB_quicksort, _heapsort)
+
+//------------------------------------------------------------------------------
+// GB_sortnet: sorting network for small arrays, n <= GB_SORTNET_MAX
+//------------------------------------------------------------------------------
+
+// Batcher's odd-even merge sort.  The sequence of compare-exchanges depends
+// only on n, never on the data, so the branch predictor sees a fixed pattern
+// instead of the data-dependent inner loop of an insertion sort.  The sorts
+// inside wait/build consist of millions of tiny per-vector runs, where those
+// mispredictions dominate.  Compare-exchanges whose second position falls at
+// or beyond n are dropped, which is the same as padding A with +infinity.
+
+#ifndef GB_SORTNET_MAX
+#define GB_SORTNET_MAX 16
+#endif
+
+static inline void GB_sortnet
+(
+    GB_args (A),            // array(s) to sort
+    const int64_t n         // size of the array(s), n <= GB_SORTNET_MAX
+)
+{
+    for (int64_t p = 1 ; p < n ; p <<= 1)
+    {
+        for (int64_t q = p ; q >= 1 ; q >>= 1)
+        {
+            for (int64_t j = q % p ; j + q < n ; j += 2*q)
+            {
+                for (int64_t i = 0 ; i < q ; i++)
+                {
+                    int64_t a = i + j ;
+                    int64_t b = a + q ;
+                    if (b < n && (a / (2*p) == b / (2*p)) &&
+                        GB_lt (A, b, A, a))
+                    { 
+                        // compare-exchange A [a] and A [b]
+                        GB_swap (A, a, b) ;
+                    }
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_heapsort: in-place heapsort, the quicksort depth-limit fallback
+//------------------------------------------------------------------------------
+
+// O(n log n) worst case, used only when the quicksort pivots have been
+// repeatedly unlucky and the recursion is far deeper than expected, so that
+// an adversarial input cannot go quadratic.
+
+static void GB_heapsort
+(
+    GB_args (A),            // array(s) to sort
+    const int64_t n         // size of the array(s) to sort
+)
+{
+    // build a max-heap in A [0:n-1], then extract the maximum n-1 times
+    int64_t start = n / 2 ;
+    int64_t end = n ;
+    while (end > 1)
+    {
+        int64_t root ;
+        if (start > 0)
+        { 
+            // heap construction: sift down the next internal node
+            start-- ;
+            root = start ;
+        }
+        else
+        { 
+            // extraction: move the maximum to the end and shrink the heap
+            end-- ;
+            GB_swap (A, 0, end) ;
+            root = 0 ;
+        }
+        // sift A [root] down to its place in the heap A [root:end-1]
+        while (2*root + 1 < end)
+        {
+            int64_t child = 2*root + 1 ;
+            if (child + 1 < end && GB_lt (A, child, A, child+1))
+            { 
+                // the right child is the larger of the two children
+                child++ ;
+            }
+            if (GB_lt (A, root, A, child))
+            { 
+                GB_swap (A, root, child) ;
+                root = child ;
+            }
+            else
+            { 
+                break ;
+            }
+        }
+    }
+}
+
 //------------------------------------------------------------------------------
 // GB_partition: use a pivot to partition an array
 //------------------------------------------------------------------------------
@@ -91,21 +192,21 @@ static void GB_quicksort    // sort A [0:n-1]
 (
     GB_args (A),            // array(s) to sort
     const int64_t n,        // size of the array(s) to sort
+    int depth_limit,        // remaining quicksort recursion depth
     uint64_t *seed          // random number seed
 )
 {
 
-    if (n < 20)
-    {
-        // in-place insertion sort on A [0:n-1], where n is small
-        for (int64_t k = 1 ; k < n ; k++)
-        {
-            for (int64_t j = k ; j > 0 && GB_lt (A, j, A, j-1) ; j--)
-            { 
-                // swap A [j-1] and A [j]
-                GB_swap (A, j-1, j) ;
-            }
-        }
+    if (n <= GB_SORTNET_MAX)
+    { 
+        // sorting network on A [0:n-1], where n is small
+        GB_sortnet (GB_arg (A), n) ;
+    }
+    else if (depth_limit <= 0)
+    { 
+        // the recursion is much deeper than expected for random pivots;
+        // finish this partition with heapsort instead (see GB_qsort_depth)
+        GB_heapsort (GB_arg (A), n) ;
     }
     else
     { 
@@ -113,8 +214,11 @@ static void GB_quicksort    // sort A [0:n-1]
         int64_t k = GB_partition (GB_arg (A), n, seed) ;
 
         // sort each partition
-        GB_quicksort (GB_arg (A), k, seed) ;                // sort A [0:k-1]
-        GB_quicksort (GB_arg_offset (A, k), n-k, seed) ;    // sort A [k+1:n-1]
+        GB_quicksort (GB_arg (A), k, depth_limit-1, seed) ;
+        GB_quicksort (GB_arg_offset (A, k), n-k, depth_limit-1, seed) ;
     }
 }
 
+#undef GB_sortnet
+#undef GB_heapsort
+
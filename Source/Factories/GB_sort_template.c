@@ -642,6 +642,368 @@ static void GB_SORT (vector)    // sort the pair of arrays A_0, A_1
     }
 }
 
+//------------------------------------------------------------------------------
+// GB_SORT (select_k): move the k best entries of an array to the front
+//------------------------------------------------------------------------------
+
+// Quickselect: repeatedly partition the array with GB_SORT (partition) until
+// A [0:k-1] holds the k smallest entries (per GB_LT, so the k largest for a
+// descending sort), in arbitrary order.  Expected O(n) time; nothing is fully
+// sorted.  Requires 0 < k < n.
+
+static void GB_SORT (select_k)
+(
+    GB_TYPE *restrict A_0,  // size n array
+    int64_t *restrict A_1,  // size n array
+    const int64_t n,        // size of the array(s)
+    const int64_t k,        // # of entries to select, 0 < k < n
+    uint64_t *seed          // random number seed
+    #if GB_SORT_UDT
+    , size_t csize              // size of GB_TYPE
+    , size_t xsize              // size of op->xtype
+    , GxB_binary_function flt   // function to test for < (ascend), > (descend)
+    , GB_cast_function fcast    // cast entry to inputs of flt
+    #endif
+)
+{
+
+    // A [lo..hi-1] still straddles position k; entries outside that range
+    // are already on their correct side of it
+    int64_t lo = 0 ;
+    int64_t hi = n ;
+    while (hi - lo > 20)
+    {
+        // partition A [lo..hi-1]; both parts are nonempty
+        int64_t split = lo + GB_SORT (partition) (GB_ADDR (A_0, lo),
+            A_1 + lo, hi - lo, seed
+            #if GB_SORT_UDT
+            , csize, xsize, flt, fcast
+            #endif
+            ) ;
+        if (split <= k)
+        { 
+            lo = split ;
+        }
+        else
+        { 
+            hi = split ;
+        }
+        if (lo == k)
+        { 
+            // A [0..k-1] <= A [k..n-1]: done
+            return ;
+        }
+    }
+
+    // sort the small remaining range that straddles position k
+    GB_SORT (quicksort) (GB_ADDR (A_0, lo), A_1 + lo, hi - lo, seed
+        #if GB_SORT_UDT
+        , csize, xsize, flt, fcast
+        #endif
+        ) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_SORT (top_k): keep the k best entries of a single long vector
+//------------------------------------------------------------------------------
+
+// Parallel top-k selection: the vector is cut into nt slices and each slice
+// selects its own k best entries in parallel; the k best of those nt*k
+// candidates are then selected and sorted by a single thread and placed in
+// A [0:k-1], in sorted order.  The rest of A is left in arbitrary order; the
+// caller truncates it.  Requires nt >= 2 and nt*k <= n, so that every slice
+// has at least k entries and the candidate buffer fits in the workspace.
+
+static void GB_SORT (top_k)
+(
+    GB_TYPE *restrict A_0,      // size n array
+    int64_t *restrict A_1,      // size n array
+    GB_TYPE *restrict W_0,      // workspace of size n * GB_SIZE bytes
+    int64_t *restrict W,        // int64_t workspace of size n+6*ntasks+1
+    const int64_t n,
+    const int64_t k,            // # of entries to keep, nt*k <= n
+    const int nt                // # of slices, 2 <= nt <= # of threads
+    #if GB_SORT_UDT
+    , size_t csize              // size of GB_TYPE
+    , size_t xsize              // size of op->xtype
+    , GxB_binary_function flt   // function to test for < (ascend), > (descend)
+    , GB_cast_function fcast    // cast entry to inputs of flt
+    #endif
+)
+{
+
+    //--------------------------------------------------------------------------
+    // split up workspace
+    //--------------------------------------------------------------------------
+
+    int64_t *restrict W_1   = W ;           // candidate indices, size nt*k
+    int64_t *restrict Slice = W + n ;       // slice boundaries, size nt+1
+
+    //--------------------------------------------------------------------------
+    // each slice selects its own k best entries as candidates
+    //--------------------------------------------------------------------------
+
+    GB_eslice (Slice, n, nt) ;
+    int tid ;
+    #pragma omp parallel for num_threads(nt) schedule(dynamic,1)
+    for (tid = 0 ; tid < nt ; tid++)
+    { 
+        int64_t p0 = Slice [tid] ;
+        int64_t len = Slice [tid+1] - p0 ;
+        uint64_t myseed = (uint64_t) tid ;
+        ASSERT (len >= k) ;
+        if (len > k)
+        { 
+            GB_SORT (select_k) (GB_ADDR (A_0, p0), A_1 + p0, len, k, &myseed
+                #if GB_SORT_UDT
+                , csize, xsize, flt, fcast
+                #endif
+                ) ;
+        }
+        // append the k best entries of this slice to the candidates
+        memcpy (GB_ADDR (W_0, tid * k), GB_ADDR (A_0, p0), k * GB_SIZE) ;
+        memcpy (W_1 + tid * k, A_1 + p0, k * sizeof (int64_t)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // select and sort the k best of the nt*k candidates
+    //--------------------------------------------------------------------------
+
+    uint64_t seed = (uint64_t) n ;
+    GB_SORT (select_k) (W_0, W_1, nt * k, k, &seed
+        #if GB_SORT_UDT
+        , csize, xsize, flt, fcast
+        #endif
+        ) ;
+    GB_SORT (quicksort) (W_0, W_1, k, &seed
+        #if GB_SORT_UDT
+        , csize, xsize, flt, fcast
+        #endif
+        ) ;
+
+    // the k best entries of the whole vector, in sorted order
+    memcpy (A_0, W_0, k * GB_SIZE) ;
+    memcpy (A_1, W_1, k * sizeof (int64_t)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_SORT (find_bucket): binary search of the splitters for an entry
+//------------------------------------------------------------------------------
+
+// Returns the sample-sort bucket of entry A [p]: the smallest b for which
+// A [p] < S [(b+1)*GB_SORT_OVERSAMPLE-1], or nbuckets-1 if there is none.
+// Ties are broken by index (as in GB_LT), so every entry has exactly one
+// bucket and the buckets are totally ordered.
+
+static inline int64_t GB_SORT (find_bucket)
+(
+    const GB_TYPE *restrict A_0,    // the entry is A [p]
+    const int64_t *restrict A_1,
+    const int64_t p,
+    const GB_TYPE *restrict S_0,    // sorted samples
+    const int64_t *restrict S_1,
+    const int nbuckets              // # of buckets; nbuckets-1 splitters
+    #if GB_SORT_UDT
+    , size_t csize              // size of GB_TYPE
+    , size_t xsize              // size of op->xtype
+    , GxB_binary_function flt   // function to test for < (ascend), > (descend)
+    , GB_cast_function fcast    // cast entry to inputs of flt
+    #endif
+)
+{
+    int64_t lo = 0 ;
+    int64_t hi = nbuckets - 1 ;
+    GB_GET (a0, A_0, p) ;           // a0 = A_0 [p]
+    while (lo < hi)
+    {
+        // splitter mid separates buckets 0..mid from buckets mid+1 and up
+        int64_t mid = (lo + hi) / 2 ;
+        int64_t sp = (mid + 1) * GB_SORT_OVERSAMPLE - 1 ;
+        bool less ;
+        GB_GET (s0, S_0, sp) ;      // s0 = S_0 [sp]
+        GB_LT (less, a0, A_1 [p],    s0, S_1 [sp]) ;
+        if (less)
+        { 
+            hi = mid ;
+        }
+        else
+        { 
+            lo = mid + 1 ;
+        }
+    }
+    return (lo) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_SORT (sample_sort): parallel sample sort of a single long vector
+//------------------------------------------------------------------------------
+
+// The mergesort above moves all n entries between A and W once per pair of
+// merge levels, so its memory traffic grows with the thread count.  For a
+// single very long vector, a sample sort is used instead: splitters taken
+// from a sorted sample of the vector partition its entries into nbuckets
+// independent, totally-ordered ranges.  One counting pass and one scatter
+// pass place every entry into its bucket in W, and each bucket is then
+// sorted in place and copied back -- a constant number of passes over the
+// data, regardless of the thread count.  Returns GrB_NO_VALUE if the sample
+// workspace cannot be allocated; the caller then falls back to the
+// mergesort, GB_SORT (vector).
+
+static GrB_Info GB_SORT (sample_sort)
+(
+    GB_TYPE *restrict A_0,      // size n array
+    int64_t *restrict A_1,      // size n array
+    GB_TYPE *restrict W_0,      // workspace of size n * GB_SIZE bytes
+    int64_t *restrict W,        // int64_t workspace of size n or more
+    const int64_t n,            // must be (much) larger than the sample
+    const int nbuckets,         // # of buckets to partition into
+    const int nthreads          // # of threads to use
+    #if GB_SORT_UDT
+    , size_t csize              // size of GB_TYPE
+    , size_t xsize              // size of op->xtype
+    , GxB_binary_function flt   // function to test for < (ascend), > (descend)
+    , GB_cast_function fcast    // cast entry to inputs of flt
+    #endif
+)
+{
+
+    //--------------------------------------------------------------------------
+    // allocate the sample workspace
+    //--------------------------------------------------------------------------
+
+    int64_t *restrict W_1 = W ;
+    int64_t nsamples = ((int64_t) nbuckets) * GB_SORT_OVERSAMPLE ;
+    ASSERT (n > 2 * nsamples) ;
+
+    // Swork holds the sample indices S_1, the scan slice boundaries, the
+    // bucket start positions, and one row of bucket counts per scan task
+    int64_t *restrict Swork = NULL ; size_t Swork_size = 0 ;
+    GB_void *restrict S_0x  = NULL ; size_t S_0x_size  = 0 ;
+    Swork = GB_MALLOC_WORK (nsamples + 2*(nbuckets+1) +
+        ((int64_t) nbuckets) * nbuckets, int64_t, &Swork_size) ;
+    S_0x = GB_MALLOC_WORK (nsamples * GB_SIZE, GB_void, &S_0x_size) ;
+    if (Swork == NULL || S_0x == NULL)
+    { 
+        // out of memory; the caller uses the mergesort instead
+        GB_FREE_WORK (&Swork, Swork_size) ;
+        GB_FREE_WORK (&S_0x, S_0x_size) ;
+        return (GrB_NO_VALUE) ;
+    }
+    GB_TYPE *restrict S_0 = (GB_TYPE *) S_0x ;
+    int64_t *restrict S_1    = Swork ;                      // size nsamples
+    int64_t *restrict Slice  = S_1 + nsamples ;             // size nbuckets+1
+    int64_t *restrict Bstart = Slice + (nbuckets+1) ;       // size nbuckets+1
+    int64_t *restrict Count  = Bstart + (nbuckets+1) ;      // nbuckets^2
+
+    //--------------------------------------------------------------------------
+    // sort an evenly strided sample of A and pick the splitters
+    //--------------------------------------------------------------------------
+
+    uint64_t seed = (uint64_t) n ;
+    for (int64_t t = 0 ; t < nsamples ; t++)
+    { 
+        int64_t p = ((t + 1) * n) / (nsamples + 1) ;
+        GB_COPY (S_0, t, A_0, p) ;
+        S_1 [t] = A_1 [p] ;
+    }
+    GB_SORT (quicksort) (S_0, S_1, nsamples, &seed
+        #if GB_SORT_UDT
+        , csize, xsize, flt, fcast
+        #endif
+        ) ;
+
+    // splitter b is S [(b+1)*GB_SORT_OVERSAMPLE-1], for b = 0 to nbuckets-2;
+    // oversampling keeps the buckets balanced even on skewed distributions
+
+    //--------------------------------------------------------------------------
+    // counting pass: how many entries of each scan slice go to each bucket
+    //--------------------------------------------------------------------------
+
+    GB_eslice (Slice, n, nbuckets) ;    // one scan task per bucket
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < nbuckets ; tid++)
+    {
+        int64_t *restrict MyCount = Count + ((int64_t) tid) * nbuckets ;
+        memset (MyCount, 0, nbuckets * sizeof (int64_t)) ;
+        for (int64_t p = Slice [tid] ; p < Slice [tid+1] ; p++)
+        { 
+            int64_t b = GB_SORT (find_bucket) (A_0, A_1, p, S_0, S_1, nbuckets
+                #if GB_SORT_UDT
+                , csize, xsize, flt, fcast
+                #endif
+                ) ;
+            MyCount [b]++ ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // turn the counts into cursors
+    //--------------------------------------------------------------------------
+
+    // entries of scan task t bound for bucket b start at position
+    // Count [t*nbuckets+b] of W, and bucket b itself starts at Bstart [b]
+
+    int64_t s = 0 ;
+    for (int64_t b = 0 ; b < nbuckets ; b++)
+    {
+        Bstart [b] = s ;
+        for (int64_t t = 0 ; t < nbuckets ; t++)
+        { 
+            int64_t c = Count [t * nbuckets + b] ;
+            Count [t * nbuckets + b] = s ;
+            s += c ;
+        }
+    }
+    Bstart [nbuckets] = s ;
+    ASSERT (s == n) ;
+
+    //--------------------------------------------------------------------------
+    // scatter pass: move each entry into its bucket in W
+    //--------------------------------------------------------------------------
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < nbuckets ; tid++)
+    {
+        int64_t *restrict MyCount = Count + ((int64_t) tid) * nbuckets ;
+        for (int64_t p = Slice [tid] ; p < Slice [tid+1] ; p++)
+        { 
+            int64_t b = GB_SORT (find_bucket) (A_0, A_1, p, S_0, S_1, nbuckets
+                #if GB_SORT_UDT
+                , csize, xsize, flt, fcast
+                #endif
+                ) ;
+            int64_t q = MyCount [b]++ ;
+            GB_COPY (W_0, q, A_0, p) ;
+            W_1 [q] = A_1 [p] ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // sort each bucket in place and copy it back
+    //--------------------------------------------------------------------------
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < nbuckets ; tid++)
+    { 
+        int64_t q = Bstart [tid] ;
+        int64_t bnz = Bstart [tid+1] - q ;
+        uint64_t myseed = (uint64_t) tid ;
+        GB_SORT (quicksort) (GB_ADDR (W_0, q), W_1 + q, bnz, &myseed
+            #if GB_SORT_UDT
+            , csize, xsize, flt, fcast
+            #endif
+            ) ;
+        // the buckets are ordered, so this completes the sort of A
+        memcpy (GB_ADDR (A_0, q), GB_ADDR (W_0, q), bnz * GB_SIZE) ;
+        memcpy (A_1 + q, W_1 + q, bnz * sizeof (int64_t)) ;
+    }
+
+    GB_FREE_WORK (&Swork, Swork_size) ;
+    GB_FREE_WORK (&S_0x, S_0x_size) ;
+    return (GrB_SUCCESS) ;
+}
+
 //------------------------------------------------------------------------------
 // sort all vectors in a matrix
 //------------------------------------------------------------------------------
@@ -658,6 +1020,7 @@ static void GB_SORT (vector)    // sort the pair of arrays A_0, A_1
 static GrB_Info GB_SORT (matrix)
 (
     GrB_Matrix C,               // matrix sorted in-place
+    const int64_t klimit,       // max # of entries to keep in each vector
     #if GB_SORT_UDT
     GrB_BinaryOp op,            // comparator for user-defined types only
     #endif
@@ -749,10 +1112,22 @@ static GrB_Info GB_SORT (matrix)
             const int64_t pC_end   = Cp [k+1] ;
             const int64_t cknz = pC_end - pC_start ;
             if (cknz <= GB_BASECASE || nthreads == 1)
-            { 
+            {
                 uint64_t seed = k ;
+                int64_t keep = cknz ;
+                if (cknz > klimit)
+                { 
+                    // move the klimit best entries of C(:,k) to the front
+                    GB_SORT (select_k) (GB_ADDR (Cx, pC_start), Ci + pC_start,
+                        cknz, klimit, &seed
+                        #if GB_SORT_UDT
+                        , csize, xsize, flt, fcast
+                        #endif
+                        ) ;
+                    keep = klimit ;
+                }
                 GB_SORT (quicksort) (GB_ADDR (Cx, pC_start), Ci + pC_start,
-                    cknz, &seed
+                    keep, &seed
                     #if GB_SORT_UDT
                     , csize, xsize, flt, fcast
                     #endif
@@ -857,12 +1232,64 @@ static GrB_Info GB_SORT (matrix)
     //--------------------------------------------------------------------------
 
     for (int64_t t = 0 ; t < total_skipped ; t++)
-    { 
+    {
         const int64_t k = C_skipped [t] ;
         const int64_t pC_start = Cp [k] ;
         const int64_t pC_end   = Cp [k+1] ;
         const int64_t cknz = pC_end - pC_start ;
         ASSERT (cknz > GB_BASECASE) ;
+        if (cknz > klimit)
+        {
+            // only the klimit best entries of C(:,k) are kept in the end,
+            // so find them without sorting all of C(:,k)
+            uint64_t seed = k ;
+            int nt = (int) GB_IMIN ((int64_t) nthreads, cknz / klimit) ;
+            if (nt > 1)
+            { 
+                // each of nt slices selects its own klimit best entries in
+                // parallel, and the klimit best of those candidates win
+                GB_SORT (top_k) (GB_ADDR (Cx, pC_start), Ci + pC_start,
+                    W_0, W, cknz, klimit, nt
+                    #if GB_SORT_UDT
+                    , csize, xsize, flt, fcast
+                    #endif
+                    ) ;
+            }
+            else
+            { 
+                // a single thread selects and sorts the klimit best
+                GB_SORT (select_k) (GB_ADDR (Cx, pC_start), Ci + pC_start,
+                    cknz, klimit, &seed
+                    #if GB_SORT_UDT
+                    , csize, xsize, flt, fcast
+                    #endif
+                    ) ;
+                GB_SORT (quicksort) (GB_ADDR (Cx, pC_start), Ci + pC_start,
+                    klimit, &seed
+                    #if GB_SORT_UDT
+                    , csize, xsize, flt, fcast
+                    #endif
+                    ) ;
+            }
+            continue ;
+        }
+        if (cknz >= GB_SORT_SAMPLE_MIN)
+        {
+            // very long vector: the sample sort does a constant number of
+            // passes over the data, regardless of the thread count
+            GrB_Info sinfo = GB_SORT (sample_sort) (GB_ADDR (Cx, pC_start),
+                Ci + pC_start, W_0, W, cknz,
+                GB_IMIN (ntasks2, GB_SORT_MAX_BUCKETS), nthreads
+                #if GB_SORT_UDT
+                , csize, xsize, flt, fcast
+                #endif
+                ) ;
+            if (sinfo == GrB_SUCCESS)
+            { 
+                continue ;
+            }
+            // no workspace for the sample sort; use the mergesort below
+        }
         GB_SORT (vector) (GB_ADDR (Cx, pC_start), Ci + pC_start,
             W_0, W, cknz, kk, ntasks2, nthreads
             #if GB_SORT_UDT
@@ -40,6 +40,8 @@
 
 // special case semirings:
 
+#define GB_SEMIRING_HAS_AVX_IMPLEMENTATION 1
+
 // monoid properties:
 #define GB_Z_TYPE int32_t
 #define GB_DECLARE_IDENTITY(z) int32_t z = INT32_MIN
@@ -213,6 +215,100 @@ GrB_Info GB (_Asaxpy4B__max_plus_int32)
 
     #if !GB_DISABLE && !GB_A_IS_PATTERN
 
+        //----------------------------------------------------------------------
+        // saxpy5 method with vectors of length 8 for double, 16 for single
+        //----------------------------------------------------------------------
+
+        // AVX512F: vector registers are 512 bits, or 64 bytes, which can hold
+        // 16 floats or 8 doubles.
+
+        #define GB_V16_512 (16 * GB_Z_NBITS <= 512)
+        #define GB_V8_512  ( 8 * GB_Z_NBITS <= 512)
+        #define GB_V4_512  ( 4 * GB_Z_NBITS <= 512)
+
+        #define GB_V16 GB_V16_512
+        #define GB_V8  GB_V8_512
+        #define GB_V4  GB_V4_512
+
+        #if GB_COMPILER_SUPPORTS_AVX512F && GB_V4_512
+
+            GB_TARGET_AVX512F static inline void GB_AxB_saxpy5_unrolled_avx512f
+            (
+                GrB_Matrix C,
+                const GrB_Matrix A,
+                const GrB_Matrix B,
+                const int ntasks,
+                const int nthreads,
+                const int64_t *B_slice
+            )
+            {
+                #include "GB_AxB_saxpy5_unrolled.c"
+            }
+
+        #endif
+
+        //----------------------------------------------------------------------
+        // saxpy5 method with vectors of length 4 for double, 8 for single
+        //----------------------------------------------------------------------
+
+        // AVX2: vector registers are 256 bits, or 32 bytes, which can hold
+        // 8 floats or 4 doubles.
+
+        #define GB_V16_256 (16 * GB_Z_NBITS <= 256)
+        #define GB_V8_256  ( 8 * GB_Z_NBITS <= 256)
+        #define GB_V4_256  ( 4 * GB_Z_NBITS <= 256)
+
+        #undef  GB_V16
+        #undef  GB_V8
+        #undef  GB_V4
+
+        #define GB_V16 GB_V16_256
+        #define GB_V8  GB_V8_256
+        #define GB_V4  GB_V4_256
+
+        #if GB_COMPILER_SUPPORTS_AVX2 && GB_V4_256
+
+            GB_TARGET_AVX2 static inline void GB_AxB_saxpy5_unrolled_avx2
+            (
+                GrB_Matrix C,
+                const GrB_Matrix A,
+                const GrB_Matrix B,
+                const int ntasks,
+                const int nthreads,
+                const int64_t *B_slice
+            )
+            {
+                #include "GB_AxB_saxpy5_unrolled.c"
+            }
+
+        #endif
+
+        //----------------------------------------------------------------------
+        // saxpy5 method for ARM64 NEON, same vector shapes as AVX2
+        //----------------------------------------------------------------------
+
+        // NEON (ASIMD) is a baseline feature of ARM64, so no runtime check
+        // and no target attribute is needed.  NEON registers are 128 bits;
+        // the 256-bit vector shapes above are lowered by the compiler onto
+        // pairs of NEON registers.
+
+        #if GB_COMPILER_SUPPORTS_NEON && GB_V4_256
+
+            static inline void GB_AxB_saxpy5_unrolled_neon
+            (
+                GrB_Matrix C,
+                const GrB_Matrix A,
+                const GrB_Matrix B,
+                const int ntasks,
+                const int nthreads,
+                const int64_t *B_slice
+            )
+            {
+                #include "GB_AxB_saxpy5_unrolled.c"
+            }
+
+        #endif
+
         //----------------------------------------------------------------------
         // saxpy5 method unrolled, with no vectors
         //----------------------------------------------------------------------
@@ -26,6 +26,11 @@
 #include "GB_nnz.h"
 #include "GB_omp.h"
 #include "GB_memory.h"
+#include "GB_pool.h"
+#include "GB_spill.h"
+#include "GB_share.h"
+#include "GB_prof.h"
+#include "GB_autotune.h"
 #include "GB_iso.h"
 #include "GB_Pending_n.h"
 #include "GB_nvals.h"
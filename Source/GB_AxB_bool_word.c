@@ -0,0 +1,103 @@
+//------------------------------------------------------------------------------
+// GB_AxB_bool_word: C=A*B for the boolean LOR_LAND semiring, word-parallel
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Computes C=A*B for the LOR_LAND_BOOL semiring where A and B are both full
+// and boolean, with no mask.  The boolean values are bytes holding 0 or 1,
+// so eight of them can be combined per 64-bit word (see GB_bitmap_scan.h):
+// C(:,j) is the OR of the columns A(:,k) for which B(k,j) is true, and each
+// OR pass moves word-at-a-time instead of byte-at-a-time.  The accumulation
+// into C(:,j) also saturates: once every byte of C(:,j) is 1, no further
+// column of A can change it, so the loop over k exits early.  The generic
+// saxbit kernel for this case applies LAND and LOR one byte-entry at a time
+// with no early exit.
+
+// C has been constructed by the caller (GB_AxB_saxbit) as bitmap, with Cb
+// all zero.  Since A and B are full, every dot product has all k terms
+// present, and C becomes an all-entries-present bitmap matrix.
+
+#include "GB_AxB_saxpy.h"
+#include "GB_bitmap_scan.h"
+
+GrB_Info GB_AxB_bool_word       // C = A*B, LOR_LAND_BOOL, A and B full
+(
+    GrB_Matrix C,               // output, bitmap, Cb all zero on input
+    const GrB_Matrix A,         // input matrix A, full, bool
+    const GrB_Matrix B,         // input matrix B, full, bool
+    const int nthreads_max,
+    const double chunk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (GB_IS_BITMAP (C)) ;
+    ASSERT (GB_IS_FULL (A) && !A->iso && A->type == GrB_BOOL) ;
+    ASSERT (GB_IS_FULL (B) && !B->iso && B->type == GrB_BOOL) ;
+
+    const int64_t m = C->vlen ;         // C is m-by-n
+    const int64_t n = C->vdim ;
+    const int64_t k = A->vdim ;         // A is m-by-k, B is k-by-n
+    const int64_t cnz = m * n ;
+
+    const bool *restrict Ax = (bool *) A->x ;
+    const bool *restrict Bx = (bool *) B->x ;
+    bool *restrict Cx = (bool *) C->x ;
+
+    int nthreads = GB_nthreads (((double) cnz) * ((double) k), chunk,
+        nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // C(:,j) = OR of A(:,k) for each k with B(k,j) true
+    //--------------------------------------------------------------------------
+
+    int64_t j ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (j = 0 ; j < n ; j++)
+    {
+        bool *restrict Cxj = Cx + j * m ;
+        const bool *restrict Bxj = Bx + j * k ;
+        memset (Cxj, 0, m) ;
+        for (int64_t kk = 0 ; kk < k ; kk++)
+        {
+            if (!Bxj [kk]) continue ;
+            const bool *restrict Axk = Ax + kk * m ;
+            uint64_t not_full = 0 ;
+            int64_t i = 0 ;
+            for ( ; i + 8 <= m ; i += 8)
+            {
+                // OR 8 entries of A(:,kk) into C(:,j) in a single word
+                uint64_t w = GB_bitmap_word ((const int8_t *) Cxj, i)
+                           | GB_bitmap_word ((const int8_t *) Axk, i) ;
+                memcpy (Cxj + i, &w, sizeof (uint64_t)) ;
+                not_full |= (w ^ GB_BITMAP_ALL8) ;
+            }
+            for ( ; i < m ; i++)
+            {
+                Cxj [i] |= Axk [i] ;
+                not_full |= (uint64_t) (!Cxj [i]) ;
+            }
+            if (not_full == 0)
+            {
+                // C(:,j) is all true; no further column of A can change it
+                break ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // all entries of C are present
+    //--------------------------------------------------------------------------
+
+    GB_memset (C->b, 1, cnz, nthreads_max) ;
+    C->nvals = cnz ;
+    ASSERT_MATRIX_OK (C, "C = A*B, boolean word-parallel", GB0) ;
+    return (GrB_SUCCESS) ;
+}
@@ -72,6 +72,8 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<#M>=A'*B, dot product method
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
+    GB_prof_info prof ;
+    GB_prof_start (&prof) ;
 
     ASSERT (C != NULL && (C->static_header || GBNSTATIC)) ;
     ASSERT_MATRIX_OK_OR_NULL (M_in, "M for dot A'*B", GB0) ;
@@ -181,7 +183,7 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<#M>=A'*B, dot product method
         GB_CLEAR_STATIC_HEADER (Mwork, &Mwork_header) ;
         GB_OK (GB_subref (Mwork, Mask_struct, M_in->is_csc, M_in,
             (A_is_hyper) ? Ah : GrB_ALL, cvlen,
-            (B_is_hyper) ? Bh : GrB_ALL, cvdim, false, Werk)) ;
+            (B_is_hyper) ? Bh : GrB_ALL, cvdim, false, NULL, Werk)) ;
         M = Mwork ;
         ASSERT_MATRIX_OK_OR_NULL (M, "M submask dot A'*B", GB0) ;
     }
@@ -228,7 +230,8 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<#M>=A'*B, dot product method
     }
 
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
+    // the chunk may have been adapted online for this kernel family
+    double chunk = GB_autotune_chunk ("dot2") ;
     int nthreads = GB_nthreads (work, chunk, nthreads_max) ;
 
     #define GB_NTASKS_PER_THREAD 32
@@ -402,6 +405,10 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<#M>=A'*B, dot product method
     // C<#>=A'*B, computing each entry with a dot product, via builtin semiring
     //--------------------------------------------------------------------------
 
+    // the slicing of A and B above forms the symbolic phase of the profile
+    // record; the numeric phase follows
+    GB_prof_phase (&prof) ;
+
     if (C_iso)
     { 
 
@@ -534,6 +541,7 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<#M>=A'*B, dot product method
     ASSERT (!GB_JUMBLED (C)) ;
     ASSERT (!GB_PENDING (C)) ;
     ASSERT (C->nvec_nonempty >= 0) ;
+    GB_prof_end (&prof, "dot2", C, naslice * nbslice, nthreads) ;
     return (GrB_SUCCESS) ;
 }
 
@@ -14,6 +14,8 @@
 
 bool GB_AxB_dot2_control  // true: use dot2, false: use saxpy
 (
+    const GrB_Matrix M,             // mask matrix (may be NULL)
+    const bool Mask_comp,           // if true, use !M
     const GrB_Matrix A,
     const GrB_Matrix B
 )
@@ -40,6 +42,29 @@ bool GB_AxB_dot2_control  // true: use dot2, false: use saxpy
     double anz = GB_nnz (A) ;       // # of entries in A
     double bnz = GB_nnz (B) ;       // # of entries in B
 
+    //--------------------------------------------------------------------------
+    // C<!M>=A'*B is very efficient if the complemented mask admits few dots
+    //--------------------------------------------------------------------------
+
+    if (M != NULL && Mask_comp)
+    {
+        // dot2 applies the complemented mask inside the kernel: the dot
+        // product for C(i,j) is skipped entirely when M(i,j)=1.  The saxpy
+        // methods ignore the complemented mask and compute all of C, leaving
+        // !M to be applied afterwards by GB_mask.  Estimate the # of dots
+        // that !M admits as the # of entries of C not in the pattern of M
+        // (an upper bound; a valued mask admits fewer).  If few dots remain,
+        // use dot2.  This occurs in the pull step of a direction-optimizing
+        // BFS, where !M is the complement of a mostly-dense visited vector.
+        double cdots =
+            ((double) M->vlen) * ((double) M->vdim) - (double) GB_nnz (M) ;
+        if (anz + bnz > 64 * GB_IMAX (cdots, 1))
+        { 
+            GBURBLE ("(!M small: dot) ") ;
+            return (true) ;
+        }
+    }
+
     if (A->nvec_nonempty < 0)
     { 
         // A->nvec_nonempty is used to select the method 
@@ -54,6 +54,8 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
+    GB_prof_info prof ;
+    GB_prof_start (&prof) ;
     ASSERT (C != NULL && (C->static_header || GBNSTATIC)) ;
 
     ASSERT_MATRIX_OK (M, "M for dot3 A'*B", GB0) ;
@@ -186,7 +188,8 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
     //--------------------------------------------------------------------------
 
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
+    // the chunk may have been adapted online for this kernel family
+    double chunk = GB_autotune_chunk ("dot3") ;
 
     //--------------------------------------------------------------------------
     // copy Mp and Mh into C
@@ -221,6 +224,13 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
     // as the pth entry in C.  This phase is purely symbolic and does not
     // depend on the data types or semiring.
 
+    if (GB_Context_cancelled ( ))
+    { 
+        // cancellation requested via the engaged Context
+        GB_FREE_ALL ;
+        return (GxB_CANCELLED) ;
+    }
+
     #include "GB_mxm_shared_definitions.h"
     #define GB_DOT3
     #define GB_DOT3_PHASE1
@@ -252,6 +262,18 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
 
     GBURBLE ("nthreads %d ntasks %d ", nthreads, ntasks) ;
 
+    // the structure of C and the tasks constructed above form the symbolic
+    // phase of the profile record; the numeric phase follows
+    GB_prof_phase (&prof) ;
+
+    if (GB_Context_cancelled ( ))
+    { 
+        // cancellation requested via the engaged Context
+        GB_FREE_ALL ;
+        return (GxB_CANCELLED) ;
+    }
+
+
     //--------------------------------------------------------------------------
     // C<M> = A'*B, via masked dot product method and built-in semiring
     //--------------------------------------------------------------------------
@@ -349,6 +371,7 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
     ASSERT (GB_ZOMBIES_OK (C)) ;
     ASSERT (GB_JUMBLED_OK (C)) ;
     ASSERT (!GB_PENDING (C)) ;
+    GB_prof_end (&prof, "dot3", C, (int64_t) ntasks, nthreads) ;
     return (GrB_SUCCESS) ;
 }
 
@@ -63,6 +63,8 @@ GrB_Info GB_AxB_dot4                // C+=A'*B, dot product method
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
+    GB_prof_info prof ;
+    GB_prof_start (&prof) ;
     ASSERT_MATRIX_OK (C, "C for dot in-place += A'*B", GB0) ;
     ASSERT_MATRIX_OK (A, "A for dot in-place += A'*B", GB0) ;
     ASSERT_MATRIX_OK (B, "B for dot in-place += A'*B", GB0) ;
@@ -82,6 +84,12 @@ GrB_Info GB_AxB_dot4                // C+=A'*B, dot product method
     GB_WERK_DECLARE (A_slice, int64_t) ;
     GB_WERK_DECLARE (B_slice, int64_t) ;
 
+    // C->x is read and modified in place: apply any deferred unary op, and
+    // if C->x is shared with a duplicate or snapshot, replace it with a
+    // private copy first
+    GB_OK (GB_materialize (C, Werk)) ;
+    GB_OK (GB_unshare (C)) ;
+
     //--------------------------------------------------------------------------
     // get the semiring operators
     //--------------------------------------------------------------------------
@@ -144,7 +152,8 @@ GrB_Info GB_AxB_dot4                // C+=A'*B, dot product method
     int64_t anz = GB_nnz_held (A) ;
     int64_t bnz = GB_nnz_held (B) ;
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
+    // the chunk may have been adapted online for this kernel family
+    double chunk = GB_autotune_chunk ("dot4") ;
     int nthreads = GB_nthreads (anz + bnz, chunk, nthreads_max) ;
 
     //--------------------------------------------------------------------------
@@ -290,6 +299,9 @@ GrB_Info GB_AxB_dot4                // C+=A'*B, dot product method
     { 
         ASSERT_MATRIX_OK (C, "dot4: output", GB0) ;
         (*done_in_place) = true ;
+        // dot4 is a single numeric phase; no GB_prof_phase is recorded
+        GB_prof_end (&prof, "dot4", C,
+            (int64_t) naslice * (int64_t) nbslice, nthreads) ;
     }
     else
     { 
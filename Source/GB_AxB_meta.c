@@ -38,6 +38,29 @@
 #include "GB_mxm.h"
 #include "GB_transpose.h"
 
+//------------------------------------------------------------------------------
+// GB_adotb_record: record the observed cost of a dot or saxpy method
+//------------------------------------------------------------------------------
+
+// Record the cost per entry of C, in seconds, observed for one C=A'*B method,
+// as an exponentially-weighted average in the matrix A.  The history is
+// consulted by GB_AxB_meta_adotb_control on later calls with the same A.
+
+static inline void GB_adotb_record
+(
+    float *cost,            // A->adotb_dot_cost or A->adotb_saxpy_cost
+    double tstart,          // start time of the method just completed
+    int64_t cnz             // # of entries in the result it computed
+)
+{
+    float c = (float) ((GB_omp_get_wtime ( ) - tstart) / ((double) cnz + 1)) ;
+    (*cost) = ((*cost) == 0) ? c : (0.5f * (*cost) + 0.5f * c) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_meta: C<M>=A*B meta algorithm
+//------------------------------------------------------------------------------
+
 GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
 (
     GrB_Matrix C,                   // output, static header (if not in-place)
@@ -209,6 +232,17 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     // possible combinations.  However, a CSR matrix that is transposed is just
     // the same as a non-transposed CSC matrix.
 
+    // Requested transposes are thus handled lazily wherever possible, and no
+    // transpose-view flag on the matrices themselves is needed: a transpose
+    // of a matrix in the opposite format is a logical no-op (the sense flips
+    // below), the swap rule rewrites the remaining cases to minimize the
+    // transpose work, and the dot-product methods then consume A'*B directly
+    // from A with nothing materialized.  An explicit transpose is built only
+    // when the chosen kernel truly requires it: AT = A' (or BT = B') for the
+    // saxpy and scale methods, and MT = M' whenever the mask format differs
+    // from C.  Those temporaries are freed when the mxm completes; they do
+    // not persist on the input matrices.
+
     // Use transpose to handle the CSR/CSC format.  If C is desired in CSR
     // format, treat it as if it were in format CSC but transposed.
     bool C_transpose = !C_is_csc ;
@@ -519,7 +553,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     #define GB_PROP_LEN (GxB_MAX_NAME_LEN+128)
     char A_str [GB_PROP_LEN+1] ;
     char B_str [GB_PROP_LEN+1] ;
-    if (GB_Global_burble_get ( ))
+    if (GB_Context_burble ( ))
     {
         int64_t anz = GB_nnz (A) ;
         int64_t bnz = GB_nnz (B) ;
@@ -561,6 +595,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
 
     // use GB_AxB_saxpy3 by default
     int axb_method = GB_USE_SAXPY ;
+    double adotb_tstart = 0 ;
 
     if (atrans)
     {
@@ -630,21 +665,27 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                 GB_OK (GB_colscale (C, AT, B, semiring, flipxy, Werk)) ;
                 break ;
 
-            case GB_USE_DOT : 
+            case GB_USE_DOT :
                 // C<M>=A'*B via dot, or C_in<M>+=A'*B if in-place
                 GBURBLE ("C%s=A'*B, %sdot_product ", M_str,
                     (M != NULL && !Mask_comp) ? "masked_" : "") ;
+                adotb_tstart = GB_omp_get_wtime ( ) ;
                 GB_OK (GB_AxB_dot (C, can_do_in_place ? C_in : NULL, M,
                     Mask_comp, Mask_struct, accum, A, B, semiring, flipxy,
                     mask_applied, done_in_place, Werk)) ;
+                GB_adotb_record (&(A->adotb_dot_cost), adotb_tstart,
+                    GB_nnz ((*done_in_place) ? C_in : C)) ;
                 break ;
 
-            default : 
+            default :
                 // C = A'*B via saxpy: Gustavson + Hash method
                 GBURBLE ("C%s=A'*B, saxpy (transposed %s) ", M_str, A_str) ;
+                adotb_tstart = GB_omp_get_wtime ( ) ;
                 GB_OK (GB_AxB_saxpy (C, can_do_in_place ? C_in : NULL, M,
                     Mask_comp, Mask_struct, accum, AT, B, semiring, flipxy,
                     mask_applied, done_in_place, AxB_method, do_sort, Werk)) ;
+                GB_adotb_record (&(A->adotb_saxpy_cost), adotb_tstart,
+                    GB_nnz ((*done_in_place) ? C_in : C)) ;
                 break ;
         }
 
@@ -80,9 +80,25 @@ void GB_AxB_meta_adotb_control
             // C<M>=A'*B uses the masked dot product method (dot3)
             (*axb_method) = GB_USE_DOT ;
         }
-        else if (GB_AxB_dot2_control (A, B))
-        { 
-            // C=A'*B or C<!M>=A'B* can efficiently use the dot2 method
+        else if (A->adotb_dot_cost > 0 && A->adotb_saxpy_cost > 0)
+        {
+            // Both the dot and saxpy methods have been tried on this matrix
+            // before: pick whichever observed the lower cost per entry of C.
+            // This adapts the push/pull choice across the calls of an
+            // iterative method (BFS on a power-law graph, for example),
+            // where the static dot2 estimate can be misled by a mask whose
+            // density changes from call to call.
+            if (A->adotb_dot_cost < A->adotb_saxpy_cost)
+            {
+                (*axb_method) = GB_USE_DOT ;
+            }
+        }
+        else if (GB_AxB_dot2_control (M, Mask_comp, A, B))
+        {
+            // C=A'*B or C<!M>=A'*B can efficiently use the dot2 method.
+            // dot3 cannot be used with a complemented mask (its output
+            // pattern is the mask itself), but dot2 tests !M inside the
+            // kernel and skips the dot product for each masked-out entry.
             (*axb_method) = GB_USE_DOT ;
         }
     }
@@ -135,6 +135,23 @@ GrB_Info GB_AxB_saxbit        // C = A*B where C is bitmap
     bool A_is_pattern, B_is_pattern ;
     GB_binop_pattern (&A_is_pattern, &B_is_pattern, flipxy, mult->opcode) ;
 
+    //--------------------------------------------------------------------------
+    // C = A*B via the word-parallel kernel for the boolean LOR_LAND semiring
+    //--------------------------------------------------------------------------
+
+    if (M == NULL && !C_iso && GB_IS_FULL (A) && GB_IS_FULL (B)
+        && !A->iso && !B->iso
+        && semiring->add->op->opcode == GB_LOR_binop_code
+        && mult->opcode == GB_LAND_binop_code
+        && A->type == GrB_BOOL && B->type == GrB_BOOL && ctype == GrB_BOOL)
+    { 
+        // both operands are full and boolean; the LAND multiplier is
+        // commutative so flipxy has no effect.  No workspace has been
+        // allocated yet, so the kernel result is returned directly.
+        GBURBLE ("(bool word-parallel saxpy) ") ;
+        return (GB_AxB_bool_word (C, A, B, nthreads_max, chunk)) ;
+    }
+
     //--------------------------------------------------------------------------
     // slice the M matrix
     //--------------------------------------------------------------------------
@@ -205,6 +205,18 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
         // or hypersparse.
 
         ASSERT (C_sparsity == GxB_HYPERSPARSE || C_sparsity == GxB_SPARSE) ;
+
+        #if defined ( GRAPHBLAS_HAS_CUDA )
+        if (M == NULL && !C_iso &&  // fixme for CUDA: handle masked and iso
+            GB_AxB_saxpy3_cuda_branch (A, B, semiring, flipxy))
+        {
+            // C is left jumbled; fixme for CUDA: honor do_sort
+            info = GB_AxB_saxpy3_cuda (C, C_sparsity, A, B, semiring,
+                flipxy) ;
+            return (info) ;
+        }
+        #endif
+
         info = GB_AxB_saxpy3 (C, C_iso, cscalar, C_sparsity, M, Mask_comp,
             Mask_struct, A, B, semiring, flipxy, mask_applied, AxB_method,
             do_sort, Werk) ;
@@ -100,6 +100,15 @@ GrB_Info GB_AxB_saxpy5              // C += A*B
 // saxbit:
 //------------------------------------------------------------------------------
 
+GrB_Info GB_AxB_bool_word       // C = A*B, LOR_LAND_BOOL, A and B full
+(
+    GrB_Matrix C,               // output, bitmap, Cb all zero on input
+    const GrB_Matrix A,         // input matrix A, full, bool
+    const GrB_Matrix B,         // input matrix B, full, bool
+    const int nthreads_max,
+    const double chunk
+) ;
+
 GrB_Info GB_AxB_saxbit        // C = A*B where C is bitmap
 (
     GrB_Matrix C,                   // output matrix, static header
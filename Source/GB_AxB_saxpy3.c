@@ -90,6 +90,7 @@
 //------------------------------------------------------------------------------
 
 #include "GB_mxm.h"
+#include "GB_AxB_saxpy3_plan.h"
 #include "GB_stringify.h"
 #include "GB_AxB_saxpy_generic.h"
 #include "GB_control.h"
@@ -113,6 +114,29 @@
     GB_phybix_free (C) ;        \
 }
 
+//------------------------------------------------------------------------------
+// GB_saxpy3_first_touch: fault in the pages of a workspace, in parallel
+//------------------------------------------------------------------------------
+
+// Write one byte per page from a statically scheduled parallel loop, so the
+// pages of a freshly malloc'd workspace are placed on the memory nodes of the
+// team of threads, rather than all on the node of the calling thread.  Only
+// used when the NUMA placement mode is enabled in the Context.
+
+static void GB_saxpy3_first_touch (void *p, size_t nbytes, int nthreads)
+{
+    #define GB_PAGE_SIZE 4096
+    if (p == NULL || nbytes < GB_PAGE_SIZE) return ;
+    GB_void *restrict x = (GB_void *) p ;
+    int64_t npages = (int64_t) (nbytes / GB_PAGE_SIZE) ;
+    int64_t pg ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (pg = 0 ; pg < npages ; pg++)
+    {
+        x [pg * GB_PAGE_SIZE] = 0 ;
+    }
+}
+
 //------------------------------------------------------------------------------
 // GB_AxB_saxpy3: compute C=A*B, C<M>=A*B, or C<!M>=A*B in parallel
 //------------------------------------------------------------------------------
@@ -142,6 +166,8 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
+    GB_prof_info prof ;
+    GB_prof_start (&prof) ;
 
     GrB_Matrix M = M_input ;        // use the mask M, until deciding otherwise
     bool Mask_comp = Mask_comp_input ;
@@ -176,7 +202,8 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     //--------------------------------------------------------------------------
 
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
+    // the chunk may have been adapted online for this kernel family
+    double chunk = GB_autotune_chunk ("saxpy3") ;
 
     //--------------------------------------------------------------------------
     // define workspace
@@ -274,8 +301,28 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
 
     int nthreads, ntasks, nfine ;
     bool M_in_place = false ;
+    bool frontier = false ;
 
-    if (nthreads_max == 1 && M == NULL && (AxB_method != GxB_AxB_HASH) &&
+    if (M == NULL && bnvec <= 1 && bnz > 0
+        && (GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)))
+    {
+        // B is a single sparse vector, as in a frontier-style GrB_vxm.  If it
+        // selects at most one chunk of work, skip the flopcount and balanced
+        // task analysis and build the single task directly, in O(nnz(B)).
+        info = GB_AxB_saxpy3_slice_frontier (C, A, B, AxB_method, chunk,
+            &SaxpyTasks, &SaxpyTasks_size, &ntasks, &nfine, &nthreads,
+            &frontier, Werk) ;
+        if (frontier)
+        {
+            GBURBLE ("(frontier) ") ;
+        }
+    }
+
+    if (frontier || info != GrB_SUCCESS)
+    {
+        // the single frontier task has been created, or out of memory
+    }
+    else if (nthreads_max == 1 && M == NULL && (AxB_method != GxB_AxB_HASH) &&
         GB_IMIN (GB_nnz (A), GB_nnz (B)) > cvlen/16)
     { 
         // Skip the flopcount analysis if only a single thread is being used,
@@ -289,14 +336,42 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
             Werk) ;
     }
     else
-    { 
-        // Do the flopcount analysis and create a set of well-balanced tasks in
-        // the general case.  This may select a single task for a single thread
-        // anyway, but this decision would be based on the analysis.
-        info = GB_AxB_saxpy3_slice_balanced (C, M, Mask_comp, A, B, AxB_method,
-            builtin_semiring,
-            &SaxpyTasks, &SaxpyTasks_size, &apply_mask, &M_in_place,
-            &ntasks, &nfine, &nthreads, Werk) ;
+    {
+        // If the plan cache is enabled and holds a schedule for operands with
+        // these same patterns, reuse it and skip the symbolic analysis.
+        uint64_t plan_key = 0 ;
+        bool plan_found = false ;
+        if (GB_Global_mxm_plan_cache_get ( ))
+        {
+            plan_key = GB_AxB_saxpy3_plan_key (M_input, Mask_comp_input, A, B,
+                AxB_method, builtin_semiring, nthreads_max, chunk) ;
+            plan_found = GB_AxB_saxpy3_plan_lookup (plan_key, &SaxpyTasks,
+                &SaxpyTasks_size, &apply_mask, &M_in_place, &ntasks, &nfine,
+                &nthreads) ;
+        }
+        if (plan_found)
+        {
+            GBURBLE ("(saxpy3 plan cache hit) ") ;
+            info = GrB_SUCCESS ;
+        }
+        else
+        {
+            // Do the flopcount analysis and create a set of well-balanced
+            // tasks in the general case.  This may select a single task for a
+            // single thread anyway, but this decision would be based on the
+            // analysis.
+            info = GB_AxB_saxpy3_slice_balanced (C, M, Mask_comp, A, B,
+                AxB_method, builtin_semiring,
+                &SaxpyTasks, &SaxpyTasks_size, &apply_mask, &M_in_place,
+                &ntasks, &nfine, &nthreads, Werk) ;
+            if (info == GrB_SUCCESS && plan_key != 0)
+            {
+                // save the schedule for subsequent calls, before any hash
+                // tables are assigned to the tasks
+                GB_AxB_saxpy3_plan_save (plan_key, SaxpyTasks, apply_mask,
+                    M_in_place, ntasks, nfine, nthreads) ;
+            }
+        }
     }
 
     if (info == GrB_NO_VALUE)
@@ -498,14 +573,29 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     }
 
     if ((Hi_size_total > 0 && Hi_all == NULL) ||
-        (Hf_size_total > 0 && Hf_all == NULL) || 
+        (Hf_size_total > 0 && Hf_all == NULL) ||
         (Hx_size_total > 0 && Hx_all == NULL))
-    { 
+    {
         // out of memory
         GB_FREE_ALL ;
         return (GrB_OUT_OF_MEMORY) ;
     }
 
+    if (GB_Context_numa ( ) && nthreads > 1)
+    {
+        // NUMA placement mode: fault in the pages of the malloc'd hash
+        // workspace from all threads of the team, so they are spread across
+        // the memory nodes instead of all landing on the node of the thread
+        // that first writes them.  The thread-to-page mapping is approximate
+        // since the numeric phases use a dynamic schedule, but spreading the
+        // workspace avoids saturating a single node's memory bandwidth on
+        // multi-socket systems.  Hf_all is calloc'd and needs no help here.
+        GBURBLE ("(numa first-touch) ") ;
+        GB_saxpy3_first_touch (Hi_all, Hi_size_total * sizeof (int64_t),
+            nthreads) ;
+        GB_saxpy3_first_touch (Hx_all, Hx_size_total * csize, nthreads) ;
+    }
+
     //--------------------------------------------------------------------------
     // split the space into separate hash tables
     //--------------------------------------------------------------------------
@@ -589,9 +679,28 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     // a total of 5.9 second for phase 7 (the numerical work below).
     // Figure out a faster method.
 
+    if (GB_Context_cancelled ( ))
+    { 
+        // cancellation requested via the engaged Context
+        GB_FREE_ALL ;
+        return (GxB_CANCELLED) ;
+    }
+
     GB_AxB_saxpy3_symbolic (C, M, Mask_comp, Mask_struct, M_in_place,
         A, B, SaxpyTasks, ntasks, nfine, nthreads) ;
 
+    // the task construction and symbolic analysis above form the symbolic
+    // phase of the profile record; the numeric phases 2 to 5 follow
+    GB_prof_phase (&prof) ;
+
+    if (GB_Context_cancelled ( ))
+    { 
+        // cancellation requested via the engaged Context
+        GB_FREE_ALL ;
+        return (GxB_CANCELLED) ;
+    }
+
+
     //==========================================================================
     // C = A*B, via saxpy3 method, phases 2 to 5
     //==========================================================================
@@ -697,6 +806,7 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     ASSERT (!GB_ZOMBIES (C)) ;
     ASSERT (!GB_PENDING (C)) ;
     (*mask_applied) = apply_mask ;
+    GB_prof_end (&prof, "saxpy3", C, (int64_t) ntasks, nthreads) ;
     return (info) ;
 }
 
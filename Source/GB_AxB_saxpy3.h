@@ -61,6 +61,76 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
 
 #include "GB_saxpy3task_struct.h"
 
+//------------------------------------------------------------------------------
+// GB_hash_table_size
+//------------------------------------------------------------------------------
+
+// flmax is the max flop count for computing A*B(:,j), for any vector j that
+// this task computes.  If the mask M is present, flmax also includes the
+// number of entries in M(:,j).  GB_hash_table_size determines the hash table
+// size for this task, which is twice the smallest power of 2 larger than
+// flmax.  If flmax is large enough, the hash_size is returned as cvlen, so
+// that Gustavson's method will be used instead of the Hash method.
+
+// By default, Gustavson vs Hash is selected automatically.  AxB_method can be
+// selected via the descriptor or a global setting, as the non-default
+// GxB_AxB_GUSTAVSON or GxB_AxB_HASH settings, to enforce the selection of
+// either of those methods.  However, if Hash is selected but the hash table
+// equals or exceeds cvlen, then Gustavson's method is used instead.
+
+static inline int64_t GB_hash_table_size
+(
+    int64_t flmax,      // max flop count for any vector computed by this task
+    int64_t cvlen,      // vector length of C
+    const GrB_Desc_Value AxB_method     // Default, Gustavson, or Hash
+)
+{
+    int64_t hash_size ;
+
+    if (AxB_method == GxB_AxB_GUSTAVSON || flmax >= cvlen/2)
+    { 
+
+        //----------------------------------------------------------------------
+        // use Gustavson if selected explicitly or if flmax is large
+        //----------------------------------------------------------------------
+
+        hash_size = cvlen ;
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // flmax is small; consider hash vs Gustavson
+        //----------------------------------------------------------------------
+
+        // hash_size = 2 * (smallest power of 2 >= flmax)
+        hash_size = ((uint64_t) 2) << (GB_FLOOR_LOG2 (flmax) + 1) ;
+        bool use_Gustavson ;
+        if (AxB_method == GxB_AxB_HASH)
+        { 
+            // always use Hash method, unless the hash_size >= cvlen
+            use_Gustavson = (hash_size >= cvlen) ;
+        }
+        else
+        { 
+            // default: auto selection:
+            // use Gustavson's method if hash_size is too big
+            use_Gustavson = (hash_size >= cvlen/12) ;
+        }
+        if (use_Gustavson)
+        { 
+            hash_size = cvlen ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    return (hash_size) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_AxB_saxpy3_flopcount:  compute flops for GB_AxB_saxpy3
 //------------------------------------------------------------------------------
@@ -76,6 +146,27 @@ GrB_Info GB_AxB_saxpy3_flopcount
     GB_Werk Werk
 ) ;
 
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_flopcount_sampled: sampled estimate of the total flop count
+//------------------------------------------------------------------------------
+
+void GB_AxB_saxpy3_flopcount_sampled
+(
+    // output:
+    double *axbflops,           // estimated flops to compute A*B, without the
+                                // work to access the mask
+    double *axbflops_err,       // 3-sigma half-width of the axbflops estimate
+    double *Mwork,              // estimated work to access the mask M
+    double *Mwork_err,          // 3-sigma half-width of the Mwork estimate
+    // input:
+    const GrB_Matrix M,         // optional mask matrix
+    const bool Mask_comp,       // if true, mask is complemented
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    int64_t nsamples,           // # of vectors of B to sample
+    GB_Werk Werk
+) ;
+
 //------------------------------------------------------------------------------
 // GB_AxB_saxpy3_cumsum: cumulative sum of C->p for GB_AxB_saxpy3
 //------------------------------------------------------------------------------
@@ -126,6 +217,28 @@ GrB_Info GB_AxB_saxpy3_slice_quick
     GB_Werk Werk
 ) ;
 
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_slice_frontier: create a single task for a frontier-style B
+//------------------------------------------------------------------------------
+
+GrB_Info GB_AxB_saxpy3_slice_frontier
+(
+    // inputs
+    GrB_Matrix C,                   // output matrix
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B, a single sparse vector
+    GrB_Desc_Value AxB_method,      // Default, Gustavson, or Hash
+    double chunk,                   // the single-task work budget
+    // outputs
+    GB_saxpy3task_struct **SaxpyTasks_handle,
+    size_t *SaxpyTasks_size_handle,
+    int *ntasks,                    // # of tasks created (coarse and fine)
+    int *nfine,                     // # of fine tasks created
+    int *nthreads,                  // # of threads to use
+    bool *slice_done,               // false if B is too heavy for one task
+    GB_Werk Werk
+) ;
+
 //------------------------------------------------------------------------------
 // GB_AxB_saxpy3_symbolic: symbolic analysis for GB_AxB_saxpy3
 //------------------------------------------------------------------------------
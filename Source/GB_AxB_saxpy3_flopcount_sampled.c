@@ -0,0 +1,283 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_flopcount_sampled: sampled flop count estimate for saxpy3
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Estimates the total flop count and the mask work of C<#M>=A*B from a random
+// sample of B's vectors, instead of walking every entry of B as
+// GB_AxB_saxpy3_flopcount does.  For operands with billions of entries the
+// exact count is itself a large fraction of the multiply time, yet some of
+// its consumers only need the total: in particular the decision to discard a
+// mask that is too costly to use, which throws the exact per-vector counts
+// away when it triggers.  The per-vector cost model is the same as the exact
+// count (including the mask binary-search refinement), applied to nsamples
+// vectors chosen with a counter-based hash, so the estimate is deterministic
+// for given inputs.  The outputs are the scaled totals and a 3-sigma
+// half-width for each, from the sample variance; a caller acts on the
+// estimate only when the decision is clear beyond the half-widths, and falls
+// back to the exact count when it is marginal.
+
+// The sample is drawn with replacement, so the error bars are the standard
+// iid ones, shrunk by the finite-population correction.
+
+#include "GB_mxm.h"
+#include "GB_AxB_saxpy3.h"
+#include "GB_unused.h"
+
+// counter-based RNG (the splitmix64 finalizer); see also GB_random.c
+static inline uint64_t GB_flops_hash (uint64_t seed, uint64_t k)
+{
+    uint64_t x = seed + (k + 1) * 0x9E3779B97F4A7C15ULL ;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL ;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL ;
+    return (x ^ (x >> 31)) ;
+}
+
+void GB_AxB_saxpy3_flopcount_sampled
+(
+    // output:
+    double *axbflops,           // estimated flops to compute A*B, without the
+                                // work to access the mask
+    double *axbflops_err,       // 3-sigma half-width of the axbflops estimate
+    double *Mwork,              // estimated work to access the mask M
+    double *Mwork_err,          // 3-sigma half-width of the Mwork estimate
+    // input:
+    const GrB_Matrix M,         // optional mask matrix
+    const bool Mask_comp,       // if true, mask is complemented
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    int64_t nsamples,           // # of vectors of B to sample
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK_OR_NULL (M, "M for sampled flop count A*B", GB0) ;
+    ASSERT_MATRIX_OK (A, "A for sampled flop count A*B", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for sampled flop count A*B", GB0) ;
+    ASSERT (A->vdim == B->vlen) ;
+    ASSERT (axbflops != NULL && axbflops_err != NULL) ;
+    ASSERT (Mwork != NULL && Mwork_err != NULL) ;
+
+    (*axbflops) = 0 ;
+    (*axbflops_err) = 0 ;
+    (*Mwork) = 0 ;
+    (*Mwork_err) = 0 ;
+
+    //--------------------------------------------------------------------------
+    // get the mask, if present: any sparsity structure
+    //--------------------------------------------------------------------------
+
+    bool mask_is_M = (M != NULL && !Mask_comp) ;
+    const int64_t *restrict Mp = NULL ;
+    const int64_t *restrict M_Yp = NULL ;
+    const int64_t *restrict M_Yi = NULL ;
+    const int64_t *restrict M_Yx = NULL ;
+    int64_t mvlen = 0 ;
+    int64_t M_hash_bits = 0 ;
+    bool M_is_hyper = GB_IS_HYPERSPARSE (M) ;
+    bool M_is_dense = false ;
+    if (M != NULL)
+    {
+        Mp = M->p ;
+        mvlen = M->vlen ;
+        M_is_dense = GB_IS_BITMAP (M) || GB_as_if_full (M) ;
+        if (M_is_hyper)
+        {
+            ASSERT_MATRIX_OK (M->Y, "M->Y hyper_hash", GB0) ;
+            M_Yp = M->Y->p ;
+            M_Yi = M->Y->i ;
+            M_Yx = M->Y->x ;
+            M_hash_bits = M->Y->vdim - 1 ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // get A and B: any sparsity structure
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int64_t avlen = A->vlen ;
+    const bool A_is_hyper = GB_IS_HYPERSPARSE (A) ;
+
+    const int64_t *restrict A_Yp = NULL ;
+    const int64_t *restrict A_Yi = NULL ;
+    const int64_t *restrict A_Yx = NULL ;
+    int64_t A_hash_bits = 0 ;
+    if (A_is_hyper)
+    {
+        ASSERT_MATRIX_OK (A->Y, "A->Y hyper_hash", GB0) ;
+        A_Yp = A->Y->p ;
+        A_Yi = A->Y->i ;
+        A_Yx = A->Y->x ;
+        A_hash_bits = A->Y->vdim - 1 ;
+    }
+
+    const int64_t *restrict Bp = B->p ;
+    const int64_t *restrict Bh = B->h ;
+    const int8_t  *restrict Bb = B->b ;
+    const int64_t *restrict Bi = B->i ;
+    const int64_t bnvec = B->nvec ;
+    const int64_t bvlen = B->vlen ;
+
+    if (bnvec == 0 || nsamples <= 0)
+    {
+        // nothing to sample
+        return ;
+    }
+    nsamples = GB_IMIN (nsamples, bnvec) ;
+
+    //--------------------------------------------------------------------------
+    // sample nsamples vectors of B and apply the exact per-vector cost model
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (nsamples, chunk, nthreads_max) ;
+
+    // the sample is a pure function of the shape of B, so repeated calls on
+    // the same operands make the same decision
+    uint64_t seed = GB_flops_hash ((uint64_t) bnvec, (uint64_t) B->vdim) ;
+
+    double f_sum = 0, f_sumsq = 0 ;     // per-vector A*B flops
+    double m_sum = 0, m_sumsq = 0 ;     // per-vector mask work
+
+    int64_t t ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,64) \
+        reduction(+:f_sum,f_sumsq,m_sum,m_sumsq)
+    for (t = 0 ; t < nsamples ; t++)
+    {
+
+        //----------------------------------------------------------------------
+        // pick a vector B(:,j) at random
+        //----------------------------------------------------------------------
+
+        int64_t kk = (int64_t) (GB_flops_hash (seed, (uint64_t) t)
+            % ((uint64_t) bnvec)) ;
+        int64_t bjnz = (Bp == NULL) ? bvlen : (Bp [kk+1] - Bp [kk]) ;
+        if (bjnz == 0)
+        {
+            // C(:,j) is empty if the entire vector B(:,j) is empty
+            continue ;
+        }
+        int64_t j = GBH (Bh, kk) ;
+        int64_t pB = GBP (Bp, kk, bvlen) ;
+        int64_t pB_end = GBP (Bp, kk+1, bvlen) ;
+
+        //----------------------------------------------------------------------
+        // see if M(:,j) is present and non-empty
+        //----------------------------------------------------------------------
+
+        double bjflops = (double) bjnz ;    // scan of B(:,j) itself
+        int64_t mjnz = 0 ;
+        if (M != NULL && !M_is_dense)
+        {
+            int64_t pM, pM_end ;
+            if (M_is_hyper)
+            {
+                GB_hyper_hash_lookup (Mp, M_Yp, M_Yi, M_Yx, M_hash_bits,
+                    j, &pM, &pM_end) ;
+            }
+            else
+            {
+                pM     = Mp [j] ;
+                pM_end = Mp [j+1] ;
+            }
+            mjnz = pM_end - pM ;
+            if (mjnz == 0 && !Mask_comp)
+            {
+                // C(:,j) is empty if M(:,j) is empty
+                continue ;
+            }
+            if (mjnz > 0)
+            {
+                bjflops = (double) mjnz ;
+            }
+        }
+        int64_t mjnz_much = 64 * mjnz ;
+
+        //----------------------------------------------------------------------
+        // count the flops to compute C(:,j)<#M(:,j)> = A*B(:,j)
+        //----------------------------------------------------------------------
+
+        for ( ; pB < pB_end ; pB++)
+        {
+            // get B(k,j)
+            int64_t k = GBI (Bi, pB, bvlen) ;
+            if (!GBB (Bb, pB)) continue ;
+
+            // find A(:,k)
+            int64_t pA, pA_end ;
+            if (A_is_hyper)
+            {
+                GB_hyper_hash_lookup (Ap, A_Yp, A_Yi, A_Yx, A_hash_bits,
+                    k, &pA, &pA_end) ;
+            }
+            else
+            {
+                pA     = GBP (Ap, k  , avlen) ;
+                pA_end = GBP (Ap, k+1, avlen) ;
+            }
+            const int64_t aknz = pA_end - pA ;
+            if (aknz == 0) continue ;
+
+            double bkjflops ;
+            if (mask_is_M)
+            {
+                if (aknz > 256 && mjnz_much < aknz && mjnz < mvlen &&
+                    aknz < avlen && !(A->jumbled))
+                {
+                    // scan M(:j), and do binary search for A(i,j)
+                    bkjflops = mjnz * (1 + 4 * log2 ((double) aknz)) ;
+                }
+                else
+                {
+                    // scan A(:k), and lookup M(i,j)
+                    bkjflops = aknz ;
+                }
+            }
+            else
+            {
+                // A(:,k)*B(k,j) requires aknz flops
+                bkjflops = aknz ;
+            }
+            bjflops += bkjflops ;
+        }
+
+        //----------------------------------------------------------------------
+        // accumulate the sample moments
+        //----------------------------------------------------------------------
+
+        double fj = bjflops - (double) mjnz ;   // A*B work, without the mask
+        double mj = (double) mjnz ;
+        f_sum += fj ; f_sumsq += fj * fj ;
+        m_sum += mj ; m_sumsq += mj * mj ;
+    }
+
+    //--------------------------------------------------------------------------
+    // scale to the full matrix and compute the 3-sigma half-widths
+    //--------------------------------------------------------------------------
+
+    double n = (double) nsamples ;
+    double N = (double) bnvec ;
+    // finite-population correction: the error vanishes as n approaches N
+    double fpc = sqrt (fmax (1 - n / N, 0)) ;
+
+    double f_mean = f_sum / n ;
+    double f_var = fmax (f_sumsq / n - f_mean * f_mean, 0) ;
+    (*axbflops) = f_mean * N ;
+    (*axbflops_err) = 3 * N * sqrt (f_var / n) * fpc ;
+
+    double m_mean = m_sum / n ;
+    double m_var = fmax (m_sumsq / n - m_mean * m_mean, 0) ;
+    (*Mwork) = m_mean * N ;
+    (*Mwork_err) = 3 * N * sqrt (m_var / n) * fpc ;
+}
@@ -0,0 +1,240 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan.c: cache of saxpy3 symbolic analyses
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Workloads that multiply a matrix with a fixed pattern against many
+// different operands (iterative solvers, repeated SpMV over the same graph)
+// pay for GB_AxB_saxpy3_flopcount and GB_AxB_saxpy3_slice_balanced on every
+// call, even though the result of that symbolic analysis depends only on the
+// patterns of M, A, and B, the AxB method, and the # of threads.  This cache
+// holds the most recently constructed task schedule, keyed on a hash of all
+// of those inputs.  A subsequent call with an identical key skips the
+// symbolic analysis and reuses the schedule.
+
+// The schedule is saved before the hash tables (Hi, Hf, Hx) are assigned to
+// the tasks, so the cached copy holds no pointers into any workspace; those
+// pointers are reassigned by GB_AxB_saxpy3 on every call.
+
+// A single plan is cached, protected by a critical section.  This is
+// sufficient for the motivating workload (one matrix reused across many
+// calls), and keeps the memory held by the cache bounded by one task list.
+// The cache is freed by GrB_finalize.
+
+#include "GB_AxB_saxpy3_plan.h"
+
+// xxHash uses switch statements with no default case.
+#if GB_COMPILER_GCC
+#pragma GCC diagnostic ignored "-Wswitch-default"
+#endif
+
+#define XXH_INLINE_ALL
+#define XXH_NO_STREAM
+#include "xxhash.h"
+
+//------------------------------------------------------------------------------
+// the cached plan
+//------------------------------------------------------------------------------
+
+static struct
+{
+    uint64_t key ;                      // plan key; 0 if cache is empty
+    GB_saxpy3task_struct *SaxpyTasks ;  // cached task schedule
+    size_t SaxpyTasks_size ;            // allocated size of SaxpyTasks
+    bool apply_mask ;                   // if true, M is applied in saxpy3
+    bool M_in_place ;                   // if true, M is used in-place
+    int ntasks ;                        // # of tasks in the schedule
+    int nfine ;                         // # of fine tasks
+    int nthreads ;                      // # of threads to use
+}
+GB_saxpy3_plan_cache =
+{
+    .key = 0,
+    .SaxpyTasks = NULL,
+    .SaxpyTasks_size = 0
+} ;
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_key: hash all inputs that determine the plan
+//------------------------------------------------------------------------------
+
+// The task schedule depends on the pattern of B (which vectors exist and how
+// many entries each one has), the per-vector entry counts of A (reached
+// through Bi), the mask M, the requested AxB method, whether the semiring is
+// built-in (which affects the choice to discard M), and the # of threads.
+// All of those inputs are hashed; matching keys give identical schedules
+// except for hash collisions of XXH3_64bits itself, which are negligible
+// (the JIT relies on the same property; see GB_jitifyer.c).
+
+uint64_t GB_AxB_saxpy3_plan_key // hash of all inputs that determine the plan
+(
+    const GrB_Matrix M,         // optional mask matrix (may be NULL)
+    const bool Mask_comp,       // if true, use !M
+    const GrB_Matrix A,         // input matrix A
+    const GrB_Matrix B,         // input matrix B
+    const GrB_Desc_Value AxB_method,    // Default, Gustavson, or Hash
+    const bool builtin_semiring,        // if true, semiring is built-in
+    const int nthreads_max,     // maximum # of threads to use
+    const double chunk          // chunk size for parallel tasks
+)
+{
+    double chunk_copy = chunk ;
+    uint64_t hash = XXH3_64bits (&(int64_t [9])
+    {
+        (int64_t) AxB_method, (int64_t) builtin_semiring,
+        (int64_t) nthreads_max, (int64_t) Mask_comp,
+        GB_PUN (int64_t, chunk_copy),
+        A->vlen, A->vdim, B->vlen, B->vdim
+    }, 9 * sizeof (int64_t)) ;
+
+    // hash the pattern of A: per-vector entry counts and vector names
+    hash += XXH3_64bits (A->p, (A->nvec + 1) * sizeof (int64_t)) ;
+    if (A->h != NULL)
+    {
+        hash += XXH3_64bits (A->h, A->nvec * sizeof (int64_t)) ;
+    }
+
+    // hash the pattern of B
+    if (B->p != NULL)
+    {
+        hash += XXH3_64bits (B->p, (B->nvec + 1) * sizeof (int64_t)) ;
+    }
+    if (B->h != NULL)
+    {
+        hash += XXH3_64bits (B->h, B->nvec * sizeof (int64_t)) ;
+    }
+    if (B->i != NULL)
+    {
+        hash += XXH3_64bits (B->i, GB_nnz_held (B) * sizeof (int64_t)) ;
+    }
+    if (B->b != NULL)
+    {
+        hash += XXH3_64bits (B->b, GB_nnz_held (B) * sizeof (int8_t)) ;
+    }
+
+    // hash the pattern of M, if present
+    if (M != NULL)
+    {
+        if (M->p != NULL)
+        {
+            hash += XXH3_64bits (M->p, (M->nvec + 1) * sizeof (int64_t)) ;
+        }
+        if (M->h != NULL)
+        {
+            hash += XXH3_64bits (M->h, M->nvec * sizeof (int64_t)) ;
+        }
+        if (M->i != NULL)
+        {
+            hash += XXH3_64bits (M->i, GB_nnz_held (M) * sizeof (int64_t)) ;
+        }
+    }
+
+    // a key of zero denotes an empty cache; remap it (see GB_jitifyer.c)
+    return ((hash == 0) ? 1 : hash) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_lookup: get a copy of the cached plan, if the key matches
+//------------------------------------------------------------------------------
+
+bool GB_AxB_saxpy3_plan_lookup  // true if a cached plan was found
+(
+    // input
+    const uint64_t key,         // plan key from GB_AxB_saxpy3_plan_key
+    // output
+    GB_saxpy3task_struct **SaxpyTasks_handle,   // newly allocated copy of the
+    size_t *SaxpyTasks_size_handle,             // cached task schedule
+    bool *apply_mask,           // if true, the mask M is applied in saxpy3
+    bool *M_in_place,           // if true, M is used in-place
+    int *ntasks,                // # of tasks created
+    int *nfine,                 // # of fine tasks created
+    int *nthreads               // # of threads to use
+)
+{
+    bool found = false ;
+    #pragma omp critical (GB_AxB_saxpy3_plan)
+    {
+        if (GB_saxpy3_plan_cache.key == key)
+        {
+            // copy the cached schedule into a fresh workspace, since the
+            // caller will assign hash tables to it and then free it
+            int cached_ntasks = GB_saxpy3_plan_cache.ntasks ;
+            GB_saxpy3task_struct *SaxpyTasks = GB_MALLOC_WORK (cached_ntasks,
+                GB_saxpy3task_struct, SaxpyTasks_size_handle) ;
+            if (SaxpyTasks != NULL)
+            {
+                memcpy (SaxpyTasks, GB_saxpy3_plan_cache.SaxpyTasks,
+                    cached_ntasks * sizeof (GB_saxpy3task_struct)) ;
+                (*SaxpyTasks_handle) = SaxpyTasks ;
+                (*apply_mask) = GB_saxpy3_plan_cache.apply_mask ;
+                (*M_in_place) = GB_saxpy3_plan_cache.M_in_place ;
+                (*ntasks)     = GB_saxpy3_plan_cache.ntasks ;
+                (*nfine)      = GB_saxpy3_plan_cache.nfine ;
+                (*nthreads)   = GB_saxpy3_plan_cache.nthreads ;
+                found = true ;
+            }
+            // if the malloc fails, fall through and redo the analysis
+        }
+    }
+    return (found) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_save: save a plan in the cache
+//------------------------------------------------------------------------------
+
+void GB_AxB_saxpy3_plan_save    // save a plan in the cache
+(
+    // input
+    const uint64_t key,         // plan key from GB_AxB_saxpy3_plan_key
+    const GB_saxpy3task_struct *SaxpyTasks,     // task schedule to save
+    const bool apply_mask,      // if true, the mask M is applied in saxpy3
+    const bool M_in_place,      // if true, M is used in-place
+    const int ntasks,           // # of tasks created
+    const int nfine,            // # of fine tasks created
+    const int nthreads          // # of threads to use
+)
+{
+    #pragma omp critical (GB_AxB_saxpy3_plan)
+    {
+        // drop the prior plan, if any
+        GB_FREE_WORK (&(GB_saxpy3_plan_cache.SaxpyTasks),
+            GB_saxpy3_plan_cache.SaxpyTasks_size) ;
+        GB_saxpy3_plan_cache.key = 0 ;
+        size_t size = 0 ;
+        GB_saxpy3task_struct *Copy = GB_MALLOC_WORK (ntasks,
+            GB_saxpy3task_struct, &size) ;
+        if (Copy != NULL)
+        {
+            memcpy (Copy, SaxpyTasks,
+                ntasks * sizeof (GB_saxpy3task_struct)) ;
+            GB_saxpy3_plan_cache.key = key ;
+            GB_saxpy3_plan_cache.SaxpyTasks = Copy ;
+            GB_saxpy3_plan_cache.SaxpyTasks_size = size ;
+            GB_saxpy3_plan_cache.apply_mask = apply_mask ;
+            GB_saxpy3_plan_cache.M_in_place = M_in_place ;
+            GB_saxpy3_plan_cache.ntasks = ntasks ;
+            GB_saxpy3_plan_cache.nfine = nfine ;
+            GB_saxpy3_plan_cache.nthreads = nthreads ;
+        }
+        // if the malloc fails, the cache is simply left empty
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_finalize: free the plan cache
+//------------------------------------------------------------------------------
+
+void GB_AxB_saxpy3_plan_finalize (void)
+{
+    #pragma omp critical (GB_AxB_saxpy3_plan)
+    {
+        GB_FREE_WORK (&(GB_saxpy3_plan_cache.SaxpyTasks),
+            GB_saxpy3_plan_cache.SaxpyTasks_size) ;
+        GB_saxpy3_plan_cache.key = 0 ;
+    }
+}
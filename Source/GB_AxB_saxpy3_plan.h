@@ -0,0 +1,63 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan.h: definitions for the saxpy3 symbolic plan cache
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The saxpy3 plan cache saves the task schedule constructed by
+// GB_AxB_saxpy3_slice_balanced, keyed on a hash of the patterns of M, A, and
+// B.  If a later GrB_mxm is performed with operands whose patterns are
+// unchanged, the flop-count analysis and task construction are skipped
+// entirely, and the cached schedule is reused.  The cache is opt-in, via
+// GxB_Global_Option_set (GxB_MXM_PLAN_CACHE, true).
+
+#ifndef GB_AXB_SAXPY3_PLAN_H
+#define GB_AXB_SAXPY3_PLAN_H
+
+#include "GB.h"
+#include "GB_AxB_saxpy3.h"
+
+uint64_t GB_AxB_saxpy3_plan_key // hash of all inputs that determine the plan
+(
+    const GrB_Matrix M,         // optional mask matrix (may be NULL)
+    const bool Mask_comp,       // if true, use !M
+    const GrB_Matrix A,         // input matrix A
+    const GrB_Matrix B,         // input matrix B
+    const GrB_Desc_Value AxB_method,    // Default, Gustavson, or Hash
+    const bool builtin_semiring,        // if true, semiring is built-in
+    const int nthreads_max,     // maximum # of threads to use
+    const double chunk          // chunk size for parallel tasks
+) ;
+
+bool GB_AxB_saxpy3_plan_lookup  // true if a cached plan was found
+(
+    // input
+    const uint64_t key,         // plan key from GB_AxB_saxpy3_plan_key
+    // output
+    GB_saxpy3task_struct **SaxpyTasks_handle,   // newly allocated copy of the
+    size_t *SaxpyTasks_size_handle,             // cached task schedule
+    bool *apply_mask,           // if true, the mask M is applied in saxpy3
+    bool *M_in_place,           // if true, M is used in-place
+    int *ntasks,                // # of tasks created
+    int *nfine,                 // # of fine tasks created
+    int *nthreads               // # of threads to use
+) ;
+
+void GB_AxB_saxpy3_plan_save    // save a plan in the cache
+(
+    // input
+    const uint64_t key,         // plan key from GB_AxB_saxpy3_plan_key
+    const GB_saxpy3task_struct *SaxpyTasks,     // task schedule to save
+    const bool apply_mask,      // if true, the mask M is applied in saxpy3
+    const bool M_in_place,      // if true, M is used in-place
+    const int ntasks,           // # of tasks created
+    const int nfine,            // # of fine tasks created
+    const int nthreads          // # of threads to use
+) ;
+
+void GB_AxB_saxpy3_plan_finalize (void) ;   // free the plan cache
+
+#endif
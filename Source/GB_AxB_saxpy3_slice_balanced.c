@@ -17,10 +17,12 @@
 
 // control parameters for generating parallel tasks
 #define GB_NTASKS_PER_THREAD 2
+#define GB_NTASKS_PER_THREAD_MAX 16     // when over-decomposing for balance
 #define GB_COSTLY 1.2
 #define GB_FINE_WORK 2
 #define GB_MWORK_ALPHA 0.01
 #define GB_MWORK_BETA 0.10
+#define GB_FLOPS_NSAMPLES 1024          // sample size for the flops estimate
 
 #define GB_FREE_WORKSPACE                   \
 {                                           \
@@ -36,76 +38,6 @@
     GB_FREE_WORK (&SaxpyTasks, SaxpyTasks_size) ;   \
 }
 
-//------------------------------------------------------------------------------
-// GB_hash_table_size
-//------------------------------------------------------------------------------
-
-// flmax is the max flop count for computing A*B(:,j), for any vector j that
-// this task computes.  If the mask M is present, flmax also includes the
-// number of entries in M(:,j).  GB_hash_table_size determines the hash table
-// size for this task, which is twice the smallest power of 2 larger than
-// flmax.  If flmax is large enough, the hash_size is returned as cvlen, so
-// that Gustavson's method will be used instead of the Hash method.
-
-// By default, Gustavson vs Hash is selected automatically.  AxB_method can be
-// selected via the descriptor or a global setting, as the non-default
-// GxB_AxB_GUSTAVSON or GxB_AxB_HASH settings, to enforce the selection of
-// either of those methods.  However, if Hash is selected but the hash table
-// equals or exceeds cvlen, then Gustavson's method is used instead.
-
-static inline int64_t GB_hash_table_size
-(
-    int64_t flmax,      // max flop count for any vector computed by this task
-    int64_t cvlen,      // vector length of C
-    const GrB_Desc_Value AxB_method     // Default, Gustavson, or Hash
-)
-{
-    int64_t hash_size ;
-
-    if (AxB_method == GxB_AxB_GUSTAVSON || flmax >= cvlen/2)
-    { 
-
-        //----------------------------------------------------------------------
-        // use Gustavson if selected explicitly or if flmax is large
-        //----------------------------------------------------------------------
-
-        hash_size = cvlen ;
-
-    }
-    else
-    {
-
-        //----------------------------------------------------------------------
-        // flmax is small; consider hash vs Gustavson
-        //----------------------------------------------------------------------
-
-        // hash_size = 2 * (smallest power of 2 >= flmax)
-        hash_size = ((uint64_t) 2) << (GB_FLOOR_LOG2 (flmax) + 1) ;
-        bool use_Gustavson ;
-        if (AxB_method == GxB_AxB_HASH)
-        { 
-            // always use Hash method, unless the hash_size >= cvlen
-            use_Gustavson = (hash_size >= cvlen) ;
-        }
-        else
-        { 
-            // default: auto selection:
-            // use Gustavson's method if hash_size is too big
-            use_Gustavson = (hash_size >= cvlen/12) ;
-        }
-        if (use_Gustavson)
-        { 
-            hash_size = cvlen ;
-        }
-    }
-
-    //--------------------------------------------------------------------------
-    // return result
-    //--------------------------------------------------------------------------
-
-    return (hash_size) ;
-}
-
 //------------------------------------------------------------------------------
 // GB_create_coarse_task: create a single coarse task
 //------------------------------------------------------------------------------
@@ -298,6 +230,37 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
     int64_t cvlen = avlen ;
     int64_t cvdim = bvdim ;
 
+    //--------------------------------------------------------------------------
+    // sampled pre-pass: discard a costly mask without the exact flop count
+    //--------------------------------------------------------------------------
+
+    // When M is sparse and B has many vectors, the exact flop count below is
+    // itself a significant fraction of the multiply time, and it is thrown
+    // away whenever the mask turns out to be too costly to use (the
+    // GrB_NO_VALUE return below).  A sampled estimate makes that same
+    // GB_MWORK_ALPHA comparison first: if the mask is clearly too costly,
+    // beyond the 3-sigma half-widths on both sides of the test, it is
+    // discarded here and the exact pass is skipped entirely.  When the
+    // decision is marginal, the exact count decides, as before.
+
+    if (M != NULL && !GB_IS_BITMAP (M) && !GB_as_if_full (M)
+        && bnvec >= 16 * GB_FLOPS_NSAMPLES)
+    {
+        double axb_est, axb_err, Mwork_est, Mwork_err ;
+        GB_AxB_saxpy3_flopcount_sampled (&axb_est, &axb_err, &Mwork_est,
+            &Mwork_err, M, Mask_comp, A, B, GB_FLOPS_NSAMPLES, Werk) ;
+        if (axb_est + axb_err <
+            GB_MWORK_ALPHA * fmax (Mwork_est - Mwork_err, 0))
+        { 
+            // the mask is clearly too costly to use; apply it after C=A*B
+            (*apply_mask) = false ;
+            GBURBLE ("(discard mask: sampled axbwork %g mwork %g) ",
+                axb_est, Mwork_est) ;
+            GB_FREE_ALL ;
+            return (GrB_NO_VALUE) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // compute flop counts for each vector of B and C
     //--------------------------------------------------------------------------
@@ -419,6 +382,44 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
     int ntasks_initial = ((*nthreads) == 1) ? 1 :
         (GB_NTASKS_PER_THREAD * (*nthreads)) ;
 
+    //--------------------------------------------------------------------------
+    // over-decompose the tasks if a few vectors dominate the flop count
+    //--------------------------------------------------------------------------
+
+    // The numeric phases execute the task list with schedule(dynamic), but
+    // with only GB_NTASKS_PER_THREAD tasks per thread the dynamic scheduler
+    // has nothing to redistribute when one hub vertex of a power-law graph
+    // lands in a single task: that task runs long after all others have
+    // finished and the remaining threads idle.  If the heaviest single
+    // vector of B would dominate a task of the mean size, create more and
+    // smaller tasks instead (splitting the hub vector into a larger team of
+    // fine tasks), so the dynamic schedule over the task list behaves like a
+    // work-stealing scheduler with tasks to spare.
+
+    if (ntasks_initial > 1 && bnvec > 1)
+    {
+        int64_t max_vector_flops = 0 ;
+        int nth = GB_nthreads (bnvec, chunk, *nthreads) ;
+        int64_t kk ;
+        #pragma omp parallel for num_threads(nth) schedule(static) \
+            reduction(max:max_vector_flops)
+        for (kk = 0 ; kk < bnvec ; kk++)
+        {
+            max_vector_flops = GB_IMAX (max_vector_flops,
+                Bflops [kk+1] - Bflops [kk]) ;
+        }
+        while (ntasks_initial < GB_NTASKS_PER_THREAD_MAX * (*nthreads)
+            && (double) max_vector_flops >
+               GB_COSTLY * (total_flops / ((double) ntasks_initial)))
+        {
+            ntasks_initial *= 2 ;
+        }
+        if (ntasks_initial > GB_NTASKS_PER_THREAD * (*nthreads))
+        {
+            GBURBLE ("(over-decompose: %d tasks) ", ntasks_initial) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // give preference to Gustavson when using few threads
     //--------------------------------------------------------------------------
@@ -0,0 +1,164 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_slice_frontier: construct a single task for a frontier B
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Create a single task for C=A*B when B is a single sparse vector with few
+// entries: the frontier of a BFS-style iteration, via GrB_vxm.  The general
+// analysis (GB_AxB_saxpy3_flopcount and GB_AxB_saxpy3_slice_balanced) is
+// built to balance large multiplies across many threads, and its setup cost
+// dwarfs the multiply itself when the frontier has a few hundred entries.
+// This method replaces it with a single O(nnz(B)) pass: the flop count is the
+// sum of the sizes of the vectors of A selected by the entries of B, read in
+// O(1) each from A->p, from the cached A->degree if A is hypersparse and held
+// by row, or found via the A->Y hyper_hash.  The scan stops as soon as the
+// flop count exceeds the single-task budget (one chunk of work), in which
+// case no task is created (*slice_done is false) and the caller falls through
+// to the balanced analysis.
+
+// The one coarse task uses Gustavson's method or the Hash method by the same
+// rule as the balanced slicer (GB_hash_table_size): a small frontier touching
+// low-degree vectors gets a hash table sized to the bound on nnz(C), not to
+// C->vlen, so the accumulator it scatters into stays in cache.
+
+#include "GB_AxB_saxpy3.h"
+
+GrB_Info GB_AxB_saxpy3_slice_frontier
+(
+    // inputs
+    GrB_Matrix C,                   // output matrix
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B, a single sparse vector
+    GrB_Desc_Value AxB_method,      // Default, Gustavson, or Hash
+    double chunk,                   // the single-task work budget
+    // outputs
+    GB_saxpy3task_struct **SaxpyTasks_handle,
+    size_t *SaxpyTasks_size_handle,
+    int *ntasks,                    // # of tasks created (coarse and fine)
+    int *nfine,                     // # of fine tasks created
+    int *nthreads,                  // # of threads to use
+    bool *slice_done,               // false if B is too heavy for one task
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)) ;
+    ASSERT (B->nvec <= 1) ;
+
+    (*slice_done) = false ;
+
+    const int64_t *restrict Bi = B->i ;
+    const int64_t bnz = GB_nnz (B) ;
+    const int64_t cvlen = C->vlen ;
+    const int64_t work_max = (int64_t) chunk ;
+
+    //--------------------------------------------------------------------------
+    // count the flops: the sizes of the vectors of A selected by B
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int64_t avlen = A->vlen ;
+    const int64_t anvec = A->nvec ;
+
+    // the degree cache gives the vector sizes of a hypersparse-by-row A in
+    // O(1), with no hyperlist search (see GB_degree.c)
+    const int64_t *restrict Adeg = (A->is_csc) ? NULL : A->degree ;
+
+    int64_t fl = 0 ;
+    for (int64_t pB = 0 ; pB < bnz && fl <= work_max ; pB++)
+    {
+        const int64_t k = Bi [pB] ;     // B(k,0) selects A(:,k)
+        if (Ap == NULL)
+        {
+            // A is bitmap or full
+            fl += avlen ;
+        }
+        else if (Ah == NULL)
+        {
+            // A is sparse
+            fl += Ap [k+1] - Ap [k] ;
+        }
+        else if (Adeg != NULL)
+        {
+            // A is hypersparse, with cached degrees
+            fl += Adeg [k] ;
+        }
+        else
+        {
+            // A is hypersparse: find vector k in the hyperlist
+            int64_t pA_start = 0, pA_end = 0 ;
+            if (A->Y == NULL)
+            {
+                int64_t kA = 0 ;
+                GB_lookup (true, Ah, Ap, avlen, &kA, anvec-1, k,
+                    &pA_start, &pA_end) ;
+            }
+            else
+            {
+                GB_hyper_hash_lookup (Ap, A->Y->p, A->Y->i, A->Y->x,
+                    A->Y->vdim-1, k, &pA_start, &pA_end) ;
+            }
+            fl += pA_end - pA_start ;
+        }
+    }
+
+    if (fl + bnz > work_max)
+    {
+        // the frontier selects too much work for a single task; fall through
+        // to the balanced analysis
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the task
+    //--------------------------------------------------------------------------
+
+    size_t SaxpyTasks_size = 0 ;
+    GB_saxpy3task_struct *SaxpyTasks = GB_MALLOC_WORK (1, GB_saxpy3task_struct,
+        &SaxpyTasks_size) ;
+    if (SaxpyTasks == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    // clear SaxpyTasks
+    memset (SaxpyTasks, 0, SaxpyTasks_size) ;
+
+    //--------------------------------------------------------------------------
+    // create a single coarse task, hash or Gustavson by the flop count
+    //--------------------------------------------------------------------------
+
+    SaxpyTasks [0].start   = 0 ;
+    SaxpyTasks [0].end     = B->nvec - 1 ;
+    SaxpyTasks [0].vector  = -1 ;
+    SaxpyTasks [0].hsize   = GB_hash_table_size (GB_IMAX (fl, 1), cvlen,
+                                AxB_method) ;
+    SaxpyTasks [0].Hi      = NULL ;      // assigned later
+    SaxpyTasks [0].Hf      = NULL ;      // assigned later
+    SaxpyTasks [0].Hx      = NULL ;      // assigned later
+    SaxpyTasks [0].my_cjnz = 0 ;         // unused
+    SaxpyTasks [0].leader  = 0 ;
+    SaxpyTasks [0].team_size = 1 ;
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    (*SaxpyTasks_handle) = SaxpyTasks ;
+    (*SaxpyTasks_size_handle) = SaxpyTasks_size ;
+    (*ntasks) = 1 ;
+    (*nfine) = 0 ;
+    (*nthreads) = 1 ;
+    (*slice_done) = true ;
+    return (GrB_SUCCESS) ;
+}
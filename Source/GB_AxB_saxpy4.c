@@ -68,6 +68,12 @@ GrB_Info GB_AxB_saxpy4              // C += A*B
     int8_t  *restrict Wf = NULL ; size_t Wf_size  = 0 ;
 
     ASSERT_MATRIX_OK (C, "C for saxpy4 C+=A*B", GB0) ;
+
+    // C->x is read and modified in place: apply any deferred unary op, and
+    // if C->x is shared with a duplicate or snapshot, replace it with a
+    // private copy first
+    GB_OK (GB_materialize (C, Werk)) ;
+    GB_OK (GB_unshare (C)) ;
     ASSERT (GB_IS_FULL (C)) ;
     ASSERT (!GB_PENDING (C)) ;
     ASSERT (!GB_JUMBLED (C)) ;
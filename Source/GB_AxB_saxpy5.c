@@ -73,6 +73,12 @@ GrB_Info GB_AxB_saxpy5              // C += A*B
 
     // C type must match the ztype of the monoid
     ASSERT_MATRIX_OK (C, "C for saxpy5 C+=A*B", GB0) ;
+
+    // C->x is read and modified in place: apply any deferred unary op, and
+    // if C->x is shared with a duplicate or snapshot, replace it with a
+    // private copy first
+    GB_OK (GB_materialize (C, Werk)) ;
+    GB_OK (GB_unshare (C)) ;
     ASSERT (GB_IS_FULL (C)) ;
     ASSERT (!GB_PENDING (C)) ;
     ASSERT (!GB_JUMBLED (C)) ;
@@ -25,33 +25,48 @@
 
 #include "GB.h"
 
+// GB_CONTEXT_SLOT is the parallel slot held by this user thread in work-queue
+// mode, or -1 if it holds none; GB_CONTEXT_SLOT_OWNER is the Context whose
+// slot it holds (see GB_Context_slot_acquire below).
+
 #if defined ( _OPENMP )
 
     // OpenMP threadprivate is preferred
     GxB_Context GB_CONTEXT_THREAD = NULL ;
     #pragma omp threadprivate (GB_CONTEXT_THREAD)
+    static int GB_CONTEXT_SLOT = -1 ;
+    #pragma omp threadprivate (GB_CONTEXT_SLOT)
+    static GxB_Context GB_CONTEXT_SLOT_OWNER = NULL ;
+    #pragma omp threadprivate (GB_CONTEXT_SLOT_OWNER)
 
 #elif defined ( HAVE_KEYWORD__THREAD )
 
     // gcc and many other compilers support the __thread keyword
     __thread GxB_Context GB_CONTEXT_THREAD = NULL ;
+    static __thread int GB_CONTEXT_SLOT = -1 ;
+    static __thread GxB_Context GB_CONTEXT_SLOT_OWNER = NULL ;
 
 #elif defined ( HAVE_KEYWORD__DECLSPEC_THREAD )
 
     // Windows: __declspec (thread)
     __declspec ( thread ) GxB_Context GB_CONTEXT_THREAD = NULL ;
+    static __declspec ( thread ) int GB_CONTEXT_SLOT = -1 ;
+    static __declspec ( thread ) GxB_Context GB_CONTEXT_SLOT_OWNER = NULL ;
 
 #elif defined ( HAVE_KEYWORD__THREAD_LOCAL )
 
     // ANSI C11 threads
     #include <threads.h>
     _Thread_local GxB_Context GB_CONTEXT_THREAD = NULL ;
+    static _Thread_local int GB_CONTEXT_SLOT = -1 ;
+    static _Thread_local GxB_Context GB_CONTEXT_SLOT_OWNER = NULL ;
 
 #else
 
     // GraphBLAS will not be thread-safe when using a GxB_Context other than
     // GxB_CONTEXT_WORLD, so GxB_Context_engage returns GrB_NOT_IMPLEMENTED
-    // if passed a Context other than GxB_CONTEXT_WORLD or NULL.
+    // if passed a Context other than GxB_CONTEXT_WORLD or NULL.  Work-queue
+    // mode has no effect in this case.
     #define NO_THREAD_LOCAL_STORAGE
     #define GB_CONTEXT_THREAD NULL
 
@@ -72,6 +87,18 @@ GrB_Info GB_Context_engage (GxB_Context Context)
     #if defined ( NO_THREAD_LOCAL_STORAGE )
     return ((Context == NULL) ? GrB_SUCCESS : GrB_NOT_IMPLEMENTED) ;
     #else
+    if (Context != NULL)
+    {
+        // snapshot the hot read-mostly global settings into the Context.
+        // Kernels running under an engaged Context then read these
+        // thread-private copies (GB_Context_burble, GB_Context_hyper_switch)
+        // instead of the shared globals of GB_Global.c, whose cache lines
+        // bounce between sockets when many user threads poll them.  A global
+        // setting changed via GxB_Global_Option_set while a Context is
+        // engaged takes effect in that Context the next time it is engaged.
+        Context->burble = GB_Global_burble_get ( ) ;
+        Context->hyper_switch = GB_Global_hyper_switch_get ( ) ;
+    }
     GB_CONTEXT_THREAD = Context ;
     return (GrB_SUCCESS) ;
     #endif
@@ -129,8 +156,18 @@ int GB_Context_nthreads_max_get (GxB_Context Context)
 
 //  GB_Context_nthreads_max: get max # of threads from the current Context
 int GB_Context_nthreads_max (void)
-{ 
-    return (GB_Context_nthreads_max_get (GB_CONTEXT_THREAD)) ;
+{
+    int nthreads_max = GB_Context_nthreads_max_get (GB_CONTEXT_THREAD) ;
+    #if !defined ( NO_THREAD_LOCAL_STORAGE )
+    if (nthreads_max > 1 && GB_CONTEXT_SLOT < 0 &&
+        GB_Context_concurrency_get (GB_CONTEXT_THREAD) > 0)
+    {
+        // work-queue mode: this user thread holds no parallel slot of its
+        // engaged Context, so its work runs serially
+        nthreads_max = 1 ;
+    }
+    #endif
+    return (nthreads_max) ;
 }
 
 //   GB_Context_nthreads_max_set: set max # of threads in a Context
@@ -200,6 +237,287 @@ void GB_Context_chunk_set
     }
 }
 
+//   GB_Context_chunk_persist: save an adapted chunk in the current Context
+void GB_Context_chunk_persist
+(
+    double chunk
+)
+{
+    // used by the chunk auto-tuner (GB_autotune.c): the adapted chunk is
+    // written back to the Context engaged to this user thread, so it
+    // persists across calls and can be read back with GxB_Context_get
+    GB_Context_chunk_set (GB_CONTEXT_THREAD, chunk) ;
+}
+
+//------------------------------------------------------------------------------
+// Context->burble, Context->hyper_switch: snapshots of hot global settings
+//------------------------------------------------------------------------------
+
+// These two globals are read on nearly every GraphBLAS call (the burble flag
+// once per GBURBLE, the hyper_switch whenever a matrix is created), through
+// the exported accessors of GB_Global.c.  With many user threads on a large
+// machine those shared reads keep the global cache lines bouncing, so a
+// Context engaged to a user thread carries its own copies, snapshotted at
+// engage time (see GB_Context_engage above).  With no Context engaged the
+// reads fall through to the globals, as before.
+
+//     GB_Context_burble: get the burble setting for this user thread
+bool GB_Context_burble (void)
+{
+    #if !defined ( NO_THREAD_LOCAL_STORAGE )
+    GxB_Context Context = GB_CONTEXT_THREAD ;
+    if (Context != NULL)
+    {
+        return (Context->burble) ;
+    }
+    #endif
+    return (GB_Global_burble_get ( )) ;
+}
+
+//     GB_Context_hyper_switch: get the default hyper_switch for this thread
+float GB_Context_hyper_switch (void)
+{
+    #if !defined ( NO_THREAD_LOCAL_STORAGE )
+    GxB_Context Context = GB_CONTEXT_THREAD ;
+    if (Context != NULL)
+    {
+        return (Context->hyper_switch) ;
+    }
+    #endif
+    return (GB_Global_hyper_switch_get ( )) ;
+}
+
+//------------------------------------------------------------------------------
+// Context->concurrency: work-queue mode for many small concurrent calls
+//------------------------------------------------------------------------------
+
+// When many user threads share one Context and each makes many small calls,
+// every call spins up its own OpenMP parallel region and the region startup
+// dominates.  In work-queue mode (concurrency > 0), the Context holds a small
+// pool of parallel slots: a kernel call that claims a slot runs with the full
+// thread team, and the others run serially on their calling threads, which
+// needs no parallel region at all.  A slot is claimed at kernel entry and
+// released at kernel completion (see GB_prof.c); a claim left behind by a
+// call that ended early expires after GB_CONTEXT_SLOT_EXPIRY seconds, so the
+// pool is self-healing.
+
+// a stale slot claim expires after this many seconds
+#define GB_CONTEXT_SLOT_EXPIRY (0.25)
+
+//     GB_Context_concurrency_get: get # of parallel slots from a Context
+int GB_Context_concurrency_get (GxB_Context Context)
+{
+    int concurrency ;
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    {
+        GB_ATOMIC_READ
+        concurrency = GxB_CONTEXT_WORLD->concurrency ;
+    }
+    else
+    {
+        concurrency = Context->concurrency ;
+    }
+    return (concurrency) ;
+}
+
+//     GB_Context_concurrency_set: set # of parallel slots in a Context
+void GB_Context_concurrency_set
+(
+    GxB_Context Context,
+    int concurrency
+)
+{
+    concurrency = GB_IMAX (0, GB_IMIN (concurrency, GB_CONTEXT_SLOTS)) ;
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    {
+        GB_ATOMIC_WRITE
+        GxB_CONTEXT_WORLD->concurrency = concurrency ;
+    }
+    else
+    {
+        Context->concurrency = concurrency ;
+    }
+}
+
+//     GB_Context_slot_acquire: claim a parallel slot for one kernel call
+void GB_Context_slot_acquire (void)
+{
+    #if !defined ( NO_THREAD_LOCAL_STORAGE )
+    GxB_Context Context = GB_CONTEXT_THREAD ;
+    if (Context == NULL)
+    {
+        Context = GxB_CONTEXT_WORLD ;
+    }
+    int concurrency = GB_Context_concurrency_get (Context) ;
+    if (concurrency <= 0)
+    {
+        // work-queue mode is not enabled for this Context; drop any slot
+        // still held from an earlier claim
+        GB_Context_slot_release ( ) ;
+        return ;
+    }
+    double now = GB_Global_get_wtime ( ) ;
+    if (GB_CONTEXT_SLOT >= 0 && GB_CONTEXT_SLOT_OWNER == Context)
+    {
+        // this user thread already holds a slot; refresh its claim
+        GB_ATOMIC_WRITE
+        Context->slot_time [GB_CONTEXT_SLOT] = now ;
+        return ;
+    }
+    // drop any slot held in a different Context, then try to claim one
+    GB_Context_slot_release ( ) ;
+    #pragma omp critical(GB_Context_slot)
+    {
+        for (int s = 0 ; s < concurrency ; s++)
+        {
+            double claimed = Context->slot_time [s] ;
+            if (claimed == 0 || (now - claimed) > GB_CONTEXT_SLOT_EXPIRY)
+            {
+                // the slot is free, or its claim has gone stale
+                Context->slot_time [s] = now ;
+                GB_CONTEXT_SLOT = s ;
+                GB_CONTEXT_SLOT_OWNER = Context ;
+                break ;
+            }
+        }
+    }
+    #endif
+}
+
+//     GB_Context_slot_release: release the parallel slot of this user thread
+void GB_Context_slot_release (void)
+{
+    #if !defined ( NO_THREAD_LOCAL_STORAGE )
+    if (GB_CONTEXT_SLOT >= 0)
+    {
+        GB_ATOMIC_WRITE
+        GB_CONTEXT_SLOT_OWNER->slot_time [GB_CONTEXT_SLOT] = 0 ;
+        GB_CONTEXT_SLOT = -1 ;
+        GB_CONTEXT_SLOT_OWNER = NULL ;
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// Context->cancelled: cooperative cancellation of long-running kernels
+//------------------------------------------------------------------------------
+
+// A runaway kernel (a GrB_mxm whose cardinality estimate went wrong, say) can
+// otherwise run for minutes with no way to stop it short of killing the
+// process.  Setting GxB_CONTEXT_CANCEL from another user thread requests
+// cancellation: the long kernels poll the flag at coarse task boundaries
+// (the saxpy3 and dot3 phase boundaries, and the sort passes of the
+// builder), free their workspace, and return GxB_CANCELLED.  The request is
+// consumed by the kernel that observes it, so a retry of the cancelled call
+// (with a different method, perhaps) starts afresh.  A request made while no
+// kernel is running remains pending until the next poll, or until it is
+// cleared by setting GxB_CONTEXT_CANCEL to zero.
+
+//     GB_Context_cancelled_get: get the cancellation flag of a Context
+bool GB_Context_cancelled_get (GxB_Context Context)
+{
+    bool cancelled ;
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    {
+        GB_ATOMIC_READ
+        cancelled = GxB_CONTEXT_WORLD->cancelled ;
+    }
+    else
+    {
+        GB_ATOMIC_READ
+        cancelled = Context->cancelled ;
+    }
+    return (cancelled) ;
+}
+
+//     GB_Context_cancelled_set: request or clear cancellation in a Context
+void GB_Context_cancelled_set
+(
+    GxB_Context Context,
+    bool cancelled
+)
+{
+    // unlike the other Context setters, the write is atomic even for a
+    // Context other than GxB_CONTEXT_WORLD: the whole point is to set the
+    // flag from a thread other than the one the Context is engaged to
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    {
+        GB_ATOMIC_WRITE
+        GxB_CONTEXT_WORLD->cancelled = cancelled ;
+    }
+    else
+    {
+        GB_ATOMIC_WRITE
+        Context->cancelled = cancelled ;
+    }
+}
+
+//     GB_Context_cancelled: poll (and consume) the cancellation request
+bool GB_Context_cancelled (void)
+{
+    GxB_Context Context = GB_CONTEXT_THREAD ;
+    if (!GB_Context_cancelled_get (Context))
+    {
+        // the common case: no cancellation pending; a single atomic read
+        return (false) ;
+    }
+    // consume the request, so a retry of the cancelled call starts afresh
+    GB_Context_cancelled_set (Context, false) ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// Context->stream_threshold: streaming stores for huge output arrays
+//------------------------------------------------------------------------------
+
+// If stream_threshold is nonzero, GB_memset and GB_memcpy write any region of
+// at least that many bytes with non-temporal stores, which bypass the cache
+// hierarchy.  A multi-gigabyte output (a bitmap conversion, a concatenation)
+// is not re-read soon, so caching it only evicts data that is.  Zero (the
+// default) disables streaming stores.  See GxB_CONTEXT_STREAM_THRESHOLD.
+
+//     GB_Context_stream_threshold_get: get the threshold of a Context
+size_t GB_Context_stream_threshold_get (GxB_Context Context)
+{
+    size_t stream_threshold ;
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    {
+        GB_ATOMIC_READ
+        stream_threshold = GxB_CONTEXT_WORLD->stream_threshold ;
+    }
+    else
+    {
+        stream_threshold = Context->stream_threshold ;
+    }
+    return (stream_threshold) ;
+}
+
+//     GB_Context_stream_threshold_set: set the threshold of a Context
+void GB_Context_stream_threshold_set
+(
+    GxB_Context Context,
+    size_t stream_threshold
+)
+{
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    {
+        GB_ATOMIC_WRITE
+        GxB_CONTEXT_WORLD->stream_threshold = stream_threshold ;
+    }
+    else
+    {
+        Context->stream_threshold = stream_threshold ;
+    }
+}
+
+//     GB_Context_stream_threshold: get the threshold of the Context of this
+//     user thread
+size_t GB_Context_stream_threshold (void)
+{
+    GxB_Context Context = GB_CONTEXT_THREAD ;
+    return (GB_Context_stream_threshold_get (Context)) ;
+}
+
 //------------------------------------------------------------------------------
 // Context->gpu_id: which GPU to use
 //------------------------------------------------------------------------------
@@ -237,13 +555,268 @@ void GB_Context_gpu_id_set
     int ngpus = GB_Global_gpu_count_get ( ) ;
     if (gpu_id > ngpus || gpu_id < 0) gpu_id = -1 ;
     if (Context == NULL || Context == GxB_CONTEXT_WORLD)
-    { 
+    {
         GB_ATOMIC_WRITE
         GxB_CONTEXT_WORLD->gpu_id = gpu_id ;
     }
     else
-    { 
+    {
         Context->gpu_id = gpu_id ;
     }
 }
 
+//------------------------------------------------------------------------------
+// Context->numa: NUMA first-touch placement mode
+//------------------------------------------------------------------------------
+
+//  GB_Context_numa_get: get the NUMA placement mode from a Context
+int GB_Context_numa_get (GxB_Context Context)
+{
+    int numa ;
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    {
+        GB_ATOMIC_READ
+        numa = GxB_CONTEXT_WORLD->numa ;
+    }
+    else
+    {
+        numa = Context->numa ;
+    }
+    return (numa) ;
+}
+
+//  GB_Context_numa: get the NUMA placement mode from the current Context
+int GB_Context_numa (void)
+{
+    return (GB_Context_numa_get (GB_CONTEXT_THREAD)) ;
+}
+
+//   GB_Context_numa_set: set the NUMA placement mode in a Context
+void GB_Context_numa_set
+(
+    GxB_Context Context,
+    int numa
+)
+{
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    {
+        GB_ATOMIC_WRITE
+        GxB_CONTEXT_WORLD->numa = numa ;
+    }
+    else
+    {
+        Context->numa = numa ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Context->arena: werkspace arena for this user thread
+//------------------------------------------------------------------------------
+
+// The arena holds werkspace allocations that do not fit in the on-stack Werk
+// space (see GB_werk_push/GB_werk_pop), so that a long sequence of GraphBLAS
+// operations can reuse the same allocation instead of calling malloc/free in
+// each operation.  It is used LIFO, just like the Werk stack itself.  The
+// arena is only consulted via GB_CONTEXT_THREAD, never through the shared
+// GxB_CONTEXT_WORLD Context, so it needs no synchronization: a Context
+// engaged to a user thread is owned by that thread alone.  The Context must
+// remain engaged while any GraphBLAS operation is in progress, so a
+// werkspace pushed onto the arena is always popped off the same arena.
+
+//  GB_Context_arena_size_get: get the arena size from a Context
+size_t GB_Context_arena_size_get (GxB_Context Context)
+{
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    {
+        // GxB_CONTEXT_WORLD is shared amongst all user threads, so it never
+        // has an arena
+        return (0) ;
+    }
+    return (Context->arena_size) ;
+}
+
+//   GB_Context_arena_size_set: set the arena size in a Context
+GrB_Info GB_Context_arena_size_set
+(
+    GxB_Context Context,
+    size_t arena_size
+)
+{
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    {
+        // the shared GxB_CONTEXT_WORLD Context cannot have an arena
+        return (GrB_INVALID_VALUE) ;
+    }
+    if (Context->arena_top != 0)
+    {
+        // the arena is in use; it cannot be resized
+        return (GrB_INVALID_VALUE) ;
+    }
+    // free any prior arena
+    GB_FREE (&(Context->arena), Context->arena_size) ;
+    Context->arena_size = 0 ;
+    if (arena_size > 0)
+    {
+        // allocate the new arena
+        size_t arena_size_allocated = 0 ;
+        Context->arena = GB_MALLOC (arena_size, GB_void,
+            &arena_size_allocated) ;
+        if (Context->arena == NULL)
+        {
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        Context->arena_size = arena_size_allocated ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//  GB_Context_arena_push: allocate werkspace from the arena of this thread
+void *GB_Context_arena_push
+(
+    size_t *size_allocated,     // # of bytes actually allocated
+    size_t size                 // # of bytes requested
+)
+{
+    GxB_Context Context = GB_CONTEXT_THREAD ;
+    if (Context == NULL || Context->arena_size == 0)
+    {
+        // no Context engaged to this user thread, or it has no arena
+        return (NULL) ;
+    }
+    size = GB_ROUND8 (size) ;
+    if (size > Context->arena_size - Context->arena_top)
+    {
+        // the request does not fit in the arena
+        return (NULL) ;
+    }
+    GB_void *p = Context->arena + Context->arena_top ;
+    Context->arena_top += size ;
+    (*size_allocated) = size ;
+    return ((void *) p) ;
+}
+
+//  GB_Context_arena_pop: free werkspace allocated from the arena
+bool GB_Context_arena_pop      // true if p was allocated from the arena
+(
+    void *p,                    // werkspace to free
+    size_t size_allocated       // # of bytes actually allocated
+)
+{
+    GxB_Context Context = GB_CONTEXT_THREAD ;
+    if (Context == NULL || Context->arena == NULL)
+    {
+        // no Context engaged to this user thread, or it has no arena
+        return (false) ;
+    }
+    GB_void *q = (GB_void *) p ;
+    if (q < Context->arena || q >= Context->arena + Context->arena_size)
+    {
+        // p was not allocated from the arena
+        return (false) ;
+    }
+    // free p, and everything above it in the arena.  If werkspaces are freed
+    // out of order, this frees the ones above p as well, just like freeing an
+    // item from the middle of the Werk stack.
+    ASSERT ((size_t) (q - Context->arena) + size_allocated
+        <= Context->arena_top) ;
+    Context->arena_top = (size_t) (q - Context->arena) ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// Context->alloc_func, dealloc_func: per-Context memory allocator
+//------------------------------------------------------------------------------
+
+// A Context engaged to a user thread can provide its own allocator, which
+// then overrides the global malloc/free functions of GxB_init for all
+// allocations made by that thread.  All such allocators must share a single
+// underlying heap with the global malloc/free (such as jemalloc arenas),
+// since a block may be allocated and freed under different engaged Contexts.
+// GxB_CONTEXT_WORLD is shared amongst all user threads and never has an
+// allocator of its own.
+
+//   GB_Context_allocator_set: set the allocator of a Context
+GrB_Info GB_Context_allocator_set
+(
+    GxB_Context Context,
+    GxB_alloc_function alloc_func,
+    GxB_dealloc_function dealloc_func,
+    void *allocator_state
+)
+{
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    {
+        // the shared GxB_CONTEXT_WORLD Context cannot have an allocator;
+        // the global malloc/free functions are set by GxB_init
+        return (GrB_INVALID_VALUE) ;
+    }
+    if ((alloc_func == NULL) != (dealloc_func == NULL))
+    {
+        // both functions must be given, or both NULL to clear the allocator
+        return (GrB_NULL_POINTER) ;
+    }
+    Context->alloc_func = alloc_func ;
+    Context->dealloc_func = dealloc_func ;
+    Context->allocator_state = allocator_state ;
+    return (GrB_SUCCESS) ;
+}
+
+//   GB_Context_allocator_get: get the allocator of a Context
+void GB_Context_allocator_get
+(
+    GxB_Context Context,
+    GxB_alloc_function *alloc_func,
+    GxB_dealloc_function *dealloc_func,
+    void **allocator_state
+)
+{
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    {
+        (*alloc_func) = NULL ;
+        (*dealloc_func) = NULL ;
+        (*allocator_state) = NULL ;
+    }
+    else
+    {
+        (*alloc_func) = Context->alloc_func ;
+        (*dealloc_func) = Context->dealloc_func ;
+        (*allocator_state) = Context->allocator_state ;
+    }
+}
+
+//  GB_Context_alloc: allocate a block via the allocator of this user thread
+void *GB_Context_alloc      // newly-allocated block, or NULL
+(
+    size_t size             // # of bytes to allocate
+)
+{
+    GxB_Context Context = GB_CONTEXT_THREAD ;
+    if (Context == NULL || Context->alloc_func == NULL)
+    {
+        // no Context engaged to this user thread, or it has no allocator
+        return (NULL) ;
+    }
+    void *p = Context->alloc_func (size, Context->allocator_state) ;
+    GB_Global_memtable_add (p, size) ;
+    return (p) ;
+}
+
+//  GB_Context_dealloc: free a block via the allocator of this user thread
+bool GB_Context_dealloc     // true if the block has been freed
+(
+    void *p,                // block to free
+    size_t size_allocated   // # of bytes actually allocated
+)
+{
+    GxB_Context Context = GB_CONTEXT_THREAD ;
+    if (Context == NULL || Context->dealloc_func == NULL)
+    {
+        // no Context engaged to this user thread, or it has no allocator
+        return (false) ;
+    }
+    Context->dealloc_func (p, size_allocated, Context->allocator_state) ;
+    GB_Global_memtable_remove (p) ;
+    return (true) ;
+}
+
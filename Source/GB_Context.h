@@ -20,9 +20,45 @@ void   GB_Context_nthreads_max_set (GxB_Context Context, int nthreads_max) ;
 double GB_Context_chunk (void) ;
 double GB_Context_chunk_get (GxB_Context Context) ;
 void   GB_Context_chunk_set (GxB_Context Context, double chunk) ;
+void   GB_Context_chunk_persist (double chunk) ;
+
+bool   GB_Context_burble (void) ;
+float  GB_Context_hyper_switch (void) ;
+
+int    GB_Context_concurrency_get (GxB_Context Context) ;
+void   GB_Context_concurrency_set (GxB_Context Context, int concurrency) ;
+void   GB_Context_slot_acquire (void) ;
+void   GB_Context_slot_release (void) ;
+
+bool   GB_Context_cancelled (void) ;
+bool   GB_Context_cancelled_get (GxB_Context Context) ;
+void   GB_Context_cancelled_set (GxB_Context Context, bool cancelled) ;
+
+size_t GB_Context_stream_threshold (void) ;
+size_t GB_Context_stream_threshold_get (GxB_Context Context) ;
+void   GB_Context_stream_threshold_set (GxB_Context Context,
+    size_t stream_threshold) ;
 
 int    GB_Context_gpu_id (void) ;
 int    GB_Context_gpu_id_get (GxB_Context Context) ;
 void   GB_Context_gpu_id_set (GxB_Context Context, int gpu_id) ;
 
+int    GB_Context_numa (void) ;
+int    GB_Context_numa_get (GxB_Context Context) ;
+void   GB_Context_numa_set (GxB_Context Context, int numa) ;
+
+size_t GB_Context_arena_size_get (GxB_Context Context) ;
+GrB_Info GB_Context_arena_size_set (GxB_Context Context, size_t arena_size) ;
+void  *GB_Context_arena_push (size_t *size_allocated, size_t size) ;
+bool   GB_Context_arena_pop (void *p, size_t size_allocated) ;
+
+GrB_Info GB_Context_allocator_set (GxB_Context Context,
+    GxB_alloc_function alloc_func, GxB_dealloc_function dealloc_func,
+    void *allocator_state) ;
+void   GB_Context_allocator_get (GxB_Context Context,
+    GxB_alloc_function *alloc_func, GxB_dealloc_function *dealloc_func,
+    void **allocator_state) ;
+void  *GB_Context_alloc (size_t size) ;
+bool   GB_Context_dealloc (void *p, size_t size_allocated) ;
+
 #endif
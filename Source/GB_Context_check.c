@@ -47,6 +47,16 @@ GrB_Info GB_Context_check       // check a GraphBLAS Context
     int gpu_id = GB_Context_gpu_id_get (Context) ;
     if (gpu_id >= 0) GBPR0 ("    Context.gpu_id:   %d\n", gpu_id) ;
 
+    int numa = GB_Context_numa_get (Context) ;
+    if (numa != 0) GBPR0 ("    Context.numa:     %d\n", numa) ;
+
+    int concurrency = GB_Context_concurrency_get (Context) ;
+    if (concurrency > 0)
+    {
+        GBPR0 ("    Context.concurrency: %d (work-queue mode)\n",
+            concurrency) ;
+    }
+
     return (GrB_SUCCESS) ;
 }
 
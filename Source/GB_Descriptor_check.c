@@ -143,10 +143,15 @@ GrB_Info GB_Descriptor_check    // check a GraphBLAS descriptor
     }
 
     if (D->import != GxB_DEFAULT)
-    { 
+    {
         GBPR0 ("    d.import   = secure\n") ;
     }
 
+    if (D->mxm_pattern_reuse)
+    {
+        GBPR0 ("    d.mxm_pattern_reuse = true\n") ;
+    }
+
     if (D->compression != GxB_DEFAULT)
     { 
         GBPR0 ("    d.compression = %d\n", D->compression) ;
@@ -16,6 +16,11 @@
 #include "GB.h"
 #include "GB_cpu_features.h"
 
+#if defined ( __linux__ )
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 //------------------------------------------------------------------------------
 // Global storage: for all threads in a user application that uses GraphBLAS
 //------------------------------------------------------------------------------
@@ -107,6 +112,56 @@ typedef struct
     bool print_one_based ;          // if true, print 1-based indices
     bool print_mem_shallow ;        // if true, print # shallow bytes
 
+    //--------------------------------------------------------------------------
+    // saxpy3 plan cache
+    //--------------------------------------------------------------------------
+
+    bool mxm_plan_cache ;           // if true, cache saxpy3 symbolic plans
+
+    //--------------------------------------------------------------------------
+    // huge pages
+    //--------------------------------------------------------------------------
+
+    bool dup_sharing ;              // if true, GrB_*_dup shares its arrays
+                                    // with the original matrix, in O(1) time,
+                                    // copying only on the first in-place write
+
+    int64_t hugepage_threshold ;    // if > 0, advise the OS to back memory
+                                    // blocks of this size or larger with
+                                    // huge pages
+
+    //--------------------------------------------------------------------------
+    // memory pressure
+    //--------------------------------------------------------------------------
+
+    GxB_memory_pressure_function memory_pressure_func ;
+                                    // if not NULL: called when a memory
+                                    // allocation fails, so the application
+                                    // can release memory; the failed
+                                    // allocation is retried if it returns
+                                    // true
+
+    int64_t spill_threshold ;       // if > 0, memory blocks of this size or
+                                    // larger are backed by file mappings
+
+    int64_t memory_in_use ;         // # of bytes currently allocated by
+                                    // GraphBLAS and not yet freed; updated
+                                    // atomically on every allocation and free
+
+    //--------------------------------------------------------------------------
+    // structured operation profiler
+    //--------------------------------------------------------------------------
+
+    bool profiling ;                // if true, profiled kernels capture one
+                                    // GxB_Profile record per call (GB_prof.c)
+
+    bool chunk_autotune ;           // if true, the chunk parameter of each
+                                    // kernel family is adapted online from
+                                    // measured run times (GB_autotune.c)
+
+    int64_t profile_bytes ;         // cumulative # of bytes allocated; only
+                                    // updated when profiling is enabled
+
     //--------------------------------------------------------------------------
     // timing: for code development only
     //--------------------------------------------------------------------------
@@ -203,6 +258,25 @@ static GB_Global_struct GB_Global =
     .print_one_based = false,   // if true, print 1-based indices
     .print_mem_shallow = false, // for @GrB interface only
 
+    // saxpy3 plan cache
+    .mxm_plan_cache = false,    // opt-in, via GxB_MXM_PLAN_CACHE
+
+    // copy-on-write duplicates
+    .dup_sharing = false,       // opt-in, via GxB_DUP_SHARING
+
+    // huge pages
+    .hugepage_threshold = 0,    // opt-in, via GxB_HUGEPAGE_THRESHOLD
+
+    // memory pressure
+    .memory_pressure_func = NULL,   // no memory-pressure callback
+    .spill_threshold = 0,       // opt-in, via GxB_SPILL_THRESHOLD
+    .memory_in_use = 0,         // no memory allocated yet
+
+    // structured operation profiler
+    .profiling = false,         // opt-in, via GxB_PROFILING
+    .profile_bytes = 0,         // no allocations profiled yet
+    .chunk_autotune = false,    // opt-in, via GxB_CHUNK_AUTOTUNE
+
     .timing = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
                 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
 
@@ -857,10 +931,179 @@ void GB_Global_burble_set (bool burble)
 }
 
 bool GB_Global_burble_get (void)
-{ 
+{
     return (GB_Global.burble) ;
 }
 
+//------------------------------------------------------------------------------
+// mxm_plan_cache: for controlling the saxpy3 plan cache
+//------------------------------------------------------------------------------
+
+void GB_Global_mxm_plan_cache_set (bool mxm_plan_cache)
+{
+    GB_Global.mxm_plan_cache = mxm_plan_cache ;
+}
+
+bool GB_Global_mxm_plan_cache_get (void)
+{
+    return (GB_Global.mxm_plan_cache) ;
+}
+
+//------------------------------------------------------------------------------
+// hugepage_threshold: huge pages for large memory blocks
+//------------------------------------------------------------------------------
+
+void GB_Global_dup_sharing_set (bool dup_sharing)
+{ 
+    GB_Global.dup_sharing = dup_sharing ;
+}
+
+bool GB_Global_dup_sharing_get (void)
+{ 
+    return (GB_Global.dup_sharing) ;
+}
+
+void GB_Global_hugepage_threshold_set (int64_t hugepage_threshold)
+{
+    GB_Global.hugepage_threshold = GB_IMAX (hugepage_threshold, 0) ;
+}
+
+int64_t GB_Global_hugepage_threshold_get (void)
+{
+    return (GB_Global.hugepage_threshold) ;
+}
+
+// GB_Global_hugepage_advise: advise the OS to back a newly-allocated block
+// with huge pages, if the block reaches the threshold.  This reduces dTLB
+// misses in kernels that access large Ap/Ai/Ax arrays at random.  The advice
+// covers the whole pages inside the block, since madvise requires an address
+// range aligned to page boundaries.  On platforms without madvise this is a
+// no-op, as it is when the threshold is zero (the default).
+
+void GB_Global_hugepage_advise (void *p, size_t size)
+{
+    #if defined ( __linux__ ) && defined ( MADV_HUGEPAGE )
+    int64_t threshold = GB_Global.hugepage_threshold ;
+    if (p != NULL && threshold > 0 && size >= (size_t) threshold)
+    {
+        size_t pagesize = (size_t) sysconf (_SC_PAGESIZE) ;
+        uintptr_t first = (((uintptr_t) p) + pagesize - 1) & ~(pagesize-1) ;
+        uintptr_t last  = (((uintptr_t) p) + size) & ~(pagesize-1) ;
+        if (last > first)
+        {
+            // advice is best-effort; ignore any failure
+            (void) madvise ((void *) first, last - first, MADV_HUGEPAGE) ;
+        }
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// memory_pressure_func: callback for failed memory allocations
+//------------------------------------------------------------------------------
+
+void GB_Global_memory_pressure_function_set
+(
+    GxB_memory_pressure_function memory_pressure_func
+)
+{
+    GB_Global.memory_pressure_func = memory_pressure_func ;
+}
+
+GxB_memory_pressure_function GB_Global_memory_pressure_function_get (void)
+{
+    return (GB_Global.memory_pressure_func) ;
+}
+
+// GB_Global_memory_pressure: report a failed allocation to the application.
+// Returns true if the callback released memory and the allocation should be
+// retried.
+
+bool GB_Global_memory_pressure (size_t size_needed)
+{
+    GxB_memory_pressure_function memory_pressure_func =
+        GB_Global.memory_pressure_func ;
+    if (memory_pressure_func == NULL)
+    {
+        return (false) ;
+    }
+    return (memory_pressure_func (size_needed)) ;
+}
+
+//------------------------------------------------------------------------------
+// spill_threshold: file-backed memory for very large blocks
+//------------------------------------------------------------------------------
+
+void GB_Global_spill_threshold_set (int64_t spill_threshold)
+{
+    GB_Global.spill_threshold = GB_IMAX (spill_threshold, 0) ;
+}
+
+int64_t GB_Global_spill_threshold_get (void)
+{
+    return (GB_Global.spill_threshold) ;
+}
+
+//------------------------------------------------------------------------------
+// memory_in_use: live count of all GraphBLAS allocations
+//------------------------------------------------------------------------------
+
+void GB_Global_memory_in_use_adjust (int64_t delta)
+{
+    GB_ATOMIC_UPDATE
+    GB_Global.memory_in_use += delta ;
+}
+
+int64_t GB_Global_memory_in_use_get (void)
+{
+    int64_t memory_in_use ;
+    GB_ATOMIC_READ
+    memory_in_use = GB_Global.memory_in_use ;
+    return (memory_in_use) ;
+}
+
+//------------------------------------------------------------------------------
+// profiling: structured operation profiler
+//------------------------------------------------------------------------------
+
+void GB_Global_profiling_set (bool profiling)
+{
+    GB_Global.profiling = profiling ;
+}
+
+bool GB_Global_profiling_get (void)
+{
+    return (GB_Global.profiling) ;
+}
+
+void GB_Global_profile_bytes_adjust (int64_t delta)
+{
+    GB_ATOMIC_UPDATE
+    GB_Global.profile_bytes += delta ;
+}
+
+int64_t GB_Global_profile_bytes_get (void)
+{
+    int64_t profile_bytes ;
+    GB_ATOMIC_READ
+    profile_bytes = GB_Global.profile_bytes ;
+    return (profile_bytes) ;
+}
+
+//------------------------------------------------------------------------------
+// chunk_autotune: online auto-tuning of the chunk parameter
+//------------------------------------------------------------------------------
+
+void GB_Global_chunk_autotune_set (bool chunk_autotune)
+{
+    GB_Global.chunk_autotune = chunk_autotune ;
+}
+
+bool GB_Global_chunk_autotune_get (void)
+{
+    return (GB_Global.chunk_autotune) ;
+}
+
 GB_printf_function_t GB_Global_printf_get (void)
 { 
     return (GB_Global.printf_func) ;
@@ -81,6 +81,36 @@ int64_t  GB_Global_hack_get (int k) ;
 void     GB_Global_burble_set (bool burble) ;
 bool     GB_Global_burble_get (void) ;
 
+void     GB_Global_mxm_plan_cache_set (bool mxm_plan_cache) ;
+bool     GB_Global_mxm_plan_cache_get (void) ;
+
+void     GB_Global_dup_sharing_set (bool dup_sharing) ;
+bool     GB_Global_dup_sharing_get (void) ;
+
+void     GB_Global_hugepage_threshold_set (int64_t hugepage_threshold) ;
+int64_t  GB_Global_hugepage_threshold_get (void) ;
+void     GB_Global_hugepage_advise (void *p, size_t size) ;
+
+void     GB_Global_memory_pressure_function_set
+             (GxB_memory_pressure_function memory_pressure_func) ;
+GxB_memory_pressure_function GB_Global_memory_pressure_function_get (void) ;
+bool     GB_Global_memory_pressure (size_t size_needed) ;
+
+void     GB_Global_spill_threshold_set (int64_t spill_threshold) ;
+int64_t  GB_Global_spill_threshold_get (void) ;
+
+void     GB_Global_memory_in_use_adjust (int64_t delta) ;
+int64_t  GB_Global_memory_in_use_get (void) ;
+
+void     GB_Global_profiling_set (bool profiling) ;
+bool     GB_Global_profiling_get (void) ;
+
+void     GB_Global_profile_bytes_adjust (int64_t delta) ;
+int64_t  GB_Global_profile_bytes_get (void) ;
+
+void     GB_Global_chunk_autotune_set (bool chunk_autotune) ;
+bool     GB_Global_chunk_autotune_get (void) ;
+
 void     GB_Global_print_one_based_set (bool onebased) ;
 bool     GB_Global_print_one_based_get (void) ;
 
@@ -67,6 +67,23 @@ GrB_Info GB_Iterator_attach
     iterator->Ab = A->b ;
     iterator->Ai = A->i ;
     iterator->Ax = A->x ;
+    GrB_Matrix Y = A->Y ;
+    if (Y != NULL)
+    { 
+        // capture the A->Y hyper_hash, so that a seek to A(:,j) can use a
+        // constant-time hash lookup instead of a binary search of Ah
+        iterator->Yp = Y->p ;
+        iterator->Yi = Y->i ;
+        iterator->Yx = (const int64_t *) Y->x ;
+        iterator->hash_bits = Y->vdim - 1 ;
+    }
+    else
+    { 
+        iterator->Yp = NULL ;
+        iterator->Yi = NULL ;
+        iterator->Yx = NULL ;
+        iterator->hash_bits = 0 ;
+    }
     iterator->type_size = A->type->size ;
     iterator->A_sparsity = GB_sparsity (A) ;
     iterator->iso = A->iso ;
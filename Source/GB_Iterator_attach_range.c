@@ -0,0 +1,62 @@
+//------------------------------------------------------------------------------
+// GB_Iterator_attach_range: attach a row/col iterator to a range of vectors
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Attach a row/col iterator to the matrix A, as GB_Iterator_attach, and then
+// restrict it to the contiguous range of vectors k0 to k1-1, where k0 and k1
+// are positions in the list of vectors held by A (as GxB_rowIterator_kseek or
+// GxB_colIterator_kseek).  The iterator is exhausted when it moves past
+// vector k1-1, so multiple user threads can consume disjoint ranges of the
+// same matrix, each with its own iterator.  On success, the iterator is moved
+// to the first vector of its range.
+
+#include "GB.h"
+
+GrB_Info GB_Iterator_attach_range
+(
+    // input/output:
+    GxB_Iterator iterator,      // iterator to attach to the matrix A
+    // input
+    GrB_Matrix A,               // matrix to attach
+    GxB_Format_Value format,    // by row or by col
+    GrB_Index k0,               // first vector in the range of the iterator
+    GrB_Index k1,               // one past the last vector in the range
+    GrB_Descriptor desc
+)
+{
+
+    //--------------------------------------------------------------------------
+    // attach the iterator to the whole matrix
+    //--------------------------------------------------------------------------
+
+    GrB_Info info = GB_Iterator_attach (iterator, A, format, desc) ;
+    if (info != GrB_SUCCESS)
+    {
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // restrict the iterator to vectors k0 to k1-1
+    //--------------------------------------------------------------------------
+
+    k1 = GB_IMIN (k1, (GrB_Index) iterator->anvec) ;
+    if (k0 > k1)
+    {
+        return (GrB_INVALID_INDEX) ;
+    }
+
+    // the iterator becomes exhausted when it moves past vector k1-1
+    iterator->anvec = (int64_t) k1 ;
+
+    //--------------------------------------------------------------------------
+    // move the iterator to the first vector of its range
+    //--------------------------------------------------------------------------
+
+    return (GB_Iterator_rc_seek (iterator, k0, true)) ;
+}
+
@@ -70,13 +70,28 @@ GrB_Info GB_Iterator_rc_seek
             {
                 // find k so that j = Ah [k], or if not found, return k as the
                 // smallest value so that j < Ah [k]. 
-                k = 0 ;
+                k = -1 ;
                 const int64_t *restrict Ah = iterator->Ah ;
-                if (j > 0)
+                if (iterator->Yp != NULL)
                 { 
-                    bool found ;
-                    int64_t pright = iterator->anvec-1 ;
-                    GB_SPLIT_BINARY_SEARCH (j, Ah, k, pright, found) ;
+                    // A has a hyper_hash: look up j in A->Y, in O(1) expected
+                    // time.  k is -1 if j is not in the Ah hyperlist.
+                    int64_t ignore1, ignore2 ;
+                    k = GB_hyper_hash_lookup (iterator->Ap, iterator->Yp,
+                        iterator->Yi, iterator->Yx, iterator->hash_bits,
+                        (int64_t) j, &ignore1, &ignore2) ;
+                }
+                if (k < 0)
+                {
+                    // j not found by the hyper_hash, or A has no hyper_hash:
+                    // binary search Ah for j, or for the first vector after j
+                    k = 0 ;
+                    if (j > 0)
+                    { 
+                        bool found ;
+                        int64_t pright = iterator->anvec-1 ;
+                        GB_SPLIT_BINARY_SEARCH (j, Ah, k, pright, found) ;
+                    }
                 }
             }
             // If j is found, A(:,j) is the kth vector in the Ah hyperlist.
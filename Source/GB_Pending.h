@@ -25,6 +25,20 @@ bool GB_Pending_alloc       // create a list of pending tuples
     int64_t nmax            // # of pending tuples to hold
 ) ;
 
+bool GB_Pending_pack        // create pending tuples from existing arrays
+(
+    GB_Pending *PHandle,    // output
+    GrB_Type type,          // type of pending tuples
+    GrB_BinaryOp op,        // operator for assembling pending tuples
+    int64_t *i,             // indices into each vector, size n; moved in
+    size_t i_size,          // size of i in bytes
+    int64_t *j,             // vector indices, size n; moved in, or NULL
+    size_t j_size,          // size of j in bytes
+    GB_void *x,             // values, size n, in the type given; moved in
+    size_t x_size,          // size of x in bytes
+    int64_t n               // # of pending tuples
+) ;
+
 bool GB_Pending_realloc     // reallocate a list of pending tuples
 (
     GB_Pending *PHandle,    // Pending tuple list to reallocate
@@ -32,6 +46,21 @@ bool GB_Pending_realloc     // reallocate a list of pending tuples
     GB_Werk Werk
 ) ;
 
+bool GB_Pending_append      // append a batch of tuples to the pending list
+(
+    GB_Pending *PHandle,    // Pending tuples to create or append to
+    bool iso,               // if true, do not allocate Pending->x
+    const int64_t *I,       // indices into each vector, size nvals
+    const int64_t *J,       // vector indices, size nvals, or NULL
+    const GB_void *X,       // values, size nvals, in the type of the list
+    const int64_t nvals,    // # of tuples to append
+    const GrB_Type type,    // type of X, if the list is created
+    const GrB_BinaryOp op,  // new Pending->op, if the list is created
+    const bool is_matrix,   // allocate Pending->j, if the list is created
+    int nthreads,           // # of threads to use
+    GB_Werk Werk
+) ;
+
 void GB_Pending_free        // free a list of pending tuples
 (
     GB_Pending *PHandle
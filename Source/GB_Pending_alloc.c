@@ -85,3 +85,71 @@ bool GB_Pending_alloc       // create a list of pending tuples
     return (true) ;
 }
 
+//------------------------------------------------------------------------------
+// GB_Pending_pack: create a list of pending tuples from existing arrays
+//------------------------------------------------------------------------------
+
+// Takes ownership of the i, j, and x arrays, which must have been allocated
+// by the same memory manager used by GraphBLAS.  The arrays are moved into
+// the pending-tuple list as-is, in O(1) time and memory; they are not copied
+// and their content is not examined here.  On failure (out of memory for the
+// header), the arrays are not freed and still belong to the caller.
+
+bool GB_Pending_pack        // create pending tuples from existing arrays
+(
+    GB_Pending *PHandle,    // output
+    GrB_Type type,          // type of pending tuples
+    GrB_BinaryOp op,        // operator for assembling pending tuples
+    int64_t *i,             // indices into each vector, size n; moved in
+    size_t i_size,          // size of i in bytes
+    int64_t *j,             // vector indices, size n; moved in, or NULL
+    size_t j_size,          // size of j in bytes
+    GB_void *x,             // values, size n, in the type given; moved in
+    size_t x_size,          // size of x in bytes
+    int64_t n               // # of pending tuples
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (PHandle != NULL) ;
+    ASSERT (i != NULL) ;
+    ASSERT (x != NULL) ;
+    (*PHandle) = NULL ;
+
+    //--------------------------------------------------------------------------
+    // allocate the Pending header
+    //--------------------------------------------------------------------------
+
+    size_t header_size ;
+    GB_Pending Pending = GB_MALLOC (1, struct GB_Pending_struct, &header_size) ;
+    if (Pending == NULL)
+    { 
+        // out of memory
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // move the arrays into the list of pending tuples
+    //--------------------------------------------------------------------------
+
+    Pending->header_size = header_size ;
+    Pending->n = n ;                    // all tuples are pending
+    Pending->nmax = n ;                 // the list is exactly full
+    Pending->sorted = false ;           // GB_builder checks the order itself
+    Pending->type = type ;              // type of pending tuples
+    Pending->size = type->size ;        // size of pending tuple type
+    Pending->op = op ;                  // pending operator (NULL is OK)
+    Pending->i = i ; Pending->i_size = i_size ;
+    Pending->j = j ; Pending->j_size = j_size ;
+    Pending->x = x ; Pending->x_size = x_size ;
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    (*PHandle) = Pending ;
+    return (true) ;
+}
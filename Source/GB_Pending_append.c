@@ -0,0 +1,109 @@
+//------------------------------------------------------------------------------
+// GB_Pending_append: append a batch of tuples to the list of pending tuples
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A batch version of GB_Pending_add: the list is grown once to make room for
+// all nvals tuples, and the copy is done in parallel.  The indices must
+// already be valid (checked by the caller) and in the internal (i,j) =
+// (index,vector) convention.  The values X must be in the type of the list;
+// no typecasting is done here (GB_builder typecasts when the tuples are
+// assembled by GB_wait).
+
+// The Pending->sorted flag is maintained just as in GB_Pending_add: the list
+// remains "sorted" only if the appended batch is itself sorted and follows
+// the last tuple already in the list.  Batches that arrive in order thus
+// keep the flag true, and GB_builder skips the sort entirely when the
+// tuples are assembled.
+
+#include "GB_Pending.h"
+
+bool GB_Pending_append      // append a batch of tuples to the pending list
+(
+    GB_Pending *PHandle,    // Pending tuples to create or append to
+    bool iso,               // if true, do not allocate Pending->x
+    const int64_t *I,       // indices into each vector, size nvals
+    const int64_t *J,       // vector indices, size nvals, or NULL
+    const GB_void *X,       // values, size nvals, in the type of the list
+    const int64_t nvals,    // # of tuples to append
+    const GrB_Type type,    // type of X, if the list is created
+    const GrB_BinaryOp op,  // new Pending->op, if the list is created
+    const bool is_matrix,   // allocate Pending->j, if the list is created
+    int nthreads,           // # of threads to use
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (PHandle != NULL) ;
+    ASSERT (I != NULL) ;
+    ASSERT (nvals >= 0) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the Pending tuples, or ensure the list is large enough
+    //--------------------------------------------------------------------------
+
+    if (!GB_Pending_ensure (PHandle, iso, type, op, is_matrix, nvals, Werk))
+    {
+        return (false) ;
+    }
+    GB_Pending Pending = (*PHandle) ;
+    int64_t n = Pending->n ;
+
+    ASSERT (Pending->type == type) ;
+    ASSERT (Pending->nmax >= n + nvals) ;
+    ASSERT (Pending->i != NULL) ;
+    ASSERT ((is_matrix) == (Pending->j != NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // append the tuples and check if the list remains sorted
+    //--------------------------------------------------------------------------
+
+    int64_t *restrict Pending_i = Pending->i ;
+    int64_t *restrict Pending_j = Pending->j ;
+
+    bool sorted = Pending->sorted ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(&&:sorted)
+    for (k = 0 ; k < nvals ; k++)
+    {
+        int64_t i = I [k] ;
+        int64_t j = (J != NULL) ? J [k] : 0 ;
+        Pending_i [n+k] = i ;
+        if (Pending_j != NULL)
+        {
+            Pending_j [n+k] = j ;
+        }
+        // compare with the prior tuple: the one before it in the batch, or
+        // the last tuple already in the list for the first one in the batch
+        int64_t t = n + k - 1 ;
+        if (t >= 0)
+        {
+            int64_t ilast = (k > 0) ? I [k-1] : Pending_i [t] ;
+            int64_t jlast = (k > 0) ? ((J != NULL) ? J [k-1] : 0) :
+                ((Pending_j != NULL) ? Pending_j [t] : 0) ;
+            sorted = sorted && ((jlast < j) || (jlast == j && ilast <= i)) ;
+        }
+    }
+    Pending->sorted = sorted ;
+
+    GB_void *restrict Pending_x = Pending->x ;
+    if (Pending_x != NULL)
+    {
+        size_t size = type->size ;
+        GB_memcpy (Pending_x + (n*size), X, nvals*size, nthreads) ;
+    }
+
+    Pending->n += nvals ;
+
+    return (true) ;     // success
+}
+
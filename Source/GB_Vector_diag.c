@@ -99,6 +99,169 @@ GrB_Info GB_Vector_diag     // extract a diagonal from a matrix, as a vector
         k = -k ;
     }
 
+    //--------------------------------------------------------------------------
+    // quick path when A is full or bitmap: strided gather of the diagonal
+    //--------------------------------------------------------------------------
+
+    bool A_is_bitmap = GB_IS_BITMAP (A) ;
+    if (n > 0 && (A_is_bitmap || GB_as_if_full (A)))
+    {
+
+        // Entry t of V is A (t+knegative, t+kpositive), which is entry
+        // p0 + t*(avlen+1) of Ab and Ax, so the diagonal is gathered with a
+        // single strided pass instead of the select machinery below.  V is
+        // built full if A is full, or bitmap if A is bitmap, and conformed to
+        // its desired format on return.
+
+        const int64_t kpositive = (k >= 0) ? k : 0 ;
+        const int64_t knegative = (k >= 0) ? 0 : (-k) ;
+        const int64_t avlen = A->vlen ;
+        const int64_t p0 = knegative + kpositive * avlen ;
+        const int64_t stride = avlen + 1 ;
+        const bool A_iso = A->iso ;
+        const size_t asize = atype->size ;
+        const size_t vsize = vtype->size ;
+        GB_Type_code vcode = vtype->code ;
+        GB_Type_code acode = atype->code ;
+        GB_cast_function cast_A_to_V = (vcode == acode) ? NULL :
+            GB_cast_factory (vcode, acode) ;
+
+        if (A_iso)
+        { 
+            GBURBLE ("(iso diag) ") ;
+        }
+
+        float bitmap_switch = V->bitmap_switch ;
+        int sparsity_control = V->sparsity_control ;
+
+        // set V->iso = A_iso   OK
+        GB_OK (GB_new_bix (&V, // existing header
+            vtype, n, 1, GB_Ap_null, true,
+            A_is_bitmap ? GxB_BITMAP : GxB_FULL, false,
+            GxB_NEVER_HYPER, -1, n, true, A_iso)) ;
+        V->sparsity_control = sparsity_control ;
+        V->bitmap_switch = bitmap_switch ;
+
+        const GB_void *restrict Ax = (GB_void *) A->x ;
+        GB_void *restrict Vx = (GB_void *) V->x ;
+
+        if (A_iso)
+        { 
+            // Vx [0] = (vtype) Ax [0]
+            GB_cast_scalar (Vx, vcode, Ax, acode, asize) ;
+        }
+
+        int nthreads_max = GB_Context_nthreads_max ( ) ;
+        double chunk = GB_Context_chunk ( ) ;
+        int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+        int64_t t ;
+
+        if (A_is_bitmap)
+        {
+
+            //------------------------------------------------------------------
+            // gather the bitmap and values of the kth diagonal of A
+            //------------------------------------------------------------------
+
+            const int8_t *restrict Ab = A->b ;
+            int8_t *restrict Vb = V->b ;
+            int64_t vnz = 0 ;
+            #pragma omp parallel for num_threads(nthreads) \
+                schedule(static) reduction(+:vnz)
+            for (t = 0 ; t < n ; t++)
+            {
+                int64_t p = p0 + t * stride ;
+                int8_t vb = Ab [p] ;
+                Vb [t] = vb ;
+                if (vb && !A_iso)
+                {
+                    // Vx [t] = (vtype) Ax [p]
+                    if (cast_A_to_V != NULL)
+                    { 
+                        cast_A_to_V (Vx + t*vsize, Ax + p*asize, asize) ;
+                    }
+                    else
+                    { 
+                        memcpy (Vx + t*vsize, Ax + p*asize, asize) ;
+                    }
+                }
+                vnz += vb ;
+            }
+            V->nvals = vnz ;
+
+        }
+        else if (!A_iso)
+        {
+
+            //------------------------------------------------------------------
+            // gather the values of the kth diagonal of full A
+            //------------------------------------------------------------------
+
+            if (cast_A_to_V != NULL)
+            {
+                // Vx [t] = (vtype) Ax [p0 + t*stride], typecasted
+                #pragma omp parallel for num_threads(nthreads) \
+                    schedule(static)
+                for (t = 0 ; t < n ; t++)
+                { 
+                    cast_A_to_V (Vx + t*vsize,
+                        Ax + (p0 + t*stride)*asize, asize) ;
+                }
+            }
+            else
+            {
+                // no typecast; use a type-specific strided gather for the
+                // common sizes so the loop vectorizes
+                switch (asize)
+                {
+                    #define GB_DIAG_GATHER(ctype)                           \
+                    {                                                       \
+                        ctype *restrict Vy = (ctype *) Vx ;                 \
+                        const ctype *restrict Ay = (const ctype *) Ax ;     \
+                        GB_PRAGMA (omp parallel for num_threads(nthreads)   \
+                            schedule(static))                               \
+                        for (t = 0 ; t < n ; t++)                           \
+                        {                                                   \
+                            Vy [t] = Ay [p0 + t*stride] ;                   \
+                        }                                                   \
+                    }                                                       \
+                    break ;
+
+                    case GB_1BYTE  : GB_DIAG_GATHER (uint8_t)
+                    case GB_2BYTE  : GB_DIAG_GATHER (uint16_t)
+                    case GB_4BYTE  : GB_DIAG_GATHER (uint32_t)
+                    case GB_8BYTE  : GB_DIAG_GATHER (uint64_t)
+                    case GB_16BYTE : GB_DIAG_GATHER (GB_blob16)
+                    #undef GB_DIAG_GATHER
+
+                    default : 
+                    {
+                        // user-defined type of another size
+                        #pragma omp parallel for num_threads(nthreads) \
+                            schedule(static)
+                        for (t = 0 ; t < n ; t++)
+                        { 
+                            memcpy (Vx + t*vsize,
+                                Ax + (p0 + t*stride)*asize, asize) ;
+                        }
+                    }
+                    break ;
+                }
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // finalize V, conform it to its desired format, and return result
+        //----------------------------------------------------------------------
+
+        V->nvec_nonempty = (GB_nnz (V) == 0) ? 0 : 1 ;
+        V->magic = GB_MAGIC ;
+        ASSERT_MATRIX_OK (V, "V before conform for GB_Vector_diag", GB0) ;
+        GB_OK (GB_conform (V, Werk)) ;
+        ASSERT_MATRIX_OK (V, "V output for GB_Vector_diag", GB0) ;
+        return (GrB_SUCCESS) ;
+    }
+
     //--------------------------------------------------------------------------
     // extract the kth diagonal of A into the temporary hypersparse matrix T
     //--------------------------------------------------------------------------
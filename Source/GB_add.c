@@ -48,7 +48,11 @@
 
 #include "GB_add.h"
 
-#define GB_FREE_ALL ;
+#define GB_FREE_ALL                 \
+{                                   \
+    GB_Matrix_free (&Awork) ;       \
+    GB_Matrix_free (&Bwork) ;       \
+}
 
 GrB_Info GB_add             // C=A+B, C<M>=A+B, or C<!M>=A+B
 (
@@ -59,8 +63,8 @@ GrB_Info GB_add             // C=A+B, C<M>=A+B, or C<!M>=A+B
     const bool Mask_struct, // if true, use the only structure of M
     const bool Mask_comp,   // if true, use !M
     bool *mask_applied,     // if true, the mask was applied
-    const GrB_Matrix A,     // input A matrix
-    const GrB_Matrix B,     // input B matrix
+    const GrB_Matrix A_in,  // input A matrix
+    const GrB_Matrix B_in,  // input B matrix
     const bool is_eWiseUnion,   // if true, eWiseUnion, else eWiseAdd
     const GrB_Scalar alpha, // alpha and beta ignored for eWiseAdd,
     const GrB_Scalar beta,  // nonempty scalars for GxB_eWiseUnion
@@ -75,18 +79,21 @@ GrB_Info GB_add             // C=A+B, C<M>=A+B, or C<!M>=A+B
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
+    struct GB_Matrix_opaque Awork_header, Bwork_header ;
+    GrB_Matrix Awork = NULL, Bwork = NULL ;
 
     ASSERT (C != NULL && (C->static_header || GBNSTATIC)) ;
 
     ASSERT (mask_applied != NULL) ;
     (*mask_applied) = false ;
 
-    ASSERT_MATRIX_OK (A, "A for add", GB0) ;
-    ASSERT_MATRIX_OK (B, "B for add", GB0) ;
+    ASSERT_MATRIX_OK (A_in, "A for add", GB0) ;
+    ASSERT_MATRIX_OK (B_in, "B for add", GB0) ;
     ASSERT_BINARYOP_OK (op, "op for add", GB0) ;
     ASSERT_MATRIX_OK_OR_NULL (M, "M for add", GB0) ;
-    ASSERT (A->vdim == B->vdim && A->vlen == B->vlen) ;
-    ASSERT (GB_IMPLIES (M != NULL, A->vdim == M->vdim && A->vlen == M->vlen)) ;
+    ASSERT (A_in->vdim == B_in->vdim && A_in->vlen == B_in->vlen) ;
+    ASSERT (GB_IMPLIES (M != NULL,
+        A_in->vdim == M->vdim && A_in->vlen == M->vlen)) ;
 
     //--------------------------------------------------------------------------
     // delete any lingering zombies and assemble any pending tuples
@@ -94,8 +101,37 @@ GrB_Info GB_add             // C=A+B, C<M>=A+B, or C<!M>=A+B
 
     // TODO: some cases can allow M, A, and/or B to be jumbled
     GB_MATRIX_WAIT (M) ;        // cannot be jumbled
-    GB_MATRIX_WAIT (A) ;        // cannot be jumbled
-    GB_MATRIX_WAIT (B) ;        // cannot be jumbled
+    GB_MATRIX_WAIT (A_in) ;     // cannot be jumbled
+    GB_MATRIX_WAIT (B_in) ;     // cannot be jumbled
+
+    //--------------------------------------------------------------------------
+    // view bitmap matrices with all entries present as full
+    //--------------------------------------------------------------------------
+
+    // A bitmap matrix with all entries present is identical in memory to a
+    // full matrix.  Viewing it as full lets GB_add_sparsity choose a full
+    // result where it would otherwise choose bitmap, and phase2 then uses the
+    // branch-free full kernels, with no Ab or Bb scans and no Cb to write.
+    // This is skipped when A and B are disjoint: that case comes from
+    // GB_wait, which requires a sparse or hypersparse result.
+
+    GrB_Matrix A = A_in ;
+    GrB_Matrix B = B_in ;
+    if (!A_and_B_are_disjoint)
+    {
+        if (GB_IS_BITMAP (A_in) && GB_as_if_full (A_in))
+        { 
+            // A = full shallow version of A_in
+            GB_CLEAR_STATIC_HEADER (Awork, &Awork_header) ;
+            A = GB_full_shallow (Awork, A_in) ;
+        }
+        if (GB_IS_BITMAP (B_in) && GB_as_if_full (B_in))
+        { 
+            // B = full shallow version of B_in
+            GB_CLEAR_STATIC_HEADER (Bwork, &Bwork_header) ;
+            B = GB_full_shallow (Bwork, B_in) ;
+        }
+    }
 
     //--------------------------------------------------------------------------
     // determine the sparsity of C
@@ -115,7 +151,7 @@ GrB_Info GB_add             // C=A+B, C<M>=A+B, or C<!M>=A+B
     int64_t *C_to_M = NULL ; size_t C_to_M_size = 0 ;
     int64_t *C_to_A = NULL ; size_t C_to_A_size = 0 ;
     int64_t *C_to_B = NULL ; size_t C_to_B_size = 0 ;
-    bool Ch_is_Mh ;
+    bool Ch_is_Mh = false ;
     int C_ntasks = 0, C_nthreads ;
     GB_task_struct *TaskList = NULL ; size_t TaskList_size = 0 ;
 
@@ -123,10 +159,16 @@ GrB_Info GB_add             // C=A+B, C<M>=A+B, or C<!M>=A+B
     // phase0: finalize the sparsity C and find the vectors in C
     //--------------------------------------------------------------------------
 
+    // with a complemented sparse/hyper mask, entries of C can fall outside
+    // the pattern of M, so the Ch == Mh shortcut of GB_add_phase0 must not be
+    // used; Ch is constructed from A and B alone, as if there were no mask
+    bool M_comp_sparse = apply_mask && Mask_comp &&
+        (GB_IS_SPARSE (M) || GB_IS_HYPERSPARSE (M)) ;
+
     info = GB_add_phase0 (
         // computed by by phase0:
         &Cnvec, &Ch, &Ch_size, &C_to_M, &C_to_M_size, &C_to_A, &C_to_A_size,
-        &C_to_B, &C_to_B_size, &Ch_is_Mh,
+        &C_to_B, &C_to_B_size, (M_comp_sparse) ? NULL : (&Ch_is_Mh),
         // input/output to phase0:
         &C_sparsity,
         // original input:
@@ -134,6 +176,7 @@ GrB_Info GB_add             // C=A+B, C<M>=A+B, or C<!M>=A+B
     if (info != GrB_SUCCESS)
     { 
         // out of memory
+        GB_FREE_ALL ;
         return (info) ;
     }
 
@@ -170,6 +213,7 @@ GrB_Info GB_add             // C=A+B, C<M>=A+B, or C<!M>=A+B
             GB_FREE_WORK (&C_to_M, C_to_M_size) ;
             GB_FREE_WORK (&C_to_A, C_to_A_size) ;
             GB_FREE_WORK (&C_to_B, C_to_B_size) ;
+            GB_FREE_ALL ;
             return (info) ;
         }
 
@@ -191,6 +235,7 @@ GrB_Info GB_add             // C=A+B, C<M>=A+B, or C<!M>=A+B
             GB_FREE_WORK (&C_to_M, C_to_M_size) ;
             GB_FREE_WORK (&C_to_A, C_to_A_size) ;
             GB_FREE_WORK (&C_to_B, C_to_B_size) ;
+            GB_FREE_ALL ;
             return (info) ;
         }
 
@@ -239,6 +284,7 @@ GrB_Info GB_add             // C=A+B, C<M>=A+B, or C<!M>=A+B
     if (info != GrB_SUCCESS)
     { 
         // out of memory
+        GB_FREE_ALL ;
         return (info) ;
     }
 
@@ -246,6 +292,7 @@ GrB_Info GB_add             // C=A+B, C<M>=A+B, or C<!M>=A+B
     // return result
     //--------------------------------------------------------------------------
 
+    GB_FREE_ALL ;
     ASSERT_MATRIX_OK (C, "C output for add", GB0) ;
     (*mask_applied) = apply_mask ;
     return (GrB_SUCCESS) ;
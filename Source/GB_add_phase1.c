@@ -10,8 +10,7 @@
 // GB_add_phase1 counts the number of entries in each vector of C, for C=A+B,
 // C<M>=A+B, or C<!M>=A+B and then does a cumulative sum to find Cp.
 // GB_add_phase1 is preceded by GB_add_phase0, which finds the non-empty
-// vectors of C.  If the mask M is sparse, it is not complemented; only a
-// bitmap or full M is complemented.
+// vectors of C.  The mask M may have any sparsity, complemented or not.
 
 // C is sparse or hypersparse, as determined by GB_add_sparsity.  M, A, and B
 // can have any sparsity structure, but only a specific set of cases will be
@@ -203,7 +203,7 @@ int GB_add_sparsity         // return the sparsity structure for C
         //      ------------------------------------------
         //      C     <!M> =        A       +       B
         //      ------------------------------------------
-        //      sparse  sparse      sparse          sparse      (mask later)
+        //      sparse  sparse      sparse          sparse
         //      bitmap  sparse      sparse          bitmap
         //      bitmap  sparse      sparse          full  
         //      bitmap  sparse      bitmap          sparse
@@ -241,11 +241,10 @@ int GB_add_sparsity         // return the sparsity structure for C
 
         if (A_is_sparse_or_hyper && B_is_sparse_or_hyper)
         { 
-            // !M must be applied later if all 4 matrices are sparse or
-            // hypersparse, since the GB_add_sparse_template method does not
-            // handle this case.  See the "(mask later)" above.  The method can
-            // construct a sparse/hyper C with !M as bitmap or full. 
-            (*apply_mask) = !M_is_sparse_or_hyper ;
+            // !M is applied here for all mask sparsities: if M is sparse or
+            // hypersparse, GB_add_sparse_M_sparse_comp merges M(:,j) with the
+            // union of A(:,j) and B(:,j) in a single ordered pass, so C is
+            // built at its final size, with no unmasked intermediate.
             C_sparsity = GxB_SPARSE ;
         }
         else
@@ -0,0 +1,232 @@
+//------------------------------------------------------------------------------
+// GB_append: append a batch of tuples to a matrix as pending tuples
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// CALLED BY: GxB_Matrix_append
+// CALLS:     GB_Pending_append
+
+// Appends a batch of (i,j,x) tuples to the list of pending tuples of C, in
+// O(batch) time, deferring all sorting and assembly to GB_wait.  This is the
+// batch analog of calling GrB_Matrix_setElement once per tuple, with two
+// differences: the entire batch is added with a single capacity check and a
+// parallel copy, and no search of the existing matrix is done (a tuple whose
+// entry is already present in C becomes a duplicate, resolved at assembly
+// time; the newly appended value wins, as with setElement).
+
+// Duplicates within and across batches are assembled with the dup operator
+// when the matrix is finalized by GrB_Matrix_wait, or by any operation that
+// needs the completed matrix.  As with the pending tuples of setElement, the
+// type of X and the dup operator must be consistent across batches: a batch
+// whose xtype or dup differs from the prior pending tuples forces those
+// tuples to be assembled first.
+
+// An iso or full/bitmap matrix cannot hold pending tuples, so C is converted
+// to non-iso and/or sparse form first.
+
+#include "GB_build.h"
+#include "GB_Pending.h"
+
+#define GB_FREE_ALL ;
+
+GrB_Info GB_append              // append a batch of tuples to a matrix
+(
+    GrB_Matrix C,               // matrix to append to
+    const GrB_Index *I,         // row indices of tuples
+    const GrB_Index *J,         // col indices of tuples (NULL for vector)
+    const void *X,              // values
+    const GrB_Index nvals,      // number of tuples
+    const GrB_BinaryOp dup,     // binary op to assemble duplicates at wait
+    const GrB_Type xtype,       // type of X array
+    const bool is_matrix,       // true if C is a matrix, false if GrB_Vector
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (C != NULL) ;
+
+    GB_RETURN_IF_NULL (I) ;
+    if (I == GrB_ALL)
+    {
+        GB_ERROR (GrB_INVALID_VALUE, "Row indices cannot be %s", "GrB_ALL") ;
+    }
+
+    if (is_matrix)
+    {
+        GB_RETURN_IF_NULL (J) ;
+        if (J == GrB_ALL)
+        {
+            GB_ERROR (GrB_INVALID_VALUE, "Column indices cannot be %s",
+                "GrB_ALL") ;
+        }
+    }
+    else
+    {
+        // only GxB_Vector_append would call this function with J == NULL
+        ASSERT (J == NULL) ;
+    }
+
+    GB_RETURN_IF_NULL (X) ;
+
+    if (nvals > GB_NMAX)
+    {
+        // problem too large
+        GB_ERROR (GrB_INVALID_VALUE, "Problem too large: nvals " GBu
+            " exceeds " GBu, nvals, GB_NMAX) ;
+    }
+
+    // C and X must be compatible
+    if (!GB_Type_compatible (xtype, C->type))
+    {
+        GB_ERROR (GrB_DOMAIN_MISMATCH,
+            "Value(s) of type [%s] cannot be typecast to matrix of type"
+            " [%s]\n", xtype->name, C->type->name) ;
+    }
+
+    // check the dup operator, as in GB_build; NULL is the implied SECOND
+    if (dup != NULL)
+    {
+        GB_RETURN_IF_FAULTY (dup) ;
+        if (GB_OP_IS_POSITIONAL (dup))
+        {
+            // dup operator cannot be a positional op
+            GB_ERROR (GrB_DOMAIN_MISMATCH, "Positional op z=%s(x,y) "
+                "not supported as dup op\n", dup->name) ;
+        }
+        if (dup->xtype != dup->ztype || dup->ytype != dup->ztype)
+        {
+            GB_ERROR (GrB_DOMAIN_MISMATCH, "All domains of dup "
+                "operator for assembling duplicates must be identical.\n"
+                "operator is: [%s] = %s ([%s],[%s])", dup->ztype->name,
+                dup->name, dup->xtype->name, dup->ytype->name) ;
+        }
+        if (!GB_Type_compatible (C->type, dup->ztype))
+        {
+            GB_ERROR (GrB_DOMAIN_MISMATCH,
+                "Operator [%s] for assembling duplicates has type [%s],\n"
+                "cannot be typecast to entries in output of type [%s]",
+                dup->name, dup->ztype->name, C->type->name) ;
+        }
+    }
+
+    if (nvals == 0)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check the indices against the matrix dimensions
+    //--------------------------------------------------------------------------
+
+    // The (row,col) tuples are mapped to (vector,index) according to the
+    // format of C, just as in GB_build.
+
+    int64_t vlen = C->vlen ;
+    int64_t vdim = C->vdim ;
+    const int64_t *restrict I_in = (int64_t *) ((C->is_csc) ? I : J) ;
+    const int64_t *restrict J_in = (int64_t *) ((C->is_csc) ? J : I) ;
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (nvals, chunk, nthreads_max) ;
+
+    bool ok = true ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(&&:ok)
+    for (k = 0 ; k < ((int64_t) nvals) ; k++)
+    {
+        int64_t i = I_in [k] ;
+        ok = ok && (i >= 0 && i < vlen) ;
+        if (J_in != NULL)
+        {
+            int64_t j = J_in [k] ;
+            ok = ok && (j >= 0 && j < vdim) ;
+        }
+    }
+
+    if (!ok)
+    {
+        // scan again to report the first bad index
+        for (k = 0 ; k < ((int64_t) nvals) ; k++)
+        {
+            int64_t i = I_in [k] ;
+            int64_t j = (J_in != NULL) ? J_in [k] : 0 ;
+            if (i < 0 || i >= vlen || j < 0 || j >= vdim)
+            {
+                int64_t row = C->is_csc ? i : j ;
+                int64_t col = C->is_csc ? j : i ;
+                int64_t nrows = C->is_csc ? vlen : vdim ;
+                int64_t ncols = C->is_csc ? vdim : vlen ;
+                GB_ERROR (GrB_INDEX_OUT_OF_BOUNDS,
+                    "index (" GBd "," GBd ") out of bounds,"
+                    " must be < (" GBd ", " GBd ")",
+                    row, col, nrows, ncols) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // convert C to a form that can hold pending tuples
+    //--------------------------------------------------------------------------
+
+    if (C->iso)
+    {
+        // the appended values are arbitrary, so C can no longer be iso
+        GB_OK (GB_convert_any_to_non_iso (C, true)) ;
+    }
+
+    if (GB_IS_FULL (C) || GB_IS_BITMAP (C))
+    {
+        // full and bitmap matrices cannot hold pending tuples
+        GB_OK (GB_convert_any_to_sparse (C, Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // assemble any incompatible prior pending tuples first
+    //--------------------------------------------------------------------------
+
+    // As in GB_setElement: the new pending tuples must have the same type and
+    // the same operator as any prior pending tuples, since no typecasting is
+    // done until the tuples are assembled.
+
+    if (C->Pending != NULL)
+    {
+        if ((xtype != C->Pending->type) ||
+            ! ((dup == C->Pending->op)
+            || (GB_op_is_second (dup, C->type) &&
+                GB_op_is_second (C->Pending->op, C->type))))
+        {
+            GB_OK (GB_wait (C, "C (append: incompatible pending tuples)",
+                Werk)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // append the batch to the list of pending tuples
+    //--------------------------------------------------------------------------
+
+    if (!GB_Pending_append (&(C->Pending), C->iso, I_in, J_in,
+        (const GB_void *) X, nvals, xtype, dup, C->vdim > 1, nthreads, Werk))
+    {
+        // out of memory
+        GB_phybix_free (C) ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    ASSERT (GB_PENDING (C)) ;
+
+    // more pending tuples; block if in blocking mode
+    return (GB_block (C, Werk)) ;
+}
+
@@ -186,6 +186,8 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
 
     // quick return if an empty mask is complemented
     GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp, Mask_struct) ;
+    // quick return if a non-complemented mask has no entries
+    GB_RETURN_IF_EMPTY_MASK (C, C_replace, M, Mask_comp) ;
 
     // delete any lingering zombies and assemble any pending tuples
     GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (A) ;      // A can be jumbled
@@ -238,6 +240,10 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
         A_transpose = !A_transpose ;
     }
 
+    // in nonblocking mode, a unary op can be deferred (see below)
+    GrB_Mode mode = GB_Global_mode_get ( ) ;
+    bool nonblocking = (mode == GrB_NONBLOCKING || mode == GxB_NONBLOCKING_GPU);
+
     if (!T_is_csc && op_is_positional)
     {
         // positional ops must be flipped, with i and j swapped
@@ -261,6 +267,38 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
     // user operator must have i,j flipped
     bool flipij = (!T_is_csc && opcode == GB_USER_idxunop_code) ;
 
+    // In nonblocking mode, C = op (A) can be deferred (see below).  Value
+    // unary ops are deferred as-is.  A positional idxunop with a thunk of 0
+    // or 1 is the same pure function of the pattern as one of the positional
+    // unary ops; rename it so it can be deferred the same way.
+    GB_Operator op_defer = NULL ;
+    if (op_is_unop)
+    { 
+        op_defer = op ;
+    }
+    else if (op_is_idxunop && op_is_positional && (ithunk == 0 || ithunk == 1))
+    {
+        bool off1 = (ithunk == 1) ;
+        bool is32 = (op->ztype == GrB_INT32) ;
+        switch (opcode)
+        {
+            case GB_ROWINDEX_idxunop_code : 
+                // z = i + thunk
+                op_defer = (GB_Operator) (is32 ?
+                    (off1 ? GxB_POSITIONI1_INT32 : GxB_POSITIONI_INT32) :
+                    (off1 ? GxB_POSITIONI1_INT64 : GxB_POSITIONI_INT64)) ;
+                break ;
+            case GB_COLINDEX_idxunop_code : 
+                // z = j + thunk
+                op_defer = (GB_Operator) (is32 ?
+                    (off1 ? GxB_POSITIONJ1_INT32 : GxB_POSITIONJ_INT32) :
+                    (off1 ? GxB_POSITIONJ1_INT64 : GxB_POSITIONJ_INT64)) ;
+                break ;
+            default : 
+                break ;
+        }
+    }
+
     if (A_transpose)
     { 
         // T = op (A'), typecasting to op->ztype
@@ -305,6 +343,45 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
         }
         return (info) ;
     }
+    else if (M == NULL && accum == NULL && (C != A) && (op_defer != NULL)
+        && opcode != GB_IDENTITY_unop_code && nonblocking
+        && (GB_OPCODE_IS_POSITIONAL (op_defer->opcode) ?
+            (C->type == op_defer->ztype
+                && A->type->size == op_defer->ztype->size) :
+            (C->type == A->type && op->ztype == A->type
+                && op->xtype == A->type)))
+    { 
+        // C = op (A) in nonblocking mode, with no mask, no accum, and no
+        // typecasting: defer the op.  C becomes an O(1) duplicate sharing
+        // the arrays of A, with the op recorded in C->deferred_unop instead
+        // of applied; it is applied to the values of C, in place, when C is
+        // next materialized (see GB_materialize), and it is skipped entirely
+        // if C is freed or overwritten first.  Any deferred op already in A
+        // has been applied by the wait above, so deferred applies do not
+        // nest.  A positional op is a pure function of the pattern, so its
+        // values never materialize at all if C is only used structurally
+        // (as a mask, say); the shared value array is a placeholder of the
+        // same size and is never read before the op is applied.
+        GBURBLE ("(deferred-op) ") ;
+        GrB_Matrix S = NULL ;
+        GB_OK (GB_dup_shared (&S, A, Werk)) ;
+        S->type = op_defer->ztype ;
+        S->deferred_unop = (GrB_UnaryOp) op_defer ;
+        // transplant S into C, carrying the deferred op with it
+        return (GB_transplant (C, C->type, &S, Werk)) ;
+    }
+    else if (M == NULL && accum != NULL && !C_replace && op_is_unop
+        && !op_is_positional && opcode != GB_IDENTITY_unop_code
+        && GB_as_if_full (C) && GB_as_if_full (A) && !GB_any_aliased (C, A)
+        && C->type == accum->ztype && C->type == accum->xtype
+        && accum->ytype == op->ztype && op->xtype == A->type)
+    { 
+        // C += op (A) where C and A are both as-if-full, with no mask and no
+        // typecasting.  op (A) is not materialized; each entry is folded into
+        // Cx as it is computed, in a single pass over A->x and C->x.
+        GBURBLE ("(fused apply-accum) ") ;
+        return (GB_apply_accum (C, (GrB_UnaryOp) op, accum, A, Werk)) ;
+    }
     else
     { 
         // T = op (A), pattern is a shallow copy of A, type is op->ztype.
@@ -28,6 +28,15 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_apply_accum     // C += op (A) in one pass
+(
+    GrB_Matrix C,               // input/output matrix, as-if-full
+    const GrB_UnaryOp op,       // unary operator to apply to A
+    const GrB_BinaryOp accum,   // accum operator, no typecasting
+    const GrB_Matrix A,         // input matrix, as-if-full
+    GB_Werk Werk
+) ;
+
 // Cx and A->x may be aliased in GB_apply_op
 
 GrB_Info GB_apply_op        // apply a unary op, idxunop, or binop, Cx = op (A)
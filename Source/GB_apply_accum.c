@@ -0,0 +1,115 @@
+//------------------------------------------------------------------------------
+// GB_apply_accum: C += op (A) in a single pass, for as-if-full C and A
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C += op (A) where C and A are both as-if-full, with no mask and no
+// typecasting.  The result op (A) is not materialized: each entry is computed
+// and immediately folded into Cx with the accum operator, in one pass over
+// the two value arrays.  The caller (GB_apply) has checked that the types
+// match the operators exactly, so no casting occurs here.
+
+// C and A are held in the same vector order, so the values of both appear in
+// the same dense order and a single linear index serves for Cx and Ax.
+
+#include "GB_apply.h"
+
+#define GB_FREE_ALL ;
+
+GrB_Info GB_apply_accum     // C += op (A) in one pass
+(
+    GrB_Matrix C,               // input/output matrix, as-if-full
+    const GrB_UnaryOp op,       // unary operator to apply to A
+    const GrB_BinaryOp accum,   // accum operator, no typecasting
+    const GrB_Matrix A,         // input matrix, as-if-full
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT_MATRIX_OK (C, "C for apply_accum", GB0) ;
+    ASSERT_UNARYOP_OK (op, "op for apply_accum", GB0) ;
+    ASSERT_BINARYOP_OK (accum, "accum for apply_accum", GB0) ;
+    ASSERT_MATRIX_OK (A, "A for apply_accum", GB0) ;
+    ASSERT (GB_as_if_full (C)) ;
+    ASSERT (GB_as_if_full (A)) ;
+    ASSERT (!GB_any_aliased (C, A)) ;
+    ASSERT (C->is_csc == A->is_csc) ;
+    ASSERT (C->vlen == A->vlen && C->vdim == A->vdim) ;
+    ASSERT (C->type == accum->ztype && C->type == accum->xtype) ;
+    ASSERT (accum->ytype == op->ztype && op->xtype == A->type) ;
+
+    //--------------------------------------------------------------------------
+    // expand C to non-iso
+    //--------------------------------------------------------------------------
+
+    if (C->iso)
+    { 
+        // the accumulated result is not iso in general
+        GB_OK (GB_convert_any_to_non_iso (C, true)) ;
+    }
+
+    // C->x is written in place below; get an exclusive copy if a snapshot or
+    // sharing duplicate co-owns it
+    GB_OK (GB_unshare (C)) ;
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    int64_t anz = GB_nnz_full (A) ;
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // Cx [p] = accum (Cx [p], op (Ax [p]))
+    //--------------------------------------------------------------------------
+
+    GB_void *restrict Cx = (GB_void *) C->x ;
+    const GB_void *restrict Ax = (GB_void *) A->x ;
+    const size_t csize = C->type->size ;
+    const size_t asize = A->type->size ;
+    const size_t zsize = op->ztype->size ;
+    GxB_unary_function fop = op->unop_function ;
+    GxB_binary_function faccum = accum->binop_function ;
+    int64_t p ;
+
+    if (A->iso)
+    {
+        // t = op (A[0]), once for all entries of the iso matrix A
+        GB_void t [GB_VLA(zsize)] ;
+        fop (t, Ax) ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (p = 0 ; p < anz ; p++)
+        { 
+            faccum (Cx + p*csize, Cx + p*csize, t) ;
+        }
+    }
+    else
+    {
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (p = 0 ; p < anz ; p++)
+        { 
+            GB_void t [GB_VLA(zsize)] ;
+            fop (t, Ax + p*asize) ;
+            faccum (Cx + p*csize, Cx + p*csize, t) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (C, "C += op (A) output", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -36,6 +36,26 @@ GrB_Info GB_apply_bind1st_jit   // Cx = op (x,B), apply bind1st via the JIT
         false, false, GxB_FULL, ctype, NULL, false, false,
         binaryop, false, NULL, B) ;
 
+    //--------------------------------------------------------------------------
+    // fold a small integer scalar into the kernel
+    //--------------------------------------------------------------------------
+
+    // A small integer scalar becomes a compile-time constant of the kernel
+    // (GB_BIND1ST_SCALAR), so the compiler folds it into immediates instead
+    // of broadcasting a runtime load.  The folded value is part of the scode,
+    // so each scalar value gets its own kernel.  Only done for kernels with
+    // no suffix, so the hash can be recomputed from the encoding alone.
+
+    if (suffix == NULL)
+    {
+        uint64_t xfold = GB_enumify_bind_scalar (xscalar, binaryop->xtype) ;
+        if (xfold != 0)
+        { 
+            encoding.code |= GB_LSHIFT (xfold, 51) ;
+            hash = GB_jitifyer_hash_encoding (&encoding) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // get the kernel function pointer, loading or compiling it if needed
     //--------------------------------------------------------------------------
@@ -36,6 +36,23 @@ GrB_Info GB_apply_bind2nd_jit   // Cx = op (x,B), apply bind2nd via the JIT
         false, false, GxB_FULL, ctype, NULL, false, false,
         binaryop, false, A, NULL) ;
 
+    //--------------------------------------------------------------------------
+    // fold a small integer scalar into the kernel
+    //--------------------------------------------------------------------------
+
+    // see GB_apply_bind1st_jit; here the folded constant is the y scalar
+    // (GB_BIND2ND_SCALAR in the generated kernel)
+
+    if (suffix == NULL)
+    {
+        uint64_t yfold = GB_enumify_bind_scalar (yscalar, binaryop->ytype) ;
+        if (yfold != 0)
+        { 
+            encoding.code |= GB_LSHIFT (yfold, 51) ;
+            hash = GB_jitifyer_hash_encoding (&encoding) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // get the kernel function pointer, loading or compiling it if needed
     //--------------------------------------------------------------------------
@@ -357,11 +357,23 @@ GrB_Info GB_apply_op        // apply a unary op, idxunop, or binop, Cx = op (A)
         ASSERT_OP_OK (op, "unop for GB_apply_op", GB0) ;
         ASSERT (!A->iso) ;
 
+        //----------------------------------------------------------------------
+        // via the CUDA kernel
+        //----------------------------------------------------------------------
+
+        #if defined ( GRAPHBLAS_HAS_CUDA )
+        if (GB_apply_unop_cuda_branch (ctype, op, A))
+        { 
+            info = GB_apply_unop_cuda (Cx, ctype, op, A) ;
+        }
+        #endif
+
         // determine number of threads to use
         #ifndef GBCOMPACT
         GB_IF_FACTORY_KERNELS_ENABLED
         { 
-            if (Atype == op->xtype || opcode == GB_IDENTITY_unop_code)
+            if (info == GrB_NO_VALUE &&
+                (Atype == op->xtype || opcode == GB_IDENTITY_unop_code))
             { 
 
                 // The switch factory is used if the op is IDENTITY, or if no
@@ -414,17 +426,28 @@ GrB_Info GB_apply_op        // apply a unary op, idxunop, or binop, Cx = op (A)
             size_t xsize = op->xtype->size ;
             GB_Type_code acode = Atype->code ;
             GB_Type_code xcode = op->xtype->code ;
-            GB_cast_function cast_A_to_X = GB_cast_factory (xcode, acode) ;
             GxB_unary_function fop = op->unop_function ;
 
-            #define GB_APPLY_OP(p)                              \
-                /* xwork = (xtype) Ax [p] */                    \
-                GB_void xwork [GB_VLA(xsize)] ;                 \
-                cast_A_to_X (xwork, Ax +(p)*asize, asize) ;     \
-                /* Cx [p] = fop (xwork) */                      \
-                fop (Cx +(p*zsize), xwork) ;
-
-            #include "GB_apply_unop_ip.c"
+            if (op->xtype == Atype && Cx != Ax)
+            {
+                // no typecast is needed and Cx does not alias Ax: apply the
+                // op directly to Ax, with no per-entry copy into xwork
+                #define GB_APPLY_OP(p)                              \
+                    /* Cx [p] = fop (Ax [p]) */                     \
+                    fop (Cx +(p*zsize), Ax +(p)*asize) ;
+                #include "GB_apply_unop_ip.c"
+            }
+            else
+            {
+                GB_cast_function cast_A_to_X = GB_cast_factory (xcode, acode) ;
+                #define GB_APPLY_OP(p)                              \
+                    /* xwork = (xtype) Ax [p] */                    \
+                    GB_void xwork [GB_VLA(xsize)] ;                 \
+                    cast_A_to_X (xwork, Ax +(p)*asize, asize) ;     \
+                    /* Cx [p] = fop (xwork) */                      \
+                    fop (Cx +(p*zsize), xwork) ;
+                #include "GB_apply_unop_ip.c"
+            }
 
             info = GrB_SUCCESS ;
         }
@@ -598,28 +621,54 @@ GrB_Info GB_apply_op        // apply a unary op, idxunop, or binop, Cx = op (A)
             ASSERT (!A->iso) ;
 
             if (binop_bind1st)
-            { 
+            {
                 // Cx = binop (scalar,Ax) with bind1st
-                GB_cast_function cast_A_to_Y = GB_cast_factory (ycode, acode) ;
-                #define GB_APPLY_OP(p)                              \
-                    /* ywork = (ytype) Ax [p] */                    \
-                    GB_void ywork [GB_VLA(ysize)] ;                 \
-                    cast_A_to_Y (ywork, Ax +(p)*asize, asize) ;     \
-                    /* Cx [p] = fop (scalarx, ywork) */             \
-                    fop (Cx +((p)*zsize), scalarx, ywork) ;
-                #include "GB_apply_unop_ip.c"
+                if (op->ytype == Atype && Cx != Ax)
+                {
+                    // no typecast is needed and Cx does not alias Ax: apply
+                    // the op directly to Ax, with no per-entry copy
+                    #define GB_APPLY_OP(p)                              \
+                        /* Cx [p] = fop (scalarx, Ax [p]) */            \
+                        fop (Cx +((p)*zsize), scalarx, Ax +(p)*asize) ;
+                    #include "GB_apply_unop_ip.c"
+                }
+                else
+                {
+                    GB_cast_function cast_A_to_Y =
+                        GB_cast_factory (ycode, acode) ;
+                    #define GB_APPLY_OP(p)                              \
+                        /* ywork = (ytype) Ax [p] */                    \
+                        GB_void ywork [GB_VLA(ysize)] ;                 \
+                        cast_A_to_Y (ywork, Ax +(p)*asize, asize) ;     \
+                        /* Cx [p] = fop (scalarx, ywork) */             \
+                        fop (Cx +((p)*zsize), scalarx, ywork) ;
+                    #include "GB_apply_unop_ip.c"
+                }
             }
             else
-            { 
+            {
                 // Cx = binop (Ax,scalar) with bind2nd
-                GB_cast_function cast_A_to_X = GB_cast_factory (xcode, acode) ;
-                #define GB_APPLY_OP(p)                              \
-                    /* xwork = (xtype) Ax [p] */                    \
-                    GB_void xwork [GB_VLA(xsize)] ;                 \
-                    cast_A_to_X (xwork, Ax +(p)*asize, asize) ;     \
-                    /* Cx [p] = fop (xwork, scalarx) */             \
-                    fop (Cx +(p*zsize), xwork, scalarx) ;
-                #include "GB_apply_unop_ip.c"
+                if (op->xtype == Atype && Cx != Ax)
+                {
+                    // no typecast is needed and Cx does not alias Ax: apply
+                    // the op directly to Ax, with no per-entry copy
+                    #define GB_APPLY_OP(p)                              \
+                        /* Cx [p] = fop (Ax [p], scalarx) */            \
+                        fop (Cx +(p*zsize), Ax +(p)*asize, scalarx) ;
+                    #include "GB_apply_unop_ip.c"
+                }
+                else
+                {
+                    GB_cast_function cast_A_to_X =
+                        GB_cast_factory (xcode, acode) ;
+                    #define GB_APPLY_OP(p)                              \
+                        /* xwork = (xtype) Ax [p] */                    \
+                        GB_void xwork [GB_VLA(xsize)] ;                 \
+                        cast_A_to_X (xwork, Ax +(p)*asize, asize) ;     \
+                        /* Cx [p] = fop (xwork, scalarx) */             \
+                        fop (Cx +(p*zsize), xwork, scalarx) ;
+                    #include "GB_apply_unop_ip.c"
+                }
             }
             info = GrB_SUCCESS ;
         }
@@ -686,16 +735,30 @@ GrB_Info GB_apply_op        // apply a unary op, idxunop, or binop, Cx = op (A)
             size_t zsize = op->ztype->size ;
             size_t xsize = op->xtype->size ;
             GB_Type_code xcode = op->xtype->code ;
-            GB_cast_function cast_A_to_X = GB_cast_factory (xcode, acode) ;
-
-            // Cx [p] = op (Ax [p], i, j, ythunk)
-            #define GB_APPLY_OP(p)                                          \
-                int64_t i = GBI_A (Ai, p, avlen) ;                          \
-                GB_void xwork [GB_VLA(xsize)] ;                             \
-                cast_A_to_X (xwork, Ax +(p)*asize, asize) ;                 \
-                fop (Cx +(p*zsize), xwork,                                  \
-                    flipij ? j : i, flipij ? i : j, ythunk) ;
-            #include "GB_apply_unop_ijp.c"
+
+            if (op->xtype == Atype && Cx != Ax)
+            {
+                // no typecast is needed and Cx does not alias Ax: apply the
+                // op directly to Ax, with no per-entry copy into xwork
+                #define GB_APPLY_OP(p)                                      \
+                    int64_t i = GBI_A (Ai, p, avlen) ;                      \
+                    /* Cx [p] = op (Ax [p], i, j, ythunk) */                \
+                    fop (Cx +(p*zsize), Ax +(p)*asize,                      \
+                        flipij ? j : i, flipij ? i : j, ythunk) ;
+                #include "GB_apply_unop_ijp.c"
+            }
+            else
+            {
+                GB_cast_function cast_A_to_X = GB_cast_factory (xcode, acode) ;
+                // Cx [p] = op (Ax [p], i, j, ythunk)
+                #define GB_APPLY_OP(p)                                      \
+                    int64_t i = GBI_A (Ai, p, avlen) ;                      \
+                    GB_void xwork [GB_VLA(xsize)] ;                         \
+                    cast_A_to_X (xwork, Ax +(p)*asize, asize) ;             \
+                    fop (Cx +(p*zsize), xwork,                              \
+                        flipij ? j : i, flipij ? i : j, ythunk) ;
+                #include "GB_apply_unop_ijp.c"
+            }
             info = GrB_SUCCESS ;
         }
     }
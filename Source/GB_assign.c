@@ -87,6 +87,9 @@ GrB_Info GB_assign                  // C<M>(Rows,Cols) += A or A'
     ASSERT_MATRIX_OK (C_in, "C_in for assign", GB0) ;
     int subassign_method ;
 
+    // some subassign methods rewrite the values of C in place
+    GB_fingerprint_clear (C_in) ;
+
     GB_OK (GB_assign_prep (&C, &M, &A, &subassign_method,
         &Cwork, &Mwork, &Awork,
         &Cwork_header, &Mwork_header, &Awork_header, &MT_header, &AT_header,
@@ -108,6 +111,11 @@ GrB_Info GB_assign                  // C<M>(Rows,Cols) += A or A'
         return (GrB_SUCCESS) ;
     }
 
+    // capture a profile record for the assignment proper; the prep above
+    // (transposes, index analysis) is excluded
+    GB_prof_info prof ;
+    GB_prof_start (&prof) ;
+
     //--------------------------------------------------------------------------
     // determine if the final C_replace phase is needed
     //--------------------------------------------------------------------------
@@ -236,7 +244,7 @@ GrB_Info GB_assign                  // C<M>(Rows,Cols) += A or A'
             // if Mask_struct is true then SubMask is extracted as iso
             GB_OK (GB_subref (SubMask, Mask_struct,
                 true, M, I_SubMask, ni_SubMask, J_SubMask, nj_SubMask,
-                false, Werk)) ;
+                false, NULL, Werk)) ;
 
             // GB_subref can return a jumbled result
             ASSERT (GB_JUMBLED_OK (SubMask)) ;
@@ -384,6 +392,11 @@ GrB_Info GB_assign                  // C<M>(Rows,Cols) += A or A'
     ASSERT_MATRIX_OK (C_in, "C to conform", GB0) ;
     GB_OK (GB_conform (C_in, Werk)) ;
     ASSERT_MATRIX_OK (C_in, "Final C for assign", GB0) ;
+    const char *prof_method =
+        (assign_kind == GB_ROW_ASSIGN) ? "row_assign" :
+        (assign_kind == GB_COL_ASSIGN) ? "col_assign" :
+        (assign_kind == GB_SUBASSIGN ) ? "subassign"  : "assign" ;
+    GB_prof_end (&prof, prof_method, C_in, 0, GB_Context_nthreads_max ( )) ;
     GB_FREE_ALL ;
     return (GB_block (C_in, Werk)) ;
 }
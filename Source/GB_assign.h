@@ -11,6 +11,16 @@
 #define GB_ASSIGN_H
 #include "GB.h"
 
+GrB_Info GB_row_assign_splice   // C(i,:) = u, or GrB_NO_VALUE if inapplicable
+(
+    GrB_Matrix C,               // input/output matrix, sparse, held by row
+    const GrB_Index row,        // row index
+    const GrB_Index *Cols,      // column indices; must be GrB_ALL
+    const GrB_Index nCols,      // number of column indices
+    const GrB_Vector u,         // input vector; must be dense
+    GB_Werk Werk
+) ;
+
 GrB_Info GB_assign                  // C<M>(Rows,Cols) += A or A'
 (
     GrB_Matrix C,                   // input/output matrix for results
@@ -27,7 +27,7 @@ void GB_assign_burble
     // quick return if burble is disabled
     //--------------------------------------------------------------------------
 
-    if (!GB_Global_burble_get ( ))
+    if (!GB_Context_burble ( ))
     { 
         return ;
     }
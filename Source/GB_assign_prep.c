@@ -112,6 +112,20 @@ GrB_Info GB_assign_prep
 
     ASSERT_MATRIX_OK (C, "C input for GB_assign_prep", GB0) ;
     ASSERT (!GB_is_shallow (C)) ;
+
+    // assignment may modify the arrays of C in place: apply any deferred
+    // unary op first, and if any array of C is shared with a duplicate or
+    // snapshot, replace it with a private copy
+    info = GB_materialize (C, Werk) ;
+    if (info == GrB_SUCCESS)
+    { 
+        info = GB_unshare (C) ;
+    }
+    if (info != GrB_SUCCESS)
+    { 
+        // out of memory
+        return (info) ;
+    }
     ASSERT_MATRIX_OK_OR_NULL (M, "M for GB_assign_prep", GB0) ;
     ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for GB_assign_prep", GB0) ;
     ASSERT (scode <= GB_UDT_code) ;
@@ -432,25 +446,27 @@ GrB_Info GB_assign_prep
     bool use_bitmap_assign = (C_is_bitmap ||
         ((*C_replace) && GB_IS_FULL (C) && C_may_be_bitmap)) ;
 
-    // an empty mask occurs when M is not present, but complemented
+    // an empty mask occurs when M is not present but complemented, or when
+    // M is present with no entries and not complemented
 
-    if (M == NULL && Mask_comp)
+    if ((M == NULL && Mask_comp) ||
+        (M != NULL && !Mask_comp && GB_NNZ_UPPER_BOUND (M) == 0))
     {
 
         //----------------------------------------------------------------------
         // C<!,replace or !replace>(I,J) = anything
         //----------------------------------------------------------------------
 
-        // The mask M is empty, and complemented, and thus M(i,j)=0 for all i
+        // The mask M is either not present and complemented, or present with
+        // no entries and not complemented.  Either way, M(i,j)=0 for all i
         // and j.  The result does not depend on A or accum.  The output C is
         // either untouched (if C_replace is false) or cleared (if C_replace is
         // true).  However, the GrB_Row_assign and GrB_Col_assign only clear
         // their specific row or column of C, respectively.  GB_subassign only
         // clears C(I,J).  GrB_assign clears all of C.
 
-        // M is NULL so C and M cannot be the same, and A is ignored so
-        // it doesn't matter whether or not C == A.  Thus C is not aliased
-        // to the inputs.
+        // M is not used below (it is either NULL or has no entries), and A
+        // is ignored, so it doesn't matter whether or not C == M or C == A.
 
         // This condition is like GB_RETURN_IF_QUICK_MASK(...), except that
         // the action taken by C_replace is different for row/col assign
@@ -840,7 +856,7 @@ GrB_Info GB_assign_prep
             // Awork = A (Iinv, Jinv)
             GB_CLEAR_STATIC_HEADER (Awork, Awork_header_handle) ;
             GB_OK (GB_subref (Awork, false,  // TODO::: make A if accum is PAIR
-                A->is_csc, A, Iinv, ni, Jinv, nj, false, Werk)) ;
+                A->is_csc, A, Iinv, ni, Jinv, nj, false, NULL, Werk)) ;
             // GB_subref can return a jumbled result
             ASSERT (GB_JUMBLED_OK (Awork)) ;
             if (A == AT)
@@ -857,7 +873,7 @@ GrB_Info GB_assign_prep
             // if Mask_struct then Mwork is extracted as iso
             GB_CLEAR_STATIC_HEADER (Mwork, Mwork_header_handle) ;
             GB_OK (GB_subref (Mwork, Mask_struct,
-                M->is_csc, M, Iinv, ni, Jinv, nj, false, Werk)) ;
+                M->is_csc, M, Iinv, ni, Jinv, nj, false, NULL, Werk)) ;
             // GB_subref can return a jumbled result
             ASSERT (GB_JUMBLED_OK (Mwork)) ;
             if (M == MT)
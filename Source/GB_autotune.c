@@ -0,0 +1,175 @@
+//------------------------------------------------------------------------------
+// GB_autotune.c: online auto-tuner for the chunk parameter
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_nthreads picks the # of threads for a kernel call as work/chunk, with a
+// fixed default chunk of 64K.  On machines with many hardware threads, small
+// operations can then be given far more threads than their run time can
+// amortize, and the fork-join overhead dominates.  When GxB_CHUNK_AUTOTUNE
+// is enabled, the run time of each profiled kernel call (see GB_prof.c) is
+// fed back here, and the chunk of its kernel family is adapted online: a
+// parallel call too brief to amortize the fork-join overhead doubles the
+// chunk of its family, and a long-running call with an adapted chunk halves
+// it back towards the default.  Each adapted chunk is also written back to
+// the Context engaged to the calling user thread, so it persists across
+// calls and can be read back with GxB_Context_get.
+
+#include "GB.h"
+
+//------------------------------------------------------------------------------
+// the auto-tuner state: one adapted chunk per kernel family
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    char name [GxB_PROFILE_METHOD_LEN] ;    // kernel family name
+    double chunk ;                          // adapted chunk of this family
+}
+GB_autotune_entry ;
+
+static GB_autotune_entry GB_autotune_table [GB_AUTOTUNE_MAX] ;
+static int GB_autotune_nfamilies = 0 ;
+
+//------------------------------------------------------------------------------
+// GB_autotune_find: find or add the entry for a kernel family
+//------------------------------------------------------------------------------
+
+// Returns NULL if the family is not in the table and the table is full.
+// Entries are never removed, so a found entry can be used without a lock;
+// only the insertion is done inside the critical section.
+
+static GB_autotune_entry *GB_autotune_find (const char *family)
+{
+    int nfamilies ;
+    GB_ATOMIC_READ
+    nfamilies = GB_autotune_nfamilies ;
+    for (int k = 0 ; k < nfamilies ; k++)
+    {
+        if (strncmp (GB_autotune_table [k].name, family,
+            GxB_PROFILE_METHOD_LEN) == 0)
+        {
+            return (&(GB_autotune_table [k])) ;
+        }
+    }
+
+    // the family is not yet in the table; add it
+    GB_autotune_entry *entry = NULL ;
+    #pragma omp critical(GB_autotune)
+    {
+        // check again, in case another thread just added this family
+        for (int k = 0 ; k < GB_autotune_nfamilies ; k++)
+        {
+            if (strncmp (GB_autotune_table [k].name, family,
+                GxB_PROFILE_METHOD_LEN) == 0)
+            {
+                entry = &(GB_autotune_table [k]) ;
+            }
+        }
+        if (entry == NULL && GB_autotune_nfamilies < GB_AUTOTUNE_MAX)
+        {
+            entry = &(GB_autotune_table [GB_autotune_nfamilies]) ;
+            strncpy (entry->name, family, GxB_PROFILE_METHOD_LEN - 1) ;
+            entry->name [GxB_PROFILE_METHOD_LEN - 1] = '\0' ;
+            entry->chunk = GB_Context_chunk ( ) ;
+            GB_ATOMIC_WRITE
+            GB_autotune_nfamilies++ ;
+        }
+    }
+    return (entry) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_autotune_chunk: chunk to use for one kernel call
+//------------------------------------------------------------------------------
+
+double GB_autotune_chunk    // chunk to use for one kernel call
+(
+    const char *family      // kernel family name (e.g. "saxpy3")
+)
+{
+    double chunk = GB_Context_chunk ( ) ;
+    if (GB_Global_chunk_autotune_get ( ))
+    {
+        GB_autotune_entry *entry = GB_autotune_find (family) ;
+        if (entry != NULL)
+        {
+            double adapted ;
+            GB_ATOMIC_READ
+            adapted = entry->chunk ;
+            chunk = fmax (chunk, adapted) ;
+        }
+    }
+    return (chunk) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_autotune_feedback: adapt the chunk of a family after one call
+//------------------------------------------------------------------------------
+
+void GB_autotune_feedback   // adapt the chunk of a family after one call
+(
+    const char *family,     // kernel family name
+    double time,            // total run time of the call, in seconds
+    int nthreads            // # of threads used by the call
+)
+{
+    if (!GB_Global_chunk_autotune_get ( ))
+    {
+        return ;
+    }
+    GB_autotune_entry *entry = GB_autotune_find (family) ;
+    if (entry == NULL)
+    {
+        // the table is full; this family is not tuned
+        return ;
+    }
+
+    double chunk ;
+    GB_ATOMIC_READ
+    chunk = entry->chunk ;
+
+    if (nthreads > 1 && time < GB_AUTOTUNE_TMIN)
+    {
+        // the call was too brief to amortize its fork-join overhead;
+        // double the chunk, so the next call of this family uses fewer
+        // threads for the same amount of work
+        chunk = fmin (2 * chunk, 1024 * ((double) GB_CHUNK_DEFAULT)) ;
+    }
+    else if (time > GB_AUTOTUNE_TMAX && chunk > GB_CHUNK_DEFAULT)
+    {
+        // the call ran long with an adapted chunk; restore half of the
+        // reduction in parallelism
+        chunk = fmax (chunk / 2, (double) GB_CHUNK_DEFAULT) ;
+    }
+    else
+    {
+        // the chunk of this family is already in balance
+        return ;
+    }
+
+    GB_ATOMIC_WRITE
+    entry->chunk = chunk ;
+
+    // persist the adapted chunk in the Context engaged to this user thread
+    GB_Context_chunk_persist (chunk) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_autotune_finalize: discard all adapted chunks
+//------------------------------------------------------------------------------
+
+// Called by GrB_finalize.
+
+void GB_autotune_finalize (void)
+{
+    #pragma omp critical(GB_autotune)
+    {
+        GB_autotune_nfamilies = 0 ;
+    }
+}
+
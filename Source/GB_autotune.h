@@ -0,0 +1,46 @@
+//------------------------------------------------------------------------------
+// GB_autotune.h: definitions for the online chunk auto-tuner
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The auto-tuner adapts the chunk parameter online, per kernel family, from
+// the measured run time of completed kernel calls (see GxB_CHUNK_AUTOTUNE).
+// GB_nthreads picks the thread count as work/chunk, so raising the chunk of
+// a family whose parallel calls run too briefly to amortize the fork-join
+// overhead reduces its thread counts, and lowering it restores parallelism
+// when calls grow long again.
+
+#ifndef GB_AUTOTUNE_H
+#define GB_AUTOTUNE_H
+
+// max # of kernel families tracked by the auto-tuner
+#define GB_AUTOTUNE_MAX 32
+
+// a parallel call shorter than TMIN cannot amortize its fork-join overhead,
+// so the chunk of its family is doubled; a call longer than TMAX with an
+// adapted chunk restores half of the reduction
+#define GB_AUTOTUNE_TMIN (200e-6)
+#define GB_AUTOTUNE_TMAX (20e-3)
+
+// the adapted chunk stays within [GB_CHUNK_DEFAULT, 1024*GB_CHUNK_DEFAULT]
+
+double GB_autotune_chunk    // chunk to use for one kernel call
+(
+    const char *family      // kernel family name (e.g. "saxpy3")
+) ;
+
+void GB_autotune_feedback   // adapt the chunk of a family after one call
+(
+    const char *family,     // kernel family name
+    double time,            // total run time of the call, in seconds
+    int nthreads            // # of threads used by the call
+) ;
+
+void GB_autotune_finalize (void) ;      // discard all adapted chunks
+
+#endif
+
@@ -87,6 +87,19 @@ bool GB_binop_builtin               // true if binary operator is builtin
         }
     }
 
+    // check for an output type wider than the factory kernels provide
+    if (!op_is_positional
+        && (*zcode) != (*xcode)                 // e.g. GxB_TIMES_FP64_FP32
+        && (*zcode) != GB_BOOL_code             // comparators: z is boolean
+        && (*opcode) != GB_CMPLX_binop_code)    // cmplx: z is complex
+    { 
+        // The factory kernels hard-code the canonical ztype for each
+        // (opcode, xtype) pair.  A widened-output operator such as
+        // GxB_TIMES_FP64_FP32 has no factory counterpart, and must be
+        // computed by the JIT or generic kernels instead.
+        return (false) ;
+    }
+
     //--------------------------------------------------------------------------
     // rename redundant boolean operators
     //--------------------------------------------------------------------------
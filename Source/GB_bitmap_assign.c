@@ -60,6 +60,11 @@ GrB_Info GB_bitmap_assign
     GB_OK (GB_convert_any_to_bitmap (C, Werk)) ;
     ASSERT (GB_IS_BITMAP (C)) ;
 
+    // the assignment modifies the C bitmap in place
+    GB_degree_free (C) ;
+    GB_lookup_cache_free (C) ;
+    GB_fingerprint_clear (C) ;
+
     bool whole_C_matrix = (Ikind == GB_ALL && Jkind == GB_ALL) ;
 
     //--------------------------------------------------------------------------
@@ -88,41 +88,34 @@ GrB_Info GB_bitmap_assign_M_noaccum_whole
         if (C_replace)
         { 
 
-            // Cb [pC] += 2 for each entry M(i,j) in the mask
-            GB_bitmap_M_scatter_whole (C,
-                M, Mask_struct, GB_BITMAP_M_SCATTER_PLUS_2,
-                M_ek_slicing, M_ntasks, M_nthreads) ;
-            // the bitmap of C now contains:
-            //  Cb (i,j) = 0:   cij not present, mij zero
-            //  Cb (i,j) = 1:   cij present, mij zero
-            //  Cb (i,j) = 2:   cij not present, mij 1
-            //  Cb (i,j) = 3:   cij present, mij 1
-
             //------------------------------------------------------------------
-            // C<M,replace> = scalar
+            // C<M,replace> = scalar, mask-first
             //------------------------------------------------------------------
 
+            // assign the scalar at each entry of the mask, marking the
+            // surviving entries with Cb [pC] = 4.  M is not scattered into
+            // Cb, so all value work visits only the entries of M, not all
+            // of Cb.
+
+            #undef  GB_MASK_WORK
+            #define GB_MASK_WORK(pC)                        \
+            {                                               \
+                /* Cx [pC] = scalar */                      \
+                task_cnvals += (Cb [pC] == 0) ;             \
+                GB_COPY_scalar_to_C (Cx, pC, cwork) ;       \
+                Cb [pC] = 4 ;                               \
+            }
+            #include "GB_bitmap_assign_M_all_template.c"
+
+            // clear the bitmap, deleting the entries outside the mask; this
+            // pass does no value work, just the byte-wise clear of Cb that
+            // C_replace requires
             #undef  GB_CIJ_WORK
-            #define GB_CIJ_WORK(pC)                                 \
-            {                                                       \
-                switch (Cb [pC])                                    \
-                {                                                   \
-                    case 1: /* C(i,j) present, M(i,j) = 0 */        \
-                        Cb [pC] = 0 ;                               \
-                        task_cnvals-- ;                             \
-                        break ;                                     \
-                    case 2: /* C(i,j) not present, M(i,j) = 1 */    \
-                        /* Cx [pC] = scalar */                      \
-                        GB_COPY_scalar_to_C (Cx, pC, cwork) ;       \
-                        Cb [pC] = 1 ;                               \
-                        task_cnvals++ ;                             \
-                        break ;                                     \
-                    case 3:  /* C(i,j) present, M(i,j) = 1 */       \
-                        /* Cx [pC] = scalar */                      \
-                        GB_COPY_scalar_to_C (Cx, pC, cwork) ;       \
-                        Cb [pC] = 1 ;                               \
-                    default: ;                                      \
-                }                                                   \
+            #define GB_CIJ_WORK(pC)                 \
+            {                                       \
+                int8_t cb = Cb [pC] ;               \
+                Cb [pC] = (cb == 4) ;               \
+                task_cnvals -= (cb == 1) ;          \
             }
             #include "GB_bitmap_assign_C_whole_template.c"
 
@@ -175,59 +168,37 @@ GrB_Info GB_bitmap_assign_M_noaccum_whole
             { 
 
                 //--------------------------------------------------------------
-                // C<M,replace> = A where A is bitmap or full
+                // C<M,replace> = A where A is bitmap or full, mask-first
                 //--------------------------------------------------------------
 
-                // Cb [pC] += 2 for each entry M(i,j) in the mask
-                GB_bitmap_M_scatter_whole (C,
-                    M, Mask_struct, GB_BITMAP_M_SCATTER_PLUS_2,
-                    M_ek_slicing, M_ntasks, M_nthreads) ;
-                // the bitmap of C now contains:
-                //  Cb (i,j) = 0:   cij not present, mij zero
-                //  Cb (i,j) = 1:   cij present, mij zero
-                //  Cb (i,j) = 2:   cij not present, mij 1
-                //  Cb (i,j) = 3:   cij present, mij 1
+                // assign A at each entry of the mask, marking the surviving
+                // entries with Cb [pC] = 4.  Entries with M(i,j)=1 but no
+                // A(i,j) are not marked, so the clear pass deletes them
+                // along with the entries outside the mask.  M is not
+                // scattered into Cb, so all value work visits only the
+                // entries of M, not all of Cb.
 
-                #undef  GB_CIJ_WORK
-                #define GB_CIJ_WORK(pC)                                       \
+                #undef  GB_MASK_WORK
+                #define GB_MASK_WORK(pC)                                      \
                 {                                                             \
-                    switch (Cb [pC])                                          \
+                    if (GBB (Ab, pC))                                         \
                     {                                                         \
-                        case 1: /* C(i,j) present, M(i,j) = 0 */              \
-                            Cb [pC] = 0 ;                                     \
-                            task_cnvals-- ;                                   \
-                            break ;                                           \
-                        case 2: /* C(i,j) not present, M(i,j) = 1 */          \
-                            if (GBB (Ab, pC))                                 \
-                            {                                                 \
-                                /* Cx [pC] = Ax [pC] */                       \
-                                GB_COPY_aij_to_C (Cx,pC,Ax,pC,A_iso,cwork) ;  \
-                                Cb [pC] = 1 ;                                 \
-                                task_cnvals++ ;                               \
-                            }                                                 \
-                            else                                              \
-                            {                                                 \
-                                /* clear the mask from C */                   \
-                                Cb [pC] = 0 ;                                 \
-                            }                                                 \
-                            break ;                                           \
-                        case 3: /* C(i,j) present, M(i,j) = 1 */              \
-                            if (GBB (Ab, pC))                                 \
-                            {                                                 \
-                                /* Cx [pC] = Ax [pC] */                       \
-                                GB_COPY_aij_to_C (Cx,pC,Ax,pC,A_iso,cwork) ;  \
-                                Cb [pC] = 1 ;                                 \
-                            }                                                 \
-                            else                                              \
-                            {                                                 \
-                                /* delete C(i,j) */                           \
-                                Cb [pC] = 0 ;                                 \
-                                task_cnvals-- ;                               \
-                            }                                                 \
-                            break ;                                           \
-                        default: ;                                            \
+                        /* Cx [pC] = Ax [pC] */                               \
+                        task_cnvals += (Cb [pC] == 0) ;                       \
+                        GB_COPY_aij_to_C (Cx,pC,Ax,pC,A_iso,cwork) ;          \
+                        Cb [pC] = 4 ;                                         \
                     }                                                         \
                 }
+                #include "GB_bitmap_assign_M_all_template.c"
+
+                // clear the bitmap, deleting the entries outside the mask
+                #undef  GB_CIJ_WORK
+                #define GB_CIJ_WORK(pC)                 \
+                {                                       \
+                    int8_t cb = Cb [pC] ;               \
+                    Cb [pC] = (cb == 4) ;               \
+                    task_cnvals -= (cb == 1) ;          \
+                }
                 #include "GB_bitmap_assign_C_whole_template.c"
 
             }
@@ -237,6 +237,95 @@ GrB_Info GB_bitmap_subref       // C = A(I,J): either symbolic or numeric
             memcpy (C->x, cscalar, ctype->size) ;
 
         }
+        else if (Ikind != GB_LIST && Jkind != GB_LIST)
+        {
+
+            //------------------------------------------------------------------
+            // C=A(I,J) non-iso numeric, A and C full, I and J strided
+            //------------------------------------------------------------------
+
+            // I and J are GB_ALL, GB_RANGE, or GB_STRIDE, so the index
+            // arithmetic is a constant stride in each dimension: no task
+            // list and no per-entry GB_ijlist call is needed.  Each vector
+            // of C is one memcpy when the row stride is 1, and a fixed-
+            // stride gather otherwise, which vectorizes for the common
+            // type sizes.
+
+            const GB_void *restrict Ax = (GB_void *) A->x ;
+                  GB_void *restrict Cx = (GB_void *) C->x ;
+
+            int64_t Ibegin = (Ikind == GB_ALL) ? 0 : Icolon [GxB_BEGIN] ;
+            int64_t Iinc   = (Ikind == GB_STRIDE) ? Icolon [GxB_INC] : 1 ;
+            int64_t Jbegin = (Jkind == GB_ALL) ? 0 : Jcolon [GxB_BEGIN] ;
+            int64_t Jinc   = (Jkind == GB_STRIDE) ? Jcolon [GxB_INC] : 1 ;
+
+            int nthreads_max = GB_Context_nthreads_max ( ) ;
+            double chunk = GB_Context_chunk ( ) ;
+            int nth = GB_nthreads (cnzmax, chunk, nthreads_max) ;
+
+            int64_t kJ ;
+            #pragma omp parallel for num_threads(nth) schedule(static)
+            for (kJ = 0 ; kJ < nJ ; kJ++)
+            {
+                int64_t jA = Jbegin + kJ * Jinc ;
+                const GB_void *restrict Aj = Ax + (jA * avlen) * asize ;
+                      GB_void *restrict Cj = Cx + (kJ * nI) * asize ;
+                if (Iinc == 1)
+                { 
+                    // C(:,kJ) is one contiguous slice of A(:,jA)
+                    memcpy (Cj, Aj + Ibegin * asize, nI * asize) ;
+                }
+                else if (asize == sizeof (uint64_t))
+                {
+                    // gather with a fixed stride, 8-byte entries
+                    const uint64_t *restrict Aj8 = (const uint64_t *) Aj ;
+                          uint64_t *restrict Cj8 = (uint64_t *) Cj ;
+                    for (int64_t kI = 0 ; kI < nI ; kI++)
+                    { 
+                        Cj8 [kI] = Aj8 [Ibegin + kI * Iinc] ;
+                    }
+                }
+                else if (asize == sizeof (uint32_t))
+                {
+                    // gather with a fixed stride, 4-byte entries
+                    const uint32_t *restrict Aj4 = (const uint32_t *) Aj ;
+                          uint32_t *restrict Cj4 = (uint32_t *) Cj ;
+                    for (int64_t kI = 0 ; kI < nI ; kI++)
+                    { 
+                        Cj4 [kI] = Aj4 [Ibegin + kI * Iinc] ;
+                    }
+                }
+                else if (asize == sizeof (uint16_t))
+                {
+                    // gather with a fixed stride, 2-byte entries
+                    const uint16_t *restrict Aj2 = (const uint16_t *) Aj ;
+                          uint16_t *restrict Cj2 = (uint16_t *) Cj ;
+                    for (int64_t kI = 0 ; kI < nI ; kI++)
+                    {
+                        Cj2 [kI] = Aj2 [Ibegin + kI * Iinc] ;
+                    }
+                }
+                else if (asize == sizeof (uint8_t))
+                {
+                    // gather with a fixed stride, 1-byte entries
+                    const uint8_t *restrict Aj1 = (const uint8_t *) Aj ;
+                          uint8_t *restrict Cj1 = (uint8_t *) Cj ;
+                    for (int64_t kI = 0 ; kI < nI ; kI++)
+                    { 
+                        Cj1 [kI] = Aj1 [Ibegin + kI * Iinc] ;
+                    }
+                }
+                else
+                {
+                    // gather with a fixed stride, any other type size
+                    for (int64_t kI = 0 ; kI < nI ; kI++)
+                    { 
+                        memcpy (Cj + kI * asize,
+                            Aj + (Ibegin + kI * Iinc) * asize, asize) ;
+                    }
+                }
+            }
+        }
         else
         { 
 
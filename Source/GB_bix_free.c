@@ -75,5 +75,13 @@ void GB_bix_free                // free A->b, A->i, and A->x of a matrix
 
     // free the list of pending tuples
     GB_Pending_free (&(A->Pending)) ;
+
+    // the pattern is gone, so the cached row degrees are invalid
+    GB_degree_free (A) ;
+    GB_lookup_cache_free (A) ;
+    GB_fingerprint_clear (A) ;
+
+    // the values are gone, so any deferred unary op is moot
+    A->deferred_unop = NULL ;
 }
 
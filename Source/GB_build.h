@@ -25,6 +25,44 @@ GrB_Info GB_build               // build matrix
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_build_sorted        // build matrix from sorted unique tuples
+(
+    GrB_Matrix C,               // matrix to build
+    const GrB_Index *I,         // row indices of tuples
+    const GrB_Index *J,         // col indices of tuples (NULL for vector)
+    const void *X,              // values
+    const GrB_Index nvals,      // number of tuples
+    const GrB_Type xtype,       // type of X array
+    const bool is_matrix,       // true if C is a matrix, false if GrB_Vector
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_random              // create a random matrix or vector
+(
+    GrB_Matrix *A_handle,       // handle of matrix to create
+    GrB_Type type,              // type of matrix to create
+    GrB_Index nrows,            // number of rows
+    GrB_Index ncols,            // number of columns
+    GrB_Index nvals,            // # of tuples to generate, before duplicates
+    int method,                 // GxB_RANDOM_UNIFORM or GxB_RANDOM_RMAT
+    uint64_t seed,              // RNG seed
+    bool is_matrix,             // true if a matrix, false if a GrB_Vector
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_append              // append a batch of tuples to a matrix
+(
+    GrB_Matrix C,               // matrix to append to
+    const GrB_Index *I,         // row indices of tuples
+    const GrB_Index *J,         // col indices of tuples (NULL for vector)
+    const void *X,              // values
+    const GrB_Index nvals,      // number of tuples
+    const GrB_BinaryOp dup,     // binary op to assemble duplicates at wait
+    const GrB_Type xtype,       // type of X array
+    const bool is_matrix,       // true if C is a matrix, false if GrB_Vector
+    GB_Werk Werk
+) ;
+
 GrB_Info GB_builder                 // build a matrix from tuples
 (
     GrB_Matrix T,                   // matrix to build, static or dynamic header
@@ -0,0 +1,260 @@
+//------------------------------------------------------------------------------
+// GB_build_sorted: build a matrix from sorted, duplicate-free tuples
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// CALLED BY: GxB_Matrix_build_Sorted
+// CALLS:     GB_builder
+
+// Identical in result to GB_build with a NULL dup operator, but the caller
+// guarantees that the tuples are already sorted (by column and then row for a
+// CSC matrix, by row and then column for CSR), with no duplicates.  The
+// guarantee lets GB_builder run with known_sorted and known_no_duplicates
+// both true: the sortedness-detection scan, the GB_msort_* sort, and the
+// duplicate assembly are all skipped, and the matrix is assembled with a
+// single parallel pass over the tuples plus a cumulative sum.
+
+// The indices are still checked against the matrix dimensions, since that
+// check is fused into the pass that copies them.  The sorted/unique guarantee
+// itself is trusted: if the caller breaks it the result is undefined (the
+// order is verified with a full scan when GraphBLAS is compiled for
+// debugging).
+
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE (&I_work, I_work_size) ;            \
+    GB_FREE (&J_work, J_work_size) ;            \
+    GrB_Matrix_free (&T) ;                      \
+}
+
+#include "GB_build.h"
+
+GrB_Info GB_build_sorted        // build matrix from sorted unique tuples
+(
+    GrB_Matrix C,               // matrix to build
+    const GrB_Index *I,         // row indices of tuples
+    const GrB_Index *J,         // col indices of tuples (NULL for vector)
+    const void *X,              // values
+    const GrB_Index nvals,      // number of tuples
+    const GrB_Type xtype,       // type of X array
+    const bool is_matrix,       // true if C is a matrix, false if GrB_Vector
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (C != NULL) ;
+    int64_t *I_work = NULL ; size_t I_work_size = 0 ;
+    int64_t *J_work = NULL ; size_t J_work_size = 0 ;
+    GrB_Matrix T = NULL ;
+
+    if (GB_nnz (C) > 0 || GB_PENDING (C))
+    {
+        // The matrix has existing entries, per the GraphBLAS API spec for
+        // GrB_Matrix_build; see GB_build.
+        GB_ERROR (GrB_OUTPUT_NOT_EMPTY,
+            "Output already has %s", "existing entries") ;
+    }
+
+    GB_RETURN_IF_NULL (I) ;
+    if (I == GrB_ALL)
+    {
+        GB_ERROR (GrB_INVALID_VALUE, "Row indices cannot be %s", "GrB_ALL") ;
+    }
+
+    if (is_matrix)
+    {
+        GB_RETURN_IF_NULL (J) ;
+        if (J == GrB_ALL)
+        {
+            GB_ERROR (GrB_INVALID_VALUE, "Column indices cannot be %s",
+                "GrB_ALL") ;
+        }
+    }
+    else
+    {
+        // only GxB_Vector_build_Sorted calls this function with J == NULL
+        ASSERT (J == NULL) ;
+    }
+
+    GB_RETURN_IF_NULL (X) ;
+
+    if (nvals > GB_NMAX)
+    {
+        // problem too large
+        GB_ERROR (GrB_INVALID_VALUE, "Problem too large: nvals " GBu
+            " exceeds " GBu, nvals, GB_NMAX) ;
+    }
+
+    // C and X must be compatible
+    if (!GB_Type_compatible (xtype, C->type))
+    {
+        GB_ERROR (GrB_DOMAIN_MISMATCH,
+            "Value(s) of type [%s] cannot be typecast to matrix of type"
+            " [%s]\n", xtype->name, C->type->name) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // copy the indices, checking them against the matrix dimensions
+    //--------------------------------------------------------------------------
+
+    // The (row,col) tuples are mapped to (vector,index) according to the
+    // format of C, just as in GB_build.
+
+    int64_t vlen = C->vlen ;
+    int64_t vdim = C->vdim ;
+    const int64_t *restrict I_in = (int64_t *) ((C->is_csc) ? I : J) ;
+    const int64_t *restrict J_in = (int64_t *) ((C->is_csc) ? J : I) ;
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (nvals, chunk, nthreads_max) ;
+
+    I_work = GB_MALLOC (nvals, int64_t, &I_work_size) ;
+    if (vdim > 1)
+    {
+        J_work = GB_MALLOC (nvals, int64_t, &J_work_size) ;
+    }
+    if (I_work == NULL || (vdim > 1 && J_work == NULL))
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    bool ok = true ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(&&:ok)
+    for (k = 0 ; k < ((int64_t) nvals) ; k++)
+    {
+        // unlike GB_builder, no sortedness or duplicate detection is fused
+        // into this pass: just the bounds check and the copy
+        int64_t i = I_in [k] ;
+        ok = ok && (i >= 0 && i < vlen) ;
+        I_work [k] = i ;
+        if (vdim > 1)
+        {
+            int64_t j = J_in [k] ;
+            ok = ok && (j >= 0 && j < vdim) ;
+            J_work [k] = j ;
+        }
+    }
+
+    if (!ok)
+    {
+        // scan again to report the first bad index
+        for (k = 0 ; k < ((int64_t) nvals) ; k++)
+        {
+            int64_t i = I_work [k] ;
+            int64_t j = (vdim > 1) ? J_work [k] : 0 ;
+            if (i < 0 || i >= vlen || j < 0 || j >= vdim)
+            {
+                int64_t row = C->is_csc ? i : j ;
+                int64_t col = C->is_csc ? j : i ;
+                int64_t nrows = C->is_csc ? vlen : vdim ;
+                int64_t ncols = C->is_csc ? vdim : vlen ;
+                GB_FREE_ALL ;
+                GB_ERROR (GrB_INDEX_OUT_OF_BOUNDS,
+                    "index (" GBd "," GBd ") out of bounds,"
+                    " must be < (" GBd ", " GBd ")",
+                    row, col, nrows, ncols) ;
+            }
+        }
+    }
+
+    #ifdef GB_DEBUG
+    {
+        // assert that the tuples are sorted with no duplicates
+        int64_t ilast = -1, jlast = -1 ;
+        for (int64_t t = 0 ; t < ((int64_t) nvals) ; t++)
+        {
+            int64_t i = I_work [t] ;
+            int64_t j = (J_work == NULL) ? 0 : J_work [t] ;
+            ASSERT ((jlast < j) || (jlast == j && ilast < i)) ;
+            ilast = i ; jlast = j ;
+        }
+    }
+    #endif
+
+    //--------------------------------------------------------------------------
+    // free all content of C
+    //--------------------------------------------------------------------------
+
+    // the type, dimensions, hyper_switch, bitmap_switch and sparsity control
+    // are still preserved in C.
+    GB_phybix_free (C) ;
+
+    //--------------------------------------------------------------------------
+    // build the matrix T, trusting the sorted and duplicate-free guarantee
+    //--------------------------------------------------------------------------
+
+    // X must be treated as read-only, so GB_builder is not allowed to
+    // transplant it into T->x.  I_work is transplanted into T->i.
+
+    GB_void *no_X_work = NULL ; size_t X_work_size = 0 ;
+    struct GB_Matrix_opaque T_header ;
+    GB_CLEAR_STATIC_HEADER (T, &T_header) ;
+
+    GB_OK (GB_builder (
+        T,              // create T using a static header
+        xtype,          // the type of T
+        C->vlen,        // T->vlen = C->vlen
+        C->vdim,        // T->vdim = C->vdim
+        C->is_csc,      // T has the same CSR/CSC format as C
+        &I_work,        // indices, already valid; transplanted into T->i
+        &I_work_size,
+        &J_work,        // vector indices, or NULL if vdim <= 1
+        &J_work_size,
+        &no_X_work,     // X_work_handle, not used here
+        &X_work_size,
+        true,           // known_sorted: guaranteed by the caller
+        true,           // known_no_duplicates: guaranteed by the caller
+        nvals,          // size of I_work and J_work
+        is_matrix,      // true if T is a GrB_Matrix
+        NULL,           // I_input: not used (I_work instead)
+        NULL,           // J_input: not used (J_work instead)
+        (const GB_void *) X,                // values, size nvals
+        false,          // X is not iso
+        nvals,          // number of tuples
+        NULL,           // no dup operator: no duplicates to assemble
+        xtype,          // type of the X array
+        true,           // burble is OK
+        Werk
+    )) ;
+
+    // GB_builder always frees J_work, and either frees I_work or transplants
+    // it in to T->i
+    ASSERT (I_work == NULL && J_work == NULL) ;
+
+    //--------------------------------------------------------------------------
+    // determine if T is iso
+    //--------------------------------------------------------------------------
+
+    if (GB_check_if_iso (T))
+    {
+        // All entries in T are the same; convert T to iso
+        GBURBLE ("(post iso) ") ;
+        T->iso = true ;
+        GB_OK (GB_convert_any_to_iso (T, NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // transplant and typecast T into C, conform C, and free T
+    //--------------------------------------------------------------------------
+
+    ASSERT (GB_IS_HYPERSPARSE (T)) ;
+    ASSERT (!GB_ZOMBIES (T)) ;
+    ASSERT (!GB_JUMBLED (T)) ;
+    ASSERT (!GB_PENDING (T)) ;
+    return (GB_transplant_conform (C, C->type, &T, Werk)) ;
+}
+
@@ -561,6 +561,13 @@ GrB_Info GB_builder                 // build a matrix from tuples
         // sort all the tuples
         //----------------------------------------------------------------------
 
+        if (GB_Context_cancelled ( ))
+        { 
+            // cancellation requested via the engaged Context
+            GB_FREE_WORKSPACE ;
+            return (GxB_CANCELLED) ;
+        }
+
         if (vdim > 1)
         {
 
@@ -568,7 +575,16 @@ GrB_Info GB_builder                 // build a matrix from tuples
             // sort a set of (j,i,k) tuples
             //------------------------------------------------------------------
 
-            if (S_iso)
+            if (GB_radix_sort_worthwhile (nvals, vdim, vlen))
+            {
+                // sort on the (j,i) keys with an LSD radix sort; K_work, if
+                // present, is carried along as the payload.  The radix sort
+                // is stable and K_work is strictly ascending on input, so
+                // the result matches the mergesort of (j,i,k) tuples.
+                info = GB_radix_sort (J_work, I_work, S_iso ? NULL : K_work,
+                    true, nvals, vdim, vlen, nthreads) ;
+            }
+            else if (S_iso)
             { 
                 // K_work is NULL; only sort (j,i)
                 info = GB_msort_2 (J_work, I_work, nvals, nthreads) ;
@@ -602,7 +618,14 @@ GrB_Info GB_builder                 // build a matrix from tuples
             // sort a set of (i,k) tuples
             //------------------------------------------------------------------
 
-            if (S_iso)
+            if (GB_radix_sort_worthwhile (nvals, vlen, 1))
+            {
+                // sort on the (i) keys with an LSD radix sort; K_work, if
+                // present, is carried along as the payload
+                info = GB_radix_sort (I_work, S_iso ? NULL : K_work, NULL,
+                    false, nvals, vlen, 1, nthreads) ;
+            }
+            else if (S_iso)
             { 
                 // K_work is NULL; only sort (i)
                 info = GB_msort_1 (I_work, nvals, nthreads) ;
@@ -632,6 +655,14 @@ GrB_Info GB_builder                 // build a matrix from tuples
             GB_FREE_WORKSPACE ;
             return (GrB_OUT_OF_MEMORY) ;
         }
+
+        if (GB_Context_cancelled ( ))
+        { 
+            // cancellation requested via the engaged Context
+            GB_FREE_WORKSPACE ;
+            return (GxB_CANCELLED) ;
+        }
+
     }
 
     //--------------------------------------------------------------------------
@@ -126,6 +126,15 @@ void *GB_calloc_memory      // pointer to allocated block of memory
 
     (*size_allocated) = (p == NULL) ? 0 : size ;
     ASSERT (GB_IMPLIES (p != NULL, size == GB_Global_memtable_size (p))) ;
+    if (p != NULL)
+    {
+        GB_Global_memory_in_use_adjust ((int64_t) size) ;
+        if (GB_Global_profiling_get ( ))
+        {
+            GB_Global_profile_bytes_adjust ((int64_t) size) ;
+            GB_prof_memory ((int64_t) size) ;
+        }
+    }
     return (p) ;
 }
 
@@ -92,15 +92,27 @@ GrB_Info GB_clear           // clear a matrix, type and dimensions unchanged
         int64_t plen = A->vdim ;
         A->nvec = plen ;
         A->plen = plen ;
-        A->p = GB_MALLOC (plen+1, int64_t, &(A->p_size)) ;
         ASSERT (A->h == NULL) ;
-        if (A->p == NULL)
+        if (plen == 1)
         { 
-            // out of memory
-            GB_phybix_free (A) ;
-            return (GrB_OUT_OF_MEMORY) ;
+            // a single sparse vector: its vector pointers are resident in the
+            // header, so clearing it allocates nothing
+            A->p = A->p_static ;
+            A->p [0] = 0 ;
+            A->p [1] = 0 ;
+            A->p_size = sizeof (A->p_static) ;
+        }
+        else
+        {
+            A->p = GB_MALLOC (plen+1, int64_t, &(A->p_size)) ;
+            if (A->p == NULL)
+            { 
+                // out of memory
+                GB_phybix_free (A) ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+            GB_memset (A->p, 0, (plen+1) * sizeof (int64_t), nthreads_max) ;
         }
-        GB_memset (A->p, 0, (plen+1) * sizeof (int64_t), nthreads_max) ;
 
     }
     else
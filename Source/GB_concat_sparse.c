@@ -316,6 +316,32 @@ GrB_Info GB_concat_sparse           // concatenate into a sparse matrix
             const int64_t *restrict Ah = A->h ;
             const int64_t *restrict Ai = A->i ;
             const bool A_iso = A->iso ;
+
+            //------------------------------------------------------------------
+            // quick path: the tile spans whole vectors of C
+            //------------------------------------------------------------------
+
+            // If C has a single tile in the inner direction (ninner == 1; a
+            // vertical concat of CSR tiles, or a horizontal concat of CSC
+            // tiles), then each vector of A becomes a whole vector of C: the
+            // indices need no shift, and the entries of A land in C in one
+            // contiguous block starting at Cp [cvstart].  If no typecast or
+            // iso expansion is needed either, the tile is copied with two
+            // parallel memcpys instead of the per-entry kernels below.
+
+            if (ninner == 1 && !C_iso && !A_iso && acode == ccode &&
+                !GB_IS_FULL (A))
+            { 
+                ASSERT (cistart == 0) ;
+                int64_t anz = GB_nnz (A) ;
+                int64_t pC = Cp [cvstart] ;
+                int nth2 = GB_nthreads (anz, chunk, nthreads_max) ;
+                GB_memcpy (Ci + pC, Ai, anz * sizeof (int64_t), nth2) ;
+                GB_memcpy ((GB_void *) C->x + pC * csize, A->x, anz * csize,
+                    nth2) ;
+                continue ;
+            }
+
             GB_SLICE_MATRIX (A, 1) ;
 
             //------------------------------------------------------------------
@@ -30,14 +30,14 @@ static inline GrB_Info GB_conform_hyper_or_bitmap
 {
     GrB_Info info ;
     if (is_full || ((is_hyper || is_sparse) &&
-        GB_convert_s2b_test (A->bitmap_switch,
+        GB_convert_s2b_test (A->bitmap_switch, A->s2b_thrash,
             GB_nnz (A), A->vlen, A->vdim)))
     { 
         // if full or sparse/hypersparse with many entries: to bitmap
         GB_OK (GB_convert_any_to_bitmap (A, Werk)) ;
     }
     else if (is_sparse || (is_bitmap &&
-        GB_convert_bitmap_to_sparse_test (A->bitmap_switch,
+        GB_convert_bitmap_to_sparse_test (A->bitmap_switch, A->s2b_thrash,
             GB_nnz (A), A->vlen, A->vdim)))
     { 
         // if sparse or bitmap with few entries: to hypersparse
@@ -58,14 +58,14 @@ static inline GrB_Info GB_conform_sparse_or_bitmap
 {
     GrB_Info info ;
     if (is_full || ((is_hyper || is_sparse) &&
-        GB_convert_s2b_test (A->bitmap_switch,
+        GB_convert_s2b_test (A->bitmap_switch, A->s2b_thrash,
             GB_nnz (A), A->vlen, A->vdim)))
     { 
         // if full or sparse/hypersparse with many entries: to bitmap
         GB_OK (GB_convert_any_to_bitmap (A, Werk)) ;
     }
     else if (is_hyper || (is_bitmap &&
-        GB_convert_bitmap_to_sparse_test (A->bitmap_switch,
+        GB_convert_bitmap_to_sparse_test (A->bitmap_switch, A->s2b_thrash,
             GB_nnz (A), A->vlen, A->vdim)))
     { 
         // if hypersparse or bitmap with few entries: to sparse
@@ -86,7 +86,7 @@ static inline GrB_Info GB_conform_hyper_sparse_or_bitmap
 {
     GrB_Info info ;
     if (is_full || ((is_hyper || is_sparse) &&
-        GB_convert_s2b_test (A->bitmap_switch,
+        GB_convert_s2b_test (A->bitmap_switch, A->s2b_thrash,
             GB_nnz (A), A->vlen, A->vdim)))
     { 
         // if full or sparse/hypersparse with many entries: to bitmap
@@ -94,7 +94,7 @@ static inline GrB_Info GB_conform_hyper_sparse_or_bitmap
     }
     else if (is_bitmap)
     {
-        if (GB_convert_bitmap_to_sparse_test (A->bitmap_switch,
+        if (GB_convert_bitmap_to_sparse_test (A->bitmap_switch, A->s2b_thrash,
             GB_nnz (A), A->vlen, A->vdim))
         { 
             // if bitmap with few entries: to sparse
@@ -15,6 +15,14 @@
 #define GB_ALWAYS_HYPER (1.0)
 #define GB_NEVER_HYPER  (-1.0)
 
+// A matrix with vdim larger than this limit always stays hypersparse.  The
+// sparse format requires a vector pointer array Ap of size vdim+1, and with
+// vdim of 2^36 or more that single array would require 512 GB or more,
+// regardless of the number of entries in the matrix.  The hyper_hash A->Y
+// provides O(1) vector lookup for hypersparse matrices, so nothing is lost
+// by never converting such a matrix to sparse.
+#define GB_HYPER_VDIM_LIMIT (((int64_t) 1) << 36)
+
 // determine the sparsity_control for a matrix
 int GB_sparsity_control     // revised sparsity_control
 (
@@ -77,6 +85,7 @@ bool GB_convert_sparse_to_hyper_test  // test sparse to hypersparse conversion
 bool GB_convert_bitmap_to_sparse_test    // test for hyper/sparse to bitmap
 (
     float bitmap_switch,    // A->bitmap_switch
+    int32_t s2b_thrash,     // A->s2b_thrash, or 0 for a matrix with no history
     int64_t anz,            // # of entries in A = GB_nnz (A)
     int64_t vlen,           // A->vlen
     int64_t vdim            // A->vdim
@@ -85,6 +94,7 @@ bool GB_convert_bitmap_to_sparse_test    // test for hyper/sparse to bitmap
 bool GB_convert_s2b_test    // test for hyper/sparse to bitmap
 (
     float bitmap_switch,    // A->bitmap_switch
+    int32_t s2b_thrash,     // A->s2b_thrash, or 0 for a matrix with no history
     int64_t anz,            // # of entries in A = GB_nnz (A)
     int64_t vlen,           // A->vlen
     int64_t vdim            // A->vdim
@@ -118,9 +128,11 @@ GrB_Info GB_convert_bitmap_worker   // extract CSC/CSR or triplets from bitmap
     int64_t *restrict Ap,        // vector pointers for CSC/CSR form
     int64_t *restrict Ai,        // indices for CSC/CSR or triplet form
     int64_t *restrict Aj,        // vector indices for triplet form
-    GB_void *restrict Ax_new,    // values for CSC/CSR or triplet form
+    GB_void *restrict Ax_new,    // values for CSC/CSR or triplet form,
+                                    // in the type given by ccode
     int64_t *anvec_nonempty,        // # of non-empty vectors
     // inputs: not modified
+    const GB_Type_code ccode,       // type code of Ax_new
     const GrB_Matrix A,             // matrix to extract; not modified
     GB_Werk Werk
 ) ;
@@ -264,5 +276,11 @@ GrB_Matrix GB_hyper_shallow         // return C
     const GrB_Matrix A              // input matrix
 ) ;
 
+GrB_Matrix GB_full_shallow          // return C
+(
+    GrB_Matrix C,                   // output full matrix
+    const GrB_Matrix A              // input all-entry matrix, not modified
+) ;
+
 #endif
 
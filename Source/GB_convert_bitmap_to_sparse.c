@@ -11,6 +11,7 @@
 
 #define GB_FREE_ALL                     \
 {                                       \
+    GB_WERK_POP (Tcnt, int64_t) ;       \
     GB_FREE (&Ap, Ap_size) ;            \
     GB_FREE (&Ai, Ai_size) ;            \
     GB_FREE (&Ax, Ax_size) ;            \
@@ -46,10 +47,12 @@ GrB_Info GB_convert_bitmap_to_sparse    // convert matrix from bitmap to sparse
     const int64_t anzmax = GB_IMAX (anvals, 1) ;
     int64_t anvec_nonempty ;
     const int64_t avdim = A->vdim ;
+    const int64_t avlen = A->vlen ;
     const size_t asize = A->type->size ;
     int64_t *restrict Ap = NULL ; size_t Ap_size = 0 ;
     int64_t *restrict Ai = NULL ; size_t Ai_size = 0 ;
     GB_void *restrict Ax = NULL ; size_t Ax_size = 0 ;
+    GB_WERK_DECLARE (Tcnt, int64_t) ;
     Ap = GB_MALLOC (avdim+1, int64_t, &Ap_size) ; 
     Ai = GB_MALLOC (anzmax, int64_t, &Ai_size) ;
     if (Ap == NULL || Ai == NULL)
@@ -61,6 +64,15 @@ GrB_Info GB_convert_bitmap_to_sparse    // convert matrix from bitmap to sparse
 
     bool Ax_shallow ;
     const bool A_iso = A->iso ;
+    bool in_place = false ;
+
+    // the GPU gathers into a freshly allocated Ax, so when it is to be used
+    // the in-place compaction below is skipped
+    bool use_b2s_cuda = false ;
+    #if defined ( GRAPHBLAS_HAS_CUDA )
+    use_b2s_cuda = GB_convert_b2s_cuda_branch (A) ;
+    #endif
+    int nthreads = 1, ntasks = 1 ;
     if (A_iso)
     { 
         // A is iso.  Remove A->x from the matrix so it is not freed by
@@ -71,10 +83,40 @@ GrB_Info GB_convert_bitmap_to_sparse    // convert matrix from bitmap to sparse
         Ax_size = A->x_size ;
         A->x = NULL ;
     }
+    else if (!A->x_shallow && !GB_share_shared (A->x) && !use_b2s_cuda)
+    {
+        // A is not iso and it owns its values exclusively: not shallow, and
+        // not co-owned by a snapshot or sharing duplicate.  The sparse values
+        // always fit at the front of the existing A->x, so it is compacted in
+        // place below instead of gathering into a freshly allocated array.
+        // This avoids a transient spike of another anzmax*asize bytes of
+        // memory, which matters most when a large matrix drops just below the
+        // bitmap-to-sparse threshold.  Remove A->x from the matrix so it is
+        // not freed by GB_phybix_free; it is transplanted back into A, below.
+        in_place = true ;
+        Ax = (GB_void *) A->x ;
+        Ax_shallow = false ;
+        Ax_size = A->x_size ;
+        A->x = NULL ;
+        // determine the tasks for the in-place compaction of Ax
+        int nthreads_max = GB_Context_nthreads_max ( ) ;
+        double chunk = GB_Context_chunk ( ) ;
+        nthreads = GB_nthreads (avlen*avdim, chunk, nthreads_max) ;
+        ntasks = (nthreads == 1) ? 1 : (8 * nthreads) ;
+        ntasks = (int) GB_IMIN (ntasks, GB_IMAX (avlen*avdim, 1)) ;
+        GB_WERK_PUSH (Tcnt, ntasks+1, int64_t) ;
+        if (Tcnt == NULL)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+    }
     else
     {
-        // A is not iso.  Allocate new space for Ax, which is filled by
-        // GB_convert_bitmap_worker.
+        // A has shallow or shared values, or the GPU gather is to be used.
+        // Allocate new space for Ax, which is filled
+        // by GB_convert_bitmap_worker.
         Ax = GB_MALLOC (anzmax * asize, GB_void, &Ax_size) ;    // x:OK
         Ax_shallow = false ;
         if (Ax == NULL)
@@ -89,9 +131,91 @@ GrB_Info GB_convert_bitmap_to_sparse    // convert matrix from bitmap to sparse
     // convert to sparse format (Ap, Ai, and Ax)
     //--------------------------------------------------------------------------
 
-    // the values are not converted if A is iso
-    GB_OK (GB_convert_bitmap_worker (Ap, Ai, NULL, (A_iso) ? NULL : Ax,
-        &anvec_nonempty, A, Werk)) ;
+    // the values are not converted if A is iso or compacted in place
+    info = GrB_NO_VALUE ;
+
+    #if defined ( GRAPHBLAS_HAS_CUDA )
+    if (use_b2s_cuda)
+    { 
+        info = GB_convert_b2s_cuda (Ap, Ai,
+            (A_iso || in_place) ? NULL : Ax, &anvec_nonempty, A) ;
+    }
+    #endif
+
+    if (info == GrB_NO_VALUE)
+    { 
+        info = GB_convert_bitmap_worker (Ap, Ai, NULL,
+            (A_iso || in_place) ? NULL : Ax,
+            &anvec_nonempty, A->type->code, A, Werk) ;
+    }
+    GB_OK (info) ;
+
+    //--------------------------------------------------------------------------
+    // compact the values in place
+    //--------------------------------------------------------------------------
+
+    if (in_place)
+    {
+
+        // Each task compacts the entries of its own slice of Ax to the front
+        // of that slice.  This is safe in parallel: a task writes only into
+        // its own slice, and within a slice each entry moves down, never up.
+
+        const int8_t *restrict Ab = A->b ;
+        const int64_t n = avlen * avdim ;
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < ntasks ; tid++)
+        {
+            int64_t pstart, pend, my_cnt = 0 ;
+            GB_PARTITION (pstart, pend, n, tid, ntasks) ;
+            for (int64_t p = pstart ; p < pend ; p++)
+            {
+                if (Ab [p])
+                {
+                    // A(i,j) is in the bitmap; move its value down
+                    if (pstart + my_cnt != p)
+                    { 
+                        memcpy (Ax + (pstart + my_cnt) * asize,
+                            Ax + p * asize, asize) ;
+                    }
+                    my_cnt++ ;
+                }
+            }
+            Tcnt [tid] = my_cnt ;
+        }
+
+        // Tcnt [tid] = where the block of task tid starts in the final Ax
+        int64_t c = 0 ;
+        for (int tid = 0 ; tid < ntasks ; tid++)
+        { 
+            int64_t len = Tcnt [tid] ;
+            Tcnt [tid] = c ;
+            c += len ;
+        }
+        Tcnt [ntasks] = c ;
+        ASSERT (c == anvals) ;
+
+        // Shift each compacted block down to its final position.  The shifts
+        // must be done in task order and cannot be done in parallel: the
+        // target region of a block can overlap the source block of an earlier
+        // task that has not yet moved.  Each shift is a single overlap-safe
+        // memmove, so this pass moves at most anvals*asize bytes in all.
+
+        for (int tid = 0 ; tid < ntasks ; tid++)
+        {
+            int64_t pstart, pend ;
+            GB_PARTITION (pstart, pend, n, tid, ntasks) ;
+            int64_t len = Tcnt [tid+1] - Tcnt [tid] ;
+            if (len > 0 && Tcnt [tid] != pstart)
+            { 
+                memmove (Ax + Tcnt [tid] * asize,
+                    Ax + pstart * asize, len * asize) ;
+            }
+        }
+
+        GB_WERK_POP (Tcnt, int64_t) ;
+    }
 
     //--------------------------------------------------------------------------
     // free prior content of A and transplant the new content
@@ -109,6 +233,11 @@ GrB_Info GB_convert_bitmap_to_sparse    // convert matrix from bitmap to sparse
     A->nvec_nonempty = anvec_nonempty ;
     A->magic = GB_MAGIC ;
 
+    // record the conversion for the GB_conform hysteresis rule
+    A->s2b_thrash = (A->s2b_last == 1) ? GB_IMIN (A->s2b_thrash + 1, 3) : 0 ;
+    A->s2b_last = -1 ;
+    A->conv_from_bitmap++ ;
+
     //--------------------------------------------------------------------------
     // return result
     //--------------------------------------------------------------------------
@@ -13,7 +13,11 @@
 // If A is m-by-n and A->sparsity_control is GxB_ANY_SPARSITY with b =
 // A->bitmap_switch, the matrix switches to bitmap if nnz(A)/(m*n) > b.  A
 // bitmap matrix switches to sparse if nnz(A)/(m*n) <= b/2.  A matrix whose
-// density is between b/2 and b remains in its current state.
+// density is between b/2 and b remains in its current state.  If the matrix
+// has recently converted back and forth between the two formats (s2b_thrash
+// is A->s2b_thrash, incremented on each conversion that reverses the prior
+// one), the band is widened to b/2^(t+1) ... b*2^t, so an oscillating matrix
+// sticks with its current format rather than converting on every step.
 
 // A->bitmap_switch is normally a fraction in range 0 to 1.  A value of 1
 // ensures that A is never converted to bitmap.
@@ -28,6 +32,7 @@
 bool GB_convert_bitmap_to_sparse_test    // test for hyper/sparse to bitmap
 (
     float bitmap_switch,    // A->bitmap_switch
+    int32_t s2b_thrash,     // A->s2b_thrash, or 0 for a matrix with no history
     int64_t anz,            // # of entries in A = GB_nnz (A)
     int64_t vlen,           // A->vlen
     int64_t vdim            // A->vdim
@@ -40,7 +45,11 @@ bool GB_convert_bitmap_to_sparse_test    // test for hyper/sparse to bitmap
     // maximum number of entries in the matrix or vector
     float nnz_dense = ((float) vlen) * ((float) vdim) ;
 
+    // lower the threshold if the matrix has been flip-flopping between the
+    // sparse and bitmap formats
+    float b = bitmap_switch / ((float) (1 << s2b_thrash)) ;
+
     // A should switch to sparse if the following condition is true:
-    return (nnz <= (bitmap_switch/2) * nnz_dense) ;
+    return (nnz <= (b/2) * nnz_dense) ;
 }
 
@@ -13,10 +13,13 @@
 // non-iso array Ax_new.  Otherwise, if Ax_new and Ax are NULL then no values
 // are extracted.
 
-// TODO allow this function to do typecasting.
+// The values are typecasted from the type of A to ccode, as needed, during
+// the gather; ccode must be compatible with A->type->code.  Pass
+// A->type->code for no typecasting.
 
 #include "GB.h"
 #include "GB_partition.h"
+#include "GB_bitmap_scan.h"
 #include "GB_unused.h"
 
 GrB_Info GB_convert_bitmap_worker   // extract CSC/CSR or triplets from bitmap
@@ -25,9 +28,11 @@ GrB_Info GB_convert_bitmap_worker   // extract CSC/CSR or triplets from bitmap
     int64_t *restrict Ap,           // vector pointers for CSC/CSR form
     int64_t *restrict Ai,           // indices for CSC/CSR or triplet form
     int64_t *restrict Aj,           // vector indices for triplet form
-    GB_void *restrict Ax_new,       // values for CSC/CSR or triplet form
+    GB_void *restrict Ax_new,       // values for CSC/CSR or triplet form,
+                                    // in the type given by ccode
     int64_t *anvec_nonempty,        // # of non-empty vectors
     // inputs: not modified
+    const GB_Type_code ccode,       // type code of Ax_new
     const GrB_Matrix A,             // matrix to extract; not modified
     GB_Werk Werk
 )
@@ -70,7 +75,14 @@ GrB_Info GB_convert_bitmap_worker   // extract CSC/CSR or triplets from bitmap
             // ajnz = nnz (A (:,j))
             int64_t ajnz = 0 ;
             int64_t pA_start = j * avlen ;
-            for (int64_t i = 0 ; i < avlen ; i++)
+            int64_t i = 0 ;
+            for ( ; i + 8 <= avlen ; i += 8)
+            { 
+                // count a group of 8 entries at a time
+                ajnz += GB_bitmap_word_count (GB_bitmap_word (Ab,
+                    i + pA_start)) ;
+            }
+            for ( ; i < avlen ; i++)
             { 
                 // see if A(i,j) is present in the bitmap
                 int64_t p = i + pA_start ;
@@ -108,7 +120,14 @@ GrB_Info GB_convert_bitmap_worker   // extract CSC/CSR or triplets from bitmap
                 // ajnz = nnz (A (istart:iend-1,j))
                 int64_t ajnz = 0 ;
                 int64_t pA_start = j * avlen ;
-                for (int64_t i = istart ; i < iend ; i++)
+                int64_t i = istart ;
+                for ( ; i + 8 <= iend ; i += 8)
+                { 
+                    // count a group of 8 entries at a time
+                    ajnz += GB_bitmap_word_count (GB_bitmap_word (Ab,
+                        i + pA_start)) ;
+                }
+                for ( ; i < iend ; i++)
                 { 
                     // see if A(i,j) is present in the bitmap
                     int64_t p = i + pA_start ;
@@ -154,6 +173,13 @@ GrB_Info GB_convert_bitmap_worker   // extract CSC/CSR or triplets from bitmap
     const bool A_iso = A->iso ;
     const bool numeric = (Ax_new != NULL && Ax != NULL) ;
 
+    // typecast the values during the gather, if needed; no typecasting can
+    // occur for user-defined types, where ccode must equal the type of A
+    const GB_Type_code acode = A->type->code ;
+    GB_cast_function cast_A_to_C =
+        (numeric && ccode != acode) ? GB_cast_factory (ccode, acode) : NULL ;
+    const size_t csize = GB_code_size (ccode, asize) ;
+
     if (by_vector)
     {
 
@@ -168,21 +194,40 @@ GrB_Info GB_convert_bitmap_worker   // extract CSC/CSR or triplets from bitmap
             // gather from the bitmap into the new A (:,j)
             int64_t pnew = Ap [j] ;
             int64_t pA_start = j * avlen ;
-            for (int64_t i = 0 ; i < avlen ; i++)
+            for (int64_t i8 = 0 ; i8 < avlen ; i8 += 8)
             {
-                int64_t p = i + pA_start ;
-                if (Ab [p])
+                // scan the entries i8 through ilast-1, in groups of up to 8
+                int64_t ilast = GB_IMIN (i8 + 8, avlen) ;
+                if (ilast - i8 == 8
+                    && GB_bitmap_word (Ab, i8 + pA_start) == 0)
+                { 
+                    // skip a group of 8 absent entries at once
+                    continue ;
+                }
+                for (int64_t i = i8 ; i < ilast ; i++)
                 {
-                    // A(i,j) is in the bitmap
-                    if (Ai != NULL) Ai [pnew] = i ;
-                    if (Aj != NULL) Aj [pnew] = j ;
-                    if (numeric)
-                    { 
-                        // Ax_new [pnew] = Ax [p])
-                        memcpy (Ax_new +(pnew)*asize,
-                            Ax +(A_iso ? 0:(p)*asize), asize) ;
+                    int64_t p = i + pA_start ;
+                    if (Ab [p])
+                    {
+                        // A(i,j) is in the bitmap
+                        if (Ai != NULL) Ai [pnew] = i ;
+                        if (Aj != NULL) Aj [pnew] = j ;
+                        if (numeric)
+                        { 
+                            // Ax_new [pnew] = (ctype) Ax [p]
+                            if (cast_A_to_C != NULL)
+                            { 
+                                cast_A_to_C (Ax_new +(pnew)*csize,
+                                    Ax +(A_iso ? 0:(p)*asize), asize) ;
+                            }
+                            else
+                            { 
+                                memcpy (Ax_new +(pnew)*csize,
+                                    Ax +(A_iso ? 0:(p)*asize), asize) ;
+                            }
+                        }
+                        pnew++ ;
                     }
-                    pnew++ ;
                 }
             }
             ASSERT (pnew == Ap [j+1]) ;
@@ -208,22 +253,41 @@ GrB_Info GB_convert_bitmap_worker   // extract CSC/CSR or triplets from bitmap
                 // gather from the bitmap into the new A (:,j)
                 int64_t pnew = Ap [j] + Wtask [j] ;
                 int64_t pA_start = j * avlen ;
-                for (int64_t i = istart ; i < iend ; i++)
+                for (int64_t i8 = istart ; i8 < iend ; i8 += 8)
                 {
-                    // see if A(i,j) is present in the bitmap
-                    int64_t p = i + pA_start ;
-                    if (Ab [p])
+                    // scan the entries i8 through ilast-1, in groups of 8
+                    int64_t ilast = GB_IMIN (i8 + 8, iend) ;
+                    if (ilast - i8 == 8
+                        && GB_bitmap_word (Ab, i8 + pA_start) == 0)
+                    { 
+                        // skip a group of 8 absent entries at once
+                        continue ;
+                    }
+                    for (int64_t i = i8 ; i < ilast ; i++)
                     {
-                        // A(i,j) is in the bitmap
-                        if (Ai != NULL) Ai [pnew] = i ;
-                        if (Aj != NULL) Aj [pnew] = j ;
-                        if (numeric)
-                        { 
-                            // Ax_new [pnew] = Ax [p] ;
-                            memcpy (Ax_new +(pnew)*asize,
-                                Ax +(A_iso ? 0:(p)*asize), asize) ;
+                        // see if A(i,j) is present in the bitmap
+                        int64_t p = i + pA_start ;
+                        if (Ab [p])
+                        {
+                            // A(i,j) is in the bitmap
+                            if (Ai != NULL) Ai [pnew] = i ;
+                            if (Aj != NULL) Aj [pnew] = j ;
+                            if (numeric)
+                            { 
+                                // Ax_new [pnew] = (ctype) Ax [p]
+                                if (cast_A_to_C != NULL)
+                                { 
+                                    cast_A_to_C (Ax_new +(pnew)*csize,
+                                        Ax +(A_iso ? 0:(p)*asize), asize) ;
+                                }
+                                else
+                                { 
+                                    memcpy (Ax_new +(pnew)*csize,
+                                        Ax +(A_iso ? 0:(p)*asize), asize) ;
+                                }
+                            }
+                            pnew++ ;
                         }
-                        pnew++ ;
                     }
                 }
             }
@@ -255,6 +255,9 @@ GrB_Info GB_convert_hyper_to_sparse // convert hypersparse to sparse
 
     A->magic = GB_MAGIC ;
 
+    // record the conversion for GxB_Matrix_advise
+    A->conv_from_hyper++ ;
+
     //--------------------------------------------------------------------------
     // A is now sparse
     //--------------------------------------------------------------------------
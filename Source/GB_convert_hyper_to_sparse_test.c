@@ -23,6 +23,13 @@ bool GB_convert_hyper_to_sparse_test    // test for hypersparse to sparse
 )
 { 
 
+    if (vdim > GB_HYPER_VDIM_LIMIT)
+    { 
+        // A->p of size vdim+1 cannot be reasonably allocated; stay
+        // hypersparse, even if A->hyper_switch is GB_NEVER_HYPER
+        return (false) ;
+    }
+
     // get the vector dimension of this matrix
     float n = (float) vdim ;
 
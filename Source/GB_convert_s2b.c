@@ -157,7 +157,15 @@ GrB_Info GB_convert_s2b    // convert sparse/hypersparse to bitmap
 
         info = GrB_NO_VALUE ;
 
-        if (A_iso)
+        #if defined ( GRAPHBLAS_HAS_CUDA )
+        if (GB_convert_s2b_cuda_branch (A))
+        { 
+            // scatter on the GPU; if A is iso only the pattern is scattered
+            info = GB_convert_s2b_cuda (A_iso ? NULL : Ax_new, Ab, A) ;
+        }
+        #endif
+
+        if (info == GrB_NO_VALUE && A_iso)
         { 
             // A is iso; numerical entries are not modified
             #undef  GB_COPY
@@ -165,7 +173,7 @@ GrB_Info GB_convert_s2b    // convert sparse/hypersparse to bitmap
             #include "GB_convert_s2b_template.c"
             info = GrB_SUCCESS ;
         }
-        else
+        else if (info == GrB_NO_VALUE)
         {
 
             #ifndef GBCOMPACT
@@ -278,6 +286,11 @@ GrB_Info GB_convert_s2b    // convert sparse/hypersparse to bitmap
 
     A->magic = GB_MAGIC ;
 
+    // record the conversion for the GB_conform hysteresis rule
+    A->s2b_thrash = (A->s2b_last == -1) ? GB_IMIN (A->s2b_thrash + 1, 3) : 0 ;
+    A->s2b_last = 1 ;
+    A->conv_to_bitmap++ ;
+
     //--------------------------------------------------------------------------
     // free workspace and return result
     //--------------------------------------------------------------------------
@@ -23,6 +23,7 @@
 bool GB_convert_s2b_test    // test for hyper/sparse to bitmap
 (
     float bitmap_switch,    // A->bitmap_switch
+    int32_t s2b_thrash,     // A->s2b_thrash, or 0 for a matrix with no history
     int64_t anz,            // # of entries in A = GB_nnz (A)
     int64_t vlen,           // A->vlen
     int64_t vdim            // A->vdim
@@ -34,7 +35,11 @@ bool GB_convert_s2b_test    // test for hyper/sparse to bitmap
     // maximum number of entries in the matrix or vector
     float nnz_dense = ((float) vlen) * ((float) vdim) ;
 
+    // raise the threshold if the matrix has been flip-flopping between the
+    // sparse and bitmap formats (see GB_convert_bitmap_to_sparse_test)
+    float b = bitmap_switch * ((float) (1 << s2b_thrash)) ;
+
     // A should switch to bitmap if the following condition is true:
-    return (nnz > bitmap_switch * nnz_dense && nnz_dense < (float) GB_NMAX) ;
+    return (nnz > b * nnz_dense && nnz_dense < (float) GB_NMAX) ;
 }
 
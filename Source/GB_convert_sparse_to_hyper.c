@@ -68,7 +68,7 @@ GrB_Info GB_convert_sparse_to_hyper // convert from sparse to hypersparse
 
         const int64_t *restrict Ap_old = A->p ;
         size_t Ap_old_size = A->p_size ;
-        bool Ap_old_shallow = A->p_shallow ;
+        bool Ap_old_shallow = A->p_shallow || (A->p == A->p_static) ;
 
         GB_WERK_DECLARE (Count, int64_t) ;
         GB_WERK_PUSH (Count, ntasks+1, int64_t) ;
@@ -153,6 +153,9 @@ GrB_Info GB_convert_sparse_to_hyper // convert from sparse to hypersparse
         Ap_new [nvec_nonempty] = anz ;
         A->magic = GB_MAGIC ;
 
+        // record the conversion for GxB_Matrix_advise
+        A->conv_to_hyper++ ;
+
         //----------------------------------------------------------------------
         // free workspace, and free the old A->p unless it's shallow
         //----------------------------------------------------------------------
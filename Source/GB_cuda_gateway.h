@@ -139,6 +139,89 @@ bool GB_cuda_type_branch            // return true if the type is OK on GPU
     const GrB_Type type             // type to query
 ) ;
 
+bool GB_ewise_dense_cuda_branch // return true to use the GPU
+(
+    const GrB_Matrix C,         // output matrix, full
+    const GrB_BinaryOp op,      // binary operator to apply
+    const GrB_Matrix A,         // first input matrix, full
+    const GrB_Matrix B          // second input matrix, full
+) ;
+
+GrB_Info GB_ewise_dense_cuda    // C = A (op) B, all 3 matrices full
+(
+    // input/output:
+    GrB_Matrix C,               // output matrix, full, not iso
+    // input:
+    const GrB_BinaryOp op,      // binary operator to apply
+    const GrB_Matrix A,         // first input matrix, full
+    const GrB_Matrix B          // second input matrix, full
+) ;
+
+bool GB_apply_unop_cuda_branch  // return true to use the GPU
+(
+    const GrB_Type ctype,       // type of the output array Cx
+    const GB_Operator op,       // operator to apply
+    const GrB_Matrix A          // input matrix
+) ;
+
+GrB_Info GB_apply_unop_cuda     // Cx = op (A)
+(
+    // output:
+    GB_void *Cx,                // output array, of type op->ztype
+    // input:
+    const GrB_Type ctype,       // type of Cx
+    const GB_Operator op,       // unary operator to apply
+    const GrB_Matrix A          // input matrix, as-if-full or bitmap
+) ;
+
+bool GB_convert_s2b_cuda_branch // return true to use the GPU
+(
+    const GrB_Matrix A          // matrix being converted to bitmap
+) ;
+
+GrB_Info GB_convert_s2b_cuda    // scatter A into the bitmap, on the GPU
+(
+    // output:
+    GB_void *Ax_new,        // values of the bitmap, already cleared, or NULL
+                            // if A is iso and the values do not move
+    int8_t *Ab,             // bitmap, already cleared
+    // input:
+    const GrB_Matrix A      // matrix to convert; sparse or hypersparse
+) ;
+
+bool GB_convert_b2s_cuda_branch // return true to use the GPU
+(
+    const GrB_Matrix A          // bitmap matrix being converted to sparse
+) ;
+
+GrB_Info GB_convert_b2s_cuda    // gather A into sparse form, on the GPU
+(
+    // output:
+    int64_t *Ap,            // vector pointers, size avdim+1
+    int64_t *Ai,            // row indices, size >= nvals(A)
+    GB_void *Ax_new,        // values, size >= nvals(A)*asize, or NULL if the
+                            // values are not moved (A iso)
+    int64_t *anvec_nonempty,    // # of non-empty vectors
+    // input:
+    const GrB_Matrix A      // matrix to convert; bitmap
+) ;
+
+bool GB_transpose_bucket_cuda_branch    // return true to use the GPU
+(
+    const GB_iso_code C_code_iso,   // iso code for C
+    const GrB_Type ctype,           // type of the output matrix C
+    const GB_Operator op,           // operator to apply, or NULL if none
+    const GrB_Matrix A              // input matrix
+) ;
+
+GrB_Info GB_transpose_bucket_cuda   // C = A', on the GPU; C left jumbled
+(
+    GrB_Matrix C,               // output matrix (static header)
+    const GrB_Type ctype,       // type of C; same size as the type of A
+    const bool C_is_csc,        // format of C
+    const GrB_Matrix A          // input matrix; sparse or hypersparse
+) ;
+
 GrB_Info GB_AxB_dot3_cuda           // C<M> = A'*B using dot product method
 (
     GrB_Matrix C,                   // output matrix, static header
@@ -160,5 +243,36 @@ bool GB_AxB_dot3_cuda_branch
     const bool flipxy               // if true, do z=fmult(b,a) vs fmult(a,b)
 );
 
+GrB_Info GB_AxB_saxpy3_cuda         // C = A*B using the saxpy3 method
+(
+    GrB_Matrix C,                   // output matrix, sparse or hypersparse
+    int C_sparsity,                 // construct C as sparse or hypersparse
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy               // if true, do z=fmult(b,a) vs fmult(a,b)
+) ;
+
+bool GB_AxB_saxpy3_cuda_branch
+(
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy               // if true, do z=fmult(b,a) vs fmult(a,b)
+) ;
+
+GrB_Info GB_cuda_matrix_prefetch_all    // async prefetch all arrays of A
+(
+    GrB_Matrix A,                   // matrix to prefetch
+    int device,                     // GPU id to prefetch to, or < 0 for CPU
+    void *stream                    // cudaStream_t, or NULL for the default
+) ;
+
+GrB_Info GB_cuda_matrix_pin_device      // pin the arrays of A on a GPU
+(
+    GrB_Matrix A,                   // matrix to pin (or unpin, if device < 0)
+    int device                      // GPU id, or < 0 to let A migrate freely
+) ;
+
 #endif
 
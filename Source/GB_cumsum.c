@@ -20,6 +20,169 @@
 
 #include "GB.h"
 
+//------------------------------------------------------------------------------
+// GB_cumsum_chained: single-pass chained scan with decoupled look-back
+//------------------------------------------------------------------------------
+
+// For very large arrays, the two-pass method below reads the entire array
+// twice from main memory.  The chained scan instead partitions the array into
+// tiles; each tile is summed, its aggregate is published, and the exclusive
+// prefix of the tile is found by walking back over the published aggregates
+// of earlier tiles (stopping early at any tile whose inclusive prefix is
+// already known).  The tile is then rewritten with its cumulative sum while
+// it is still in cache, so each entry crosses the memory bus once instead of
+// twice.  The count of nonzero entries (k) is fused into the same pass.
+
+// Tiles are claimed in order via an atomic counter, and each thread publishes
+// the aggregate of its tile before waiting on any other tile, so the
+// look-back can always make progress.
+
+#define GB_CUMSUM_TILE_SIZE (64 * 1024)
+#define GB_CUMSUM_CHAINED_MIN (256 * GB_CUMSUM_TILE_SIZE)
+
+static bool GB_cumsum_chained       // true if successful; false if no memory
+(
+    int64_t *restrict count,        // size n+1, input/output
+    const int64_t n,
+    int64_t *restrict kresult,      // return k, if needed by the caller
+    int nthreads
+)
+{
+
+    //--------------------------------------------------------------------------
+    // allocate the tile workspace
+    //--------------------------------------------------------------------------
+
+    int64_t ntiles = (n + GB_CUMSUM_TILE_SIZE - 1) / GB_CUMSUM_TILE_SIZE ;
+    int64_t *restrict Tile_agg = NULL ;   size_t Tile_agg_size = 0 ;
+    int64_t *restrict Tile_prefix = NULL ; size_t Tile_prefix_size = 0 ;
+    int64_t *restrict Tile_state = NULL ; size_t Tile_state_size = 0 ;
+
+    Tile_agg    = GB_MALLOC_WORK (ntiles, int64_t, &Tile_agg_size) ;
+    Tile_prefix = GB_MALLOC_WORK (ntiles, int64_t, &Tile_prefix_size) ;
+    Tile_state  = GB_MALLOC_WORK (ntiles, int64_t, &Tile_state_size) ;
+    if (Tile_agg == NULL || Tile_prefix == NULL || Tile_state == NULL)
+    {
+        // out of memory; the caller falls back to the two-pass method
+        GB_FREE_WORK (&Tile_agg, Tile_agg_size) ;
+        GB_FREE_WORK (&Tile_prefix, Tile_prefix_size) ;
+        GB_FREE_WORK (&Tile_state, Tile_state_size) ;
+        return (false) ;
+    }
+
+    // Tile_state [t] is 0 if tile t has published nothing, 1 if Tile_agg [t]
+    // holds its aggregate, and 2 if Tile_prefix [t] holds its inclusive
+    // prefix (the sum of all entries in tiles 0 to t).
+    GB_memset (Tile_state, 0, ntiles * sizeof (int64_t), nthreads) ;
+
+    //--------------------------------------------------------------------------
+    // scan the tiles
+    //--------------------------------------------------------------------------
+
+    int64_t k = 0 ;
+    int64_t tile_claim = 0 ;
+
+    #pragma omp parallel num_threads(nthreads) reduction(+:k)
+    {
+        while (true)
+        {
+
+            //------------------------------------------------------------------
+            // claim the next tile
+            //------------------------------------------------------------------
+
+            int64_t t ;
+            GB_ATOMIC_CAPTURE_INC64 (t, tile_claim) ;
+            if (t >= ntiles)
+            {
+                break ;
+            }
+            int64_t istart = t * GB_CUMSUM_TILE_SIZE ;
+            int64_t iend = GB_IMIN (n, istart + GB_CUMSUM_TILE_SIZE) ;
+
+            //------------------------------------------------------------------
+            // sum this tile and publish its aggregate
+            //------------------------------------------------------------------
+
+            int64_t s = 0 ;
+            for (int64_t i = istart ; i < iend ; i++)
+            {
+                int64_t c = count [i] ;
+                if (c != 0) k++ ;
+                s += c ;
+            }
+            Tile_agg [t] = s ;
+            GB_ATOMIC_WRITE
+            Tile_state [t] = 1 ;        // aggregate of tile t is available
+
+            //------------------------------------------------------------------
+            // look back to find the exclusive prefix of this tile
+            //------------------------------------------------------------------
+
+            int64_t exclusive = 0 ;
+            for (int64_t u = t-1 ; u >= 0 ; u--)
+            {
+                int64_t state ;
+                do
+                {
+                    GB_ATOMIC_READ
+                    state = Tile_state [u] ;
+                }
+                while (state == 0) ;
+                if (state == 2)
+                {
+                    // the inclusive prefix of tile u is available; done
+                    exclusive += Tile_prefix [u] ;
+                    break ;
+                }
+                else
+                {
+                    // only the aggregate of tile u is available; keep walking
+                    exclusive += Tile_agg [u] ;
+                }
+            }
+
+            //------------------------------------------------------------------
+            // rewrite the tile (still in cache) with its cumulative sum
+            //------------------------------------------------------------------
+
+            s = exclusive ;
+            for (int64_t i = istart ; i < iend ; i++)
+            {
+                int64_t c = count [i] ;
+                count [i] = s ;
+                s += c ;
+            }
+            if (iend == n)
+            {
+                count [n] = s ;
+            }
+
+            //------------------------------------------------------------------
+            // publish the inclusive prefix of this tile
+            //------------------------------------------------------------------
+
+            Tile_prefix [t] = s ;
+            GB_ATOMIC_WRITE
+            Tile_state [t] = 2 ;        // inclusive prefix of t is available
+        }
+    }
+
+    if (kresult != NULL)
+    {
+        (*kresult) = k ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORK (&Tile_agg, Tile_agg_size) ;
+    GB_FREE_WORK (&Tile_prefix, Tile_prefix_size) ;
+    GB_FREE_WORK (&Tile_state, Tile_state_size) ;
+    return (true) ;
+}
+
 void GB_cumsum                      // cumulative sum of an array
 (
     int64_t *restrict count,     // size n+1, input/output
@@ -51,6 +214,22 @@ void GB_cumsum                      // cumulative sum of an array
         nthreads = GB_IMAX (nthreads, 1) ;
     }
 
+    //--------------------------------------------------------------------------
+    // use the single-pass chained scan for very large arrays
+    //--------------------------------------------------------------------------
+
+    if (nthreads > 2 && n >= GB_CUMSUM_CHAINED_MIN)
+    {
+        // the array is far larger than cache, so the memory traffic of the
+        // two-pass method below dominates; the chained scan touches each
+        // entry once
+        if (GB_cumsum_chained (count, n, kresult, nthreads))
+        {
+            return ;
+        }
+        // out of memory; fall back to the two-pass method
+    }
+
     //--------------------------------------------------------------------------
     // count = cumsum ([0 count[0:n-1]]) ;
     //--------------------------------------------------------------------------
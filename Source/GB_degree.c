@@ -0,0 +1,199 @@
+//------------------------------------------------------------------------------
+// GB_degree: compute and cache the row degrees of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A->degree caches the row degrees of a matrix: degree [i] = # of entries in
+// A(i,:).  Like the A->Y hyper_hash, the cache is computed on demand, travels
+// with the matrix until its pattern changes, and can always be rebuilt.  If A
+// is held by row the degrees are read off the vector pointers; if held by
+// column they are accumulated from the row indices with atomic updates, as in
+// the atomic bucket method of GB_transpose_bucket.
+
+// GB_degree_free must be called by any method that changes the pattern of a
+// matrix without freeing it via GB_phy_free or GB_bix_free (which call it
+// themselves), such as the in-place bitmap modifications of GB_setElement,
+// GrB_Matrix_removeElement, and GB_bitmap_assign.  Methods that leave zombies
+// or pending tuples behind need no explicit call: the cache is only consulted
+// after GB_MATRIX_WAIT, and GB_wait discards it before assembling them.
+
+#include "GB.h"
+
+#define GB_FREE_ALL ;
+
+//------------------------------------------------------------------------------
+// GB_degree_free: free the A->degree cache of a matrix
+//------------------------------------------------------------------------------
+
+void GB_degree_free             // free the A->degree cache of a matrix
+(
+    GrB_Matrix A                // matrix with content to free
+)
+{
+    if (A != NULL)
+    { 
+        GB_FREE (&(A->degree), A->degree_size) ;
+        A->degree = NULL ;
+        A->degree_size = 0 ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_degree_cache: ensure the A->degree cache is computed
+//------------------------------------------------------------------------------
+
+GrB_Info GB_degree_cache        // ensure the A->degree cache is computed
+(
+    GrB_Matrix A,               // matrix to query; pending work is finished
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs and finish any pending work
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT_MATRIX_OK (A, "A input for GB_degree_cache", GB0) ;
+    GB_MATRIX_WAIT (A) ;
+
+    if (A->degree != NULL)
+    { 
+        // the row degrees are already cached
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the degree array
+    //--------------------------------------------------------------------------
+
+    const int64_t nrows = GB_NROWS (A) ;
+    const int64_t vlen = A->vlen ;
+    const int64_t vdim = A->vdim ;
+    int64_t *restrict degree = NULL ;
+    degree = GB_CALLOC (GB_IMAX (nrows, 1), int64_t, &(A->degree_size)) ;
+    if (degree == NULL)
+    { 
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    A->degree = degree ;
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+
+    //--------------------------------------------------------------------------
+    // compute the row degrees
+    //--------------------------------------------------------------------------
+
+    if (GB_IS_FULL (A))
+    {
+
+        //----------------------------------------------------------------------
+        // A is full: all rows have the same degree
+        //----------------------------------------------------------------------
+
+        const int64_t d = A->is_csc ? vdim : vlen ;
+        int nth = GB_nthreads (nrows, chunk, nthreads_max) ;
+        int64_t i ;
+        #pragma omp parallel for num_threads(nth) schedule(static)
+        for (i = 0 ; i < nrows ; i++)
+        { 
+            degree [i] = d ;
+        }
+
+    }
+    else if (GB_IS_BITMAP (A))
+    {
+
+        //----------------------------------------------------------------------
+        // A is bitmap: sum the bitmap along each row
+        //----------------------------------------------------------------------
+
+        const int8_t *restrict Ab = A->b ;
+        int nth = GB_nthreads (vlen * vdim, chunk, nthreads_max) ;
+        int64_t i ;
+        if (A->is_csc)
+        {
+            // A(i,j) is held at position i + j*vlen
+            #pragma omp parallel for num_threads(nth) schedule(static)
+            for (i = 0 ; i < vlen ; i++)
+            {
+                int64_t d = 0 ;
+                for (int64_t j = 0 ; j < vdim ; j++)
+                { 
+                    d += (Ab [i + j * vlen] != 0) ;
+                }
+                degree [i] = d ;
+            }
+        }
+        else
+        {
+            // A(i,j) is held at position j + i*vlen
+            #pragma omp parallel for num_threads(nth) schedule(static)
+            for (i = 0 ; i < vdim ; i++)
+            {
+                const int8_t *restrict Abi = Ab + i * vlen ;
+                int64_t d = 0 ;
+                for (int64_t j = 0 ; j < vlen ; j++)
+                { 
+                    d += (Abi [j] != 0) ;
+                }
+                degree [i] = d ;
+            }
+        }
+
+    }
+    else if (!A->is_csc)
+    {
+
+        //----------------------------------------------------------------------
+        // A is sparse/hypersparse by row: read the vector pointers
+        //----------------------------------------------------------------------
+
+        const int64_t *restrict Ap = A->p ;
+        const int64_t *restrict Ah = A->h ;
+        const int64_t anvec = A->nvec ;
+        int nth = GB_nthreads (anvec, chunk, nthreads_max) ;
+        int64_t k ;
+        #pragma omp parallel for num_threads(nth) schedule(static)
+        for (k = 0 ; k < anvec ; k++)
+        { 
+            int64_t i = GBH (Ah, k) ;
+            degree [i] = Ap [k+1] - Ap [k] ;
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // A is sparse/hypersparse by column: count the row indices
+        //----------------------------------------------------------------------
+
+        const int64_t *restrict Ai = A->i ;
+        const int64_t anz = GB_nnz (A) ;
+        int nth = GB_nthreads (anz, chunk, nthreads_max) ;
+        int64_t p ;
+        #pragma omp parallel for num_threads(nth) schedule(static)
+        for (p = 0 ; p < anz ; p++)
+        { 
+            int64_t i = Ai [p] ;
+            // update degree [i]++ atomically
+            GB_ATOMIC_UPDATE
+            degree [i]++ ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A with cached degrees", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
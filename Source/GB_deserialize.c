@@ -9,6 +9,13 @@
 
 // A parallel decompression of a serialized blob into a GrB_Matrix.
 
+// If shallow is true, any array stored uncompressed in the blob
+// (GxB_COMPRESSION_NONE) is not copied: the matrix points directly into the
+// blob, and the corresponding shallow flag of the matrix is set.  The caller
+// must keep the blob alive (a mmap'd file, for example) for the lifetime of
+// the matrix.  Compressed arrays are decompressed into fresh deep copies as
+// usual, so a shallow deserialization of a compressed blob is still valid.
+
 #include "GB.h"
 #include "GB_serialize.h"
 
@@ -18,14 +25,65 @@
     GB_Matrix_free (&C) ;                   \
 }
 
+//------------------------------------------------------------------------------
+// GB_deserialize_array: get a single array, shallow or deep
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_deserialize_array
+(
+    // output:
+    GB_void **X_handle,         // output array
+    size_t *X_size_handle,      // size of X as allocated (or X_len if shallow)
+    bool *X_shallow,            // true if X points into the blob
+    // input:
+    bool shallow,               // if true, try a shallow pointer to the blob
+    int64_t X_len,              // size of X in bytes
+    const GB_void *blob,        // serialized blob of size blob_size
+    size_t blob_size,
+    int64_t *Sblocks,           // array of size nblocks
+    int32_t nblocks,            // # of compressed blocks for this array
+    int32_t method,             // compression method used for each block
+    // input/output:
+    size_t *s_handle            // where to read from the blob
+)
+{
+    int32_t algo, level ;
+    GB_serialize_method (&algo, &level, method) ;
+    size_t s = (*s_handle) ;
+    if (shallow && algo == GxB_COMPRESSION_NONE && nblocks == 1
+        && Sblocks [0] == X_len && s + X_len <= blob_size)
+    {
+        // the array is a single uncompressed block in the blob: point to it
+        (*X_handle) = (GB_void *) (blob + s) ;
+        (*X_size_handle) = X_len ;
+        (*X_shallow) = true ;
+        (*s_handle) = s + X_len ;
+        return (GrB_SUCCESS) ;
+    }
+    // otherwise, decompress the array into a fresh deep copy
+    (*X_shallow) = false ;
+    return (GB_deserialize_from_blob (X_handle, X_size_handle, X_len, blob,
+        blob_size, Sblocks, nblocks, method, s_handle)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_deserialize
+//------------------------------------------------------------------------------
+
 GrB_Info GB_deserialize             // deserialize a matrix from a blob
 (
     // output:
     GrB_Matrix *Chandle,            // output matrix created from the blob
     // input:
     GrB_Type type_expected,         // type expected (NULL for any built-in)
-    const GB_void *blob,            // serialized matrix 
-    size_t blob_size                // size of the blob
+    const GB_void *blob,            // serialized matrix
+    size_t blob_size,               // size of the blob
+    bool shallow,                   // if true, any uncompressed array in the
+                                    // blob becomes a shallow pointer into the
+                                    // blob itself, with no copy
+    bool typecast                   // if true, a blob holding a built-in type
+                                    // other than type_expected is typecast to
+                                    // type_expected as its values are loaded
 )
 {
 
@@ -103,6 +161,11 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
         return (GrB_DOMAIN_MISMATCH) ;
     }
 
+    // if cast is set, the values are loaded in their stored type ctype and
+    // typecast to type_expected at the end, in a single extra pass over the
+    // values only
+    bool cast = false ;
+
     if (ccode == GB_UDT_code)
     {
         // user-defined name is 128 bytes, if present
@@ -117,10 +180,16 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
         s += GxB_MAX_NAME_LEN ;
     }
     else if (type_expected != NULL && ctype != type_expected)
-    { 
-        // built-in type must match type_expected
-        // blob is invalid
-        return (GrB_DOMAIN_MISMATCH) ;
+    {
+        // the blob holds a built-in type other than type_expected
+        if (!typecast || type_expected->code == GB_UDT_code)
+        { 
+            // built-in type must match type_expected
+            // blob is invalid
+            return (GrB_DOMAIN_MISMATCH) ;
+        }
+        // any two built-in types can be typecast
+        cast = true ;
     }
 
     //--------------------------------------------------------------------------
@@ -160,49 +229,50 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
 
     switch (sparsity)
     {
-        case GxB_HYPERSPARSE : 
+        case GxB_HYPERSPARSE :
             // decompress Cp, Ch, and Ci
-            GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->p), &(C->p_size),
-                Cp_len, blob, blob_size, Cp_Sblocks, Cp_nblocks, Cp_method,
-                &s)) ;
+            GB_OK (GB_deserialize_array ((GB_void **) &(C->p), &(C->p_size),
+                &(C->p_shallow), shallow, Cp_len, blob, blob_size, Cp_Sblocks,
+                Cp_nblocks, Cp_method, &s)) ;
 
-            GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->h), &(C->h_size),
-                Ch_len, blob, blob_size, Ch_Sblocks, Ch_nblocks, Ch_method,
-                &s)) ;
+            GB_OK (GB_deserialize_array ((GB_void **) &(C->h), &(C->h_size),
+                &(C->h_shallow), shallow, Ch_len, blob, blob_size, Ch_Sblocks,
+                Ch_nblocks, Ch_method, &s)) ;
 
-            GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->i), &(C->i_size),
-                Ci_len, blob, blob_size, Ci_Sblocks, Ci_nblocks, Ci_method,
-                &s)) ;
+            GB_OK (GB_deserialize_array ((GB_void **) &(C->i), &(C->i_size),
+                &(C->i_shallow), shallow, Ci_len, blob, blob_size, Ci_Sblocks,
+                Ci_nblocks, Ci_method, &s)) ;
             break ;
 
-        case GxB_SPARSE : 
+        case GxB_SPARSE :
 
             // decompress Cp and Ci
-            GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->p), &(C->p_size),
-                Cp_len, blob, blob_size, Cp_Sblocks, Cp_nblocks, Cp_method,
-                &s)) ;
+            GB_OK (GB_deserialize_array ((GB_void **) &(C->p), &(C->p_size),
+                &(C->p_shallow), shallow, Cp_len, blob, blob_size, Cp_Sblocks,
+                Cp_nblocks, Cp_method, &s)) ;
 
-            GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->i), &(C->i_size),
-                Ci_len, blob, blob_size, Ci_Sblocks, Ci_nblocks, Ci_method,
-                &s)) ;
+            GB_OK (GB_deserialize_array ((GB_void **) &(C->i), &(C->i_size),
+                &(C->i_shallow), shallow, Ci_len, blob, blob_size, Ci_Sblocks,
+                Ci_nblocks, Ci_method, &s)) ;
             break ;
 
-        case GxB_BITMAP : 
+        case GxB_BITMAP :
 
             // decompress Cb
-            GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->b), &(C->b_size),
-                Cb_len, blob, blob_size, Cb_Sblocks, Cb_nblocks, Cb_method,
-                &s)) ;
+            GB_OK (GB_deserialize_array ((GB_void **) &(C->b), &(C->b_size),
+                &(C->b_shallow), shallow, Cb_len, blob, blob_size, Cb_Sblocks,
+                Cb_nblocks, Cb_method, &s)) ;
             break ;
 
-        case GxB_FULL : 
+        case GxB_FULL :
             break ;
         default: ;
     }
 
     // decompress Cx
-    GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->x), &(C->x_size), Cx_len,
-        blob, blob_size, Cx_Sblocks, Cx_nblocks, Cx_method, &s)) ;
+    GB_OK (GB_deserialize_array ((GB_void **) &(C->x), &(C->x_size),
+        &(C->x_shallow), shallow, Cx_len, blob, blob_size, Cx_Sblocks,
+        Cx_nblocks, Cx_method, &s)) ;
 
     if (C->p != NULL)
     { 
@@ -218,6 +288,58 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     }
     C->magic = GB_MAGIC ;
 
+    //--------------------------------------------------------------------------
+    // typecast the values to the requested type, if the blob type differs
+    //--------------------------------------------------------------------------
+
+    // The cast touches only the values, in one parallel pass with the same
+    // kernels as GrB_apply of an identity operator, but with no second
+    // matrix and no copy of the pattern arrays; if the values were stored
+    // uncompressed, they are read directly from the blob, with no transient
+    // copy of the stored type at all.
+
+    if (cast)
+    {
+        GBURBLE ("(cast %s to %s) ", ctype->name, type_expected->name) ;
+        const int64_t cx_entries = (C->iso) ? 1 : GB_nnz_held (C) ;
+        GB_void *Cx_new = NULL ; size_t Cx_new_size = 0 ;
+        Cx_new = GB_MALLOC (GB_IMAX (cx_entries, 1) * type_expected->size,
+            GB_void, &Cx_new_size) ;
+        if (Cx_new == NULL)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        if (C->iso || cx_entries == 0)
+        { 
+            // cast the single iso value
+            GB_cast_scalar (Cx_new, type_expected->code, C->x, ccode,
+                ctype->size) ;
+        }
+        else
+        {
+            int nthreads_max = GB_Context_nthreads_max ( ) ;
+            double chunk = GB_Context_chunk ( ) ;
+            int nthreads = GB_nthreads (cx_entries, chunk, nthreads_max) ;
+            info = GB_cast_array (Cx_new, type_expected->code, C, nthreads) ;
+            if (info != GrB_SUCCESS)
+            { 
+                GB_FREE (&Cx_new, Cx_new_size) ;
+                GB_FREE_ALL ;
+                return (info) ;
+            }
+        }
+        if (!C->x_shallow)
+        { 
+            GB_FREE (&(C->x), C->x_size) ;
+        }
+        C->x = Cx_new ;
+        C->x_size = Cx_new_size ;
+        C->x_shallow = false ;
+        C->type = type_expected ;
+    }
+
     //--------------------------------------------------------------------------
     // return result
     //--------------------------------------------------------------------------
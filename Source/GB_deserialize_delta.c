@@ -0,0 +1,391 @@
+//------------------------------------------------------------------------------
+// GB_deserialize_delta: decode a delta blob into a GrB_Matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Reconstruct a matrix from a delta blob created by GB_serialize_delta.
+// Changed chunks are decompressed from the blob; unchanged chunks are copied
+// from the corresponding arrays of the base matrix, which is the matrix
+// reconstructed from the prior blob in the snapshot chain.  Each unchanged
+// chunk taken from the base is verified against the checksum recorded in the
+// delta blob, so a wrong or stale base is detected rather than silently
+// producing a corrupted matrix.
+
+#include "GB.h"
+#include "GB_serialize.h"
+#include "GB_lz4.h"
+#include "GB_zstd.h"
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_Matrix_free (&C) ;                   \
+}
+
+//------------------------------------------------------------------------------
+// GB_undelta_array: reconstruct one array from its chunks
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_undelta_array
+(
+    // output:
+    GB_void **X_handle,         // output array
+    size_t *X_size_handle,      // size of X as allocated
+    // input:
+    int64_t X_len,              // size of X in bytes
+    const GB_void *blob,        // the delta blob
+    size_t blob_size,
+    const uint64_t *Checks,     // checksum of each chunk
+    const int64_t *Schunks,     // cumulative compressed chunk sizes
+    int32_t nchunks,            // # of chunks
+    int32_t method,             // compression method for changed chunks
+    const GB_void *Base,        // base array, or NULL if none
+    size_t Base_size,           // size of the base array, in bytes
+    // input/output:
+    size_t *s_handle            // where to read from the blob
+)
+{
+
+    //--------------------------------------------------------------------------
+    // allocate the output array
+    //--------------------------------------------------------------------------
+
+    ASSERT (X_handle != NULL && X_size_handle != NULL) ;
+    (*X_handle) = NULL ;
+    (*X_size_handle) = 0 ;
+    if (X_len == 0)
+    {
+        // input array is empty
+        return (GrB_SUCCESS) ;
+    }
+    if (nchunks != GB_ICEIL (X_len, GB_DELTA_CHUNK))
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    size_t X_size = 0 ;
+    GB_void *X = GB_MALLOC (X_len, GB_void, &X_size) ;
+    if (X == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    int32_t algo, level ;
+    GB_serialize_method (&algo, &level, method) ;
+
+    //--------------------------------------------------------------------------
+    // reconstruct each chunk
+    //--------------------------------------------------------------------------
+
+    size_t s = (*s_handle) ;
+    int64_t slast = 0 ;
+    for (int32_t chunkid = 0 ; chunkid < nchunks ; chunkid++)
+    {
+        int64_t kstart = ((int64_t) chunkid) * GB_DELTA_CHUNK ;
+        int64_t chunklen = GB_IMIN (GB_DELTA_CHUNK, X_len - kstart) ;
+        int64_t csize = Schunks [chunkid] - slast ;
+        slast = Schunks [chunkid] ;
+        if (csize > 0)
+        {
+            // the chunk changed: decompress it from the blob
+            if (s + csize > blob_size)
+            {
+                // blob is invalid
+                GB_FREE (&X, X_size) ;
+                return (GrB_INVALID_OBJECT) ;
+            }
+            const char *src = (const char *) (blob + s) ;
+            char *dst = (char *) (X + kstart) ;
+            bool ok ;
+            switch (algo)
+            {
+                case GxB_COMPRESSION_NONE :
+                    ok = (csize == chunklen) ;
+                    if (ok) memcpy (dst, src, chunklen) ;
+                    break ;
+                case GxB_COMPRESSION_LZ4 :
+                case GxB_COMPRESSION_LZ4HC :
+                    ok = (LZ4_decompress_safe (src, dst, (int) csize,
+                        (int) chunklen) == (int) chunklen) ;
+                    break ;
+                default :
+                case GxB_COMPRESSION_ZSTD :
+                    ok = (ZSTD_decompress (dst, chunklen, src, csize)
+                        == (size_t) chunklen) ;
+                    break ;
+            }
+            if (!ok)
+            {
+                // blob is invalid
+                GB_FREE (&X, X_size) ;
+                return (GrB_INVALID_OBJECT) ;
+            }
+            s += csize ;
+        }
+        else
+        {
+            // the chunk is unchanged: copy it from the base matrix
+            if (Base == NULL)
+            {
+                // a base matrix is required but was not provided
+                GB_FREE (&X, X_size) ;
+                return (GrB_NULL_POINTER) ;
+            }
+            if (((size_t) (kstart + chunklen)) > Base_size
+                || GB_delta_checksum (Base + kstart, chunklen)
+                    != Checks [chunkid])
+            {
+                // the base does not hold the chunk this delta expects
+                GB_FREE (&X, X_size) ;
+                return (GrB_INVALID_OBJECT) ;
+            }
+            memcpy (X + kstart, Base + kstart, chunklen) ;
+        }
+    }
+
+    (*X_handle) = X ;
+    (*X_size_handle) = X_size ;
+    (*s_handle) = s ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_deserialize_delta
+//------------------------------------------------------------------------------
+
+GrB_Info GB_deserialize_delta   // deserialize a matrix from a delta blob
+(
+    // output:
+    GrB_Matrix *Chandle,            // output matrix created from the blob
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    const GB_void *blob,            // serialized delta blob
+    size_t blob_size,               // size of the delta blob
+    const GrB_Matrix base           // base matrix holding the unchanged
+                                    // chunks, or NULL if the delta is full
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (blob != NULL && Chandle != NULL) ;
+    (*Chandle) = NULL ;
+    GrB_Matrix C = NULL ;
+
+    //--------------------------------------------------------------------------
+    // read the content of the header
+    //--------------------------------------------------------------------------
+
+    size_t s = 0 ;
+
+    if (blob_size < sizeof (uint64_t) + GB_BLOB_HEADER_SIZE)
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT)  ;
+    }
+
+    GB_BLOB_READ (magic, uint64_t) ;
+    GB_BLOB_READ (blob_size2, uint64_t) ;
+    GB_BLOB_READ (typecode, int32_t) ;
+    uint64_t blob_size1 = (uint64_t) blob_size ;
+
+    if (magic != GB_DELTA_MAGIC || blob_size1 != blob_size2
+        || typecode < GB_BOOL_code || typecode > GB_UDT_code
+        || (typecode == GB_UDT_code && blob_size <
+            sizeof (uint64_t) + GB_BLOB_HEADER_SIZE + GxB_MAX_NAME_LEN))
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT)  ;
+    }
+
+    GB_BLOB_READ (version, int32_t) ;
+    GB_BLOB_READ (vlen, int64_t) ;
+    GB_BLOB_READ (vdim, int64_t) ;
+    GB_BLOB_READ (nvec, int64_t) ;
+    GB_BLOB_READ (nvec_nonempty, int64_t) ;     ASSERT (nvec_nonempty >= 0) ;
+    GB_BLOB_READ (nvals, int64_t) ;
+    GB_BLOB_READ (typesize, int64_t) ;
+    GB_BLOB_READ (Cp_len, int64_t) ;
+    GB_BLOB_READ (Ch_len, int64_t) ;
+    GB_BLOB_READ (Cb_len, int64_t) ;
+    GB_BLOB_READ (Ci_len, int64_t) ;
+    GB_BLOB_READ (Cx_len, int64_t) ;
+    GB_BLOB_READ (hyper_switch, float) ;
+    GB_BLOB_READ (bitmap_switch, float) ;
+    GB_BLOB_READ (sparsity_control, int32_t) ;
+    GB_BLOB_READ (sparsity_iso_csc, int32_t) ;
+    GB_BLOB_READ (Cp_nchunks, int32_t) ; GB_BLOB_READ (Cp_method, int32_t) ;
+    GB_BLOB_READ (Ch_nchunks, int32_t) ; GB_BLOB_READ (Ch_method, int32_t) ;
+    GB_BLOB_READ (Cb_nchunks, int32_t) ; GB_BLOB_READ (Cb_method, int32_t) ;
+    GB_BLOB_READ (Ci_nchunks, int32_t) ; GB_BLOB_READ (Ci_method, int32_t) ;
+    GB_BLOB_READ (Cx_nchunks, int32_t) ; GB_BLOB_READ (Cx_method, int32_t) ;
+
+    int32_t sparsity = sparsity_iso_csc / 4 ;
+    bool iso = ((sparsity_iso_csc & 2) == 2) ;
+    bool is_csc = ((sparsity_iso_csc & 1) == 1) ;
+
+    //--------------------------------------------------------------------------
+    // determine the matrix type
+    //--------------------------------------------------------------------------
+
+    GB_Type_code ccode = (GB_Type_code) typecode ;
+    GrB_Type ctype = GB_code_type (ccode, type_expected) ;
+
+    // ensure the type has the right size
+    if (ctype == NULL || ctype->size != typesize)
+    {
+        // blob is invalid; type is missing or the wrong size
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    if (ccode == GB_UDT_code)
+    {
+        // user-defined name is 128 bytes, if present
+        // ensure the user-defined type has the right name
+        ASSERT (ctype == type_expected) ;
+        if (strncmp ((const char *) (blob + s), ctype->name,
+            GxB_MAX_NAME_LEN) != 0)
+        {
+            // blob is invalid
+            return (GrB_DOMAIN_MISMATCH) ;
+        }
+        s += GxB_MAX_NAME_LEN ;
+    }
+    else if (type_expected != NULL && ctype != type_expected)
+    {
+        // built-in type must match type_expected
+        // blob is invalid
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    // the base matrix, if given, must have the same type
+    if (base != NULL && base->type != ctype)
+    {
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get the chunk tables from the blob for each array
+    //--------------------------------------------------------------------------
+
+    int64_t nchunks_total = (int64_t) Cp_nchunks + Ch_nchunks + Cb_nchunks
+        + Ci_nchunks + Cx_nchunks ;
+    if (s + nchunks_total * 2 * sizeof (uint64_t) > blob_size)
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    #define GB_DELTA_TABLES(Checks,Schunks,n)                               \
+        const uint64_t *Checks = (const uint64_t *) (blob + s) ;            \
+        s += (n) * sizeof (uint64_t) ;                                      \
+        const int64_t *Schunks = (const int64_t *) (blob + s) ;             \
+        s += (n) * sizeof (int64_t) ;
+
+    GB_DELTA_TABLES (Cp_Checks, Cp_Schunks, Cp_nchunks) ;
+    GB_DELTA_TABLES (Ch_Checks, Ch_Schunks, Ch_nchunks) ;
+    GB_DELTA_TABLES (Cb_Checks, Cb_Schunks, Cb_nchunks) ;
+    GB_DELTA_TABLES (Ci_Checks, Ci_Schunks, Ci_nchunks) ;
+    GB_DELTA_TABLES (Cx_Checks, Cx_Schunks, Cx_nchunks) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the output matrix C
+    //--------------------------------------------------------------------------
+
+    // allocate the matrix with info from the header
+    GB_OK (GB_new (&C,  // new header (C is NULL on input)
+        ctype, vlen, vdim, GB_Ap_null, is_csc,
+        sparsity, hyper_switch, nvec)) ;
+
+    C->nvec = nvec ;
+    C->nvec_nonempty = nvec_nonempty ;
+    C->nvals = nvals ;      // revised below
+    C->bitmap_switch = bitmap_switch ;
+    C->sparsity_control = sparsity_control ;
+    C->iso = iso ;
+
+    // the matrix has no pending work
+    ASSERT (C->Pending == NULL) ;
+    ASSERT (C->nzombies == 0) ;
+    ASSERT (!C->jumbled) ;
+
+    //--------------------------------------------------------------------------
+    // reconstruct each array (Cp, Ch, Cb, Ci, and Cx)
+    //--------------------------------------------------------------------------
+
+    #define GB_BASE(X,X_size) \
+        ((base == NULL) ? NULL : (const GB_void *) base->X), \
+        ((base == NULL) ? 0 : base->X_size)
+
+    switch (sparsity)
+    {
+        case GxB_HYPERSPARSE :
+            // reconstruct Cp, Ch, and Ci
+            GB_OK (GB_undelta_array ((GB_void **) &(C->p), &(C->p_size),
+                Cp_len, blob, blob_size, Cp_Checks, Cp_Schunks, Cp_nchunks,
+                Cp_method, GB_BASE (p, p_size), &s)) ;
+
+            GB_OK (GB_undelta_array ((GB_void **) &(C->h), &(C->h_size),
+                Ch_len, blob, blob_size, Ch_Checks, Ch_Schunks, Ch_nchunks,
+                Ch_method, GB_BASE (h, h_size), &s)) ;
+
+            GB_OK (GB_undelta_array ((GB_void **) &(C->i), &(C->i_size),
+                Ci_len, blob, blob_size, Ci_Checks, Ci_Schunks, Ci_nchunks,
+                Ci_method, GB_BASE (i, i_size), &s)) ;
+            break ;
+
+        case GxB_SPARSE :
+
+            // reconstruct Cp and Ci
+            GB_OK (GB_undelta_array ((GB_void **) &(C->p), &(C->p_size),
+                Cp_len, blob, blob_size, Cp_Checks, Cp_Schunks, Cp_nchunks,
+                Cp_method, GB_BASE (p, p_size), &s)) ;
+
+            GB_OK (GB_undelta_array ((GB_void **) &(C->i), &(C->i_size),
+                Ci_len, blob, blob_size, Ci_Checks, Ci_Schunks, Ci_nchunks,
+                Ci_method, GB_BASE (i, i_size), &s)) ;
+            break ;
+
+        case GxB_BITMAP :
+
+            // reconstruct Cb
+            GB_OK (GB_undelta_array ((GB_void **) &(C->b), &(C->b_size),
+                Cb_len, blob, blob_size, Cb_Checks, Cb_Schunks, Cb_nchunks,
+                Cb_method, GB_BASE (b, b_size), &s)) ;
+            break ;
+
+        case GxB_FULL :
+            break ;
+        default: ;
+    }
+
+    // reconstruct Cx
+    GB_OK (GB_undelta_array ((GB_void **) &(C->x), &(C->x_size),
+        Cx_len, blob, blob_size, Cx_Checks, Cx_Schunks, Cx_nchunks,
+        Cx_method, GB_BASE (x, x_size), &s)) ;
+
+    if (C->p != NULL)
+    {
+        // use Cp [nvec] for the nvals of a sparse or hypersparse matrix,
+        // as in GB_deserialize
+        C->nvals = C->p [C->nvec] ;
+    }
+    C->magic = GB_MAGIC ;
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    (*Chandle) = C ;
+    ASSERT_MATRIX_OK (*Chandle, "Final result from deserialize_delta", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -19,6 +19,14 @@
 #include "GB_serialize.h"
 #include "GB_lz4.h"
 #include "GB_zstd.h"
+// xxHash uses switch statements with no default case.
+#if GB_COMPILER_GCC
+#pragma GCC diagnostic ignored "-Wswitch-default"
+#endif
+
+#define XXH_INLINE_ALL
+#define XXH_NO_STREAM
+#include "xxhash.h"
 
 #define GB_FREE_ALL         \
 {                           \
@@ -60,6 +68,7 @@ GrB_Info GB_deserialize_from_blob
 
     int32_t algo, level ;
     GB_serialize_method (&algo, &level, method) ;
+    bool checksum = (method >= GxB_COMPRESSION_CHECKSUM) ;
 
     //--------------------------------------------------------------------------
     // allocate the output array
@@ -145,6 +154,26 @@ GrB_Info GB_deserialize_from_blob
                 // GB_deserialize, if requested.
                 const char *src = (const char *) (blob + s + s_start) ;
                 char *dst = (char *) (X + kstart) ;
+                if (checksum)
+                {
+                    // the block ends with its own xxHash64 digest, computed
+                    // by GB_serialize_array; verify it before decompressing
+                    uint64_t digest ;
+                    if (s_size <= sizeof (uint64_t))
+                    { 
+                        // blob is invalid
+                        ok = false ;
+                        continue ;
+                    }
+                    s_size -= sizeof (uint64_t) ;
+                    memcpy (&digest, src + s_size, sizeof (uint64_t)) ;
+                    if (XXH3_64bits (src, s_size) != digest)
+                    { 
+                        // blob is corrupted
+                        ok = false ;
+                        continue ;
+                    }
+                }
                 if (algo == GxB_COMPRESSION_ZSTD)
                 { 
                     // ZSTD
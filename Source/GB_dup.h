@@ -17,6 +17,13 @@ GrB_Info GB_dup             // make an exact copy of a matrix
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_dup_shared      // C = A, sharing the arrays of A
+(
+    GrB_Matrix *Chandle,    // handle of output matrix to create
+    const GrB_Matrix A,     // input matrix to copy
+    GB_Werk Werk
+) ;
+
 GrB_Info GB_dup_worker      // make an exact copy of a matrix
 (
     GrB_Matrix *Chandle,    // output matrix, NULL or existing static/dynamic
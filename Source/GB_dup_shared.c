@@ -0,0 +1,139 @@
+//------------------------------------------------------------------------------
+// GB_dup_shared: C = A, an O(1) duplicate sharing the arrays of A
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Create a duplicate C of a matrix A in O(1) time and memory: C shares the
+// arrays of A, with each shared array registered in the share registry (see
+// GB_share.c) so that it is released only by its last owner.  A and C can
+// then be used, modified, and freed independently: any method that replaces
+// the arrays of one of them leaves the other holding the originals, and
+// methods that modify an array in place call GB_unshare first, which gives
+// them a private copy.  Any pending work on A is finished first, so the
+// duplicate is fully materialized.
+
+// If the share registry is full, a deep copy is created instead, which has
+// the same result, just not in O(1) time.
+
+// Used by GxB_Matrix_snapshot, and by GrB_Matrix_dup, GrB_Vector_dup, and
+// GrB_Scalar_dup when the GxB_DUP_SHARING global option is enabled.
+
+#include "GB.h"
+
+#define GB_FREE_ALL GB_Matrix_free (Chandle) ;
+
+GrB_Info GB_dup_shared      // C = A, sharing the arrays of A
+(
+    GrB_Matrix *Chandle,    // handle of output matrix to create
+    const GrB_Matrix A,     // input matrix to copy
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (Chandle != NULL) ;
+    (*Chandle) = NULL ;
+    ASSERT_MATRIX_OK (A, "A to duplicate by sharing", GB0) ;
+
+    //--------------------------------------------------------------------------
+    // finish any pending work, so the duplicate is fully materialized
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_MATRIX_WAIT (A) ;
+
+    if (GB_is_shallow (A) || A->p == A->p_static)
+    { 
+        // the arrays of A are not all owned by A: shallow arrays belong to
+        // another matrix or to a serialized blob, and a header-resident A->p
+        // lives inside the header of A itself.  None of these may outlive A
+        // through the share registry, so make a deep copy instead.
+        return (GB_dup (Chandle, A, Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // register the arrays of A as shared
+    //--------------------------------------------------------------------------
+
+    void *arrays [5] = { A->p, A->h, A->b, A->i, A->x } ;
+    int k ;
+    bool ok = true ;
+    for (k = 0 ; k < 5 && ok ; k++)
+    {
+        ok = (arrays [k] == NULL) || GB_share_add (arrays [k]) ;
+    }
+
+    if (!ok)
+    {
+        // the share registry is full; release what was registered and fall
+        // back to a deep copy, which is still an exact duplicate
+        for (k = k-2 ; k >= 0 ; k--)
+        {
+            if (arrays [k] != NULL)
+            {
+                GB_share_release (arrays [k]) ;
+            }
+        }
+        return (GB_dup (Chandle, A, Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the header of C
+    //--------------------------------------------------------------------------
+
+    info = GB_new (Chandle, // new dynamic header
+        A->type, A->vlen, A->vdim, GB_Ap_null, A->is_csc,
+        GB_sparsity (A), A->hyper_switch, 0) ;
+    if (info != GrB_SUCCESS)
+    {
+        // out of memory; the arrays of A are no longer shared
+        for (k = 0 ; k < 5 ; k++)
+        {
+            if (arrays [k] != NULL)
+            {
+                GB_share_release (arrays [k]) ;
+            }
+        }
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // C co-owns the arrays of A
+    //--------------------------------------------------------------------------
+
+    // Unlike GB_shallow_copy, the arrays of C are not flagged as shallow:
+    // freeing C drops one owner of each array via the share registry, and
+    // the last owner frees them for real.
+
+    GrB_Matrix C = (*Chandle) ;
+    ASSERT (C->magic == GB_MAGIC2) ;    // C not yet initialized
+    C->p = A->p ; C->p_size = A->p_size ; C->p_shallow = false ;
+    C->h = A->h ; C->h_size = A->h_size ; C->h_shallow = false ;
+    C->b = A->b ; C->b_size = A->b_size ; C->b_shallow = false ;
+    C->i = A->i ; C->i_size = A->i_size ; C->i_shallow = false ;
+    C->x = A->x ; C->x_size = A->x_size ; C->x_shallow = false ;
+    C->plen = A->plen ;
+    C->nvec = A->nvec ;
+    C->nvec_nonempty = A->nvec_nonempty ;
+    C->nvals = A->nvals ;
+    C->jumbled = A->jumbled ;
+    C->iso = A->iso ;
+    C->bitmap_switch = A->bitmap_switch ;
+    C->sparsity_control = A->sparsity_control ;
+
+    // the hyper_hash is not shared; C rebuilds its own if it is needed
+    C->Y = NULL ;
+    C->Y_shallow = false ;
+
+    C->magic = GB_MAGIC ;
+    ASSERT_MATRIX_OK (C, "C = shared duplicate of A", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
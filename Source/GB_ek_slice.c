@@ -72,6 +72,23 @@ GB_CALLBACK_EK_SLICE_PROTO (GB_ek_slice)
         return ;
     }
 
+    //--------------------------------------------------------------------------
+    // quick return for a single task
+    //--------------------------------------------------------------------------
+
+    if (ntasks == 1)
+    { 
+        // the single task owns all entries and all vectors, so skip the
+        // entry partition and the binary searches.  This keeps the fixed
+        // cost of tiny operations low, where slicing a vector with a few
+        // entries can otherwise take longer than the kernel itself.
+        pstart_slice [0] = 0 ;
+        pstart_slice [1] = anz ;
+        kfirst_slice [0] = 0 ;
+        klast_slice  [0] = anvec - 1 ;
+        return ;
+    }
+
     //--------------------------------------------------------------------------
     // find the first and last entries in each slice
     //--------------------------------------------------------------------------
@@ -0,0 +1,200 @@
+//------------------------------------------------------------------------------
+// GB_emult3: C<M> = accum (C, (A.*B).*D), fusing the two emults when possible
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_emult3 does the work for GxB_Matrix_eWiseMult3.  It computes the chained
+// element-wise multiply T = op2 (op1 (A,B), D), and then C<M> = accum (C,T).
+
+// When A, B, and D are all full, with no transpose, no typecasting, and no
+// positional ops, the two emults are fused: a single pass walks the (common)
+// pattern once and evaluates the two-operator chain per entry, so the
+// intermediate op1(A,B) is never written to memory and re-read.  This is the
+// common case for pattern-aligned scoring pipelines over dense matrices.
+// Otherwise, the computation falls back to two ordinary emults, with an
+// explicit intermediate.
+
+#define GB_FREE_ALL             \
+{                               \
+    GB_Matrix_free (&T) ;       \
+    GB_Matrix_free (&T1) ;      \
+}
+
+#include "GB_ewise.h"
+#include "GB_accum_mask.h"
+
+GrB_Info GB_emult3              // C<M> = accum (C, (A.*B).*D)
+(
+    GrB_Matrix C,               // input/output matrix for results
+    const bool C_replace,       // C descriptor
+    const GrB_Matrix M,         // optional mask for C, unused if NULL
+    const bool Mask_comp,       // M descriptor
+    const bool Mask_struct,     // if true, use the only structure of M
+    const GrB_BinaryOp accum,   // optional accum for Z=accum(C,T)
+    const GrB_BinaryOp op1,     // defines '.*' for A.*B
+    const GrB_BinaryOp op2,     // defines '.*' for (A.*B).*D
+    const GrB_Matrix A,         // first input:  matrix A
+    bool A_transpose,           // A matrix descriptor
+    const GrB_Matrix B,         // second input: matrix B
+    bool B_transpose,           // B matrix descriptor
+    const GrB_Matrix D,         // third input:  matrix D, never transposed
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    struct GB_Matrix_opaque T_header ;
+    GrB_Matrix T = NULL, T1 = NULL ;
+
+    ASSERT_MATRIX_OK (C, "C input for emult3", GB0) ;
+    ASSERT_MATRIX_OK_OR_NULL (M, "M for emult3", GB0) ;
+    ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for emult3", GB0) ;
+    ASSERT_BINARYOP_OK (op1, "op1 for emult3", GB0) ;
+    ASSERT_BINARYOP_OK (op2, "op2 for emult3", GB0) ;
+    ASSERT_MATRIX_OK (A, "A for emult3", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for emult3", GB0) ;
+    ASSERT_MATRIX_OK (D, "D for emult3", GB0) ;
+
+    // delete any lingering zombies and assemble any pending tuples
+    GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (A) ;
+    GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (B) ;
+    GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (D) ;
+
+    // check the dimensions of D against the result of op1 (A,B); all other
+    // dimension and domain checks are done by GB_ewise and GB_accum_mask
+    int64_t tnrows = (A_transpose) ? GB_NCOLS (A) : GB_NROWS (A) ;
+    int64_t tncols = (A_transpose) ? GB_NROWS (A) : GB_NCOLS (A) ;
+    if (GB_NROWS (D) != tnrows || GB_NCOLS (D) != tncols)
+    {
+        GB_ERROR (GrB_DIMENSION_MISMATCH,
+            "Dimensions not compatible:\n"
+            "first product is " GBd "-by-" GBd "\n"
+            "third input is " GBd "-by-" GBd,
+            tnrows, tncols, GB_NROWS (D), GB_NCOLS (D)) ;
+    }
+    if (GB_NROWS (C) != tnrows || GB_NCOLS (C) != tncols)
+    {
+        GB_ERROR (GrB_DIMENSION_MISMATCH,
+            "Dimensions not compatible:\n"
+            "output is " GBd "-by-" GBd "\n"
+            "input is " GBd "-by-" GBd,
+            GB_NROWS (C), GB_NCOLS (C), tnrows, tncols) ;
+    }
+
+    // check domains of C<M> = accum (C,T), with T of type op2->ztype
+    GB_OK (GB_compatible (C->type, C, M, Mask_struct, accum, op2->ztype,
+        Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // fuse the two emults if the single-pass kernel applies
+    //--------------------------------------------------------------------------
+
+    if (M == NULL && !Mask_comp && !A_transpose && !B_transpose
+        && GB_IS_FULL (A) && GB_IS_FULL (B) && GB_IS_FULL (D)
+        && !A->iso && !B->iso && !D->iso
+        && A->is_csc == C->is_csc && B->is_csc == C->is_csc
+        && D->is_csc == C->is_csc
+        && !GB_OPCODE_IS_POSITIONAL (op1->opcode)
+        && !GB_OPCODE_IS_POSITIONAL (op2->opcode)
+        && A->type == op1->xtype && B->type == op1->ytype
+        && op1->ztype == op2->xtype && D->type == op2->ytype)
+    {
+
+        //----------------------------------------------------------------------
+        // T = op2 (op1 (A,B), D) in a single pass, all matrices full
+        //----------------------------------------------------------------------
+
+        GBURBLE ("(fused emult3) ") ;
+        GrB_Type ttype = op2->ztype ;
+        int64_t anz = GB_nnz_full (A) ;
+
+        GB_CLEAR_STATIC_HEADER (T, &T_header) ;
+        GB_OK (GB_new_bix (&T, // full, static header
+            ttype, A->vlen, A->vdim, GB_Ap_null, C->is_csc, GxB_FULL, false,
+            A->hyper_switch, -1, anz, true, false)) ;
+        T->magic = GB_MAGIC ;
+
+        GxB_binary_function f1 = op1->binop_function ;
+        GxB_binary_function f2 = op2->binop_function ;
+        const GB_void *restrict Ax = (GB_void *) A->x ;
+        const GB_void *restrict Bx = (GB_void *) B->x ;
+        const GB_void *restrict Dx = (GB_void *) D->x ;
+        GB_void *restrict Tx = (GB_void *) T->x ;
+        const size_t asize = A->type->size ;
+        const size_t bsize = B->type->size ;
+        const size_t dsize = D->type->size ;
+        const size_t tsize = ttype->size ;
+        const size_t zsize = op1->ztype->size ;
+
+        int nthreads_max = GB_Context_nthreads_max ( ) ;
+        double chunk = GB_Context_chunk ( ) ;
+        int nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
+
+        int64_t p ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (p = 0 ; p < anz ; p++)
+        {
+            // z = op1 (A(i,j), B(i,j)) ; T(i,j) = op2 (z, D(i,j))
+            GB_void z [GB_VLA(zsize)] ;
+            f1 (z, Ax + (p)*asize, Bx + (p)*bsize) ;
+            f2 (Tx + (p)*tsize, z, Dx + (p)*dsize) ;
+        }
+
+        ASSERT_MATRIX_OK (T, "T = fused (A.*B).*D", GB0) ;
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // fall back to two emults, with an explicit intermediate T1
+        //----------------------------------------------------------------------
+
+        // T1 = op1 (A,B)
+        int64_t vlen = (C->is_csc) ? tnrows : tncols ;
+        int64_t vdim = (C->is_csc) ? tncols : tnrows ;
+        GB_OK (GB_new (&T1, // auto sparsity, new header
+            op1->ztype, vlen, vdim, GB_Ap_calloc, C->is_csc,
+            GxB_AUTO_SPARSITY, GB_Context_hyper_switch ( ), 1)) ;
+        GB_OK (GB_ewise (
+            T1, false,                  // T1 and its descriptor
+            NULL, false, false,         // no mask
+            NULL,                       // no accum
+            op1,                        // operator that defines '.*'
+            A, A_transpose,             // A matrix and its descriptor
+            B, B_transpose,             // B matrix and its descriptor
+            false,                      // eWiseMult
+            false, NULL, NULL,          // not eWiseUnion
+            Werk)) ;
+
+        // C<M> = accum (C, op2 (T1,D))
+        info = GB_ewise (
+            C, C_replace,               // C and its descriptor
+            M, Mask_comp, Mask_struct,  // mask and its descriptor
+            accum,                      // accumulate operator
+            op2,                        // operator that defines '.*'
+            T1, false,                  // T1, never transposed
+            D, false,                   // D, never transposed
+            false,                      // eWiseMult
+            false, NULL, NULL,          // not eWiseUnion
+            Werk) ;
+        GB_FREE_ALL ;
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // C<M> = accum (C,T): accumulate the results into C via the mask
+    //--------------------------------------------------------------------------
+
+    return (GB_accum_mask (C, M, NULL, accum, &T, C_replace, Mask_comp,
+        Mask_struct, Werk)) ;
+}
+
@@ -103,25 +103,40 @@ GrB_Info GB_emult_generic       // generic emult
 
     const GB_cast_function cast_Z_to_C =
         GB_cast_factory (ccode, op->ztype->code) ;
-    
-    // declare aij as xtype
+
+    // if no typecast is needed, aij and bij point directly into Ax and Bx,
+    // with no per-entry copy into the xwork/ywork space
+    const bool A_direct = (cast_A_to_X != NULL) && (xtype == A->type) ;
+    const bool B_direct = (cast_B_to_Y != NULL) && (ytype == B->type) ;
+
+    // declare aij as xtype, or as a pointer into Ax if no typecast is needed
     #define GB_DECLAREA(aij)                                            \
-        GB_void aij [GB_VLA(xsize)] ;
+        GB_void aij ## _work [GB_VLA(xsize)] ;                          \
+        GB_void *aij = aij ## _work ;
 
     // aij = (xtype) A(i,j), located in Ax [pA]
     #define GB_GETA(aij,Ax,pA,A_iso)                                    \
-        if (cast_A_to_X != NULL)                                        \
+        if (A_direct)                                                   \
+        {                                                               \
+            aij = (GB_void *) (Ax +((A_iso) ? 0:(pA)*asize)) ;          \
+        }                                                               \
+        else if (cast_A_to_X != NULL)                                   \
         {                                                               \
             cast_A_to_X (aij, Ax +((A_iso) ? 0:(pA)*asize), asize) ;    \
         }
 
-    // declare bij as ytype
+    // declare bij as ytype, or as a pointer into Bx if no typecast is needed
     #define GB_DECLAREB(bij)                                            \
-        GB_void bij [GB_VLA(ysize)] ;
+        GB_void bij ## _work [GB_VLA(ysize)] ;                          \
+        GB_void *bij = bij ## _work ;
 
     // bij = (ytype) B(i,j), located in Bx [pB]
     #define GB_GETB(bij,Bx,pB,B_iso)                                    \
-        if (cast_B_to_Y != NULL)                                        \
+        if (B_direct)                                                   \
+        {                                                               \
+            bij = (GB_void *) (Bx +((B_iso) ? 0:(pB)*bsize)) ;          \
+        }                                                               \
+        else if (cast_B_to_Y != NULL)                                   \
         {                                                               \
             cast_B_to_Y (bij, Bx +((B_iso) ? 0:(pB)*bsize), bsize) ;    \
         }
@@ -0,0 +1,72 @@
+//------------------------------------------------------------------------------
+// GB_enumify_bind_scalar: encode a small bound scalar for a JIT bind kernel
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The bind1st and bind2nd apply kernels pass their bound scalar to the JIT
+// kernel as a runtime argument, so the compiler sees it as an opaque memory
+// load.  For the common case of a small integer constant (multiply-by-2,
+// threshold-at-0, and the like), the value can instead be folded into the
+// kernel itself: the ewise scode has 13 unused bits above bit 50, and a
+// scalar encoded there reaches GB_macrofy_ewise through the scode, where it
+// is emitted as a compile-time constant in the generated kernel.  The scode
+// determines the kernel name and its entry in the JIT hash table, so kernels
+// bound to different scalars are distinct kernels, and a kernel is reused
+// only for the same scalar value.
+
+// Returns 0 if the scalar is not folded: zero is never a valid encoding,
+// since a scalar with value v is encoded as v+1.  Only non-negative integer
+// scalars of a builtin integer (or boolean) type, with value at most
+// GB_BIND_SCALAR_MAX, are folded; anything else remains a runtime argument.
+
+#include "GB.h"
+#include "GB_stringify.h"
+
+uint64_t GB_enumify_bind_scalar     // encode a bound scalar, 0 if not folded
+(
+    const GB_void *scalar,      // the bound scalar, typecast to type
+    const GrB_Type type         // type of the bound scalar
+)
+{
+
+    if (scalar == NULL || type == NULL)
+    {
+        return (0) ;
+    }
+
+    int64_t v ;
+    switch (type->code)
+    {
+        case GB_BOOL_code   : v = (int64_t) (*((bool     *) scalar)) ; break ;
+        case GB_INT8_code   : v = (int64_t) (*((int8_t   *) scalar)) ; break ;
+        case GB_INT16_code  : v = (int64_t) (*((int16_t  *) scalar)) ; break ;
+        case GB_INT32_code  : v = (int64_t) (*((int32_t  *) scalar)) ; break ;
+        case GB_INT64_code  : v =           (*((int64_t  *) scalar)) ; break ;
+        case GB_UINT8_code  : v = (int64_t) (*((uint8_t  *) scalar)) ; break ;
+        case GB_UINT16_code : v = (int64_t) (*((uint16_t *) scalar)) ; break ;
+        case GB_UINT32_code : v = (int64_t) (*((uint32_t *) scalar)) ; break ;
+        case GB_UINT64_code :
+        {
+            uint64_t u = (*((uint64_t *) scalar)) ;
+            if (u > GB_BIND_SCALAR_MAX) return (0) ;
+            v = (int64_t) u ;
+        }
+        break ;
+        default :
+            // floating-point, complex, and user-defined scalars are not
+            // folded; they stay a runtime kernel argument
+            return (0) ;
+    }
+
+    if (v < 0 || v > GB_BIND_SCALAR_MAX)
+    {
+        // the value does not fit in the spare scode bits
+        return (0) ;
+    }
+
+    return (((uint64_t) v) + 1) ;
+}
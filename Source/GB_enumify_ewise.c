@@ -188,7 +188,10 @@ void GB_enumify_ewise       // enumerate a GrB_eWise problem
     // construct the ewise scode
     //--------------------------------------------------------------------------
 
-    // total scode bits: 51 (13 hex digits)
+    // total scode bits: 51 (13 hex digits); the 13 bits above bit 50 are
+    // zero here, and hold the folded bound scalar for the bind1st and
+    // bind2nd apply kernels, or the folded alpha/beta default scalars for
+    // the eWiseUnion kernels (see GB_enumify_bind_scalar)
 
     (*scode) =
                                                // range        bits
@@ -25,6 +25,7 @@
 #include "GB_transpose.h"
 #include "GB_accum_mask.h"
 #include "GB_binop.h"
+#include "GB_subassign.h"
 
 GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
 (
@@ -157,6 +158,8 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
 
     // quick return if an empty mask M is complemented
     GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp, Mask_struct) ;
+    // quick return if a non-complemented mask has no entries
+    GB_RETURN_IF_EMPTY_MASK (C, C_replace, M, Mask_comp) ;
 
     //--------------------------------------------------------------------------
     // handle CSR and CSC formats
@@ -313,6 +316,7 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
 
         if (GB_IS_FULL (C)                  // C is full
         && !C->iso                          // C is not iso
+        && !GB_DEFERRED (C)                 // C has no deferred unary op
         && accum == op)                     // accum is same as the op
         { 
 
@@ -339,7 +343,20 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
 
             // C_replace is ignored
             GBURBLE ("dense C=A+B ") ;
-            info = GB_ewise_fulln (C, op, A1, B1) ;
+
+            #if defined ( GRAPHBLAS_HAS_CUDA )
+            if (GB_IS_FULL (C) && !C->iso && !GB_DEFERRED (C)
+                && GB_ewise_dense_cuda_branch (C, op, A1, B1))
+            { 
+                // via the CUDA kernel; C is already full so only its values
+                // are computed, and they stay resident on the GPU
+                info = GB_ewise_dense_cuda (C, op, A1, B1) ;
+            }
+            else
+            #endif
+            { 
+                info = GB_ewise_fulln (C, op, A1, B1) ;
+            }
 
             if (info != GrB_NO_VALUE)
             { 
@@ -349,6 +366,43 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
         }
     }
 
+    if (eWiseAdd && !is_eWiseUnion          // C = C+B (set union)
+        && (A1 == C)                        // A is aliased with C
+        && (B1 != C)                        // B is a different matrix
+        && (M == NULL) && !Mask_comp        // no mask
+        && (accum == NULL)                  // no accum
+        && !C_replace                       // C_replace is false
+        && (C->is_csc == T_is_csc)          // no transpose of C
+        && no_typecast                      // no typecasting
+        && !GB_IS_BITMAP (C)                // C is sparse, hyper, or full
+        && !GB_IS_FULL (C)                  // (the full case is handled above)
+        && !GB_DEFERRED (C)                 // C has no deferred unary op
+        && !any_iso                         // A and B are not iso
+        && !op_is_positional)               // op is not positional
+    {
+
+        //----------------------------------------------------------------------
+        // C = C+B where C is sparse or hypersparse: update C in place
+        //----------------------------------------------------------------------
+
+        // The set-union result is identical to GxB_subassign C(:,:) += B with
+        // the op as the accum operator: entries in both C and B become
+        // op(cij,bij), entries only in C are left as-is, and entries only in B
+        // are inserted into C.  The subassign methods update the values of
+        // matched entries in place and append the unmatched entries of B as
+        // pending tuples, so no temporary matrix T is constructed and the
+        // pattern and values of C are not copied when the pattern of C is a
+        // superset of the pattern of B.
+
+        GBURBLE ("in-place C=C+B ") ;
+        info = GB_subassign (C, false, NULL, false, false, false,
+            /* accum: */ op, /* A: */ B1, false,
+            GrB_ALL, GB_NROWS (C), GrB_ALL, GB_NCOLS (C),
+            false, NULL, GB_ignore_code, Werk) ;
+        GB_FREE_ALL ;
+        return (info) ;
+    }
+
     //--------------------------------------------------------------------------
     // T = A+B or A.*B, or with any mask M
     //--------------------------------------------------------------------------
@@ -356,7 +410,36 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
     bool mask_applied = false ;
     GB_CLEAR_STATIC_HEADER (T, &T_header) ;
 
-    if (eWiseAdd)
+    if ((M1 == NULL) && !Mask_comp          // no mask
+        && !A_transpose && !B_transpose     // no transpose of A or B
+        && (A1->is_csc == B1->is_csc)       // same CSR/CSC interpretation
+        && (A1->p == B1->p)                 // A and B share a single pattern
+        && (A1->h == B1->h)
+        && (A1->i == B1->i)
+        && (A1->b == B1->b)
+        && !any_iso                         // A and B are not iso
+        && (op->xtype == A1->type)          // no typecasting of A or B
+        && (op->ytype == B1->type)
+        && !op_is_positional                // op is not positional
+        && !any_pending_work)               // no matrix has pending work
+    { 
+
+        //----------------------------------------------------------------------
+        // T = A+B == A.*B where A and B have an identical pattern
+        //----------------------------------------------------------------------
+
+        // The set union and set intersection of the two patterns are both the
+        // shared pattern itself, so eWiseAdd, eWiseUnion, and eWiseMult all
+        // reduce to a single values-only pass over that pattern, with no
+        // set-union or set-intersection logic.  This is common when A and B
+        // share their pattern (as after GB_dup_shared), and also handles the
+        // case where A and B are the same matrix, or both full.
+
+        GBURBLE ("(same-pattern ewise) ") ;
+        GB_OK (GB_ewise_same_pattern (T, T_is_csc, op, A1, B1, Werk)) ;
+
+    }
+    else if (eWiseAdd)
     { 
 
         //----------------------------------------------------------------------
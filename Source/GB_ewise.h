@@ -32,6 +32,42 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
     GB_Werk Werk
 ) ;
 
+//------------------------------------------------------------------------------
+// GB_emult3: C<M> = accum (C, (A.*B).*D), fused when possible
+//------------------------------------------------------------------------------
+
+GrB_Info GB_emult3              // C<M> = accum (C, (A.*B).*D)
+(
+    GrB_Matrix C,               // input/output matrix for results
+    const bool C_replace,       // C descriptor
+    const GrB_Matrix M,         // optional mask for C, unused if NULL
+    const bool Mask_comp,       // M descriptor
+    const bool Mask_struct,     // if true, use the only structure of M
+    const GrB_BinaryOp accum,   // optional accum for Z=accum(C,T)
+    const GrB_BinaryOp op1,     // defines '.*' for A.*B
+    const GrB_BinaryOp op2,     // defines '.*' for (A.*B).*D
+    const GrB_Matrix A,         // first input:  matrix A
+    bool A_transpose,           // A matrix descriptor
+    const GrB_Matrix B,         // second input: matrix B
+    bool B_transpose,           // B matrix descriptor
+    const GrB_Matrix D,         // third input:  matrix D, never transposed
+    GB_Werk Werk
+) ;
+
+//------------------------------------------------------------------------------
+// GB_ewise_same_pattern: T = op (A,B) where A and B have an identical pattern
+//------------------------------------------------------------------------------
+
+GrB_Info GB_ewise_same_pattern  // T = op (A,B), patterns of A and B identical
+(
+    GrB_Matrix T,           // output T, of type op->ztype, static header
+    const bool T_is_csc,    // desired CSR/CSC format of T
+    const GrB_BinaryOp op,  // op to perform T = op (A,B)
+    const GrB_Matrix A,     // input A matrix
+    const GrB_Matrix B,     // input B matrix, same pattern as A
+    GB_Werk Werk
+) ;
+
 //------------------------------------------------------------------------------
 // GB_ewise_fulla: C += A+B, all 3 matrices full
 //------------------------------------------------------------------------------
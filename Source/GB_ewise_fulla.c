@@ -33,6 +33,14 @@ GrB_Info GB_ewise_fulla        // C += A+B, all matrices full
 
     GrB_Info info ;
     ASSERT_MATRIX_OK (C, "C for full C+=A+B", GB0) ;
+
+    // C->x is modified in place; if it is shared with a duplicate or
+    // snapshot, replace it with a private copy first
+    info = GB_unshare (C) ;
+    if (info != GrB_SUCCESS)
+    { 
+        return (info) ;
+    }
     ASSERT (!GB_ZOMBIES (C)) ;
     ASSERT (!GB_JUMBLED (C)) ;
     ASSERT (!GB_PENDING (C)) ;
@@ -0,0 +1,173 @@
+//------------------------------------------------------------------------------
+// GB_ewise_same_pattern: T = op (A,B) where A and B have an identical pattern
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// T = op (A,B), called only by GB_ewise, when the patterns of A and B are the
+// same object: A->p == B->p and A->i == B->i, as pointer equality.  This
+// arises when A and B share their pattern (after GB_dup_shared, or when B is
+// a shallow view of A).  In that case the set union and set intersection of
+// the two patterns are both equal to the pattern itself, so eWiseAdd,
+// eWiseUnion, and eWiseMult all reduce to a values-only operation: the
+// pattern of T is a shallow copy of the pattern of A, and T->x is computed
+// with a single loop over the k-th entries of A->x and B->x, with no
+// set-union or set-intersection logic at all.
+
+// The pattern is always a shallow copy, in the style of GB_shallow_op.  No
+// errors are checked except for out-of-memory conditions.  Shallow matrices
+// are never passed back to the user.
+
+#include "GB_ewise.h"
+
+#define GB_FREE_ALL GB_phybix_free (T) ;
+
+GrB_Info GB_ewise_same_pattern  // T = op (A,B), patterns of A and B identical
+(
+    GrB_Matrix T,           // output T, of type op->ztype, static header
+    const bool T_is_csc,    // desired CSR/CSC format of T
+    const GrB_BinaryOp op,  // op to perform T = op (A,B)
+    const GrB_Matrix A,     // input A matrix
+    const GrB_Matrix B,     // input B matrix, same pattern as A
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (T != NULL && (T->static_header || GBNSTATIC)) ;
+    ASSERT_MATRIX_OK (A, "A for same_pattern", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for same_pattern", GB0) ;
+    ASSERT_BINARYOP_OK (op, "op for same_pattern", GB0) ;
+    ASSERT (A->p == B->p && A->h == B->h && A->i == B->i && A->b == B->b) ;
+    ASSERT (A->is_csc == B->is_csc) ;
+    ASSERT (!A->iso && !B->iso) ;
+    ASSERT (!GB_ANY_PENDING_WORK (A)) ;
+    ASSERT (!GB_ANY_PENDING_WORK (B)) ;
+    ASSERT (!GB_OPCODE_IS_POSITIONAL (op->opcode)) ;
+    ASSERT (op->xtype == A->type && op->ytype == B->type) ;
+
+    GrB_Type ztype = op->ztype ;
+
+    //--------------------------------------------------------------------------
+    // construct a shallow copy of the pattern of A for the pattern of T
+    //--------------------------------------------------------------------------
+
+    // initialized the header for T, but do not allocate T->{p,h,b,i,x}
+    // T has the exact same sparsity structure as A.
+    GrB_Info info ;
+    info = GB_new (&T, // any sparsity, existing header
+        ztype, A->vlen, A->vdim, GB_Ap_null, T_is_csc,
+        GB_sparsity (A), A->hyper_switch, 0) ;
+    ASSERT (info == GrB_SUCCESS) ;
+
+    // make a shallow copy of the vector pointers
+    T->p_shallow = (A->p != NULL) ;     // T->p not freed when freeing T
+    T->h_shallow = (A->h != NULL) ;     // T->h not freed when freeing T
+    T->p = A->p ;                       // T->p is of size A->plen + 1
+    T->h = A->h ;                       // T->h is of size A->plen
+    T->p_size = A->p_size ;
+    T->h_size = A->h_size ;
+    T->plen = A->plen ;                 // T and A have the same hyperlist sizes
+    T->nvec = A->nvec ;
+    T->nvec_nonempty = A->nvec_nonempty ;
+    T->nvals = A->nvals ;
+    T->magic = GB_MAGIC ;
+
+    // make a shallow copy of the A->Y hyper_hash
+    T->Y = A->Y ;
+    T->Y_shallow = (A->Y != NULL) ;
+
+    //--------------------------------------------------------------------------
+    // check for empty matrix
+    //--------------------------------------------------------------------------
+
+    if (GB_nnz_max (A) == 0)
+    {
+        // T->p and T->h are shallow but the rest is empty
+        T->b = NULL ;
+        T->i = NULL ;
+        T->x = NULL ;
+        T->b_shallow = false ;
+        T->i_shallow = false ;
+        T->x_shallow = false ;
+        ASSERT_MATRIX_OK (T, "T = quick copy of empty A", GB0) ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // make a shallow copy of the pattern
+    //--------------------------------------------------------------------------
+
+    T->b = A->b ; T->b_shallow = (A->b != NULL) ; T->b_size = A->b_size ;
+    T->i = A->i ; T->i_shallow = (A->i != NULL) ; T->i_size = A->i_size ;
+
+    //--------------------------------------------------------------------------
+    // allocate new space for the numerical values of T
+    //--------------------------------------------------------------------------
+
+    int64_t anz = GB_nnz_held (A) ;
+    T->x = GB_XALLOC (GB_IS_BITMAP (T), false, anz,     // x:OK
+        ztype->size, &(T->x_size)) ;
+    T->x_shallow = false ;          // free T->x when freeing T
+    if (T->x == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // T(i,j) = op (A(i,j), B(i,j)) for each entry in the common pattern
+    //--------------------------------------------------------------------------
+
+    GxB_binary_function fop = op->binop_function ;
+    const GB_void *restrict Ax = (GB_void *) A->x ;
+    const GB_void *restrict Bx = (GB_void *) B->x ;
+    GB_void *restrict Tx = (GB_void *) T->x ;
+    const size_t asize = A->type->size ;
+    const size_t bsize = B->type->size ;
+    const size_t tsize = ztype->size ;
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
+
+    if (GB_IS_BITMAP (A))
+    {
+        // skip entries not present in the bitmap
+        const int8_t *restrict Ab = A->b ;
+        int64_t p ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (p = 0 ; p < anz ; p++)
+        {
+            if (Ab [p])
+            {
+                fop (Tx + (p)*tsize, Ax + (p)*asize, Bx + (p)*bsize) ;
+            }
+        }
+    }
+    else
+    {
+        // sparse, hypersparse, or full: all held entries are present
+        int64_t p ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (p = 0 ; p < anz ; p++)
+        {
+            fop (Tx + (p)*tsize, Ax + (p)*asize, Bx + (p)*bsize) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // return the result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (T, "T = same_pattern (op (A,B))", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
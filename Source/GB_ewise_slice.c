@@ -109,11 +109,19 @@ GrB_Info GB_ewise_slice
     // TaskList is reallocated.
 
     // When the mask is present, it is often fastest to break the work up
-    // into tasks, even when nthreads_max is 1.
+    // into tasks, even when nthreads_max is 1.  However, when the total work
+    // is tiny the fixed cost of the per-vector work estimate and the task
+    // builder dominates the operation itself, so a single coarse task is
+    // constructed regardless of the mask or the # of threads available.
+
+    double total_work = GB_nnz_held (A) + GB_nnz_held (B) + Cnvec +
+        ((M == NULL) ? 0 : GB_nnz_held (M)) ;
+    bool work_is_tiny = (total_work < chunk / 64) ;
 
     GB_task_struct *restrict TaskList = NULL ; size_t TaskList_size = 0 ;
     int max_ntasks = 0 ;
-    int ntasks0 = (M == NULL && nthreads_max == 1) ? 1 : (32 * nthreads_max) ;
+    int ntasks0 = ((M == NULL && nthreads_max == 1) || work_is_tiny) ?
+        1 : (32 * nthreads_max) ;
     GB_REALLOC_TASK_WORK (TaskList, ntasks0, max_ntasks) ;
 
     //--------------------------------------------------------------------------
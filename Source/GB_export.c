@@ -111,6 +111,27 @@ GrB_Info GB_export      // export/unpack a matrix in any format
         default: ;
     }
 
+    //--------------------------------------------------------------------------
+    // move a header-resident A->p to the heap if it is being handed out
+    //--------------------------------------------------------------------------
+
+    if (s == GxB_SPARSE && !is_sparse_vector && (*A)->p == (*A)->p_static)
+    {
+        // A is a single sparse vector whose A->p is resident in its header
+        // (see GB_matrix.h), but the caller will take ownership of Ap, which
+        // must outlive the header: give A a freeable heap copy first
+        int64_t *Ap_heap = NULL ; size_t Ap_heap_size = 0 ;
+        Ap_heap = GB_MALLOC ((*A)->plen+1, int64_t, &Ap_heap_size) ;
+        if (Ap_heap == NULL)
+        { 
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        memcpy (Ap_heap, (*A)->p, ((*A)->plen+1) * sizeof (int64_t)) ;
+        (*A)->p = Ap_heap ;
+        (*A)->p_size = Ap_heap_size ;
+    }
+
     //--------------------------------------------------------------------------
     // allocate new space for Ap and Ah if unpacking
     //--------------------------------------------------------------------------
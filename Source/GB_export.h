@@ -56,6 +56,12 @@ GrB_Info GB_import      // import/pack a matrix in any format
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_import_validate     // check the content of an imported matrix
+(
+    GrB_Matrix A,               // matrix with imported content to check
+    GB_Werk Werk
+) ;
+
 GrB_Info GB_export      // export/unpack a matrix in any format
 (
     bool unpacking,     // unpack if true, export and free if false
@@ -37,6 +37,8 @@ GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
     const GrB_Index nRows_in,       // number of row indices
     const GrB_Index *Cols,          // column indices
     const GrB_Index nCols_in,       // number of column indices
+    const GxB_IndexList Row_list,   // cached analysis of Rows, or NULL
+    const GxB_IndexList Col_list,   // cached analysis of Cols, or NULL
     GB_Werk Werk
 )
 {
@@ -94,6 +96,8 @@ GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
 
     // quick return if an empty mask is complemented
     GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp, Mask_struct) ;
+    // quick return if a non-complemented mask has no entries
+    GB_RETURN_IF_EMPTY_MASK (C, C_replace, M, Mask_comp) ;
 
     // delete any lingering zombies and assemble any pending tuples
     GB_MATRIX_WAIT (M) ;        // cannot be jumbled
@@ -109,6 +113,7 @@ GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
 
     const GrB_Index *I, *J ;
     int64_t ni, nj ;
+    GxB_IndexList I_list ;
     bool T_is_csc ;
 
     if (A->is_csc)
@@ -119,6 +124,7 @@ GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
             I = Rows ; ni = nRows_in ;  // indices into the vectors
             J = Cols ; nj = nCols_in ;  // vectors
             T_is_csc = true ;           // return T in CSC format
+            I_list = Row_list ;
         }
         else
         { 
@@ -126,6 +132,7 @@ GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
             I = Cols ; ni = nCols_in ;  // indices into the vectors
             J = Rows ; nj = nRows_in ;  // vectors
             T_is_csc = false ;          // return T in CSR format
+            I_list = Col_list ;
         }
     }
     else
@@ -136,6 +143,7 @@ GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
             I = Cols ; ni = nCols_in ;  // indices into the vectors
             J = Rows ; nj = nRows_in ;  // vectors
             T_is_csc = false ;          // return T in CSR format
+            I_list = Col_list ;
         }
         else
         { 
@@ -143,6 +151,7 @@ GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
             I = Rows ; ni = nRows_in ;  // indices into the vectors
             J = Cols ; nj = nCols_in ;  // vectors
             T_is_csc = true ;           // return T in CSC format
+            I_list = Row_list ;
         }
     }
 
@@ -163,7 +172,8 @@ GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
     // TODO::: iso:  if accum is PAIR, extract T as iso
 
     GB_CLEAR_STATIC_HEADER (T, &T_header) ;
-    GB_OK (GB_subref (T, false, T_is_csc, A, I, ni, J, nj, false, Werk)) ;
+    GB_OK (GB_subref (T, false, T_is_csc, A, I, ni, J, nj, false, I_list,
+        Werk)) ;
     ASSERT_MATRIX_OK (T, "T extracted", GB0) ;
     ASSERT (GB_JUMBLED_OK (T)) ;
 
@@ -25,6 +25,8 @@ GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
     const GrB_Index nRows_in,       // number of row indices
     const GrB_Index *Cols,          // column indices
     const GrB_Index nCols_in,       // number of column indices
+    const GxB_IndexList Row_list,   // cached analysis of Rows, or NULL
+    const GxB_IndexList Col_list,   // cached analysis of Cols, or NULL
     GB_Werk Werk
 ) ;
 
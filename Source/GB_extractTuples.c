@@ -24,9 +24,7 @@
 
 #define GB_FREE_ALL                             \
 {                                               \
-    GB_Matrix_free (&T) ;                       \
     GB_FREE_WORK (&Ap, Ap_size) ;               \
-    GB_FREE_WORK (&X_bitmap, X_bitmap_size) ;   \
 }
 
 GrB_Info GB_extractTuples       // extract all tuples from a matrix
@@ -46,10 +44,7 @@ GrB_Info GB_extractTuples       // extract all tuples from a matrix
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
-    struct GB_Matrix_opaque T_header ;
-    GrB_Matrix T = NULL ;
-    GB_void *restrict X_bitmap = NULL ; size_t X_bitmap_size = 0 ;
-    int64_t *restrict Ap       = NULL ; size_t Ap_size = 0 ;
+    int64_t *restrict Ap = NULL ; size_t Ap_size = 0 ;
 
     ASSERT_MATRIX_OK (A, "A to extract", GB0) ;
     ASSERT (p_nvals != NULL) ;
@@ -119,15 +114,8 @@ GrB_Info GB_extractTuples       // extract all tuples from a matrix
         // allocate workspace
         //----------------------------------------------------------------------
 
-        bool need_typecast = (X != NULL) && (xcode != acode) ;
-        if (need_typecast)
-        { 
-            // X must be typecasted
-            int64_t anzmax = GB_IMAX (anz, 1) ;
-            X_bitmap = GB_MALLOC_WORK (anzmax*asize, GB_void, &X_bitmap_size) ;
-        }
         Ap = GB_MALLOC_WORK (A->vdim+1, int64_t, &Ap_size) ;
-        if (Ap == NULL || (need_typecast && X_bitmap == NULL))
+        if (Ap == NULL)
         { 
             // out of memory
             GB_FREE_ALL ;
@@ -138,37 +126,13 @@ GrB_Info GB_extractTuples       // extract all tuples from a matrix
         // extract the tuples
         //----------------------------------------------------------------------
 
-        // TODO: pass xcode to GB_convert_bitmap_worker and let it do the
-        // typecasting.  This works for now, however.
-
-        // if A is iso, GB_convert_bitmap_worker expands the iso scalar
-        // into its result, X or X_bitmap
+        // The tuples are gathered directly into the caller's I, J, and X
+        // arrays, with no intermediate copy of the matrix or its values.  If
+        // A is iso, GB_convert_bitmap_worker expands the iso scalar into X,
+        // and the values are typecasted to xcode during the gather.
 
         GB_OK (GB_convert_bitmap_worker (Ap, (int64_t *) I, (int64_t *) J,
-            (GB_void *) (need_typecast ? X_bitmap : X), NULL, A, Werk)) ;
-
-        //----------------------------------------------------------------------
-        // typecast X if needed
-        //----------------------------------------------------------------------
-
-        if (need_typecast)
-        { 
-            // typecast the values from X_bitmap into X, using a temporary
-            // full anz-by-1 matrix T
-            ASSERT (X != NULL) ;
-            ASSERT (xcode != acode) ;
-            GB_CLEAR_STATIC_HEADER (T, &T_header) ;
-            GB_OK (GB_new (&T, // full, existing header
-                A->type, anz, 1, GB_Ap_null, true, GxB_FULL, 0, 0)) ;
-            T->x = X_bitmap ;
-            T->x_shallow = true ;
-            T->magic = GB_MAGIC ;
-            T->plen = -1 ;
-            T->nvec = 1 ;
-            ASSERT_MATRIX_OK (T, "T to cast_array", GB0) ;
-            GB_OK (GB_cast_array ((GB_void *) X, xcode, T, nthreads)) ;
-            GB_Matrix_free (&T) ;
-        }
+            (GB_void *) X, NULL, xcode, A, Werk)) ;
 
     }
     else
@@ -95,6 +95,48 @@ static bool GB_file_lock (FILE *fp, int fd)
     #endif
 }
 
+//------------------------------------------------------------------------------
+// GB_file_trylock:  try to lock a file for exclusive writing, without waiting
+//------------------------------------------------------------------------------
+
+// Returns true if the lock was acquired.  On failure, busy is set to true if
+// the lock is currently held by another process, and false for any other
+// error.  On Windows there is no try-variant of _lock_file, so this call
+// blocks as GB_file_lock does, and busy is always returned as false.
+
+static bool GB_file_trylock (FILE *fp, int fd, bool *busy)
+{
+    (*busy) = false ;
+    #ifdef NJIT
+    {
+        // JIT disabled
+        return (false) ;
+    }
+    #elif GB_WINDOWS
+    {
+        // lock file for Windows
+        _lock_file (fp) ;
+        return (true) ;
+    }
+    #else
+    {
+        // try to lock file for POSIX, without blocking
+        struct flock lock ;
+        lock.l_type = F_WRLCK ;
+        lock.l_whence = SEEK_SET ;
+        lock.l_start = 0 ;
+        lock.l_len = 0 ;
+        lock.l_pid = 0 ;
+        if (fcntl (fd, F_SETLK, &lock) == 0)
+        {
+            return (true) ;
+        }
+        (*busy) = (errno == EACCES || errno == EAGAIN) ;
+        return (false) ;
+    }
+    #endif
+}
+
 //------------------------------------------------------------------------------
 // GB_file_unlock:  unlock a file
 //------------------------------------------------------------------------------
@@ -191,6 +233,76 @@ bool GB_file_open_and_lock  // true if successful, false on error
     #endif
 }
 
+//------------------------------------------------------------------------------
+// GB_file_open_and_trylock:  open and try to lock a file, without waiting
+//------------------------------------------------------------------------------
+
+// Identical to GB_file_open_and_lock, except that it does not wait if the
+// lock is held by another process.  In that case it returns false with busy
+// set to true, and the caller can do something else rather than waiting.
+
+bool GB_file_open_and_trylock   // true if successful, false on error or busy
+(
+    // input
+    char *filename,     // full path to file to open
+    // output
+    FILE **fp_handle,   // file pointer of open file (NULL on error)
+    int *fd_handle,     // file descriptor of open file (-1 on error)
+    bool *busy          // true if the lock is held by another process
+)
+{
+
+    #ifdef NJIT
+    {
+        // JIT disabled
+        return (false) ;
+    }
+    #else
+    {
+        if (filename == NULL || fp_handle == NULL || fd_handle == NULL ||
+            busy == NULL)
+        {
+            // failure: inputs invalid
+            return (false) ;
+        }
+
+        (*fp_handle) = NULL ;
+        (*fd_handle) = -1 ;
+        (*busy) = false ;
+
+        // open the file, creating it if it doesn't exist
+        int fd = GB_OPEN (filename, GB_READ_WRITE, GB_MODE) ;
+        if (fd == -1)
+        {
+            // failure: file does not exist or cannot be created
+            return (false) ;
+        }
+
+        // get the file pointer from the file descriptor
+        FILE *fp = GB_FDOPEN (fd, "w+") ;
+        if (fp == NULL)
+        {
+            // failure: cannot create file pointer from file descriptor
+            GB_CLOSE (fd) ;
+            return (false) ;
+        }
+
+        // try to lock the file, without waiting
+        if (!GB_file_trylock (fp, fd, busy))
+        {
+            // failure: cannot lock the file, or it is locked elsewhere
+            fclose (fp) ;
+            return (false) ;
+        }
+
+        // success: file exists, is open, and is locked for writing
+        (*fp_handle) = fp ;
+        (*fd_handle) = fd ;
+        return (true) ;
+    }
+    #endif
+}
+
 //------------------------------------------------------------------------------
 // GB_file_unlock_and_close:  unlock and close a file
 //------------------------------------------------------------------------------
@@ -296,6 +408,59 @@ bool GB_file_mkdir (char *path)
     #endif
 }
 
+//------------------------------------------------------------------------------
+// GB_file_copy: copy a file
+//------------------------------------------------------------------------------
+
+// Copy the file src to the file dst, replacing dst if it already exists.
+// Returns true if the whole file was copied, false on any I/O error (in which
+// case dst may be a partial copy, and the caller should remove it).  The copy
+// is not atomic; for an atomic update the caller must copy to a temporary
+// name and then rename it into place.
+
+bool GB_file_copy (char *src, char *dst)
+{
+    if (src == NULL || dst == NULL)
+    {
+        // invalid input
+        return (false) ;
+    }
+
+    #ifdef NJIT
+    {
+        // JIT disabled
+        return (false) ;
+    }
+    #else
+    {
+        FILE *fsrc = fopen (src, "rb") ;
+        if (fsrc == NULL)
+        {
+            // source file does not exist or cannot be read
+            return (false) ;
+        }
+        FILE *fdst = fopen (dst, "wb") ;
+        if (fdst == NULL)
+        {
+            // cannot create the destination file
+            fclose (fsrc) ;
+            return (false) ;
+        }
+        char buffer [4096] ;
+        bool ok = true ;
+        size_t nread ;
+        while (ok && (nread = fread (buffer, 1, sizeof (buffer), fsrc)) > 0)
+        {
+            ok = (fwrite (buffer, 1, nread, fdst) == nread) ;
+        }
+        ok = ok && !ferror (fsrc) ;
+        ok = (fclose (fdst) == 0) && ok ;
+        fclose (fsrc) ;
+        return (ok) ;
+    }
+    #endif
+}
+
 //------------------------------------------------------------------------------
 // GB_file_dlopen: open a dynamic library
 //------------------------------------------------------------------------------
@@ -32,6 +32,16 @@ bool GB_file_open_and_lock  // true if successful, false on error
     int *fd_handle      // file descriptor of open file (-1 on error)
 ) ;
 
+bool GB_file_open_and_trylock   // true if successful, false on error or busy
+(
+    // input
+    char *filename,     // full path to file to open
+    // output
+    FILE **fp_handle,   // file pointer of open file (NULL on error)
+    int *fd_handle,     // file descriptor of open file (-1 on error)
+    bool *busy          // true if the lock is held by another process
+) ;
+
 bool GB_file_unlock_and_close   // true if successful, false on error
 (
     // input/output
@@ -41,6 +51,8 @@ bool GB_file_unlock_and_close   // true if successful, false on error
 
 bool GB_file_mkdir (char *path) ;
 
+bool GB_file_copy (char *src, char *dst) ;
+
 void *GB_file_dlopen (char *library_name) ;
 
 void *GB_file_dlsym (void *dl_handle, char *symbol) ;
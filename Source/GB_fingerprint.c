@@ -0,0 +1,288 @@
+//------------------------------------------------------------------------------
+// GB_fingerprint: compute and cache the content fingerprint of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The fingerprint is an XXH3 hash over the arrays that hold the matrix
+// content (Ap, Ah, Ab, Ai, and Ax), together with its dimensions, type, and
+// sparsity format.  Pending work must be finished before the hash is
+// computed, so that the arrays are in their canonical form (no zombies, no
+// pending tuples, sorted indices).
+
+// The hash is cached in A->fingerprint, and any method that modifies the
+// matrix clears it (GB_fingerprint_clear), so a repeated query of an
+// unchanged matrix is O(1) and does not reread the arrays.
+
+// Each large array is hashed in fixed-size blocks in parallel, and the block
+// hashes are themselves hashed.  The block size is a constant, so the result
+// does not depend on the number of threads used.
+
+#include "GB.h"
+
+// xxHash uses switch statements with no default case.
+#if GB_COMPILER_GCC
+#pragma GCC diagnostic ignored "-Wswitch-default"
+#endif
+
+#define XXH_INLINE_ALL
+#include "xxhash.h"
+
+// bytes hashed per block; a constant, so that the fingerprint is independent
+// of the number of threads
+#define GB_FINGERPRINT_BLOCK (8 * 1024 * 1024)
+
+//------------------------------------------------------------------------------
+// GB_fingerprint_clear: invalidate the cached fingerprint of a matrix
+//------------------------------------------------------------------------------
+
+void GB_fingerprint_clear       // invalidate the cached fingerprint
+(
+    GrB_Matrix A                // matrix being modified; may be NULL
+)
+{
+    if (A != NULL)
+    {
+        A->fingerprint_ok = false ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_fingerprint_array: block-parallel XXH3 hash of a single array
+//------------------------------------------------------------------------------
+
+static uint64_t GB_fingerprint_array
+(
+    const void *x,              // array to hash; may be NULL
+    size_t nbytes,              // # of bytes to hash
+    int nthreads_max,
+    double chunk
+)
+{
+    if (x == NULL || nbytes == 0)
+    {
+        return (0) ;
+    }
+
+    int64_t nblocks = GB_ICEIL ((int64_t) nbytes, GB_FINGERPRINT_BLOCK) ;
+    int nthreads = GB_nthreads ((int64_t) nbytes, chunk, nthreads_max) ;
+
+    if (nblocks == 1 || nthreads == 1)
+    {
+        // a single block, or a single thread: hash the array directly
+        return (XXH3_64bits (x, nbytes)) ;
+    }
+
+    size_t Blockhash_size = 0 ;
+    uint64_t *Blockhash = GB_MALLOC_WORK (nblocks, uint64_t,
+        &Blockhash_size) ;
+    if (Blockhash == NULL)
+    {
+        // out of memory for the block hashes; hash sequentially instead
+        return (XXH3_64bits (x, nbytes)) ;
+    }
+
+    nthreads = GB_IMIN (nthreads, nblocks) ;
+    int64_t b ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (b = 0 ; b < nblocks ; b++)
+    {
+        size_t pstart = ((size_t) b) * GB_FINGERPRINT_BLOCK ;
+        size_t blocksize = GB_IMIN (nbytes - pstart,
+            (size_t) GB_FINGERPRINT_BLOCK) ;
+        Blockhash [b] = XXH3_64bits (((const char *) x) + pstart, blocksize) ;
+    }
+
+    uint64_t hash = XXH3_64bits (Blockhash, nblocks * sizeof (uint64_t)) ;
+    GB_FREE_WORK (&Blockhash, Blockhash_size) ;
+    return (hash) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_fingerprint_bitmap_values: hash the values present in a bitmap matrix
+//------------------------------------------------------------------------------
+
+// Positions with Ab [p] == 0 hold stale bytes, so hashing all of Ax would
+// give a different fingerprint for identical content.  Instead, each block
+// streams the runs of present entries through an XXH3 state, skipping the
+// gaps; a block with no entries present hashes to zero.
+
+static uint64_t GB_fingerprint_bitmap_values
+(
+    const GB_void *Ax,          // values, of size (vlen*vdim)*asize
+    const int8_t *Ab,           // bitmap, of size vlen*vdim
+    const int64_t anz_held,     // vlen*vdim
+    const size_t asize,         // size of each entry
+    int nthreads_max,
+    double chunk
+)
+{
+    // # of entries per block, a constant for a given type size
+    const int64_t bsize = GB_IMAX (1,
+        GB_FINGERPRINT_BLOCK / ((int64_t) asize)) ;
+    const int64_t nblocks = GB_ICEIL (anz_held, bsize) ;
+
+    size_t Blockhash_size = 0 ;
+    uint64_t *Blockhash = NULL ;
+    int nthreads = GB_nthreads (anz_held * asize, chunk, nthreads_max) ;
+    nthreads = GB_IMIN (nthreads, nblocks) ;
+    if (nthreads > 1)
+    {
+        Blockhash = GB_MALLOC_WORK (nblocks, uint64_t, &Blockhash_size) ;
+    }
+
+    if (Blockhash == NULL)
+    {
+        // a single thread: stream all runs through one state
+        XXH3_state_t state ;
+        XXH3_64bits_reset (&state) ;
+        for (int64_t p = 0 ; p < anz_held ; )
+        {
+            if (!Ab [p]) { p++ ; continue ; }
+            int64_t pend = p ;
+            while (pend < anz_held && Ab [pend]) pend++ ;
+            XXH3_64bits_update (&state, Ax + p * asize,
+                (pend - p) * asize) ;
+            p = pend ;
+        }
+        return (XXH3_64bits_digest (&state)) ;
+    }
+
+    int64_t b ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (b = 0 ; b < nblocks ; b++)
+    {
+        const int64_t pstart = b * bsize ;
+        const int64_t plast = GB_IMIN (pstart + bsize, anz_held) ;
+        XXH3_state_t state ;
+        XXH3_64bits_reset (&state) ;
+        bool any = false ;
+        for (int64_t p = pstart ; p < plast ; )
+        {
+            if (!Ab [p]) { p++ ; continue ; }
+            int64_t pend = p ;
+            while (pend < plast && Ab [pend]) pend++ ;
+            XXH3_64bits_update (&state, Ax + p * asize,
+                (pend - p) * asize) ;
+            any = true ;
+            p = pend ;
+        }
+        Blockhash [b] = (any) ? XXH3_64bits_digest (&state) : 0 ;
+    }
+
+    uint64_t hash = XXH3_64bits (Blockhash, nblocks * sizeof (uint64_t)) ;
+    GB_FREE_WORK (&Blockhash, Blockhash_size) ;
+    return (hash) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_fingerprint: compute and cache the fingerprint of a matrix
+//------------------------------------------------------------------------------
+
+GrB_Info GB_fingerprint         // compute and cache the fingerprint of A
+(
+    GrB_Matrix A,               // matrix to hash; pending work is finished
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A for GB_fingerprint", GB0) ;
+    ASSERT (!GB_ZOMBIES (A)) ;
+    ASSERT (!GB_JUMBLED (A)) ;
+    ASSERT (!GB_PENDING (A)) ;
+
+    if (A->fingerprint_ok)
+    {
+        // the cached fingerprint is still valid
+        return (GrB_SUCCESS) ;
+    }
+
+    GBURBLE ("(fingerprint) ") ;
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+
+    //--------------------------------------------------------------------------
+    // gather the scalars and the hash of each array
+    //--------------------------------------------------------------------------
+
+    const size_t asize = A->type->size ;
+    const int64_t anz = GB_nnz (A) ;
+
+    uint64_t Digest [16] ;
+    int k = 0 ;
+
+    Digest [k++] = (uint64_t) A->vlen ;
+    Digest [k++] = (uint64_t) A->vdim ;
+    Digest [k++] = (uint64_t) A->type->code ;
+    Digest [k++] = (uint64_t) asize ;
+    Digest [k++] = (uint64_t) A->is_csc ;
+    Digest [k++] = (uint64_t) A->iso ;
+    Digest [k++] = (uint64_t) GB_sparsity (A) ;
+
+    if (A->type->code == GB_UDT_code)
+    {
+        // user-defined types of the same size are distinguished by name
+        Digest [k++] = XXH3_64bits (A->type->name,
+            strlen (A->type->name)) ;
+    }
+
+    // Ap and Ah, for sparse and hypersparse matrices
+    Digest [k++] = GB_fingerprint_array (A->p,
+        (A->p == NULL) ? 0 : (A->nvec + 1) * sizeof (int64_t),
+        nthreads_max, chunk) ;
+    Digest [k++] = GB_fingerprint_array (A->h,
+        (A->h == NULL) ? 0 : A->nvec * sizeof (int64_t),
+        nthreads_max, chunk) ;
+
+    // Ab, for bitmap matrices
+    Digest [k++] = GB_fingerprint_array (A->b,
+        (A->b == NULL) ? 0 : A->vlen * A->vdim,
+        nthreads_max, chunk) ;
+
+    // Ai, for sparse and hypersparse matrices
+    Digest [k++] = GB_fingerprint_array (A->i,
+        (A->i == NULL) ? 0 : anz * sizeof (int64_t),
+        nthreads_max, chunk) ;
+
+    // Ax: a single entry if iso; for a non-iso bitmap matrix only the
+    // entries present in the bitmap are hashed, since the gaps hold stale
+    // bytes that are not part of the content
+    if (A->x == NULL)
+    {
+        Digest [k++] = 0 ;
+    }
+    else if (A->iso)
+    {
+        Digest [k++] = GB_fingerprint_array (A->x, asize,
+            nthreads_max, chunk) ;
+    }
+    else if (GB_IS_BITMAP (A))
+    {
+        Digest [k++] = GB_fingerprint_bitmap_values ((GB_void *) A->x,
+            A->b, GB_nnz_held (A), asize, nthreads_max, chunk) ;
+    }
+    else
+    {
+        // sparse, hypersparse, or full: the first anz entries are the values
+        Digest [k++] = GB_fingerprint_array (A->x,
+            GB_nnz_held (A) * asize, nthreads_max, chunk) ;
+    }
+
+    ASSERT (k <= 16) ;
+
+    //--------------------------------------------------------------------------
+    // the fingerprint is the hash of the digest
+    //--------------------------------------------------------------------------
+
+    A->fingerprint = XXH3_64bits (Digest, k * sizeof (uint64_t)) ;
+    A->fingerprint_ok = true ;
+    return (GrB_SUCCESS) ;
+}
@@ -17,8 +17,40 @@
 GB_CALLBACK_FREE_MEMORY_PROTO (GB_free_memory)
 {
     if (p != NULL && (*p) != NULL)
-    { 
+    {
         ASSERT (size_allocated == GB_Global_memtable_size (*p)) ;
+        if (GB_share_release (*p))
+        {
+            // the block is shared with a snapshot; another owner still holds
+            // it, so it is not freed (nor uncounted) here
+            (*p) = NULL ;
+            return ;
+        }
+        GB_Global_memory_in_use_adjust (-((int64_t) size_allocated)) ;
+        if (GB_Global_profiling_get ( ))
+        {
+            GB_prof_memory (-((int64_t) size_allocated)) ;
+        }
+        if (GB_Context_dealloc (*p, size_allocated))
+        {
+            // the block has been freed by the allocator of the Context
+            // engaged to this user thread
+            (*p) = NULL ;
+            return ;
+        }
+        if (GB_spill_free (*p, size_allocated))
+        {
+            // the block was backed by a file mapping, now unmapped
+            (*p) = NULL ;
+            return ;
+        }
+        if (GB_pool_put (*p, size_allocated))
+        {
+            // the block has been returned to the free pool, to be recycled
+            // by a later GB_malloc_memory of the same size class
+            (*p) = NULL ;
+            return ;
+        }
         #ifdef GB_MEMDUMP
         printf ("\nhard free %p %ld\n", *p, size_allocated) ;   // MEMDUMP
         #endif
@@ -0,0 +1,91 @@
+//------------------------------------------------------------------------------
+// GB_full_shallow: create a full shallow version of an all-entry matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A matrix with all entries present (GB_as_if_full) holds its values densely,
+// in vector order, regardless of its sparsity structure: a bitmap matrix with
+// every Ab [p] == 1, or a sparse or hypersparse matrix with every entry
+// present, has the same A->x as the full version of the same matrix.  This
+// method constructs C as a full shallow view of such a matrix, in O(1) time
+// and with no memory allocated: only A->x is kept, flagged as shallow, and
+// the pattern is dropped.  A is not modified.
+
+// On input C must exist but the content of the C header is uninitialized
+// except for C->static_header and C->header_size.  If A is iso then so is C.
+
+#include "GB.h"
+#include "GB_convert.h"
+
+GrB_Matrix GB_full_shallow          // return C
+(
+    GrB_Matrix C,                   // output full matrix
+    const GrB_Matrix A              // input all-entry matrix, not modified
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "full_shallow input", GB0) ;
+    ASSERT (C != NULL && (C->static_header || GBNSTATIC)) ;
+    ASSERT (!GB_IS_FULL (A)) ;
+    ASSERT (GB_as_if_full (A)) ;
+
+    //--------------------------------------------------------------------------
+    // construct the full_shallow version
+    //--------------------------------------------------------------------------
+
+    // save the C header status
+    bool C_static_header = C->static_header ;
+    bool C_header_size = C->header_size ;
+
+    // copy the header
+    memcpy (C, A, sizeof (struct GB_Matrix_opaque)) ;
+
+    // restore the C header status
+    C->static_header = C_static_header  ;
+    C->header_size = C_header_size ;
+
+    // remove the pattern and the hyper_hash; only the values remain
+    C->p = NULL ;
+    C->p_shallow = false ;
+    C->h = NULL ;
+    C->h_shallow = false ;
+    C->b = NULL ;
+    C->b_shallow = false ;
+    C->i = NULL ;
+    C->i_shallow = false ;
+    C->Y = NULL ;
+    C->Y_shallow = false ;
+    C->degree = NULL ;
+    C->degree_size = 0 ;
+    C->lookup_p = NULL ;
+    C->lookup_p_size = 0 ;
+    C->lookup_e = NULL ;
+    C->lookup_e_size = 0 ;
+    C->lookup_nbuckets = 0 ;
+
+    // flag the values of C as shallow
+    C->x_shallow = true ;
+
+    // C is full
+    C->plen = -1 ;
+    C->nvec = C->vdim ;
+    C->nvec_nonempty = (C->vlen > 0) ? C->vdim : 0 ;
+    C->nvals = GB_nnz_full (C) ;
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (C, "full_shallow output", GB0) ;
+    ASSERT (GB_IS_FULL (C)) ;
+    return (C) ;
+}
+
@@ -54,6 +54,16 @@ GrB_Info GB_hyper_hash_build    // construct A->Y if not already constructed
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_hyper_hash_update   // update A->Y after a hyperlist splice
+(
+    GrB_Matrix A,               // matrix with a spliced hyperlist
+    const int64_t kA,           // start of the replaced region of A->h
+    const int64_t kA2_old,      // end of the replaced region (exclusive),
+                                // in the old hyperlist
+    const int64_t anvec_old,    // # of vectors in the old hyperlist
+    GB_Werk Werk
+) ;
+
 //------------------------------------------------------------------------------
 // GB_lookup: find k so that j == Ah [k], without using the A->Y hyper_hash
 //------------------------------------------------------------------------------
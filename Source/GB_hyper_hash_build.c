@@ -154,6 +154,9 @@ GrB_Info GB_hyper_hash_build    // construct A->Y if not already constructed
     // return result
     //--------------------------------------------------------------------------
 
+    // record the build for GxB_Matrix_advise
+    A->yhash_builds++ ;
+
     ASSERT_MATRIX_OK (A, "A from hyper_hash", GB0) ;
     ASSERT (!GB_ZOMBIES (Y)) ;
     ASSERT (!GB_JUMBLED (Y)) ;
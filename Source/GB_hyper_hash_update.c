@@ -0,0 +1,348 @@
+//------------------------------------------------------------------------------
+// GB_hyper_hash_update: incrementally update A->Y after a hyperlist splice
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// A->h has been modified by a splice: the vectors in positions [kA, kA2_old)
+// of the old hyperlist (which had anvec_old vectors) have been replaced by a
+// new set of vectors, now in positions [kA, kA + nmid) of A->h, and the
+// vectors past the spliced region have shifted position by delta =
+// A->nvec - anvec_old.  The prefix [0, kA) is unchanged.  This is the form
+// of update done by GB_wait when it splices assembled pending tuples into A.
+
+// Rather than freeing A->Y and rebuilding it from scratch (hashing and
+// sorting all A->nvec vectors), the existing hash matrix is updated in
+// place: the positions held in Y->x are shifted for the unchanged suffix,
+// positions of surviving spliced vectors are reassigned, new vectors are
+// inserted into their hash buckets, and vectors no longer in A->h are
+// deleted.  The cost is O(nnz(Y)) in the worst case but with no sort and no
+// rebuild, and the pattern of Y is untouched entirely when the splice
+// introduces and removes no vectors.
+
+// If the update would degrade the hash table (load factor above 4), or if
+// A->Y is shallow and cannot be modified, A->Y is freed instead and will be
+// rebuilt by GB_hyper_hash_build when next needed.  If A has no hyper_hash
+// (including the case where A is sparse, not hypersparse), nothing is done.
+
+#define GB_FREE_WORKSPACE               \
+{                                       \
+    GB_FREE_WORK (&I_ins, I_ins_size) ; \
+    GB_FREE_WORK (&K_ins, K_ins_size) ; \
+    GB_FREE_WORK (&I_srt, I_srt_size) ; \
+    GB_FREE_WORK (&K_srt, K_srt_size) ; \
+    GB_FREE_WORK (&W, W_size) ;         \
+    GB_FREE_WORK (&W2, W2_size) ;       \
+}
+
+#define GB_FREE_ALL                     \
+{                                       \
+    GB_FREE_WORKSPACE ;                 \
+    GB_hyper_hash_free (A) ;            \
+}
+
+#include "GB.h"
+
+GrB_Info GB_hyper_hash_update   // update A->Y after a hyperlist splice
+(
+    GrB_Matrix A,               // matrix with a spliced hyperlist
+    const int64_t kA,           // start of the replaced region of A->h
+    const int64_t kA2_old,      // end of the replaced region (exclusive),
+                                // in the old hyperlist
+    const int64_t anvec_old,    // # of vectors in the old hyperlist
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    int64_t *restrict I_ins = NULL ; size_t I_ins_size = 0 ;
+    int64_t *restrict K_ins = NULL ; size_t K_ins_size = 0 ;
+    int64_t *restrict I_srt = NULL ; size_t I_srt_size = 0 ;
+    int64_t *restrict K_srt = NULL ; size_t K_srt_size = 0 ;
+    int64_t *restrict W  = NULL ; size_t W_size  = 0 ;
+    int64_t *restrict W2 = NULL ; size_t W2_size = 0 ;
+
+    ASSERT (A != NULL) ;
+
+    if (A->Y == NULL)
+    { 
+        // no hyper_hash to update; it is built when next needed
+        return (GrB_SUCCESS) ;
+    }
+
+    ASSERT (GB_IS_HYPERSPARSE (A)) ;
+    ASSERT (kA >= 0 && kA <= kA2_old && kA2_old <= anvec_old) ;
+
+    GrB_Matrix Y = A->Y ;
+    int64_t anvec_new = A->nvec ;
+    int64_t yvdim = Y->vdim ;
+
+    if (A->Y_shallow || Y->i_shallow || Y->x_shallow ||
+        anvec_new > 4 * yvdim)
+    { 
+        // Y is shallow and cannot be modified, or the hash table would
+        // become overloaded; free it and let it be rebuilt from scratch
+        GB_hyper_hash_free (A) ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get Y and the shape of the splice
+    //--------------------------------------------------------------------------
+
+    int64_t *restrict Yp = Y->p ;
+    int64_t *restrict Yi = Y->i ;
+    int64_t *restrict Yx = (int64_t *) Y->x ;
+    int64_t ynz = GB_nnz (Y) ;
+    ASSERT (ynz == anvec_old) ;
+
+    const int64_t *restrict Ah = A->h ;
+    int64_t hash_bits = yvdim - 1 ;         // yvdim is always a power of 2
+    int64_t delta = anvec_new - anvec_old ;
+    // the spliced region now occupies positions [kA, kA + nmid) of A->h
+    int64_t nmid = anvec_new - anvec_old + (kA2_old - kA) ;
+    ASSERT (nmid >= 0 && kA + nmid <= anvec_new) ;
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (ynz, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // shift the suffix positions and mark the spliced region as stale
+    //--------------------------------------------------------------------------
+
+    // Entries of Y holding positions past the spliced region shift by delta.
+    // Entries for the old spliced region are marked stale; those whose
+    // vector survives the splice are reassigned their new position below.
+
+    int64_t p ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (p = 0 ; p < ynz ; p++)
+    {
+        int64_t k = Yx [p] ;
+        if (k >= kA2_old)
+        {
+            Yx [p] = k + delta ;
+        }
+        else if (k >= kA)
+        {
+            Yx [p] = -1 ;       // stale; reassigned or deleted below
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // reassign the spliced vectors, collecting any new ones
+    //--------------------------------------------------------------------------
+
+    // The splice region is small by assumption, so this pass is done by a
+    // single thread.  The hyperlist is sorted, so the collected list of new
+    // vectors is sorted by vector index j.
+
+    int64_t nins = 0 ;
+    for (int64_t k = kA ; k < kA + nmid ; k++)
+    {
+        int64_t j = Ah [k] ;
+        int64_t jhash = GB_HASHF2 (j, hash_bits) ;
+        bool found = false ;
+        for (int64_t py = Yp [jhash] ; py < Yp [jhash+1] ; py++)
+        {
+            if (Yi [py] == j)
+            {
+                // vector j survives the splice, in its new position k
+                Yx [py] = k ;
+                found = true ;
+                break ;
+            }
+        }
+        if (!found)
+        {
+            // vector j is new; insert it into Y below
+            if (I_ins == NULL)
+            {
+                I_ins = GB_MALLOC_WORK (nmid, int64_t, &I_ins_size) ;
+                K_ins = GB_MALLOC_WORK (nmid, int64_t, &K_ins_size) ;
+                if (I_ins == NULL || K_ins == NULL)
+                {
+                    // out of memory; free Y and rebuild it later
+                    GB_FREE_ALL ;
+                    return (GrB_SUCCESS) ;
+                }
+            }
+            I_ins [nins] = j ;
+            K_ins [nins] = k ;
+            nins++ ;
+        }
+    }
+
+    // # of old spliced vectors no longer present in A->h
+    int64_t ndel = (kA2_old - kA) - (nmid - nins) ;
+    ASSERT (ndel >= 0) ;
+
+    //--------------------------------------------------------------------------
+    // delete the entries of vectors removed by the splice
+    //--------------------------------------------------------------------------
+
+    if (ndel > 0)
+    {
+        // compact Y, deleting the entries still marked stale
+        int64_t pdst = 0 ;
+        for (int64_t b = 0 ; b < yvdim ; b++)
+        {
+            int64_t pstart = Yp [b] ;
+            int64_t pend = Yp [b+1] ;
+            Yp [b] = pdst ;
+            for (int64_t py = pstart ; py < pend ; py++)
+            {
+                if (Yx [py] >= 0)
+                {
+                    Yi [pdst] = Yi [py] ;
+                    Yx [pdst] = Yx [py] ;
+                    pdst++ ;
+                }
+            }
+        }
+        Yp [yvdim] = pdst ;
+        ASSERT (pdst == ynz - ndel) ;
+        ynz = pdst ;
+        Y->nvals = ynz ;
+        Y->nvec_nonempty = -1 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // insert the new vectors into their hash buckets
+    //--------------------------------------------------------------------------
+
+    if (nins > 0)
+    {
+
+        //----------------------------------------------------------------------
+        // make sure Y has enough space for the new entries
+        //----------------------------------------------------------------------
+
+        if (ynz + nins > GB_nnz_max (Y))
+        {
+            info = GB_ix_realloc (Y, 2 * (ynz + nins)) ;
+            if (info != GrB_SUCCESS)
+            {
+                // out of memory; free Y and rebuild it later
+                GB_FREE_ALL ;
+                return (GrB_SUCCESS) ;
+            }
+            Yi = Y->i ;
+            Yx = (int64_t *) Y->x ;
+        }
+
+        //----------------------------------------------------------------------
+        // group the new entries by hash bucket
+        //----------------------------------------------------------------------
+
+        W  = GB_MALLOC_WORK (yvdim+1, int64_t, &W_size) ;
+        W2 = GB_MALLOC_WORK (yvdim+1, int64_t, &W2_size) ;
+        I_srt = GB_MALLOC_WORK (nins, int64_t, &I_srt_size) ;
+        K_srt = GB_MALLOC_WORK (nins, int64_t, &K_srt_size) ;
+        if (W == NULL || W2 == NULL || I_srt == NULL || K_srt == NULL)
+        {
+            // out of memory; free Y and rebuild it later
+            GB_FREE_ALL ;
+            return (GrB_SUCCESS) ;
+        }
+
+        // W [b] = # of new entries in bucket b
+        GB_memset (W, 0, (yvdim+1) * sizeof (int64_t), nthreads) ;
+        for (int64_t t = 0 ; t < nins ; t++)
+        {
+            W [GB_HASHF2 (I_ins [t], hash_bits)]++ ;
+        }
+
+        // W [b] = position of the first new entry of bucket b
+        GB_cumsum (W, yvdim, NULL, nthreads, Werk) ;
+        ASSERT (W [yvdim] == nins) ;
+
+        // scatter the new entries into bucket order; each bucket's group
+        // stays sorted by j since I_ins is sorted by j
+        GB_memcpy (W2, W, (yvdim+1) * sizeof (int64_t), nthreads) ;
+        for (int64_t t = 0 ; t < nins ; t++)
+        {
+            int64_t b = GB_HASHF2 (I_ins [t], hash_bits) ;
+            I_srt [W2 [b]] = I_ins [t] ;
+            K_srt [W2 [b]] = K_ins [t] ;
+            W2 [b]++ ;
+        }
+
+        //----------------------------------------------------------------------
+        // merge the new entries into their buckets, from the last downwards
+        //----------------------------------------------------------------------
+
+        // Bucket b grows by W [b+1] - W [b] entries and its contents shift
+        // up by W [b] ; buckets below the first insertion do not move.
+
+        for (int64_t b = yvdim - 1 ; b >= 0 ; b--)
+        {
+            if (W [b+1] == 0)
+            {
+                // no insertions in this bucket or any bucket below it
+                break ;
+            }
+            int64_t pstart = Yp [b] ;
+            int64_t pold = Yp [b+1] - 1 ;       // last old entry in bucket b
+            int64_t q = W [b+1] - 1 ;           // last new entry for bucket b
+            int64_t pdst = Yp [b+1] + W [b+1] - 1 ;
+            // merge old and new entries, keeping the bucket sorted by j
+            while (q >= W [b])
+            {
+                if (pold >= pstart && Yi [pold] > I_srt [q])
+                {
+                    Yi [pdst] = Yi [pold] ;
+                    Yx [pdst] = Yx [pold] ;
+                    pold-- ;
+                }
+                else
+                {
+                    Yi [pdst] = I_srt [q] ;
+                    Yx [pdst] = K_srt [q] ;
+                    q-- ;
+                }
+                pdst-- ;
+            }
+            // shift the remaining old entries up by W [b]
+            while (pold >= pstart && pdst != pold)
+            {
+                Yi [pdst] = Yi [pold] ;
+                Yx [pdst] = Yx [pold] ;
+                pold-- ;
+                pdst-- ;
+            }
+        }
+
+        // shift the bucket pointers
+        int64_t b ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (b = 0 ; b <= yvdim ; b++)
+        {
+            Yp [b] += W [b] ;
+        }
+
+        ynz += nins ;
+        Y->nvals = ynz ;
+        Y->nvec_nonempty = -1 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    ASSERT (Y->nvals == anvec_new) ;
+    GB_FREE_WORKSPACE ;
+    ASSERT_MATRIX_OK (A, "A with updated hyper_hash", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -50,6 +50,13 @@ GrB_Matrix GB_hyper_shallow         // return C
     C->h_shallow = false ;
     C->Y = NULL ;
     C->Y_shallow = false ;
+    C->degree = NULL ;
+    C->degree_size = 0 ;
+    C->lookup_p = NULL ;
+    C->lookup_p_size = 0 ;
+    C->lookup_e = NULL ;
+    C->lookup_e_size = 0 ;
+    C->lookup_nbuckets = 0 ;
 
     // flag all content of C as shallow
     C->p_shallow = true ;
@@ -42,6 +42,57 @@ GrB_Info GB_ijproperties        // check I and determine its properties
     GB_Werk Werk
 ) ;
 
+//------------------------------------------------------------------------------
+// GxB_IndexList: a reusable, pre-analyzed index list
+//------------------------------------------------------------------------------
+
+// A GxB_IndexList holds a private copy of an explicit index list together
+// with the analysis that C=A(I,J) would otherwise redo on every call: the
+// properties from GB_ijproperties, and the I-inverse buckets (Mark and
+// Inext, from GB_I_inverse) for the axis dimension the list was built for.
+// Repeated extracts with the same index list then skip the sequential
+// O(limit) bucket construction in GB_subref_slice.
+
+struct GB_IndexList_opaque      // content of GxB_IndexList
+{
+    // first 2 items exactly match all other opaque objects:
+    int64_t magic ;             // for detecting uninitialized objects
+    size_t header_size ;        // size of the malloc'd block for this struct
+    // private copy of the index list:
+    GrB_Index *I ;              // the index list, of length ni
+    size_t I_size ;
+    int64_t ni ;                // number of indices in the list
+    int64_t limit ;             // dimension of the axis being indexed
+    // analysis from GB_ijlength and GB_ijproperties:
+    int Ikind ;                 // GB_ALL, GB_RANGE, GB_STRIDE, or GB_LIST
+    int64_t nI ;                // actual length of the list
+    int64_t Icolon [3] ;        // begin:inc:end, if not GB_LIST
+    int64_t imin, imax ;        // min (I) and max (I)
+    bool I_is_unsorted ;        // true if I is out of order
+    bool I_has_dupl ;           // true if I has a duplicate entry
+    bool I_is_contig ;          // true if I is the contiguous list imin:imax
+    // I-inverse buckets from GB_I_inverse, or NULL if Ikind is not GB_LIST:
+    int64_t *Mark ;             // head pointers for buckets, size limit
+    size_t Mark_size ;
+    int64_t *Inext ;            // next pointers for buckets, size nI
+    size_t Inext_size ;
+    int64_t ndupl ;             // number of duplicate entries in the list
+} ;
+
+// GB_index_list_ok: true if I_list holds a valid cached analysis for the
+// index list I of length nI, indexing an axis of dimension avlen
+static inline bool GB_index_list_ok
+(
+    const GxB_IndexList I_list,     // cached index list, or NULL
+    const GrB_Index *I,             // index list in use
+    const int64_t nI,               // its actual length
+    const int64_t avlen             // dimension of the axis being indexed
+)
+{
+    return (I_list != NULL && I_list->magic == GB_MAGIC
+        && I_list->I == I && I_list->nI == nI && I_list->limit == avlen) ;
+}
+
 GrB_Info GB_ijsort
 (
     const GrB_Index *restrict I, // size ni, where ni > 1 always holds
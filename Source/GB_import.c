@@ -208,7 +208,7 @@ GrB_Info GB_import      // import/pack a matrix in any format
     // also create A->p if this is a sparse GrB_Vector
     GrB_Info info = GB_new (A, // any sparsity, new or existing user header
         type, vlen, vdim, is_sparse_vector ? GB_Ap_calloc : GB_Ap_null,
-        is_csc, sparsity, GB_Global_hyper_switch_get ( ), nvec) ;
+        is_csc, sparsity, GB_Context_hyper_switch ( ), nvec) ;
     if (info != GrB_SUCCESS)
     { 
         // out of memory
@@ -362,9 +362,11 @@ GrB_Info GB_import      // import/pack a matrix in any format
         //
         // The time for this check is proportional to the size of the 5 input
         // arrays, far higher than the O(1) time for the fast import.  However,
-        // this check is essential if the input data is not trusted.
+        // this check is essential if the input data is not trusted.  The
+        // check is done in parallel, so a secure import of a large matrix
+        // runs near memory bandwidth rather than at single-thread speed.
         GBURBLE ("(secure import) ") ;
-        GB_OK (GB_matvec_check (*A, "secure import", GxB_SILENT, NULL, "")) ;
+        GB_OK (GB_import_validate (*A, Werk)) ;
     }
 
     //--------------------------------------------------------------------------
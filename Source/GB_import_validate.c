@@ -0,0 +1,194 @@
+//------------------------------------------------------------------------------
+// GB_import_validate: exhaustive parallel check of imported content
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A secure import (the GxB_SECURE_IMPORT descriptor setting, or any method
+// that imports untrusted data) must check the content of the A->[phbi] arrays
+// exhaustively before the matrix can be used.  This check was formerly done
+// by GB_matvec_check, which walks the matrix with a single thread; on an
+// import of billions of entries the serial walk costs far more than the O(1)
+// move of the arrays themselves.  This method makes the same checks with all
+// available threads.  The vector pointers and the hyperlist are checked with
+// parallel scans.  The indices are checked with an ek-sliced scan: each task
+// checks the bounds and (if the matrix is not imported as jumbled) the strict
+// monotonicity of its span of entries, where the pair of entries that joins a
+// task to its predecessor within a vector is checked by the later task.
+
+// Returns GrB_SUCCESS if the content is valid, or GrB_INVALID_OBJECT if not.
+// The checks are silent, like GB_matvec_check with GxB_SILENT.
+
+#include "GB_export.h"
+#include "GB_ek_slice.h"
+
+GrB_Info GB_import_validate     // check the content of an imported matrix
+(
+    GrB_Matrix A,               // matrix with imported content to check
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    // the header of A has been constructed by GB_import from scalars that
+    // have already been checked; only the array content remains untrusted
+    ASSERT (A != NULL) ;
+    ASSERT (A->magic == GB_MAGIC) ;
+    ASSERT (!GB_ZOMBIES (A)) ;
+    ASSERT (!GB_PENDING (A)) ;
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+
+    const int64_t anvec = A->nvec ;
+    const int64_t avlen = A->vlen ;
+    const int64_t avdim = A->vdim ;
+    bool ok = true ;
+    int64_t k, p ;
+
+    //--------------------------------------------------------------------------
+    // full matrix: no pattern to check
+    //--------------------------------------------------------------------------
+
+    if (GB_IS_FULL (A))
+    {
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // bitmap matrix: Ab must be 0/1 with exactly A->nvals entries present
+    //--------------------------------------------------------------------------
+
+    if (GB_IS_BITMAP (A))
+    {
+        const int8_t *restrict Ab = A->b ;
+        const int64_t anz_held = GB_nnz_held (A) ;
+        int nthreads = GB_nthreads (anz_held, chunk, nthreads_max) ;
+        int64_t nvals = 0 ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(&&:ok) reduction(+:nvals)
+        for (p = 0 ; p < anz_held ; p++)
+        {
+            int8_t ab = Ab [p] ;
+            ok = ok && (ab == 0 || ab == 1) ;
+            nvals += (ab != 0) ;
+        }
+        if (!ok || nvals != A->nvals)
+        {
+            return (GrB_INVALID_OBJECT) ;
+        }
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // sparse or hypersparse matrix: get the content
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int64_t *restrict Ai = A->i ;
+    const int64_t anz = A->nvals ;
+
+    //--------------------------------------------------------------------------
+    // check the vector pointers
+    //--------------------------------------------------------------------------
+
+    if (Ap == NULL || Ap [0] != 0 || Ap [anvec] != anz)
+    {
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    int nthreads = GB_nthreads (anvec, chunk, nthreads_max) ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(&&:ok)
+    for (k = 0 ; k < anvec ; k++)
+    {
+        ok = ok && (Ap [k] <= Ap [k+1]) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check the hyperlist: strictly increasing, in range 0:vdim-1
+    //--------------------------------------------------------------------------
+
+    if (Ah != NULL)
+    {
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(&&:ok)
+        for (k = 0 ; k < anvec ; k++)
+        {
+            int64_t j = Ah [k] ;
+            ok = ok && (j >= 0 && j < avdim && (k == 0 || Ah [k-1] < j)) ;
+        }
+    }
+
+    if (!ok)
+    {
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check the indices with an ek-sliced scan
+    //--------------------------------------------------------------------------
+
+    // Ap is now known to be valid, so A can be safely sliced.
+
+    if (anz > 0 && Ai != NULL)
+    {
+        int A_ntasks, A_nthreads ;
+        GB_ek_slice_ntasks (&A_nthreads, &A_ntasks, anz, 8, anz, chunk,
+            nthreads_max) ;
+        GB_WERK_DECLARE (A_ek_slicing, int64_t) ;
+        GB_WERK_PUSH (A_ek_slicing, 3*A_ntasks+1, int64_t) ;
+        if (A_ek_slicing == NULL)
+        {
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        GB_ek_slice (A_ek_slicing, A, A_ntasks) ;
+        const int64_t *restrict kfirst_Aslice = A_ek_slicing ;
+        const int64_t *restrict klast_Aslice  = A_ek_slicing + A_ntasks ;
+        const int64_t *restrict pstart_Aslice = A_ek_slicing + A_ntasks*2 ;
+        const bool check_sorted = !(A->jumbled) ;
+
+        int tid ;
+        #pragma omp parallel for num_threads(A_nthreads) schedule(dynamic,1) \
+            reduction(&&:ok)
+        for (tid = 0 ; tid < A_ntasks ; tid++)
+        {
+            int64_t kfirst = kfirst_Aslice [tid] ;
+            int64_t klast  = klast_Aslice  [tid] ;
+            for (int64_t kk = kfirst ; kk <= klast ; kk++)
+            {
+                int64_t p0 = Ap [kk] ;
+                int64_t p1 = Ap [kk+1] ;
+                GB_GET_PA (pA_start, pA_end, tid, kk, kfirst, klast,
+                    pstart_Aslice, p0, p1) ;
+                for (int64_t pA = pA_start ; pA < pA_end ; pA++)
+                {
+                    // the entry Ai [pA] must be in range, and if the matrix
+                    // is not jumbled, larger than its predecessor in the same
+                    // vector (which also rules out duplicate indices).  When
+                    // pA is the first entry of this task but not the first of
+                    // its vector, this compares across the task boundary.
+                    int64_t i = Ai [pA] ;
+                    ok = ok && (i >= 0 && i < avlen) &&
+                        (!check_sorted || pA == p0 || Ai [pA-1] < i) ;
+                }
+            }
+        }
+
+        GB_WERK_POP (A_ek_slicing, int64_t) ;
+        if (!ok)
+        {
+            return (GrB_INVALID_OBJECT) ;
+        }
+    }
+
+    return (GrB_SUCCESS) ;
+}
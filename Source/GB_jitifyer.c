@@ -14,6 +14,16 @@
 #include "GB_JITpackage.h"
 #include "GB_file.h"
 
+#ifndef NJIT
+#if GB_WINDOWS
+#include <process.h>    // for _getpid
+#define GB_GETPID _getpid
+#else
+#include <unistd.h>     // for getpid, used by GB_jitifyer_direct_compile_async
+#define GB_GETPID getpid
+#endif
+#endif
+
 typedef GB_JIT_KERNEL_USER_OP_PROTO ((*GB_user_op_f)) ;
 typedef GB_JIT_KERNEL_USER_TYPE_PROTO ((*GB_user_type_f)) ;
 
@@ -43,14 +53,26 @@ static bool GB_jit_use_cmake =
     false ;     // otherwise, default is to skip cmake and compile directly
     #endif
 
+// if true, missing kernels are compiled in the background while the caller
+// falls back to a generic kernel (direct compile only, not with cmake):
+static bool GB_jit_async = false ;
+
 // path to user cache folder:
 static char    *GB_jit_cache_path = NULL ;
 static size_t   GB_jit_cache_path_allocated = 0 ;
 
+// path to optional read-only remote cache folder (read-through tier):
+static char    *GB_jit_remote_path = NULL ;
+static size_t   GB_jit_remote_path_allocated = 0 ;
+
 // path to error log file:
 static char    *GB_jit_error_log = NULL ;
 static size_t   GB_jit_error_log_allocated = 0 ;
 
+// path to kernel trace file:
+static char    *GB_jit_trace = NULL ;
+static size_t   GB_jit_trace_allocated = 0 ;
+
 // name of the C compiler:
 static char    *GB_jit_C_compiler = NULL ;
 static size_t   GB_jit_C_compiler_allocated = 0 ;
@@ -79,6 +101,11 @@ static size_t   GB_jit_C_preface_allocated = 0 ;
 static char    *GB_jit_temp = NULL ;
 static size_t   GB_jit_temp_allocated = 0 ;
 
+// second workspace, for methods that need two full paths at once (the
+// copy-and-rename from the remote cache tier into the local cache):
+static char    *GB_jit_temp2 = NULL ;
+static size_t   GB_jit_temp2_allocated = 0 ;
+
 // compile with -DJITINIT=4 (for example) to set the initial JIT C control
 #ifdef JITINIT
 #define GB_JIT_C_CONTROL_INIT JITINIT
@@ -89,6 +116,104 @@ static size_t   GB_jit_temp_allocated = 0 ;
 
 static GxB_JIT_Control GB_jit_control = GB_JIT_C_CONTROL_INIT ;
 
+// kernel telemetry: hit/miss/compile counters for each kernel family.  Entry
+// zero holds the total; entries 1 to GB_JIT_NFAMILIES-1 are indexed by the
+// GB_jit_family enum.  A "miss" is a call to GB_jitifyer_load that punts to a
+// generic kernel.
+static int64_t GB_jit_kernel_hits     [GB_JIT_NFAMILIES] ;
+static int64_t GB_jit_kernel_misses   [GB_JIT_NFAMILIES] ;
+static int64_t GB_jit_kernel_compiles [GB_JIT_NFAMILIES] ;
+
+// increment the total and per-family count of a telemetry counter
+static inline void GB_jitifyer_count
+(
+    int64_t *counter,           // one of the three counters above
+    GB_jit_family family        // family of the kernel
+)
+{
+    GB_ATOMIC_UPDATE
+    counter [0] ++ ;
+    GB_ATOMIC_UPDATE
+    counter [(int) family] ++ ;
+}
+
+//------------------------------------------------------------------------------
+// per-thread kernel memo
+//------------------------------------------------------------------------------
+
+// Each user thread keeps a small direct-mapped memo of the kernels it has
+// most recently dispatched.  GB_jitifyer_load probes the memo before the hash
+// table, so a workload that cycles through a few dozen distinct built-in
+// kernels repeats each dispatch with no shared-memory synchronization: no
+// re-probe of the shared hash table, and no entry into the critical section.
+// The memo holds no resources of its own; it only repeats an answer the hash
+// table gave this thread earlier.  GB_jit_memo_epoch advances whenever any
+// kernel is unloaded (GB_jitifyer_entry_free), which invalidates the memo of
+// every thread at its next probe.  Kernels with a user-defined operator or
+// type have a name suffix that would have to be copied and compared, so they
+// are not memoized and always take the normal path.
+
+#define GB_JIT_MEMO_SIZE 32
+
+typedef struct
+{
+    uint64_t hash ;             // hash code of the problem
+    uint64_t epoch ;            // value of GB_jit_memo_epoch when filled
+    GB_jit_encoding encoding ;  // encoding of the problem; suffix_len is 0
+    void *dl_function ;         // kernel function pointer
+}
+GB_jit_memo_entry ;
+
+static uint64_t GB_jit_memo_epoch = 1 ;     // never zero
+
+#if defined ( _OPENMP )
+
+    // OpenMP threadprivate is preferred
+    static GB_jit_memo_entry GB_jit_memo [GB_JIT_MEMO_SIZE] ;
+    #pragma omp threadprivate (GB_jit_memo)
+
+#elif defined ( HAVE_KEYWORD__THREAD )
+
+    // gcc and many other compilers support the __thread keyword
+    static __thread GB_jit_memo_entry GB_jit_memo [GB_JIT_MEMO_SIZE] ;
+
+#elif defined ( HAVE_KEYWORD__DECLSPEC_THREAD )
+
+    // Windows: __declspec (thread)
+    static __declspec ( thread ) GB_jit_memo_entry
+        GB_jit_memo [GB_JIT_MEMO_SIZE] ;
+
+#elif defined ( HAVE_KEYWORD__THREAD_LOCAL )
+
+    // ANSI C11 threads
+    #include <threads.h>
+    static _Thread_local GB_jit_memo_entry GB_jit_memo [GB_JIT_MEMO_SIZE] ;
+
+#else
+
+    // no thread-local storage: the kernel memo is disabled, and every
+    // dispatch takes the normal path through the hash table
+    #define GB_JIT_NO_MEMO
+
+#endif
+
+// GB_JIT_MEMO_FILL: remember the kernel just found in this thread's memo.
+// Used only in GB_jitifyer_load, on its local variables.  The epoch was read
+// before the hash table was probed: if a kernel unload raced with this
+// dispatch, the entry is recorded with a stale epoch and ignored later.
+#ifdef GB_JIT_NO_MEMO
+#define GB_JIT_MEMO_FILL
+#else
+#define GB_JIT_MEMO_FILL                                                \
+    if (memo != NULL)                                                   \
+    {                                                                   \
+        memo->hash = hash ;                                             \
+        memo->epoch = memo_epoch ;                                      \
+        memo->encoding = (*encoding) ;                                  \
+        memo->dl_function = (*dl_function) ;                            \
+    }
+#endif
+
 //------------------------------------------------------------------------------
 // check_table: check if the hash table is OK
 //------------------------------------------------------------------------------
@@ -201,7 +326,9 @@ void GB_jitifyer_finalize (void)
 { 
     GB_jitifyer_table_free (true) ;
     GB_FREE_STUFF (GB_jit_cache_path) ;
+    GB_FREE_STUFF (GB_jit_remote_path) ;
     GB_FREE_STUFF (GB_jit_error_log) ;
+    GB_FREE_STUFF (GB_jit_trace) ;
     GB_FREE_STUFF (GB_jit_C_compiler) ;
     GB_FREE_STUFF (GB_jit_C_flags) ;
     GB_FREE_STUFF (GB_jit_C_link_flags) ;
@@ -209,6 +336,7 @@ void GB_jitifyer_finalize (void)
     GB_FREE_STUFF (GB_jit_C_cmake_libs) ;
     GB_FREE_STUFF (GB_jit_C_preface) ;
     GB_FREE_STUFF (GB_jit_temp) ;
+    GB_FREE_STUFF (GB_jit_temp2) ;
 }
 
 //------------------------------------------------------------------------------
@@ -297,11 +425,22 @@ GrB_Info GB_jitifyer_init (void)
         if ((*p) == '\\') (*p) = '/' ; 
     }
 
+    //--------------------------------------------------------------------------
+    // find the GB_jit_remote_path
+    //--------------------------------------------------------------------------
+
+    // the remote cache tier (if any) is a read-only folder with the same
+    // layout as the local cache, typically shared across a cluster via NFS
+    char *remote_path = getenv ("GRAPHBLAS_CACHE_REMOTE") ;
+    GB_COPY_STUFF (GB_jit_remote_path,
+        (remote_path == NULL) ? "" : remote_path) ;
+
     //--------------------------------------------------------------------------
     // initialize the remaining strings
     //--------------------------------------------------------------------------
 
     GB_COPY_STUFF (GB_jit_error_log,     "") ;
+    GB_COPY_STUFF (GB_jit_trace,         "") ;
     GB_COPY_STUFF (GB_jit_C_compiler,   GB_C_COMPILER) ;
     GB_COPY_STUFF (GB_jit_C_flags,      GB_C_FLAGS) ;
     GB_COPY_STUFF (GB_jit_C_link_flags, GB_C_LINK_FLAGS) ;
@@ -314,8 +453,39 @@ GrB_Info GB_jitifyer_init (void)
     // establish the cache path and src path, and make sure they exist
     //--------------------------------------------------------------------------
 
+    #if !defined (NJIT) && !GB_WINDOWS
+    GxB_JIT_Control jit_control_desired = GB_jit_control ;
+    #endif
     OK (GB_jitifyer_establish_paths (GrB_SUCCESS)) ;
 
+    #if !defined (NJIT) && !GB_WINDOWS
+    if (GB_jit_cache_path [0] == '\0')
+    {
+        // The cache path could not be determined or created: a read-only
+        // home directory on a diskless container, for example.  Before
+        // settling for a disabled JIT, retry with a RAM-backed cache in
+        // /dev/shm, per-user to keep permissions simple: compiles and
+        // dlopens then run at memory speed and need no writable filesystem.
+        // Setting GRAPHBLAS_CACHE_PATH still places the cache anywhere else.
+        GB_FREE_STUFF (GB_jit_cache_path) ;
+        size_t len = 64 ;
+        GB_MALLOC_STUFF (GB_jit_cache_path, len) ;
+        snprintf (GB_jit_cache_path, GB_jit_cache_path_allocated,
+            "/dev/shm/SuiteSparse_%d/GrB%d.%d.%d", (int) getuid ( ),
+            GxB_IMPLEMENTATION_MAJOR,
+            GxB_IMPLEMENTATION_MINOR,
+            GxB_IMPLEMENTATION_SUB) ;
+        OK (GB_jitifyer_alloc_space ( )) ;
+        OK (GB_jitifyer_establish_paths (GrB_SUCCESS)) ;
+        if (GB_jit_cache_path [0] != '\0')
+        {
+            // the RAM-backed cache is usable; restore the JIT control
+            GBURBLE ("(jit init: cache in /dev/shm) ") ;
+            GB_jit_control = jit_control_desired ;
+        }
+    }
+    #endif
+
     //--------------------------------------------------------------------------
     // remove "-arch arm64" if compiling JIT kernels for MATLAB
     //--------------------------------------------------------------------------
@@ -577,6 +747,74 @@ GrB_Info GB_jitifyer_establish_paths (GrB_Info error_condition)
     return (ok ? GrB_SUCCESS : error_condition) ;
 }
 
+//------------------------------------------------------------------------------
+// GB_jitifyer_src_version_ok: check the version number in src/GraphBLAS.h
+//------------------------------------------------------------------------------
+
+#ifndef NJIT
+
+// Returns true if src/GraphBLAS.h exists in the cache folder and holds the
+// version number of this GraphBLAS library, in which case the source cache is
+// assumed to be intact and extraction of the JITpackage can be skipped.
+
+static bool GB_jitifyer_src_version_ok (void)
+{
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/src/GraphBLAS.h",
+        GB_jit_cache_path) ;
+    FILE *fp_graphblas = fopen (GB_jit_temp, "r") ;
+    if (fp_graphblas == NULL)
+    {
+        return (false) ;
+    }
+    int v1 = -1, v2 = -1, v3 = -1 ;
+    int r = fscanf (fp_graphblas, "// SuiteSparse:GraphBLAS %d.%d.%d",
+        &v1, &v2, &v3) ;
+    fclose (fp_graphblas) ;
+    return (r == 3 &&
+        v1 == GxB_IMPLEMENTATION_MAJOR &&
+        v2 == GxB_IMPLEMENTATION_MINOR &&
+        v3 == GxB_IMPLEMENTATION_SUB) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_extract_file: uncompress one file of the JITpackage
+//------------------------------------------------------------------------------
+
+static bool GB_jitifyer_extract_file    // true if successful
+(
+    int k,              // file of the JITpackage to extract
+    uint8_t *dst,       // workspace of size dst_size
+    size_t dst_size,
+    char *filename      // workspace of size GB_jit_temp_allocated
+)
+{
+    // uncompress the blob
+    uint8_t *src = GB_JITpackage_index [k].blob ;
+    size_t src_size = GB_JITpackage_index [k].compressed_size ;
+    size_t u = ZSTD_decompress (dst, dst_size, src, src_size) ;
+    if (u != GB_JITpackage_index [k].uncompressed_size)
+    {
+        // JITPackage error: blob is invalid
+        return (false) ;
+    }
+    // construct the filename
+    snprintf (filename, GB_jit_temp_allocated, "%s/src/%s",
+        GB_jit_cache_path, GB_JITpackage_index [k].filename) ;
+    // open the file
+    FILE *fp_src = fopen (filename, "w") ;
+    if (fp_src == NULL)
+    {
+        // JITPackage error: file cannot be created
+        return (false) ;
+    }
+    // write the uncompressed blob to the file
+    size_t nwritten = fwrite (dst, sizeof (uint8_t), u, fp_src) ;
+    fclose (fp_src) ;
+    return (nwritten == u) ;
+}
+
+#endif
+
 //------------------------------------------------------------------------------
 // GB_jitifyer_extract_JITpackage: extract the GraphBLAS source
 //------------------------------------------------------------------------------
@@ -590,6 +828,24 @@ GrB_Info GB_jitifyer_extract_JITpackage (GrB_Info error_condition)
 
     #ifndef NJIT
 
+    //--------------------------------------------------------------------------
+    // quick check of the version number in src/GraphBLAS.h
+    //--------------------------------------------------------------------------
+
+    // If the source cache already holds the source for this exact version of
+    // GraphBLAS, no extraction is needed, and no lock is taken.  This allows
+    // the cache path to point at a read-only pre-extracted image of the
+    // source, shared across many processes or containers.  The check is safe
+    // without the lock because the extraction below writes src/GraphBLAS.h
+    // last, as a completion sentinel: a current version number is only ever
+    // observed once all other source files are fully written.
+
+    if (GB_jitifyer_src_version_ok ( ))
+    {
+        // looks fine; assume the rest of the source is fine
+        return (GrB_SUCCESS) ;
+    }
+
     //--------------------------------------------------------------------------
     // lock the lock/00/src_lock file
     //--------------------------------------------------------------------------
@@ -607,93 +863,105 @@ GrB_Info GB_jitifyer_extract_JITpackage (GrB_Info error_condition)
     }
 
     //--------------------------------------------------------------------------
-    // check the version number in src/GraphBLAS.h
+    // check the version number again, now that the lock is held
     //--------------------------------------------------------------------------
 
-    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/src/GraphBLAS.h",
-        GB_jit_cache_path) ;
-    FILE *fp_graphblas = fopen (GB_jit_temp, "r") ;
-    if (fp_graphblas != NULL)
-    { 
-        int v1 = -1, v2 = -1, v3 = -1 ;
-        int r = fscanf (fp_graphblas, "// SuiteSparse:GraphBLAS %d.%d.%d",
-            &v1, &v2, &v3) ;
-        fclose (fp_graphblas) ;
-        if (r == 3 &&
-            v1 == GxB_IMPLEMENTATION_MAJOR &&
-            v2 == GxB_IMPLEMENTATION_MINOR &&
-            v3 == GxB_IMPLEMENTATION_SUB)
-        { 
-            // looks fine; assume the rest of the source is fine
-            GB_file_unlock_and_close (&fp_lock, &fd_lock) ;
-            return (GrB_SUCCESS) ;
-        }
+    // Another process may have extracted the source while this process was
+    // waiting for the lock.
+
+    if (GB_jitifyer_src_version_ok ( ))
+    {
+        // looks fine; assume the rest of the source is fine
+        GB_file_unlock_and_close (&fp_lock, &fd_lock) ;
+        return (GrB_SUCCESS) ;
     }
 
     //--------------------------------------------------------------------------
-    // allocate workspace for the largest uncompressed file
+    // allocate workspace for the largest uncompressed file, per thread
     //--------------------------------------------------------------------------
 
     size_t dst_size = 0 ;
+    double total_work = 0 ;
     for (int k = 0 ; k < GB_JITpackage_nfiles ; k++)
-    { 
+    {
         size_t uncompressed_size = GB_JITpackage_index [k].uncompressed_size ;
         dst_size = GB_IMAX (dst_size, uncompressed_size) ;
+        total_work += (double) uncompressed_size ;
     }
 
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (total_work, chunk, nthreads_max) ;
+    nthreads = GB_IMIN (nthreads, GB_JITpackage_nfiles) ;
+
     uint8_t *dst ;
-    GB_MALLOC_PERSISTENT (dst, (dst_size+2) * sizeof(uint8_t)) ;
-    if (dst == NULL)
+    GB_MALLOC_PERSISTENT (dst, nthreads * (dst_size+2) * sizeof(uint8_t)) ;
+    char *fnames ;
+    GB_MALLOC_PERSISTENT (fnames, nthreads * GB_jit_temp_allocated) ;
+    if (dst == NULL || fnames == NULL)
     {
         // JITPackage error: out of memory; disable the JIT
+        GB_FREE_PERSISTENT (dst) ;
+        GB_FREE_PERSISTENT (fnames) ;
+        GB_file_unlock_and_close (&fp_lock, &fd_lock) ;
         GB_jit_control = GxB_JIT_RUN ;
         return (GrB_OUT_OF_MEMORY) ;
     }
 
     //--------------------------------------------------------------------------
-    // uncompress each file into the src folder
+    // uncompress each file into the src folder, in parallel
     //--------------------------------------------------------------------------
 
-    bool ok = true ;
+    // src/GraphBLAS.h is the version sentinel tested by
+    // GB_jitifyer_src_version_ok, so it is skipped here and written last,
+    // after every other file is complete.
+
+    int k_sentinel = -1 ;
     for (int k = 0 ; k < GB_JITpackage_nfiles ; k++)
-    { 
-        // uncompress the blob
-        uint8_t *src = GB_JITpackage_index [k].blob ;
-        size_t src_size = GB_JITpackage_index [k].compressed_size ;
-        size_t u = ZSTD_decompress (dst, dst_size, src, src_size) ;
-        if (u != GB_JITpackage_index [k].uncompressed_size)
-        {
-            // JITPackage error: blob is invalid
-            ok = false ;
-            break ;
-        }
-        // construct the filename
-        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/src/%s",
-            GB_jit_cache_path, GB_JITpackage_index [k].filename) ;
-        // open the file
-        FILE *fp_src = fopen (GB_jit_temp, "w") ;
-        if (fp_src == NULL)
+    {
+        if (strcmp (GB_JITpackage_index [k].filename, "GraphBLAS.h") == 0)
         {
-            // JITPackage error: file cannot be created
-            ok = false ;
+            k_sentinel = k ;
             break ;
         }
-        // write the uncompressed blob to the file
-        size_t nwritten = fwrite (dst, sizeof (uint8_t), u, fp_src) ;
-        fclose (fp_src) ;
-        if (nwritten != u)
+    }
+
+    bool ok = true ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic) \
+        reduction(&&:ok)
+    for (int tid = 0 ; tid < nthreads ; tid++)
+    {
+        // this thread uncompresses files kfirst:klast-1
+        uint8_t *my_dst = dst + tid * (dst_size+2) ;
+        char *my_filename = fnames + tid * GB_jit_temp_allocated ;
+        int kfirst, klast ;
+        GB_PARTITION (kfirst, klast, GB_JITpackage_nfiles, tid, nthreads) ;
+        for (int k = kfirst ; k < klast && ok ; k++)
         {
-            // JITPackage error: file is invalid
-            ok = false ;
-            break ;
+            if (k == k_sentinel)
+            {
+                // the version sentinel is written last, below
+                continue ;
+            }
+            ok = GB_jitifyer_extract_file (k, my_dst, dst_size, my_filename) ;
         }
     }
 
+    //--------------------------------------------------------------------------
+    // write src/GraphBLAS.h, the completion sentinel
+    //--------------------------------------------------------------------------
+
+    if (ok && k_sentinel >= 0)
+    {
+        ok = GB_jitifyer_extract_file (k_sentinel, dst, dst_size, fnames) ;
+    }
+
     //--------------------------------------------------------------------------
     // free workspace
     //--------------------------------------------------------------------------
 
     GB_FREE_PERSISTENT (dst) ;
+    GB_FREE_PERSISTENT (fnames) ;
 
     //--------------------------------------------------------------------------
     // unlock and close the lock/GB_src_lock file
@@ -754,6 +1022,39 @@ void GB_jitifyer_set_control (int control)
     }
 }
 
+//------------------------------------------------------------------------------
+// GB_jitifyer_get_hits, _misses, _compiles: get the telemetry counters
+//------------------------------------------------------------------------------
+
+// Each method fills value [0..GB_JIT_NFAMILIES-1]: entry 0 is the total,
+// and entries 1 to 9 are indexed by the GB_jit_family enum.
+
+static void GB_jitifyer_counter_read (const int64_t *counter, int64_t *value)
+{
+    for (int k = 0 ; k < GB_JIT_NFAMILIES ; k++)
+    {
+        int64_t c ;
+        GB_ATOMIC_READ
+        c = counter [k] ;
+        value [k] = c ;
+    }
+}
+
+void GB_jitifyer_get_hits (int64_t *value)
+{
+    GB_jitifyer_counter_read (GB_jit_kernel_hits, value) ;
+}
+
+void GB_jitifyer_get_misses (int64_t *value)
+{
+    GB_jitifyer_counter_read (GB_jit_kernel_misses, value) ;
+}
+
+void GB_jitifyer_get_compiles (int64_t *value)
+{
+    GB_jitifyer_counter_read (GB_jit_kernel_compiles, value) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_jitifyer_alloc_space: allocate temporary workspace for the JIT
 //------------------------------------------------------------------------------
@@ -792,8 +1093,12 @@ GrB_Info GB_jitifyer_alloc_space (void)
         GB_jit_C_libraries_allocated +
         GB_jit_C_cmake_libs_allocated +
         GB_jit_error_log_allocated +
+        GB_jit_trace_allocated +
+        GB_jit_remote_path_allocated +
         300 ;
     GB_MALLOC_STUFF (GB_jit_temp, len) ;
+    GB_FREE_STUFF (GB_jit_temp2) ;
+    GB_MALLOC_STUFF (GB_jit_temp2, len) ;
 
     return (GrB_SUCCESS) ;
 }
@@ -863,6 +1168,65 @@ GrB_Info GB_jitifyer_set_cache_path_worker (const char *new_cache_path)
     return (GB_jitifyer_extract_JITpackage (GrB_INVALID_VALUE)) ;
 }
 
+//------------------------------------------------------------------------------
+// GB_jitifyer_get_remote_path: return the current remote cache path
+//------------------------------------------------------------------------------
+
+const char *GB_jitifyer_get_remote_path (void)
+{ 
+    const char *s ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        s = GB_jit_remote_path ;
+    }
+    return (s) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_remote_path: set a new remote cache path
+//------------------------------------------------------------------------------
+
+// The remote cache is an optional, read-only second tier with the same layout
+// as the local cache (typically a folder shared across a cluster via NFS).
+// If a kernel is not found in the local cache, its compiled lib*.so is looked
+// up in the remote cache and, if found there, copied into the local cache
+// before being loaded, so a single compile can serve many nodes.  GraphBLAS
+// never writes to the remote cache itself; it is populated out-of-band, by
+// pointing GxB_JIT_CACHE_PATH of one canary process at it, or by an rsync of
+// a local cache in a deploy step.
+
+// If new_remote_path is NULL or the empty string, the remote tier is disabled.
+
+GrB_Info GB_jitifyer_set_remote_path (const char *new_remote_path)
+{ 
+
+    //--------------------------------------------------------------------------
+    // set the remote cache path in a critical section
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        info = GB_jitifyer_set_remote_path_worker
+            ((new_remote_path == NULL) ? "" : new_remote_path) ;
+    }
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_remote_path_worker: set remote path in a critical section
+//------------------------------------------------------------------------------
+
+GrB_Info GB_jitifyer_set_remote_path_worker (const char *new_remote_path)
+{ 
+    // free the old remote cache path
+    GB_FREE_STUFF (GB_jit_remote_path) ;
+    // allocate the new GB_jit_remote_path
+    GB_COPY_STUFF (GB_jit_remote_path, new_remote_path) ;
+    // allocate workspace
+    return (GB_jitifyer_alloc_space ( )) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_jitifyer_get_error_log: return the current log file
 //------------------------------------------------------------------------------
@@ -913,6 +1277,63 @@ GrB_Info GB_jitifyer_set_error_log_worker (const char *new_error_log)
     return (GB_jitifyer_alloc_space ( )) ;
 }
 
+//------------------------------------------------------------------------------
+// GB_jitifyer_get_trace: return the current kernel trace file
+//------------------------------------------------------------------------------
+
+const char *GB_jitifyer_get_trace (void)
+{
+    const char *s ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        s = GB_jit_trace ;
+    }
+    return (s) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_trace: set a new kernel trace file
+//------------------------------------------------------------------------------
+
+// If the trace file is set to a non-empty path, the name of every JIT kernel
+// that is not already loaded in this process is appended to that file, one
+// per line, as bucket/kernel_name.  A canary run with the trace enabled thus
+// records exactly the kernels a workload needs; their generated sources are
+// kept in the c/ folder of the cache, so a deploy step can bulk-compile the
+// recorded list in parallel before any worker process starts, instead of
+// each worker compiling kernels lazily on first use.
+
+// If new_trace is NULL or the empty string, tracing is disabled.
+
+GrB_Info GB_jitifyer_set_trace (const char *new_trace)
+{
+
+    //--------------------------------------------------------------------------
+    // set the trace file in a critical section
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        info = GB_jitifyer_set_trace_worker
+            ((new_trace == NULL) ? "" : new_trace) ;
+    }
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_trace_worker: set trace file in a critical section
+//------------------------------------------------------------------------------
+
+GrB_Info GB_jitifyer_set_trace_worker (const char *new_trace)
+{
+    // free the old trace file
+    GB_FREE_STUFF (GB_jit_trace) ;
+    // allocate the new GB_jit_trace
+    GB_COPY_STUFF (GB_jit_trace, new_trace) ;
+    return (GB_jitifyer_alloc_space ( )) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_jitifyer_get_C_compiler: return the current C compiler
 //------------------------------------------------------------------------------
@@ -1172,6 +1593,37 @@ void GB_jitifyer_set_use_cmake (bool use_cmake)
     }
 }
 
+//------------------------------------------------------------------------------
+// GB_jitifyer_get_async: return true/false if background compilation is in use
+//------------------------------------------------------------------------------
+
+bool GB_jitifyer_get_async (void)
+{
+    bool async ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        async = GB_jit_async ;
+    }
+    return (async) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_async: set true/false to compile kernels in the background
+//------------------------------------------------------------------------------
+
+void GB_jitifyer_set_async (bool async)
+{
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        #if defined (_MSC_VER)
+        // MSVC requires cmake, which compiles synchronously
+        GB_jit_async = false ;
+        #else
+        GB_jit_async = async ;
+        #endif
+    }
+}
+
 //------------------------------------------------------------------------------
 // GB_jitifyer_get_C_cmake_libs: return the current cmake libs
 //------------------------------------------------------------------------------
@@ -1429,18 +1881,46 @@ GrB_Info GB_jitifyer_load
 
     GrB_Info info ;
     if (hash == UINT64_MAX)
-    { 
+    {
         // The kernel may not be compiled; it does not have a valid definition.
         GBURBLE ("(jit: undefined) ") ;
+        GB_jitifyer_count (GB_jit_kernel_misses, family) ;
         return (GrB_NO_VALUE) ;
     }
 
     if ((GB_jit_control == GxB_JIT_OFF) || (GB_jit_control == GxB_JIT_PAUSE))
-    { 
+    {
         // The JIT control has disabled all JIT kernels.  Punt to generic.
+        GB_jitifyer_count (GB_jit_kernel_misses, family) ;
         return (GrB_NO_VALUE) ;
     }
 
+    //--------------------------------------------------------------------------
+    // probe this thread's kernel memo
+    //--------------------------------------------------------------------------
+
+    #ifndef GB_JIT_NO_MEMO
+    GB_jit_memo_entry *memo = NULL ;
+    uint64_t memo_epoch = 0 ;
+    if (encoding->suffix_len == 0)
+    {
+        // built-in kernel: check if this thread has dispatched it before
+        GB_ATOMIC_READ
+        memo_epoch = GB_jit_memo_epoch ;
+        memo = &(GB_jit_memo [hash & (GB_JIT_MEMO_SIZE - 1)]) ;
+        if (memo->epoch == memo_epoch && memo->hash == hash &&
+            memo->encoding.code == encoding->code &&
+            memo->encoding.kcode == encoding->kcode &&
+            memo->encoding.suffix_len == 0)
+        { 
+            // the memo repeats the answer the hash table gave earlier
+            (*dl_function) = memo->dl_function ;
+            GB_jitifyer_count (GB_jit_kernel_hits, family) ;
+            return (GrB_SUCCESS) ;
+        }
+    }
+    #endif
+
     //--------------------------------------------------------------------------
     // handle the GxB_JIT_RUN case: critical section not required
     //--------------------------------------------------------------------------
@@ -1461,15 +1941,18 @@ GrB_Info GB_jitifyer_load
             // an unchecked PreJIT kernel; check it inside critical section
         }
         else if ((*dl_function) != NULL)
-        { 
+        {
             // found the kernel in the hash table
+            GB_JIT_MEMO_FILL ;
+            GB_jitifyer_count (GB_jit_kernel_hits, family) ;
             return (GrB_SUCCESS) ;
         }
         else
-        { 
+        {
             // No kernels may be loaded or compiled, but existing kernels
             // already loaded may be run (handled above if dl_function was
             // found).  This kernel was not loaded, so punt to generic.
+            GB_jitifyer_count (GB_jit_kernel_misses, family) ;
             return (GrB_NO_VALUE) ;
         }
     }
@@ -1479,11 +1962,18 @@ GrB_Info GB_jitifyer_load
     //--------------------------------------------------------------------------
 
     #pragma omp critical (GB_jitifyer_worker)
-    { 
+    {
         info = GB_jitifyer_worker (dl_function, family, kname, hash,
             encoding, suffix, semiring, monoid, op, type1, type2, type3) ;
     }
 
+    if (info == GrB_SUCCESS)
+    { 
+        GB_JIT_MEMO_FILL ;
+    }
+
+    GB_jitifyer_count ((info == GrB_SUCCESS) ?
+        GB_jit_kernel_hits : GB_jit_kernel_misses, family) ;
     return (info) ;
 }
 
@@ -1672,16 +2162,44 @@ GrB_Info GB_jitifyer_worker
         encoding->code, suffix) ;
 
     //--------------------------------------------------------------------------
-    // lock the kernel
+    // record the kernel in the trace file, if enabled
     //--------------------------------------------------------------------------
 
     uint32_t bucket = hash & 0xFF ;
+
+    if (GB_jit_trace [0] != '\0')
+    {
+        // append this kernel to the trace of kernels this workload needs
+        FILE *fp_trace = fopen (GB_jit_trace, "a") ;
+        if (fp_trace != NULL)
+        {
+            fprintf (fp_trace, "%02x/%s\n", bucket, kernel_name) ;
+            fclose (fp_trace) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // lock the kernel
+    //--------------------------------------------------------------------------
     snprintf (GB_jit_temp, GB_jit_temp_allocated,
         "%s/lock/%02x/%016" PRIx64 "_lock", GB_jit_cache_path, bucket, hash) ;
     FILE *fp_klock = NULL ;
     int fd_klock = -1 ;
-    if (!GB_file_open_and_lock (GB_jit_temp, &fp_klock, &fd_klock))
+    bool klock_busy = false ;
+    if (!GB_file_open_and_trylock (GB_jit_temp, &fp_klock, &fd_klock,
+        &klock_busy))
     {
+        if (klock_busy)
+        {
+            // Another process on this host holds the lock for this same
+            // kernel, and is compiling it right now.  Do not wait for the
+            // compiler to finish; punt to the generic kernel for this call.
+            // A later call will find the finished kernel in the on-disk
+            // cache, where all processes sharing GxB_JIT_CACHE_PATH can
+            // dlopen it without recompiling.
+            GBURBLE ("(jit: kernel busy in another process) ") ;
+            return (GrB_NO_VALUE) ;
+        }
         // JIT error: unable to lock the kernel
         // disable the JIT to avoid repeated load errors
         GB_jit_control = GxB_JIT_RUN ;
@@ -1772,6 +2290,63 @@ GrB_Info GB_jitifyer_load_worker
         }
     }
 
+    //--------------------------------------------------------------------------
+    // try the read-through remote cache tier, if configured
+    //--------------------------------------------------------------------------
+
+    if (dl_handle == NULL && GB_jit_remote_path [0] != '\0')
+    {
+        // look for the compiled kernel in the remote cache
+        snprintf (GB_jit_temp2, GB_jit_temp2_allocated, "%s/lib/%02x/%s%s%s",
+            GB_jit_remote_path, bucket, GB_LIB_PREFIX, kernel_name,
+            GB_LIB_SUFFIX) ;
+        // copy it into the local cache under a process-unique temporary name,
+        // then rename it into place, so a dlopen by another process sharing
+        // the local cache never sees a partially copied library
+        snprintf (GB_jit_temp, GB_jit_temp_allocated,
+            "%s/lib/%02x/%s%s%s_%d.tmp", GB_jit_cache_path, bucket,
+            GB_LIB_PREFIX, kernel_name, GB_LIB_SUFFIX, (int) GB_GETPID ( )) ;
+        if (GB_file_copy (GB_jit_temp2, GB_jit_temp))
+        { 
+            // the copy is complete; rename it into place and load it
+            snprintf (GB_jit_temp2, GB_jit_temp2_allocated,
+                "%s/lib/%02x/%s%s%s", GB_jit_cache_path, bucket,
+                GB_LIB_PREFIX, kernel_name, GB_LIB_SUFFIX) ;
+            rename (GB_jit_temp, GB_jit_temp2) ;
+            dl_handle = GB_file_dlopen (GB_jit_temp2) ;
+            if (dl_handle != NULL)
+            {
+                // library is loaded but make sure the defn match
+                GB_jit_query_func dl_query = (GB_jit_query_func)
+                    GB_file_dlsym (dl_handle, "GB_jit_query") ;
+                bool ok = (dl_query != NULL) ;
+                if (ok)
+                { 
+                    ok = GB_jitifyer_query (dl_query, hash, semiring, monoid,
+                        op, type1, type2, type3) ;
+                }
+                if (!ok)
+                { 
+                    // the remote kernel is stale; discard the local copy and
+                    // recompile, as if the remote tier had missed
+                    GB_file_dlclose (dl_handle) ; dl_handle = NULL ;
+                    remove (GB_jit_temp2) ;
+                    GBURBLE ("(jit: remote kernel stale; must recompile) ") ;
+                }
+                else
+                { 
+                    GBURBLE ("(jit: loaded from remote cache) ") ;
+                }
+            }
+        }
+        else
+        { 
+            // remote cache miss, or the copy failed partway; remove any
+            // partial local copy and compile the kernel locally instead
+            remove (GB_jit_temp) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // create and compile source file, if needed
     //--------------------------------------------------------------------------
@@ -1825,13 +2400,26 @@ GrB_Info GB_jitifyer_load_worker
         // gracefully fail.
 
         // compile the kernel to get the lib*.so file
+        GB_jitifyer_count (GB_jit_kernel_compiles, family) ;
         if (GB_jit_use_cmake)
-        { 
+        {
             // use cmake to compile the kernel
             GB_jitifyer_cmake_compile (kernel_name, hash) ;
         }
+        else if (GB_jit_async)
+        {
+            // Compile the kernel in the background and use a generic kernel
+            // for this call, so the caller does not stall while the compiler
+            // runs.  The background job links the kernel under a temporary
+            // name and renames it into place when done, so a later call
+            // (from this or any other process) finds the finished lib*.so in
+            // the cache and loads it as usual.
+            GB_jitifyer_direct_compile_async (kernel_name, bucket) ;
+            GBURBLE ("(jit: compiling in background) ") ;
+            return (GrB_NO_VALUE) ;
+        }
         else
-        { 
+        {
             // use the compiler to directly compile the kernel
             GB_jitifyer_direct_compile (kernel_name, bucket) ;
         }
@@ -2099,6 +2687,9 @@ void GB_jitifyer_entry_free (GB_jit_entry *e)
 {
     e->dl_function = NULL ;
     GB_jit_table_populated-- ;
+    // invalidate the kernel memo of every thread
+    GB_ATOMIC_UPDATE
+    GB_jit_memo_epoch ++ ;
     GB_FREE_PERSISTENT (e->suffix) ;
     // unload the dl library
     if (e->dl_handle != NULL)
@@ -2389,6 +2980,93 @@ void GB_jitifyer_direct_compile (char *kernel_name, uint32_t bucket)
 #endif
 }
 
+//------------------------------------------------------------------------------
+// GB_jitifyer_direct_compile_async: compile a kernel in the background
+//------------------------------------------------------------------------------
+
+// The same compile/link commands as GB_jitifyer_direct_compile, except that
+// the whole job runs in a detached background shell and this method returns
+// immediately, without waiting for the compiler.  The kernel is linked under
+// a process-unique temporary name and then renamed into place, so a dlopen of
+// the lib*.so file (by this process or another sharing the same cache) never
+// sees a partially written library.  The *.o file is also process-unique and
+// is removed by the background job itself.
+
+// Like GB_jitifyer_direct_compile, this method does not return any
+// error/success code; if the compilation fails, later loads of the kernel
+// fail and the kernel is recompiled.  Not used with MSVC, which requires
+// cmake (and cmake compiles synchronously).
+
+void GB_jitifyer_direct_compile_async (char *kernel_name, uint32_t bucket)
+{
+
+#if !defined (NJIT) && !defined (_MSC_VER)
+
+    char *burble_stdout = GB_Global_burble_get ( ) ? "" : GB_DEV_NULL ;
+    char *err_redirect = (strlen (GB_jit_error_log) > 0) ? " 2>> " : "" ;
+    int pid = (int) getpid ( ) ;
+
+    snprintf (GB_jit_temp, GB_jit_temp_allocated,
+
+    // compile:
+    "sh -c \""                          // execute with POSIX shell
+    "%s "                               // compiler command
+    "-DGB_JIT_RUNTIME=1 %s "            // C flags
+    "-I%s/src "                         // include source directory
+    "%s "                               // openmp include directories
+    "-o %s/c/%02x/%s_%d%s "             // *.o output file (process-unique)
+    "-c %s/c/%02x/%s.c "                // *.c input file
+    "%s "                               // burble stdout
+    "%s %s ; "                          // error log file
+
+    // link:
+    "%s "                               // C compiler
+    "%s "                               // C flags
+    "%s "                               // C link flags
+    "-o %s/lib/%02x/%s%s%s_%d.tmp "     // temporary lib*.so output file
+    "%s/c/%02x/%s_%d%s "                // *.o input file
+    "%s "                               // libraries to link with
+    "%s "                               // burble stdout
+    "%s %s ; "                          // error log file
+
+    // rename the finished library into place, and remove the *.o file:
+    "mv -f %s/lib/%02x/%s%s%s_%d.tmp %s/lib/%02x/%s%s%s ; "
+    "rm -f %s/c/%02x/%s_%d%s"
+    "\" &",                             // run the whole job in the background
+
+    // compile:
+    GB_jit_C_compiler,                  // C compiler
+    GB_jit_C_flags,                     // C flags
+    GB_jit_cache_path,                  // include source directory (cache/src)
+    GB_OMP_INC,                         // openmp include
+    GB_jit_cache_path, bucket, kernel_name, pid, GB_OBJ_SUFFIX, // *.o output
+    GB_jit_cache_path, bucket, kernel_name,                 // *.c input file
+    burble_stdout,                      // burble stdout
+    err_redirect, GB_jit_error_log,     // error log file
+
+    // link:
+    GB_jit_C_compiler,                  // C compiler
+    GB_jit_C_flags,                     // C flags
+    GB_jit_C_link_flags,                // C link flags
+    GB_jit_cache_path, bucket,
+    GB_LIB_PREFIX, kernel_name, GB_LIB_SUFFIX, pid,         // lib*.so.tmp file
+    GB_jit_cache_path, bucket, kernel_name, pid, GB_OBJ_SUFFIX, // *.o input
+    GB_jit_C_libraries,                 // libraries to link with
+    burble_stdout,                      // burble stdout
+    err_redirect, GB_jit_error_log,     // error log file
+
+    // rename and cleanup:
+    GB_jit_cache_path, bucket, GB_LIB_PREFIX, kernel_name, GB_LIB_SUFFIX, pid,
+    GB_jit_cache_path, bucket, GB_LIB_PREFIX, kernel_name, GB_LIB_SUFFIX,
+    GB_jit_cache_path, bucket, kernel_name, pid, GB_OBJ_SUFFIX) ;
+
+    // start the background compile job and return immediately
+    GBURBLE ("(jit: %s) ", GB_jit_temp) ;
+    GB_jitifyer_command (GB_jit_temp) ; // OK: see security comment above
+
+#endif
+}
+
 //------------------------------------------------------------------------------
 // GB_jitifyer_hash:  compute the hash
 //------------------------------------------------------------------------------
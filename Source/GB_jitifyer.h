@@ -42,6 +42,10 @@ typedef enum
 }
 GB_jit_family ;
 
+// number of entries in the per-family kernel telemetry counters: entry 0
+// holds the total, and entries 1 to 9 are indexed by the GB_jit_family enum
+#define GB_JIT_NFAMILIES 10
+
 //------------------------------------------------------------------------------
 // list of jitifyed kernels
 //------------------------------------------------------------------------------
@@ -326,6 +330,7 @@ bool GB_jitifyer_query
 
 void GB_jitifyer_cmake_compile (char *kernel_name, uint64_t hash) ;
 void GB_jitifyer_direct_compile (char *kernel_name, uint32_t bucket) ;
+void GB_jitifyer_direct_compile_async (char *kernel_name, uint32_t bucket) ;
 
 GrB_Info GB_jitifyer_init (void) ;  // initialize the JIT
 
@@ -344,10 +349,19 @@ GrB_Info GB_jitifyer_include (void) ;
 void GB_jitifyer_set_control (int control) ;
 GxB_JIT_Control GB_jitifyer_get_control (void) ;
 
+// kernel telemetry counters; value has size GB_JIT_NFAMILIES
+void GB_jitifyer_get_hits (int64_t *value) ;
+void GB_jitifyer_get_misses (int64_t *value) ;
+void GB_jitifyer_get_compiles (int64_t *value) ;
+
 const char *GB_jitifyer_get_cache_path (void) ;
 GrB_Info GB_jitifyer_set_cache_path (const char *new_cache_path) ;
 GrB_Info GB_jitifyer_set_cache_path_worker (const char *new_cache_path) ;
 
+const char *GB_jitifyer_get_remote_path (void) ;
+GrB_Info GB_jitifyer_set_remote_path (const char *new_remote_path) ;
+GrB_Info GB_jitifyer_set_remote_path_worker (const char *new_remote_path) ;
+
 const char *GB_jitifyer_get_C_compiler (void) ;
 GrB_Info GB_jitifyer_set_C_compiler (const char *new_C_compiler) ;
 GrB_Info GB_jitifyer_set_C_compiler_worker (const char *new_C_compiler) ;
@@ -376,8 +390,15 @@ const char *GB_jitifyer_get_error_log (void) ;
 GrB_Info GB_jitifyer_set_error_log (const char *new_error_log) ;
 GrB_Info GB_jitifyer_set_error_log_worker (const char *new_error_log) ;
 
+const char *GB_jitifyer_get_trace (void) ;
+GrB_Info GB_jitifyer_set_trace (const char *new_trace) ;
+GrB_Info GB_jitifyer_set_trace_worker (const char *new_trace) ;
+
 bool GB_jitifyer_get_use_cmake (void) ;
 void GB_jitifyer_set_use_cmake (bool use_cmake) ;
 
+bool GB_jitifyer_get_async (void) ;
+void GB_jitifyer_set_async (bool async) ;
+
 #endif
 
@@ -107,6 +107,8 @@ GrB_Info GB_kron                    // C<M> = accum (C, kron(A,B))
 
     // quick return if an empty mask is complemented
     GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp, Mask_struct) ;
+    // quick return if a non-complemented mask has no entries
+    GB_RETURN_IF_EMPTY_MASK (C, C_replace, M, Mask_comp) ;
 
     //--------------------------------------------------------------------------
     // transpose A and B if requested
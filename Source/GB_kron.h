@@ -27,6 +27,23 @@ GrB_Info GB_kron                    // C<M> = accum (C, kron(A,B))
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_kron_mxv                // w<M> = accum (w, kron(A,B)*u)
+(
+    GrB_Matrix w,                   // input/output vector (as an n-by-1 matrix)
+    const bool C_replace,           // if true, clear w before writing to it
+    const GrB_Matrix M,             // optional mask for w, unused if NULL
+    const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_Semiring semiring,    // defines '+' and '*' for kron(A,B)*u
+    const GrB_Matrix A,             // input matrix
+    bool A_transpose,               // if true, use A' instead of A
+    const GrB_Matrix B,             // input matrix
+    bool B_transpose,               // if true, use B' instead of B
+    const GrB_Matrix u,             // input vector, never transposed
+    GB_Werk Werk
+) ;
+
 GrB_Info GB_kroner                  // C = kron (A,B)
 (
     GrB_Matrix C,                   // output matrix (static header)
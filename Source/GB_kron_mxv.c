@@ -0,0 +1,166 @@
+//------------------------------------------------------------------------------
+// GB_kron_mxv: w<M> = accum (w, kron(A,B)*u) without forming kron(A,B)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Computes w<M> = accum (w, kron(A,B)*u) via the identity
+//
+//      kron(A,B) * vec(X) = vec (B*X*A')
+//
+// where vec(X) stacks the columns of X, so the Kronecker product itself is
+// never materialized.  With A of size m1-by-n1 and B of size m2-by-n2, the
+// vector u of length n1*n2 is reshaped by column into the n2-by-n1 matrix X,
+// then T = B*X (size m2-by-n1) and Y = A*T' (size m1-by-m2) are computed with
+// the given semiring, and Y reshaped by row gives the result of length m1*m2.
+//
+// The multiplicative op is applied as mult(aij,mult(bij,x)), which matches
+// the mult(mult(aij,bij),x) of a matrix-vector multiply by the materialized
+// kron(A,B) whenever the op is associative.  Positional multiply ops are not
+// supported, since their row and column indices would refer to the unformed
+// Kronecker product.
+
+#define GB_FREE_WORKSPACE   \
+{                           \
+    GB_Matrix_free (&X) ;   \
+    GB_Matrix_free (&T) ;   \
+}
+
+#define GB_FREE_ALL         \
+{                           \
+    GB_FREE_WORKSPACE ;     \
+    GB_Matrix_free (&Y) ;   \
+}
+
+#include "GB_kron.h"
+#include "GB_mxm.h"
+#include "GB_reshape.h"
+#include "GB_accum_mask.h"
+
+GrB_Info GB_kron_mxv                // w<M> = accum (w, kron(A,B)*u)
+(
+    GrB_Matrix w,                   // input/output vector (as an n-by-1 matrix)
+    const bool C_replace,           // if true, clear w before writing to it
+    const GrB_Matrix M,             // optional mask for w, unused if NULL
+    const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_Semiring semiring,    // defines '+' and '*' for kron(A,B)*u
+    const GrB_Matrix A,             // input matrix
+    bool A_transpose,               // if true, use A' instead of A
+    const GrB_Matrix B,             // input matrix
+    bool B_transpose,               // if true, use B' instead of B
+    const GrB_Matrix u,             // input vector, never transposed
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    // w may be aliased with M and/or u
+
+    GrB_Info info ;
+    GrB_Matrix X = NULL, T = NULL, Y = NULL ;
+
+    GB_RETURN_IF_NULL_OR_FAULTY (w) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (B) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (u) ;
+    GB_RETURN_IF_FAULTY (M) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (semiring) ;
+    GB_RETURN_IF_FAULTY_OR_POSITIONAL (accum) ;
+
+    ASSERT_MATRIX_OK (w, "w input for GB_kron_mxv", GB0) ;
+    ASSERT_MATRIX_OK_OR_NULL (M, "M for GB_kron_mxv", GB0) ;
+    ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for GB_kron_mxv", GB0) ;
+    ASSERT_SEMIRING_OK (semiring, "semiring for GB_kron_mxv", GB0) ;
+    ASSERT_MATRIX_OK (A, "A for GB_kron_mxv", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for GB_kron_mxv", GB0) ;
+
+    if (GB_OP_IS_POSITIONAL (semiring->multiply))
+    { 
+        GB_ERROR (GrB_NOT_IMPLEMENTED, "%s",
+            "GxB_kron_mxv does not support positional multiply operators") ;
+    }
+
+    // check domains and dimensions for w<M> = accum (w,t); the two internal
+    // matrix multiplies check the compatibility of A, B, and u with the
+    // semiring
+    GrB_Type ztype = semiring->add->op->ztype ;
+    GB_OK (GB_compatible (w->type, w, M, Mask_struct, accum, ztype, Werk)) ;
+
+    int64_t anrows = (A_transpose) ? GB_NCOLS (A) : GB_NROWS (A) ;
+    int64_t ancols = (A_transpose) ? GB_NROWS (A) : GB_NCOLS (A) ;
+    int64_t bnrows = (B_transpose) ? GB_NCOLS (B) : GB_NROWS (B) ;
+    int64_t bncols = (B_transpose) ? GB_NROWS (B) : GB_NCOLS (B) ;
+    GrB_Index cnrows, cncols ;
+    bool ok = GB_int64_multiply (&cnrows, anrows, bnrows) ;
+    ok = ok && GB_int64_multiply (&cncols, ancols, bncols) ;
+    if (!ok || w->vlen != (int64_t) cnrows || u->vlen != (int64_t) cncols)
+    { 
+        GB_ERROR (GrB_DIMENSION_MISMATCH, "%s:\n"
+            "output is " GBd "-by-1; must be " GBu "-by-1\n"
+            "input vector is " GBd "-by-1; must be " GBu "-by-1\n"
+            "first input is " GBd "-by-" GBd "%s\n"
+            "second input is " GBd "-by-" GBd "%s",
+            ok ? "Dimensions not compatible" : "Problem too large",
+            w->vlen, cnrows, u->vlen, cncols,
+            anrows, ancols, A_transpose ? " (transposed)" : "",
+            bnrows, bncols, B_transpose ? " (transposed)" : "") ;
+    }
+
+    // quick return if an empty mask is complemented
+    GB_RETURN_IF_QUICK_MASK (w, C_replace, M, Mask_comp, Mask_struct) ;
+    // quick return if a non-complemented mask has no entries
+    GB_RETURN_IF_EMPTY_MASK (w, C_replace, M, Mask_comp) ;
+
+    //--------------------------------------------------------------------------
+    // X = reshape (u, n2, n1) by column
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_reshape (&X, (GrB_Matrix) u, true, bncols, ancols, Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // T = B*X or B'*X, of size m2-by-n1
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_new (&T, // auto sparsity, new header
+        ztype, bnrows, ancols, GB_Ap_calloc, true, GxB_AUTO_SPARSITY,
+        GB_Context_hyper_switch ( ), 1)) ;
+    GB_OK (GB_mxm (T, false, NULL, false, false, NULL, semiring,
+        B, B_transpose, X, false, false, GxB_DEFAULT, 0, Werk)) ;
+    GB_Matrix_free (&X) ;
+    ASSERT_MATRIX_OK (T, "T = B*X for GB_kron_mxv", GB0) ;
+
+    //--------------------------------------------------------------------------
+    // Y = A*T' or A'*T', of size m1-by-m2
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_new (&Y, // auto sparsity, new header
+        ztype, anrows, bnrows, GB_Ap_calloc, true, GxB_AUTO_SPARSITY,
+        GB_Context_hyper_switch ( ), 1)) ;
+    GB_OK (GB_mxm (Y, false, NULL, false, false, NULL, semiring,
+        A, A_transpose, T, true, false, GxB_DEFAULT, 0, Werk)) ;
+    GB_FREE_WORKSPACE ;
+    ASSERT_MATRIX_OK (Y, "Y = A*T' for GB_kron_mxv", GB0) ;
+
+    //--------------------------------------------------------------------------
+    // reshape Y by row into a vector of length m1*m2
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_reshape (NULL, Y, false, (int64_t) cnrows, 1, Werk)) ;
+    ASSERT_MATRIX_OK (Y, "Y reshaped for GB_kron_mxv", GB0) ;
+
+    //--------------------------------------------------------------------------
+    // w<M> = accum (w,Y): accumulate the results into w via the mask
+    //--------------------------------------------------------------------------
+
+    return (GB_accum_mask (w, M, NULL, accum, &Y, C_replace, Mask_comp,
+        Mask_struct, Werk)) ;
+}
+
@@ -0,0 +1,176 @@
+//------------------------------------------------------------------------------
+// GB_lookup_cache: build or free the point-lookup index of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A->lookup_p and A->lookup_e form an opt-in hash index over the entries of a
+// sparse or hypersparse matrix, mapping (i,j) to the position of A(i,j) in
+// A->i and A->x.  With the index, GrB_Matrix_extractElement finds an entry in
+// O(1) expected time instead of the O(log(d)) binary search of its vector, so
+// a serving workload of many random point reads of a static matrix is no
+// longer dominated by the searches.  The index holds the position of every
+// entry, so a failed probe also answers "entry not present" in O(1) time.
+
+// Bucket b of the index holds the entry positions
+// lookup_e [lookup_p [b] ... lookup_p [b+1]-1], built by a parallel counting
+// sort of all entries on their bucket GB_HASHF_POINT (i,j).  A candidate
+// position p matches a query (i,j) iff A->i [p] == i and p lies within the
+// vector j, so the buckets need not store the keys themselves.  The number of
+// buckets is the smallest power of 2 strictly larger than nnz(A), as for the
+// A->Y hyper_hash, so buckets hold one entry each on average.
+
+// Unlike the A->Y hyper_hash and the A->degree cache, the index is never
+// built on demand: a single extractElement gains nothing from it, so it is
+// only built when the user asks for it with GxB_Matrix_lookup_build.  It is
+// freed whenever the pattern of the matrix changes, at the same places the
+// A->degree cache is freed (see GB_degree.c); a subsequent
+// GxB_Matrix_lookup_build rebuilds it.  It is not serialized, it is always
+// deep, and it is never shared between matrices.
+
+#include "GB.h"
+#include "GB_cumsum.h"
+
+#define GB_FREE_ALL                                 \
+{                                                   \
+    GB_FREE_WORK (&W, W_size) ;                     \
+    GB_lookup_cache_free (A) ;                      \
+}
+
+//------------------------------------------------------------------------------
+// GB_lookup_cache_free: free the point-lookup index of a matrix
+//------------------------------------------------------------------------------
+
+void GB_lookup_cache_free       // free the point-lookup index of a matrix
+(
+    GrB_Matrix A                // matrix with content to free
+)
+{
+    if (A != NULL)
+    {
+        GB_FREE (&(A->lookup_p), A->lookup_p_size) ;
+        GB_FREE (&(A->lookup_e), A->lookup_e_size) ;
+        A->lookup_p = NULL ;
+        A->lookup_p_size = 0 ;
+        A->lookup_e = NULL ;
+        A->lookup_e_size = 0 ;
+        A->lookup_nbuckets = 0 ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_lookup_cache_build: build the point-lookup index of a matrix
+//------------------------------------------------------------------------------
+
+GrB_Info GB_lookup_cache_build  // build the point-lookup index of a matrix
+(
+    GrB_Matrix A,               // matrix to index; pending work is finished
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs and finish any pending work
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    int64_t *restrict W = NULL ; size_t W_size = 0 ;
+    ASSERT_MATRIX_OK (A, "A input for GB_lookup_cache_build", GB0) ;
+    GB_MATRIX_WAIT (A) ;
+
+    if (A->lookup_p != NULL)
+    {
+        // the point-lookup index is already built
+        return (GrB_SUCCESS) ;
+    }
+
+    const int64_t anz = GB_nnz (A) ;
+    if (A->p == NULL || anz == 0)
+    {
+        // A is bitmap or full, where point lookups are already O(1), or it
+        // has no entries; there is nothing to index
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the index and the workspace
+    //--------------------------------------------------------------------------
+
+    const int64_t nbuckets = ((uint64_t) 1) << (GB_FLOOR_LOG2 (anz) + 1) ;
+    const uint64_t hash_bits = (uint64_t) (nbuckets - 1) ;
+
+    A->lookup_p = GB_CALLOC (nbuckets + 1, int64_t, &(A->lookup_p_size)) ;
+    A->lookup_e = GB_MALLOC (anz, int64_t, &(A->lookup_e_size)) ;
+    W = GB_MALLOC_WORK (nbuckets, int64_t, &W_size) ;
+    if (A->lookup_p == NULL || A->lookup_e == NULL || W == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    int64_t *restrict Bp = A->lookup_p ;
+    int64_t *restrict Be = A->lookup_e ;
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int64_t *restrict Ai = A->i ;
+    const int64_t anvec = A->nvec ;
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // count the entries in each bucket
+    //--------------------------------------------------------------------------
+
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,8)
+    for (k = 0 ; k < anvec ; k++)
+    {
+        const int64_t j = GBH (Ah, k) ;
+        for (int64_t p = Ap [k] ; p < Ap [k+1] ; p++)
+        {
+            const int64_t b = GB_HASHF_POINT (Ai [p], j, hash_bits) ;
+            // update the count of bucket b atomically
+            GB_ATOMIC_UPDATE
+            Bp [b]++ ;
+        }
+    }
+
+    GB_cumsum (Bp, nbuckets, NULL, nthreads, Werk) ;
+    ASSERT (Bp [nbuckets] == anz) ;
+    GB_memcpy (W, Bp, nbuckets * sizeof (int64_t), nthreads) ;
+
+    //--------------------------------------------------------------------------
+    // place each entry in its bucket
+    //--------------------------------------------------------------------------
+
+    // the entries within a bucket appear in arbitrary order, which is fine:
+    // a probe scans its whole bucket (one entry, on average)
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,8)
+    for (k = 0 ; k < anvec ; k++)
+    {
+        const int64_t j = GBH (Ah, k) ;
+        for (int64_t p = Ap [k] ; p < Ap [k+1] ; p++)
+        {
+            const int64_t b = GB_HASHF_POINT (Ai [p], j, hash_bits) ;
+            int64_t s ;
+            GB_ATOMIC_CAPTURE_INC64 (s, W [b]) ;
+            Be [s] = p ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    A->lookup_nbuckets = nbuckets ;
+    GB_FREE_WORK (&W, W_size) ;
+    ASSERT_MATRIX_OK (A, "A with point-lookup index", GB0) ;
+    return (GrB_SUCCESS) ;
+}
@@ -27,9 +27,12 @@ void GB_macrofy_ewise           // construct all macros for GrB_eWise
     // extract the binaryop scode
     //--------------------------------------------------------------------------
 
+    // bound scalar folded into a bind1st/bind2nd kernel (13 bits)
+    uint64_t bind_fold = GB_RSHIFT (scode, 51, 13) ;
+
     // method (3 bits)
 //  bool is_emult   = GB_RSHIFT (scode, 50, 1) ;
-//  bool is_union   = GB_RSHIFT (scode, 49, 1) ;
+    bool is_union   = GB_RSHIFT (scode, 49, 1) ;
     bool copy_to_C  = GB_RSHIFT (scode, 48, 1) ;
 
     // C in, A, and B iso-valued and flipxy (one hex digit)
@@ -135,6 +138,40 @@ void GB_macrofy_ewise           // construct all macros for GrB_eWise
         fprintf (fp, "#define GB_OP_IS_SECOND 1\n") ;
     }
 
+    if (bind_fold != 0 && !C_iso)
+    {
+        if (is_union)
+        {
+            // the alpha and/or beta default scalars of an eWiseUnion kernel
+            // are small integers, folded into the kernel as compile-time
+            // constants, each in its own 6-bit field of the scode (see
+            // GB_UNION_SCALAR_MAX)
+            uint64_t alpha_fold = (bind_fold     ) & 0x3F ;
+            uint64_t beta_fold  = (bind_fold >> 6) & 0x3F ;
+            if (alpha_fold != 0)
+            {
+                fprintf (fp, "#define GB_ALPHA_SCALAR ((GB_X_TYPE) %" PRIu64
+                    ")\n", alpha_fold - 1) ;
+            }
+            if (beta_fold != 0)
+            {
+                fprintf (fp, "#define GB_BETA_SCALAR ((GB_Y_TYPE) %" PRIu64
+                    ")\n", beta_fold - 1) ;
+            }
+        }
+        else
+        {
+            // the bound scalar of a bind1st/bind2nd apply kernel is a small
+            // integer, folded into the kernel as a compile-time constant
+            // (see GB_enumify_bind_scalar); acode of 15 denotes bind1st
+            fprintf (fp, "#define GB_BIND%s_SCALAR ((GB_%s_TYPE) %" PRIu64
+                ")\n",
+                (acode == 15) ? "1ST" : "2ND",
+                (acode == 15) ? "X" : "Y",
+                bind_fold - 1) ;
+        }
+    }
+
     GB_macrofy_cast_copy (fp, "C", "A", (C_iso || !copy_to_C) ? NULL : ctype,
             (acode == 0 || acode == 15) ? NULL : atype, A_iso_code) ;
 
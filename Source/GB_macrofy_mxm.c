@@ -303,6 +303,24 @@ void GB_macrofy_mxm        // construct all macros for GrB_mxm
         // future:: try AVX acceleration on more semirings
         fprintf (fp, "#define GB_SEMIRING_HAS_AVX_IMPLEMENTATION 1\n") ;
     }
+    else if ((addop->opcode == GB_MIN_binop_code ||
+              addop->opcode == GB_MAX_binop_code)
+        && (mult->opcode == GB_PLUS_binop_code ||
+            mult->opcode == GB_TIMES_binop_code)
+        && (zcode >= GB_INT8_code && zcode <= GB_UINT64_code))
+    { 
+
+        //----------------------------------------------------------------------
+        // semiring is an integer tropical semiring
+        //----------------------------------------------------------------------
+
+        // MIN_PLUS, MIN_TIMES, MAX_PLUS, and MAX_TIMES over the integers: the
+        // saxpy5 vector kernels fold the monoid with an elementwise select,
+        // which is exact for integers.  The floating-point MIN/MAX monoids
+        // are excluded, since their omitnan semantics do not reduce to a
+        // select; they use the scalar unrolled kernel instead.
+        fprintf (fp, "#define GB_SEMIRING_HAS_AVX_IMPLEMENTATION 1\n") ;
+    }
 
     //--------------------------------------------------------------------------
     // special case multiply ops
@@ -27,7 +27,46 @@ static inline void *GB_malloc_helper
     // make sure the block is at least 8 bytes in size
     (*size) = GB_IMAX (*size, 8) ;
 
+    // if the Context engaged to this user thread has its own allocator, all
+    // allocations use it (bypassing the free pool, whose blocks would
+    // otherwise migrate between allocators)
+    p = GB_Context_alloc (*size) ;
+    if (p != NULL)
+    {
+        return (p) ;
+    }
+
+    if (GB_pool_poolable (size))
+    {
+        // the size is now rounded up to a power-of-two size class; try to
+        // recycle a block of that size from the free pool
+        p = GB_pool_get (*size) ;
+        if (p != NULL)
+        {
+            return (p) ;
+        }
+    }
+
+    // spill very large blocks to a file mapping, if enabled
+    p = GB_spill_malloc (*size, false) ;
+    if (p != NULL)
+    {
+        return (p) ;
+    }
+
     p = GB_Global_malloc_function (*size) ;
+    if (p == NULL && GB_Global_memory_pressure (*size))
+    {
+        // the memory-pressure callback released some memory; retry once
+        p = GB_Global_malloc_function (*size) ;
+    }
+    if (p == NULL)
+    {
+        // last resort: a file mapping, if spilling is enabled, regardless of
+        // the block size
+        return (GB_spill_malloc (*size, true)) ;
+    }
+    GB_Global_hugepage_advise (p, *size) ;
 
     #ifdef GB_MEMDUMP
     printf ("hard malloc %p %ld\n", p, *size) ; // MEMDUMP
@@ -113,6 +152,15 @@ GB_CALLBACK_MALLOC_MEMORY_PROTO (GB_malloc_memory)
 
     (*size_allocated) = (p == NULL) ? 0 : size ;
     ASSERT (GB_IMPLIES (p != NULL, size == GB_Global_memtable_size (p))) ;
+    if (p != NULL)
+    {
+        GB_Global_memory_in_use_adjust ((int64_t) size) ;
+        if (GB_Global_profiling_get ( ))
+        {
+            GB_Global_profile_bytes_adjust ((int64_t) size) ;
+            GB_prof_memory ((int64_t) size) ;
+        }
+    }
     return (p) ;
 }
 
@@ -0,0 +1,92 @@
+//------------------------------------------------------------------------------
+// GB_materialize: apply the deferred unary operator of a matrix, in place
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// In nonblocking mode, GrB_apply can return its output in O(1) time as a
+// duplicate sharing the arrays of its input, with the unary operator recorded
+// in A->deferred_unop instead of applied to the values (see GB_apply).  This
+// method applies the deferred operator to the values of A, in place, and
+// clears it.  It is called by GB_wait, and directly by methods that read or
+// modify individual values in place (see GB_setElement, GB_AxB_dot4, and
+// others).  Deferring the operator means it is applied at most once no
+// matter how many operations created the matrix, and it is skipped entirely
+// if the matrix is freed or overwritten before its values are needed.
+
+// The operator applies only to the values already in A->x.  Zombies keep
+// their (ignored) values, and pending tuples are untouched: they can only
+// have been added after the apply was deferred, so the operator must not be
+// applied to them.
+
+#include "GB_apply.h"
+
+#define GB_FREE_ALL ;
+
+GrB_Info GB_materialize         // apply any deferred unary op, in place
+(
+    GrB_Matrix A,               // matrix with a deferred unary op
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    if (A == NULL || A->deferred_unop == NULL)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    GB_Operator op = (GB_Operator) A->deferred_unop ;
+    A->deferred_unop = NULL ;
+    ASSERT_OP_OK (op, "deferred unop to materialize", GB0) ;
+    ASSERT (op->ztype == A->type) ;
+    // positional ops compute from the pattern and ignore op->xtype
+    ASSERT (GB_OPCODE_IS_POSITIONAL (op->opcode) || op->xtype == A->type) ;
+    GB_BURBLE_MATRIX (A, "(materialize: %s) ", op->name) ;
+
+    if (A->x == NULL || GB_nnz_held (A) == 0)
+    {
+        // no values to operate on
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // ensure A owns its arrays exclusively
+    //--------------------------------------------------------------------------
+
+    // A was created by GB_dup_shared, so A->x is likely still shared with
+    // the input of the deferred apply; get a private copy before modifying
+    // the values in place
+    GB_OK (GB_unshare (A)) ;
+
+    //--------------------------------------------------------------------------
+    // A->x = op (A->x), in place, with no typecasting
+    //--------------------------------------------------------------------------
+
+    GB_iso_code A_code_iso = GB_unop_code_iso (A, op, false) ;
+    if (A_code_iso == GB_NON_ISO && A->iso)
+    {
+        // expand A to non-iso, initializing A->x
+        GB_OK (GB_convert_any_to_non_iso (A, true)) ;
+    }
+    GB_OK (GB_apply_op ((GB_void *) A->x, A->type, A_code_iso, op,
+        NULL, false, false, A, Werk)) ;
+    if (A_code_iso != GB_NON_ISO)
+    {
+        // compact the iso values of A
+        A->iso = true ;
+        GB_OK (GB_convert_any_to_iso (A, NULL)) ;
+    }
+
+    ASSERT_MATRIX_OK (A, "A materialized", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
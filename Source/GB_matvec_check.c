@@ -298,7 +298,7 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
 
     int64_t nallocs ;
     size_t mem_deep, mem_shallow, memsize ;
-    GB_memoryUsage (&nallocs, &mem_deep, &mem_shallow, A, true) ;
+    GB_memoryUsage (&nallocs, &mem_deep, &mem_shallow, NULL, A, true) ;
     memsize = mem_deep + (pr_mem_shallow ? mem_shallow : 0) ;
 
     #if GB_DEVELOPER
@@ -503,6 +503,11 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
             A->nzombies) ;
     }
 
+    if (A->deferred_unop != NULL)
+    { 
+        GBPR0 ("  deferred unary op: %s\n", A->deferred_unop->name) ;
+    }
+
     if (is_full || is_bitmap)
     {
         if (A->nzombies != 0)
@@ -15,6 +15,46 @@
 
 #define GB_MEM_CHUNK (1024*1024)
 
+#if defined ( __SSE2__ )
+#include <emmintrin.h>
+
+// GB_memcpy_stream: memcpy with non-temporal stores.  A huge output array
+// (a concatenated or converted matrix, say) will not be re-read soon, so
+// writing it through the cache only evicts data that will be.  The caller
+// must issue an _mm_sfence after its last call, to order the streamed
+// stores before any subsequent reads of dest.
+static inline void GB_memcpy_stream
+(
+    GB_void *dest,
+    const GB_void *src,
+    size_t n
+)
+{
+    // head: bytes up to the first 16-byte boundary of dest, via ordinary
+    // memcpy; only the stores are streamed, so src need not be aligned
+    size_t head = (16 - (((uintptr_t) dest) & 15)) & 15 ;
+    head = GB_IMIN (head, n) ;
+    if (head > 0)
+    { 
+        memcpy (dest, src, head) ;
+        dest += head ;
+        src += head ;
+        n -= head ;
+    }
+    // middle: whole 16-byte words, streamed past the cache
+    for ( ; n >= 16 ; dest += 16, src += 16, n -= 16)
+    { 
+        _mm_stream_si128 ((__m128i *) dest,
+            _mm_loadu_si128 ((const __m128i *) src)) ;
+    }
+    // tail: any remaining bytes
+    if (n > 0)
+    { 
+        memcpy (dest, src, n) ;
+    }
+}
+#endif
+
 void GB_memcpy                  // parallel memcpy
 (
     void *dest,                 // destination
@@ -24,6 +64,13 @@ void GB_memcpy                  // parallel memcpy
 )
 {
 
+    #if defined ( __SSE2__ )
+    // stream the writes past the cache if the engaged Context requests it
+    // and the region is large enough (see GxB_CONTEXT_STREAM_THRESHOLD)
+    size_t stream_threshold = GB_Context_stream_threshold ( ) ;
+    bool stream = (stream_threshold > 0 && n >= stream_threshold) ;
+    #endif
+
     if (nthreads <= 1 || n <= GB_MEM_CHUNK)
     { 
 
@@ -31,7 +78,17 @@ void GB_memcpy                  // parallel memcpy
         // memcpy using a single thread
         //----------------------------------------------------------------------
 
-        memcpy (dest, src, n) ;
+        #if defined ( __SSE2__ )
+        if (stream)
+        { 
+            GB_memcpy_stream ((GB_void *) dest, (const GB_void *) src, n) ;
+            _mm_sfence ( ) ;
+        }
+        else
+        #endif
+        { 
+            memcpy (dest, src, n) ;
+        }
     }
     else
     {
@@ -56,9 +113,26 @@ void GB_memcpy                  // parallel memcpy
             if (start < n)
             { 
                 size_t chunk = GB_IMIN (n - start, GB_MEM_CHUNK) ;
-                memcpy (pdest + start, psrc + start, chunk) ;
+                #if defined ( __SSE2__ )
+                if (stream)
+                { 
+                    GB_memcpy_stream (pdest + start, psrc + start, chunk) ;
+                }
+                else
+                #endif
+                { 
+                    memcpy (pdest + start, psrc + start, chunk) ;
+                }
             }
         }
+
+        #if defined ( __SSE2__ )
+        if (stream)
+        { 
+            // order the streamed stores before any subsequent reads of dest
+            _mm_sfence ( ) ;
+        }
+        #endif
     }
 }
 
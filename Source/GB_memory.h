@@ -19,6 +19,9 @@ void GB_memoryUsage         // count # allocated blocks and their sizes
     int64_t *nallocs,       // # of allocated memory blocks
     size_t *mem_deep,       // # of bytes in blocks owned by this matrix
     size_t *mem_shallow,    // # of bytes in blocks owned by another matrix
+    size_t *mem_component,  // if not NULL: array of size
+                            // GxB_MEMORY_USAGE_NCOMPONENTS, the deep bytes
+                            // broken down by matrix component
     const GrB_Matrix A,     // matrix to query
     bool count_hyper_hash   // if true, include A->Y
 ) ;
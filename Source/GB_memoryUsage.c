@@ -14,6 +14,9 @@ void GB_memoryUsage         // count # allocated blocks and their sizes
     int64_t *nallocs,       // # of allocated memory blocks
     size_t *mem_deep,       // # of bytes in blocks owned by this matrix
     size_t *mem_shallow,    // # of bytes in blocks owned by another matrix
+    size_t *mem_component,  // if not NULL: array of size
+                            // GxB_MEMORY_USAGE_NCOMPONENTS, the deep bytes
+                            // broken down by matrix component
     const GrB_Matrix A,     // matrix to query
     bool count_hyper_hash   // if true, include A->Y
 )
@@ -37,6 +40,14 @@ void GB_memoryUsage         // count # allocated blocks and their sizes
     (*mem_deep) = 0 ;
     (*mem_shallow) = 0 ;
 
+    if (mem_component != NULL)
+    {
+        for (int k = 0 ; k < GxB_MEMORY_USAGE_NCOMPONENTS ; k++)
+        { 
+            mem_component [k] = 0 ;
+        }
+    }
+
     if (A == NULL)
     { 
         #pragma omp flush
@@ -45,14 +56,24 @@ void GB_memoryUsage         // count # allocated blocks and their sizes
 
     GB_Pending Pending = A->Pending ;
 
+    #define GB_COUNT_COMPONENT(k,size)          \
+    {                                           \
+        if (mem_component != NULL)              \
+        {                                       \
+            mem_component [k] += (size) ;       \
+        }                                       \
+    }
+
     if (!A->static_header)
     { 
         (*nallocs)++ ;
         (*mem_deep) += A->header_size ;
+        GB_COUNT_COMPONENT (GxB_MEMORY_USAGE_HEADER, A->header_size) ;
     }
 
-    if (A->p != NULL)
+    if (A->p != NULL && A->p != A->p_static)
     {
+        // a header-resident A->p is already counted in the header itself
         if (A->p_shallow)
         { 
             (*mem_shallow) += A->p_size ;
@@ -61,6 +82,7 @@ void GB_memoryUsage         // count # allocated blocks and their sizes
         { 
             (*nallocs)++ ;
             (*mem_deep) += A->p_size ;
+            GB_COUNT_COMPONENT (GxB_MEMORY_USAGE_P, A->p_size) ;
         }
     }
 
@@ -74,6 +96,7 @@ void GB_memoryUsage         // count # allocated blocks and their sizes
         { 
             (*nallocs)++ ;
             (*mem_deep) += A->h_size ;
+            GB_COUNT_COMPONENT (GxB_MEMORY_USAGE_H, A->h_size) ;
         }
     }
 
@@ -87,6 +110,7 @@ void GB_memoryUsage         // count # allocated blocks and their sizes
         { 
             (*nallocs)++ ;
             (*mem_deep) += A->b_size ;
+            GB_COUNT_COMPONENT (GxB_MEMORY_USAGE_B, A->b_size) ;
         }
     }
 
@@ -100,6 +124,7 @@ void GB_memoryUsage         // count # allocated blocks and their sizes
         { 
             (*nallocs)++ ;
             (*mem_deep) += A->i_size ;
+            GB_COUNT_COMPONENT (GxB_MEMORY_USAGE_I, A->i_size) ;
         }
     }
 
@@ -113,6 +138,7 @@ void GB_memoryUsage         // count # allocated blocks and their sizes
         { 
             (*nallocs)++ ;
             (*mem_deep) += A->x_size ;
+            GB_COUNT_COMPONENT (GxB_MEMORY_USAGE_X, A->x_size) ;
         }
     }
 
@@ -120,24 +146,28 @@ void GB_memoryUsage         // count # allocated blocks and their sizes
     { 
         (*nallocs)++ ;
         (*mem_deep) += Pending->header_size ;
+        GB_COUNT_COMPONENT (GxB_MEMORY_USAGE_PENDING, Pending->header_size) ;
     }
 
     if (Pending != NULL && Pending->i != NULL)
     { 
         (*nallocs)++ ;
         (*mem_deep) += Pending->i_size ;
+        GB_COUNT_COMPONENT (GxB_MEMORY_USAGE_PENDING, Pending->i_size) ;
     }
 
     if (Pending != NULL && Pending->j != NULL)
     { 
         (*nallocs)++ ;
         (*mem_deep) += Pending->j_size ;
+        GB_COUNT_COMPONENT (GxB_MEMORY_USAGE_PENDING, Pending->j_size) ;
     }
 
     if (Pending != NULL && Pending->x != NULL)
     { 
         (*nallocs)++ ;
         (*mem_deep) += Pending->x_size ;
+        GB_COUNT_COMPONENT (GxB_MEMORY_USAGE_PENDING, Pending->x_size) ;
     }
 
     if (count_hyper_hash && A->Y != NULL)
@@ -145,7 +175,8 @@ void GB_memoryUsage         // count # allocated blocks and their sizes
         int64_t Y_nallocs = 0 ;
         size_t Y_mem_deep = 0 ;
         size_t Y_mem_shallow = 0 ;
-        GB_memoryUsage (&Y_nallocs, &Y_mem_deep, &Y_mem_shallow, A->Y, false) ;
+        GB_memoryUsage (&Y_nallocs, &Y_mem_deep, &Y_mem_shallow, NULL,
+            A->Y, false) ;
         if (A->Y_shallow)
         { 
             // all of A->Y is shallow
@@ -157,6 +188,7 @@ void GB_memoryUsage         // count # allocated blocks and their sizes
             (*nallocs) += Y_nallocs ;
             (*mem_deep) += Y_mem_deep ;
             (*mem_shallow) += Y_mem_shallow ;
+            GB_COUNT_COMPONENT (GxB_MEMORY_USAGE_HYPER_HASH, Y_mem_deep) ;
         }
     }
 
@@ -15,8 +15,49 @@
 
 #define GB_MEM_CHUNK (1024*1024)
 
+#if defined ( __SSE2__ )
+#include <emmintrin.h>
+
+// GB_memset_stream: memset with non-temporal stores.  A huge output array
+// (a bitmap pattern, say) will not be re-read soon, so writing it through
+// the cache only evicts data that will be.  The caller must issue an
+// _mm_sfence after its last call, to order the streamed stores before any
+// subsequent reads of dest.
+static inline void GB_memset_stream (GB_void *dest, int c, size_t n)
+{
+    // head: bytes up to the first 16-byte boundary, via ordinary memset
+    size_t head = (16 - (((uintptr_t) dest) & 15)) & 15 ;
+    head = GB_IMIN (head, n) ;
+    if (head > 0)
+    { 
+        memset (dest, c, head) ;
+        dest += head ;
+        n -= head ;
+    }
+    // middle: whole 16-byte words, streamed past the cache
+    __m128i cword = _mm_set1_epi8 ((char) c) ;
+    for ( ; n >= 16 ; dest += 16, n -= 16)
+    { 
+        _mm_stream_si128 ((__m128i *) dest, cword) ;
+    }
+    // tail: any remaining bytes
+    if (n > 0)
+    { 
+        memset (dest, c, n) ;
+    }
+}
+#endif
+
 GB_CALLBACK_MEMSET_PROTO (GB_memset)
 {
+
+    #if defined ( __SSE2__ )
+    // stream the writes past the cache if the engaged Context requests it
+    // and the region is large enough (see GxB_CONTEXT_STREAM_THRESHOLD)
+    size_t stream_threshold = GB_Context_stream_threshold ( ) ;
+    bool stream = (stream_threshold > 0 && n >= stream_threshold) ;
+    #endif
+
     if (nthreads <= 1 || n <= GB_MEM_CHUNK)
     { 
 
@@ -24,7 +65,17 @@ GB_CALLBACK_MEMSET_PROTO (GB_memset)
         // memset using a single thread
         //----------------------------------------------------------------------
 
-        memset (dest, c, n) ;
+        #if defined ( __SSE2__ )
+        if (stream)
+        { 
+            GB_memset_stream ((GB_void *) dest, c, n) ;
+            _mm_sfence ( ) ;
+        }
+        else
+        #endif
+        { 
+            memset (dest, c, n) ;
+        }
     }
     else
     {
@@ -48,9 +99,26 @@ GB_CALLBACK_MEMSET_PROTO (GB_memset)
             if (start < n)
             { 
                 size_t chunk = GB_IMIN (n - start, GB_MEM_CHUNK) ;
-                memset (pdest + start, c, chunk) ;
+                #if defined ( __SSE2__ )
+                if (stream)
+                { 
+                    GB_memset_stream (pdest + start, c, chunk) ;
+                }
+                else
+                #endif
+                { 
+                    memset (pdest + start, c, chunk) ;
+                }
             }
         }
+
+        #if defined ( __SSE2__ )
+        if (stream)
+        { 
+            // order the streamed stores before any subsequent reads of dest
+            _mm_sfence ( ) ;
+        }
+        #endif
     }
 }
 
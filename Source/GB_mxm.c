@@ -62,6 +62,9 @@ GrB_Info GB_mxm                     // C<M> = A*B
     ASSERT_MATRIX_OK (A, "A for GB_mxm", GB0) ;
     ASSERT_MATRIX_OK (B, "B for GB_mxm", GB0) ;
 
+    // the in-place methods (dot4, saxpy4, saxpy5) update C->x directly
+    GB_fingerprint_clear (C) ;
+
     // check domains and dimensions for C<M> = accum (C,T)
     GrB_Type T_type = semiring->add->op->ztype ;
     GB_OK (GB_compatible (C->type, C, M_input, Mask_struct, accum, T_type,
@@ -112,6 +115,8 @@ GrB_Info GB_mxm                     // C<M> = A*B
 
     // quick return if a NULL mask is complemented
     GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp, Mask_struct) ;
+    // quick return if a non-complemented mask has no entries
+    GB_RETURN_IF_EMPTY_MASK (C, C_replace, M, Mask_comp) ;
     GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (A) ;
     GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (B) ;
 
@@ -97,6 +97,15 @@ GrB_Info GB_colscale                // C = A*D, column scale with diagonal D
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_scale               // C = D*C (row scale) or C = C*D (col scale)
+(
+    GrB_Matrix C,               // input/output matrix, modified in place
+    const GrB_BinaryOp op,      // scaling operator; op ztype must be C->type
+    const GrB_Matrix D,         // diagonal matrix of scale factors
+    const bool D_on_left,       // if true, C = D*C; otherwise C = C*D
+    GB_Werk Werk
+) ;
+
 bool GB_AxB_semiring_builtin        // true if semiring is builtin
 (
     // inputs:
@@ -249,6 +258,8 @@ static inline bool GB_AxB_dot3_control
 
 bool GB_AxB_dot2_control  // true: use dot2, false: use saxpy
 (
+    const GrB_Matrix M,             // mask matrix (may be NULL)
+    const bool Mask_comp,           // if true, use !M
     const GrB_Matrix A,
     const GrB_Matrix B
 ) ;
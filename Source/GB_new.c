@@ -103,6 +103,42 @@ GrB_Info GB_new                 // create matrix, except for indices & values
     A->hyper_switch = hyper_switch ;
     A->bitmap_switch = GB_Global_bitmap_switch_matrix_get (vlen, vdim) ;
     A->sparsity_control = GxB_AUTO_SPARSITY ;
+    A->gpu_device = -1 ;
+
+    // no adaptive A'*B method history yet
+    A->adotb_dot_cost = 0 ;
+    A->adotb_saxpy_cost = 0 ;
+
+    // no select history yet
+    A->select_opcode = 0 ;
+    A->select_anz = 0 ;
+    A->select_cnz = -1 ;
+
+    // no sparse <-> bitmap conversion history yet
+    A->s2b_last = 0 ;
+    A->s2b_thrash = 0 ;
+
+    // no format advisor history yet
+    A->conv_to_bitmap = 0 ;
+    A->conv_from_bitmap = 0 ;
+    A->conv_to_hyper = 0 ;
+    A->conv_from_hyper = 0 ;
+    A->yhash_builds = 0 ;
+
+    // no row degree cache yet
+    A->degree = NULL ;
+    A->degree_size = 0 ;
+
+    // no point-lookup index yet
+    A->lookup_p = NULL ;
+    A->lookup_p_size = 0 ;
+    A->lookup_e = NULL ;
+    A->lookup_e_size = 0 ;
+    A->lookup_nbuckets = 0 ;
+
+    // no content fingerprint yet
+    A->fingerprint = 0 ;
+    A->fingerprint_ok = false ;
 
     if (sparsity == GxB_HYPERSPARSE)
     { 
@@ -165,6 +201,7 @@ GrB_Info GB_new                 // create matrix, except for indices & values
     A->nzombies = 0 ;
     A->jumbled = false ;
     A->Pending = NULL ;
+    A->deferred_unop = NULL ;
     A->iso = false ;            // OK: if iso, burble in the caller
 
     //--------------------------------------------------------------------------
@@ -180,6 +217,20 @@ GrB_Info GB_new                 // create matrix, except for indices & values
         A->h = NULL ;
         ok = true ;
     }
+    else if (!A_is_hyper && A->plen == 1)
+    {
+        // A is a single sparse vector: a GrB_Vector, a GrB_Scalar, or an
+        // n-by-1 matrix.  Its two vector pointers live in the header itself,
+        // in A->p_static, so no A->p allocation is made at all (see
+        // GB_matrix.h).  The array is zeroed here, which defines the single
+        // vector as empty; for GB_Ap_malloc the caller overwrites it anyway.
+        A->magic = (Ap_option == GB_Ap_calloc) ? GB_MAGIC : GB_MAGIC2 ;
+        A->p = A->p_static ;
+        A->p [0] = 0 ;
+        A->p [1] = 0 ;
+        A->p_size = sizeof (A->p_static) ;
+        ok = true ;
+    }
     else if (Ap_option == GB_Ap_calloc)
     {
         // Sets the vector pointers to zero, which defines all vectors as empty
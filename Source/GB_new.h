@@ -83,6 +83,39 @@ void GB_hyper_hash_free         // free the A->Y hyper_hash of a matrix
     GrB_Matrix A                // matrix with content to free
 ) ;
 
+void GB_degree_free             // free the A->degree cache of a matrix
+(
+    GrB_Matrix A                // matrix with content to free
+) ;
+
+GrB_Info GB_degree_cache        // ensure the A->degree cache is computed
+(
+    GrB_Matrix A,               // matrix to query; pending work is finished
+    GB_Werk Werk
+) ;
+
+void GB_lookup_cache_free       // free the point-lookup index of a matrix
+(
+    GrB_Matrix A                // matrix with content to free
+) ;
+
+GrB_Info GB_lookup_cache_build  // build the point-lookup index of a matrix
+(
+    GrB_Matrix A,               // matrix to index; pending work is finished
+    GB_Werk Werk
+) ;
+
+void GB_fingerprint_clear       // invalidate the cached fingerprint
+(
+    GrB_Matrix A                // matrix being modified; may be NULL
+) ;
+
+GrB_Info GB_fingerprint         // compute and cache the fingerprint of A
+(
+    GrB_Matrix A,               // matrix to hash; pending work is finished
+    GB_Werk Werk
+) ;
+
 void GB_phybix_free             // free all content of a matrix
 (
     GrB_Matrix A                // matrix with content to free
@@ -25,8 +25,10 @@ GrB_Info GB_nvals           // get the number of entries in a matrix
 
     GB_RETURN_IF_NULL (nvals) ;
 
-    // leave zombies alone, and leave jumbled, but assemble any pending tuples
-    GB_MATRIX_WAIT_IF_PENDING (A) ;
+    // leave zombies alone, and leave jumbled, but assemble any pending
+    // tuples.  A deferred unary op can also be left in place: it does not
+    // change the number of entries, and the values are not read here.
+    GB_WAIT_IF (GB_PENDING (A), A, GB_STR (A)) ;
 
     //--------------------------------------------------------------------------
     // return the number of entries in the matrix
@@ -79,6 +79,20 @@
         return (C_replace ? GB_clear (C, Werk) : GrB_SUCCESS) ;          \
     }
 
+// C<M>=Z writes nothing to C if M is present, not complemented, and has no
+// entries: M(i,j)=0 for all i and j, whether the mask is valued or
+// structural.  Z need not be computed at all.  C is cleared if the replace
+// option is true, and is otherwise left unchanged.  This occurs on the last
+// iteration of many iterative methods, when the frontier used as the mask
+// becomes empty.  GB_NNZ_UPPER_BOUND is exact when it reaches zero, so M
+// need not be finished first for this test.
+#define GB_RETURN_IF_EMPTY_MASK(C, C_replace, M, Mask_comp)                 \
+    if (M != NULL && !Mask_comp && GB_NNZ_UPPER_BOUND (M) == 0)             \
+    {                                                                       \
+        /* C<empty>=Z touches no part of C */                               \
+        return (C_replace ? GB_clear (C, Werk) : GrB_SUCCESS) ;             \
+    }
+
 //------------------------------------------------------------------------------
 // GB_GET_DESCRIPTOR*: get the contents of a descriptor
 //------------------------------------------------------------------------------
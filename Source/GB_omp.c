@@ -9,9 +9,85 @@
 
 #include "GB.h"
 
+//------------------------------------------------------------------------------
+// GB_omp_cgroup_max_threads: # of CPUs granted by a Linux cgroup quota
+//------------------------------------------------------------------------------
+
+// In a container, omp_get_max_threads reports the CPUs of the host, not the
+// CPU quota of the cgroup the process runs in, so using it as-is
+// oversubscribes the quota.  Parse the cgroup v2 (cpu.max) or cgroup v1
+// (cpu.cfs_quota_us / cpu.cfs_period_us) CPU quota and return the number of
+// CPUs it grants, rounded up, or 0 if there is no quota (or not on Linux).
+// The quota can change while the process runs, so callers re-read it rather
+// than caching it; the cost is two small sysfs reads.
+
+int GB_omp_cgroup_max_threads (void)
+{
+    #if defined ( __linux__ )
+    {
+        // cgroup v2: cpu.max holds "$QUOTA $PERIOD", in microseconds, where
+        // the quota is "max" if unlimited
+        FILE *fp = fopen ("/sys/fs/cgroup/cpu.max", "r") ;
+        if (fp != NULL)
+        {
+            long long quota = -1, period = -1 ;
+            int nread = fscanf (fp, "%lld %lld", &quota, &period) ;
+            fclose (fp) ;
+            if (nread == 2 && quota > 0 && period > 0)
+            {
+                // round up: a quota of 2.5 CPUs can run 3 threads part-time
+                return ((int) ((quota + period - 1) / period)) ;
+            }
+            // "max": the v2 cgroup places no quota
+            return (0) ;
+        }
+        // cgroup v1: quota and period are in separate files; the quota is
+        // -1 if unlimited.  The cpu controller is mounted at one of two
+        // conventional paths.
+        static const char *quota_files [2] =
+        {
+            "/sys/fs/cgroup/cpu/cpu.cfs_quota_us",
+            "/sys/fs/cgroup/cpu,cpuacct/cpu.cfs_quota_us"
+        } ;
+        static const char *period_files [2] =
+        {
+            "/sys/fs/cgroup/cpu/cpu.cfs_period_us",
+            "/sys/fs/cgroup/cpu,cpuacct/cpu.cfs_period_us"
+        } ;
+        for (int k = 0 ; k < 2 ; k++)
+        {
+            fp = fopen (quota_files [k], "r") ;
+            if (fp == NULL) continue ;
+            long long quota = -1, period = -1 ;
+            int nread = fscanf (fp, "%lld", &quota) ;
+            fclose (fp) ;
+            if (nread != 1 || quota <= 0) return (0) ;
+            fp = fopen (period_files [k], "r") ;
+            if (fp == NULL) return (0) ;
+            nread = fscanf (fp, "%lld", &period) ;
+            fclose (fp) ;
+            if (nread != 1 || period <= 0) return (0) ;
+            return ((int) ((quota + period - 1) / period)) ;
+        }
+    }
+    #endif
+    // no cgroup quota found
+    return (0) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_omp_get_max_threads: default # of threads to use
+//------------------------------------------------------------------------------
+
 int GB_omp_get_max_threads (void)
 { 
-    return (GB_OPENMP_MAX_THREADS) ;
+    int nthreads_max = GB_OPENMP_MAX_THREADS ;
+    int cgroup_cpus = GB_omp_cgroup_max_threads ( ) ;
+    if (cgroup_cpus > 0)
+    {
+        nthreads_max = GB_IMIN (nthreads_max, cgroup_cpus) ;
+    }
+    return (nthreads_max) ;
 }
 
 double GB_omp_get_wtime (void)
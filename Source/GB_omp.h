@@ -11,6 +11,7 @@
 #define GB_OMP_H
 
 int GB_omp_get_max_threads (void) ;
+int GB_omp_cgroup_max_threads (void) ;
 double GB_omp_get_wtime (void) ;
 
 #endif
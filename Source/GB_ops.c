@@ -77,7 +77,8 @@ GB_TYPEDEF (GxB, FC64  , GxB_FC64_t, "GxB_FC64_t") ;
         o,                          /* default: axb */                      \
         0,                          /* default compression */               \
         0,                          /* no sort */                           \
-        0                           /* import */                            \
+        0,                          /* import */                            \
+        0                           /* no pattern reuse */                  \
     } ;                                                                     \
     GrB_Descriptor GRB (DESC_ ## name) = & GB_OPAQUE (desc_ ## name) ;
 
@@ -830,6 +831,49 @@ GB_MONOID_DEF  ( BXNOR_UINT64 , uint64_t  , 0xFFFFFFFFFFFFFFFF )
 #define GB_XTYPE    FC64
 #include "GB_semiring_template.c"
 
+//------------------------------------------------------------------------------
+// mixed-precision semiring: FP32 inputs with FP64 accumulation
+//------------------------------------------------------------------------------
+
+// GxB_TIMES_FP64_FP32 is the one built-in operator whose ztype is wider than
+// its inputs: z = (double) (x * y) for float x and y.  Paired with the
+// PLUS_FP64 monoid it forms GxB_PLUS_FP64_TIMES_FP32, which streams float
+// data at FP32 bandwidth while the products are summed in double, where the
+// rounding error of a long dot product accumulates.  The factory kernels
+// assume the canonical ztype for each (opcode, xtype) pair, so this operator
+// is always computed by the JIT or generic kernels (see GB_binop_builtin).
+
+void GB_func_TIMES_FP64_FP32 (double *z, const float *x, const float *y) ;
+void GB_func_TIMES_FP64_FP32 (double *z, const float *x, const float *y)
+{
+    // the product is computed in float, matching the JIT kernels; the
+    // accuracy gain of this semiring comes from the double accumulator
+    (*z) = (double) ((*x) * (*y)) ;
+}
+
+struct GB_BinaryOp_opaque GB_OPAQUE (TIMES_FP64_FP32) =
+{
+    GB_MAGIC, 0,                // magic and header_size
+    & GB_OPAQUE (FP64),         // ztype
+    & GB_OPAQUE (FP32),         // xtype
+    & GB_OPAQUE (FP32),         // ytype
+    NULL, NULL, (GxB_binary_function) (& GB_func_TIMES_FP64_FP32),
+    "times", 0,                 // name and name_len
+    GB_TIMES_binop_code,        // opcode
+    NULL, 0, 0                  // defn, alloc, hash
+} ;
+GrB_BinaryOp GxB_TIMES_FP64_FP32 = & GB_OPAQUE (TIMES_FP64_FP32) ;
+
+struct GB_Semiring_opaque GB_OPAQUE (PLUS_FP64_TIMES_FP32) =
+{
+    GB_MAGIC, 0,                // magic and header_size
+    & GB_OPAQUE (PLUS_FP64_MONOID),
+    & GB_OPAQUE (TIMES_FP64_FP32),
+    NULL, 0, 0, 0               // name, name_len, name_size, hash
+} ;
+GrB_Semiring GxB_PLUS_FP64_TIMES_FP32 =
+    & GB_OPAQUE (PLUS_FP64_TIMES_FP32) ;
+
 //------------------------------------------------------------------------------
 // 124 predefined built-in semirings in the v1.3 C API
 //------------------------------------------------------------------------------
@@ -1007,6 +1051,20 @@ struct GB_Context_opaque GB_OPAQUE (CONTEXT_WORLD) =
     (double) GB_CHUNK_DEFAULT,      // chunk
     1,                              // nthreads_max
     -1,                             // gpu_id
+    0,                              // numa: no first-touch placement
+    0,                              // concurrency: work-queue mode off
+    { 0 },                          // slot_time: all parallel slots free
+    false,                          // cancelled: no cancellation pending
+    0,                              // stream_threshold: no streaming stores
+    false,                          // burble: snapshots are unused for the
+    GB_HYPER_SWITCH_DEFAULT,        // hyper_switch: world Context (it is
+                                    // never engaged; see GB_Context_engage)
+    NULL,                           // arena: the world Context is shared
+    0,                              // arena_size: amongst all user threads,
+    0,                              // arena_top: so it never has an arena
+    NULL,                           // alloc_func: nor its own allocator
+    NULL,                           // dealloc_func
+    NULL,                           // allocator_state
 } ;
 
 GxB_Context GxB_CONTEXT_WORLD = & GB_OPAQUE (CONTEXT_WORLD) ;
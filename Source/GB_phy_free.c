@@ -32,8 +32,8 @@ void GB_phy_free                // free A->p, A->h, and A->Y of a matrix
     // free A->p, A->h, and A->Y
     //--------------------------------------------------------------------------
 
-    // free A->p unless it is shallow
-    if (!A->p_shallow)
+    // free A->p unless it is shallow or resident in the header itself
+    if (!A->p_shallow && A->p != A->p_static)
     { 
         GB_FREE (&(A->p), A->p_size) ;
     }
@@ -56,6 +56,9 @@ void GB_phy_free                // free A->p, A->h, and A->Y of a matrix
     A->nvec_nonempty = 0 ;
 
     GB_hyper_hash_free (A) ;
+    GB_degree_free (A) ;
+    GB_lookup_cache_free (A) ;
+    GB_fingerprint_clear (A) ;
 
     //--------------------------------------------------------------------------
     // set the status to invalid
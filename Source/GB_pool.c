@@ -0,0 +1,192 @@
+//------------------------------------------------------------------------------
+// GB_pool.c: free pool of small memory blocks
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A free pool of small blocks, to reduce the malloc/free traffic of workloads
+// that create and free many small matrices and vectors.  Such workloads spend
+// much of their time allocating and freeing the GB_Matrix_opaque header and
+// the small A->p array of each intermediate vector.
+
+// Blocks of power-of-two sizes (2^GB_POOL_LOG2_MIN to 2^GB_POOL_LOG2_MAX
+// bytes) are kept in singly-linked free lists, one list per size class, with
+// the link stored in the first 8 bytes of each free block.  The lists are
+// sharded: each shard holds its own set of free lists, protected by its own
+// test-and-set lock, and a thread uses the shard indexed by its OpenMP thread
+// id.  Threads thus normally revisit their own shard, so the lock is held
+// briefly and almost never contended.
+
+// The pool is bypassed entirely when malloc tracking is enabled (for memory
+// usage tests, which count each malloc and free).  Pooled blocks keep their
+// entry in the debug memtable, since they are still allocated from the heap;
+// the entry is removed when GB_pool_finalize frees them.
+
+#include "GB.h"
+
+//------------------------------------------------------------------------------
+// the global free pool
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    int8_t lock ;                       // test-and-set shard lock
+    int32_t nblocks [GB_POOL_NCLASSES] ;    // # of blocks in each free list
+    void *head [GB_POOL_NCLASSES] ;     // head of each free list
+}
+GB_pool_shard ;
+
+static GB_pool_shard GB_pool [GB_POOL_NSHARDS] ;
+
+//------------------------------------------------------------------------------
+// GB_pool_lock and GB_pool_unlock: lock/unlock a shard
+//------------------------------------------------------------------------------
+
+static inline void GB_pool_lock (GB_pool_shard *shard)
+{
+    int8_t held = 1 ;
+    do
+    {
+        GB_ATOMIC_CAPTURE_INT8 (held, shard->lock, 1) ;
+    }
+    while (held) ;
+}
+
+static inline void GB_pool_unlock (GB_pool_shard *shard)
+{
+    GB_ATOMIC_WRITE
+    shard->lock = 0 ;
+}
+
+//------------------------------------------------------------------------------
+// GB_pool_shard_and_class: find the shard of this thread, and the size class
+//------------------------------------------------------------------------------
+
+static inline GB_pool_shard *GB_pool_shard_and_class
+(
+    int *class_id,          // size class of the block
+    size_t size             // exact size of the block; must be a size class
+)
+{
+    ASSERT (size >= (((size_t) 1) << GB_POOL_LOG2_MIN)) ;
+    ASSERT (size <= GB_POOL_MAX_SIZE) ;
+    ASSERT ((size & (size-1)) == 0) ;       // size is a power of 2
+    int k = GB_POOL_LOG2_MIN ;
+    while ((((size_t) 1) << k) < size)
+    {
+        k++ ;
+    }
+    (*class_id) = k - GB_POOL_LOG2_MIN ;
+    return (&(GB_pool [GB_OPENMP_GET_THREAD_ID & (GB_POOL_NSHARDS-1)])) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_pool_poolable: query if a block of a given size can be pooled
+//------------------------------------------------------------------------------
+
+bool GB_pool_poolable       // true if a block of this size can be pooled
+(
+    size_t *size            // on input: # of bytes requested; on output,
+                            // rounded up to the next size class
+)
+{
+    if ((*size) > GB_POOL_MAX_SIZE || GB_Global_malloc_tracking_get ( ))
+    {
+        // too large to pool, or memory usage tracking is enabled
+        return (false) ;
+    }
+    // round the size up to the next power of 2
+    size_t s = (((size_t) 1) << GB_POOL_LOG2_MIN) ;
+    while (s < (*size))
+    {
+        s <<= 1 ;
+    }
+    (*size) = s ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_pool_get: get a block from the free pool
+//------------------------------------------------------------------------------
+
+void *GB_pool_get           // return a pooled block, or NULL if none
+(
+    size_t size             // exact size of the block; must be a size class
+)
+{
+    int class_id ;
+    GB_pool_shard *shard = GB_pool_shard_and_class (&class_id, size) ;
+    void *p = NULL ;
+    GB_pool_lock (shard) ;
+    p = shard->head [class_id] ;
+    if (p != NULL)
+    {
+        // remove the block at the head of the free list
+        shard->head [class_id] = (*((void **) p)) ;
+        shard->nblocks [class_id]-- ;
+    }
+    GB_pool_unlock (shard) ;
+    return (p) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_pool_put: return a block to the free pool
+//------------------------------------------------------------------------------
+
+bool GB_pool_put            // true if the block is kept in the pool
+(
+    void *p,                // block to return to the pool
+    size_t size             // exact size of the block, as allocated
+)
+{
+    if (size < (((size_t) 1) << GB_POOL_LOG2_MIN) || size > GB_POOL_MAX_SIZE
+        || (size & (size-1)) != 0 || GB_Global_malloc_tracking_get ( ))
+    {
+        // not a size class (the block did not come from the pool path),
+        // or memory usage tracking is enabled
+        return (false) ;
+    }
+    int class_id ;
+    GB_pool_shard *shard = GB_pool_shard_and_class (&class_id, size) ;
+    bool pooled = false ;
+    GB_pool_lock (shard) ;
+    if (shard->nblocks [class_id] < GB_POOL_MAX_BLOCKS)
+    {
+        // place the block at the head of the free list
+        (*((void **) p)) = shard->head [class_id] ;
+        shard->head [class_id] = p ;
+        shard->nblocks [class_id]++ ;
+        pooled = true ;
+    }
+    GB_pool_unlock (shard) ;
+    return (pooled) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_pool_finalize: free all pooled blocks
+//------------------------------------------------------------------------------
+
+// Called by GrB_finalize, which only a single user thread may call.
+
+void GB_pool_finalize (void)
+{
+    for (int s = 0 ; s < GB_POOL_NSHARDS ; s++)
+    {
+        GB_pool_shard *shard = &(GB_pool [s]) ;
+        for (int class_id = 0 ; class_id < GB_POOL_NCLASSES ; class_id++)
+        {
+            void *p = shard->head [class_id] ;
+            while (p != NULL)
+            {
+                void *pnext = (*((void **) p)) ;
+                GB_Global_free_function (p) ;
+                p = pnext ;
+            }
+            shard->head [class_id] = NULL ;
+            shard->nblocks [class_id] = 0 ;
+        }
+    }
+}
@@ -0,0 +1,46 @@
+//------------------------------------------------------------------------------
+// GB_pool.h: definitions for the free pool of small memory blocks
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#ifndef GB_POOL_H
+#define GB_POOL_H
+
+// smallest and largest pooled block: 2^GB_POOL_LOG2_MIN to 2^GB_POOL_LOG2_MAX
+// bytes.  The largest class must cover the GB_Matrix_opaque header and the
+// A->p array of a typical small intermediate vector.
+#define GB_POOL_LOG2_MIN 3
+#define GB_POOL_LOG2_MAX 13
+#define GB_POOL_NCLASSES (GB_POOL_LOG2_MAX - GB_POOL_LOG2_MIN + 1)
+#define GB_POOL_MAX_SIZE (((size_t) 1) << GB_POOL_LOG2_MAX)
+
+// # of lock shards; must be a power of 2
+#define GB_POOL_NSHARDS 16
+
+// max # of blocks held per size class, per shard
+#define GB_POOL_MAX_BLOCKS 16
+
+void *GB_pool_get           // return a pooled block, or NULL if none
+(
+    size_t size             // exact size of the block; must be a size class
+) ;
+
+bool GB_pool_put            // true if the block is kept in the pool
+(
+    void *p,                // block to return to the pool
+    size_t size             // exact size of the block, as allocated
+) ;
+
+bool GB_pool_poolable       // true if a block of this size can be pooled
+(
+    size_t *size            // on input: # of bytes requested; on output,
+                            // rounded up to the next size class
+) ;
+
+void GB_pool_finalize (void) ;  // free all pooled blocks, for GrB_finalize
+
+#endif
@@ -172,12 +172,14 @@ void GB_assign_describe
 #define GB_NVTX
 #endif
 
-// define the function to use to burble
+// define the function to use to burble.  The burble flag is read through the
+// engaged Context when there is one (a thread-private snapshot; see
+// GB_Context_burble), and through the global setting otherwise.
 #undef  GBURBLE
 #define GBURBLE(...)                                \
 {                                                   \
     GB_NVTX                                         \
-    if (GB_Global_burble_get ( ))                   \
+    if (GB_Context_burble ( ))                      \
     {                                               \
         GBDUMP (__VA_ARGS__) ;                      \
     }                                               \
@@ -211,7 +213,7 @@ void GB_assign_describe
     double t_burble = 0 ;                               \
     {                                                   \
         GB_NVTX                                         \
-        if (GB_Global_burble_get ( ))                   \
+        if (GB_Context_burble ( ))                      \
         {                                               \
             GBURBLE (" [ " func " ") ;                  \
             t_burble = GB_OPENMP_GET_WTIME ;            \
@@ -221,7 +223,7 @@ void GB_assign_describe
     #define GB_BURBLE_END                               \
     {                                                   \
         GB_NVTX                                         \
-        if (GB_Global_burble_get ( ))                   \
+        if (GB_Context_burble ( ))                      \
         {                                               \
             t_burble = GB_OPENMP_GET_WTIME - t_burble ; \
             GBURBLE ("\n   %.3g sec ]\n", t_burble) ;   \
@@ -0,0 +1,409 @@
+//------------------------------------------------------------------------------
+// GB_prof.c: structured operation profiler
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Profile records are appended to a fixed-size ring buffer, overwriting the
+// oldest records when it is full, and drained (FIFO) by GxB_Profile_get.
+// The ring is guarded by a critical section; one record is captured per
+// profiled kernel call, so the cost is negligible relative to the kernel.
+
+// the syscall wrapper in <unistd.h> requires _GNU_SOURCE, and it must be
+// defined before any system header is included
+#if defined ( __linux__ ) && !defined ( GBNPERF ) && !defined ( _GNU_SOURCE )
+#define _GNU_SOURCE 1
+#endif
+
+#include "GB.h"
+
+//------------------------------------------------------------------------------
+// optional hardware performance counters (Linux perf_event)
+//------------------------------------------------------------------------------
+
+// On Linux, each profiled kernel call also counts hardware cache references
+// and cache misses, via perf_event, so bandwidth-bound regressions can be
+// told apart from latency-bound ones.  The counters are opened lazily, once
+// per user thread, and count events on the calling thread only (which
+// participates in the parallel region, so its counts are representative).
+// If perf_event is unavailable (non-Linux, a kernel without perf support, or
+// insufficient permissions via perf_event_paranoid), the counts are reported
+// as zero and profiling is otherwise unaffected.  Compile with -DGBNPERF to
+// disable the counters entirely.
+
+#if defined ( __linux__ ) && !defined ( GBNPERF )
+#define GB_PROF_PERF 1
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#ifdef GB_PROF_PERF
+
+    // per-thread perf_event state: [0] is the cache-references event, [1] is
+    // the cache-misses event, and [2] is the status (0: not yet opened,
+    // 1: open, -1: unavailable); same thread-local mechanism as GB_Context.c
+
+    #if defined ( _OPENMP )
+
+        // OpenMP threadprivate is preferred
+        static int GB_prof_perf [3] = { -1, -1, 0 } ;
+        #pragma omp threadprivate (GB_prof_perf)
+
+    #elif defined ( HAVE_KEYWORD__THREAD )
+
+        // gcc and many other compilers support the __thread keyword
+        static __thread int GB_prof_perf [3] = { -1, -1, 0 } ;
+
+    #elif defined ( HAVE_KEYWORD__THREAD_LOCAL )
+
+        // ANSI C11 threads
+        #include <threads.h>
+        static _Thread_local int GB_prof_perf [3] = { -1, -1, 0 } ;
+
+    #else
+
+        // without thread-local storage, the counters are disabled
+        #undef GB_PROF_PERF
+
+    #endif
+
+#endif
+
+#ifdef GB_PROF_PERF
+
+//------------------------------------------------------------------------------
+// GB_prof_perf_open: open one hardware event for the calling thread
+//------------------------------------------------------------------------------
+
+static int GB_prof_perf_open (uint64_t config)
+{
+    struct perf_event_attr pe ;
+    memset (&pe, 0, sizeof (pe)) ;
+    pe.type = PERF_TYPE_HARDWARE ;
+    pe.size = sizeof (pe) ;
+    pe.config = config ;
+    pe.disabled = 1 ;
+    pe.exclude_kernel = 1 ;
+    pe.exclude_hv = 1 ;
+    return ((int) syscall (SYS_perf_event_open, &pe, 0, -1, -1, 0)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_prof_perf_begin: reset and enable the counters for one kernel call
+//------------------------------------------------------------------------------
+
+static void GB_prof_perf_begin (void)
+{
+    if (GB_prof_perf [2] == 0)
+    {
+        // first profiled call on this user thread: open the two events
+        GB_prof_perf [0] = GB_prof_perf_open (PERF_COUNT_HW_CACHE_REFERENCES) ;
+        GB_prof_perf [1] = GB_prof_perf_open (PERF_COUNT_HW_CACHE_MISSES) ;
+        if (GB_prof_perf [0] < 0 || GB_prof_perf [1] < 0)
+        {
+            // perf_event is unavailable; do not try again on this thread
+            if (GB_prof_perf [0] >= 0) close (GB_prof_perf [0]) ;
+            if (GB_prof_perf [1] >= 0) close (GB_prof_perf [1]) ;
+            GB_prof_perf [0] = -1 ;
+            GB_prof_perf [1] = -1 ;
+            GB_prof_perf [2] = -1 ;
+        }
+        else
+        {
+            GB_prof_perf [2] = 1 ;
+        }
+    }
+    if (GB_prof_perf [2] == 1)
+    {
+        for (int k = 0 ; k <= 1 ; k++)
+        {
+            ioctl (GB_prof_perf [k], PERF_EVENT_IOC_RESET, 0) ;
+            ioctl (GB_prof_perf [k], PERF_EVENT_IOC_ENABLE, 0) ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_prof_perf_finish: disable and read the counters for one kernel call
+//------------------------------------------------------------------------------
+
+static void GB_prof_perf_finish (int64_t *cache_refs, int64_t *cache_misses)
+{
+    (*cache_refs) = 0 ;
+    (*cache_misses) = 0 ;
+    if (GB_prof_perf [2] == 1)
+    {
+        int64_t counts [2] = { 0, 0 } ;
+        for (int k = 0 ; k <= 1 ; k++)
+        {
+            ioctl (GB_prof_perf [k], PERF_EVENT_IOC_DISABLE, 0) ;
+            if (read (GB_prof_perf [k], &(counts [k]), sizeof (int64_t))
+                != sizeof (int64_t))
+            {
+                counts [k] = 0 ;
+            }
+        }
+        (*cache_refs) = counts [0] ;
+        (*cache_misses) = counts [1] ;
+    }
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// per-thread live workspace counters
+//------------------------------------------------------------------------------
+
+// Each allocation and free adjusts a thread-local count of live bytes (via
+// GB_prof_memory, called by the memory wrappers when profiling is enabled),
+// and GB_prof_start/GB_prof_end bracket it into a per-call high-water mark,
+// so a profile record reports the peak workspace its call held, not just the
+// total it allocated.  Attribution is by allocating thread: kernels allocate
+// their workspace from the calling user thread before entering their parallel
+// regions, so the per-call peak is captured where it matters.  Blocks freed
+// on a different thread than the one that allocated them only make the live
+// count of each thread conservative; the high-water mark never decreases
+// within a call.  Without thread-local storage the peak is reported as zero.
+
+#if defined ( _OPENMP )
+
+    // OpenMP threadprivate is preferred
+    static int64_t GB_prof_mem [2] = { 0, 0 } ; // [0]: live bytes, [1]: peak
+    #pragma omp threadprivate (GB_prof_mem)
+    #define GB_PROF_MEM 1
+
+#elif defined ( HAVE_KEYWORD__THREAD )
+
+    // gcc and many other compilers support the __thread keyword
+    static __thread int64_t GB_prof_mem [2] = { 0, 0 } ;
+    #define GB_PROF_MEM 1
+
+#elif defined ( HAVE_KEYWORD__THREAD_LOCAL )
+
+    // ANSI C11 threads
+    #include <threads.h>
+    static _Thread_local int64_t GB_prof_mem [2] = { 0, 0 } ;
+    #define GB_PROF_MEM 1
+
+#else
+
+    // without thread-local storage, the live workspace is not tracked
+
+#endif
+
+//------------------------------------------------------------------------------
+// GB_prof_memory: adjust the live workspace count of this thread
+//------------------------------------------------------------------------------
+
+void GB_prof_memory     // adjust the live workspace count of this thread
+(
+    int64_t delta       // +size for an allocation, -size for a free
+)
+{
+    #ifdef GB_PROF_MEM
+    GB_prof_mem [0] += delta ;
+    if (delta > 0 && GB_prof_mem [0] > GB_prof_mem [1])
+    {
+        GB_prof_mem [1] = GB_prof_mem [0] ;
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// the profile ring buffer
+//------------------------------------------------------------------------------
+
+static GxB_Profile GB_prof_ring [GB_PROF_MAX] ;
+static int64_t GB_prof_head = 0 ;       // oldest record in the ring
+static int64_t GB_prof_count = 0 ;      // # of records in the ring
+
+//------------------------------------------------------------------------------
+// GB_prof_start: start profiling one kernel call
+//------------------------------------------------------------------------------
+
+void GB_prof_start      // start profiling one kernel call
+(
+    GB_prof_info *prof
+)
+{
+    // in work-queue mode, try to claim a parallel slot for this kernel call
+    // (a no-op otherwise); the slot is released by GB_prof_end
+    GB_Context_slot_acquire ( ) ;
+
+    bool profiling = GB_Global_profiling_get ( ) ;
+    if (!profiling && !GB_Global_chunk_autotune_get ( ))
+    {
+        // profiling and auto-tuning are both disabled; GB_prof_phase and
+        // GB_prof_end will do nothing for this call
+        prof->tstart = 0 ;
+        return ;
+    }
+    prof->tphase = 0 ;
+    prof->bytes_start = GB_Global_profile_bytes_get ( ) ;
+    #ifdef GB_PROF_MEM
+    // bracket the live workspace of this thread for a per-call peak; the
+    // high-water mark of the enclosing call, if any, is restored by
+    // GB_prof_end
+    prof->live_start = GB_prof_mem [0] ;
+    prof->peak_save = GB_prof_mem [1] ;
+    GB_prof_mem [1] = GB_prof_mem [0] ;
+    #endif
+    #ifdef GB_PROF_PERF
+    if (profiling)
+    {
+        GB_prof_perf_begin ( ) ;
+    }
+    #endif
+    prof->tstart = GB_Global_get_wtime ( ) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_prof_phase: mark the end of the symbolic phase
+//------------------------------------------------------------------------------
+
+void GB_prof_phase      // mark the end of the symbolic phase
+(
+    GB_prof_info *prof
+)
+{
+    if (prof->tstart != 0)
+    {
+        prof->tphase = GB_Global_get_wtime ( ) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_prof_end: capture the record for one kernel call
+//------------------------------------------------------------------------------
+
+void GB_prof_end        // capture the record for one kernel call
+(
+    GB_prof_info *prof,
+    const char *method,     // kernel and method name (e.g. "saxpy3")
+    GrB_Matrix C,           // output of the call, or NULL if none
+    int64_t ntasks,         // # of tasks used by the kernel, or 0 if the
+                            // method does not use the task model
+    int nthreads            // # of threads used by the kernel
+)
+{
+    // release the parallel slot claimed by GB_prof_start, if any
+    GB_Context_slot_release ( ) ;
+
+    if (prof->tstart == 0)
+    {
+        // profiling was disabled when this call started
+        return ;
+    }
+
+    double tend = GB_Global_get_wtime ( ) ;
+
+    // peak live workspace held by this thread during the call; then restore
+    // the high-water mark of the enclosing call, if any
+    int64_t peak_bytes = 0 ;
+    #ifdef GB_PROF_MEM
+    peak_bytes = GB_IMAX (GB_prof_mem [1] - prof->live_start, 0) ;
+    GB_prof_mem [1] = GB_IMAX (GB_prof_mem [1], prof->peak_save) ;
+    #endif
+
+    // feed the total run time of the call to the chunk auto-tuner
+    GB_autotune_feedback (method, tend - prof->tstart, nthreads) ;
+
+    if (!GB_Global_profiling_get ( ))
+    {
+        // the call was timed for the auto-tuner only; no record is captured
+        return ;
+    }
+
+    GxB_Profile record ;
+    memset (&record, 0, sizeof (GxB_Profile)) ;
+    #ifdef GB_PROF_PERF
+    GB_prof_perf_finish (&(record.cache_refs), &(record.cache_misses)) ;
+    #endif
+    strncpy (record.method, method, GxB_PROFILE_METHOD_LEN - 1) ;
+    if (prof->tphase != 0)
+    {
+        // the kernel has distinct symbolic and numeric phases
+        record.symbolic_time = prof->tphase - prof->tstart ;
+        record.numeric_time = tend - prof->tphase ;
+    }
+    else
+    {
+        // the whole call is a single numeric phase
+        record.symbolic_time = 0 ;
+        record.numeric_time = tend - prof->tstart ;
+    }
+    record.ntasks = ntasks ;
+    record.nthreads = nthreads ;
+    if (C != NULL)
+    {
+        // the shape of the output describes the problem size of the call
+        record.nrows = GB_NROWS (C) ;
+        record.ncols = GB_NCOLS (C) ;
+        record.nvals = GB_nnz (C) ;
+    }
+    record.bytes_allocated =
+        GB_Global_profile_bytes_get ( ) - prof->bytes_start ;
+    record.peak_bytes = peak_bytes ;
+
+    #pragma omp critical(GB_prof)
+    {
+        int64_t tail = (GB_prof_head + GB_prof_count) % GB_PROF_MAX ;
+        GB_prof_ring [tail] = record ;
+        if (GB_prof_count < GB_PROF_MAX)
+        {
+            GB_prof_count++ ;
+        }
+        else
+        {
+            // the ring is full; the oldest record is overwritten
+            GB_prof_head = (GB_prof_head + 1) % GB_PROF_MAX ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_prof_drain: remove up to maxrecords records from the ring (FIFO)
+//------------------------------------------------------------------------------
+
+// Used by GxB_Profile_get.
+
+int64_t GB_prof_drain   // # of records returned
+(
+    GxB_Profile *records,   // array of size maxrecords
+    int64_t maxrecords
+)
+{
+    int64_t n = 0 ;
+    #pragma omp critical(GB_prof)
+    {
+        n = GB_IMIN (maxrecords, GB_prof_count) ;
+        for (int64_t k = 0 ; k < n ; k++)
+        {
+            records [k] = GB_prof_ring [(GB_prof_head + k) % GB_PROF_MAX] ;
+        }
+        GB_prof_head = (GB_prof_head + n) % GB_PROF_MAX ;
+        GB_prof_count -= n ;
+    }
+    return (n) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_prof_finalize: discard all profile records
+//------------------------------------------------------------------------------
+
+// Called by GrB_finalize.
+
+void GB_prof_finalize (void)
+{
+    #pragma omp critical(GB_prof)
+    {
+        GB_prof_head = 0 ;
+        GB_prof_count = 0 ;
+    }
+}
+
@@ -0,0 +1,69 @@
+//------------------------------------------------------------------------------
+// GB_prof.h: definitions for the structured operation profiler
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The profiler captures one GxB_Profile record per profiled kernel call into
+// a fixed-size ring buffer, retrievable via GxB_Profile_get.  Unlike the
+// burble, records are structured and cheap to capture, so profiling can stay
+// enabled in production (see GxB_PROFILING).  A kernel is instrumented with
+// three calls: GB_prof_start at entry, GB_prof_phase at the boundary between
+// its symbolic (analysis) and numeric phases, and GB_prof_end on completion.
+// All three are no-ops when profiling is disabled.
+
+#ifndef GB_PROF_H
+#define GB_PROF_H
+
+// # of records held in the ring buffer; the oldest are overwritten
+#define GB_PROF_MAX 1024
+
+typedef struct
+{
+    double tstart ;         // time at GB_prof_start, or 0 if not profiling
+    double tphase ;         // time at GB_prof_phase, or 0 if no such phase
+    int64_t bytes_start ;   // cumulative bytes allocated at GB_prof_start
+    int64_t live_start ;    // live bytes on this thread at GB_prof_start
+    int64_t peak_save ;     // high-water mark of the enclosing call, if any,
+                            // restored by GB_prof_end
+}
+GB_prof_info ;
+
+void GB_prof_start      // start profiling one kernel call
+(
+    GB_prof_info *prof
+) ;
+
+void GB_prof_phase      // mark the end of the symbolic phase
+(
+    GB_prof_info *prof
+) ;
+
+void GB_prof_end        // capture the record for one kernel call
+(
+    GB_prof_info *prof,
+    const char *method,     // kernel and method name (e.g. "saxpy3")
+    GrB_Matrix C,           // output of the call, or NULL if none
+    int64_t ntasks,         // # of tasks used by the kernel, or 0 if the
+                            // method does not use the task model
+    int nthreads            // # of threads used by the kernel
+) ;
+
+void GB_prof_memory     // adjust the live workspace count of this thread
+(
+    int64_t delta       // +size for an allocation, -size for a free
+) ;
+
+int64_t GB_prof_drain   // # of records returned
+(
+    GxB_Profile *records,   // array of size maxrecords
+    int64_t maxrecords
+) ;
+
+void GB_prof_finalize (void) ;      // discard all profile records
+
+#endif
+
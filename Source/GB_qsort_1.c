@@ -42,6 +42,6 @@
 GB_CALLBACK_QSORT_1_PROTO (GB_qsort_1)
 { 
     uint64_t seed = n ;
-    GB_quicksort (GB_arg (A), n, &seed) ;
+    GB_quicksort (GB_arg (A), n, GB_qsort_depth (n), &seed) ;
 }
 
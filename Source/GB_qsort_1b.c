@@ -57,7 +57,7 @@ void GB_qsort_1b    // sort array A of size 2-by-n, using 1 key (A [0][])
 )
 { 
     uint64_t seed = n ;
-    GB_quicksort (GB_arg (A), n, &seed) ;
+    GB_quicksort (GB_arg (A), n, GB_qsort_depth (n), &seed) ;
 }
 
 //------------------------------------------------------------------------------
@@ -107,7 +107,7 @@ void GB_qsort_1b_size1  // GB_qsort_1b with A_1 with sizeof = 1
 )
 { 
     uint64_t seed = n ;
-    GB_quicksort (GB_arg (A), n, &seed) ;
+    GB_quicksort (GB_arg (A), n, GB_qsort_depth (n), &seed) ;
 }
 
 //------------------------------------------------------------------------------
@@ -133,7 +133,7 @@ void GB_qsort_1b_size2  // GB_qsort_1b with A_1 with sizeof = 2
 )
 { 
     uint64_t seed = n ;
-    GB_quicksort (GB_arg (A), n, &seed) ;
+    GB_quicksort (GB_arg (A), n, GB_qsort_depth (n), &seed) ;
 }
 
 //------------------------------------------------------------------------------
@@ -160,7 +160,7 @@ void GB_qsort_1b_size4  // GB_qsort_1b with A_1 with sizeof = 4
 )
 { 
     uint64_t seed = n ;
-    GB_quicksort (GB_arg (A), n, &seed) ;
+    GB_quicksort (GB_arg (A), n, GB_qsort_depth (n), &seed) ;
 }
 
 //------------------------------------------------------------------------------
@@ -187,7 +187,7 @@ void GB_qsort_1b_size8  // GB_qsort_1b with A_1 with sizeof = 8
 )
 { 
     uint64_t seed = n ;
-    GB_quicksort (GB_arg (A), n, &seed) ;
+    GB_quicksort (GB_arg (A), n, GB_qsort_depth (n), &seed) ;
 }
 
 //------------------------------------------------------------------------------
@@ -213,6 +213,6 @@ void GB_qsort_1b_size16 // GB_qsort_1b with A_1 with sizeof = 16
 )
 { 
     uint64_t seed = n ;
-    GB_quicksort (GB_arg (A), n, &seed) ;
+    GB_quicksort (GB_arg (A), n, GB_qsort_depth (n), &seed) ;
 }
 
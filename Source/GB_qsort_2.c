@@ -49,6 +49,6 @@ void GB_qsort_2     // sort array A of size 2-by-n, using 2 keys (A [0:1][])
 )
 { 
     uint64_t seed = n ;
-    GB_quicksort (GB_arg (A), n, &seed) ;
+    GB_quicksort (GB_arg (A), n, GB_qsort_depth (n), &seed) ;
 }
 
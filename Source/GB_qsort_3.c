@@ -52,6 +52,6 @@ void GB_qsort_3     // sort array A of size 3-by-n, using 3 keys (A [0:2][])
 )
 { 
     uint64_t seed = n ;
-    GB_quicksort (GB_arg (A), n, &seed) ;
+    GB_quicksort (GB_arg (A), n, GB_qsort_depth (n), &seed) ;
 }
 
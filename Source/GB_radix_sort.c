@@ -0,0 +1,248 @@
+//------------------------------------------------------------------------------
+// GB_radix_sort: stable parallel LSD radix sort of 1-, 2-, or 3-by-n lists
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// A parallel least-significant-digit radix sort, as an alternative to the
+// comparison-based GB_msort_* mergesorts for the tuple sort in GB_builder.
+// The keys are matrix indices, so their range is known (the matrix
+// dimensions), and the sort runs in O(n) time: one histogram pass and one
+// scatter pass per 8-bit digit of the key range, rather than the O(n log n)
+// comparisons of a mergesort.  Each pass is a stable counting sort, so ties
+// retain their input order; with K_work as the payload this gives the same
+// result as the stable mergesort of (key, K_work) tuples, since K_work is
+// strictly ascending on input.
+
+// A_0 is the primary key.  A_1 is the secondary key if A_1_is_key is true
+// (sorting in ascending order of (A_0, A_1)), or a payload permuted alongside
+// the keys if false.  A_2, if present, is always a payload.  The exclusive
+// upper bounds hi_0 and hi_1 determine how many digit passes each key needs;
+// digits beyond the key range are skipped.  The workspace is one scratch copy
+// of each array plus a histogram per thread, about the same total as the
+// GB_msort_* workspace.
+
+#include "GB_sort.h"
+
+#define GB_RADIX_BITS     8
+#define GB_RADIX_BUCKETS  256
+
+#define GB_FREE_WORKSPACE                       \
+{                                               \
+    GB_FREE_WORK (&W_0, W_0_size) ;             \
+    GB_FREE_WORK (&W_1, W_1_size) ;             \
+    GB_FREE_WORK (&W_2, W_2_size) ;             \
+    GB_FREE_WORK (&Counts, Counts_size) ;       \
+}
+
+//------------------------------------------------------------------------------
+// GB_radix_sort_passes: # of 8-bit digit passes for keys in [0, hi)
+//------------------------------------------------------------------------------
+
+static inline int GB_radix_sort_passes (int64_t hi)
+{
+    int npasses = 0 ;
+    uint64_t h = (hi <= 1) ? 0 : ((uint64_t) (hi - 1)) ;
+    while (h > 0)
+    {
+        npasses++ ;
+        h = h >> GB_RADIX_BITS ;
+    }
+    return (npasses) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_radix_sort
+//------------------------------------------------------------------------------
+
+GrB_Info GB_radix_sort  // stable LSD radix sort of a 1-, 2-, or 3-by-n list
+(
+    int64_t *restrict A_0,      // size n array: primary key
+    int64_t *restrict A_1,      // size n array: 2nd key or payload, or NULL
+    int64_t *restrict A_2,      // size n array: payload, or NULL
+    const bool A_1_is_key,      // if true A_1 is a key, else a payload
+    const int64_t n,
+    const int64_t hi_0,         // exclusive upper bound on the A_0 keys
+    const int64_t hi_1,         // exclusive upper bound on the A_1 keys,
+                                // ignored if A_1 is NULL or a payload
+    int nthreads                // # of threads to use
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs and handle small lists with a single-threaded quicksort
+    //--------------------------------------------------------------------------
+
+    ASSERT (A_0 != NULL) ;
+    ASSERT (GB_IMPLIES (A_2 != NULL, A_1 != NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    int64_t *restrict W_0 = NULL ; size_t W_0_size = 0 ;
+    int64_t *restrict W_1 = NULL ; size_t W_1_size = 0 ;
+    int64_t *restrict W_2 = NULL ; size_t W_2_size = 0 ;
+    int64_t *restrict Counts = NULL ; size_t Counts_size = 0 ;
+
+    nthreads = GB_IMAX (nthreads, 1) ;
+    W_0 = GB_MALLOC_WORK (n, int64_t, &W_0_size) ;
+    if (A_1 != NULL)
+    {
+        W_1 = GB_MALLOC_WORK (n, int64_t, &W_1_size) ;
+    }
+    if (A_2 != NULL)
+    {
+        W_2 = GB_MALLOC_WORK (n, int64_t, &W_2_size) ;
+    }
+    Counts = GB_MALLOC_WORK (nthreads * GB_RADIX_BUCKETS, int64_t,
+        &Counts_size) ;
+    if (W_0 == NULL || (A_1 != NULL && W_1 == NULL)
+        || (A_2 != NULL && W_2 == NULL) || Counts == NULL)
+    {
+        // out of memory
+        GB_FREE_WORKSPACE ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the digit passes: least-significant key first
+    //--------------------------------------------------------------------------
+
+    // Src [0:2] and Dst [0:2] are the current source and destination of the
+    // tuples; they swap after each scatter pass.
+
+    int64_t *restrict Src [3] ; Src [0] = A_0 ; Src [1] = A_1 ; Src [2] = A_2 ;
+    int64_t *restrict Dst [3] ; Dst [0] = W_0 ; Dst [1] = W_1 ; Dst [2] = W_2 ;
+    int narrays = (A_2 != NULL) ? 3 : ((A_1 != NULL) ? 2 : 1) ;
+
+    int npasses_0 = GB_radix_sort_passes (hi_0) ;
+    int npasses_1 = (A_1_is_key && A_1 != NULL) ?
+        GB_radix_sort_passes (hi_1) : 0 ;
+
+    for (int pass = 0 ; pass < npasses_1 + npasses_0 ; pass++)
+    {
+
+        //----------------------------------------------------------------------
+        // get the key array and digit for this pass
+        //----------------------------------------------------------------------
+
+        // all passes of the secondary key come first, so the final order is
+        // ascending in the primary key with ties in the secondary key's order
+
+        int keyslot = (pass < npasses_1) ? 1 : 0 ;
+        int shift = GB_RADIX_BITS *
+            ((pass < npasses_1) ? pass : (pass - npasses_1)) ;
+        const int64_t *restrict Key = Src [keyslot] ;
+
+        //----------------------------------------------------------------------
+        // histogram the digit, one slice per thread
+        //----------------------------------------------------------------------
+
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t *restrict My_counts = Counts + tid * GB_RADIX_BUCKETS ;
+            memset (My_counts, 0, GB_RADIX_BUCKETS * sizeof (int64_t)) ;
+            int64_t kstart, kend ;
+            GB_PARTITION (kstart, kend, n, tid, nthreads) ;
+            for (int64_t k = kstart ; k < kend ; k++)
+            {
+                My_counts [(Key [k] >> shift) & (GB_RADIX_BUCKETS-1)]++ ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // cumulative sum, bucket-major, giving each thread its offsets
+        //----------------------------------------------------------------------
+
+        int64_t offset = 0 ;
+        bool one_bucket = false ;
+        for (int b = 0 ; b < GB_RADIX_BUCKETS ; b++)
+        {
+            for (int t = 0 ; t < nthreads ; t++)
+            {
+                int64_t c = Counts [t * GB_RADIX_BUCKETS + b] ;
+                Counts [t * GB_RADIX_BUCKETS + b] = offset ;
+                one_bucket = one_bucket || (c == n) ;
+                offset += c ;
+            }
+        }
+
+        if (one_bucket)
+        {
+            // all tuples share this digit; the scatter would be the identity
+            continue ;
+        }
+
+        //----------------------------------------------------------------------
+        // scatter the tuples into the destination arrays
+        //----------------------------------------------------------------------
+
+        const int64_t *restrict S_0 = Src [0] ;
+        const int64_t *restrict S_1 = Src [1] ;
+        const int64_t *restrict S_2 = Src [2] ;
+        int64_t *restrict D_0 = Dst [0] ;
+        int64_t *restrict D_1 = Dst [1] ;
+        int64_t *restrict D_2 = Dst [2] ;
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t *restrict My_counts = Counts + tid * GB_RADIX_BUCKETS ;
+            int64_t kstart, kend ;
+            GB_PARTITION (kstart, kend, n, tid, nthreads) ;
+            for (int64_t k = kstart ; k < kend ; k++)
+            {
+                int64_t pos = My_counts [(Key [k] >> shift)
+                    & (GB_RADIX_BUCKETS-1)]++ ;
+                D_0 [pos] = S_0 [k] ;
+                if (narrays > 1) D_1 [pos] = S_1 [k] ;
+                if (narrays > 2) D_2 [pos] = S_2 [k] ;
+            }
+        }
+
+        // swap the source and destination arrays
+        for (int a = 0 ; a < narrays ; a++)
+        {
+            int64_t *restrict t = Src [a] ; Src [a] = Dst [a] ; Dst [a] = t ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // copy the result back if it ended up in the workspace
+    //--------------------------------------------------------------------------
+
+    if (Src [0] != A_0)
+    {
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t kstart, kend ;
+            GB_PARTITION (kstart, kend, n, tid, nthreads) ;
+            memcpy (A_0 + kstart, Src [0] + kstart,
+                (kend - kstart) * sizeof (int64_t)) ;
+            if (narrays > 1)
+            {
+                memcpy (A_1 + kstart, Src [1] + kstart,
+                    (kend - kstart) * sizeof (int64_t)) ;
+            }
+            if (narrays > 2)
+            {
+                memcpy (A_2 + kstart, Src [2] + kstart,
+                    (kend - kstart) * sizeof (int64_t)) ;
+            }
+        }
+    }
+
+    GB_FREE_WORKSPACE ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -0,0 +1,210 @@
+//------------------------------------------------------------------------------
+// GB_random: create a random matrix or vector from reproducible streams
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Does the work for GxB_Matrix_random and GxB_Vector_random.  The tuples are
+// generated in parallel with a counter-based RNG: the bits of tuple k are a
+// hash of (seed, k), not of any per-thread state, so the result is a pure
+// function of the arguments and is identical for any number of threads.  The
+// generated tuples are handed to GB_build with the GxB_IGNORE_DUP operator,
+// which sorts them and discards duplicates, so the matrix can have slightly
+// fewer than nvals entries (noticeably fewer for RMAT, which is skewed by
+// design).
+
+// JIT: not needed.  Only one variant possible.
+
+#include "GB_build.h"
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_Matrix_free (&C) ;                   \
+    GB_FREE (&I_work, I_size) ;             \
+    GB_FREE (&J_work, J_size) ;             \
+    GB_FREE (&X_work, X_size) ;             \
+}
+
+//------------------------------------------------------------------------------
+// GB_rand_hash: counter-based RNG (the splitmix64 finalizer)
+//------------------------------------------------------------------------------
+
+static inline uint64_t GB_rand_hash (uint64_t seed, uint64_t k)
+{
+    uint64_t x = seed + (k + 1) * 0x9E3779B97F4A7C15ULL ;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL ;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL ;
+    return (x ^ (x >> 31)) ;
+}
+
+// uniform double in [0,1), from the top 53 bits of a random word
+#define GB_RAND_DOUBLE(r) (((double) ((r) >> 11)) / 9007199254740992.0)
+
+//------------------------------------------------------------------------------
+// GB_random: generate the tuples and build the matrix
+//------------------------------------------------------------------------------
+
+GrB_Info GB_random              // create a random matrix or vector
+(
+    GrB_Matrix *A_handle,       // handle of matrix to create
+    GrB_Type type,              // type of matrix to create
+    GrB_Index nrows,            // number of rows
+    GrB_Index ncols,            // number of columns
+    GrB_Index nvals,            // # of tuples to generate, before duplicates
+    int method,                 // GxB_RANDOM_UNIFORM or GxB_RANDOM_RMAT
+    uint64_t seed,              // RNG seed
+    bool is_matrix,             // true for a matrix, false for a vector
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GrB_Matrix C = NULL ;
+    GrB_Index *restrict I_work = NULL ; size_t I_size = 0 ;
+    GrB_Index *restrict J_work = NULL ; size_t J_size = 0 ;
+    double    *restrict X_work = NULL ; size_t X_size = 0 ;
+
+    ASSERT (A_handle != NULL) ;
+    (*A_handle) = NULL ;
+
+    if (method != GxB_RANDOM_UNIFORM && method != GxB_RANDOM_RMAT)
+    {
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    if (nrows == 0 || ncols == 0)
+    {
+        // an empty matrix cannot hold any entry
+        nvals = 0 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // create the new matrix, with no entries
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_Matrix_new (&C, type, nrows, ncols)) ;
+
+    if (nvals == 0)
+    {
+        // nothing to generate
+        (*A_handle) = C ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the tuples
+    //--------------------------------------------------------------------------
+
+    I_work = GB_MALLOC (nvals, GrB_Index, &I_size) ;
+    X_work = GB_MALLOC (nvals, double, &X_size) ;
+    bool ok = (I_work != NULL && X_work != NULL) ;
+    if (is_matrix)
+    {
+        J_work = GB_MALLOC (nvals, GrB_Index, &J_size) ;
+        ok = ok && (J_work != NULL) ;
+    }
+    if (!ok)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (nvals, chunk, nthreads_max) ;
+
+    // keep the two models in distinct counter streams, so that a uniform and
+    // an RMAT matrix built from the same seed do not share any random bits
+    uint64_t s = GB_rand_hash (seed, (uint64_t) method) ;
+
+    //--------------------------------------------------------------------------
+    // generate the tuples
+    //--------------------------------------------------------------------------
+
+    int64_t k ;
+
+    if (method == GxB_RANDOM_UNIFORM || !is_matrix)
+    {
+
+        //----------------------------------------------------------------------
+        // uniform: each tuple takes 3 counters (row, column, value)
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < (int64_t) nvals ; k++)
+        {
+            uint64_t c = 3 * (uint64_t) k ;
+            I_work [k] = GB_rand_hash (s, c) % nrows ;
+            if (is_matrix)
+            {
+                J_work [k] = GB_rand_hash (s, c + 1) % ncols ;
+            }
+            X_work [k] = GB_RAND_DOUBLE (GB_rand_hash (s, c + 2)) ;
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // RMAT: recursive quadrant descent on a 2^scale grid
+        //----------------------------------------------------------------------
+
+        // Graph500 parameters: (a,b,c,d) = (0.57, 0.19, 0.19, 0.05).  Each
+        // level of the descent consumes one counter, plus one for the value,
+        // so tuple k owns the counter range [k*(scale+1), (k+1)*(scale+1)).
+
+        int scale = 0 ;
+        GrB_Index ngrid = GB_IMAX (nrows, ncols) ;
+        while ((((GrB_Index) 1) << scale) < ngrid && scale < 63) scale++ ;
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < (int64_t) nvals ; k++)
+        {
+            uint64_t c = ((uint64_t) k) * (scale + 1) ;
+            GrB_Index i = 0, j = 0 ;
+            for (int lev = 0 ; lev < scale ; lev++)
+            {
+                double u = GB_RAND_DOUBLE (GB_rand_hash (s, c + lev)) ;
+                int ibit = (u >= 0.76) ;                    // a+b = 0.76
+                int jbit = (u >= 0.57 && u < 0.76)          // b quadrant
+                        || (u >= 0.95) ;                    // d quadrant
+                i = 2 * i + ibit ;
+                j = 2 * j + jbit ;
+            }
+            I_work [k] = i % nrows ;
+            J_work [k] = j % ncols ;
+            X_work [k] = GB_RAND_DOUBLE (GB_rand_hash (s, c + scale)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // build the matrix, discarding duplicate tuples
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_build (C, I_work, J_work, X_work, nvals, GxB_IGNORE_DUP,
+        GrB_FP64, is_matrix, false, Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return the result
+    //--------------------------------------------------------------------------
+
+    GB_FREE (&I_work, I_size) ;
+    GB_FREE (&J_work, J_size) ;
+    GB_FREE (&X_work, X_size) ;
+    ASSERT_MATRIX_OK (C, "C random", GB0) ;
+    (*A_handle) = C ;
+    return (GrB_SUCCESS) ;
+}
@@ -111,7 +111,7 @@ void *GB_realloc_memory     // pointer to reallocated block of memory, or
 
     void *pnew = NULL ;
     size_t newsize_allocated = GB_IMAX (newsize, 8) ;
-    if (!GB_Global_have_realloc_function ( ))
+    if (!GB_Global_have_realloc_function ( ) || GB_share_shared (p))
     {
 
         //----------------------------------------------------------------------
@@ -149,6 +149,23 @@ void *GB_realloc_memory     // pointer to reallocated block of memory, or
                 p, oldsize_allocated, newsize_allocated) ;
             #endif
             pnew = GB_Global_realloc_function (p, newsize_allocated) ;
+            if (pnew != NULL)
+            {
+                GB_Global_memory_in_use_adjust ((int64_t) newsize_allocated
+                    - (int64_t) oldsize_allocated) ;
+                if (GB_Global_profiling_get ( ))
+                {
+                    int64_t delta = (int64_t) newsize_allocated
+                        - (int64_t) oldsize_allocated ;
+                    if (delta > 0)
+                    {
+                        // only growth counts toward the bytes allocated
+                        GB_Global_profile_bytes_adjust (delta) ;
+                    }
+                    // but both growth and shrink change the live workspace
+                    GB_prof_memory (delta) ;
+                }
+            }
             #ifdef GB_MEMDUMP
             GB_Global_memtable_dump ( ) ;
             #endif
@@ -21,6 +21,15 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_reduce_to_vector_dense  // T = reduce(A) or reduce(A')
+(
+    GrB_Matrix T,                   // output vector, static header
+    const GrB_Monoid monoid,        // reduce monoid
+    const GrB_Matrix A,             // input matrix, bitmap or full
+    const bool A_transpose,         // if true, reduce the columns of A
+    GB_Werk Werk
+) ;
+
 GrB_Info GB_reduce_to_vector        // C<M> = accum (C,reduce(A))
 (
     GrB_Matrix C,                   // input/output for results, size n-by-1
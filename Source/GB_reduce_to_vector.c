@@ -20,6 +20,7 @@
 #include "GB_binop.h"
 #include "GB_mxm.h"
 #include "GB_get_mask.h"
+#include "GB_accum_mask.h"
 #include "GB_Semiring_new.h"
 
 GrB_Info GB_reduce_to_vector        // C<M> = accum (C,reduce(A))
@@ -106,6 +107,32 @@ GrB_Info GB_reduce_to_vector        // C<M> = accum (C,reduce(A))
 
     // quick return if an empty mask is complemented
     GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp, Mask_struct) ;
+    // quick return if a non-complemented mask has no entries
+    GB_RETURN_IF_EMPTY_MASK (C, C_replace, M, Mask_comp) ;
+
+    //--------------------------------------------------------------------------
+    // T = reduce (A) via the direct kernel, when A is bitmap or full
+    //--------------------------------------------------------------------------
+
+    if (GB_IS_BITMAP (A) || GB_IS_FULL (A))
+    {
+        struct GB_Matrix_opaque T_header ;
+        GrB_Matrix T = NULL ;
+        GB_CLEAR_STATIC_HEADER (T, &T_header) ;
+        info = GB_reduce_to_vector_dense (T, monoid, A, A_transpose, Werk) ;
+        if (info == GrB_SUCCESS)
+        { 
+            // C<M> = accum (C,T): accumulate the results into C via the mask
+            return (GB_accum_mask (C, M, NULL, accum, &T, C_replace,
+                Mask_comp, Mask_struct, Werk)) ;
+        }
+        else if (info != GrB_NO_VALUE)
+        { 
+            // out of memory
+            return (info) ;
+        }
+        // otherwise fall through to the mxm method
+    }
 
     //--------------------------------------------------------------------------
     // create B as full iso vector
@@ -201,7 +228,7 @@ GrB_Info GB_reduce_to_vector        // C<M> = accum (C,reduce(A))
 
     ASSERT_SEMIRING_OK (semiring, "semiring for reduce-to-vector", GB0) ;
 
-    if (GB_Global_burble_get ( ))
+    if (GB_Context_burble ( ))
     { 
         GB_Semiring_check (semiring, "semiring for reduce-to-vector", 3, NULL) ;
     }
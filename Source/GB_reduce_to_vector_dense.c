@@ -0,0 +1,200 @@
+//------------------------------------------------------------------------------
+// GB_reduce_to_vector_dense: T = reduce(A) or reduce(A') for bitmap/full A
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Computes T = reduce(A), a tlen-by-1 vector, directly, when A is bitmap or
+// full.  GB_reduce_to_vector otherwise reduces via C=A*B with an iso ones
+// vector B, which carries the full matrix-multiply machinery (semiring
+// construction, saxpy analysis, task setup) for what is a single sweep over
+// Ax.  Here each entry of T is the monoid fold of one "row" of the dense
+// value array:
+
+//  * if the reduced dimension runs along the vectors of A (A held by row and
+//    reducing rows, or held by column and reducing columns), each T(k) is the
+//    fold of the contiguous segment Ax [k*vlen ... k*vlen+vlen-1], done one
+//    vector per thread;
+
+//  * otherwise the reduction runs across the vectors, and each thread owns a
+//    contiguous slice of indices, folding that slice of every vector in turn:
+//    the thread's accumulators and the slice of Ax it reads stay
+//    cache-resident, the dense-matrix analogue of the panel in
+//    GB_reduce_to_scalar.
+
+// No typecasting is done (A->type must equal the monoid type), and A must not
+// be iso; GrB_NO_VALUE is returned for the cases left to the mxm method.  T
+// is full if A is full, and bitmap if A is bitmap, since a bitmap row with no
+// entries present yields no entry in T.
+
+#include "GB_reduce.h"
+
+#define GB_FREE_ALL GB_phybix_free (T) ;
+
+GrB_Info GB_reduce_to_vector_dense  // T = reduce(A) or reduce(A')
+(
+    GrB_Matrix T,                   // output vector, static header
+    const GrB_Monoid monoid,        // reduce monoid
+    const GrB_Matrix A,             // input matrix, bitmap or full
+    const bool A_transpose,         // if true, reduce the columns of A
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check if the direct kernel applies
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (T != NULL && (T->static_header || GBNSTATIC)) ;
+
+    GrB_Type ztype = monoid->op->ztype ;
+    GxB_binary_function freduce = monoid->op->binop_function ;
+
+    if (!(GB_IS_BITMAP (A) || GB_IS_FULL (A)) || A->iso
+        || A->type != ztype || freduce == NULL)
+    {
+        // the mxm method handles all other cases
+        return (GrB_NO_VALUE) ;
+    }
+
+    GBURBLE ("(dense reduce) ") ;
+
+    //--------------------------------------------------------------------------
+    // get A and allocate T
+    //--------------------------------------------------------------------------
+
+    const int64_t vlen = A->vlen ;
+    const int64_t vdim = A->vdim ;
+    const int64_t anz = vlen * vdim ;
+    const int8_t *restrict Ab = A->b ;
+    const GB_void *restrict Ax = (GB_void *) A->x ;
+    const size_t zsize = ztype->size ;
+    const GB_void *restrict identity = (GB_void *) monoid->identity ;
+
+    // the reduced dimension runs along the vectors of A if the CSR/CSC format
+    // and the transpose request agree; otherwise it runs across them
+    const bool within = (A_transpose == A->is_csc) ;
+    const int64_t tlen = (within) ? vdim : vlen ;
+
+    // a full A with a non-empty reduced dimension gives a full T
+    const bool T_is_full = GB_IS_FULL (A) && ((within ? vlen : vdim) > 0) ;
+
+    // set T->iso = false   OK
+    GB_OK (GB_new_bix (&T, // bitmap or full, existing header
+        ztype, tlen, 1, GB_Ap_null, true,
+        (T_is_full) ? GxB_FULL : GxB_BITMAP, false,
+        GB_HYPER_SWITCH_DEFAULT, -1, tlen, true, false)) ;
+    T->magic = GB_MAGIC ;
+
+    int8_t *restrict Tb = T->b ;
+    GB_void *restrict Tx = (GB_void *) T->x ;
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+
+    //--------------------------------------------------------------------------
+    // T = reduce (A)
+    //--------------------------------------------------------------------------
+
+    int64_t tnvals = 0 ;
+
+    if (within)
+    {
+
+        //----------------------------------------------------------------------
+        // T(k) = fold of the contiguous vector A(:,k)
+        //----------------------------------------------------------------------
+
+        int nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
+        nthreads = GB_IMIN (nthreads, vdim) ;
+
+        int64_t k ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(+:tnvals)
+        for (k = 0 ; k < vdim ; k++)
+        {
+            GB_void z [GB_VLA(zsize)] ;
+            memcpy (z, identity, zsize) ;
+            int64_t count = 0 ;
+            const int64_t pstart = k * vlen ;
+            for (int64_t p = pstart ; p < pstart + vlen ; p++)
+            {
+                if (!GBB (Ab, p)) continue ;
+                freduce (z, z, Ax + p*zsize) ;
+                count++ ;
+            }
+            memcpy (Tx + k*zsize, z, zsize) ;
+            if (!T_is_full)
+            {
+                Tb [k] = (count > 0) ;
+            }
+            tnvals += (count > 0) ;
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // T(i) = fold of A(i,:) across the vectors, one index slice per thread
+        //----------------------------------------------------------------------
+
+        int nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
+        nthreads = GB_IMIN (nthreads, vlen) ;
+
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(+:tnvals)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t istart, iend ;
+            GB_PARTITION (istart, iend, vlen, tid, nthreads) ;
+            for (int64_t i = istart ; i < iend ; i++)
+            {
+                memcpy (Tx + i*zsize, identity, zsize) ;
+                if (!T_is_full)
+                {
+                    Tb [i] = 0 ;
+                }
+            }
+            for (int64_t k = 0 ; k < vdim ; k++)
+            {
+                const int64_t pstart = k * vlen ;
+                for (int64_t i = istart ; i < iend ; i++)
+                {
+                    const int64_t p = pstart + i ;
+                    if (!GBB (Ab, p)) continue ;
+                    freduce (Tx + i*zsize, Tx + i*zsize, Ax + p*zsize) ;
+                    if (!T_is_full)
+                    {
+                        Tb [i] = 1 ;
+                    }
+                }
+            }
+            if (T_is_full)
+            {
+                tnvals += (iend - istart) ;
+            }
+            else
+            {
+                for (int64_t i = istart ; i < iend ; i++)
+                {
+                    tnvals += (Tb [i] != 0) ;
+                }
+            }
+        }
+
+    }
+
+    if (!T_is_full)
+    {
+        T->nvals = tnvals ;
+    }
+
+    ASSERT_MATRIX_OK (T, "T = dense reduce (A)", GB0) ;
+    return (GrB_SUCCESS) ;
+}
@@ -25,6 +25,7 @@
     GB_FREE (&I_work, I_work_size) ;            \
     GB_FREE (&J_work, J_work_size) ;            \
     GB_FREE (&S_work, S_work_size) ;            \
+    GB_FREE (&Cp_new, Cp_new_size) ;            \
     if (T != A && T != C)                       \
     {                                           \
         GB_Matrix_free (&T) ;                   \
@@ -65,9 +66,9 @@ GrB_Info GB_reshape         // reshape a GrB_Matrix into another GrB_Matrix
     GrB_Info info ;
     ASSERT_MATRIX_OK (A, "A for reshape", GB0) ;
 
-    int64_t *I_work = NULL, *J_work = NULL ;
+    int64_t *I_work = NULL, *J_work = NULL, *Cp_new = NULL ;
     GB_void *S_work = NULL, *S_input = NULL ;
-    size_t I_work_size = 0, J_work_size = 0, S_work_size = 0 ;
+    size_t I_work_size = 0, J_work_size = 0, S_work_size = 0, Cp_new_size = 0 ;
     GB_WERK_DECLARE (T_ek_slicing, int64_t) ;
     GrB_Matrix C = NULL, T = NULL ;
 
@@ -116,7 +117,7 @@ GrB_Info GB_reshape         // reshape a GrB_Matrix into another GrB_Matrix
             // T = A'
             GB_OK (GB_new (&T,  // new header
                 type, A->vdim, A->vlen, GB_Ap_null, by_col, GxB_AUTO_SPARSITY,
-                GB_Global_hyper_switch_get ( ), 0)) ;
+                GB_Context_hyper_switch ( ), 0)) ;
             GB_OK (GB_transpose_cast (T, type, by_col, A, false, Werk)) ;
             // now T can be reshaped in-place to construct C
             in_place = true ;
@@ -185,6 +186,16 @@ GrB_Info GB_reshape         // reshape a GrB_Matrix into another GrB_Matrix
         // sparse/hypersparse case
         //----------------------------------------------------------------------
 
+        if (in_place)
+        {
+            // T->i is overwritten by the direct reshape below, or T->i and
+            // T->x are stolen into the builder's in-place sort; get an
+            // exclusive copy if a snapshot or sharing duplicate co-owns them.
+            // GB_MATRIX_WAIT above does not handle this case: GB_wait only
+            // unshares a matrix that has pending work.
+            GB_OK (GB_unshare (T)) ;
+        }
+
         int64_t nvals = GB_nnz (T) ;
         int64_t *Tp = T->p ;
         int64_t *Th = T->h ;
@@ -199,77 +210,90 @@ GrB_Info GB_reshape         // reshape a GrB_Matrix into another GrB_Matrix
         GB_SLICE_MATRIX (T, 1) ;
 
         //----------------------------------------------------------------------
-        // allocate output and workspace
+        // direct reshape, if the entries of T are sorted
         //----------------------------------------------------------------------
 
-        if (in_place)
-        { 
-
-            //------------------------------------------------------------------
-            // Remove T->i and T->x from T; these become I_work and S_work
-            //------------------------------------------------------------------
-
-            // remove T->i from T; it becomes I_work
-            I_work = T->i ; I_work_size = T->i_size ;
-            T->i = NULL   ; T->i_size = 0 ;
-            // remove T->x from T; it becomes S_work
-            S_work = T->x ; S_work_size = T->x_size ;
-            T->x = NULL   ; T->x_size = 0 ;
-            S_input = NULL ;
-
-            // move T into C
-            C = T ;
-            T = NULL ;
-
-        }
-        else
+        // If T is not jumbled, its entries appear in strictly increasing
+        // order of their 1D index iold + jold*tvlen, and the reshape
+        // preserves that order.  C can then be constructed directly: each
+        // vector of C covers a contiguous range of that same entry order, so
+        // each new vector pointer is found by binary search in T, and each
+        // new row index is computed from the old one with a single div/mod.
+        // This skips the GB_builder sort entirely and, when done in place,
+        // moves no values at all.  The direct method is not used if T is
+        // hypersparse, or if C would have more vectors than entries; in
+        // those cases GB_builder constructs C as hypersparse instead.
+
+        if (!T_jumbled && !GB_IS_HYPERSPARSE (T) && nvals > 0 &&
+            vdim_new <= nvals)
         {
 
             //------------------------------------------------------------------
-            // create a new matrix C for GB_builder and allocate I_work
+            // allocate the new vector pointers, and C if not in place
             //------------------------------------------------------------------
 
-            // create the output matrix (just the header; no content)
-            GB_OK (GB_new (&C, // new header
-                type, vlen_new, vdim_new, GB_Ap_null, T_is_csc,
-                GxB_AUTO_SPARSITY, GB_Global_hyper_switch_get ( ), 0)) ;
-            // allocate new space for the future C->i
-            I_work = GB_MALLOC (nvals, int64_t, &I_work_size) ;
-            if (I_work == NULL)
+            GBURBLE ("(direct reshape) ") ;
+            int64_t *restrict Ci = NULL ;
+            Cp_new = GB_MALLOC (vdim_new+1, int64_t, &Cp_new_size) ;
+            if (Cp_new == NULL)
             { 
                 // out of memory
                 GB_FREE_ALL ;
                 return (GrB_OUT_OF_MEMORY) ;
             }
-            // use T->x as S_input to GB_builder, which is not modified
-            S_input = T->x ;
-        }
-
-        if (vdim_new > 1)
-        {
-            // J_work is not needed if vdim_new == 1
-            J_work = GB_MALLOC (nvals, int64_t, &J_work_size) ;
-            if (J_work == NULL)
+            if (in_place)
             { 
-                // out of memory
-                GB_FREE_ALL ;
-                return (GrB_OUT_OF_MEMORY) ;
+                // the new row indices overwrite T->i; the values do not move
+                Ci = T->i ;
+            }
+            else
+            { 
+                // allocate C and copy the values of T into it
+                // set C->iso = T_iso   OK: no burble needed
+                GB_OK (GB_new_bix (&C, // sparse, new header
+                    type, vlen_new, vdim_new, GB_Ap_null, T_is_csc,
+                    GxB_SPARSE, false, GB_Context_hyper_switch ( ),
+                    vdim_new, nvals, true, T_iso)) ;
+                Ci = C->i ;
+                GB_memcpy (C->x, T->x, (T_iso ? 1 : nvals) * type->size,
+                    GB_nthreads (nvals, chunk, nthreads_max)) ;
             }
-        }
 
-        //----------------------------------------------------------------------
-        // construct the new indices
-        //----------------------------------------------------------------------
+            //------------------------------------------------------------------
+            // construct the new vector pointers by binary search in T
+            //------------------------------------------------------------------
 
-        int tid ;
+            // Cp_new [jnew] = # of entries of T whose 1D index < jnew*vlen_new
 
-        if (vdim_new == 1)
-        { 
+            int64_t tvdim = T->vdim ;
+            int nth = GB_nthreads (vdim_new, chunk, nthreads_max) ;
+            int64_t jnew ;
+            #pragma omp parallel for num_threads(nth) schedule(static)
+            for (jnew = 0 ; jnew <= vdim_new ; jnew++)
+            {
+                int64_t b = jnew * vlen_new ;   // 1D start of C(:,jnew)
+                int64_t jold = b / tvlen ;
+                if (jold >= tvdim)
+                { 
+                    Cp_new [jnew] = nvals ;
+                }
+                else
+                { 
+                    // find the first entry in T(:,jold) with index >= b%tvlen
+                    int64_t iold = b % tvlen ;
+                    bool found ;
+                    int64_t pleft = Tp [jold] ;
+                    int64_t pright = Tp [jold+1] - 1 ;
+                    GB_SPLIT_BINARY_SEARCH (iold, Ti, pleft, pright, found) ;
+                    Cp_new [jnew] = pleft ;
+                }
+            }
 
             //------------------------------------------------------------------
-            // C is a single vector: no J_work is needed, and new index is 1D
+            // construct the new row indices
             //------------------------------------------------------------------
 
+            int tid ;
             #pragma omp parallel for num_threads(T_nthreads) schedule(static)
             for (tid = 0 ; tid < T_ntasks ; tid++)
             {
@@ -286,90 +310,210 @@ GrB_Info GB_reshape         // reshape a GrB_Matrix into another GrB_Matrix
                         int64_t iold = Ti [p] ;
                         // convert (iold,jold) to a 1D index
                         int64_t index_1d = iold + jold * tvlen ;
-                        // save the new 1D index
-                        I_work [p] = index_1d ;
+                        // save the new row index; its vector is implicit
+                        Ci [p] = index_1d % vlen_new ;
                     }
                 }
             }
 
+            //------------------------------------------------------------------
+            // transplant the new vector pointers and finish C
+            //------------------------------------------------------------------
+
+            if (in_place)
+            { 
+                // move T into C, and free its old vector pointers
+                C = T ;
+                T = NULL ;
+                GB_phy_free (C) ;
+            }
+            C->p = Cp_new ; C->p_size = Cp_new_size ; C->p_shallow = false ;
+            Cp_new = NULL ; Cp_new_size = 0 ;
+            C->vlen = vlen_new ;
+            C->vdim = vdim_new ;
+            C->plen = vdim_new ;
+            C->nvec = vdim_new ;
+            C->nvals = nvals ;
+            C->magic = GB_MAGIC ;
+            C->nvec_nonempty = GB_nvec_nonempty (C) ;
+
         }
         else
-        { 
+        {
 
             //------------------------------------------------------------------
-            // C is a matrix
+            // allocate output and workspace
             //------------------------------------------------------------------
 
-            #pragma omp parallel for num_threads(T_nthreads) schedule(static)
-            for (tid = 0 ; tid < T_ntasks ; tid++)
+            if (in_place)
+            { 
+
+                //--------------------------------------------------------------
+                // Remove T->i and T->x from T; these become I_work and S_work
+                //--------------------------------------------------------------
+
+                // remove T->i from T; it becomes I_work
+                I_work = T->i ; I_work_size = T->i_size ;
+                T->i = NULL   ; T->i_size = 0 ;
+                // remove T->x from T; it becomes S_work
+                S_work = T->x ; S_work_size = T->x_size ;
+                T->x = NULL   ; T->x_size = 0 ;
+                S_input = NULL ;
+
+                // move T into C
+                C = T ;
+                T = NULL ;
+
+            }
+            else
             {
-                int64_t kfirst = kfirst_Tslice [tid] ;
-                int64_t klast  = klast_Tslice  [tid] ;
-                for (int64_t k = kfirst ; k <= klast ; k++)
+
+                //--------------------------------------------------------------
+                // create a new matrix C for GB_builder and allocate I_work
+                //--------------------------------------------------------------
+
+                // create the output matrix (just the header; no content)
+                GB_OK (GB_new (&C, // new header
+                    type, vlen_new, vdim_new, GB_Ap_null, T_is_csc,
+                    GxB_AUTO_SPARSITY, GB_Context_hyper_switch ( ), 0)) ;
+                // allocate new space for the future C->i
+                I_work = GB_MALLOC (nvals, int64_t, &I_work_size) ;
+                if (I_work == NULL)
+                { 
+                    // out of memory
+                    GB_FREE_ALL ;
+                    return (GrB_OUT_OF_MEMORY) ;
+                }
+                // use T->x as S_input to GB_builder, which is not modified
+                S_input = T->x ;
+            }
+
+            if (vdim_new > 1)
+            {
+                // J_work is not needed if vdim_new == 1
+                J_work = GB_MALLOC (nvals, int64_t, &J_work_size) ;
+                if (J_work == NULL)
+                { 
+                    // out of memory
+                    GB_FREE_ALL ;
+                    return (GrB_OUT_OF_MEMORY) ;
+                }
+            }
+
+            //------------------------------------------------------------------
+            // construct the new indices
+            //------------------------------------------------------------------
+
+            int tid ;
+
+            if (vdim_new == 1)
+            { 
+
+                //--------------------------------------------------------------
+                // C is a single vector: no J_work needed; new index is 1D
+                //--------------------------------------------------------------
+
+                #pragma omp parallel for num_threads(T_nthreads) schedule(static)
+                for (tid = 0 ; tid < T_ntasks ; tid++)
                 {
-                    int64_t jold = GBH (Th, k) ;
-                    int64_t pT_start, pT_end ;
-                    GB_get_pA (&pT_start, &pT_end, tid, k,
-                        kfirst, klast, pstart_Tslice, Tp, tvlen) ;
-                    for (int64_t p = pT_start ; p < pT_end ; p++)
+                    int64_t kfirst = kfirst_Tslice [tid] ;
+                    int64_t klast  = klast_Tslice  [tid] ;
+                    for (int64_t k = kfirst ; k <= klast ; k++)
                     {
-                        int64_t iold = Ti [p] ;
-                        // convert (iold,jold) to a 1D index
-                        int64_t index_1d = iold + jold * tvlen ;
-                        // convert the 1D index to the 2d index: (inew,jnew)
-                        int64_t inew = index_1d % vlen_new ;
-                        int64_t jnew = (index_1d - inew) / vlen_new ;
-                        // save the new indices
-                        I_work [p] = inew ;
-                        J_work [p] = jnew ;
+                        int64_t jold = GBH (Th, k) ;
+                        int64_t pT_start, pT_end ;
+                        GB_get_pA (&pT_start, &pT_end, tid, k,
+                            kfirst, klast, pstart_Tslice, Tp, tvlen) ;
+                        for (int64_t p = pT_start ; p < pT_end ; p++)
+                        {
+                            int64_t iold = Ti [p] ;
+                            // convert (iold,jold) to a 1D index
+                            int64_t index_1d = iold + jold * tvlen ;
+                            // save the new 1D index
+                            I_work [p] = index_1d ;
+                        }
                     }
                 }
+
             }
-        }
+            else
+            { 
 
-        //----------------------------------------------------------------------
-        // free the old C->p and C->h, if constructing C in place
-        //----------------------------------------------------------------------
+                //--------------------------------------------------------------
+                // C is a matrix
+                //--------------------------------------------------------------
 
-        if (in_place)
-        { 
-            GB_phybix_free (C) ;
-        }
+                #pragma omp parallel for num_threads(T_nthreads) schedule(static)
+                for (tid = 0 ; tid < T_ntasks ; tid++)
+                {
+                    int64_t kfirst = kfirst_Tslice [tid] ;
+                    int64_t klast  = klast_Tslice  [tid] ;
+                    for (int64_t k = kfirst ; k <= klast ; k++)
+                    {
+                        int64_t jold = GBH (Th, k) ;
+                        int64_t pT_start, pT_end ;
+                        GB_get_pA (&pT_start, &pT_end, tid, k,
+                            kfirst, klast, pstart_Tslice, Tp, tvlen) ;
+                        for (int64_t p = pT_start ; p < pT_end ; p++)
+                        {
+                            int64_t iold = Ti [p] ;
+                            // convert (iold,jold) to a 1D index
+                            int64_t index_1d = iold + jold * tvlen ;
+                            // convert the 1D index to the 2d index: (inew,jnew)
+                            int64_t inew = index_1d % vlen_new ;
+                            int64_t jnew = (index_1d - inew) / vlen_new ;
+                            // save the new indices
+                            I_work [p] = inew ;
+                            J_work [p] = jnew ;
+                        }
+                    }
+                }
+            }
 
-        //----------------------------------------------------------------------
-        // build the output matrix C
-        //----------------------------------------------------------------------
+            //------------------------------------------------------------------
+            // free the old C->p and C->h, if constructing C in place
+            //------------------------------------------------------------------
+
+            if (in_place)
+            { 
+                GB_phybix_free (C) ;
+            }
+
+            //------------------------------------------------------------------
+            // build the output matrix C
+            //------------------------------------------------------------------
 
-        GB_OK (GB_builder (
-            C,              // output matrix
-            type,           // same type as T
-            vlen_new,       // new vlen
-            vdim_new,       // new vdim
-            T_is_csc,       // same format as T
-            &I_work,        // transplanted into C->i
-            &I_work_size,
-            &J_work,        // freed when done
-            &J_work_size,
-            &S_work,        // array of values; transplanted into C->x in-place
-            &S_work_size,
-            !T_jumbled,     // indices may be jumbled on input
-            true,           // no duplicates exist
-            nvals,          // number of entries in T and C 
-            true,           // C is a matrix
-            NULL,           // I_input is not used
-            NULL,           // J_input is not used
-            S_input,        // S_input is used if not in-place; NULL if in-place
-            T_iso,          // true if T and C are iso-valued
-            nvals,          // number of entries in T and C 
-            NULL,           // no dup operator
-            type,           // type of S_work and S_input
-            true,           // burble is allowed
-            Werk
-        )) ;
-
-        ASSERT (I_work == NULL) ;   // transplanted into C->i
-        ASSERT (J_work == NULL) ;   // freed by GB_builder
-        ASSERT (S_work == NULL) ;   // freed by GB_builder
+            GB_OK (GB_builder (
+                C,              // output matrix
+                type,           // same type as T
+                vlen_new,       // new vlen
+                vdim_new,       // new vdim
+                T_is_csc,       // same format as T
+                &I_work,        // transplanted into C->i
+                &I_work_size,
+                &J_work,        // freed when done
+                &J_work_size,
+                &S_work,        // values; transplanted into C->x in-place
+                &S_work_size,
+                !T_jumbled,     // indices may be jumbled on input
+                true,           // no duplicates exist
+                nvals,          // number of entries in T and C 
+                true,           // C is a matrix
+                NULL,           // I_input is not used
+                NULL,           // J_input is not used
+                S_input,        // S_input used if not in-place; else NULL
+                T_iso,          // true if T and C are iso-valued
+                nvals,          // number of entries in T and C 
+                NULL,           // no dup operator
+                type,           // type of S_work and S_input
+                true,           // burble is allowed
+                Werk
+            )) ;
+
+            ASSERT (I_work == NULL) ;   // transplanted into C->i
+            ASSERT (J_work == NULL) ;   // freed by GB_builder
+            ASSERT (S_work == NULL) ;   // freed by GB_builder
+        }
     }
 
     //--------------------------------------------------------------------------
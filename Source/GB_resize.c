@@ -41,6 +41,10 @@ GrB_Info GB_resize              // change the size of a matrix
     int8_t  *restrict Ab_new = NULL ; size_t Ab_new_size = 0 ;
     ASSERT_MATRIX_OK (A, "A to resize", GB0) ;
 
+    // resizing modifies A in place; if any array of A is shared, replace it
+    // with a private copy first
+    GB_OK (GB_unshare (A)) ;
+
     //--------------------------------------------------------------------------
     // handle the CSR/CSC format
     //--------------------------------------------------------------------------
@@ -65,6 +69,52 @@ GrB_Info GB_resize              // change the size of a matrix
         return (GrB_SUCCESS) ;
     }
 
+    // the row dimension is changing, so the cached row degrees are invalid
+    GB_degree_free (A) ;
+    GB_lookup_cache_free (A) ;
+    GB_fingerprint_clear (A) ;
+
+    //--------------------------------------------------------------------------
+    // grow-only resize of a sparse or hypersparse matrix
+    //--------------------------------------------------------------------------
+
+    // If neither dimension shrinks, no entry can be deleted or moved, and the
+    // resize is just a header update.  Zombies, pending tuples, and the
+    // jumbled state all remain valid, with one exception: if vdim_old is 1
+    // then Pending->j has not been allocated, but is required if the matrix
+    // grows past a single vector, so the tuples must be assembled first.
+
+    if (!GB_IS_BITMAP (A) && !GB_IS_FULL (A)
+        && vdim_new >= vdim_old && vlen_new >= vlen_old)
+    {
+        if (GB_PENDING (A) && vdim_old <= 1 && vdim_new > 1)
+        {
+            GB_MATRIX_WAIT (A) ;
+        }
+
+        // growing the vector length requires no other changes
+        A->vlen = vlen_new ;
+
+        if (vdim_new > vdim_old)
+        {
+            // Grow the vector dimension.  The new vectors are all empty and
+            // are left implicit in the hyperlist, which does not change, so
+            // A->p is never extended.  A->Y depends only on A->h and remains
+            // valid.
+            if (!GB_IS_HYPERSPARSE (A))
+            {
+                // convert to hypersparse first, in O(vdim_old) time
+                GB_OK (GB_convert_sparse_to_hyper (A, Werk)) ;
+            }
+            A->vdim = vdim_new ;
+        }
+
+        ASSERT_MATRIX_OK (A, "A grown", GB0) ;
+
+        // conform the matrix to its desired sparsity structure
+        return (GB_conform (A, Werk)) ;
+    }
+
     //--------------------------------------------------------------------------
     // delete any lingering zombies and assemble any pending tuples
     //--------------------------------------------------------------------------
@@ -0,0 +1,155 @@
+//------------------------------------------------------------------------------
+// GB_row_assign_splice: C(i,:) = u where C is sparse and held by row, u dense
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Fast path for GrB_Row_assign when the new row content completely replaces
+// the old: C is sparse and held by row, there is no mask and no accum, the
+// column list is the whole row, u is dense, and no typecast is needed.  Row i
+// of C is then a contiguous segment of Ci and Cx, and the assignment is a
+// splice: shift the tail of Ci and Cx to make the segment exactly the size of
+// u, copy u into it, and offset the vector pointers after i.  No pending
+// tuples or zombies are created, so a workload that refreshes one row at a
+// time never pays for the assemble/sort churn of the general subassign
+// methods.
+
+// Returns GrB_NO_VALUE, with C unchanged, if the fast path does not apply;
+// the caller then proceeds with the general GB_assign.
+
+#include "GB.h"
+#include "GB_assign.h"
+
+#define GB_FREE_ALL ;
+
+GrB_Info GB_row_assign_splice   // C(i,:) = u, or GrB_NO_VALUE if inapplicable
+(
+    GrB_Matrix C,               // input/output matrix, sparse, held by row
+    const GrB_Index row,        // row index
+    const GrB_Index *Cols,      // column indices; must be GrB_ALL
+    const GrB_Index nCols,      // number of column indices
+    const GrB_Vector u,         // input vector; must be dense
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check if the fast path applies
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+
+    // C is held by row, so user row i of C is the internal vector i, of
+    // length C->vlen (the number of columns of C)
+    const int64_t cvlen = C->vlen ;
+
+    if (C->is_csc || !GB_IS_SPARSE (C)
+        || Cols != GrB_ALL || nCols != (GrB_Index) cvlen
+        || row >= (GrB_Index) C->vdim
+        || C->type != u->type || C->iso
+        || C->p_shallow || C->i_shallow || C->x_shallow
+        || u->vlen != cvlen || GB_nnz (u) != cvlen)
+    {
+        // the general method handles all other cases, including the
+        // out-of-bound row index
+        return (GrB_NO_VALUE) ;
+    }
+
+    // finish any prior pending work; later row splices create none
+    GB_MATRIX_WAIT (C) ;
+    GB_MATRIX_WAIT ((GrB_Matrix) u) ;
+
+    if (!GB_IS_SPARSE (C) || GB_nnz (u) != cvlen)
+    {
+        // waiting may have conformed C or u to another sparsity structure
+        return (GrB_NO_VALUE) ;
+    }
+
+    GBURBLE ("(row splice) ") ;
+
+    //--------------------------------------------------------------------------
+    // make the segment Ci,Cx [Cp [i] ... Cp [i+1]-1] exactly cvlen in size
+    //--------------------------------------------------------------------------
+
+    const int64_t i = (int64_t) row ;
+    const int64_t cnz = GB_nnz (C) ;
+    const size_t csize = C->type->size ;
+
+    int64_t *restrict Cp = C->p ;
+    const int64_t rnz_old = Cp [i+1] - Cp [i] ;
+    const int64_t delta = cvlen - rnz_old ;
+
+    if (delta != 0)
+    {
+        if (cnz + delta > GB_nnz_max (C))
+        {
+            // grow Ci and Cx to hold the larger row
+            GB_OK (GB_ix_realloc (C, cnz + delta)) ;
+        }
+
+        // shift the tail, all entries after row i, by delta
+        int64_t tail = cnz - Cp [i+1] ;
+        memmove (C->i + Cp [i+1] + delta, C->i + Cp [i+1],
+            tail * sizeof (int64_t)) ;
+        memmove ((GB_void *) C->x + (Cp [i+1] + delta) * csize,
+            (GB_void *) C->x + Cp [i+1] * csize, tail * csize) ;
+
+        // offset the vector pointers after row i
+        int nthreads_max = GB_Context_nthreads_max ( ) ;
+        double chunk = GB_Context_chunk ( ) ;
+        const int64_t cnvec = C->nvec ;
+        int nthreads = GB_nthreads (cnvec - i, chunk, nthreads_max) ;
+        int64_t k ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = i+1 ; k <= cnvec ; k++)
+        {
+            Cp [k] += delta ;
+        }
+
+        C->nvals += delta ;
+        if (rnz_old == 0 && cvlen > 0 && C->nvec_nonempty >= 0)
+        {
+            C->nvec_nonempty++ ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // copy u into the segment: row i becomes dense
+    //--------------------------------------------------------------------------
+
+    int64_t *restrict Ci = C->i + Cp [i] ;
+    GB_void *restrict Cx = (GB_void *) C->x + Cp [i] * csize ;
+    const GB_void *restrict Ux = (GB_void *) u->x ;
+
+    for (int64_t jj = 0 ; jj < cvlen ; jj++)
+    {
+        Ci [jj] = jj ;
+    }
+
+    if (u->iso)
+    {
+        // expand the iso value of u
+        for (int64_t jj = 0 ; jj < cvlen ; jj++)
+        {
+            memcpy (Cx + jj * csize, Ux, csize) ;
+        }
+    }
+    else
+    {
+        memcpy (Cx, Ux, cvlen * csize) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // the pattern of C has changed; free the caches that depend on it
+    //--------------------------------------------------------------------------
+
+    GB_degree_free (C) ;
+    GB_lookup_cache_free (C) ;
+    GB_fingerprint_clear (C) ;
+
+    ASSERT_MATRIX_OK (C, "C after row splice", GB0) ;
+    return (GrB_SUCCESS) ;
+}
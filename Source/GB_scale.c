@@ -0,0 +1,318 @@
+//------------------------------------------------------------------------------
+// GB_scale: C = D*C (row scale) or C = C*D (col scale), in place
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  The work is a single memory-bound sweep through C->x.
+
+// In-place counterpart of GB_rowscale and GB_colscale: the values of C are
+// overwritten with op (D(i,i), C(i,j)) (row scale, D on the left) or with
+// op (C(i,j), D(j,j)) (col scale, D on the right).  The pattern of C does
+// not change, so no output matrix is allocated; this halves the memory
+// traffic of iterated scaling steps such as normalizing each row of a
+// matrix by its degree.
+
+// Since the result replaces C->x, the ztype of op must match the type of C
+// exactly.  The inputs of op may require typecasting, which is done here
+// with the same generic cast-and-call scheme as the generic rowscale and
+// colscale kernels.  D must be a square diagonal matrix with all diagonal
+// entries present (as checked by GB_is_diagonal), so D(k,k) is Dx [k].
+
+// The pattern of C is not modified, but C is finished first: pending tuples
+// and zombies have no values to scale, so they are assembled; C may remain
+// jumbled.  If C is iso it is expanded to non-iso, since op in general does
+// not preserve the iso property, and if C->x is shallow a private copy is
+// made first.
+
+#include "GB_mxm.h"
+#include "GB_binop.h"
+#include "GB_iso.h"
+#include "GB_ek_slice.h"
+
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_WERK_POP (C_ek_slicing, int64_t) ;   \
+}
+
+#define GB_FREE_ALL GB_FREE_WORKSPACE
+
+GrB_Info GB_scale               // C = D*C (row scale) or C = C*D (col scale)
+(
+    GrB_Matrix C,               // input/output matrix, modified in place
+    const GrB_BinaryOp op,      // scaling operator; op ztype must be C->type
+    const GrB_Matrix D,         // diagonal matrix of scale factors
+    const bool D_on_left,       // if true, C = D*C; otherwise C = C*D
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT_MATRIX_OK (C, "C input for in-place scale", GB0) ;
+    ASSERT_MATRIX_OK (D, "D for in-place scale", GB0) ;
+    ASSERT_BINARYOP_OK (op, "op for in-place scale", GB0) ;
+    GB_WERK_DECLARE (C_ek_slicing, int64_t) ;
+
+    if (GB_OP_IS_POSITIONAL (op))
+    {
+        // positional ops do not read the values of D or C, so an in-place
+        // scale has no advantage over GrB_apply; they are not supported here
+        GB_ERROR (GrB_DOMAIN_MISMATCH,
+            "positional op %s cannot be used to scale a matrix in place",
+            op->name) ;
+    }
+
+    if (op->ztype != C->type)
+    {
+        // the result overwrites C->x, so no typecast of z is possible
+        GB_ERROR (GrB_DOMAIN_MISMATCH,
+            "op output of type [%s]\n"
+            "must match the matrix type [%s] for an in-place scale",
+            op->ztype->name, C->type->name) ;
+    }
+
+    // D is typecast to the x input of op and C to its y input (row scale),
+    // or C to x and D to y (col scale)
+    GrB_Type D_intype = D_on_left ? op->xtype : op->ytype ;
+    GrB_Type C_intype = D_on_left ? op->ytype : op->xtype ;
+    if (!GB_Type_compatible (D->type, D_intype))
+    {
+        GB_ERROR (GrB_DOMAIN_MISMATCH,
+            "scale factors D of type [%s]\n"
+            "cannot be typecast to op input of type [%s]",
+            D->type->name, D_intype->name) ;
+    }
+    if (!GB_Type_compatible (C->type, C_intype))
+    {
+        GB_ERROR (GrB_DOMAIN_MISMATCH,
+            "matrix of type [%s]\n"
+            "cannot be typecast to op input of type [%s]",
+            C->type->name, C_intype->name) ;
+    }
+
+    int64_t n = D_on_left ? GB_NROWS (C) : GB_NCOLS (C) ;
+    if (GB_NROWS (D) != n || GB_NCOLS (D) != n)
+    {
+        GB_ERROR (GrB_DIMENSION_MISMATCH,
+            "D is " GBd "-by-" GBd "; must be " GBd "-by-" GBd " to scale the"
+            " %s of C", GB_NROWS (D), GB_NCOLS (D), n, n,
+            D_on_left ? "rows" : "columns") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finish any pending work on C and D
+    //--------------------------------------------------------------------------
+
+    GB_MATRIX_WAIT (D) ;
+    GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (C) ;      // C may remain jumbled
+
+    if (!GB_is_diagonal (D))
+    {
+        GB_ERROR (GrB_INVALID_VALUE, "%s",
+            "D must be a sparse or hypersparse diagonal matrix, with all"
+            " diagonal entries present") ;
+    }
+
+    int64_t cnz = GB_nnz_held (C) ;
+    if (cnz == 0)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // ensure C->x can be modified in place
+    //--------------------------------------------------------------------------
+
+    if (C->iso)
+    {
+        // expand C to non-iso; op in general does not preserve the iso value
+        GB_OK (GB_convert_any_to_non_iso (C, true)) ;
+    }
+    else if (C->x_shallow)
+    {
+        // C->x is shared with another matrix; make a private copy to scale
+        size_t Cx_size = 0 ;
+        GB_void *restrict Cx_new =
+            GB_MALLOC (cnz * C->type->size, GB_void, &Cx_size) ;
+        if (Cx_new == NULL)
+        {
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        int nth = GB_nthreads (cnz, GB_Context_chunk ( ),
+            GB_Context_nthreads_max ( )) ;
+        GB_memcpy (Cx_new, C->x, cnz * C->type->size, nth) ;
+        C->x = Cx_new ;
+        C->x_size = Cx_size ;
+        C->x_shallow = false ;
+    }
+
+    // C->x may still be co-owned by a snapshot or sharing duplicate; get an
+    // exclusive copy before scaling it in place
+    GB_OK (GB_unshare (C)) ;
+
+    //--------------------------------------------------------------------------
+    // get C, D, and the operator
+    //--------------------------------------------------------------------------
+
+    GBURBLE ("(in-place %s scale) ", D_on_left ? "row" : "col") ;
+
+    const int64_t cvlen = C->vlen ;
+    const int64_t *restrict Ci = C->i ;
+    const int8_t  *restrict Cb = C->b ;
+    GB_void *restrict Cx = (GB_void *) C->x ;
+    const GB_void *restrict Dx = (const GB_void *) D->x ;
+    const bool D_iso = D->iso ;
+    const size_t csize = C->type->size ;
+    const size_t dsize = D->type->size ;
+
+    GxB_binary_function fop = op->binop_function ;
+    ASSERT (fop != NULL) ;
+    const size_t dkk_size = D_intype->size ;
+    const size_t cij_size = C_intype->size ;
+    GB_cast_function cast_D = GB_cast_factory (D_intype->code, D->type->code) ;
+    GB_cast_function cast_C = GB_cast_factory (C_intype->code, C->type->code) ;
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+
+    // The scale factor D(k,k) is selected by the row index i of each entry
+    // (row scale of a CSC matrix, or col scale of a CSR matrix), or by the
+    // vector index j (the other two cases).
+    bool scale_by_vector = (D_on_left != C->is_csc) ;
+
+    //--------------------------------------------------------------------------
+    // C = D*C or C = C*D, in place
+    //--------------------------------------------------------------------------
+
+    if (!scale_by_vector)
+    {
+
+        //----------------------------------------------------------------------
+        // the scale factor depends on the entry index: C(i,j) = op (.., ..)
+        //----------------------------------------------------------------------
+
+        // one pass over the entries, as in GB_rowscale_template
+        int nthreads = GB_nthreads (cnz, chunk, nthreads_max) ;
+        int ntasks = GB_IMIN (cnz, nthreads) ;
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < ntasks ; tid++)
+        {
+            int64_t pstart, pend ;
+            GB_PARTITION (pstart, pend, cnz, tid, ntasks) ;
+            for (int64_t p = pstart ; p < pend ; p++)
+            {
+                if (!GBB (Cb, p)) continue ;
+                int64_t i = GBI (Ci, p, cvlen) ;
+                GB_void dii [GB_VLA(dkk_size)] ;
+                cast_D (dii, Dx + (D_iso ? 0 : i*dsize), dsize) ;
+                GB_void cij [GB_VLA(cij_size)] ;
+                cast_C (cij, Cx + p*csize, csize) ;
+                if (D_on_left)
+                {
+                    fop (Cx + p*csize, dii, cij) ;  // C(i,j) = D(i,i)*C(i,j)
+                }
+                else
+                {
+                    fop (Cx + p*csize, cij, dii) ;  // C(i,j) = C(i,j)*D(i,i)
+                }
+            }
+        }
+
+    }
+    else if (Ci != NULL)
+    {
+
+        //----------------------------------------------------------------------
+        // sparse/hypersparse C; one scale factor per vector of C
+        //----------------------------------------------------------------------
+
+        // slice the entries of C, as in GB_colscale_template
+        int C_nthreads, C_ntasks ;
+        GB_SLICE_MATRIX (C, 32) ;
+        const int64_t *restrict Cp = C->p ;
+        const int64_t *restrict Ch = C->h ;
+
+        int tid ;
+        #pragma omp parallel for num_threads(C_nthreads) schedule(dynamic,1)
+        for (tid = 0 ; tid < C_ntasks ; tid++)
+        {
+            int64_t kfirst = kfirst_Cslice [tid] ;
+            int64_t klast  = klast_Cslice  [tid] ;
+            for (int64_t k = kfirst ; k <= klast ; k++)
+            {
+                int64_t j = GBH (Ch, k) ;
+                GB_GET_PA (pC_start, pC_end, tid, k, kfirst, klast,
+                    pstart_Cslice, Cp [k], Cp [k+1]) ;
+                GB_void djj [GB_VLA(dkk_size)] ;
+                cast_D (djj, Dx + (D_iso ? 0 : j*dsize), dsize) ;
+                for (int64_t p = pC_start ; p < pC_end ; p++)
+                {
+                    GB_void cij [GB_VLA(cij_size)] ;
+                    cast_C (cij, Cx + p*csize, csize) ;
+                    if (D_on_left)
+                    {
+                        fop (Cx + p*csize, djj, cij) ;
+                    }
+                    else
+                    {
+                        fop (Cx + p*csize, cij, djj) ;
+                    }
+                }
+            }
+        }
+        GB_FREE_WORKSPACE ;
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // bitmap/full C; one scale factor per vector of C
+        //----------------------------------------------------------------------
+
+        int nthreads = GB_nthreads (cnz, chunk, nthreads_max) ;
+        int ntasks = GB_IMIN (cnz, nthreads) ;
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < ntasks ; tid++)
+        {
+            int64_t pstart, pend ;
+            GB_PARTITION (pstart, pend, cnz, tid, ntasks) ;
+            for (int64_t p = pstart ; p < pend ; p++)
+            {
+                if (!GBB (Cb, p)) continue ;
+                int64_t j = p / cvlen ;
+                GB_void djj [GB_VLA(dkk_size)] ;
+                cast_D (djj, Dx + (D_iso ? 0 : j*dsize), dsize) ;
+                GB_void cij [GB_VLA(cij_size)] ;
+                cast_C (cij, Cx + p*csize, csize) ;
+                if (D_on_left)
+                {
+                    fop (Cx + p*csize, djj, cij) ;
+                }
+                else
+                {
+                    fop (Cx + p*csize, cij, djj) ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (C, "C output for in-place scale", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -121,13 +121,42 @@ GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
 
     // quick return if an empty mask is complemented
     GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp, Mask_struct) ;
+    // quick return if a non-complemented mask has no entries
+    GB_RETURN_IF_EMPTY_MASK (C, C_replace, M, Mask_comp) ;
+
+    // capture a profile record for the select proper
+    GB_prof_info prof ;
+    GB_prof_start (&prof) ;
 
     //--------------------------------------------------------------------------
     // delete any lingering zombies and assemble any pending tuples
     //--------------------------------------------------------------------------
 
     GB_MATRIX_WAIT (M) ;        // TODO: delay until accum/mask phase
-    GB_MATRIX_WAIT (A) ;        // TODO: could tolerate jumbled in some cases
+
+    // The generic select kernels tolerate zombies in A for the VALUE* and
+    // user-defined entry selectors, so in those cases only the pending tuples
+    // need to be assembled (and the zombies are pruned from T, not A).  This
+    // lets a burst of deletions be followed by many selects without paying
+    // for a wait on A after each deletion.  The bool-valued VALUE* ops are
+    // excluded since they may be remapped below to a shallow copy of all of
+    // A, and the iso case is excluded since GB_selector may then copy the
+    // pattern of A as-is.  Positional ops require sorted, zombie-free vectors.
+    bool op_tolerates_zombies = (opcode == GB_USER_idxunop_code) ||
+        (!A->iso && xcode != GB_BOOL_code &&
+         (opcode >= GB_VALUENE_idxunop_code &&
+          opcode <= GB_VALUELE_idxunop_code)) ;
+    if (op_tolerates_zombies)
+    {
+        // assemble any pending tuples of A but tolerate its zombies
+        GB_MATRIX_WAIT_IF_PENDING (A) ;
+        GB_MATRIX_WAIT_IF_JUMBLED (A) ;
+    }
+    else
+    {
+        // finish all pending work on A
+        GB_MATRIX_WAIT (A) ;    // TODO: could tolerate jumbled in some cases
+    }
 
     GB_BURBLE_DENSE (C, "(C %s) ") ;
     GB_BURBLE_DENSE (M, "(M %s) ") ;
@@ -379,7 +408,7 @@ GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
         // T is an empty non-iso matrix
         GB_OK (GB_new (&T, // auto (sparse or hyper), existing header
             A->type, A->vlen, A->vdim, GB_Ap_calloc, A_csc,
-            GxB_SPARSE + GxB_HYPERSPARSE, GB_Global_hyper_switch_get ( ), 1)) ;
+            GxB_SPARSE + GxB_HYPERSPARSE, GB_Context_hyper_switch ( ), 1)) ;
     }
     else
     { 
@@ -391,6 +420,10 @@ GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
     ASSERT_MATRIX_OK (T, "T=select(A,Thunk) output", GB0) ;
     ASSERT_MATRIX_OK (C, "C for accum; T=select(A,Thunk) output", GB0) ;
 
+    // T = select (A, Thunk) is done; the accum/mask step that follows is
+    // not part of this record
+    GB_prof_end (&prof, "select", T, 0, GB_Context_nthreads_max ( )) ;
+
     //--------------------------------------------------------------------------
     // C<M> = accum (C,T): accumulate the results into C via the mask
     //--------------------------------------------------------------------------
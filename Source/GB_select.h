@@ -125,6 +125,40 @@ GrB_Info GB_select_generic_phase2
     const int A_nthreads
 ) ;
 
+GrB_Info GB_select_generic_fused
+(
+    int64_t *restrict Tk,
+    int64_t *restrict Ti,
+    GB_void *restrict Tx,
+    int64_t *restrict Tcnt,
+    int64_t *restrict Cp,
+    int64_t *restrict Wfirst,
+    int64_t *restrict Wlast,
+    const GrB_Matrix A,
+    const bool flipij,
+    const GB_void *restrict ythunk,
+    const GrB_IndexUnaryOp op,
+    const int64_t *A_ek_slicing,
+    const int A_ntasks,
+    const int A_nthreads
+) ;
+
+void GB_select_fused_gather
+(
+    int64_t *restrict Ci,
+    GB_void *restrict Cx,
+    const int64_t *restrict Cp,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *restrict Tk,
+    const int64_t *restrict Ti,
+    const GB_void *restrict Tx,
+    const int64_t *restrict Tcnt,
+    const size_t asize,
+    const int64_t *A_ek_slicing,
+    const int A_ntasks,
+    const int A_nthreads
+) ;
+
 GrB_Info GB_select_positional_phase1
 (
     int64_t *restrict Zp,
@@ -145,7 +145,7 @@ GrB_Info GB_select_column
         // return C as empty
         return (GB_new (&C, // auto (sparse or hyper), existing header
             A->type, avlen, avdim, GB_Ap_calloc, true,
-            GxB_AUTO_SPARSITY, GB_Global_hyper_switch_get ( ), 1)) ;
+            GxB_AUTO_SPARSITY, GB_Context_hyper_switch ( ), 1)) ;
     }
 
     //--------------------------------------------------------------------------
@@ -0,0 +1,170 @@
+//------------------------------------------------------------------------------
+// GB_select_generic_fused.c: fused one-pass C=select(A,thunk)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A is sparse or hypersparse, with no zombies and not iso, and the op is one
+// of the built-in GrB_VALUE* selectors.  Instead of counting the live entries
+// (phase1) and then re-testing every entry to copy them (phase2), each task
+// compacts its survivors into its own segment of the workspace Tk, Ti, and
+// Tx in a single scan of A, counting them per vector at the same time.  Each
+// segment is the task's entry range in A, an upper bound on what it can keep,
+// so no counts are needed in advance.  After the caller has finished the
+// cumulative sum of Cp, GB_select_fused_gather moves each segment into its
+// final place in C, without revisiting A or re-testing any entry.
+
+// GB_select_sparse only takes this path when a prior run of the same
+// selection on this matrix predicts that well under half of its entries
+// survive; see the select history in GB_matrix.h.
+
+#include "GB_select.h"
+#include "GB_ek_slice.h"
+
+GrB_Info GB_select_generic_fused
+(
+    int64_t *restrict Tk,           // workspace, size nnz(A)
+    int64_t *restrict Ti,           // workspace, size nnz(A)
+    GB_void *restrict Tx,           // workspace, size nnz(A)*asize, or NULL
+                                    // if C is iso-valued
+    int64_t *restrict Tcnt,         // size A_ntasks: # entries kept per task
+    int64_t *restrict Cp,
+    int64_t *restrict Wfirst,
+    int64_t *restrict Wlast,
+    const GrB_Matrix A,
+    const bool flipij,
+    const GB_void *restrict ythunk,
+    const GrB_IndexUnaryOp op,
+    const int64_t *A_ek_slicing,
+    const int A_ntasks,
+    const int A_nthreads
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_Opcode opcode = op->opcode ;
+    ASSERT (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) ;
+    ASSERT (opcode >= GB_VALUENE_idxunop_code
+         && opcode <= GB_VALUELE_idxunop_code) ;
+    ASSERT (!(A->iso)) ;
+    ASSERT (A->nzombies == 0) ;
+
+    //--------------------------------------------------------------------------
+    // fused scan: generic entry selector
+    //--------------------------------------------------------------------------
+
+    ASSERT_TYPE_OK (op->xtype, "op->xtype", GB0) ;
+    GB_Type_code zcode = op->ztype->code ;
+    GB_Type_code xcode = op->xtype->code ;
+    GB_Type_code acode = A->type->code ;
+    size_t zsize = op->ztype->size ;
+    size_t xsize = op->xtype->size ;
+    GxB_index_unary_function fkeep = op->idxunop_function ;
+    GB_cast_function cast_Z_to_bool, cast_A_to_X ;
+
+    #define GB_GENERIC
+    #define GB_A_TYPE GB_void
+    #include "GB_select_shared_definitions.h"
+
+    if (op->ztype == GrB_BOOL && op->xtype == A->type)
+    { 
+
+        //----------------------------------------------------------------------
+        // no typecasting is required
+        //----------------------------------------------------------------------
+
+        #define GB_TEST_VALUE_OF_ENTRY(keep,p)                          \
+            bool keep ;                                                 \
+            fkeep (&keep, Ax +(p)*asize,                                \
+                flipij ? j : i, flipij ? i : j, ythunk) ;
+        #include "GB_select_fused_template.c"
+
+    }
+    else
+    { 
+
+        //----------------------------------------------------------------------
+        // typecasting is required
+        //----------------------------------------------------------------------
+
+        cast_A_to_X = GB_cast_factory (xcode, acode) ;
+        cast_Z_to_bool = GB_cast_factory (GB_BOOL_code, zcode) ; 
+
+        #undef  GB_TEST_VALUE_OF_ENTRY
+        #define GB_TEST_VALUE_OF_ENTRY(keep,p)                          \
+            bool keep ;                                                 \
+            GB_void z [GB_VLA(zsize)] ;                                 \
+            GB_void x [GB_VLA(xsize)] ;                                 \
+            cast_A_to_X (x, Ax +(p)*asize, asize) ;                     \
+            fkeep (z, x, flipij ? j : i, flipij ? i : j, ythunk) ;      \
+            cast_Z_to_bool (&keep, z, zsize) ;
+        #include "GB_select_fused_template.c"
+
+    }
+
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_select_fused_gather: move the compacted segments into C
+//------------------------------------------------------------------------------
+
+// Survivors in a task's segment of Tk, Ti, Tx are ordered by vector, and a
+// vector's survivors within a segment are contiguous.  The destination
+// restarts at Cp [k] at each vector boundary, or at Cp_kfirst [tid] for the
+// task's first vector, which earlier tasks may share: the same rule as
+// GB_GET_PA_AND_PC in the phase2 kernels.
+
+void GB_select_fused_gather
+(
+    int64_t *restrict Ci,
+    GB_void *restrict Cx,           // NULL if C is iso-valued
+    const int64_t *restrict Cp,     // after the cumulative sum
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *restrict Tk,
+    const int64_t *restrict Ti,
+    const GB_void *restrict Tx,     // NULL if C is iso-valued
+    const int64_t *restrict Tcnt,
+    const size_t asize,
+    const int64_t *A_ek_slicing,
+    const int A_ntasks,
+    const int A_nthreads
+)
+{
+
+    const int64_t *restrict kfirst_Aslice = A_ek_slicing ;
+    const int64_t *restrict pstart_Aslice = A_ek_slicing + A_ntasks * 2 ;
+
+    int tid ;
+    #pragma omp parallel for num_threads(A_nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < A_ntasks ; tid++)
+    {
+        int64_t kfirst = kfirst_Aslice [tid] ;
+        int64_t pT = pstart_Aslice [tid] ;      // base of this task's segment
+        int64_t tnz = Tcnt [tid] ;
+        int64_t k = -1 ;
+        int64_t pC = 0 ;
+        for (int64_t t = pT ; t < pT + tnz ; t++)
+        {
+            if (Tk [t] != k)
+            { 
+                // first survivor of vector k in this segment
+                k = Tk [t] ;
+                pC = (k == kfirst) ? Cp_kfirst [tid] : Cp [k] ;
+            }
+            Ci [pC] = Ti [t] ;
+            if (Cx != NULL)
+            { 
+                memcpy (Cx + pC*asize, Tx + t*asize, asize) ;
+            }
+            pC++ ;
+        }
+    }
+}
+
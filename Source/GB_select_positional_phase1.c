@@ -9,6 +9,17 @@
 
 // A is sparse or hypersparse
 
+// For the positional selectors (TRIL, TRIU, DIAG, OFFDIAG, ROWINDEX, ROWLE,
+// and ROWGT) the survivors within each vector of A form one contiguous
+// segment (or all but one entry, for OFFDIAG and ROWINDEX), since the row
+// indices in each vector are sorted.  Phase1 therefore finds each cut point
+// with a binary search, in O(log (nnz (A (:,j)))) time per vector instead of
+// scanning the entries, and records it in Zp; phase2 then assembles C purely
+// with segment memcpy's.  Extracting a triangle of a large matrix thus costs
+// O(anvec log d) for the count plus the copy of the result, independent of
+// the number of entries examined.  The entry-by-entry scan below is used
+// only for the nonzombie selector, whose survivors are not contiguous.
+
 // JIT: not needed, but 3 variants possible (A sparse, hyper, or full for DIAG)
 
 #include "GB_select.h"
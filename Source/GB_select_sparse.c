@@ -19,6 +19,10 @@
 
 #define GB_FREE_WORKSPACE                   \
 {                                           \
+    GB_FREE_WORK (&Tk, Tk_size) ;           \
+    GB_FREE_WORK (&Ti, Ti_size) ;           \
+    GB_FREE_WORK (&Tx, Tx_size) ;           \
+    GB_WERK_POP (Tcnt, int64_t) ;           \
     GB_FREE_WORK (&Zp, Zp_size) ;           \
     GB_WERK_POP (Work, int64_t) ;           \
     GB_WERK_POP (A_ek_slicing, int64_t) ;   \
@@ -54,6 +58,10 @@ GrB_Info GB_select_sparse
 
     GrB_Info info ;
     int64_t *restrict Zp = NULL ; size_t Zp_size = 0 ;
+    int64_t *restrict Tk = NULL ; size_t Tk_size = 0 ;
+    int64_t *restrict Ti = NULL ; size_t Ti_size = 0 ;
+    GB_void *restrict Tx = NULL ; size_t Tx_size = 0 ;
+    GB_WERK_DECLARE (Tcnt, int64_t) ;
     GB_WERK_DECLARE (Work, int64_t) ;
     int64_t *restrict Wfirst = NULL ;
     int64_t *restrict Wlast = NULL ;
@@ -155,12 +163,68 @@ GrB_Info GB_select_sparse
         }
     }
 
+    //--------------------------------------------------------------------------
+    // decide whether to use the fused single-scan method
+    //--------------------------------------------------------------------------
+
+    // If this same selection was applied to this matrix before, the number of
+    // entries it kept is recorded in the select history of A (see
+    // GB_matrix.h).  When that history predicts that under half the entries
+    // survive, a single fused scan replaces phase1 and phase2 below: each
+    // task compacts its survivors into its own segment of the workspace Tk,
+    // Ti, Tx, sized by nnz(A) as an upper bound, and a gather pass then moves
+    // them into C.  This reads A once instead of twice.  The history is a
+    // heuristic only, so a stale prediction can affect the time taken but
+    // never the result.
+
+    bool op_is_value = (opcode >= GB_VALUENE_idxunop_code)
+                    && (opcode <= GB_VALUELE_idxunop_code) ;
+    size_t ysize = (op->ytype == NULL) ? 0 : op->ytype->size ;
+    bool use_fused = false ;
+    if (!in_place_A && op_is_value && !A_iso && A->nzombies == 0
+        && ysize > 0 && ysize <= sizeof (A->select_ythunk)
+        && A->select_opcode == (int32_t) opcode
+        && A->select_cnz >= 0
+        && memcmp (A->select_ythunk, ythunk, ysize) == 0
+        && 2 * A->select_cnz < A->select_anz)
+    { 
+        // allocate the fused workspace; fall back to the two-pass method if
+        // out of memory
+        GB_WERK_PUSH (Tcnt, A_ntasks, int64_t) ;
+        Tk = GB_MALLOC_WORK (anz_held, int64_t, &Tk_size) ;
+        Ti = GB_MALLOC_WORK (anz_held, int64_t, &Ti_size) ;
+        if (!C_iso)
+        { 
+            Tx = GB_MALLOC_WORK (anz_held * asize, GB_void, &Tx_size) ;
+        }
+        use_fused = (Tcnt != NULL && Tk != NULL && Ti != NULL
+            && (C_iso || Tx != NULL)) ;
+        if (!use_fused)
+        { 
+            GB_FREE_WORK (&Tk, Tk_size) ;
+            GB_FREE_WORK (&Ti, Ti_size) ;
+            GB_FREE_WORK (&Tx, Tx_size) ;
+            GB_WERK_POP (Tcnt, int64_t) ;
+        }
+    }
+
     //==========================================================================
     // phase1: count the live entries in each column
     //==========================================================================
 
     info = GrB_NO_VALUE ;
-    if (op_is_positional || opcode == GB_NONZOMBIE_idxunop_code)
+    if (use_fused)
+    { 
+
+        //----------------------------------------------------------------------
+        // fused phase1+phase2: count and compact A in a single scan
+        //----------------------------------------------------------------------
+
+        info = GB_select_generic_fused (Tk, Ti, Tx, Tcnt, Cp, Wfirst, Wlast,
+            A, flipij, ythunk, op, A_ek_slicing, A_ntasks, A_nthreads) ;
+
+    }
+    else if (op_is_positional || opcode == GB_NONZOMBIE_idxunop_code)
     { 
 
         //----------------------------------------------------------------------
@@ -184,9 +248,15 @@ GrB_Info GB_select_sparse
              && opcode <= GB_VALUELE_idxunop_code)
              || (opcode == GB_USER_idxunop_code)) ;
 
+        // if A has zombies, only the generic kernel can be used, since it
+        // skips the zombies inline; the factory and JIT kernels do not
+        bool A_has_zombies = (A->nzombies > 0) ;
+
         #ifndef GBCOMPACT
         GB_IF_FACTORY_KERNELS_ENABLED
-        { 
+        {
+            if (!A_has_zombies)
+            { 
 
             //------------------------------------------------------------------
             // via the factory kernel (includes user-defined ops)
@@ -204,6 +274,7 @@ GrB_Info GB_select_sparse
             // launch the switch factory
             #include "GB_select_entry_factory.c"
             #undef  GB_SEL_WORKER
+            }
         }
         #endif
 
@@ -211,7 +282,7 @@ GrB_Info GB_select_sparse
         // via the JIT or PreJIT kernel
         //----------------------------------------------------------------------
 
-        if (info == GrB_NO_VALUE)
+        if (info == GrB_NO_VALUE && !A_has_zombies)
         { 
             info = GB_select_phase1_jit (Cp, Wfirst, Wlast, C_iso, in_place_A,
                 A, ythunk, op, flipij, A_ek_slicing, A_ntasks, A_nthreads) ;
@@ -241,6 +312,19 @@ GrB_Info GB_select_sparse
     GB_ek_slice_merge2 (&C_nvec_nonempty, Cp_kfirst, Cp, anvec,
         Wfirst, Wlast, A_ek_slicing, A_ntasks, A_nthreads, Werk) ;
 
+    //--------------------------------------------------------------------------
+    // record the select history of A
+    //--------------------------------------------------------------------------
+
+    if (!in_place_A && op_is_value && !A_iso && A->nzombies == 0
+        && ysize > 0 && ysize <= sizeof (A->select_ythunk))
+    { 
+        A->select_opcode = (int32_t) opcode ;
+        memcpy (A->select_ythunk, ythunk, ysize) ;
+        A->select_anz = anz_held ;
+        A->select_cnz = Cp [anvec] ;
+    }
+
     //--------------------------------------------------------------------------
     // allocate new space for the compacted Ci and Cx
     //--------------------------------------------------------------------------
@@ -272,7 +356,19 @@ GrB_Info GB_select_sparse
     //==========================================================================
 
     info = GrB_NO_VALUE ;
-    if (op_is_positional || (opcode == GB_NONZOMBIE_idxunop_code && A_iso))
+    if (use_fused)
+    { 
+
+        //----------------------------------------------------------------------
+        // fused method: gather the compacted segments into Ci and Cx
+        //----------------------------------------------------------------------
+
+        GB_select_fused_gather (Ci, C_iso ? NULL : Cx, Cp, Cp_kfirst,
+            Tk, Ti, Tx, Tcnt, asize, A_ek_slicing, A_ntasks, A_nthreads) ;
+        info = GrB_SUCCESS ;
+
+    }
+    else if (op_is_positional || (opcode == GB_NONZOMBIE_idxunop_code && A_iso))
     { 
 
         //----------------------------------------------------------------------
@@ -297,9 +393,17 @@ GrB_Info GB_select_sparse
              || (opcode == GB_NONZOMBIE_idxunop_code && !A_iso)
              || (opcode == GB_USER_idxunop_code)) ;
 
+        // as in phase1, zombies in A restrict phase2 to the generic kernel,
+        // except for the NONZOMBIE selector whose kernels handle them by
+        // construction
+        bool phase2_tolerates_zombies =
+            (opcode == GB_NONZOMBIE_idxunop_code) || (A->nzombies == 0) ;
+
         #ifndef GBCOMPACT
         GB_IF_FACTORY_KERNELS_ENABLED
-        { 
+        {
+            if (phase2_tolerates_zombies)
+            { 
 
             //------------------------------------------------------------------
             // via the factory kernel
@@ -317,6 +421,7 @@ GrB_Info GB_select_sparse
 
             // launch the switch factory
             #include "GB_select_entry_factory.c"
+            }
         }
         #endif
 
@@ -324,7 +429,7 @@ GrB_Info GB_select_sparse
         // via the JIT or PreJIT kernel
         //----------------------------------------------------------------------
 
-        if (info == GrB_NO_VALUE)
+        if (info == GrB_NO_VALUE && phase2_tolerates_zombies)
         { 
             info = GB_select_phase2_jit (Ci, C_iso ? NULL : Cx, Cp, C_iso,
                 in_place_A, Cp_kfirst, A, flipij, ythunk, op, A_ek_slicing,
@@ -380,13 +485,20 @@ GrB_Info GB_select_sparse
             A->nvec = cnvec ;
             ASSERT (A->nvec == C_nvec_nonempty) ;
             GB_FREE (&Cp, Cp_size) ;
-            // the A->Y hyper_hash is now invalid
+            // the A->Y hyper_hash and A->degree are now invalid
             GB_hyper_hash_free (A) ;
+            GB_degree_free (A) ;
+            GB_lookup_cache_free (A) ;
+            GB_fingerprint_clear (A) ;
         }
         else
         { 
-            // free the old A->p and transplant in Cp as the new A->p
-            GB_FREE (&Ap, Ap_size) ;
+            // free the old A->p, unless it is resident in the header of A,
+            // and transplant in Cp as the new A->p
+            if (Ap != A->p_static)
+            { 
+                GB_FREE (&Ap, Ap_size) ;
+            }
             A->p = Cp ; Cp = NULL ; A->p_size = Cp_size ;
             A->plen = cplen ;
         }
@@ -83,7 +83,7 @@ GrB_Info GB_select_value_iso
         // C is an empty matrix
         return (GB_new (&C, // existing header
             A->type, A->vlen, A->vdim, GB_Ap_calloc, true,
-            GxB_AUTO_SPARSITY, GB_Global_hyper_switch_get ( ), 1)) ;
+            GxB_AUTO_SPARSITY, GB_Context_hyper_switch ( ), 1)) ;
     }
     else
     { 
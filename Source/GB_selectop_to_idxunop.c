@@ -209,7 +209,7 @@ GrB_Info GB_selectop_to_idxunop
 
     // allocate the NewThunk as a full scalar
     GB_OK (GB_new_bix ((GrB_Matrix *) &NewThunk, idxunop->ytype, 1, 1,
-        GB_Ap_calloc, true, GxB_FULL, false, GB_Global_hyper_switch_get ( ),
+        GB_Ap_calloc, true, GxB_FULL, false, GB_Context_hyper_switch ( ),
         1, 1, true, false)) ;
 
     // NewThunk = 0
@@ -127,14 +127,21 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
     //--------------------------------------------------------------------------
 
     int32_t algo, level ;
+    bool checksum = (method >= GxB_COMPRESSION_CHECKSUM) ;
     GB_serialize_method (&algo, &level, method) ;
     method = algo + level ;
-    GBURBLE ("(compression: %s%s%s%s:%d) ",
+    if (checksum && algo != GxB_COMPRESSION_NONE)
+    { 
+        // append an xxHash64 digest to each compressed block
+        method += GxB_COMPRESSION_CHECKSUM ;
+    }
+    GBURBLE ("(compression: %s%s%s%s%s:%d%s) ",
         (algo == GxB_COMPRESSION_NONE ) ? "none" : "",
         (algo == GxB_COMPRESSION_LZ4  ) ? "LZ4" : "",
         (algo == GxB_COMPRESSION_LZ4HC) ? "LZ4HC" : "",
         (algo == GxB_COMPRESSION_ZSTD ) ? "ZSTD" : "",
-        level) ;
+        (algo == GxB_COMPRESSION_AUTO ) ? "auto" : "",
+        level, checksum ? "+checksum" : "") ;
 
     //--------------------------------------------------------------------------
     // get the content of the matrix
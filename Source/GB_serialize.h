@@ -21,6 +21,18 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_serialize_stream    // serialize a matrix into a stream
+(
+    // output:
+    size_t *blob_size_handle,       // # of bytes written to the stream
+    // input:
+    GxB_serialize_callback write,   // user write callback
+    void *stream,                   // opaque stream handle passed to write
+    const GrB_Matrix A,             // matrix to serialize
+    int32_t method,                 // method to use
+    GB_Werk Werk
+) ;
+
 void GB_serialize_method
 (
     // output
@@ -36,8 +48,14 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     GrB_Matrix *Chandle,            // output matrix created from the blob
     // input:
     GrB_Type type_expected,         // type expected (NULL for any built-in)
-    const GB_void *blob,            // serialized matrix 
-    size_t blob_size                // size of the blob
+    const GB_void *blob,            // serialized matrix
+    size_t blob_size,               // size of the blob
+    bool shallow,                   // if true, any uncompressed array in the
+                                    // blob becomes a shallow pointer into the
+                                    // blob itself, with no copy
+    bool typecast                   // if true, a blob holding a built-in type
+                                    // other than type_expected is typecast to
+                                    // type_expected as its values are loaded
 ) ;
 
 typedef struct
@@ -134,5 +152,68 @@ GrB_Info GB_deserialize_from_blob
 #define GB_BLOB_READS(S,n) \
     int64_t *S = (int64_t *) (blob + s) ; s += n * sizeof (int64_t) ;
 
+//------------------------------------------------------------------------------
+// delta serialization
+//------------------------------------------------------------------------------
+
+// A delta blob starts with GB_DELTA_MAGIC, followed by the same 160-byte
+// header as a standard blob (with the per-array nblocks slots holding the #
+// of delta chunks), the type_name for user-defined types, then for each of
+// the five arrays: a table of per-chunk checksums (uint64_t) and cumulative
+// compressed chunk sizes (int64_t), and finally the compressed data of the
+// changed chunks.  A chunk whose cumulative size does not advance is
+// unchanged, and is recovered from the base matrix when deserialized.
+
+#define GB_DELTA_MAGIC  UINT64_C (0x61746c6564427247)   // "GrBdelta"
+#define GB_DELTA_CHUNK  (64*1024)       // bytes per delta chunk
+
+// GB_delta_checksum: checksum of one delta chunk (FNV-1a, 8 bytes at a time)
+static inline uint64_t GB_delta_checksum (const GB_void *X, int64_t len)
+{
+    uint64_t h = UINT64_C (0xcbf29ce484222325) ;
+    int64_t n = len / 8 ;
+    for (int64_t k = 0 ; k < n ; k++)
+    {
+        uint64_t w ;
+        memcpy (&w, X + 8*k, 8) ;
+        h = (h ^ w) * UINT64_C (0x100000001b3) ;
+    }
+    for (int64_t k = 8*n ; k < len ; k++)
+    {
+        h = (h ^ (uint64_t) X [k]) * UINT64_C (0x100000001b3) ;
+    }
+    return (h) ;
+}
+
+GrB_Info GB_serialize_delta     // delta-serialize a matrix into a blob
+(
+    // output:
+    GB_void **blob_handle,          // delta blob, allocated on output
+    size_t *blob_size_handle,       // size of the delta blob
+    // input:
+    const GrB_Matrix A,             // matrix to serialize
+    const GB_void *base_blob,       // prior delta blob, or NULL for a full
+                                    // delta blob with all chunks present
+    size_t base_blob_size,          // size of the prior delta blob
+    int32_t method,                 // method to use
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_deserialize_delta   // deserialize a matrix from a delta blob
+(
+    // output:
+    GrB_Matrix *Chandle,            // output matrix created from the blob
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    const GB_void *blob,            // serialized delta blob
+    size_t blob_size,               // size of the delta blob
+    const GrB_Matrix base           // base matrix holding the unchanged
+                                    // chunks, or NULL if the delta is full
+) ;
+
+// first 8 bytes of a GxB_checkpoint stream ("GBCHKPT" and a version nibble)
+#define GB_CHECKPOINT_MAGIC   0x474243484B505431ULL
+#define GB_CHECKPOINT_VERSION 1
+
 #endif
 
@@ -17,6 +17,14 @@
 #include "GB_serialize.h"
 #include "GB_lz4.h"
 #include "GB_zstd.h"
+// xxHash uses switch statements with no default case.
+#if GB_COMPILER_GCC
+#pragma GCC diagnostic ignored "-Wswitch-default"
+#endif
+
+#define XXH_INLINE_ALL
+#define XXH_NO_STREAM
+#include "xxhash.h"
 
 #define GB_FREE_ALL                                             \
 {                                                               \
@@ -24,6 +32,78 @@
     GB_serialize_free_blocks (&Blocks, Blocks_size, nblocks) ;  \
 }
 
+//------------------------------------------------------------------------------
+// GB_serialize_autotune: pick a method for one array by trial compression
+//------------------------------------------------------------------------------
+
+// For GxB_COMPRESSION_AUTO: trial-compress a few sampled regions of the array
+// with ZSTD at level 1, and pick a method for the whole array from the sample
+// compression ratio.  An array that barely compresses (the index arrays of a
+// matrix with random pattern, or an array of floating-point values with fully
+// random mantissas) is stored uncompressed, skipping the compression entirely.
+// A highly compressible array is worth a higher ZSTD level.  Everything else
+// gets the default ZSTD level 1.
+
+#define GB_AUTOTUNE_SAMPLE  (32*1024)   // bytes per sampled region
+#define GB_AUTOTUNE_NSAMPLES 3          // # of sampled regions
+
+static int32_t GB_serialize_autotune    // method to use for this array
+(
+    GB_void *X,                         // input array of size len
+    int64_t len                         // size of X, in bytes
+)
+{
+
+    // allocate workspace for the trial compression
+    size_t dst_size = 0 ;
+    size_t bound = ZSTD_compressBound (GB_AUTOTUNE_SAMPLE) ;
+    GB_void *dst = GB_MALLOC (bound, GB_void, &dst_size) ;
+    if (dst == NULL)
+    {
+        // out of memory: use the default method for this array
+        return (GxB_COMPRESSION_ZSTD + 1) ;
+    }
+
+    // trial-compress up to 3 regions: the start, middle, and end of X
+    int64_t sample = GB_IMIN (len, GB_AUTOTUNE_SAMPLE) ;
+    int nsamples = (len >= GB_AUTOTUNE_NSAMPLES * sample) ?
+        GB_AUTOTUNE_NSAMPLES : 1 ;
+    int64_t in = 0, out = 0 ;
+    for (int k = 0 ; k < nsamples ; k++)
+    {
+        int64_t kstart = (nsamples == 1) ? 0 :
+            ((len - sample) * k) / (nsamples - 1) ;
+        size_t s = ZSTD_compress (dst, dst_size, X + kstart, sample, 1) ;
+        if (s > dst_size)
+        {
+            // compression failure: this can "never" occur
+            in = 0 ;
+            break ;
+        }
+        in += sample ;
+        out += (int64_t) s ;
+    }
+    GB_FREE (&dst, dst_size) ;
+
+    if (in == 0)
+    {
+        // trial failed: use the default method for this array
+        return (GxB_COMPRESSION_ZSTD + 1) ;
+    }
+    if (out >= (in * 63) / 64)
+    {
+        // the sample saves less than ~1.6%: not worth compressing at all
+        return (GxB_COMPRESSION_NONE) ;
+    }
+    if (out <= in / 3)
+    {
+        // highly compressible: a higher level is worth the extra time
+        return (GxB_COMPRESSION_ZSTD + 9) ;
+    }
+    // otherwise, use the default ZSTD level 1
+    return (GxB_COMPRESSION_ZSTD + 1) ;
+}
+
 GrB_Info GB_serialize_array
 (
     // output:
@@ -79,6 +159,32 @@ GrB_Info GB_serialize_array
         return (GrB_SUCCESS) ;
     }
 
+    //--------------------------------------------------------------------------
+    // get the per-block checksum flag
+    //--------------------------------------------------------------------------
+
+    // if set, each compressed block is followed by its own xxHash64 digest,
+    // which is verified by GB_deserialize_from_blob before decompressing
+
+    bool checksum = (method >= GxB_COMPRESSION_CHECKSUM) ;
+    if (checksum)
+    { 
+        method -= GxB_COMPRESSION_CHECKSUM ;
+    }
+
+    //--------------------------------------------------------------------------
+    // resolve the AUTO method, by trial compression of a sample
+    //--------------------------------------------------------------------------
+
+    if (algo == GxB_COMPRESSION_AUTO && !dryrun && len >= 256)
+    {
+        // pick NONE, ZSTD level 1, or ZSTD level 9 for this array.  For the
+        // dryrun case this is skipped; the ZSTD bound computed below is an
+        // upper bound on the size for any method the trial may select.
+        method = GB_serialize_autotune (X, len) ;
+        GB_serialize_method (&algo, &level, method) ;
+    }
+
     //--------------------------------------------------------------------------
     // check for no compression
     //--------------------------------------------------------------------------
@@ -116,7 +222,7 @@ GrB_Info GB_serialize_array
         return (GrB_SUCCESS) ;
     }
 
-    (*method_used) = method ;
+    (*method_used) = method + (checksum ? GxB_COMPRESSION_CHECKSUM : 0) ;
 
     //--------------------------------------------------------------------------
     // determine # of threads to use
@@ -185,6 +291,11 @@ GrB_Info GB_serialize_array
         }
 
         ASSERT (s < INT32_MAX) ;
+        if (checksum)
+        { 
+            // reserve room for the trailing xxHash64 digest of the block
+            s += sizeof (uint64_t) ;
+        }
         if (dryrun)
         { 
             // do not allocate the block; just sum up the upper bound sizes
@@ -232,6 +343,11 @@ GrB_Info GB_serialize_array
         char *dst = (char *) Blocks [blockid].p ;           // destination
         int srcSize = (int) (kend - kstart) ;               // size of source
         size_t dsize = Blocks [blockid].p_size_allocated ;  // size of dest
+        if (checksum)
+        { 
+            // the last 8 bytes of the block are reserved for its digest
+            dsize -= sizeof (uint64_t) ;
+        }
         int dstCapacity = (int) GB_IMIN (dsize, INT32_MAX) ;
         int s ;
         size_t s64 ;
@@ -260,6 +376,15 @@ GrB_Info GB_serialize_array
                 Sblocks [blockid] = (int64_t) s64 ;
                 break ;
         }
+
+        if (checksum && ok)
+        { 
+            // append the xxHash64 digest of the compressed block
+            int64_t bsize = Sblocks [blockid] ;
+            uint64_t digest = XXH3_64bits (dst, bsize) ;
+            memcpy (dst + bsize, &digest, sizeof (uint64_t)) ;
+            Sblocks [blockid] = bsize + sizeof (uint64_t) ;
+        }
     }
 
     if (!ok)
@@ -0,0 +1,611 @@
+//------------------------------------------------------------------------------
+// GB_serialize_delta: delta-serialize a GrB_Matrix against a prior blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Serialize a matrix as a delta against a prior delta blob.  Each of the five
+// arrays (Ap, Ah, Ab, Ai, and Ax) is split into fixed-size chunks of
+// GB_DELTA_CHUNK bytes, and each chunk is checksummed.  A chunk whose
+// checksum and length match the corresponding chunk of the base blob is
+// recorded as unchanged, with no data; only changed chunks are compressed
+// and written.  The checksum table of the current matrix is always written
+// in full, so the resulting blob can in turn serve as the base for the next
+// delta.  With base_blob of NULL, every chunk is written, giving a
+// self-contained "full" delta blob to start a snapshot chain.
+
+// Chunks are compared positionally, so a change that shifts the tail of an
+// array marks all chunks after the shift as changed.  For the intended use
+// (periodic checkpoints of a slowly-changing matrix) most chunks are
+// identical in place and are skipped, avoiding both their compression time
+// and their space in the blob.
+
+// The delta blob is decoded by GB_deserialize_delta, which requires the
+// matrix reconstructed from the base blob to supply the unchanged chunks.
+
+#include "GB.h"
+#include "GB_serialize.h"
+#include "GB_lz4.h"
+#include "GB_zstd.h"
+
+#define GB_FREE_ALL                                                         \
+{                                                                           \
+    for (int a = 0 ; a < 5 ; a++)                                           \
+    {                                                                       \
+        GB_FREE (&(Checks [a]), Checks_size [a]) ;                          \
+        GB_FREE (&(Schunks [a]), Schunks_size [a]) ;                        \
+        GB_serialize_free_blocks (&(Blocks [a]), Blocks_size [a],           \
+            nchunks [a]) ;                                                  \
+    }                                                                       \
+    GB_FREE (&blob, blob_size_allocated) ;                                  \
+}
+
+//------------------------------------------------------------------------------
+// GB_delta_array: checksum one array and compress its changed chunks
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_delta_array
+(
+    // output:
+    GB_blocks **Blocks_handle,          // Blocks: one per chunk
+    size_t *Blocks_size_handle,         // size of Blocks
+    uint64_t **Checks_handle,           // checksum of each chunk
+    size_t *Checks_size_handle,         // size of Checks
+    int64_t **Schunks_handle,           // cumulative compressed chunk sizes
+    size_t *Schunks_size_handle,        // size of Schunks
+    int32_t *nchunks_handle,            // # of chunks
+    size_t *compressed_size,            // total size of the changed chunks
+    // input:
+    GB_void *X,                         // input array of size len
+    int64_t len,                        // size of X, in bytes
+    const uint64_t *base_checks,        // base checksums, or NULL if no base
+    int32_t base_nchunks,               // # of chunks in the base array
+    int64_t base_len,                   // size of the base array, in bytes
+    int32_t algo,                       // compression algorithm
+    int32_t level,                      // compression level
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check for quick return
+    //--------------------------------------------------------------------------
+
+    GB_blocks *Blocks = NULL ;
+    uint64_t *Checks = NULL ;
+    int64_t *Schunks = NULL ;
+    size_t Blocks_size = 0, Checks_size = 0, Schunks_size = 0 ;
+
+    (*Blocks_handle) = NULL ;   (*Blocks_size_handle) = 0 ;
+    (*Checks_handle) = NULL ;   (*Checks_size_handle) = 0 ;
+    (*Schunks_handle) = NULL ;  (*Schunks_size_handle) = 0 ;
+    (*nchunks_handle) = 0 ;
+    (*compressed_size) = 0 ;
+    if (X == NULL || len == 0)
+    {
+        // input array is empty
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the chunk tables
+    //--------------------------------------------------------------------------
+
+    int64_t nchunks64 = GB_ICEIL (len, GB_DELTA_CHUNK) ;
+    ASSERT (nchunks64 < INT32_MAX) ;
+    int32_t nchunks = (int32_t) nchunks64 ;
+
+    Blocks = GB_CALLOC (nchunks, GB_blocks, &Blocks_size) ;
+    Checks = GB_MALLOC (nchunks, uint64_t, &Checks_size) ;
+    Schunks = GB_MALLOC (nchunks, int64_t, &Schunks_size) ;
+    if (Blocks == NULL || Checks == NULL || Schunks == NULL)
+    {
+        // out of memory
+        GB_FREE (&Checks, Checks_size) ;
+        GB_FREE (&Schunks, Schunks_size) ;
+        GB_serialize_free_blocks (&Blocks, Blocks_size, nchunks) ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine # of threads to use
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (len, chunk, nthreads_max) ;
+    nthreads = GB_IMIN (nthreads, nchunks) ;
+
+    //--------------------------------------------------------------------------
+    // checksum all chunks and compare them with the base
+    //--------------------------------------------------------------------------
+
+    int32_t chunkid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+    for (chunkid = 0 ; chunkid < nchunks ; chunkid++)
+    {
+        int64_t kstart = ((int64_t) chunkid) * GB_DELTA_CHUNK ;
+        int64_t chunklen = GB_IMIN (GB_DELTA_CHUNK, len - kstart) ;
+        Checks [chunkid] = GB_delta_checksum (X + kstart, chunklen) ;
+        // the chunk is unchanged if the base has the same chunk, with the
+        // same length and the same checksum; use Schunks as a scratch flag
+        bool unchanged = (base_checks != NULL && chunkid < base_nchunks
+            && chunklen == GB_IMIN (GB_DELTA_CHUNK,
+                base_len - kstart)
+            && Checks [chunkid] == base_checks [chunkid]) ;
+        Schunks [chunkid] = unchanged ? 0 : chunklen ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate a block for each changed chunk
+    //--------------------------------------------------------------------------
+
+    bool ok = true ;
+    for (chunkid = 0 ; chunkid < nchunks && ok ; chunkid++)
+    {
+        int64_t chunklen = Schunks [chunkid] ;
+        if (chunklen == 0)
+        {
+            // the chunk is unchanged; no block needed
+            continue ;
+        }
+        int64_t kstart = ((int64_t) chunkid) * GB_DELTA_CHUNK ;
+        size_t s ;
+        switch (algo)
+        {
+            case GxB_COMPRESSION_NONE :
+                // the chunk is held as a shallow pointer into X
+                Blocks [chunkid].p = X + kstart ;
+                Blocks [chunkid].p_size_allocated = 0 ;
+                continue ;
+            case GxB_COMPRESSION_LZ4 :
+            case GxB_COMPRESSION_LZ4HC :
+                s = (size_t) LZ4_compressBound ((int) chunklen) ;
+                break ;
+            default :
+            case GxB_COMPRESSION_ZSTD :
+                s = ZSTD_compressBound (chunklen) ;
+                break ;
+        }
+        size_t size_allocated = 0 ;
+        GB_void *p = GB_MALLOC (s, GB_void, &size_allocated) ;
+        ok = (p != NULL) ;
+        Blocks [chunkid].p = p ;
+        Blocks [chunkid].p_size_allocated = size_allocated ;
+    }
+
+    if (!ok)
+    {
+        // out of memory
+        GB_FREE (&Checks, Checks_size) ;
+        GB_FREE (&Schunks, Schunks_size) ;
+        GB_serialize_free_blocks (&Blocks, Blocks_size, nchunks) ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compress the changed chunks in parallel
+    //--------------------------------------------------------------------------
+
+    if (algo != GxB_COMPRESSION_NONE)
+    {
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic) \
+            reduction(&&:ok)
+        for (chunkid = 0 ; chunkid < nchunks ; chunkid++)
+        {
+            int64_t chunklen = Schunks [chunkid] ;
+            if (chunklen == 0)
+            {
+                // the chunk is unchanged; nothing to compress
+                continue ;
+            }
+            int64_t kstart = ((int64_t) chunkid) * GB_DELTA_CHUNK ;
+            const char *src = (const char *) (X + kstart) ;
+            char *dst = (char *) Blocks [chunkid].p ;
+            size_t dsize = Blocks [chunkid].p_size_allocated ;
+            int dstCapacity = (int) GB_IMIN (dsize, INT32_MAX) ;
+            int s ;
+            size_t s64 ;
+            switch (algo)
+            {
+
+                case GxB_COMPRESSION_LZ4 :
+                    s = LZ4_compress_default (src, dst, (int) chunklen,
+                        dstCapacity) ;
+                    ok = ok && (s > 0) ;
+                    Schunks [chunkid] = (int64_t) s ;
+                    break ;
+
+                case GxB_COMPRESSION_LZ4HC :
+                    s = LZ4_compress_HC (src, dst, (int) chunklen,
+                        dstCapacity, level) ;
+                    ok = ok && (s > 0) ;
+                    Schunks [chunkid] = (int64_t) s ;
+                    break ;
+
+                default :
+                case GxB_COMPRESSION_ZSTD :
+                    s64 = ZSTD_compress (dst, dstCapacity, src, chunklen,
+                        level) ;
+                    ok = ok && (s64 <= dstCapacity) ;
+                    Schunks [chunkid] = (int64_t) s64 ;
+                    break ;
+            }
+        }
+
+        if (!ok)
+        {
+            // compression failure: this can "never" occur
+            GB_FREE (&Checks, Checks_size) ;
+            GB_FREE (&Schunks, Schunks_size) ;
+            GB_serialize_free_blocks (&Blocks, Blocks_size, nchunks) ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // compute the cumulative sum of the compressed chunks
+    //--------------------------------------------------------------------------
+
+    int64_t total = 0 ;
+    for (chunkid = 0 ; chunkid < nchunks ; chunkid++)
+    {
+        total += Schunks [chunkid] ;
+        Schunks [chunkid] = total ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    (*Blocks_handle) = Blocks ;     (*Blocks_size_handle) = Blocks_size ;
+    (*Checks_handle) = Checks ;     (*Checks_size_handle) = Checks_size ;
+    (*Schunks_handle) = Schunks ;   (*Schunks_size_handle) = Schunks_size ;
+    (*nchunks_handle) = nchunks ;
+    (*compressed_size) = total ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_serialize_delta
+//------------------------------------------------------------------------------
+
+GrB_Info GB_serialize_delta     // delta-serialize a matrix into a blob
+(
+    // output:
+    GB_void **blob_handle,          // delta blob, allocated on output
+    size_t *blob_size_handle,       // size of the delta blob
+    // input:
+    const GrB_Matrix A,             // matrix to serialize
+    const GB_void *base_blob,       // prior delta blob, or NULL for a full
+                                    // delta blob with all chunks present
+    size_t base_blob_size,          // size of the prior delta blob
+    int32_t method,                 // method to use
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (blob_handle != NULL) ;
+    ASSERT (blob_size_handle != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for serialize_delta", GB0) ;
+
+    (*blob_handle) = NULL ;
+    (*blob_size_handle) = 0 ;
+
+    GB_void *blob = NULL ;
+    size_t blob_size_allocated = 0 ;
+    GB_blocks *Blocks [5] = {NULL, NULL, NULL, NULL, NULL} ;
+    uint64_t *Checks [5] = {NULL, NULL, NULL, NULL, NULL} ;
+    int64_t *Schunks [5] = {NULL, NULL, NULL, NULL, NULL} ;
+    size_t Blocks_size [5] = {0, 0, 0, 0, 0} ;
+    size_t Checks_size [5] = {0, 0, 0, 0, 0} ;
+    size_t Schunks_size [5] = {0, 0, 0, 0, 0} ;
+    int32_t nchunks [5] = {0, 0, 0, 0, 0} ;
+    size_t compressed [5] = {0, 0, 0, 0, 0} ;
+
+    //--------------------------------------------------------------------------
+    // ensure all pending work is finished
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_wait (A, "A to serialize", Werk)) ;
+    ASSERT (A->nvec_nonempty >= 0) ;
+
+    //--------------------------------------------------------------------------
+    // parse the method
+    //--------------------------------------------------------------------------
+
+    int32_t algo, level ;
+    GB_serialize_method (&algo, &level, method) ;
+    if (algo == GxB_COMPRESSION_AUTO)
+    {
+        // AUTO is not supported for delta blobs; use the default instead
+        algo = GxB_COMPRESSION_ZSTD ;
+        level = 1 ;
+    }
+    method = algo + level ;
+
+    //--------------------------------------------------------------------------
+    // get the content of the matrix
+    //--------------------------------------------------------------------------
+
+    int32_t version = GxB_IMPLEMENTATION ;
+    int64_t vlen = A->vlen ;
+    int64_t vdim = A->vdim ;
+    int64_t nvec = A->nvec ;
+    int64_t nvals = A->nvals ;
+    int64_t nvec_nonempty = A->nvec_nonempty ;
+    int32_t sparsity = GB_sparsity (A) ;
+    bool iso = A->iso ;
+    float hyper_switch = A->hyper_switch ;
+    float bitmap_switch = A->bitmap_switch ;
+    int32_t sparsity_control = A->sparsity_control ;
+    GrB_Type atype = A->type ;
+    int64_t typesize = atype->size ;
+    int32_t typecode = (int32_t) (atype->code) ;
+    int64_t anz = GB_nnz (A) ;
+    int64_t anz_held = GB_nnz_held (A) ;
+
+    // determine the uncompressed sizes of Ap, Ah, Ab, Ai, and Ax
+    int64_t Ap_len = 0 ;
+    int64_t Ah_len = 0 ;
+    int64_t Ab_len = 0 ;
+    int64_t Ai_len = 0 ;
+    int64_t Ax_len = 0 ;
+    switch (sparsity)
+    {
+        case GxB_HYPERSPARSE :
+            Ah_len = sizeof (GrB_Index) * nvec ;
+            // fall through to the sparse case
+        case GxB_SPARSE :
+            Ap_len = sizeof (GrB_Index) * (nvec+1) ;
+            Ai_len = sizeof (GrB_Index) * anz ;
+            Ax_len = typesize * (iso ? 1 : anz) ;
+            break ;
+        case GxB_BITMAP :
+            Ab_len = sizeof (int8_t) * anz_held ;
+            // fall through to the full case
+        case GxB_FULL :
+            Ax_len = typesize * (iso ? 1 : anz_held) ;
+            break ;
+        default: ;
+    }
+
+    GB_void *Arrays [5] = {(GB_void *) A->p, (GB_void *) A->h,
+        (GB_void *) A->b, (GB_void *) A->i, (GB_void *) A->x} ;
+    int64_t Alens [5] = {Ap_len, Ah_len, Ab_len, Ai_len, Ax_len} ;
+
+    //--------------------------------------------------------------------------
+    // locate the checksum tables in the base blob, if present
+    //--------------------------------------------------------------------------
+
+    const uint64_t *base_checks [5] = {NULL, NULL, NULL, NULL, NULL} ;
+    int32_t base_nchunks [5] = {0, 0, 0, 0, 0} ;
+    int64_t base_lens [5] = {0, 0, 0, 0, 0} ;
+
+    if (base_blob != NULL)
+    {
+        if (base_blob_size < sizeof (uint64_t) + GB_BLOB_HEADER_SIZE)
+        {
+            // base blob is invalid
+            return (GrB_INVALID_OBJECT) ;
+        }
+        size_t s = 0 ;
+        const GB_void *blob = base_blob ;       // for GB_BLOB_READ
+        GB_BLOB_READ (base_magic, uint64_t) ;
+        GB_BLOB_READ (base_size, uint64_t) ;
+        GB_BLOB_READ (base_typecode, int32_t) ;
+        if (base_magic != GB_DELTA_MAGIC
+            || base_size != (uint64_t) base_blob_size
+            || base_typecode != typecode)
+        {
+            // the base is not a delta blob, or does not match A
+            return (GrB_INVALID_OBJECT) ;
+        }
+        // skip the rest of the scalar header, up to A[phbix]_len
+        s = 2 * sizeof (uint64_t)               // magic and blob size
+            + 2 * sizeof (int32_t)              // typecode and version
+            + 6 * sizeof (int64_t) ;            // vlen through typesize
+        GB_BLOB_READ (base_Ap_len, int64_t) ;
+        GB_BLOB_READ (base_Ah_len, int64_t) ;
+        GB_BLOB_READ (base_Ab_len, int64_t) ;
+        GB_BLOB_READ (base_Ai_len, int64_t) ;
+        GB_BLOB_READ (base_Ax_len, int64_t) ;
+        // skip the switch and sparsity settings of the base
+        s += 2 * sizeof (float) + 2 * sizeof (int32_t) ;
+        int32_t base_nb [5] ;
+        for (int a = 0 ; a < 5 ; a++)
+        {
+            GB_BLOB_READ (nb, int32_t) ;
+            base_nb [a] = nb ;
+            s += sizeof (int32_t) ;             // skip the method
+        }
+        if (base_typecode == GB_UDT_code)
+        {
+            s += GxB_MAX_NAME_LEN ;
+        }
+        base_lens [0] = base_Ap_len ;
+        base_lens [1] = base_Ah_len ;
+        base_lens [2] = base_Ab_len ;
+        base_lens [3] = base_Ai_len ;
+        base_lens [4] = base_Ax_len ;
+        for (int a = 0 ; a < 5 ; a++)
+        {
+            // the checksum table of array a, followed by its chunk sizes
+            if (s + base_nb [a] * 2 * sizeof (uint64_t) > base_blob_size)
+            {
+                // base blob is invalid
+                return (GrB_INVALID_OBJECT) ;
+            }
+            base_checks [a] = (const uint64_t *) (base_blob + s) ;
+            base_nchunks [a] = base_nb [a] ;
+            s += base_nb [a] * 2 * sizeof (uint64_t) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // checksum each array and compress its changed chunks
+    //--------------------------------------------------------------------------
+
+    for (int a = 0 ; a < 5 ; a++)
+    {
+        GB_OK (GB_delta_array (&(Blocks [a]), &(Blocks_size [a]),
+            &(Checks [a]), &(Checks_size [a]),
+            &(Schunks [a]), &(Schunks_size [a]),
+            &(nchunks [a]), &(compressed [a]),
+            Arrays [a], Alens [a],
+            base_checks [a], base_nchunks [a], base_lens [a],
+            algo, level, Werk)) ;
+    }
+
+    int64_t nchanged = 0, nchunks_total = 0 ;
+    for (int a = 0 ; a < 5 ; a++)
+    {
+        nchunks_total += nchunks [a] ;
+        int64_t slast = 0 ;
+        for (int32_t k = 0 ; k < nchunks [a] ; k++)
+        {
+            if (Schunks [a][k] > slast) nchanged++ ;
+            slast = Schunks [a][k] ;
+        }
+    }
+    GBURBLE ("(delta: %g of %g chunks changed) ",
+        (double) nchanged, (double) nchunks_total) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the delta blob
+    //--------------------------------------------------------------------------
+
+    size_t blob_size_required =
+        sizeof (uint64_t)                   // magic
+        + GB_BLOB_HEADER_SIZE
+        + ((typecode == GB_UDT_code) ? GxB_MAX_NAME_LEN : 0) ;
+    for (int a = 0 ; a < 5 ; a++)
+    {
+        // checksum and chunk-size tables, plus the changed chunks
+        blob_size_required += nchunks [a] * 2 * sizeof (uint64_t) ;
+        blob_size_required += compressed [a] ;
+    }
+
+    blob = GB_MALLOC (blob_size_required, GB_void, &blob_size_allocated) ;
+    if (blob == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // write the header and type_name into the blob
+    //--------------------------------------------------------------------------
+
+    size_t s = 0 ;
+    int32_t sparsity_iso_csc = (4 * sparsity) + (iso ? 2 : 0) +
+        (A->is_csc ? 1 : 0) ;
+
+    uint64_t magic = GB_DELTA_MAGIC ;
+    GB_BLOB_WRITE (magic, uint64_t) ;
+    uint64_t blob_size_required64 = (uint64_t) blob_size_required ;
+    GB_BLOB_WRITE (blob_size_required64, uint64_t) ;
+    GB_BLOB_WRITE (typecode, int32_t) ;
+    GB_BLOB_WRITE (version, int32_t) ;
+    GB_BLOB_WRITE (vlen, int64_t) ;
+    GB_BLOB_WRITE (vdim, int64_t) ;
+    GB_BLOB_WRITE (nvec, int64_t) ;
+    GB_BLOB_WRITE (nvec_nonempty, int64_t) ;
+    GB_BLOB_WRITE (nvals, int64_t) ;
+    GB_BLOB_WRITE (typesize, int64_t) ;
+    GB_BLOB_WRITE (Ap_len, int64_t) ;
+    GB_BLOB_WRITE (Ah_len, int64_t) ;
+    GB_BLOB_WRITE (Ab_len, int64_t) ;
+    GB_BLOB_WRITE (Ai_len, int64_t) ;
+    GB_BLOB_WRITE (Ax_len, int64_t) ;
+    GB_BLOB_WRITE (hyper_switch, float) ;
+    GB_BLOB_WRITE (bitmap_switch, float) ;
+    GB_BLOB_WRITE (sparsity_control, int32_t) ;
+    GB_BLOB_WRITE (sparsity_iso_csc, int32_t);
+    for (int a = 0 ; a < 5 ; a++)
+    {
+        GB_BLOB_WRITE (nchunks [a], int32_t) ;
+        GB_BLOB_WRITE (method, int32_t) ;
+    }
+
+    if (typecode == GB_UDT_code)
+    {
+        // only copy the type_name for user-defined types
+        memset (blob + s, 0, GxB_MAX_NAME_LEN) ;
+        #if GB_COMPILER_GCC
+        #if (__GNUC__ > 5)
+        #pragma GCC diagnostic ignored "-Wstringop-truncation"
+        #endif
+        #endif
+        strncpy ((char *) (blob + s), atype->name, GxB_MAX_NAME_LEN-1) ;
+        s += GxB_MAX_NAME_LEN ;
+    }
+
+    //--------------------------------------------------------------------------
+    // write the chunk tables into the blob
+    //--------------------------------------------------------------------------
+
+    for (int a = 0 ; a < 5 ; a++)
+    {
+        if (nchunks [a] > 0)
+        {
+            memcpy (blob + s, Checks [a], nchunks [a] * sizeof (uint64_t)) ;
+            s += nchunks [a] * sizeof (uint64_t) ;
+            memcpy (blob + s, Schunks [a], nchunks [a] * sizeof (int64_t)) ;
+            s += nchunks [a] * sizeof (int64_t) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // write the changed chunks into the blob
+    //--------------------------------------------------------------------------
+
+    for (int a = 0 ; a < 5 ; a++)
+    {
+        int64_t slast = 0 ;
+        for (int32_t k = 0 ; k < nchunks [a] ; k++)
+        {
+            int64_t csize = Schunks [a][k] - slast ;
+            slast = Schunks [a][k] ;
+            if (csize > 0)
+            {
+                memcpy (blob + s, Blocks [a][k].p, csize) ;
+                s += csize ;
+            }
+        }
+    }
+
+    ASSERT (s == blob_size_required) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    for (int a = 0 ; a < 5 ; a++)
+    {
+        GB_FREE (&(Checks [a]), Checks_size [a]) ;
+        GB_FREE (&(Schunks [a]), Schunks_size [a]) ;
+        GB_serialize_free_blocks (&(Blocks [a]), Blocks_size [a],
+            nchunks [a]) ;
+    }
+
+    // giving the blob to the user; remove it from the list of malloc'd blocks
+    #ifdef GB_MEMDUMP
+    printf ("removing delta blob %p size %ld from memtable\n", blob, // MEMDUMP
+        blob_size_allocated) ;
+    #endif
+    GB_Global_memtable_remove (blob) ;
+    (*blob_handle) = blob ;
+    (*blob_size_handle) = blob_size_required ;
+    return (GrB_SUCCESS) ;
+}
+
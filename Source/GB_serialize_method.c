@@ -28,6 +28,13 @@ void GB_serialize_method
         return ;
     }
 
+    if (method >= GxB_COMPRESSION_CHECKSUM)
+    { 
+        // the per-block checksum flag is handled by the caller; parse the
+        // underlying compression method
+        method -= GxB_COMPRESSION_CHECKSUM ;
+    }
+
     // Determine the algorithm and level.  Lower levels give faster compression
     // time but not as good of compression.  Higher levels give more compact
     // compressions, at the cost of higher run times.  For all methods: a level
@@ -62,6 +69,12 @@ void GB_serialize_method
         case GxB_COMPRESSION_ZSTD :     // ZSTD: level 1 to 19; default 1.
             if ((*level) <= 0 || (*level) > 19) (*level) = 1 ;
             break ;
+
+        case GxB_COMPRESSION_AUTO :     // per-array method selection
+            // resolved in GB_serialize_array, by trial compression of a few
+            // sampled regions of each array; the level setting is ignored
+            (*level) = 0 ;
+            break ;
     }
 }
 
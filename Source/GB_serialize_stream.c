@@ -0,0 +1,346 @@
+//------------------------------------------------------------------------------
+// GB_serialize_stream: compress and serialize a GrB_Matrix into a stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Identical in format to GB_serialize, except that the blob is never held in
+// memory.  Each piece of the blob (the header, the Sblocks arrays, and the
+// compressed blocks of each array) is handed to a user write callback in
+// order, and the compressed blocks of each array are freed as soon as they
+// have been written.  Concatenating all the pieces gives the same blob that
+// GB_serialize constructs, so the stream can be deserialized with
+// GrB_Matrix_deserialize or GxB_Matrix_deserialize.
+
+// The peak memory usage is the matrix plus its compressed copy; the
+// blob-sized output buffer of GB_serialize is never allocated.  The header
+// must record the compressed size of every array, so each array is fully
+// compressed before any of its blocks can be streamed out; bounding the
+// in-flight memory any further would require a change to the blob format.
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE (&Ap_Sblocks, Ap_Sblocks_size) ;    \
+    GB_FREE (&Ah_Sblocks, Ah_Sblocks_size) ;    \
+    GB_FREE (&Ab_Sblocks, Ab_Sblocks_size) ;    \
+    GB_FREE (&Ai_Sblocks, Ai_Sblocks_size) ;    \
+    GB_FREE (&Ax_Sblocks, Ax_Sblocks_size) ;    \
+    GB_serialize_free_blocks (&Ap_Blocks, Ap_Blocks_size, Ap_nblocks) ; \
+    GB_serialize_free_blocks (&Ah_Blocks, Ah_Blocks_size, Ah_nblocks) ; \
+    GB_serialize_free_blocks (&Ab_Blocks, Ab_Blocks_size, Ab_nblocks) ; \
+    GB_serialize_free_blocks (&Ai_Blocks, Ai_Blocks_size, Ai_nblocks) ; \
+    GB_serialize_free_blocks (&Ax_Blocks, Ax_Blocks_size, Ax_nblocks) ; \
+}
+
+//------------------------------------------------------------------------------
+// GB_stream_array: write the blocks of one array and free them
+//------------------------------------------------------------------------------
+
+static bool GB_stream_array     // true if successful, false on write failure
+(
+    GxB_serialize_callback write,   // user write callback
+    void *stream,                   // opaque stream handle passed to write
+    bool ok,                        // if false, skip the writes (free only)
+    GB_blocks **Blocks_handle,      // Blocks: freed when done
+    size_t Blocks_size,             // size of Blocks
+    int64_t *Sblocks,               // cumulative compressed sizes, size nblocks
+    int32_t nblocks                 // # of blocks
+)
+{
+    GB_blocks *Blocks = (*Blocks_handle) ;
+    for (int32_t blockid = 0 ; blockid < nblocks && ok ; blockid++)
+    {
+        // write the compressed block of size s_size to the stream
+        size_t s_start = (blockid == 0) ? 0 : Sblocks [blockid-1] ;
+        size_t s_size  = Sblocks [blockid] - s_start ;
+        ok = write (stream, Blocks [blockid].p, s_size) ;
+    }
+    // free the blocks; they are no longer needed once written
+    GB_serialize_free_blocks (Blocks_handle, Blocks_size, nblocks) ;
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_serialize_stream
+//------------------------------------------------------------------------------
+
+GrB_Info GB_serialize_stream    // serialize a matrix into a stream
+(
+    // output:
+    size_t *blob_size_handle,       // # of bytes written to the stream
+    // input:
+    GxB_serialize_callback write,   // user write callback
+    void *stream,                   // opaque stream handle passed to write
+    const GrB_Matrix A,             // matrix to serialize
+    int32_t method,                 // method to use
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (blob_size_handle != NULL) ;
+    ASSERT (write != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for serialize_stream", GB0) ;
+
+    (*blob_size_handle) = 0 ;
+
+    GB_blocks *Ap_Blocks = NULL ; size_t Ap_Blocks_size = 0 ;
+    GB_blocks *Ah_Blocks = NULL ; size_t Ah_Blocks_size = 0 ;
+    GB_blocks *Ab_Blocks = NULL ; size_t Ab_Blocks_size = 0 ;
+    GB_blocks *Ai_Blocks = NULL ; size_t Ai_Blocks_size = 0 ;
+    GB_blocks *Ax_Blocks = NULL ; size_t Ax_Blocks_size = 0 ;
+    int64_t *Ap_Sblocks = NULL  ; size_t Ap_Sblocks_size = 0 ;
+    int64_t *Ah_Sblocks = NULL  ; size_t Ah_Sblocks_size = 0 ;
+    int64_t *Ab_Sblocks = NULL  ; size_t Ab_Sblocks_size = 0 ;
+    int64_t *Ai_Sblocks = NULL  ; size_t Ai_Sblocks_size = 0 ;
+    int64_t *Ax_Sblocks = NULL  ; size_t Ax_Sblocks_size = 0 ;
+    int32_t Ap_nblocks = 0      ; size_t Ap_compressed_size = 0 ;
+    int32_t Ah_nblocks = 0      ; size_t Ah_compressed_size = 0 ;
+    int32_t Ab_nblocks = 0      ; size_t Ab_compressed_size = 0 ;
+    int32_t Ai_nblocks = 0      ; size_t Ai_compressed_size = 0 ;
+    int32_t Ax_nblocks = 0      ; size_t Ax_compressed_size = 0 ;
+
+    //--------------------------------------------------------------------------
+    // ensure all pending work is finished
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_wait (A, "A to serialize", Werk)) ;
+    ASSERT (A->nvec_nonempty >= 0) ;
+
+    //--------------------------------------------------------------------------
+    // parse the method
+    //--------------------------------------------------------------------------
+
+    int32_t algo, level ;
+    bool checksum = (method >= GxB_COMPRESSION_CHECKSUM) ;
+    GB_serialize_method (&algo, &level, method) ;
+    method = algo + level ;
+    if (checksum && algo != GxB_COMPRESSION_NONE)
+    { 
+        // append an xxHash64 digest to each compressed block
+        method += GxB_COMPRESSION_CHECKSUM ;
+    }
+    GBURBLE ("(compression: %s%s%s%s%s:%d%s) ",
+        (algo == GxB_COMPRESSION_NONE ) ? "none" : "",
+        (algo == GxB_COMPRESSION_LZ4  ) ? "LZ4" : "",
+        (algo == GxB_COMPRESSION_LZ4HC) ? "LZ4HC" : "",
+        (algo == GxB_COMPRESSION_ZSTD ) ? "ZSTD" : "",
+        (algo == GxB_COMPRESSION_AUTO ) ? "auto" : "",
+        level, checksum ? "+checksum" : "") ;
+
+    //--------------------------------------------------------------------------
+    // get the content of the matrix
+    //--------------------------------------------------------------------------
+
+    int32_t version = GxB_IMPLEMENTATION ;
+    int64_t vlen = A->vlen ;
+    int64_t vdim = A->vdim ;
+    int64_t nvec = A->nvec ;
+    int64_t nvals = A->nvals ;
+    int64_t nvec_nonempty = A->nvec_nonempty ;
+    int32_t sparsity = GB_sparsity (A) ;
+    bool iso = A->iso ;
+    float hyper_switch = A->hyper_switch ;
+    float bitmap_switch = A->bitmap_switch ;
+    int32_t sparsity_control = A->sparsity_control ;
+    // the matrix has no pending work
+    ASSERT (A->Pending == NULL) ;
+    ASSERT (A->nzombies == 0) ;
+    ASSERT (!A->jumbled) ;
+    GrB_Type atype = A->type ;
+    int64_t typesize = atype->size ;
+    int32_t typecode = (int32_t) (atype->code) ;
+    int64_t anz = GB_nnz (A) ;
+    int64_t anz_held = GB_nnz_held (A) ;
+
+    // determine the uncompressed sizes of Ap, Ah, Ab, Ai, and Ax
+    int64_t Ap_len = 0 ;
+    int64_t Ah_len = 0 ;
+    int64_t Ab_len = 0 ;
+    int64_t Ai_len = 0 ;
+    int64_t Ax_len = 0 ;
+    switch (sparsity)
+    {
+        case GxB_HYPERSPARSE :
+            Ah_len = sizeof (GrB_Index) * nvec ;
+            // fall through to the sparse case
+        case GxB_SPARSE :
+            Ap_len = sizeof (GrB_Index) * (nvec+1) ;
+            Ai_len = sizeof (GrB_Index) * anz ;
+            Ax_len = typesize * (iso ? 1 : anz) ;
+            break ;
+        case GxB_BITMAP :
+            Ab_len = sizeof (int8_t) * anz_held ;
+            // fall through to the full case
+        case GxB_FULL :
+            Ax_len = typesize * (iso ? 1 : anz_held) ;
+            break ;
+        default: ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compress each array (Ap, Ah, Ab, Ai, and Ax)
+    //--------------------------------------------------------------------------
+
+    int32_t Ap_method, Ah_method, Ab_method, Ai_method, Ax_method ;
+
+    GB_OK (GB_serialize_array (&Ap_Blocks, &Ap_Blocks_size,
+        &Ap_Sblocks, &Ap_Sblocks_size, &Ap_nblocks, &Ap_method,
+        &Ap_compressed_size, false,
+        (GB_void *) A->p, Ap_len, method, algo, level, Werk)) ;
+
+    GB_OK (GB_serialize_array (&Ah_Blocks, &Ah_Blocks_size,
+        &Ah_Sblocks, &Ah_Sblocks_size, &Ah_nblocks, &Ah_method,
+        &Ah_compressed_size, false,
+        (GB_void *) A->h, Ah_len, method, algo, level, Werk)) ;
+
+    GB_OK (GB_serialize_array (&Ab_Blocks, &Ab_Blocks_size,
+        &Ab_Sblocks, &Ab_Sblocks_size, &Ab_nblocks, &Ab_method,
+        &Ab_compressed_size, false,
+        (GB_void *) A->b, Ab_len, method, algo, level, Werk)) ;
+
+    GB_OK (GB_serialize_array (&Ai_Blocks, &Ai_Blocks_size,
+        &Ai_Sblocks, &Ai_Sblocks_size, &Ai_nblocks, &Ai_method,
+        &Ai_compressed_size, false,
+        (GB_void *) A->i, Ai_len, method, algo, level, Werk)) ;
+
+    GB_OK (GB_serialize_array (&Ax_Blocks, &Ax_Blocks_size,
+        &Ax_Sblocks, &Ax_Sblocks_size, &Ax_nblocks, &Ax_method,
+        &Ax_compressed_size, false,
+        (GB_void *) A->x, Ax_len, method, algo, level, Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // determine the size of the blob
+    //--------------------------------------------------------------------------
+
+    size_t blob_size_required =
+        // header information
+        GB_BLOB_HEADER_SIZE
+        // Sblocks for each array
+        + Ap_nblocks * sizeof (int64_t)     // Ap_Sblocks [1:Ap_nblocks]
+        + Ah_nblocks * sizeof (int64_t)     // Ah_Sblocks [1:Ah_nblocks]
+        + Ab_nblocks * sizeof (int64_t)     // Ab_Sblocks [1:Ab_nblocks]
+        + Ai_nblocks * sizeof (int64_t)     // Ai_Sblocks [1:Ai_nblocks]
+        + Ax_nblocks * sizeof (int64_t)     // Ax_Sblocks [1:Ax_nblocks]
+        // type_name for user-defined types
+        + ((typecode == GB_UDT_code) ? GxB_MAX_NAME_LEN : 0)
+        // size of compressed arrays Ap, Ah, Ab, Ai, and Ax in the blob
+        + Ap_compressed_size
+        + Ah_compressed_size
+        + Ab_compressed_size
+        + Ai_compressed_size
+        + Ax_compressed_size ;
+
+    //--------------------------------------------------------------------------
+    // write the header, type_name, and Sblocks into a small buffer
+    //--------------------------------------------------------------------------
+
+    // 160 bytes, plus 128 bytes for user-defined types, plus the five
+    // Sblocks arrays; everything in the blob except the compressed blocks
+
+    GB_void header [GB_BLOB_HEADER_SIZE + GxB_MAX_NAME_LEN] ;
+    GB_void *blob = header ;
+    size_t s = 0 ;
+    int32_t sparsity_iso_csc = (4 * sparsity) + (iso ? 2 : 0) +
+        (A->is_csc ? 1 : 0) ;
+
+    // size_t is 32 bits if GraphBLAS is compiled in ILP32 mode,
+    // so write a 64-bit blob size, regardless of the size of size_t
+    uint64_t blob_size_required64 = (uint64_t) blob_size_required ;
+    GB_BLOB_WRITE (blob_size_required64, uint64_t) ;
+
+    GB_BLOB_WRITE (typecode, int32_t) ;
+    GB_BLOB_WRITE (version, int32_t) ;
+    GB_BLOB_WRITE (vlen, int64_t) ;
+    GB_BLOB_WRITE (vdim, int64_t) ;
+    GB_BLOB_WRITE (nvec, int64_t) ;
+    GB_BLOB_WRITE (nvec_nonempty, int64_t) ;
+    GB_BLOB_WRITE (nvals, int64_t) ;
+    GB_BLOB_WRITE (typesize, int64_t) ;
+    GB_BLOB_WRITE (Ap_len, int64_t) ;
+    GB_BLOB_WRITE (Ah_len, int64_t) ;
+    GB_BLOB_WRITE (Ab_len, int64_t) ;
+    GB_BLOB_WRITE (Ai_len, int64_t) ;
+    GB_BLOB_WRITE (Ax_len, int64_t) ;
+    GB_BLOB_WRITE (hyper_switch, float) ;
+    GB_BLOB_WRITE (bitmap_switch, float) ;
+    GB_BLOB_WRITE (sparsity_control, int32_t) ;
+    GB_BLOB_WRITE (sparsity_iso_csc, int32_t);
+    GB_BLOB_WRITE (Ap_nblocks, int32_t) ; GB_BLOB_WRITE (Ap_method, int32_t) ;
+    GB_BLOB_WRITE (Ah_nblocks, int32_t) ; GB_BLOB_WRITE (Ah_method, int32_t) ;
+    GB_BLOB_WRITE (Ab_nblocks, int32_t) ; GB_BLOB_WRITE (Ab_method, int32_t) ;
+    GB_BLOB_WRITE (Ai_nblocks, int32_t) ; GB_BLOB_WRITE (Ai_method, int32_t) ;
+    GB_BLOB_WRITE (Ax_nblocks, int32_t) ; GB_BLOB_WRITE (Ax_method, int32_t) ;
+
+    // 128 bytes, if present
+    if (typecode == GB_UDT_code)
+    {
+        // only copy the type_name for user-defined types
+        memset (blob + s, 0, GxB_MAX_NAME_LEN) ;
+        #if GB_COMPILER_GCC
+        #if (__GNUC__ > 5)
+        #pragma GCC diagnostic ignored "-Wstringop-truncation"
+        #endif
+        #endif
+        strncpy ((char *) (blob + s), atype->name, GxB_MAX_NAME_LEN-1) ;
+        s += GxB_MAX_NAME_LEN ;
+    }
+
+    //--------------------------------------------------------------------------
+    // write the header and the Sblocks to the stream
+    //--------------------------------------------------------------------------
+
+    bool ok = write (stream, header, s) ;
+
+    // 8 * (# blocks for Ap, Ah, Ab, Ai, Ax)
+    #define GB_STREAM_WRITES(S,n)                                   \
+        if (ok && n > 0)                                            \
+        {                                                           \
+            ok = write (stream, S + 1, (n) * sizeof (int64_t)) ;    \
+        }
+    GB_STREAM_WRITES (Ap_Sblocks, Ap_nblocks) ;
+    GB_STREAM_WRITES (Ah_Sblocks, Ah_nblocks) ;
+    GB_STREAM_WRITES (Ab_Sblocks, Ab_nblocks) ;
+    GB_STREAM_WRITES (Ai_Sblocks, Ai_nblocks) ;
+    GB_STREAM_WRITES (Ax_Sblocks, Ax_nblocks) ;
+
+    //--------------------------------------------------------------------------
+    // write the compressed blocks to the stream, freeing them as they go
+    //--------------------------------------------------------------------------
+
+    ok = GB_stream_array (write, stream, ok,
+        &Ap_Blocks, Ap_Blocks_size, Ap_Sblocks+1, Ap_nblocks) ;
+    ok = GB_stream_array (write, stream, ok,
+        &Ah_Blocks, Ah_Blocks_size, Ah_Sblocks+1, Ah_nblocks) ;
+    ok = GB_stream_array (write, stream, ok,
+        &Ab_Blocks, Ab_Blocks_size, Ab_Sblocks+1, Ab_nblocks) ;
+    ok = GB_stream_array (write, stream, ok,
+        &Ai_Blocks, Ai_Blocks_size, Ai_Sblocks+1, Ai_nblocks) ;
+    ok = GB_stream_array (write, stream, ok,
+        &Ax_Blocks, Ax_Blocks_size, Ax_Sblocks+1, Ax_nblocks) ;
+
+    GB_FREE_ALL ;
+    if (!ok)
+    {
+        // the write callback failed; the stream contents are undefined
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    (*blob_size_handle) = blob_size_required ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -54,6 +54,9 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
     ASSERT (C != NULL) ;
     GB_RETURN_IF_NULL (scalar) ;
 
+    // C is modified even when an existing entry merely changes value
+    GB_fingerprint_clear (C) ;
+
     if (row >= GB_NROWS (C))
     { 
         GB_ERROR (GrB_INVALID_INDEX,
@@ -94,6 +97,12 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
     ASSERT (GB_PENDING_OK (C)) ;
     ASSERT (GB_ZOMBIES_OK (C)) ;
 
+    // apply any deferred unary op before a value of C is written in place,
+    // and if any array of C is shared with a duplicate or snapshot, replace
+    // it with a private copy
+    GB_OK (GB_materialize (C, Werk)) ;
+    GB_OK (GB_unshare (C)) ;
+
     //--------------------------------------------------------------------------
     // sort C if needed; do not assemble pending tuples or kill zombies yet
     //--------------------------------------------------------------------------
@@ -339,6 +348,9 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
             // set the entry in the C bitmap
             C->nvals += (cb == 0) ;
             C->b [pleft] = 1 ;
+            // the pattern of C has changed
+            GB_degree_free (C) ;
+            GB_lookup_cache_free (C) ;
         }
 
         return (GrB_SUCCESS) ;
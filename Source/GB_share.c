@@ -0,0 +1,160 @@
+//------------------------------------------------------------------------------
+// GB_share.c: shared (copy-on-write) memory blocks
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_snapshot creates an O(1) view of a matrix that shares its
+// arrays.  Each shared array is recorded here with a count of its extra
+// owners.  GB_free_memory consults the registry: freeing a shared block
+// merely drops one owner, and only the last owner actually releases the
+// memory.  GB_realloc_memory likewise refuses to grow a shared block in
+// place, and instead allocates a fresh block and copies it, which is what
+// gives the snapshot its copy-on-write behavior: whichever side replaces
+// its arrays gets new ones, and the other side keeps the originals.
+
+// The registry is guarded by a critical section.  Sharing is rare (a few
+// blocks per snapshot) and the common case of no shared blocks at all is a
+// single load, so the critical section costs nothing on the normal path.
+
+#include "GB.h"
+
+//------------------------------------------------------------------------------
+// the share registry
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    void *p ;               // the shared block
+    int64_t nextra ;        // # of owners beyond the first
+}
+GB_share_entry ;
+
+static GB_share_entry GB_share_table [GB_SHARE_MAX] ;
+static int GB_share_nblocks = 0 ;
+
+//------------------------------------------------------------------------------
+// GB_share_add: record one additional owner of a block
+//------------------------------------------------------------------------------
+
+bool GB_share_add       // true if successful, false if the table is full
+(
+    void *p             // block gaining one additional owner
+)
+{
+    ASSERT (p != NULL) ;
+    bool ok = false ;
+    #pragma omp critical(GB_share)
+    {
+        int k ;
+        for (k = 0 ; k < GB_share_nblocks ; k++)
+        {
+            if (GB_share_table [k].p == p)
+            {
+                // the block is already shared; add one more owner
+                GB_share_table [k].nextra++ ;
+                ok = true ;
+                break ;
+            }
+        }
+        if (!ok && GB_share_nblocks < GB_SHARE_MAX)
+        {
+            // add the block to the registry, with one extra owner
+            GB_share_table [GB_share_nblocks].p = p ;
+            GB_share_table [GB_share_nblocks].nextra = 1 ;
+            GB_share_nblocks++ ;
+            ok = true ;
+        }
+    }
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_share_release: drop one owner of a block
+//------------------------------------------------------------------------------
+
+// Called by GB_free_memory for every block it frees.  If the block is in the
+// registry, one owner is dropped and the block must not be freed, since at
+// least one other owner still holds it.  The last owner finds no entry, and
+// frees the block for real.
+
+bool GB_share_release   // true if the block is still owned elsewhere
+(
+    void *p             // block losing one of its owners
+)
+{
+    // quick return if no blocks are shared: a shared block is always
+    // registered before any owner can free it, so if the registry appears
+    // empty here, p cannot be a shared block
+    if (GB_share_nblocks == 0)
+    {
+        return (false) ;
+    }
+    bool found = false ;
+    #pragma omp critical(GB_share)
+    {
+        for (int k = 0 ; k < GB_share_nblocks ; k++)
+        {
+            if (GB_share_table [k].p == p)
+            {
+                found = true ;
+                if (--(GB_share_table [k].nextra) == 0)
+                {
+                    // only one owner remains; remove the registry entry so
+                    // that the final free releases the block for real
+                    GB_share_table [k] =
+                        GB_share_table [--GB_share_nblocks] ;
+                }
+                break ;
+            }
+        }
+    }
+    return (found) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_share_shared: query if a block has more than one owner
+//------------------------------------------------------------------------------
+
+bool GB_share_shared    // true if the block has more than one owner
+(
+    void *p             // block to query
+)
+{
+    if (GB_share_nblocks == 0)
+    {
+        return (false) ;
+    }
+    bool found = false ;
+    #pragma omp critical(GB_share)
+    {
+        for (int k = 0 ; k < GB_share_nblocks ; k++)
+        {
+            if (GB_share_table [k].p == p)
+            {
+                found = true ;
+                break ;
+            }
+        }
+    }
+    return (found) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_share_finalize: clear the share registry
+//------------------------------------------------------------------------------
+
+// Called by GrB_finalize.  Any remaining entries belong to matrices the user
+// application failed to free; the blocks themselves are not touched.
+
+void GB_share_finalize (void)
+{
+    #pragma omp critical(GB_share)
+    {
+        GB_share_nblocks = 0 ;
+    }
+}
+
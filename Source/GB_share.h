@@ -0,0 +1,44 @@
+//------------------------------------------------------------------------------
+// GB_share.h: definitions for shared (copy-on-write) memory blocks
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A registry of memory blocks co-owned by more than one matrix, used by
+// GxB_Matrix_snapshot.  Each entry counts the extra owners of a block: a
+// block is actually freed only by its last owner, so a matrix and its
+// snapshots can share the same arrays until one of them replaces its copy.
+
+#ifndef GB_SHARE_H
+#define GB_SHARE_H
+
+// maximum # of blocks that can be shared at any one time
+#define GB_SHARE_MAX 4096
+
+bool GB_share_add       // true if successful, false if the table is full
+(
+    void *p             // block gaining one additional owner
+) ;
+
+bool GB_share_release   // true if the block is still owned elsewhere
+(
+    void *p             // block losing one of its owners
+) ;
+
+bool GB_share_shared    // true if the block has more than one owner
+(
+    void *p             // block to query
+) ;
+
+void GB_share_finalize (void) ;     // clear the share registry
+
+GrB_Info GB_unshare     // ensure a matrix owns its arrays exclusively
+(
+    GrB_Matrix A        // matrix about to be modified in place
+) ;
+
+#endif
+
@@ -11,6 +11,7 @@
 
 #include "GB_sort.h"
 #include "GB_transpose.h"
+#include "GB_wait.h"
 #include "GB_ek_slice.h"
 
 //  macros:
@@ -215,6 +216,10 @@ GrB_Info GB_sort
     GrB_BinaryOp op,            // comparator for the sort
     GrB_Matrix A,               // matrix to sort
     const bool A_transpose,     // false: sort each row, true: sort each column
+    const int64_t klimit,       // max # of entries to keep in each vector
+                                // (INT64_MAX: keep all of them)
+    const bool keep_pattern,    // true: C keeps its original indices and no
+                                // permutation is built (P must be NULL)
     GB_Werk Werk
 )
 {
@@ -368,27 +373,27 @@ GrB_Info GB_sort
             switch (acode)
             {
                 case GB_BOOL_code : 
-                    GB_OK (GB(sort_matrix_ascend_BOOL   )(C, Werk)) ; break ;
+                    GB_OK (GB(sort_matrix_ascend_BOOL   )(C, klimit, Werk)) ; break ;
                 case GB_INT8_code : 
-                    GB_OK (GB(sort_matrix_ascend_INT8   )(C, Werk)) ; break ;
+                    GB_OK (GB(sort_matrix_ascend_INT8   )(C, klimit, Werk)) ; break ;
                 case GB_INT16_code : 
-                    GB_OK (GB(sort_matrix_ascend_INT16  )(C, Werk)) ; break ;
+                    GB_OK (GB(sort_matrix_ascend_INT16  )(C, klimit, Werk)) ; break ;
                 case GB_INT32_code : 
-                    GB_OK (GB(sort_matrix_ascend_INT32  )(C, Werk)) ; break ;
+                    GB_OK (GB(sort_matrix_ascend_INT32  )(C, klimit, Werk)) ; break ;
                 case GB_INT64_code : 
-                    GB_OK (GB(sort_matrix_ascend_INT64  )(C, Werk)) ; break ;
+                    GB_OK (GB(sort_matrix_ascend_INT64  )(C, klimit, Werk)) ; break ;
                 case GB_UINT8_code : 
-                    GB_OK (GB(sort_matrix_ascend_UINT8  )(C, Werk)) ; break ;
+                    GB_OK (GB(sort_matrix_ascend_UINT8  )(C, klimit, Werk)) ; break ;
                 case GB_UINT16_code : 
-                    GB_OK (GB(sort_matrix_ascend_UINT16 )(C, Werk)) ; break ;
+                    GB_OK (GB(sort_matrix_ascend_UINT16 )(C, klimit, Werk)) ; break ;
                 case GB_UINT32_code : 
-                    GB_OK (GB(sort_matrix_ascend_UINT32 )(C, Werk)) ; break ;
+                    GB_OK (GB(sort_matrix_ascend_UINT32 )(C, klimit, Werk)) ; break ;
                 case GB_UINT64_code : 
-                    GB_OK (GB(sort_matrix_ascend_UINT64 )(C, Werk)) ; break ;
+                    GB_OK (GB(sort_matrix_ascend_UINT64 )(C, klimit, Werk)) ; break ;
                 case GB_FP32_code : 
-                    GB_OK (GB(sort_matrix_ascend_FP32   )(C, Werk)) ; break ;
+                    GB_OK (GB(sort_matrix_ascend_FP32   )(C, klimit, Werk)) ; break ;
                 case GB_FP64_code : 
-                    GB_OK (GB(sort_matrix_ascend_FP64   )(C, Werk)) ; break ;
+                    GB_OK (GB(sort_matrix_ascend_FP64   )(C, klimit, Werk)) ; break ;
                 default:;
             }
         }
@@ -398,27 +403,27 @@ GrB_Info GB_sort
             switch (acode)
             {
                 case GB_BOOL_code : 
-                    GB_OK (GB(sort_matrix_descend_BOOL  )(C, Werk)) ; break ;
+                    GB_OK (GB(sort_matrix_descend_BOOL  )(C, klimit, Werk)) ; break ;
                 case GB_INT8_code : 
-                    GB_OK (GB(sort_matrix_descend_INT8  )(C, Werk)) ; break ;
+                    GB_OK (GB(sort_matrix_descend_INT8  )(C, klimit, Werk)) ; break ;
                 case GB_INT16_code : 
-                    GB_OK (GB(sort_matrix_descend_INT16 )(C, Werk)) ; break ;
+                    GB_OK (GB(sort_matrix_descend_INT16 )(C, klimit, Werk)) ; break ;
                 case GB_INT32_code : 
-                    GB_OK (GB(sort_matrix_descend_INT32 )(C, Werk)) ; break ;
+                    GB_OK (GB(sort_matrix_descend_INT32 )(C, klimit, Werk)) ; break ;
                 case GB_INT64_code : 
-                    GB_OK (GB(sort_matrix_descend_INT64 )(C, Werk)) ; break ;
+                    GB_OK (GB(sort_matrix_descend_INT64 )(C, klimit, Werk)) ; break ;
                 case GB_UINT8_code : 
-                    GB_OK (GB(sort_matrix_descend_UINT8 )(C, Werk)) ; break ;
+                    GB_OK (GB(sort_matrix_descend_UINT8 )(C, klimit, Werk)) ; break ;
                 case GB_UINT16_code : 
-                    GB_OK (GB(sort_matrix_descend_UINT16)(C, Werk)) ; break ;
+                    GB_OK (GB(sort_matrix_descend_UINT16)(C, klimit, Werk)) ; break ;
                 case GB_UINT32_code : 
-                    GB_OK (GB(sort_matrix_descend_UINT32)(C, Werk)) ; break ;
+                    GB_OK (GB(sort_matrix_descend_UINT32)(C, klimit, Werk)) ; break ;
                 case GB_UINT64_code : 
-                    GB_OK (GB(sort_matrix_descend_UINT64)(C, Werk)) ; break ;
+                    GB_OK (GB(sort_matrix_descend_UINT64)(C, klimit, Werk)) ; break ;
                 case GB_FP32_code : 
-                    GB_OK (GB(sort_matrix_descend_FP32  )(C, Werk)) ; break ;
+                    GB_OK (GB(sort_matrix_descend_FP32  )(C, klimit, Werk)) ; break ;
                 case GB_FP64_code : 
-                    GB_OK (GB(sort_matrix_descend_FP64  )(C, Werk)) ; break ;
+                    GB_OK (GB(sort_matrix_descend_FP64  )(C, klimit, Werk)) ; break ;
                 default:;
             }
         }
@@ -431,7 +436,107 @@ GrB_Info GB_sort
         // typecasting, user-defined types, or unconventional operators
         //----------------------------------------------------------------------
 
-        GB_OK (GB (sort_matrix_UDT) (C, op, Werk)) ;
+        GB_OK (GB (sort_matrix_UDT) (C, klimit, op, Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // truncate each vector of C to at most klimit entries
+    //--------------------------------------------------------------------------
+
+    if (klimit < GB_nnz (C))
+    {
+        // Each vector of C now has its (at most) klimit best entries first,
+        // in sorted order; discard the rest.  No vector becomes empty, since
+        // klimit >= 1, so C->h and C->nvec_nonempty do not change.
+        int64_t knvec = C->nvec ;
+        int64_t *restrict Kp = C->p ;
+        size_t csize = C->type->size ;
+        int64_t *restrict Tp = NULL ; size_t Tp_size = 0 ;
+        int64_t *restrict Tix = NULL ; size_t Tix_size = 0 ;
+        GB_void *restrict Tx = NULL ; size_t Tx_size = 0 ;
+        Tp = GB_MALLOC (C->plen+1, int64_t, &Tp_size) ;
+        if (Tp == NULL)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        int64_t tnz = 0 ;
+        for (int64_t k = 0 ; k < knvec ; k++)
+        { 
+            Tp [k] = tnz ;
+            tnz += GB_IMIN (Kp [k+1] - Kp [k], klimit) ;
+        }
+        Tp [knvec] = tnz ;
+        if (tnz == Kp [knvec])
+        { 
+            // no vector has more than klimit entries; nothing to discard
+            GB_FREE (&Tp, Tp_size) ;
+        }
+        else
+        {
+            // copy the surviving entries into a compacted pattern and values
+            Tix = GB_MALLOC (GB_IMAX (tnz, 1), int64_t, &Tix_size) ;
+            if (!C->iso)
+            { 
+                Tx = GB_MALLOC (GB_IMAX (tnz, 1) * csize, GB_void, &Tx_size) ;
+            }
+            if (Tix == NULL || (!C->iso && Tx == NULL))
+            { 
+                // out of memory
+                GB_FREE (&Tp, Tp_size) ;
+                GB_FREE (&Tix, Tix_size) ;
+                GB_FREE (&Tx, Tx_size) ;
+                GB_FREE_ALL ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+            int nth = GB_nthreads (tnz, chunk, nthreads_max) ;
+            const int64_t *restrict Ki = C->i ;
+            const GB_void *restrict Kx = (GB_void *) C->x ;
+            int64_t k ;
+            #pragma omp parallel for num_threads(nth) schedule(static)
+            for (k = 0 ; k < knvec ; k++)
+            {
+                int64_t len = Tp [k+1] - Tp [k] ;
+                memcpy (Tix + Tp [k], Ki + Kp [k], len * sizeof (int64_t)) ;
+                if (Tx != NULL)
+                { 
+                    memcpy (Tx + Tp [k] * csize, Kx + Kp [k] * csize,
+                        len * csize) ;
+                }
+            }
+            if (C->p != C->p_static)
+            { 
+                GB_FREE (&(C->p), C->p_size) ;
+            }
+            C->p = Tp ; C->p_size = Tp_size ;
+            GB_FREE (&(C->i), C->i_size) ;
+            C->i = Tix ; C->i_size = Tix_size ;
+            if (Tx != NULL)
+            { 
+                GB_FREE (&(C->x), C->x_size) ;
+                C->x = Tx ; C->x_size = Tx_size ;
+            }
+            C->nvals = tnz ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // keep the original pattern, if requested
+    //--------------------------------------------------------------------------
+
+    if (keep_pattern)
+    { 
+        // The entries of C keep their original indices (a top-k selection,
+        // not a sort): restore the index order within each vector, instead
+        // of constructing the sorted positions and the permutation P.
+        ASSERT (P == NULL && !C_is_NULL) ;
+        C->jumbled = true ;
+        GB_OK (GB_unjumble (C, Werk)) ;
+        GB_FREE_WORKSPACE ;
+        GB_OK (GB_conform (C, Werk)) ;
+        ASSERT_MATRIX_OK (C, "C output of GB_sort (top-k selection)", GB0) ;
+        return (GrB_SUCCESS) ;
     }
 
     //--------------------------------------------------------------------------
@@ -503,7 +608,22 @@ GrB_Info GB_sort
             // the values of C are not needed.  The indices of C become the
             // values of P, Cp becomes Pp, and Ch (if present) becomes Ph.
             P->x = C->i ; C->i = NULL ; P->x_size = C->i_size ;
-            P->p = C->p ; C->p = NULL ; P->p_size = C->p_size ;
+            if (C->p == C->p_static)
+            { 
+                // C->p is resident in the header of C; copy it into P
+                P->p = GB_MALLOC (C->plen+1, int64_t, &(P->p_size)) ;
+                if (P->p == NULL)
+                { 
+                    // out of memory
+                    GB_FREE_ALL ;
+                    return (GrB_OUT_OF_MEMORY) ;
+                }
+                memcpy (P->p, C->p, (C->plen+1) * sizeof (int64_t)) ;
+            }
+            else
+            { 
+                P->p = C->p ; C->p = NULL ; P->p_size = C->p_size ;
+            }
             P->h = C->h ; C->h = NULL ; P->h_size = C->h_size ;
             P->plen = C->plen ;
         }
@@ -19,6 +19,14 @@
 
 #define GB_BASECASE (64 * 1024)
 
+// Single long vectors above this size are sorted with the sample sort in
+// GB_sort_template.c rather than its mergesort; the splitters come from a
+// sorted sample of GB_SORT_OVERSAMPLE entries per bucket, with at most
+// GB_SORT_MAX_BUCKETS buckets.
+#define GB_SORT_SAMPLE_MIN (4 * 1024 * 1024)
+#define GB_SORT_OVERSAMPLE 32
+#define GB_SORT_MAX_BUCKETS 1024
+
 void GB_qsort_1b    // sort array A of size 2-by-n, using 1 key (A [0][])
 (
     int64_t *restrict A_0,      // size n array
@@ -104,6 +112,61 @@ GrB_Info GB_msort_3    // sort array A of size 3-by-n, using 3 keys (A [0:2][])
     int nthreads                // # of threads to use
 ) ;
 
+GrB_Info GB_radix_sort  // stable LSD radix sort of a 1-, 2-, or 3-by-n list
+(
+    int64_t *restrict A_0,      // size n array: primary key
+    int64_t *restrict A_1,      // size n array: 2nd key or payload, or NULL
+    int64_t *restrict A_2,      // size n array: payload, or NULL
+    const bool A_1_is_key,      // if true A_1 is a key, else a payload
+    const int64_t n,
+    const int64_t hi_0,         // exclusive upper bound on the A_0 keys
+    const int64_t hi_1,         // exclusive upper bound on the A_1 keys,
+                                // ignored if A_1 is NULL or a payload
+    int nthreads                // # of threads to use
+) ;
+
+// GB_radix_sort_worthwhile: select the radix sort over the mergesorts.  The
+// radix sort does one histogram+scatter pass over all n tuples per 8-bit
+// digit of the key range, so it only pays off when the list is large and the
+// keys span few digits; otherwise the GB_msort_* mergesorts are used.
+
+static inline bool GB_radix_sort_worthwhile
+(
+    const int64_t n,            // # of tuples to sort
+    const int64_t hi_0,         // exclusive upper bound on the primary keys
+    const int64_t hi_1          // exclusive upper bound on the 2nd keys, or
+                                // 1 if there is no 2nd key
+)
+{
+    int nbits = 0 ;
+    uint64_t h0 = (hi_0 <= 1) ? 0 : ((uint64_t) (hi_0 - 1)) ;
+    uint64_t h1 = (hi_1 <= 1) ? 0 : ((uint64_t) (hi_1 - 1)) ;
+    while (h0 > 0) { nbits += 8 ; h0 = h0 >> 8 ; }
+    while (h1 > 0) { nbits += 8 ; h1 = h1 >> 8 ; }
+    // with up to 6 digit passes the radix sort still beats the n log2(n)
+    // comparisons of the mergesort for n of one million tuples or more
+    return (n >= 16 * GB_BASECASE && nbits <= 48) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_qsort_depth: quicksort recursion-depth limit
+//------------------------------------------------------------------------------
+
+// 2*floor(log2(n)), about twice the expected depth for random pivots.  A
+// quicksort that exceeds it has been repeatedly unlucky with its pivots and
+// falls back to heapsort (see GB_qsort_template.c), bounding the worst case
+// at O(n log n).
+
+static inline int GB_qsort_depth (int64_t n)
+{
+    int depth = 0 ;
+    for ( ; n > 1 ; n = n >> 1)
+    { 
+        depth += 2 ;
+    }
+    return (depth) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_lt_1: sorting comparator function, one key
 //------------------------------------------------------------------------------
@@ -232,6 +295,10 @@ GrB_Info GB_sort
     GrB_BinaryOp op,            // comparator for the sort
     GrB_Matrix A,               // matrix to sort
     const bool A_transpose,     // false: sort each row, true: sort each column
+    const int64_t klimit,       // max # of entries to keep in each vector
+                                // (INT64_MAX: keep all of them)
+    const bool keep_pattern,    // true: C keeps its original indices and no
+                                // permutation is built (P must be NULL)
     GB_Werk Werk
 ) ;
 
@@ -41,6 +41,20 @@ int GB_sparsity_control     // revised sparsity_control
         sparsity_control = sparsity_control | GxB_SPARSE ;
     }
 
+    //--------------------------------------------------------------------------
+    // ensure matrices with a huge vector dimension stay hypersparse
+    //--------------------------------------------------------------------------
+
+    if (vdim > GB_HYPER_VDIM_LIMIT && (sparsity_control & GxB_SPARSE))
+    { 
+        // a matrix with a huge vector dimension cannot be held in sparse
+        // form, since its vector pointer array Ap of size vdim+1 could not be
+        // reasonably allocated.  If the sparsity_control allows for the
+        // sparse case, disable it and enable the hypersparse case instead.
+        sparsity_control = sparsity_control & (~GxB_SPARSE) ;
+        sparsity_control = sparsity_control | GxB_HYPERSPARSE ;
+    }
+
     //--------------------------------------------------------------------------
     // return revised sparsity_control
     //--------------------------------------------------------------------------
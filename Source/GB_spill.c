@@ -0,0 +1,185 @@
+//------------------------------------------------------------------------------
+// GB_spill.c: file-backed memory blocks for large intermediates
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// On memory-tight systems, a very large intermediate (the T matrix of
+// GB_accum_mask, or the Gustavson workspace of saxpy3, for example) can push
+// the process past its memory limit.  When GxB_SPILL_THRESHOLD is set,
+// memory blocks of at least that many bytes are backed by a mapping of an
+// unnamed temporary file instead of the heap, so the OS can page them to
+// disk under pressure: a graceful slowdown instead of a dead process.  A
+// file mapping is also used as a last resort when malloc fails outright.
+
+// The temporary file is created with tmpfile() (in the system temporary
+// directory), sized with ftruncate, mapped shared, and closed; the file
+// itself is already unlinked, so the space is reclaimed when the mapping is
+// removed, even if the process dies.  Spilled blocks are recorded in a small
+// registry so that GB_free_memory can recognize them by address and unmap
+// them; the registry is guarded by a critical section, which is cheap since
+// spilled blocks are rare and huge.
+
+// On platforms without POSIX mmap, spilling is disabled and these functions
+// are no-ops.
+
+// for ftruncate and fileno, when compiling with a strict -std= setting
+#if !defined ( _XOPEN_SOURCE )
+#define _XOPEN_SOURCE 600
+#endif
+
+#include "GB.h"
+
+#if defined ( __linux__ ) || defined ( __unix__ ) || defined ( __APPLE__ )
+#define GB_HAS_SPILL
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+//------------------------------------------------------------------------------
+// the spill registry
+//------------------------------------------------------------------------------
+
+#ifdef GB_HAS_SPILL
+
+typedef struct
+{
+    void *p ;               // the file-backed block
+    size_t size ;           // its size in bytes
+}
+GB_spill_entry ;
+
+static GB_spill_entry GB_spill_table [GB_SPILL_MAX] ;
+static int GB_spill_nblocks = 0 ;
+
+#endif
+
+//------------------------------------------------------------------------------
+// GB_spill_malloc: allocate a file-backed block
+//------------------------------------------------------------------------------
+
+void *GB_spill_malloc       // file-backed block, or NULL
+(
+    size_t size,            // # of bytes to allocate
+    bool force              // if true, ignore the spill threshold
+)
+{
+    #ifdef GB_HAS_SPILL
+    int64_t threshold = GB_Global_spill_threshold_get ( ) ;
+    if (threshold <= 0 || (!force && size < (size_t) threshold))
+    {
+        // spilling is disabled, or the block is too small to spill
+        return (NULL) ;
+    }
+    // create the temporary file; tmpfile unlinks it immediately
+    FILE *f = tmpfile ( ) ;
+    if (f == NULL)
+    {
+        return (NULL) ;
+    }
+    void *p = NULL ;
+    if (ftruncate (fileno (f), (off_t) size) == 0)
+    {
+        p = mmap (NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+            fileno (f), 0) ;
+        if (p == MAP_FAILED)
+        {
+            p = NULL ;
+        }
+    }
+    // the mapping keeps the file alive; the stream is no longer needed
+    fclose (f) ;
+    if (p != NULL)
+    {
+        // record the block in the registry
+        bool ok = false ;
+        #pragma omp critical(GB_spill)
+        {
+            if (GB_spill_nblocks < GB_SPILL_MAX)
+            {
+                GB_spill_table [GB_spill_nblocks].p = p ;
+                GB_spill_table [GB_spill_nblocks].size = size ;
+                GB_spill_nblocks++ ;
+                ok = true ;
+            }
+        }
+        if (!ok)
+        {
+            // registry full (never occurs in practice)
+            munmap (p, size) ;
+            p = NULL ;
+        }
+    }
+    if (p != NULL)
+    {
+        GB_Global_memtable_add (p, size) ;
+    }
+    return (p) ;
+    #else
+    return (NULL) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_spill_free: free a file-backed block
+//------------------------------------------------------------------------------
+
+bool GB_spill_free          // true if p was a file-backed block
+(
+    void *p,                // block to free
+    size_t size             // # of bytes allocated
+)
+{
+    #ifdef GB_HAS_SPILL
+    if (GB_spill_nblocks == 0)
+    {
+        // no file-backed blocks exist, so p is not one of them.  If p were
+        // file-backed, its registration happened before this free of p, and
+        // the handoff of p to this thread makes it visible here.
+        return (false) ;
+    }
+    bool found = false ;
+    #pragma omp critical(GB_spill)
+    {
+        for (int k = 0 ; k < GB_spill_nblocks ; k++)
+        {
+            if (GB_spill_table [k].p == p)
+            {
+                ASSERT (GB_spill_table [k].size == size) ;
+                GB_spill_table [k] = GB_spill_table [GB_spill_nblocks-1] ;
+                GB_spill_nblocks-- ;
+                found = true ;
+                break ;
+            }
+        }
+    }
+    if (found)
+    {
+        munmap (p, size) ;
+        GB_Global_memtable_remove (p) ;
+    }
+    return (found) ;
+    #else
+    return (false) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_spill_finalize: unmap all file-backed blocks
+//------------------------------------------------------------------------------
+
+// Called by GrB_finalize, which only a single user thread may call.
+
+void GB_spill_finalize (void)
+{
+    #ifdef GB_HAS_SPILL
+    for (int k = 0 ; k < GB_spill_nblocks ; k++)
+    {
+        munmap (GB_spill_table [k].p, GB_spill_table [k].size) ;
+    }
+    GB_spill_nblocks = 0 ;
+    #endif
+}
@@ -0,0 +1,31 @@
+//------------------------------------------------------------------------------
+// GB_spill.h: definitions for file-backed memory blocks
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#ifndef GB_SPILL_H
+#define GB_SPILL_H
+
+// max # of file-backed blocks live at any time; spilled blocks are very
+// large, so this bound is never a practical limit
+#define GB_SPILL_MAX 2048
+
+void *GB_spill_malloc       // file-backed block, or NULL
+(
+    size_t size,            // # of bytes to allocate
+    bool force              // if true, ignore the spill threshold
+) ;
+
+bool GB_spill_free          // true if p was a file-backed block
+(
+    void *p,                // block to free
+    size_t size             // # of bytes allocated
+) ;
+
+void GB_spill_finalize (void) ;     // unmap all blocks, for GrB_finalize
+
+#endif
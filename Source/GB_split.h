@@ -57,5 +57,14 @@ GrB_Info GB_split_sparse            // split a sparse matrix
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_window                  // construct a shallow window view of A
+(
+    GrB_Matrix *V,              // output: shallow view of A, as a new matrix
+    const GrB_Matrix A,         // input matrix to view
+    const int64_t kbegin,       // first vector of the window
+    const int64_t kend,         // last vector of the window, plus one
+    GB_Werk Werk
+) ;
+
 #endif
 
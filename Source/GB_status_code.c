@@ -31,6 +31,7 @@ const char *GB_status_code (GrB_Info info)
         case GrB_PANIC                : return ("GrB_PANIC") ;
         case GrB_NOT_IMPLEMENTED      : return ("GrB_NOT_IMPLEMENTED") ;
         case GrB_EMPTY_OBJECT         : return ("GrB_EMPTY_OBJECT") ;
+        case GxB_CANCELLED            : return ("GxB_CANCELLED") ;
         default                       : return ("unknown GrB_Info value!") ;
     }
 }
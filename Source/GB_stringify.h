@@ -161,6 +161,23 @@ void GB_enumify_ewise       // enumerate a GrB_eWise problem
     GrB_Matrix B            // NULL for unary apply with binop, bind 2nd
 ) ;
 
+// a bound scalar folded into a bind1st/bind2nd kernel occupies the 13 spare
+// bits of the ewise scode (bits 51 to 63), encoded as value+1, or 0 if the
+// scalar is not folded and stays a runtime argument
+#define GB_BIND_SCALAR_MAX 8190
+
+// an eWiseUnion kernel folds its two default scalars (alpha and beta) into
+// the same 13 spare bits, as two 6-bit fields (alpha in bits 51 to 56, beta
+// in bits 57 to 62), each encoded as value+1 or 0 if not folded, so each
+// scalar is folded independently
+#define GB_UNION_SCALAR_MAX 62
+
+uint64_t GB_enumify_bind_scalar     // encode a bound scalar, 0 if not folded
+(
+    const GB_void *scalar,      // the bound scalar, typecast to type
+    const GrB_Type type         // type of the bound scalar
+) ;
+
 void GB_macrofy_ewise           // construct all macros for GrB_eWise
 (
     // output:
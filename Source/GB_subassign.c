@@ -80,6 +80,9 @@ GrB_Info GB_subassign               // C(Rows,Cols)<M> += A or A'
     int assign_kind = GB_SUBASSIGN ;
     int subassign_method ;
 
+    // some subassign methods rewrite the values of C in place
+    GB_fingerprint_clear (C_in) ;
+
     GB_OK (GB_assign_prep (&C, &M, &A, &subassign_method,
         &Cwork, &Mwork, &Awork,
         &Cwork_header, &Mwork_header, &Awork_header, &MT_header, &AT_header,
@@ -193,6 +193,7 @@ GrB_Info GB_assign_prep
 #define GB_SUBASSIGN_METHOD_23  23     // C += A ; C is dense
 #define GB_SUBASSIGN_METHOD_24  24     // C = A
 #define GB_SUBASSIGN_METHOD_25  25     // C(:,:)<M,struct> = A ; C empty
+#define GB_SUBASSIGN_METHOD_26  26     // C(:,j1:j2) = A ; C sparse, A full
 #define GB_SUBASSIGN_METHOD_BITMAP 999 // bitmap assignment
 
 #endif
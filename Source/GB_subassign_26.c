@@ -0,0 +1,164 @@
+//------------------------------------------------------------------------------
+// GB_subassign_26: C(:,j1:j2) = A ; C is sparse, A is full, no S
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Method 26: C(:,j1:j2) = A ; no S, C sparse, A full
+
+// M:           NULL
+// Mask_comp:   false
+// C_replace:   effectively false
+// accum:       NULL
+// A:           full matrix
+// S:           none
+
+// C is sparse (not hypersparse), with no pending work; A is full, and both
+// have the same type, so the assignment replaces entire vectors j1:j2 of C
+// with dense vectors, in place.  The new vectors are packed segments of
+// length C->vlen, so the body of the assignment is a single memcpy of the
+// values of A, with the entries of C to the right of the spliced region
+// shifted by one memmove, and the tail of C->p adjusted by the change in
+// the region's size.  This turns the common case of replacing a contiguous
+// range of rows of a CSR matrix (or columns of a CSC matrix) with a dense
+// block into little more than the raw data movement.
+
+// C remains sparse, and keeps its jumbled state: the spliced vectors are
+// constructed in sorted order, and the order of the remaining vectors is
+// preserved.
+
+#include "GB_subassign_dense.h"
+#define GB_FREE_ALL ;
+
+GrB_Info GB_subassign_26    // C(:,j1:j2) = A ; C sparse, A full
+(
+    GrB_Matrix C,           // input/output matrix
+    // input:
+    const int64_t Jcolon [3],   // j1:j2, with an increment of 1
+    const int64_t nJ,           // number of vectors, nJ = j2 - j1 + 1
+    const GrB_Matrix A,     // input matrix, full
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (!GB_any_aliased (C, A)) ;   // NO ALIAS of C==A
+    ASSERT (!GB_is_shallow (C)) ;
+
+    ASSERT_MATRIX_OK (C, "C for subassign method_26", GB0) ;
+    ASSERT (GB_IS_SPARSE (C)) ;
+    ASSERT (!C->iso) ;
+    ASSERT (!GB_ZOMBIES (C)) ;
+    ASSERT (GB_JUMBLED_OK (C)) ;
+    ASSERT (!GB_PENDING (C)) ;
+
+    ASSERT_MATRIX_OK (A, "A for subassign method_26", GB0) ;
+    ASSERT (GB_IS_FULL (A)) ;
+    ASSERT (!A->iso) ;
+    ASSERT (A->type == C->type) ;
+    ASSERT (A->vlen == C->vlen) ;
+    ASSERT (A->vdim == nJ) ;
+
+    const int64_t j1 = Jcolon [GxB_BEGIN] ;
+    ASSERT (Jcolon [GxB_INC] == 1) ;
+    ASSERT (nJ == Jcolon [GxB_END] - j1 + 1) ;
+    ASSERT (j1 >= 0 && j1 + nJ <= C->vdim) ;
+
+    if (nJ == 0 || C->vlen == 0)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get C and A
+    //--------------------------------------------------------------------------
+
+    int64_t *restrict Cp = C->p ;
+    const int64_t cvlen = C->vlen ;
+    const int64_t cnvec = C->nvec ;
+    const size_t csize = C->type->size ;
+    const int64_t cnz = Cp [cnvec] ;
+
+    // the spliced region is Cp [j1] ... Cp [j1+nJ]-1, replaced by anz entries
+    const int64_t pstart = Cp [j1] ;
+    const int64_t pend = Cp [j1+nJ] ;
+    const int64_t anz = nJ * cvlen ;        // # of entries in A, which is full
+    const int64_t delta = anz - (pend - pstart) ;
+    const int64_t cnz_new = cnz + delta ;
+
+    //--------------------------------------------------------------------------
+    // ensure C can hold the result
+    //--------------------------------------------------------------------------
+
+    if (cnz_new > GB_nnz_max (C))
+    {
+        GB_OK (GB_ix_realloc (C, cnz_new)) ;
+    }
+
+    int64_t *restrict Ci = C->i ;
+    GB_void *restrict Cx = (GB_void *) C->x ;
+    const GB_void *restrict Ax = (GB_void *) A->x ;
+
+    //--------------------------------------------------------------------------
+    // shift the tail of C by delta, in one pass
+    //--------------------------------------------------------------------------
+
+    if (delta != 0 && pend < cnz)
+    {
+        memmove (Ci + pstart + anz, Ci + pend,
+            (cnz - pend) * sizeof (int64_t)) ;
+        memmove (Cx + (pstart + anz) * csize, Cx + pend * csize,
+            (cnz - pend) * csize) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // fill vectors j1:j2 of C with the dense block A
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
+
+    // the pattern of each spliced vector is 0:cvlen-1
+    int64_t p ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (p = 0 ; p < anz ; p++)
+    {
+        Ci [pstart + p] = p % cvlen ;
+    }
+
+    // the values are a packed copy of A
+    GB_memcpy (Cx + pstart * csize, Ax, anz * csize, nthreads) ;
+
+    //--------------------------------------------------------------------------
+    // adjust the vector pointers of C
+    //--------------------------------------------------------------------------
+
+    int nth = GB_nthreads (cnvec, chunk, nthreads_max) ;
+    int64_t j ;
+    #pragma omp parallel for num_threads(nth) schedule(static)
+    for (j = j1+1 ; j <= cnvec ; j++)
+    {
+        Cp [j] = (j <= j1 + nJ) ? (pstart + (j - j1) * cvlen)
+                                : (Cp [j] + delta) ;
+    }
+
+    // the spliced vectors are all non-empty; recompute the count lazily
+    C->nvec_nonempty = -1 ;
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (C, "C output for subassign method_26", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -76,6 +76,20 @@ GrB_Info GB_subassign_24    // C = A, copy A into an existing matrix C
     GB_Werk Werk
 ) ;
 
+//------------------------------------------------------------------------------
+// GB_subassign_26: C(:,j1:j2) = A ; C is sparse, A is full
+//------------------------------------------------------------------------------
+
+GrB_Info GB_subassign_26    // C(:,j1:j2) = A ; C sparse, A full
+(
+    GrB_Matrix C,           // input/output matrix
+    // input:
+    const int64_t Jcolon [3],   // j1:j2, with an increment of 1
+    const int64_t nJ,           // number of vectors, nJ = j2 - j1 + 1
+    const GrB_Matrix A,     // input matrix, full
+    GB_Werk Werk
+) ;
+
 //------------------------------------------------------------------------------
 // GB_subassign_25: C<M> = A ; C is empty, A is dense, M is structural
 //------------------------------------------------------------------------------
@@ -65,7 +65,8 @@ GrB_Info GB_subassign_symbolic
     // in the same hypersparse form as C (unless S is empty, in which case
     // it is always returned as hypersparse). This also checks I and J.
     // S is not iso, even if C is iso.
-    GB_OK (GB_subref (S, false, C->is_csc, C, I, ni, J, nj, true, Werk)) ;
+    GB_OK (GB_subref (S, false, C->is_csc, C, I, ni, J, nj, true, NULL,
+        Werk)) ;
     ASSERT (GB_JUMBLED_OK (S)) ;    // GB_subref can return S as unsorted
 
     //--------------------------------------------------------------------------
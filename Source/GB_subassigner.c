@@ -471,7 +471,7 @@ GrB_Info GB_subassigner             // C(I,J)<#M> = A or accum (C (I,J), A)
         }
         break ;
 
-        case GB_SUBASSIGN_METHOD_02 : 
+        case GB_SUBASSIGN_METHOD_02 :
         {
             // Method 02: C(I,J) = A ; using S
             GBURBLE ("Method 02: C(%s,%s) = Z ; using S ",
@@ -482,6 +482,14 @@ GrB_Info GB_subassigner             // C(I,J)<#M> = A or accum (C (I,J), A)
         }
         break ;
 
+        case GB_SUBASSIGN_METHOD_26 :
+        {
+            // Method 26: C(:,j1:j2) = A ; no S, C sparse, A full
+            GBURBLE ("Method 26: C(:,%s) = Z ; splice ", Jstring) ;
+            GB_OK (GB_subassign_26 (C, Jcolon, nJ, A, Werk)) ;
+        }
+        break ;
+
         case GB_SUBASSIGN_METHOD_04 : 
         {
             // Method 04: C(I,J) += A ; using S
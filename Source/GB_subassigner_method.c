@@ -500,9 +500,20 @@ int GB_subassigner_method           // return method to use in GB_subassigner
         else
         {
             if (accum == NULL)
-            { 
-                // Method 02: C(I,J) = A ; using S
-                subassign_method = GB_SUBASSIGN_METHOD_02 ;
+            {
+                if (Ikind == GB_ALL && Jkind == GB_RANGE && A_is_full
+                    && !A->iso && GB_IS_SPARSE (C) && !C->iso
+                    && !GB_PENDING_OR_ZOMBIES (C) && ctype == A->type)
+                {
+                    // Method 26: C(:,j1:j2) = A ; no S, C sparse, A full,
+                    // no typecasting: replace whole vectors of C in place
+                    subassign_method = GB_SUBASSIGN_METHOD_26 ;
+                }
+                else
+                {
+                    // Method 02: C(I,J) = A ; using S
+                    subassign_method = GB_SUBASSIGN_METHOD_02 ;
+                }
             }
             else
             { 
@@ -880,6 +891,10 @@ int GB_subassigner_method           // return method to use in GB_subassigner
             // C, M, and A can have any sparsity structure, including bitmap
             break ;
 
+        case GB_SUBASSIGN_METHOD_26 :   // C(:,j1:j2) = A ; C sparse, A full
+            // C is always sparse; this method is selected only in that case
+            break ;
+
         case GB_SUBASSIGN_METHOD_25 :   // C(:,:)<M,struct> = A ; C empty
             // C, M, and A can have any sparsity structure, including bitmap,
             // but if M is bitmap or full, use bitmap assignment instead.
@@ -101,6 +101,8 @@ GrB_Info GB_subref              // C = A(I,J): either symbolic or numeric
     const GrB_Index *J,         // index list for C = A(I,J), or GrB_ALL, etc.
     const int64_t nj,           // length of J, or special
     const bool symbolic,        // if true, construct C as symbolic
+    const GxB_IndexList I_list, // cached analysis of I from GxB_IndexList_new,
+                                // or NULL if none available
     GB_Werk Werk
 )
 {
@@ -168,7 +170,7 @@ GrB_Info GB_subref              // C = A(I,J): either symbolic or numeric
     GB_task_struct *TaskList      = NULL ; size_t TaskList_size = 0 ;
 
     int64_t Cnvec = 0, nI = 0, nJ, Icolon [3], Cnvec_nonempty, ndupl ;
-    bool post_sort, need_qsort ;
+    bool post_sort, need_qsort, I_inverse_from_list = false ;
     int Ikind, ntasks, nthreads ;
 
     //--------------------------------------------------------------------------
@@ -191,20 +193,71 @@ GrB_Info GB_subref              // C = A(I,J): either symbolic or numeric
         // original input:
         A, I, ni, J, nj, Werk)) ;
 
+    //--------------------------------------------------------------------------
+    // construct C as bitmap if its estimated density is high enough
+    //--------------------------------------------------------------------------
+
+    // Extracting a dense block from a large sparse or hypersparse matrix
+    // often produces a C whose density is far above the bitmap switch, so a
+    // sparse C would be converted to bitmap as soon as it is conformed.  In
+    // that case, construct C as bitmap directly, skipping phases 1 to 3, the
+    // qsort of any unsorted vectors, and the conversion.  The number of
+    // entries in C is bounded by the trimmed vector pointers from phase0;
+    // the bound is exact unless I is a subset of imin:imax or A has dense
+    // vectors (which are not trimmed).
+
+    if (!symbolic && !GB_ZOMBIES (A) && Cnvec > 0)
+    {
+        int nthreads_max = GB_Context_nthreads_max ( ) ;
+        double chunk = GB_Context_chunk ( ) ;
+        int nth = GB_nthreads (Cnvec, chunk, nthreads_max) ;
+        int64_t cnz_bound = 0 ;
+        int64_t kC ;
+        #pragma omp parallel for num_threads(nth) schedule(static) \
+            reduction(+:cnz_bound)
+        for (kC = 0 ; kC < Cnvec ; kC++)
+        {
+            int64_t pA = Ap_start [kC] ;
+            if (pA >= 0)
+            {
+                cnz_bound += (Ap_end [kC] - pA) ;
+            }
+        }
+        float bitmap_switch = GB_Global_bitmap_switch_matrix_get (nI, nJ) ;
+        if (GB_convert_s2b_test (bitmap_switch, 0, cnz_bound, nI, nJ))
+        {
+            GBURBLE ("(bitmap subref) ") ;
+            GB_OK (GB_subref_bitmap (C, C_iso, cscalar, C_is_csc, A,
+                Ch, Ap_start, Ap_end, Cnvec, Ikind, nI, Icolon, nJ,
+                I, I_list, Werk)) ;
+            GB_FREE_ALL ;
+            ASSERT_MATRIX_OK (C, "C output for C=A(I,J), bitmap", GB0) ;
+            return (GrB_SUCCESS) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // phase1: split C=A(I,J) into tasks for phase2 and phase3
     //--------------------------------------------------------------------------
 
-    // This phase also inverts I if needed.
+    // This phase also inverts I if needed, unless a valid I-inverse is
+    // available from a GxB_IndexList built for this index list and vector
+    // length; in that case the buckets cached in I_list are used instead.
 
     GB_OK (GB_subref_slice (
         // computed by phase1:
         &TaskList, &TaskList_size, &ntasks, &nthreads, &post_sort,
-        &Mark, &Mark_size, &Inext, &Inext_size, &ndupl,
+        &Mark, &Mark_size, &Inext, &Inext_size, &ndupl, &I_inverse_from_list,
         // computed by phase0:
         Ap_start, Ap_end, Cnvec, need_qsort, Ikind, nI, Icolon,
         // original input:
-        A->vlen, GB_nnz (A), I, Werk)) ;
+        A->vlen, GB_nnz (A), I,
+        (GB_index_list_ok (I_list, I, nI, A->vlen) && I_list->Mark != NULL) ?
+            I_list : NULL, Werk)) ;
+
+    // use the I-inverse buckets cached in I_list, if the slice selected them
+    const int64_t *Mark_inv  = I_inverse_from_list ? I_list->Mark  : Mark ;
+    const int64_t *Inext_inv = I_inverse_from_list ? I_list->Inext : Inext ;
 
     //--------------------------------------------------------------------------
     // phase2: count the number of entries in each vector of C
@@ -214,7 +267,7 @@ GrB_Info GB_subref              // C = A(I,J): either symbolic or numeric
         // computed by phase2:
         &Cp, &Cp_size, &Cnvec_nonempty,
         // computed by phase1:
-        TaskList, ntasks, nthreads, Mark, Inext, ndupl,
+        TaskList, ntasks, nthreads, Mark_inv, Inext_inv, ndupl,
         // computed by phase0:
         Ap_start, Ap_end, Cnvec, need_qsort, Ikind, nI, Icolon,
         // original input:
@@ -230,7 +283,7 @@ GrB_Info GB_subref              // C = A(I,J): either symbolic or numeric
         // from phase2:
         &Cp, Cp_size, Cnvec_nonempty,
         // from phase1:
-        TaskList, ntasks, nthreads, post_sort, Mark, Inext, ndupl,
+        TaskList, ntasks, nthreads, post_sort, Mark_inv, Inext_inv, ndupl,
         // from phase0:
         &Ch, Ch_size, Ap_start, Ap_end, Cnvec, need_qsort,
         Ikind, nI, Icolon, nJ,
@@ -24,6 +24,7 @@ GrB_Info GB_subref              // C = A(I,J): either symbolic or numeric
     const GrB_Index *J,         // index list for C = A(I,J), or GrB_ALL, etc.
     const int64_t nj,           // length of J, or special
     const bool symbolic,        // if true, construct C as symbolic
+    const GxB_IndexList I_list, // cached analysis of I, or NULL
     GB_Werk Werk
 ) ;
 
@@ -65,6 +66,8 @@ GrB_Info GB_subref_slice    // phase 1 of GB_subref
     int64_t *restrict *p_Inext,     // for I inverse, if needed; size nI
     size_t *p_Inext_size,
     int64_t *p_nduplicates,         // # of duplicates, if I inverse computed
+    bool *p_I_inverse_from_list,    // true if the cached I_list buckets are
+                                    // to be used in place of Mark and Inext
     // from phase0:
     const int64_t *restrict Ap_start,   // location of A(imin:imax,kA)
     const int64_t *restrict Ap_end,
@@ -77,6 +80,7 @@ GrB_Info GB_subref_slice    // phase 1 of GB_subref
     const int64_t avlen,            // A->vlen
     const int64_t anz,              // nnz (A)
     const GrB_Index *I,
+    const GxB_IndexList I_list,     // cached analysis of I, or NULL
     GB_Werk Werk
 ) ;
 
@@ -176,6 +180,30 @@ GrB_Info GB_bitmap_subref       // C = A(I,J): either symbolic or numeric
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_subref_bitmap       // C = A(I,J): numeric, C bitmap
+(
+    // output
+    GrB_Matrix C,               // output matrix, static header
+    // input, not modified
+    const bool C_iso,           // if true, C is iso
+    const GB_void *cscalar,     // scalar value of C, if iso
+    const bool C_is_csc,        // requested format of C
+    const GrB_Matrix A,         // sparse or hypersparse
+    // from GB_subref_phase0:
+    const int64_t *restrict Ch,         // Ch [kC] = jC, or NULL if C standard
+    const int64_t *restrict Ap_start,   // A(:,kA) starts at Ap_start [kC]
+    const int64_t *restrict Ap_end,     // ... and ends at Ap_end [kC] - 1
+    const int64_t Cnvec,        // # of vectors of C with entries from A
+    const int Ikind,            // kind of I
+    const int64_t nI,           // length of I
+    const int64_t Icolon [3],   // for GB_RANGE and GB_STRIDE
+    const int64_t nJ,           // length of J
+    // original input:
+    const GrB_Index *I,         // index list for C = A(I,J), or GrB_ALL, etc.
+    const GxB_IndexList I_list, // cached analysis of I, or NULL
+    GB_Werk Werk
+) ;
+
 //------------------------------------------------------------------------------
 // GB_subref_method: select a method for C(:,kC) = A(I,kA), for one vector of C
 //------------------------------------------------------------------------------
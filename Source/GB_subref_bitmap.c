@@ -0,0 +1,275 @@
+//------------------------------------------------------------------------------
+// GB_subref_bitmap: C = A(I,J) where A is sparse/hypersparse and C is bitmap
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=A(I,J), numeric only, where A is sparse or hypersparse and the output C
+// is constructed as bitmap.  This method is used by GB_subref when the
+// estimated density of C is high enough that a sparse C would be converted
+// to bitmap anyway (see GB_convert_s2b_test); constructing C as bitmap
+// directly skips phases 1 to 3 of the sparse subref, the qsort of unsorted
+// vectors, and the subsequent conversion.
+
+// The vectors of C have already been found by GB_subref_phase0:  the (kC)th
+// vector of C is C(:,jC) with jC = Ch [kC] (or jC = kC if Ch is NULL), and
+// the corresponding vector A(imin:imax,kA) is held in Ai,Ax [Ap_start [kC]
+// ... Ap_end [kC]-1].  Each entry of A in that range is scattered into the
+// bitmap of C, mapping its row index i to inew via I.  No atomics are
+// needed: within one vector of A the row indices are unique, and each task
+// owns entire vectors of C.
+
+// The symbolic case is not handled; it is used only by GB_subassign_symbolic
+// where C must remain sparse.  A has no zombies or pending tuples.
+
+#include "GB_subref.h"
+
+#define GB_FREE_WORKSPACE                       \
+{                                               \
+    GB_FREE_WORK (&Mark, Mark_size) ;           \
+    GB_FREE_WORK (&Inext, Inext_size) ;         \
+}
+
+#define GB_FREE_ALL             \
+{                               \
+    GB_FREE_WORKSPACE ;         \
+    GB_phybix_free (C) ;        \
+}
+
+GrB_Info GB_subref_bitmap       // C = A(I,J): numeric, C bitmap
+(
+    // output
+    GrB_Matrix C,               // output matrix, static header
+    // input, not modified
+    const bool C_iso,           // if true, C is iso
+    const GB_void *cscalar,     // scalar value of C, if iso
+    const bool C_is_csc,        // requested format of C
+    const GrB_Matrix A,         // sparse or hypersparse
+    // from GB_subref_phase0:
+    const int64_t *restrict Ch,         // Ch [kC] = jC, or NULL if C standard
+    const int64_t *restrict Ap_start,   // A(:,kA) starts at Ap_start [kC]
+    const int64_t *restrict Ap_end,     // ... and ends at Ap_end [kC] - 1
+    const int64_t Cnvec,        // # of vectors of C with entries from A
+    const int Ikind,            // kind of I
+    const int64_t nI,           // length of I
+    const int64_t Icolon [3],   // for GB_RANGE and GB_STRIDE
+    const int64_t nJ,           // length of J
+    // original input:
+    const GrB_Index *I,         // index list for C = A(I,J), or GrB_ALL, etc.
+    const GxB_IndexList I_list, // cached analysis of I, or NULL
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (C != NULL && (C->static_header || GBNSTATIC)) ;
+    ASSERT_MATRIX_OK (A, "A for C=A(I,J) bitmap-output subref", GB0) ;
+    ASSERT (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) ;
+    ASSERT (!GB_ZOMBIES (A)) ;
+    ASSERT (!GB_JUMBLED (A)) ;
+    ASSERT (!GB_PENDING (A)) ;
+
+    int64_t *restrict Mark  = NULL ; size_t Mark_size = 0 ;
+    int64_t *restrict Inext = NULL ; size_t Inext_size = 0 ;
+
+    //--------------------------------------------------------------------------
+    // get A
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Ai = A->i ;
+    const int64_t avlen = A->vlen ;
+    const size_t asize = A->type->size ;
+
+    //--------------------------------------------------------------------------
+    // get or build the I inverse buckets, if I is an explicit list
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Mark_inv  = NULL ;
+    const int64_t *restrict Inext_inv = NULL ;
+
+    if (Ikind == GB_LIST)
+    {
+        if (GB_index_list_ok (I_list, I, nI, avlen) && I_list->Mark != NULL)
+        {
+            // use the buckets cached in the GxB_IndexList
+            Mark_inv  = I_list->Mark ;
+            Inext_inv = I_list->Inext ;
+        }
+        else
+        {
+            // I = I [0:nI-1], an explicit list: invert it
+            int64_t ndupl ;
+            GB_OK (GB_I_inverse (I, nI, avlen, &Mark, &Mark_size,
+                &Inext, &Inext_size, &ndupl, Werk)) ;
+            Mark_inv  = Mark ;
+            Inext_inv = Inext ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate C
+    //--------------------------------------------------------------------------
+
+    int64_t cnzmax ;
+    bool ok = GB_int64_multiply ((GrB_Index *) (&cnzmax), nI, nJ) ;
+    if (!ok)
+    {
+        // problem too large; the caller falls back to the sparse method,
+        // but GB_convert_s2b_test has already ruled this case out
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    // set C->iso = C_iso   OK
+    GB_OK (GB_new_bix (&C, // bitmap, existing header
+        A->type, nI, nJ, GB_Ap_null, C_is_csc,
+        GxB_BITMAP, true, A->hyper_switch, -1, cnzmax, true, C_iso)) ;
+
+    int8_t *restrict Cb = C->b ;
+    const GB_void *restrict Ax = (GB_void *) A->x ;
+          GB_void *restrict Cx = (GB_void *) C->x ;
+    if (C_iso)
+    {
+        memcpy (C->x, cscalar, asize) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (cnzmax, chunk, nthreads_max) ;
+    nthreads = GB_IMIN (nthreads, Cnvec) ;
+    nthreads = GB_IMAX (nthreads, 1) ;
+
+    //--------------------------------------------------------------------------
+    // C = A(I,J): scatter each vector of A into the bitmap of C
+    //--------------------------------------------------------------------------
+
+    const int64_t ibegin = Icolon [GxB_BEGIN] ;
+    const int64_t iinc   = Icolon [GxB_INC] ;
+    int64_t cnvals = 0 ;
+
+    int64_t kC ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+        reduction(+:cnvals)
+    for (kC = 0 ; kC < Cnvec ; kC++)
+    {
+        // C(:,jC) = A (imin:imax,kA), the (kC)th vector of C
+        int64_t jC = (Ch == NULL) ? kC : Ch [kC] ;
+        int64_t pC_start = jC * nI ;
+        int64_t pA_start = Ap_start [kC] ;
+        int64_t pA_end   = Ap_end   [kC] ;
+        int64_t task_cnvals = 0 ;
+        if (pA_start < 0)
+        {
+            // A (imin:imax,kA) is empty
+            continue ;
+        }
+
+        // scatter C(inew,jC) = A (i,kA) for each i in I
+        #define GB_SCATTER(inew)                                        \
+        {                                                               \
+            int64_t pC = pC_start + (inew) ;                            \
+            Cb [pC] = 1 ;                                               \
+            if (!C_iso)                                                 \
+            {                                                           \
+                /* Cx [pC] = Ax [pA] */                                 \
+                memcpy (Cx + (pC)*asize, Ax + pA*asize, asize) ;        \
+            }                                                           \
+            task_cnvals++ ;                                             \
+        }
+
+        switch (Ikind)
+        {
+
+            case GB_ALL :       // I is ":"
+            {
+                for (int64_t pA = pA_start ; pA < pA_end ; pA++)
+                {
+                    int64_t i = Ai [pA] ;
+                    GB_SCATTER (i) ;
+                }
+            }
+            break ;
+
+            case GB_RANGE :     // I is ibegin:iend
+            {
+                // if A(:,kA) is dense, Ap_start and Ap_end are not trimmed
+                // to imin:imax, so entries outside the range must be skipped
+                for (int64_t pA = pA_start ; pA < pA_end ; pA++)
+                {
+                    int64_t inew = Ai [pA] - ibegin ;
+                    if (inew < 0 || inew >= nI) continue ;
+                    GB_SCATTER (inew) ;
+                }
+            }
+            break ;
+
+            case GB_STRIDE :    // I is ibegin:iinc:iend, iinc nonzero
+            {
+                if (iinc > 0)
+                {
+                    for (int64_t pA = pA_start ; pA < pA_end ; pA++)
+                    {
+                        int64_t d = Ai [pA] - ibegin ;
+                        if (d < 0 || d % iinc != 0) continue ;
+                        int64_t inew = d / iinc ;
+                        if (inew >= nI) continue ;
+                        GB_SCATTER (inew) ;
+                    }
+                }
+                else
+                {
+                    // the stride is negative, so I is a descending sequence
+                    for (int64_t pA = pA_start ; pA < pA_end ; pA++)
+                    {
+                        int64_t d = ibegin - Ai [pA] ;
+                        if (d < 0 || d % (-iinc) != 0) continue ;
+                        int64_t inew = d / (-iinc) ;
+                        if (inew >= nI) continue ;
+                        GB_SCATTER (inew) ;
+                    }
+                }
+            }
+            break ;
+
+            default :           // Ikind == GB_LIST
+            {
+                // an entry A(i,kA) appears once in C(:,jC) for each
+                // duplicate of i in I, via the I inverse buckets
+                for (int64_t pA = pA_start ; pA < pA_end ; pA++)
+                {
+                    int64_t i = Ai [pA] ;
+                    for (int64_t inew = Mark_inv [i] - 1 ; inew >= 0 ;
+                         inew = Inext_inv [inew])
+                    {
+                        GB_SCATTER (inew) ;
+                    }
+                }
+            }
+            break ;
+        }
+        cnvals += task_cnvals ;
+    }
+
+    C->nvals = cnvals ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    C->magic = GB_MAGIC ;
+    ASSERT_MATRIX_OK (C, "C output for bitmap-output subref C=A(I,J)", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
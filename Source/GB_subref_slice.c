@@ -60,6 +60,8 @@ GrB_Info GB_subref_slice    // phase 1 of GB_subref
     int64_t *restrict *p_Inext,     // for I inverse, if needed; size nI
     size_t *p_Inext_size,
     int64_t *p_nduplicates,         // # of duplicates, if I inverse computed
+    bool *p_I_inverse_from_list,    // true if the cached I_list buckets are
+                                    // to be used in place of Mark and Inext
     // from phase0:
     const int64_t *restrict Ap_start,   // location of A(imin:imax,kA)
     const int64_t *restrict Ap_end,
@@ -72,6 +74,7 @@ GrB_Info GB_subref_slice    // phase 1 of GB_subref
     const int64_t avlen,            // A->vlen
     const int64_t anz,              // nnz (A)
     const GrB_Index *I,
+    const GxB_IndexList I_list,     // cached analysis of I, or NULL
     GB_Werk Werk
 )
 {
@@ -88,6 +91,7 @@ GrB_Info GB_subref_slice    // phase 1 of GB_subref
     ASSERT (p_Mark  != NULL) ;
     ASSERT (p_Inext != NULL) ;
     ASSERT (p_nduplicates != NULL) ;
+    ASSERT (p_I_inverse_from_list != NULL) ;
 
     ASSERT ((Cnvec > 0) == (Ap_start != NULL)) ;
     ASSERT ((Cnvec > 0) == (Ap_end != NULL)) ;
@@ -96,6 +100,7 @@ GrB_Info GB_subref_slice    // phase 1 of GB_subref
     (*p_TaskList_size) = 0 ;
     (*p_Mark    ) = NULL ;
     (*p_Inext   ) = NULL ;
+    (*p_I_inverse_from_list) = false ;
 
     int64_t *restrict Mark  = NULL ; size_t Mark_size = 0 ;
     int64_t *restrict Inext = NULL ; size_t Inext_size = 0 ;
@@ -221,11 +226,24 @@ GrB_Info GB_subref_slice    // phase 1 of GB_subref
 
     int64_t ndupl = 0 ;
     if (need_I_inverse)
-    { 
-        GB_OK (GB_I_inverse (I, nI, avlen, &Mark, &Mark_size,
-            &Inext, &Inext_size, &ndupl, Werk)) ;
-        ASSERT (Mark != NULL) ;
-        ASSERT (Inext != NULL) ;
+    {
+        if (I_list != NULL)
+        { 
+            // the I-inverse buckets were built once by GxB_IndexList_new;
+            // use them in place of Mark and Inext
+            ASSERT (GB_index_list_ok (I_list, I, nI, avlen)) ;
+            ASSERT (I_list->Mark != NULL) ;
+            ASSERT (I_list->Inext != NULL) ;
+            ndupl = I_list->ndupl ;
+            (*p_I_inverse_from_list) = true ;
+        }
+        else
+        { 
+            GB_OK (GB_I_inverse (I, nI, avlen, &Mark, &Mark_size,
+                &Inext, &Inext_size, &ndupl, Werk)) ;
+            ASSERT (Mark != NULL) ;
+            ASSERT (Inext != NULL) ;
+        }
     }
 
     //--------------------------------------------------------------------------
@@ -91,6 +91,7 @@ GrB_Info GB_transplant          // transplant one matrix into another
     C->vdim = avdim ;
     C->nvec_nonempty = A->nvec_nonempty ;
     C->iso = A_iso ;        // OK:transplant
+    C->deferred_unop = A->deferred_unop ;   // deferred op moves into C
 
     // C is not shallow, and has no content yet
     ASSERT (!GB_is_shallow (C)) ;
@@ -235,11 +236,12 @@ GrB_Info GB_transplant          // transplant one matrix into another
         GB_phy_free (A) ;
 
     }
-    else if (A->p_shallow || A->h_shallow)
+    else if (A->p_shallow || A->h_shallow || A->p == A->p_static)
     {
 
         //----------------------------------------------------------------------
-        // A->p or A->h are shallow copies another matrix; make a deep copy
+        // A->p or A->h are shallow copies another matrix, or A->p is resident
+        // in the header of A; make a deep copy
         //----------------------------------------------------------------------
 
         int nth = GB_nthreads (anvec, chunk, nthreads_max) ;
@@ -267,12 +269,22 @@ GrB_Info GB_transplant          // transplant one matrix into another
             // A is sparse, create new C->p
             C->plen = avdim ;
             C->nvec = avdim ;
-            C->p = GB_MALLOC (C->plen+1, int64_t, &(C->p_size)) ;
-            if (C->p == NULL)
+            if (avdim == 1)
             { 
-                // out of memory
-                GB_FREE_ALL ;
-                return (GrB_OUT_OF_MEMORY) ;
+                // C is a single sparse vector: its vector pointers are
+                // resident in the header of C, so nothing is allocated
+                C->p = C->p_static ;
+                C->p_size = sizeof (C->p_static) ;
+            }
+            else
+            {
+                C->p = GB_MALLOC (C->plen+1, int64_t, &(C->p_size)) ;
+                if (C->p == NULL)
+                { 
+                    // out of memory
+                    GB_FREE_ALL ;
+                    return (GrB_OUT_OF_MEMORY) ;
+                }
             }
 
             // copy A->p into the newly created C->p
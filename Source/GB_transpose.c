@@ -109,8 +109,10 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A' or C=op(A')
     int64_t avlen = A->vlen ;
     int64_t avdim = A->vdim ;
 
-    // wait if A has pending tuples or zombies; leave jumbled unless avdim == 1
-    if (GB_PENDING (A) || GB_ZOMBIES (A) || (avdim == 1 && GB_JUMBLED (A)))
+    // wait if A has pending tuples, zombies, or a deferred unary op; leave
+    // jumbled unless avdim == 1
+    if (GB_PENDING (A) || GB_ZOMBIES (A) || GB_DEFERRED (A)
+        || (avdim == 1 && GB_JUMBLED (A)))
     { 
         GB_OK (GB_wait (A, "A", Werk)) ;
     }
@@ -272,9 +274,18 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A' or C=op(A')
             (avlen == 1 || avdim == 1)      // A is a row or column vector,
             && op == NULL                   // no operator to apply,
             && atype == ctype ;             // and no typecasting
+        bool T_square =                 // T=A' can be done within A itself if:
+            !T_cheap
+            && in_place                     // the transpose is in-place,
+            && avlen == avdim               // A is square,
+            && op == NULL                   // no operator to apply,
+            && atype == ctype               // no typecasting,
+            && !A->b_shallow && !A->x_shallow   // A owns its arrays,
+            && !GB_share_shared (A->b)          // exclusively: no snapshot or
+            && !GB_share_shared (A->x) ;        // sharing dup co-owns them
 
         // allocate T
-        if (T_cheap)
+        if (T_cheap || T_square)
         { 
             // just initialize the static header of T, not T->b or T->x
             GBURBLE ("(cheap transpose) ") ;
@@ -325,6 +336,20 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A' or C=op(A')
             }
             T->iso = A->iso ;   // OK
         }
+        else if (T_square)
+        { 
+            // transplant A->b and A->x into T, and transpose them in place,
+            // block by block, with no out-of-place copy of the large arrays
+            GBURBLE ("(in-place square transpose) ") ;
+            T->b = A->b ; T->b_size = A->b_size ; T->b_shallow = false ;
+            T->x = A->x ; T->x_size = A->x_size ; T->x_shallow = false ;
+            A->b = NULL ;
+            A->x = NULL ;
+            T->iso = A->iso ;   // OK
+            // an iso transpose permutes no values, just the bitmap if present
+            GB_transpose_square ((T->iso) ? NULL : ((GB_void *) T->x), T->b,
+                avlen, atype->size, nthreads) ;
+        }
         else if (op == NULL)
         { 
             // do not apply an operator; optional typecast to T->type
@@ -740,7 +765,10 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A' or C=op(A')
             // if in_place, the prior A->p and A->h can now be freed
             if (in_place)
             { 
-                if (!A->p_shallow) GB_FREE (&A->p, A->p_size) ;
+                if (!A->p_shallow && A->p != A->p_static)
+                { 
+                    GB_FREE (&A->p, A->p_size) ;
+                }
                 if (!A->h_shallow) GB_FREE (&A->h, A->h_size) ;
             }
 
@@ -66,6 +66,15 @@ GrB_Info GB_transpose_bucket    // bucket transpose; typecast and apply op
     GB_Werk Werk
 ) ;
 
+void GB_transpose_square    // in-place transpose of a square full/bitmap array
+(
+    GB_void *restrict Ax,   // values, n-by-n, held by column; NULL if iso
+    int8_t *restrict Ab,    // bitmap, n-by-n, or NULL if A is full
+    const int64_t n,        // A is n-by-n
+    const size_t asize,     // size of each entry of Ax
+    const int nthreads      // # of threads to use
+) ;
+
 GrB_Info GB_transpose_ix        // transpose the pattern and values of a matrix
 (
     GrB_Matrix C,                       // output matrix
@@ -32,8 +32,15 @@
 // hypersparse matrices, or for very sparse matrices, the qsort method should
 // be used instead (see GB_transpose).
 
-// This method is parallel, but not highly scalable.  At most O(e/m) threads
-// are used.
+// Three variants are used, selected by GB_transpose_method: a sequential
+// method (one workspace of size m, C not jumbled); an atomic method (a
+// single workspace of size m shared by all threads, with an atomic
+// histogram and scatter, C left jumbled), which scales with e and avoids
+// any per-thread workspace blowup on huge matrices; and a non-atomic
+// method (one workspace of size m per thread, C not jumbled), used only
+// when nthreads*m <= e so its total workspace never exceeds the size of
+// A->i.  The non-atomic method is parallel but not highly scalable: at
+// most O(e/m) threads are used.
 
 #include "GB_transpose.h"
 
@@ -104,6 +111,24 @@ GrB_Info GB_transpose_bucket    // bucket transpose; typecast and apply op
     int64_t anz = GB_nnz (A) ;
     int64_t vlen = A->vlen ;
 
+    //--------------------------------------------------------------------------
+    // via the CUDA kernel
+    //--------------------------------------------------------------------------
+
+    #if defined ( GRAPHBLAS_HAS_CUDA )
+    if (GB_transpose_bucket_cuda_branch (C_code_iso, ctype, op, A))
+    { 
+        // the GPU does the whole transpose (allocating C itself), leaving C
+        // jumbled as the CPU atomic method does; on GrB_NO_VALUE it has
+        // declined and the CPU methods below are used instead
+        GrB_Info cuda_info = GB_transpose_bucket_cuda (C, ctype, C_is_csc, A) ;
+        if (cuda_info != GrB_NO_VALUE)
+        { 
+            return (cuda_info) ;
+        }
+    }
+    #endif
+
     //--------------------------------------------------------------------------
     // determine the number of threads to use
     //--------------------------------------------------------------------------
@@ -0,0 +1,79 @@
+//------------------------------------------------------------------------------
+// GB_transpose_square: in-place blocked transpose of a square full/bitmap A
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Transposes a square n-by-n full or bitmap matrix within its own Ax (and Ab)
+// allocation, so that an in-place C=C' of a large dense matrix does not
+// transiently double its memory.  For a square matrix the permutation of
+// entry positions decomposes into 2-cycles only -- (i,j) trades places with
+// (j,i) -- so the transpose is a pairwise swap of the strict upper and lower
+// triangles, done block-by-block: a block pair (I,J) and (J,I) of at most
+// GB_TRANS_BLOCK^2 entries each is swapped while both blocks sit in cache,
+// rather than striding the full matrix row-by-row.  Block pairs are
+// independent, so they are done in parallel.
+
+// No operator is applied and no typecasting is done; the caller handles the
+// iso case (an iso transpose permutes no values) by passing Ax as NULL.
+
+#include "GB_transpose.h"
+
+#define GB_TRANS_BLOCK 32
+
+void GB_transpose_square    // in-place transpose of a square full/bitmap array
+(
+    GB_void *restrict Ax,   // values, n-by-n, held by column; NULL if iso
+    int8_t *restrict Ab,    // bitmap, n-by-n, or NULL if A is full
+    const int64_t n,        // A is n-by-n
+    const size_t asize,     // size of each entry of Ax
+    const int nthreads      // # of threads to use
+)
+{
+
+    //--------------------------------------------------------------------------
+    // swap the block pairs (I,J) and (J,I), upper triangle against lower
+    //--------------------------------------------------------------------------
+
+    const int64_t nblocks = (n + GB_TRANS_BLOCK - 1) / GB_TRANS_BLOCK ;
+
+    int64_t ib ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (ib = 0 ; ib < nblocks ; ib++)
+    {
+        GB_void t [GB_VLA(asize)] ;
+        const int64_t istart = ib * GB_TRANS_BLOCK ;
+        const int64_t iend = GB_IMIN (istart + GB_TRANS_BLOCK, n) ;
+        for (int64_t jb = ib ; jb < nblocks ; jb++)
+        {
+            const int64_t jstart = jb * GB_TRANS_BLOCK ;
+            const int64_t jend = GB_IMIN (jstart + GB_TRANS_BLOCK, n) ;
+            for (int64_t j = jstart ; j < jend ; j++)
+            {
+                // on the diagonal block, swap only below the diagonal
+                const int64_t ilast = (ib == jb) ? GB_IMIN (j, iend) : iend ;
+                for (int64_t i = istart ; i < ilast ; i++)
+                {
+                    // swap A(i,j) and A(j,i)
+                    const int64_t p = i + j * n ;   // position of A(i,j)
+                    const int64_t q = j + i * n ;   // position of A(j,i)
+                    if (Ab != NULL)
+                    {
+                        const int8_t ab = Ab [p] ;
+                        Ab [p] = Ab [q] ;
+                        Ab [q] = ab ;
+                    }
+                    if (Ax != NULL)
+                    {
+                        memcpy (t, Ax + p*asize, asize) ;
+                        memcpy (Ax + p*asize, Ax + q*asize, asize) ;
+                        memcpy (Ax + q*asize, t, asize) ;
+                    }
+                }
+            }
+        }
+    }
+}
@@ -56,6 +56,33 @@ GrB_Info GB_union_jit      // C=A+B, C<#M>=A+B, eWiseUnion, via the JIT
         false, false, C_sparsity, C->type, M, Mask_struct, Mask_comp,
         binaryop, false, A, B) ;
 
+    //--------------------------------------------------------------------------
+    // fold small integer alpha and beta scalars into the kernel
+    //--------------------------------------------------------------------------
+
+    // Small integer alpha/beta scalars become compile-time constants of the
+    // kernel (GB_ALPHA_SCALAR and GB_BETA_SCALAR), so the compiler folds the
+    // defaults into immediates instead of broadcasting runtime loads.  Each
+    // scalar is folded independently, into a 6-bit field of the scode (see
+    // GB_UNION_SCALAR_MAX), so each (alpha,beta) pair gets its own kernel.
+    // Only done for kernels with no suffix, so the hash can be recomputed
+    // from the encoding alone.
+
+    if (suffix == NULL)
+    {
+        uint64_t afold = GB_enumify_bind_scalar (alpha_scalar_in,
+            binaryop->xtype) ;
+        uint64_t bfold = GB_enumify_bind_scalar (beta_scalar_in,
+            binaryop->ytype) ;
+        if (afold > GB_UNION_SCALAR_MAX + 1) afold = 0 ;
+        if (bfold > GB_UNION_SCALAR_MAX + 1) bfold = 0 ;
+        if (afold != 0 || bfold != 0)
+        {
+            encoding.code |= GB_LSHIFT (afold, 51) | GB_LSHIFT (bfold, 57) ;
+            hash = GB_jitifyer_hash_encoding (&encoding) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // get the kernel function pointer, loading or compiling it if needed
     //--------------------------------------------------------------------------
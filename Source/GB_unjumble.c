@@ -35,6 +35,14 @@ GrB_Info GB_unjumble        // unjumble a matrix
         return (GrB_SUCCESS) ;
     }
 
+    // the sort is done in place; if any array of A is shared, replace it
+    // with a private copy first
+    GrB_Info info = GB_unshare (A) ;
+    if (info != GrB_SUCCESS)
+    { 
+        return (info) ;
+    }
+
     // full and bitmap matrices are never jumbled 
     ASSERT (!GB_IS_FULL (A)) ;
     ASSERT (!GB_IS_BITMAP (A)) ;
@@ -11,6 +11,14 @@
 // transposing the matrix in place, which case the contents of A have already
 // been transplanted into T, and only A->x remains.
 
+// This method takes O(1) time: a single scalar application of the op.  It
+// covers every op for which GB_unop_code_iso reports an iso result, including
+// user-defined unary and binary ops: an op created with a NULL function
+// pointer gets a JIT-compiled function pointer in GxB_*Op_new, so the direct
+// call below is always valid.  The only apply cases that fall through to the
+// full O(nnz) kernels are positional and user-defined index-unary ops, whose
+// results genuinely depend on the pattern.
+
 #include "GB.h"
 
 void GB_unop_iso            // Cx [0] = unop (A), binop (s,A) or binop (A,s)
@@ -0,0 +1,93 @@
+//------------------------------------------------------------------------------
+// GB_unshare: give a matrix exclusive copies of any shared arrays
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A matrix created by GB_dup_shared (GrB_Matrix_dup with GxB_DUP_SHARING, or
+// GxB_Matrix_snapshot) co-owns its arrays with the original matrix.  Methods
+// that modify an array in place, without replacing it (GB_setElement,
+// removeElement, GB_wait, GB_unjumble, GB_resize, the in-place accumulation
+// kernels, ...), must call this first: any array still shared is replaced by
+// a private copy, so the other owners keep the original content.  This is
+// the "copy" half of copy-on-write, deferred to the first in-place write.
+
+// When nothing in the process is shared, each check is a single load.
+
+#include "GB.h"
+
+//------------------------------------------------------------------------------
+// GB_unshare_array: replace one shared array with a private copy
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_unshare_array
+(
+    void **p,               // array to replace with a private copy
+    size_t *p_size,         // # of bytes allocated for the array
+    int nthreads_max
+)
+{
+    if ((*p) == NULL || !GB_share_shared (*p))
+    {
+        // the array is not shared; nothing to do
+        return (GrB_SUCCESS) ;
+    }
+    size_t size_allocated ;
+    void *pnew = GB_malloc_memory (*p_size, 1, &size_allocated) ;
+    if (pnew == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    GB_memcpy (pnew, *p, *p_size, nthreads_max) ;
+    // drop this matrix's ownership of the shared array
+    GB_free_memory (p, *p_size) ;
+    (*p) = pnew ;
+    (*p_size) = size_allocated ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_unshare
+//------------------------------------------------------------------------------
+
+GrB_Info GB_unshare     // ensure a matrix owns its arrays exclusively
+(
+    GrB_Matrix A        // matrix about to be modified in place
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (A == NULL)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // replace any shared arrays with private copies
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+
+    info = GB_unshare_array ((void **) &(A->p), &(A->p_size), nthreads_max) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    info = GB_unshare_array ((void **) &(A->h), &(A->h_size), nthreads_max) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    info = GB_unshare_array ((void **) &(A->b), &(A->b_size), nthreads_max) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    info = GB_unshare_array ((void **) &(A->i), &(A->i_size), nthreads_max) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    info = GB_unshare_array ((void **) &(A->x), &(A->x_size), nthreads_max) ;
+    if (info != GrB_SUCCESS) return (info) ;
+
+    return (GrB_SUCCESS) ;
+}
+
@@ -56,7 +56,6 @@
 #include "GB_binop.h"
 #include "GB_Pending.h"
 #include "GB_build.h"
-#include "GB_jappend.h"
 #include "GB_scalar_wrap.h"
 
 GrB_Info GB_wait                // finish all pending computations
@@ -77,6 +76,13 @@ GrB_Info GB_wait                // finish all pending computations
 
     ASSERT_MATRIX_OK (A, "A to wait", GB_FLIP (GB0)) ;
 
+    if (GB_DEFERRED (A))
+    {
+        // apply any deferred unary op to the values of A, in place; this must
+        // come first since full and bitmap matrices can also be deferred
+        GB_OK (GB_materialize (A, Werk)) ;
+    }
+
     if (GB_IS_FULL (A) || GB_IS_BITMAP (A))
     { 
         // full and bitmap matrices never have any pending work
@@ -95,6 +101,13 @@ GrB_Info GB_wait                // finish all pending computations
     ASSERT (GB_JUMBLED_OK (A)) ;
     ASSERT (GB_PENDING_OK (A)) ;
 
+    if (GB_ANY_PENDING_WORK (A))
+    { 
+        // finishing the pending work modifies A->i and A->x in place; if any
+        // array of A is shared, replace it with a private copy first
+        GB_OK (GB_unshare (A)) ;
+    }
+
     //--------------------------------------------------------------------------
     // get the zombie and pending count, and burble if work needs to be done
     //--------------------------------------------------------------------------
@@ -148,6 +161,14 @@ GrB_Info GB_wait                // finish all pending computations
         return (info) ;
     }
 
+    //--------------------------------------------------------------------------
+    // the pattern of A is changing: discard its cached row degrees
+    //--------------------------------------------------------------------------
+
+    GB_degree_free (A) ;
+    GB_lookup_cache_free (A) ;
+    GB_fingerprint_clear (A) ;
+
     //--------------------------------------------------------------------------
     // assemble the pending tuples into T
     //--------------------------------------------------------------------------
@@ -333,7 +354,6 @@ GrB_Info GB_wait                // finish all pending computations
     int64_t tjfirst = T->h [0] ;
     int64_t anz0 = 0 ;
     int64_t kA = 0 ;
-    int64_t jlast ;
 
     int64_t *restrict Ap = A->p ;
     int64_t *restrict Ah = A->h ;
@@ -354,47 +374,65 @@ GrB_Info GB_wait                // finish all pending computations
         ASSERT (kA >= 0 && kA <= anvec) ;
         ASSERT (GB_IMPLIES (kA > 0 && kA < anvec, A->h [kA-1] < tjfirst)) ;
         ASSERT (GB_IMPLIES (found, A->h [kA] == tjfirst)) ;
-        jlast = (kA > 0) ? A->h [kA-1] : (-1) ;
     }
     else
     { 
         kA = tjfirst ;
-        jlast = tjfirst - 1 ;
     }
 
-    // anz1 = nnz (A1) = nnz (A (:, kA:end)), the region modified by T
+    // tjlast = last vector in T; A2 = A (:, kA2:end) is the region of A
+    // past the last vector of T, not modified by T
+    int64_t tjlast = T->h [T->nvec-1] ;
+    int64_t kA2 = kA ;
+    if (A->h != NULL)
+    { 
+        // find the first vector in A->h past tjlast
+        int64_t pright = anvec - 1 ;
+        bool found ;
+        GB_SPLIT_BINARY_SEARCH (tjlast+1, A->h, kA2, pright, found) ;
+        // A->h [kA2 ... anvec-1] holds only vectors past tjlast
+        ASSERT (kA2 >= kA && kA2 <= anvec) ;
+        ASSERT (GB_IMPLIES (kA2 < anvec, A->h [kA2] > tjlast)) ;
+    }
+    else
+    { 
+        kA2 = tjlast + 1 ;
+    }
+
+    // anz1 = nnz (A1) = nnz (A (:, kA:kA2-1)), the region modified by T, and
+    // anz2 = nnz (A2) = nnz (A (:, kA2:end)), past the region modified by T
     anz0 = A->p [kA] ;
-    int64_t anz1 = anz - anz0 ;
+    int64_t anz2 = anz - A->p [kA2] ;
+    int64_t anz1 = anz - anz0 - anz2 ;
     bool ignore ;
 
     // A + T will have anz_new entries
     int64_t anz_new = anz + tnz ;       // must have at least this space
 
-    if (2 * anz1 < anz0)
+    if (2 * anz1 < anz0 + anz2)
     {
 
         //----------------------------------------------------------------------
-        // append new tuples to A
+        // splice new tuples into the region of A modified by T
         //----------------------------------------------------------------------
 
-        // A is growing incrementally.  It splits into two parts: A = [A0 A1].
-        // where A0 = A (:, 0:kA-1) and A1 = A (:, kA:end).  The
-        // first part (A0 with anz0 = nnz (A0) entries) is not modified.  The
-        // second part (A1, with anz1 = nnz (A1) entries) overlaps with T.
-        // If anz1 is zero, or small compared to anz0, then it is faster to
-        // leave A0 unmodified, and to update just A1.
+        // A is being updated incrementally.  It splits into three parts:
+        // A = [A0 A1 A2], where A0 = A (:, 0:kA-1) and A2 = A (:, kA2:end)
+        // do not overlap with any vector of T, and A1 = A (:, kA:kA2-1)
+        // covers the vectors modified by T.  A0 is left in place, only the
+        // modified region is rebuilt as S = A1+T, and A2 is shifted to its
+        // new position with a single move.  If the pending tuples touch only
+        // a few vectors, most of the matrix is not rebuilt: the typical
+        // cases are a stream of updates past the end of A (A2 and often A1
+        // empty), or a batch confined to a few vectors in the middle (A0
+        // and A2 large, A1 small).
 
         // TODO: if A also had zombies, GB_selector could pad A so that
         // GB_nnz_max (A) is equal to anz + tnz.
 
-        // make sure A has enough space for the new tuples
-        if (anz_new > GB_nnz_max (A))
-        { 
-            // double the size if not enough space
-            GB_OK (GB_ix_realloc (A, 2 * anz_new)) ;
-            Ai = A->i ;
-            Ax = (GB_void *) A->x ;
-        }
+        // If A does not have enough space for the new tuples, it is grown
+        // below, after S = A1+T is computed: growing it here would copy all
+        // of A, including the region about to be overwritten by T.
 
         //----------------------------------------------------------------------
         // T = A1 + T
@@ -404,18 +442,18 @@ GrB_Info GB_wait                // finish all pending computations
         {
 
             //------------------------------------------------------------------
-            // extract A1 = A (:, kA:end) as a shallow copy
+            // extract A1 = A (:, kA:kA2-1) as a shallow copy
             //------------------------------------------------------------------
 
-            // A1 = [0, A (:, kA:end)], hypersparse with same dimensions as A
+            // A1 = [0, A (:, kA:kA2-1)], hypersparse with same dims as A
             GB_CLEAR_STATIC_HEADER (A1, &A1_header) ;
             GB_OK (GB_new (&A1, // hyper, existing header
                 A->type, A->vlen, A->vdim, GB_Ap_malloc, A->is_csc,
-                GxB_HYPERSPARSE, GB_ALWAYS_HYPER, anvec - kA)) ;
+                GxB_HYPERSPARSE, GB_ALWAYS_HYPER, kA2 - kA)) ;
 
-            // the A1->i and A1->x content are shallow copies of A(:,kA:end).
-            // They are not allocated pointers, but point to space inside
-            // Ai and Ax.
+            // the A1->i and A1->x content are shallow copies of
+            // A(:,kA:kA2-1).  They are not allocated pointers, but point to
+            // space inside Ai and Ax.
 
             A1->x = (void *) (Ax + (A_iso ? 0 : (asize * anz0))) ;
             A1->x_size = (A_iso ? 1 : anz1) * asize  ;
@@ -429,7 +467,7 @@ GrB_Info GB_wait                // finish all pending computations
             int64_t *restrict A1p = A1->p ;
             int64_t *restrict A1h = A1->h ;
             int64_t a1nvec = 0 ;
-            for (int64_t k = kA ; k < anvec ; k++)
+            for (int64_t k = kA ; k < kA2 ; k++)
             {
                 // get A (:,k)
                 int64_t pA_start = Ap [k] ;
@@ -474,58 +512,184 @@ GrB_Info GB_wait                // finish all pending computations
             T = S ;
             S = NULL ;
             tnz = GB_nnz (T) ;
+        }
+
+        //----------------------------------------------------------------------
+        // move A2 to its new position, growing A if needed
+        //----------------------------------------------------------------------
+
+        // T now holds all tnz entries of the modified region, assembled.
+        // The union can only grow: tnz >= anz1, so A2 shifts up by delta.
+
+        int64_t delta = tnz - anz1 ;
+        ASSERT (delta >= 0) ;
+        anz_new = anz + delta ;
+
+        int nthreads = GB_nthreads (tnz + anz2, chunk, nthreads_max) ;
+
+        if (anz_new > GB_nnz_max (A))
+        {
 
             //------------------------------------------------------------------
-            // remove A1 from the vectors of A, if A is hypersparse
+            // grow A: copy only A0 and A2, placed at their final positions
             //------------------------------------------------------------------
 
-            if (A->h != NULL)
+            // Fresh space is allocated instead of reallocating A->i and
+            // A->x, which would copy all of A (including the stale region
+            // [anz0, anz0+anz1) about to be overwritten by T) and then move
+            // A2 a second time.  Only the untouched prefix A0 and the
+            // suffix A2 are copied, with A2 going directly to its final
+            // position; T is copied into the gap below.
+
+            int64_t nzmax_new = GB_IMIN (2 * anz_new, GB_NMAX) ;
+            if (anz_new > GB_NMAX)
+            { 
+                // problem too large
+                GB_FREE_ALL ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+            int64_t *Ai_new = NULL ; size_t Ai_new_size = 0 ;
+            GB_void *Ax_new = NULL ; size_t Ax_new_size = 0 ;
+            Ai_new = GB_MALLOC (nzmax_new, int64_t, &Ai_new_size) ;
+            Ax_new = GB_MALLOC ((A_iso ? 1 : nzmax_new) * asize, GB_void,
+                &Ax_new_size) ;
+            if (Ai_new == NULL || Ax_new == NULL)
+            { 
+                // out of memory
+                GB_FREE (&Ai_new, Ai_new_size) ;
+                GB_FREE (&Ax_new, Ax_new_size) ;
+                GB_FREE_ALL ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+            GB_memcpy (Ai_new, Ai, anz0 * sizeof (int64_t), nthreads) ;
+            GB_memcpy (Ai_new + anz0 + tnz, Ai + anz0 + anz1,
+                anz2 * sizeof (int64_t), nthreads) ;
+            if (A_iso)
+            { 
+                memcpy (Ax_new, Ax, asize) ;
+            }
+            else
             { 
-                A->nvec = kA ;
+                GB_memcpy (Ax_new, Ax, anz0 * asize, nthreads) ;
+                GB_memcpy (Ax_new + (anz0 + tnz) * asize,
+                    Ax + (anz0 + anz1) * asize, anz2 * asize, nthreads) ;
+            }
+            GB_FREE (&(A->i), A->i_size) ;
+            GB_FREE (&(A->x), A->x_size) ;
+            A->i = Ai_new ; A->i_size = Ai_new_size ;
+            A->x = Ax_new ; A->x_size = Ax_new_size ;
+            Ai = A->i ;
+            Ax = (GB_void *) A->x ;
+
+        }
+        else if (anz2 > 0 && delta != 0)
+        { 
+            // A has enough space already; the old and new positions of A2
+            // may overlap, so use memmove
+            memmove (Ai + anz0 + tnz, Ai + anz0 + anz1,
+                anz2 * sizeof (int64_t)) ;
+            if (!A_iso)
+            { 
+                memmove (Ax + (anz0 + tnz) * asize,
+                    Ax + (anz0 + anz1) * asize, anz2 * asize) ;
             }
         }
 
         //----------------------------------------------------------------------
-        // append T to the end of A0
+        // copy T into the modified region of A
+        //----------------------------------------------------------------------
+
+        GB_memcpy (Ai + anz0, T->i, tnz * sizeof (int64_t), nthreads) ;
+        if (!A_iso)
+        { 
+            const GB_void *restrict Tx = (GB_void *) T->x ;
+            GB_memcpy (Ax + anz0 * asize, Tx, tnz * asize, nthreads) ;
+        }
+
+        //----------------------------------------------------------------------
+        // splice the vectors of T into A->p and A->h
         //----------------------------------------------------------------------
 
         const int64_t *restrict Tp = T->p ;
         const int64_t *restrict Th = T->h ;
-        const int64_t *restrict Ti = T->i ;
         int64_t tnvec = T->nvec ;
 
-        anz = anz0 ;
-        int64_t anz_last = anz ;
-    
-        int nthreads = GB_nthreads (tnz, chunk, nthreads_max) ;
-
-        // append the indices and values of T to the end of A
-        GB_memcpy (Ai + anz, Ti, tnz * sizeof (int64_t), nthreads) ;
-        if (!A_iso)
+        if (Ah != NULL)
         {
-            const GB_void *restrict Tx = (GB_void *) T->x ;
-            GB_memcpy (Ax + anz * asize, Tx, tnz * asize, nthreads) ;
+
+            //------------------------------------------------------------------
+            // A is hypersparse: replace A->h [kA:kA2-1] with vectors of T
+            //------------------------------------------------------------------
+
+            int64_t anvec_new = kA + tnvec + (anvec - kA2) ;
+            if (anvec_new > A->plen)
+            { 
+                GB_OK (GB_hyper_realloc (A, anvec_new, Werk)) ;
+                Ap = A->p ;
+                Ah = A->h ;
+            }
+
+            // move the vectors of A2; the old and new regions may overlap
+            memmove (Ah + kA + tnvec, Ah + kA2,
+                (anvec - kA2) * sizeof (int64_t)) ;
+            memmove (Ap + kA + tnvec, Ap + kA2,
+                (anvec - kA2 + 1) * sizeof (int64_t)) ;
+
+            // insert the vectors of T
+            for (int64_t k = 0 ; k < tnvec ; k++)
+            { 
+                Ah [kA + k] = Th [k] ;
+                Ap [kA + k] = anz0 + Tp [k] ;
+            }
+
+            // shift the vector pointers of A2
+            for (int64_t k = kA + tnvec ; k <= anvec_new ; k++)
+            { 
+                Ap [k] += delta ;
+            }
+            A->nvec = anvec_new ;
         }
+        else
+        {
 
-        // append the vectors of T to the end of A
-        for (int64_t k = 0 ; k < tnvec ; k++)
-        { 
-            int64_t j = Th [k] ;
-            ASSERT (j >= tjfirst) ;
-            anz += (Tp [k+1] - Tp [k]) ;
-            GB_OK (GB_jappend (A, j, &jlast, anz, &anz_last, Werk)) ;
+            //------------------------------------------------------------------
+            // A is sparse: expand the vectors of T into A->p
+            //------------------------------------------------------------------
+
+            int64_t pT = anz0 ;
+            int64_t kT = 0 ;
+            for (int64_t j = tjfirst ; j <= tjlast ; j++)
+            {
+                Ap [j] = pT ;
+                if (kT < tnvec && Th [kT] == j)
+                { 
+                    pT += (Tp [kT+1] - Tp [kT]) ;
+                    kT++ ;
+                }
+            }
+            ASSERT (pT == anz0 + tnz) ;
+
+            // shift the vector pointers of A2
+            int64_t j ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (j = tjlast+1 ; j <= anvec ; j++)
+            { 
+                Ap [j] += delta ;
+            }
         }
 
-        GB_jwrapup (A, jlast, anz) ;
-        ASSERT (anz == anz_new) ;
+        A->nvals = anz_new ;
 
         // need to recompute the # of non-empty vectors in GB_conform
         A->nvec_nonempty = -1 ;     // recomputed just below
 
-        // A->h has been modified so A->Y is now invalid
-        GB_hyper_hash_free (A) ;
+        // A->h and/or A->p have been modified, so A->Y is updated in place
+        // to reflect the splice, keeping it warm for subsequent lookups
+        // rather than rebuilding it from scratch (if A is sparse it has no
+        // A->Y and this does nothing)
+        GB_OK (GB_hyper_hash_update (A, kA, kA2, anvec, Werk)) ;
 
-        ASSERT_MATRIX_OK (A, "A after GB_wait:append", GB0) ;
+        ASSERT_MATRIX_OK (A, "A after GB_wait:splice", GB0) ;
 
         GB_Matrix_free (&T) ;
 
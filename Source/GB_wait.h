@@ -29,6 +29,12 @@ GrB_Info GB_unjumble        // unjumble a matrix
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_materialize     // apply any deferred unary op, in place
+(
+    GrB_Matrix A,           // matrix with a deferred unary op
+    GB_Werk Werk
+) ;
+
 // wait if condition holds
 #define GB_WAIT_IF(condition,A,name)                                    \
 {                                                                       \
@@ -42,15 +48,20 @@ GrB_Info GB_unjumble        // unjumble a matrix
 // do all pending work:  zombies, pending tuples, and unjumble
 #define GB_MATRIX_WAIT(A) GB_WAIT_IF (GB_ANY_PENDING_WORK (A), A, GB_STR (A))
 
+// A deferred unary op must be applied before the values of A are read, so
+// the three partial conditions below also wait if GB_DEFERRED (A) is true.
+
 // do all pending work if pending tuples; zombies and jumbled are OK
-#define GB_MATRIX_WAIT_IF_PENDING(A) GB_WAIT_IF (GB_PENDING (A), A, GB_STR (A))
+#define GB_MATRIX_WAIT_IF_PENDING(A)                                    \
+    GB_WAIT_IF (GB_PENDING (A) || GB_DEFERRED (A), A, GB_STR (A))
 
 // delete zombies and assemble any pending tuples; jumbled is O
 #define GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES(A)                         \
-    GB_WAIT_IF (GB_PENDING_OR_ZOMBIES (A), A, GB_STR (A))
+    GB_WAIT_IF (GB_PENDING_OR_ZOMBIES (A) || GB_DEFERRED (A), A, GB_STR (A))
 
 // ensure A is not jumbled
-#define GB_MATRIX_WAIT_IF_JUMBLED(A) GB_WAIT_IF (GB_JUMBLED (A), A, GB_STR (A))
+#define GB_MATRIX_WAIT_IF_JUMBLED(A)                                    \
+    GB_WAIT_IF (GB_JUMBLED (A) || GB_DEFERRED (A), A, GB_STR (A))
 
 #endif
 
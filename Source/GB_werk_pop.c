@@ -34,8 +34,14 @@ GB_CALLBACK_WERK_POP_PROTO (GB_werk_pop)
         Werk->pwerk = ((GB_void *) p) - Werk->Stack ;
         (*size_allocated) = 0 ;
     }
+    else if (GB_Context_arena_pop (p, *size_allocated))
+    {
+        // werkspace was allocated from the arena of the Context engaged to
+        // this user thread; it has been popped off the arena
+        (*size_allocated) = 0 ;
+    }
     else
-    { 
+    {
         // werkspace was allocated from malloc
         GB_free_memory (&p, *size_allocated) ;
     }
@@ -10,7 +10,8 @@
 #include "GB.h"
 
 // The werkspace is allocated from the Werk static if it small enough and space
-// is available.  Otherwise it is allocated by malloc.
+// is available.  Otherwise it is allocated from the arena of the Context
+// engaged to this user thread (if any), or by malloc.
 
 GB_CALLBACK_WERK_PUSH_PROTO (GB_werk_push)
 {
@@ -60,8 +61,19 @@ GB_CALLBACK_WERK_PUSH_PROTO (GB_werk_push)
         return ((void *) p) ;
     }
     else
-    { 
-        // allocate the werkspace from malloc
+    {
+        // try to allocate the werkspace from the arena of the Context engaged
+        // to this user thread, if any (GB_werk_pop finds such werkspaces by
+        // their address, so on_stack remains false)
+        if (GB_size_t_multiply (&size, nitems, GB_IMAX (1, size_of_item)))
+        {
+            void *p = GB_Context_arena_push (size_allocated, size) ;
+            if (p != NULL)
+            {
+                return (p) ;
+            }
+        }
+        // otherwise, allocate the werkspace from malloc
         return (GB_malloc_memory (nitems, size_of_item, size_allocated)) ;
     }
 }
@@ -0,0 +1,160 @@
+//------------------------------------------------------------------------------
+// GB_window: construct a shallow window view of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// V = A (:, kbegin:kend-1) if A is held by column, or A (kbegin:kend-1, :) if
+// A is held by row, as a shallow view.  V->i and V->x (and V->b if A is
+// bitmap) are shallow pointers into the parent's arrays, offset to the start
+// of the window; only the vector pointers V->p are allocated.  Creating the
+// view thus takes time and memory proportional to the # of vectors in the
+// window, not the # of entries it covers.  Compare GB_split, which copies
+// each tile, and GB_hyper_shallow, which builds similar internal views.
+
+// The view is strictly read-only.  Freeing V never frees the parent's arrays,
+// since all of its large content is flagged as shallow.  GraphBLAS does not
+// reference-count the shared arrays, so the parent must not be modified or
+// freed while any view of it is in use; that is the caller's responsibility.
+
+#include "GB_split.h"
+
+#define GB_FREE_ALL GB_Matrix_free (V) ;
+
+GrB_Info GB_window                  // construct a shallow window view of A
+(
+    GrB_Matrix *V,              // output: shallow view of A, as a new matrix
+    const GrB_Matrix A,         // input matrix to view
+    const int64_t kbegin,       // first vector of the window
+    const int64_t kend,         // last vector of the window, plus one
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (V != NULL && (*V) == NULL) ;
+    ASSERT_MATRIX_OK (A, "A input for GB_window", GB0) ;
+    ASSERT (kbegin >= 0 && kbegin <= kend && kend <= A->vdim) ;
+    GB_MATRIX_WAIT (A) ;
+
+    if (GB_IS_HYPERSPARSE (A))
+    { 
+        // the vectors of a hypersparse matrix cannot be located in O(1) time;
+        // convert the parent to sparse first to create windows of it
+        GB_ERROR (GrB_NOT_IMPLEMENTED, "%s",
+            "windows of a hypersparse matrix are not supported") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get inputs
+    //--------------------------------------------------------------------------
+
+    const int64_t vlen = A->vlen ;
+    const int64_t wdim = kend - kbegin ;
+    const size_t asize = A->type->size ;
+    const bool A_iso = A->iso ;
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    GBURBLE ("(%swindow) ", A_iso ? "iso " : "") ;
+
+    //--------------------------------------------------------------------------
+    // construct the view
+    //--------------------------------------------------------------------------
+
+    if (GB_IS_SPARSE (A))
+    {
+
+        //----------------------------------------------------------------------
+        // shallow window of a sparse matrix
+        //----------------------------------------------------------------------
+
+        const int64_t *restrict Ap = A->p ;
+        const int64_t aps = Ap [kbegin] ;
+        GB_OK (GB_new (V, // sparse, new header
+            A->type, vlen, wdim, GB_Ap_malloc, A->is_csc, GxB_SPARSE,
+            A->hyper_switch, wdim)) ;
+        GrB_Matrix W = (*V) ;
+        // rebase the vector pointers of the window so that Wp [0] is zero
+        int64_t *restrict Wp = W->p ;
+        int nth = GB_nthreads (wdim, chunk, nthreads_max) ;
+        int64_t k ;
+        #pragma omp parallel for num_threads(nth) schedule(static)
+        for (k = 0 ; k <= wdim ; k++)
+        { 
+            Wp [k] = Ap [kbegin + k] - aps ;
+        }
+        W->i = A->i + aps ;
+        W->i_shallow = true ; W->i_size = A->i_size ;
+        W->x = ((GB_void *) A->x) + (A_iso ? 0 : aps * asize) ;
+        W->x_shallow = true ; W->x_size = A->x_size ;
+        W->iso = A_iso ;    // OK: window is iso if the parent is iso
+        W->nvals = Ap [kend] - aps ;
+        W->magic = GB_MAGIC ;
+        W->nvec_nonempty = GB_nvec_nonempty (W) ;
+
+    }
+    else if (GB_IS_BITMAP (A))
+    {
+
+        //----------------------------------------------------------------------
+        // shallow window of a bitmap matrix
+        //----------------------------------------------------------------------
+
+        GB_OK (GB_new (V, // bitmap, new header
+            A->type, vlen, wdim, GB_Ap_null, A->is_csc, GxB_BITMAP,
+            A->hyper_switch, 0)) ;
+        GrB_Matrix W = (*V) ;
+        const int8_t *restrict Ab = A->b + kbegin * vlen ;
+        W->b = (int8_t *) Ab ;
+        W->b_shallow = true ; W->b_size = A->b_size ;
+        W->x = ((GB_void *) A->x) + (A_iso ? 0 : kbegin * vlen * asize) ;
+        W->x_shallow = true ; W->x_size = A->x_size ;
+        W->iso = A_iso ;    // OK: window is iso if the parent is iso
+        // count the entries in the window
+        const int64_t wnz_held = wdim * vlen ;
+        int nth = GB_nthreads (wnz_held, chunk, nthreads_max) ;
+        int64_t wnz = 0, p ;
+        #pragma omp parallel for num_threads(nth) schedule(static) \
+            reduction(+:wnz)
+        for (p = 0 ; p < wnz_held ; p++)
+        { 
+            wnz += (Ab [p] != 0) ;
+        }
+        W->nvals = wnz ;
+        W->nvec_nonempty = -1 ;     // not yet known
+        W->magic = GB_MAGIC ;
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // shallow window of a full matrix
+        //----------------------------------------------------------------------
+
+        ASSERT (GB_IS_FULL (A)) ;
+        GB_OK (GB_new (V, // full, new header
+            A->type, vlen, wdim, GB_Ap_null, A->is_csc, GxB_FULL,
+            A->hyper_switch, 0)) ;
+        GrB_Matrix W = (*V) ;
+        W->x = ((GB_void *) A->x) + (A_iso ? 0 : kbegin * vlen * asize) ;
+        W->x_shallow = true ; W->x_size = A->x_size ;
+        W->iso = A_iso ;    // OK: window is iso if the parent is iso
+        W->magic = GB_MAGIC ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (*V, "V shallow window view from GB_window", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
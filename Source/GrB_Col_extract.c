@@ -74,6 +74,7 @@ GrB_Info GrB_Col_extract        // w<M> = accum (w, A(I,j)) or (A(j,I))'
         A,                 A_transpose, // A and its descriptor
         I, ni,                          // row indices I and length ni
         J, 1,                           // one column index, nj = 1
+        NULL, NULL,                 // no cached index lists
         Werk) ;
 
     GB_BURBLE_END ;
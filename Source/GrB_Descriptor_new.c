@@ -52,6 +52,7 @@ GrB_Info GrB_Descriptor_new     // create a new descriptor
     desc->do_sort = false ;        // do not sort in GrB_mxm and others
     desc->compression = GxB_DEFAULT ;
     desc->import = GxB_DEFAULT ;   // trust input data in GxB import/deserialize
+    desc->mxm_pattern_reuse = false ;  // do not reuse C's pattern in GrB_mxm
     return (GrB_SUCCESS) ;
 }
 
@@ -31,7 +31,16 @@ GrB_Info GrB_Matrix_dup     // make an exact copy of a matrix
     // duplicate the matrix
     //--------------------------------------------------------------------------
 
-    GrB_Info info = GB_dup (C, A, Werk) ;
+    GrB_Info info ;
+    if (GB_Global_dup_sharing_get ( ))
+    { 
+        // C = A in O(1) time, sharing the arrays of A (see GxB_DUP_SHARING)
+        info = GB_dup_shared (C, A, Werk) ;
+    }
+    else
+    { 
+        info = GB_dup (C, A, Werk) ;
+    }
     GB_BURBLE_END ;
     return (info) ;
 }
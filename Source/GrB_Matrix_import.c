@@ -268,7 +268,7 @@ static GrB_Info GB_import_worker   // import a matrix of any type
                 // allocate the header for A
                 GB_OK (GB_new (A, // new header
                     type, vlen, vdim, GB_Ap_null, is_csc, GxB_AUTO_SPARSITY,
-                    GB_Global_hyper_switch_get ( ), 0)) ;
+                    GB_Context_hyper_switch ( ), 0)) ;
 
                 // build A from the input triplets
                 GB_OK (GB_builder (
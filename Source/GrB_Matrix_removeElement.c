@@ -51,6 +51,10 @@ static inline bool GB_removeElement     // return true if found
             // C(i,j) is present; remove it
             Cb [p] = 0 ;
             C->nvals-- ;
+            // the pattern of C has changed
+            GB_degree_free (C) ;
+            GB_lookup_cache_free (C) ;
+            GB_fingerprint_clear (C) ;
         }
         // C(i,j) is always found, whether present or not
         return (true) ;
@@ -156,6 +160,18 @@ GrB_Info GB_Matrix_removeElement
 )
 {
 
+    //--------------------------------------------------------------------------
+    // if any array of C is shared, replace it with a private copy
+    //--------------------------------------------------------------------------
+
+    {
+        GrB_Info info = GB_unshare (C) ;
+        if (info != GrB_SUCCESS)
+        {
+            return (info) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // if C is jumbled, wait on the matrix first.  If full, convert to nonfull
     //--------------------------------------------------------------------------
@@ -45,6 +45,22 @@ GrB_Info GrB_Row_assign             // C<M'>(row,Cols) += u'
     // get the mask
     GrB_Matrix M = GB_get_mask ((GrB_Matrix) M_in, &Mask_comp, &Mask_struct) ;
 
+    //--------------------------------------------------------------------------
+    // C(row,:) = u': try the row-splice fast path
+    //--------------------------------------------------------------------------
+
+    if (M == NULL && accum == NULL && !Mask_comp)
+    {
+        // with no mask and no accum, u completely replaces the old row; if C
+        // is sparse and held by row and u is dense, this is a segment splice
+        info = GB_row_assign_splice (C, row, Cols, nCols, u, Werk) ;
+        if (info != GrB_NO_VALUE)
+        { 
+            GB_BURBLE_END ;
+            return (info) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // C<M'>(row,Cols) = accum (C(row,Cols), u')
     //--------------------------------------------------------------------------
@@ -31,6 +31,11 @@ GrB_Info GrB_Scalar_dup     // make an exact copy of a GrB_Scalar
     // duplicate the GrB_Scalar
     //--------------------------------------------------------------------------
 
+    if (GB_Global_dup_sharing_get ( ))
+    { 
+        // s = t in O(1) time, sharing the arrays of t (see GxB_DUP_SHARING)
+        return (GB_dup_shared ((GrB_Matrix *) s, (GrB_Matrix) t, Werk)) ;
+    }
     return (GB_dup ((GrB_Matrix *) s, (GrB_Matrix) t, Werk)) ;
 }
 
@@ -32,7 +32,16 @@ GrB_Info GrB_Vector_dup     // make an exact copy of a vector
     // duplicate the vector
     //--------------------------------------------------------------------------
 
-    GrB_Info info = GB_dup ((GrB_Matrix *) w, (GrB_Matrix) u, Werk) ;
+    GrB_Info info ;
+    if (GB_Global_dup_sharing_get ( ))
+    { 
+        // w = u in O(1) time, sharing the arrays of u (see GxB_DUP_SHARING)
+        info = GB_dup_shared ((GrB_Matrix *) w, (GrB_Matrix) u, Werk) ;
+    }
+    else
+    { 
+        info = GB_dup ((GrB_Matrix *) w, (GrB_Matrix) u, Werk) ;
+    }
     GB_BURBLE_END ;
     return (info) ;
 }
@@ -47,7 +47,7 @@ GrB_Info GrB_Vector_new     // create a new vector with no entries
     info = GB_new ((GrB_Matrix *) v, // new user header
         type, vlen, 1, GB_Ap_calloc,
         true,  // a GrB_Vector is always held by-column
-        GxB_SPARSE, GB_Global_hyper_switch_get ( ), 1) ;
+        GxB_SPARSE, GB_Context_hyper_switch ( ), 1) ;
     ASSERT (GB_IMPLIES (info == GrB_SUCCESS, GB_VECTOR_OK (*v))) ;
     return (info) ;
 }
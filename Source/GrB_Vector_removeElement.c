@@ -48,6 +48,10 @@ static inline bool GB_removeElement     // returns true if found
             // V(i) is present; remove it
             Vb [i] = 0 ;
             V->nvals-- ;
+            // the pattern of V has changed
+            GB_degree_free ((GrB_Matrix) V) ;
+            GB_lookup_cache_free ((GrB_Matrix) V) ;
+            GB_fingerprint_clear ((GrB_Matrix) V) ;
         }
         // V(i) is always found, whether present or not
         return (true) ;
@@ -110,6 +114,18 @@ GrB_Info GB_Vector_removeElement
 )
 {
 
+    //--------------------------------------------------------------------------
+    // if any array of V is shared, replace it with a private copy
+    //--------------------------------------------------------------------------
+
+    {
+        GrB_Info info = GB_unshare ((GrB_Matrix) V) ;
+        if (info != GrB_SUCCESS)
+        {
+            return (info) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // if V is jumbled, wait on the vector first.  If full, convert to nonfull
     //--------------------------------------------------------------------------
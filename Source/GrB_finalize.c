@@ -14,10 +14,17 @@
 
 #include "GB.h"
 #include "GB_jitifyer.h"
+#include "GB_AxB_saxpy3_plan.h"
 
 GrB_Info GrB_finalize ( )
-{ 
+{
+    GB_AxB_saxpy3_plan_finalize ( ) ;
     GB_jitifyer_finalize ( ) ;
+    GB_pool_finalize ( ) ;
+    GB_spill_finalize ( ) ;
+    GB_share_finalize ( ) ;
+    GB_prof_finalize ( ) ;
+    GB_autotune_finalize ( ) ;
     return (GrB_SUCCESS) ;
 }
 
@@ -46,6 +46,33 @@ GrB_Info GrB_mxm                    // C<M> = accum (C, A*B)
     // get the mask
     GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
 
+    //--------------------------------------------------------------------------
+    // pattern-reuse mode: redo only the numeric work
+    //--------------------------------------------------------------------------
+
+    // If the caller asserts, via the GxB_MXM_PATTERN_REUSE descriptor field,
+    // that the pattern of A*B is identical to the pattern already held in C
+    // (as in an iterative solver where only the values of A and B change
+    // across iterations), then C's own pattern is used as a structural mask.
+    // The dot3 method then computes only the entries in that pattern, and the
+    // symbolic work of constructing C's pattern from scratch is skipped.
+    // This mode applies only when no mask and no accum are in use.  If the
+    // caller's assertion does not hold, the result is still well-defined: it
+    // is C<C,structural> = A*B, which differs from a full recomputation.
+
+    if (desc != NULL && desc->mxm_pattern_reuse && M == NULL && accum == NULL
+        && !C_replace && GB_nnz (C) > 0)
+    {
+        GBURBLE ("(mxm pattern reuse) ") ;
+        M = C ;
+        Mask_comp = false ;
+        Mask_struct = true ;
+        if (AxB_method == GxB_DEFAULT)
+        {
+            AxB_method = GxB_AxB_DOT ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // C<M> = accum (C,A*B) and variations, using the mxm kernel
     //--------------------------------------------------------------------------
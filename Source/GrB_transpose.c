@@ -71,6 +71,8 @@ GrB_Info GrB_transpose              // C<M> = accum(C,A') or accum(C,A)
 
     // quick return if an empty mask is complemented
     GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp, Mask_struct) ;
+    // quick return if a non-complemented mask has no entries
+    GB_RETURN_IF_EMPTY_MASK (C, C_replace, M, Mask_comp) ;
 
     //--------------------------------------------------------------------------
     // T = A or A', where T can have the type of C or the type of A
@@ -0,0 +1,39 @@
+//------------------------------------------------------------------------------
+// GxB_Context_allocator_get: get the allocator of a Context
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB.h"
+
+GrB_Info GxB_Context_allocator_get  // get the allocator of a Context
+(
+    GxB_Context Context,            // Context to query
+    GxB_alloc_function *alloc_func,     // allocation function
+    GxB_dealloc_function *dealloc_func, // deallocation function
+    void **allocator_state          // state of the allocator
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Context_allocator_get (Context, &alloc_func,"
+        " &dealloc_func, &allocator_state)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (Context) ;
+    GB_RETURN_IF_NULL (alloc_func) ;
+    GB_RETURN_IF_NULL (dealloc_func) ;
+    GB_RETURN_IF_NULL (allocator_state) ;
+
+    //--------------------------------------------------------------------------
+    // get the allocator
+    //--------------------------------------------------------------------------
+
+    GB_Context_allocator_get (Context, alloc_func, dealloc_func,
+        allocator_state) ;
+    return (GrB_SUCCESS) ;
+}
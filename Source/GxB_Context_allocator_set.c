@@ -0,0 +1,46 @@
+//------------------------------------------------------------------------------
+// GxB_Context_allocator_set: set the allocator of a Context
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// While this Context is engaged to a user thread, all memory allocated and
+// freed by that thread uses alloc_func and dealloc_func in place of the
+// global malloc/free functions of GxB_init.  All Context allocators and the
+// global malloc/free must share a single underlying heap (such as jemalloc
+// arenas), since a block may be allocated and freed under different engaged
+// Contexts.  Both functions must be given, or both NULL to remove the
+// allocator.  GxB_CONTEXT_WORLD cannot be given an allocator.
+
+// The allocator must not be changed while the Context is engaged to any user
+// thread that has a GraphBLAS operation in progress.
+
+#include "GB.h"
+
+GrB_Info GxB_Context_allocator_set  // set the allocator of a Context
+(
+    GxB_Context Context,            // Context to modify
+    GxB_alloc_function alloc_func,      // allocation function
+    GxB_dealloc_function dealloc_func,  // deallocation function
+    void *allocator_state           // passed to alloc_func/dealloc_func
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Context_allocator_set (Context, alloc_func, dealloc_func,"
+        " allocator_state)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (Context) ;
+
+    //--------------------------------------------------------------------------
+    // set the allocator
+    //--------------------------------------------------------------------------
+
+    return (GB_Context_allocator_set (Context, alloc_func, dealloc_func,
+        allocator_state)) ;
+}
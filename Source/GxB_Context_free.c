@@ -36,6 +36,10 @@ GrB_Info GxB_Context_free           // free a Context
             size_t header_size = Context->header_size ;
             if (header_size > 0)
             { 
+                // free the arena, if any
+                GB_FREE (&(Context->arena), Context->arena_size) ;
+                Context->arena_size = 0 ;
+                Context->arena_top = 0 ;
                 Context->magic = GB_FREED ;  // to help detect dangling pointers
                 Context->header_size = 0 ;
                 GB_FREE (Context_handle, header_size) ;
@@ -46,6 +46,31 @@ GrB_Info GxB_Context_get_INT32      // get a parameter of a Context
             (*value) = GB_Context_gpu_id_get (Context) ;
             break ;
 
+        case GxB_CONTEXT_NUMA :
+
+            (*value) = GB_Context_numa_get (Context) ;
+            break ;
+
+        case GxB_CONTEXT_CONCURRENCY :
+
+            (*value) = GB_Context_concurrency_get (Context) ;
+            break ;
+
+        case GxB_CONTEXT_CANCEL :
+
+            (*value) = (int32_t) GB_Context_cancelled_get (Context) ;
+            break ;
+
+        case GxB_CONTEXT_ARENA_SIZE :
+
+            (*value) = (int32_t) GB_Context_arena_size_get (Context) ;
+            break ;
+
+        case GxB_CONTEXT_STREAM_THRESHOLD :
+
+            (*value) = (int32_t) GB_Context_stream_threshold_get (Context) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -146,6 +171,61 @@ GrB_Info GxB_Context_get            // get a parameter in a Context
             }
             break ;
 
+        case GxB_CONTEXT_NUMA :
+
+            {
+                va_start (ap, field) ;
+                int *value = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (value) ;
+                (*value) = GB_Context_numa_get (Context) ;
+            }
+            break ;
+
+        case GxB_CONTEXT_CONCURRENCY :
+
+            {
+                va_start (ap, field) ;
+                int *value = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (value) ;
+                (*value) = GB_Context_concurrency_get (Context) ;
+            }
+            break ;
+
+        case GxB_CONTEXT_CANCEL :
+
+            {
+                va_start (ap, field) ;
+                int *value = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (value) ;
+                (*value) = (int) GB_Context_cancelled_get (Context) ;
+            }
+            break ;
+
+        case GxB_CONTEXT_ARENA_SIZE :
+
+            {
+                va_start (ap, field) ;
+                int *value = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (value) ;
+                (*value) = (int) GB_Context_arena_size_get (Context) ;
+            }
+            break ;
+
+        case GxB_CONTEXT_STREAM_THRESHOLD :
+
+            {
+                va_start (ap, field) ;
+                int *value = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (value) ;
+                (*value) = (int) GB_Context_stream_threshold_get (Context) ;
+            }
+            break ;
+
         case GxB_CONTEXT_CHUNK :            // same as GxB_CHUNK
 
             {
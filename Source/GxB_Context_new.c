@@ -44,8 +44,40 @@ GrB_Info GxB_Context_new            // create a new Context
 
     // initialize the Context with the same settings as GxB_CONTEXT_WORLD
     Context->nthreads_max = GB_Context_nthreads_max_get (NULL) ;
+    // re-check the cgroup CPU quota, which can change while the process
+    // runs (a container can be resized); cap the inherited default at the
+    // current quota.  GxB_set (Context, GxB_NTHREADS, ...) can still raise it.
+    int cgroup_cpus = GB_omp_cgroup_max_threads ( ) ;
+    if (cgroup_cpus > 0 && Context->nthreads_max > cgroup_cpus)
+    { 
+        Context->nthreads_max = cgroup_cpus ;
+    }
     Context->chunk = GB_Context_chunk_get (NULL) ;
     Context->gpu_id = GB_Context_gpu_id_get (NULL) ;
+    Context->numa = GB_Context_numa_get (NULL) ;
+    Context->concurrency = GB_Context_concurrency_get (NULL) ;
+    memset (Context->slot_time, 0, sizeof (Context->slot_time)) ;
+
+    // no cancellation request is pending; see GxB_CONTEXT_CANCEL
+    Context->cancelled = false ;
+
+    Context->stream_threshold = GB_Context_stream_threshold_get (NULL) ;
+
+    // snapshots of the hot global settings; refreshed each time the Context
+    // is engaged (see GB_Context_engage)
+    Context->burble = GB_Global_burble_get ( ) ;
+    Context->hyper_switch = GB_Global_hyper_switch_get ( ) ;
+
+    // the arena is not inherited from GxB_CONTEXT_WORLD (which never has
+    // one); it is allocated on demand via GxB_CONTEXT_ARENA_SIZE
+    Context->arena = NULL ;
+    Context->arena_size = 0 ;
+    Context->arena_top = 0 ;
+
+    // no per-Context allocator; see GxB_Context_allocator_set
+    Context->alloc_func = NULL ;
+    Context->dealloc_func = NULL ;
+    Context->allocator_state = NULL ;
 
     // return the result
     (*Context_handle) = Context ;
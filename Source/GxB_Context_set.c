@@ -45,6 +45,38 @@ GrB_Info GxB_Context_set_INT32      // set a parameter in a Context
             GB_Context_gpu_id_set (Context, value) ;
             break ;
 
+        case GxB_CONTEXT_NUMA :
+
+            GB_Context_numa_set (Context, value) ;
+            break ;
+
+        case GxB_CONTEXT_CONCURRENCY :
+
+            GB_Context_concurrency_set (Context, value) ;
+            break ;
+
+        case GxB_CONTEXT_CANCEL :
+
+            GB_Context_cancelled_set (Context, value != 0) ;
+            break ;
+
+        case GxB_CONTEXT_ARENA_SIZE :
+
+            if (value < 0)
+            {
+                return (GrB_INVALID_VALUE) ;
+            }
+            return (GB_Context_arena_size_set (Context, (size_t) value)) ;
+
+        case GxB_CONTEXT_STREAM_THRESHOLD :
+
+            if (value < 0)
+            {
+                return (GrB_INVALID_VALUE) ;
+            }
+            GB_Context_stream_threshold_set (Context, (size_t) value) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -140,6 +172,36 @@ GrB_Info GxB_Context_set            // set a parameter in a Context
             }
             break ;
 
+        case GxB_CONTEXT_NUMA :
+
+            {
+                va_start (ap, field) ;
+                int value = va_arg (ap, int) ;
+                GB_Context_numa_set (Context, value) ;
+                va_end (ap) ;
+            }
+            break ;
+
+        case GxB_CONTEXT_CONCURRENCY :
+
+            {
+                va_start (ap, field) ;
+                int value = va_arg (ap, int) ;
+                GB_Context_concurrency_set (Context, value) ;
+                va_end (ap) ;
+            }
+            break ;
+
+        case GxB_CONTEXT_CANCEL :
+
+            {
+                va_start (ap, field) ;
+                int value = va_arg (ap, int) ;
+                GB_Context_cancelled_set (Context, value != 0) ;
+                va_end (ap) ;
+            }
+            break ;
+
         case GxB_CONTEXT_CHUNK :            // same as GxB_CHUNK
 
             {
@@ -150,6 +212,33 @@ GrB_Info GxB_Context_set            // set a parameter in a Context
             }
             break ;
 
+        case GxB_CONTEXT_ARENA_SIZE :
+
+            {
+                va_start (ap, field) ;
+                int value = va_arg (ap, int) ;
+                va_end (ap) ;
+                if (value < 0)
+                {
+                    return (GrB_INVALID_VALUE) ;
+                }
+                return (GB_Context_arena_size_set (Context, (size_t) value)) ;
+            }
+
+        case GxB_CONTEXT_STREAM_THRESHOLD :
+
+            {
+                va_start (ap, field) ;
+                int value = va_arg (ap, int) ;
+                va_end (ap) ;
+                if (value < 0)
+                {
+                    return (GrB_INVALID_VALUE) ;
+                }
+                GB_Context_stream_threshold_set (Context, (size_t) value) ;
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -72,6 +72,12 @@ GrB_Info GxB_Desc_get_INT32     // get a parameter from a descriptor
             (*value) = (int32_t) ((desc == NULL) ? GxB_DEFAULT : desc->do_sort);
             break ;
 
+        case GxB_MXM_PATTERN_REUSE : 
+
+            (*value) = (int32_t) ((desc == NULL) ?
+                false : desc->mxm_pattern_reuse) ;
+            break ;
+
         case GxB_COMPRESSION : 
 
             (*value) = (int32_t) ((desc == NULL) ?
@@ -202,6 +208,18 @@ GrB_Info GxB_Desc_get           // get a parameter from a descriptor
             }
             break ;
 
+        case GxB_MXM_PATTERN_REUSE : 
+
+            {
+                va_start (ap, field) ;
+                int *mxm_pattern_reuse = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (mxm_pattern_reuse) ;
+                int s = (desc == NULL) ? false : desc->mxm_pattern_reuse ;
+                (*mxm_pattern_reuse) = s ;
+            }
+            break ;
+
         case GxB_COMPRESSION : 
 
             {
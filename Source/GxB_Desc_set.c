@@ -139,6 +139,11 @@ GrB_Info GxB_Desc_set_INT32     // set a parameter in a descriptor
             desc->do_sort = value ;
             break ;
 
+        case GxB_MXM_PATTERN_REUSE : 
+
+            desc->mxm_pattern_reuse = (bool) value ;
+            break ;
+
         case GxB_COMPRESSION : 
 
             desc->compression = value ;
@@ -323,6 +328,15 @@ GrB_Info GxB_Desc_set           // set a parameter in a descriptor
             }
             break ;
 
+        case GxB_MXM_PATTERN_REUSE : 
+
+            {
+                va_start (ap, field) ;
+                desc->mxm_pattern_reuse = (bool) va_arg (ap, int) ;
+                va_end (ap) ;
+            }
+            break ;
+
         case GxB_COMPRESSION : 
 
             {
@@ -87,11 +87,31 @@ GrB_Info GxB_Global_Option_get_INT32    // gets the current global option
                     GxB_BY_COL : GxB_BY_ROW ;
             break ;
 
-        case GxB_BURBLE : 
+        case GxB_BURBLE :
 
             (*value) = (int32_t) GB_Global_burble_get ( ) ;
             break ;
 
+        case GxB_MXM_PLAN_CACHE :
+
+            (*value) = (int32_t) GB_Global_mxm_plan_cache_get ( ) ;
+            break ;
+
+        case GxB_DUP_SHARING :
+
+            (*value) = (int32_t) GB_Global_dup_sharing_get ( ) ;
+            break ;
+
+        case GxB_PROFILING :
+
+            (*value) = (int32_t) GB_Global_profiling_get ( ) ;
+            break ;
+
+        case GxB_CHUNK_AUTOTUNE :
+
+            (*value) = (int32_t) GB_Global_chunk_autotune_get ( ) ;
+            break ;
+
         case GxB_LIBRARY_OPENMP : 
 
             #ifdef _OPENMP
@@ -111,11 +131,16 @@ GrB_Info GxB_Global_Option_get_INT32    // gets the current global option
             (*value) = (int32_t) GB_jitifyer_get_control ( ) ;
             break ;
 
-        case GxB_JIT_USE_CMAKE : 
+        case GxB_JIT_USE_CMAKE :
 
             (*value) = (int32_t) GB_jitifyer_get_use_cmake ( ) ;
             break ;
 
+        case GxB_JIT_ASYNC :
+
+            (*value) = (int32_t) GB_jitifyer_get_async ( ) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -168,6 +193,21 @@ GrB_Info GxB_Global_Option_get_FP64     // gets the current global option
             (*value) = GB_Context_chunk_get (NULL) ;
             break ;
 
+        case GxB_HUGEPAGE_THRESHOLD :
+
+            (*value) = (double) GB_Global_hugepage_threshold_get ( ) ;
+            break ;
+
+        case GxB_SPILL_THRESHOLD :
+
+            (*value) = (double) GB_Global_spill_threshold_get ( ) ;
+            break ;
+
+        case GxB_MEMORY_IN_USE :
+
+            (*value) = (double) GB_Global_memory_in_use_get ( ) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -211,6 +251,21 @@ GrB_Info GxB_Global_Option_get_INT64    // gets the current global option
             }
             break ;
 
+        case GxB_JIT_KERNEL_HITS :
+
+            GB_jitifyer_get_hits (value) ;
+            break ;
+
+        case GxB_JIT_KERNEL_MISSES :
+
+            GB_jitifyer_get_misses (value) ;
+            break ;
+
+        case GxB_JIT_KERNEL_COMPILES :
+
+            GB_jitifyer_get_compiles (value) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -334,16 +389,26 @@ GrB_Info GxB_Global_Option_get_CHAR     // gets the current global option
             (*value) = GB_jitifyer_get_C_preface ( ) ;
             break ;
 
-        case GxB_JIT_ERROR_LOG : 
+        case GxB_JIT_ERROR_LOG :
 
             (*value) = GB_jitifyer_get_error_log ( ) ;
             break ;
 
+        case GxB_JIT_TRACE :
+
+            (*value) = GB_jitifyer_get_trace ( ) ;
+            break ;
+
         case GxB_JIT_CACHE_PATH : 
 
             (*value) = GB_jitifyer_get_cache_path ( ) ;
             break ;
 
+        case GxB_JIT_CACHE_REMOTE : 
+
+            (*value) = GB_jitifyer_get_remote_path ( ) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -388,6 +453,11 @@ GrB_Info GxB_Global_Option_get_FUNCTION // gets the current global option
             (*value) = (void *) GB_Global_flush_get ( ) ;
             break ;
 
+        case GxB_MEMORY_PRESSURE_FUNCTION : 
+
+            (*value) = (void *) GB_Global_memory_pressure_function_get ( ) ;
+            break ;
+
         case GxB_MALLOC_FUNCTION : 
 
             (*value) = (void *) GB_Global_malloc_function_get ( ) ;
@@ -538,6 +608,39 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        case GxB_HUGEPAGE_THRESHOLD :
+
+            {
+                va_start (ap, field) ;
+                double *value = va_arg (ap, double *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (value) ;
+                (*value) = (double) GB_Global_hugepage_threshold_get ( ) ;
+            }
+            break ;
+
+        case GxB_SPILL_THRESHOLD :
+
+            {
+                va_start (ap, field) ;
+                double *value = va_arg (ap, double *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (value) ;
+                (*value) = (double) GB_Global_spill_threshold_get ( ) ;
+            }
+            break ;
+
+        case GxB_MEMORY_IN_USE :
+
+            {
+                va_start (ap, field) ;
+                double *value = va_arg (ap, double *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (value) ;
+                (*value) = (double) GB_Global_memory_in_use_get ( ) ;
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // memory pool control
         //----------------------------------------------------------------------
@@ -557,6 +660,34 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        //----------------------------------------------------------------------
+        // JIT kernel telemetry
+        //----------------------------------------------------------------------
+
+        case GxB_JIT_KERNEL_HITS :
+        case GxB_JIT_KERNEL_MISSES :
+        case GxB_JIT_KERNEL_COMPILES :
+
+            {
+                va_start (ap, field) ;
+                int64_t *value = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (value) ;
+                if (field == GxB_JIT_KERNEL_HITS)
+                {
+                    GB_jitifyer_get_hits (value) ;
+                }
+                else if (field == GxB_JIT_KERNEL_MISSES)
+                {
+                    GB_jitifyer_get_misses (value) ;
+                }
+                else
+                {
+                    GB_jitifyer_get_compiles (value) ;
+                }
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // SuiteSparse:GraphBLAS version, date, license, etc
         //----------------------------------------------------------------------
@@ -759,6 +890,50 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        case GxB_MXM_PLAN_CACHE :
+
+            {
+                va_start (ap, field) ;
+                bool *mxm_plan_cache = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (mxm_plan_cache) ;
+                (*mxm_plan_cache) = GB_Global_mxm_plan_cache_get ( ) ;
+            }
+            break ;
+
+        case GxB_DUP_SHARING :
+
+            {
+                va_start (ap, field) ;
+                bool *dup_sharing = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (dup_sharing) ;
+                (*dup_sharing) = GB_Global_dup_sharing_get ( ) ;
+            }
+            break ;
+
+        case GxB_PROFILING :
+
+            {
+                va_start (ap, field) ;
+                bool *profiling = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (profiling) ;
+                (*profiling) = GB_Global_profiling_get ( ) ;
+            }
+            break ;
+
+        case GxB_CHUNK_AUTOTUNE :
+
+            {
+                va_start (ap, field) ;
+                bool *chunk_autotune = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (chunk_autotune) ;
+                (*chunk_autotune) = GB_Global_chunk_autotune_get ( ) ;
+            }
+            break ;
+
         case GxB_PRINTF : 
 
             {
@@ -921,7 +1096,7 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
-        case GxB_JIT_USE_CMAKE : 
+        case GxB_JIT_USE_CMAKE :
 
             {
                 va_start (ap, field) ;
@@ -932,7 +1107,18 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
-        case GxB_JIT_ERROR_LOG : 
+        case GxB_JIT_ASYNC :
+
+            {
+                va_start (ap, field) ;
+                bool *async = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (async) ;
+                (*async) = GB_jitifyer_get_async ( ) ;
+            }
+            break ;
+
+        case GxB_JIT_ERROR_LOG :
 
             {
                 va_start (ap, field) ;
@@ -943,6 +1129,17 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        case GxB_JIT_TRACE :
+
+            {
+                va_start (ap, field) ;
+                const char **trace = va_arg (ap, const char **) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (trace) ;
+                (*trace) = GB_jitifyer_get_trace ( ) ;
+            }
+            break ;
+
         case GxB_JIT_CACHE_PATH : 
 
             {
@@ -954,6 +1151,17 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        case GxB_JIT_CACHE_REMOTE : 
+
+            {
+                va_start (ap, field) ;
+                const char **remote_path = va_arg (ap, const char **) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (remote_path) ;
+                (*remote_path) = GB_jitifyer_get_remote_path ( ) ;
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
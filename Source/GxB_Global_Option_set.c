@@ -64,21 +64,46 @@ GrB_Info GxB_Global_Option_set_INT32      // set a global default option
             GB_Context_gpu_id_set (NULL, value) ;
             break ;
 
-        case GxB_BURBLE : 
+        case GxB_BURBLE :
 
             GB_Global_burble_set ((bool) value) ;
             break ;
 
+        case GxB_MXM_PLAN_CACHE :
+
+            GB_Global_mxm_plan_cache_set ((bool) value) ;
+            break ;
+
+        case GxB_DUP_SHARING :
+
+            GB_Global_dup_sharing_set ((bool) value) ;
+            break ;
+
+        case GxB_PROFILING :
+
+            GB_Global_profiling_set ((bool) value) ;
+            break ;
+
+        case GxB_CHUNK_AUTOTUNE :
+
+            GB_Global_chunk_autotune_set ((bool) value) ;
+            break ;
+
         case GxB_PRINT_1BASED : 
 
             GB_Global_print_one_based_set ((bool) value) ;
             break ;
 
-        case GxB_JIT_USE_CMAKE : 
+        case GxB_JIT_USE_CMAKE :
 
             GB_jitifyer_set_use_cmake ((bool) value) ;
             break ;
 
+        case GxB_JIT_ASYNC :
+
+            GB_jitifyer_set_async ((bool) value) ;
+            break ;
+
         case GxB_JIT_C_CONTROL : 
 
             GB_jitifyer_set_control ((int) value) ;
@@ -126,6 +151,16 @@ GrB_Info GxB_Global_Option_set_FP64      // set a global default option
             GB_Context_chunk_set (NULL, value) ;
             break ;
 
+        case GxB_HUGEPAGE_THRESHOLD :
+
+            GB_Global_hugepage_threshold_set ((int64_t) value) ;
+            break ;
+
+        case GxB_SPILL_THRESHOLD :
+
+            GB_Global_spill_threshold_set ((int64_t) value) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -267,14 +302,22 @@ GrB_Info GxB_Global_Option_set_CHAR      // set a global default option
 
             return (GB_jitifyer_set_C_preface (value)) ;
 
-        case GxB_JIT_ERROR_LOG : 
+        case GxB_JIT_ERROR_LOG :
 
             return (GB_jitifyer_set_error_log (value)) ;
 
+        case GxB_JIT_TRACE :
+
+            return (GB_jitifyer_set_trace (value)) ;
+
         case GxB_JIT_CACHE_PATH : 
 
             return (GB_jitifyer_set_cache_path (value)) ;
 
+        case GxB_JIT_CACHE_REMOTE : 
+
+            return (GB_jitifyer_set_remote_path (value)) ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -315,6 +358,12 @@ GrB_Info GxB_Global_Option_set_FUNCTION      // set a global default option
             GB_Global_flush_set ((GB_flush_function_t) value) ;
             break ;
 
+        case GxB_MEMORY_PRESSURE_FUNCTION : 
+
+            GB_Global_memory_pressure_function_set
+                ((GxB_memory_pressure_function) value) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -433,6 +482,37 @@ GrB_Info GxB_Global_Option_set      // set a global default option
             }
             break ;
 
+        case GxB_HUGEPAGE_THRESHOLD :
+
+            {
+                va_start (ap, field) ;
+                double value = va_arg (ap, double) ;
+                va_end (ap) ;
+                GB_Global_hugepage_threshold_set ((int64_t) value) ;
+            }
+            break ;
+
+        case GxB_SPILL_THRESHOLD :
+
+            {
+                va_start (ap, field) ;
+                double value = va_arg (ap, double) ;
+                va_end (ap) ;
+                GB_Global_spill_threshold_set ((int64_t) value) ;
+            }
+            break ;
+
+        case GxB_MEMORY_PRESSURE_FUNCTION :
+
+            {
+                va_start (ap, field) ;
+                void *value = va_arg (ap, void *) ;
+                va_end (ap) ;
+                GB_Global_memory_pressure_function_set
+                    ((GxB_memory_pressure_function) value) ;
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // memory pool control
         //----------------------------------------------------------------------
@@ -456,6 +536,46 @@ GrB_Info GxB_Global_Option_set      // set a global default option
             }
             break ;
 
+        case GxB_MXM_PLAN_CACHE :
+
+            {
+                va_start (ap, field) ;
+                int mxm_plan_cache = va_arg (ap, int) ;
+                va_end (ap) ;
+                GB_Global_mxm_plan_cache_set ((bool) mxm_plan_cache) ;
+            }
+            break ;
+
+        case GxB_DUP_SHARING :
+
+            {
+                va_start (ap, field) ;
+                int dup_sharing = va_arg (ap, int) ;
+                va_end (ap) ;
+                GB_Global_dup_sharing_set ((bool) dup_sharing) ;
+            }
+            break ;
+
+        case GxB_PROFILING :
+
+            {
+                va_start (ap, field) ;
+                int profiling = va_arg (ap, int) ;
+                va_end (ap) ;
+                GB_Global_profiling_set ((bool) profiling) ;
+            }
+            break ;
+
+        case GxB_CHUNK_AUTOTUNE :
+
+            {
+                va_start (ap, field) ;
+                int chunk_autotune = va_arg (ap, int) ;
+                va_end (ap) ;
+                GB_Global_chunk_autotune_set ((bool) chunk_autotune) ;
+            }
+            break ;
+
         case GxB_PRINTF : 
 
             {
@@ -544,7 +664,7 @@ GrB_Info GxB_Global_Option_set      // set a global default option
                 return (GB_jitifyer_set_C_preface (C_preface)) ;
             }
 
-        case GxB_JIT_USE_CMAKE : 
+        case GxB_JIT_USE_CMAKE :
 
             {
                 va_start (ap, field) ;
@@ -554,6 +674,16 @@ GrB_Info GxB_Global_Option_set      // set a global default option
             }
             break ;
 
+        case GxB_JIT_ASYNC :
+
+            {
+                va_start (ap, field) ;
+                int value = va_arg (ap, int) ;
+                va_end (ap) ;
+                GB_jitifyer_set_async ((bool) value) ;
+            }
+            break ;
+
         case GxB_JIT_C_CONTROL : 
 
             {
@@ -564,7 +694,7 @@ GrB_Info GxB_Global_Option_set      // set a global default option
             }
             break ;
 
-        case GxB_JIT_ERROR_LOG : 
+        case GxB_JIT_ERROR_LOG :
 
             {
                 va_start (ap, field) ;
@@ -573,6 +703,15 @@ GrB_Info GxB_Global_Option_set      // set a global default option
                 return (GB_jitifyer_set_error_log (error_log)) ;
             }
 
+        case GxB_JIT_TRACE :
+
+            {
+                va_start (ap, field) ;
+                char *trace = va_arg (ap, char *) ;
+                va_end (ap) ;
+                return (GB_jitifyer_set_trace (trace)) ;
+            }
+
         case GxB_JIT_CACHE_PATH : 
 
             {
@@ -582,6 +721,15 @@ GrB_Info GxB_Global_Option_set      // set a global default option
                 return (GB_jitifyer_set_cache_path (cache_path)) ;
             }
 
+        case GxB_JIT_CACHE_REMOTE : 
+
+            {
+                va_start (ap, field) ;
+                char *remote_path = va_arg (ap, char *) ;
+                va_end (ap) ;
+                return (GB_jitifyer_set_remote_path (remote_path)) ;
+            }
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -0,0 +1,39 @@
+//------------------------------------------------------------------------------
+// GxB_IndexList_free: free a pre-analyzed index list
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_ij.h"
+
+GrB_Info GxB_IndexList_free     // free an index list
+(
+    GxB_IndexList *list             // handle of index list to free
+)
+{
+
+    if (list != NULL)
+    {
+        GxB_IndexList L = *list ;
+        if (L != NULL)
+        {
+            size_t header_size = L->header_size ;
+            if (header_size > 0)
+            {
+                GB_FREE (&(L->I), L->I_size) ;
+                GB_FREE_WORK (&(L->Mark), L->Mark_size) ;
+                GB_FREE_WORK (&(L->Inext), L->Inext_size) ;
+                L->magic = GB_FREED ;  // to help detect dangling pointers
+                L->header_size = 0 ;
+                GB_FREE (list, header_size) ;
+            }
+        }
+        (*list) = NULL ;
+    }
+
+    return (GrB_SUCCESS) ;
+}
+
@@ -0,0 +1,100 @@
+//------------------------------------------------------------------------------
+// GxB_IndexList_new: create a reusable, pre-analyzed index list
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Creates a GxB_IndexList from an explicit list of indices, for repeated use
+// in GxB_Matrix_extract_IndexList.  A private copy of the list is made, so
+// the caller may free I after this call.  The analysis that C=A(I,J) would
+// otherwise redo on every extraction is done once here: the index properties
+// (min, max, sorted, duplicates) and, if the list is not recognized as a
+// contiguous range or stride, the I-inverse buckets of GB_I_inverse, which
+// are built sequentially in O(limit) time.  The list must index a specific
+// axis dimension: all indices must be less than limit, and the cached
+// analysis is only used when extracting along an axis of that dimension.
+
+#include "GB_subref.h"
+
+#define GB_FREE_ALL GxB_IndexList_free (list) ;
+
+GrB_Info GxB_IndexList_new      // create a pre-analyzed index list
+(
+    GxB_IndexList *list,            // handle of index list to create
+    const GrB_Index *I,             // index list to copy and analyze
+    GrB_Index ni,                   // number of indices in the list
+    GrB_Index limit                 // dimension of the axis being indexed;
+                                    // all indices must be < limit
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_WHERE1 ("GxB_IndexList_new (&list, I, ni, limit)") ;
+    GB_RETURN_IF_NULL (list) ;
+    (*list) = NULL ;
+    GB_RETURN_IF_NULL (I) ;
+    if (ni > GB_NMAX || limit > GB_NMAX)
+    {
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the index list and copy I into it
+    //--------------------------------------------------------------------------
+
+    size_t header_size ;
+    GxB_IndexList L = GB_MALLOC (1, struct GB_IndexList_opaque, &header_size) ;
+    if (L == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    (*list) = L ;
+    L->magic = GB_MAGIC ;           // in progress; freed by GB_FREE_ALL on
+    L->header_size = header_size ;  // any failure below
+    L->ni = (int64_t) ni ;
+    L->limit = (int64_t) limit ;
+    L->I = NULL ; L->I_size = 0 ;
+    L->Mark = NULL ; L->Mark_size = 0 ;
+    L->Inext = NULL ; L->Inext_size = 0 ;
+    L->ndupl = 0 ;
+
+    L->I = GB_MALLOC (GB_IMAX (ni, 1), GrB_Index, &(L->I_size)) ;
+    if (L->I == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    GB_memcpy (L->I, I, ni * sizeof (GrB_Index), 1) ;
+
+    //--------------------------------------------------------------------------
+    // analyze the list
+    //--------------------------------------------------------------------------
+
+    GB_ijlength (L->I, L->ni, L->limit, &(L->nI), &(L->Ikind), L->Icolon) ;
+    GB_OK (GB_ijproperties (L->I, L->ni, L->nI, L->limit,
+        &(L->Ikind), L->Icolon, &(L->I_is_unsorted), &(L->I_has_dupl),
+        &(L->I_is_contig), &(L->imin), &(L->imax), Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // build the I-inverse buckets, if the list is not a range or stride
+    //--------------------------------------------------------------------------
+
+    if (L->Ikind == GB_LIST && L->nI > 0)
+    {
+        GB_OK (GB_I_inverse (L->I, L->nI, L->limit, &(L->Mark),
+            &(L->Mark_size), &(L->Inext), &(L->Inext_size), &(L->ndupl),
+            Werk)) ;
+    }
+
+    return (GrB_SUCCESS) ;
+}
+
@@ -0,0 +1,86 @@
+//------------------------------------------------------------------------------
+// GxB_Iterator_getSlice: zero-copy access to the current vector of an iterator
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Return the vector at which a row/col iterator is positioned, as a (vector
+// id, index pointer, value pointer, length) tuple that aliases the internal
+// arrays of the matrix, so the vector can be consumed in bulk without any
+// per-entry iterator calls.  The pointers remain valid only until the matrix
+// is modified or freed.
+
+#include "GB.h"
+
+GrB_Info GxB_Iterator_getSlice  // zero-copy view of the current vector
+(
+    // input:
+    GxB_Iterator iterator,
+    // output:
+    GrB_Index *jvec,            // id of the current vector (row or column)
+    const GrB_Index **indices,  // indices of the entries, or NULL if full
+    const void **values,        // values of the entries
+    GrB_Index *len              // # of entries in the vector
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_RETURN_IF_NULL (iterator) ;
+    GB_RETURN_IF_NULL (jvec) ;
+    GB_RETURN_IF_NULL (indices) ;
+    GB_RETURN_IF_NULL (values) ;
+    GB_RETURN_IF_NULL (len) ;
+
+    if (iterator->k >= iterator->anvec)
+    {
+        // the iterator is past the end of the matrix, or its range
+        return (GxB_EXHAUSTED) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get the contents of the current vector
+    //--------------------------------------------------------------------------
+
+    switch (iterator->A_sparsity)
+    {
+        default :
+        case GxB_SPARSE :
+        case GxB_HYPERSPARSE :
+        {
+            // the vector id is k, or Ah [k] if the matrix is hypersparse
+            (*jvec) = (iterator->A_sparsity == GxB_HYPERSPARSE) ?
+                iterator->Ah [iterator->k] : iterator->k ;
+            (*indices) = (const GrB_Index *)
+                (& (iterator->Ai [iterator->pstart])) ;
+        }
+        break ;
+
+        case GxB_BITMAP :
+        {
+            // the entries of a bitmap matrix are not held contiguously;
+            // convert the matrix to sparse to stream it in bulk
+            return (GrB_NOT_IMPLEMENTED) ;
+        }
+
+        case GxB_FULL :
+        {
+            // the implicit indices of the vector are 0 to len-1
+            (*jvec) = iterator->k ;
+            (*indices) = NULL ;
+        }
+        break ;
+    }
+
+    // if the matrix is iso-valued, all entries share the single iso value
+    (*values) = ((const char *) iterator->Ax) + ((iterator->iso) ? 0 :
+        (iterator->pstart * iterator->type_size)) ;
+    (*len) = (iterator->pend - iterator->pstart) ;
+    return (GrB_SUCCESS) ;
+}
+
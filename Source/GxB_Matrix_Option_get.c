@@ -59,6 +59,11 @@ GrB_Info GxB_Matrix_Option_get_INT32    // gets the current option of a matrix
             (*value) = (int32_t) ((A->is_csc) ? GxB_BY_COL : GxB_BY_ROW) ;
             break ;
 
+        case GxB_MATRIX_GPU_ID : 
+
+            (*value) = A->gpu_device ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -199,6 +204,17 @@ GrB_Info GxB_Matrix_Option_get      // gets the current option of a matrix
             }
             break ;
 
+        case GxB_MATRIX_GPU_ID : 
+
+            {
+                va_start (ap, field) ;
+                int *gpu_id = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (gpu_id) ;
+                (*gpu_id) = A->gpu_device ;
+            }
+            break ;
+
         case GxB_IS_HYPER : // historical; use GxB_SPARSITY_STATUS instead
 
             {
@@ -74,6 +74,21 @@ GrB_Info GxB_Matrix_Option_set_INT32    // set an option in a matrix
             }
             break ;
 
+        case GxB_MATRIX_GPU_ID : 
+
+            {
+                // pin the matrix arrays on a GPU, or unpin them if value < 0
+                int gpu_id = GB_IMAX (value, -1) ;
+                #if defined ( GRAPHBLAS_HAS_CUDA )
+                if (A->gpu_device != gpu_id)
+                { 
+                    GB_OK (GB_cuda_matrix_pin_device (A, gpu_id)) ;
+                }
+                #endif
+                A->gpu_device = gpu_id ;
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -232,6 +247,24 @@ GrB_Info GxB_Matrix_Option_set      // set an option in a matrix
             }
             break ;
 
+        case GxB_MATRIX_GPU_ID : 
+
+            {
+                va_start (ap, field) ;
+                int value = va_arg (ap, int) ;
+                va_end (ap) ;
+                // pin the matrix arrays on a GPU, or unpin them if value < 0
+                int gpu_id = GB_IMAX (value, -1) ;
+                #if defined ( GRAPHBLAS_HAS_CUDA )
+                if (A->gpu_device != gpu_id)
+                { 
+                    GB_OK (GB_cuda_matrix_pin_device (A, gpu_id)) ;
+                }
+                #endif
+                A->gpu_device = gpu_id ;
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
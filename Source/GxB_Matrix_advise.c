@@ -0,0 +1,129 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_advise: recommend format settings from a matrix's own history
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Recommends a sparsity control and hyper_switch setting for a matrix, based
+// on the format work the matrix has actually undergone: conversions into and
+// out of bitmap, conversions between sparse and hypersparse, and hyper_hash
+// rebuilds (see the advisor counters in GB_matrix.h).  An application that
+// tunes GxB_SPARSITY_CONTROL by trial and error can instead run its workload
+// once with the default settings, ask each long-lived matrix for its advice,
+// and apply it with GxB_Matrix_Option_set.
+
+// The advice is a heuristic, not a promise: it aims to eliminate repeated
+// conversions the workload has already paid for.  A matrix with too little
+// history simply gets its current settings back.  This method does not
+// modify A, and the counters keep accumulating afterwards.
+
+#include "GB.h"
+#include "GB_convert.h"
+
+// # of conversions (in one direction pair) before the advisor speaks up
+#define GB_ADVISE_THRESHOLD 4
+
+GrB_Info GxB_Matrix_advise      // recommend format settings for a matrix
+(
+    // output:
+    int32_t *sparsity_control,  // recommended GxB_SPARSITY_CONTROL for A
+    double *hyper_switch,       // recommended hyper_switch for A
+    // input:
+    const GrB_Matrix A          // matrix to advise on; not modified
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_advise (&sparsity_control, &hyper_switch, A)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL (sparsity_control) ;
+    GB_RETURN_IF_NULL (hyper_switch) ;
+
+    //--------------------------------------------------------------------------
+    // start from the current settings of A
+    //--------------------------------------------------------------------------
+
+    int control = A->sparsity_control ;
+    double hyper = (double) A->hyper_switch ;
+
+    //--------------------------------------------------------------------------
+    // sparse <-> bitmap churn: pin or widen the sparsity control
+    //--------------------------------------------------------------------------
+
+    int32_t s2b = A->conv_to_bitmap ;
+    int32_t b2s = A->conv_from_bitmap ;
+    if (s2b + b2s >= GB_ADVISE_THRESHOLD)
+    {
+        if (b2s == 0)
+        {
+            // the matrix only ever densifies; pin it as bitmap (or full) so
+            // no conversion into bitmap is ever needed again
+            control = GxB_BITMAP + GxB_FULL ;
+        }
+        else if (s2b == 0)
+        {
+            // the matrix only ever sparsifies; keep bitmap out of its reach
+            control = GxB_SPARSE + GxB_HYPERSPARSE ;
+        }
+        else
+        {
+            // the matrix oscillates across the bitmap_switch band, despite
+            // the s2b_thrash hysteresis; allow every format so GB_conform
+            // leaves it wherever each operation puts it
+            control = GxB_ANY_SPARSITY ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // sparse <-> hypersparse churn: pin the hyper_switch
+    //--------------------------------------------------------------------------
+
+    int32_t s2h = A->conv_to_hyper ;
+    int32_t h2s = A->conv_from_hyper ;
+    if (s2h + h2s >= GB_ADVISE_THRESHOLD)
+    {
+        if (h2s == 0)
+        {
+            // the matrix always ends up hypersparse; start it there and keep
+            // it there
+            hyper = GB_ALWAYS_HYPER ;
+        }
+        else if (s2h == 0)
+        {
+            // the matrix always ends up sparse; never go hypersparse at all
+            hyper = GB_NEVER_HYPER ;
+        }
+        // if it bounces in both directions, keep the current hyper_switch:
+        // the conversion band already straddles the right density
+    }
+
+    //--------------------------------------------------------------------------
+    // frequent hyper_hash rebuilds: the pattern churn outruns the hash
+    //--------------------------------------------------------------------------
+
+    if (A->yhash_builds >= GB_ADVISE_THRESHOLD && s2h + h2s == 0)
+    {
+        // the matrix stays hypersparse but its pattern keeps changing, so the
+        // hyper_hash is rebuilt over and over; a sparse matrix needs no hash
+        // at all, which is the cheaper trade unless vdim is truly huge
+        hyper = GB_NEVER_HYPER ;
+        if ((control & GxB_SPARSE) != 0)
+        {
+            control = control & (~GxB_HYPERSPARSE) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // return the advice
+    //--------------------------------------------------------------------------
+
+    (*sparsity_control) = control ;
+    (*hyper_switch) = hyper ;
+    return (GrB_SUCCESS) ;
+}
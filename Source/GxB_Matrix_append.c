@@ -0,0 +1,55 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_append: append a batch of tuples to a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Appends a batch of (i,j,x) tuples to the matrix C as pending tuples, in
+// time O(batch size), without sorting or assembling them.  The tuples become
+// part of the matrix when it is finalized by GrB_Matrix_wait, or by any
+// GraphBLAS operation that requires the completed matrix.  This supports
+// streaming ingestion: tuples arriving in batches (from a network stream,
+// say) can be handed to GraphBLAS as they arrive, and the single sort and
+// assembly of all batches is deferred until the matrix is first used:
+//
+//      GrB_Matrix_new (&A, GrB_FP64, nrows, ncols) ;
+//      while (get_batch (&I, &J, &X, &n))           // as tuples arrive
+//          GxB_Matrix_append (A, I, J, X, n, GrB_PLUS_FP64, GrB_FP64) ;
+//      GrB_Matrix_wait (A, GrB_MATERIALIZE) ;       // assemble all at once
+//
+// Duplicate tuples, within a batch, across batches, or with entries already
+// in C, are assembled with the dup operator when the matrix is finalized
+// (dup == NULL acts as the implied SECOND operator: the newest value wins,
+// as with GrB_Matrix_setElement).  If the batches arrive already sorted the
+// assembly skips its sort, so ordered streams finalize fastest.
+
+// The xtype and dup operator should be the same for all batches; a batch
+// with a different xtype or dup forces the prior pending tuples to be
+// assembled first.  Unlike GrB_Matrix_build, C need not be empty: appending
+// to a matrix that already has entries is how a stream extends it.
+
+#include "GB_build.h"
+
+GrB_Info GxB_Matrix_append      // append a batch of tuples to a matrix
+(
+    GrB_Matrix C,                   // matrix to append to
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const void *X,                  // array of values of tuples
+    GrB_Index nvals,                // number of tuples
+    const GrB_BinaryOp dup,         // op to assemble duplicates, or NULL
+    GrB_Type xtype                  // type of the X array
+)
+{
+    GB_WHERE (C, "GxB_Matrix_append (C, I, J, X, nvals, dup, xtype)") ;
+    GB_BURBLE_START ("GxB_Matrix_append") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (xtype) ;
+    GrB_Info info = GB_append (C, I, J, X, nvals, dup, xtype, true, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -0,0 +1,76 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_as_iso: discard the values of a matrix, keeping its pattern
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A is converted in place to an iso matrix whose every entry is the given
+// value.  The iso format is the structure-only representation in GraphBLAS:
+// the value array shrinks to a single entry regardless of nnz(A), and all
+// kernels handle iso inputs without streaming any values.  An unweighted
+// graph held as a boolean iso matrix thus stores its pattern alone, and
+// structural semirings (LOR_LAND_BOOL, ANY_PAIR) read no value memory.
+
+#include "GB.h"
+
+#define GB_FREE_ALL ;
+
+GrB_Info GxB_Matrix_as_iso      // discard the values; A becomes iso
+(
+    GrB_Matrix A,               // input/output matrix to modify in place
+    const GrB_Scalar value,     // the single value, typecast to the type of A
+    const GrB_Descriptor desc   // unused, except threading control
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (A, "GxB_Matrix_as_iso (A, value, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_as_iso") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (value) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    if (!GB_Type_compatible (A->type, value->type))
+    { 
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get the value, typecast to the type of A
+    //--------------------------------------------------------------------------
+
+    GB_MATRIX_WAIT ((GrB_Matrix) value) ;
+    if (GB_nnz ((GrB_Matrix) value) == 0)
+    { 
+        // the value must have an entry
+        return (GrB_EMPTY_OBJECT) ;
+    }
+    const size_t asize = A->type->size ;
+    GB_void scalar [GB_VLA(asize)] ;
+    GB_cast_scalar (scalar, A->type->code, value->x, value->type->code,
+        asize) ;
+
+    //--------------------------------------------------------------------------
+    // discard any pending values and convert A to iso
+    //--------------------------------------------------------------------------
+
+    GB_MATRIX_WAIT (A) ;
+    GB_OK (GB_convert_any_to_iso (A, scalar)) ;
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A converted to iso", GB0) ;
+    GB_BURBLE_END ;
+    return (GrB_SUCCESS) ;
+}
+
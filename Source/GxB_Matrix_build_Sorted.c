@@ -0,0 +1,44 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_build_Sorted: build a matrix from sorted, duplicate-free tuples
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Identical in result to GrB_Matrix_build_* with a NULL dup operator, but the
+// caller guarantees that the tuples are already sorted, with no duplicates:
+// in ascending order of column index, ties broken by row index, for a matrix
+// held by column (GrB_COLMAJOR, the default), or sorted by row with ties
+// broken by column for a matrix held by row.  The guarantee lets the sort and
+// the duplicate detection of GrB_Matrix_build be skipped entirely: the matrix
+// is assembled with a single parallel pass over the tuples.  Indices are
+// still checked against the dimensions of C, but the sorted order itself is
+// trusted; if the guarantee is broken the result is undefined.
+
+// Since a single method serves all types, the values are passed as a void
+// pointer with their type given by xtype, which must match the X array (as
+// with the _UDT build methods, this cannot be checked).
+
+#include "GB_build.h"
+
+GrB_Info GxB_Matrix_build_Sorted    // build from sorted duplicate-free tuples
+(
+    GrB_Matrix C,                   // matrix to build
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const void *X,                  // array of values of tuples
+    GrB_Index nvals,                // number of tuples
+    GrB_Type xtype                  // type of the X array
+)
+{
+    GB_WHERE (C, "GxB_Matrix_build_Sorted (C, I, J, X, nvals, xtype)") ;
+    GB_BURBLE_START ("GxB_Matrix_build_Sorted") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (xtype) ;
+    GrB_Info info = GB_build_sorted (C, I, J, X, nvals, xtype, true, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -0,0 +1,114 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_clear_keep: clear a matrix but keep its allocations for refill
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Removes all entries from A, like GrB_Matrix_clear, but retains the A->p,
+// A->h, A->i, and A->x allocations at their current capacity instead of
+// freeing them.  A scratch matrix that is filled, used, and cleared every
+// frame thus frees and re-mallocs nothing: the next refill grows into the
+// same arrays (see also GxB_Matrix_reserve).  The dimensions, type, format,
+// and CSR/CSC orientation of A are unchanged, and any zombies and pending
+// tuples are simply discarded, since all entries are being deleted anyway.
+
+// A sparse or hypersparse matrix keeps its index and value arrays with their
+// contents left stale beyond the (now all-zero) vector pointers.  A bitmap
+// matrix keeps everything and only zeroes its bitmap, and a full matrix is
+// given a zeroed bitmap (becoming an empty bitmap matrix), which keeps its
+// large value array in place.  Unlike GrB_Matrix_clear, the newly empty
+// matrix is not conformed to its sparsity control: conforming an empty
+// matrix would only free the arrays this method exists to keep.  The next
+// operation that modifies A conforms it as usual.
+
+#include "GB.h"
+#include "GB_Pending.h"
+
+GrB_Info GxB_Matrix_clear_keep  // clear a matrix, but keep its allocations
+(
+    GrB_Matrix A                // matrix to clear
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (A, "GxB_Matrix_clear_keep (A)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    if (A->p_shallow || A->h_shallow || A->b_shallow || A->i_shallow
+        || A->x_shallow
+        || GB_share_shared (A->p) || GB_share_shared (A->h)
+        || GB_share_shared (A->b) || GB_share_shared (A->i)
+        || GB_share_shared (A->x))
+    {
+        // A does not own its arrays exclusively (they are shallow, or
+        // co-owned by a snapshot or sharing duplicate), so there is nothing
+        // to keep; clear it the ordinary way
+        return (GB_clear (A, Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // discard all pending work; its results are about to be deleted
+    //--------------------------------------------------------------------------
+
+    GB_Pending_free (&(A->Pending)) ;
+    A->nzombies = 0 ;
+    A->jumbled = false ;
+
+    // the pattern is changing, so the caches that depend on it are freed
+    GB_hyper_hash_free (A) ;
+    GB_degree_free (A) ;
+    GB_lookup_cache_free (A) ;
+    GB_fingerprint_clear (A) ;
+
+    //--------------------------------------------------------------------------
+    // clear the content of A, keeping the allocations
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+
+    if (GB_IS_FULL (A))
+    {
+        // A becomes an empty bitmap matrix, keeping its value array; this is
+        // the only allocation this method makes, and only on the first clear
+        const int64_t anz = GB_nnz_full (A) ;
+        A->b = GB_CALLOC (GB_IMAX (anz, 1), int8_t, &(A->b_size)) ;
+        if (A->b == NULL)
+        {
+            // out of memory; fall back to freeing the content instead
+            return (GB_clear (A, Werk)) ;
+        }
+        A->nvals = 0 ;
+    }
+    else if (GB_IS_BITMAP (A))
+    {
+        // zero the bitmap; the value array is retained as is
+        GB_memset (A->b, 0, GB_nnz_held (A), nthreads_max) ;
+        A->nvals = 0 ;
+    }
+    else if (A->h != NULL)
+    {
+        // A is hypersparse: it keeps its A->p, A->h, A->i, and A->x arrays,
+        // and simply forgets all of its vectors
+        A->nvec = 0 ;
+        A->p [0] = 0 ;
+        A->nvals = 0 ;
+        A->nvec_nonempty = 0 ;
+    }
+    else
+    {
+        // A is sparse: zero the vector pointers; A->i and A->x are retained
+        // at their current capacity, their stale content unreachable
+        GB_memset (A->p, 0, (A->plen + 1) * sizeof (int64_t), nthreads_max) ;
+        A->nvals = 0 ;
+        A->nvec_nonempty = 0 ;
+    }
+
+    ASSERT_MATRIX_OK (A, "A cleared with allocations kept", GB0) ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,46 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_colScale: C = C*D, scale the columns of a matrix in place
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Overwrites each entry C(i,j) with op (C(i,j), D(j,j)), where D is a square
+// diagonal matrix with all diagonal entries present.  The pattern of C does
+// not change and no new matrix is allocated; see GxB_Matrix_rowScale.
+
+#include "GB_mxm.h"
+
+GrB_Info GxB_Matrix_colScale    // C = C*D, scale the columns of C in place
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_BinaryOp op,          // scaling operator; ztype must match C
+    const GrB_Matrix D,             // diagonal matrix of scale factors
+    const GrB_Descriptor desc       // currently unused
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (C, "GxB_Matrix_colScale (C, op, D, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_colScale") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (op) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (D) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, xx0, xx1, xx2, xx3, xx4, xx5, xx6) ;
+
+    //--------------------------------------------------------------------------
+    // C = C*D
+    //--------------------------------------------------------------------------
+
+    info = GB_scale (C, op, D, false, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -0,0 +1,72 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_degree: compute the row degrees of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// degree is a new dense GrB_INT64 vector of length nrows(A), with degree(i)
+// equal to the # of entries in A(i,:).  The degrees are cached inside A (see
+// GB_degree_cache), so repeated calls on an unmodified matrix cost only the
+// copy into the output vector.
+
+#include "GB.h"
+
+GrB_Info GxB_Matrix_degree      // compute the row degrees of a matrix
+(
+    GrB_Vector *degree,         // output vector of row degrees
+    GrB_Matrix A,               // input matrix to query
+    const GrB_Descriptor desc   // unused, except threading control
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (A, "GxB_Matrix_degree (&degree, A, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_degree") ;
+    GB_RETURN_IF_NULL (degree) ;
+    (*degree) = NULL ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // ensure the row degrees of A are cached
+    //--------------------------------------------------------------------------
+
+    info = GB_degree_cache (A, Werk) ;
+    if (info != GrB_SUCCESS)
+    { 
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the output vector as a full copy of the cache
+    //--------------------------------------------------------------------------
+
+    int64_t nrows = GB_NROWS (A) ;
+    GrB_Matrix v = NULL ;
+    info = GB_new_bix (&v, // full, new header
+        GrB_INT64, nrows, 1, GB_Ap_null, true, GxB_FULL, false,
+        GB_Context_hyper_switch ( ), 1, nrows, true, false) ;
+    if (info != GrB_SUCCESS)
+    { 
+        return (info) ;
+    }
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    GB_memcpy (v->x, A->degree, nrows * sizeof (int64_t),
+        GB_nthreads (nrows, chunk, nthreads_max)) ;
+    v->magic = GB_MAGIC ;
+    ASSERT_VECTOR_OK ((GrB_Vector) v, "degree output", GB0) ;
+
+    (*degree) = (GrB_Vector) v ;
+    GB_BURBLE_END ;
+    return (GrB_SUCCESS) ;
+}
+
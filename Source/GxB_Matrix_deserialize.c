@@ -22,8 +22,9 @@ GrB_Info GxB_Matrix_deserialize     // deserialize blob into a GrB_Matrix
     // input:
     GrB_Type type,      // type of the matrix C.  Required if the blob holds a
                         // matrix of user-defined type.  May be NULL if blob
-                        // holds a built-in type; otherwise must match the
-                        // type of C.
+                        // holds a built-in type; if it is another built-in
+                        // type, the values are typecast to it as they are
+                        // loaded.
     const void *blob,       // the blob
     GrB_Index blob_size,    // size of the blob
     const GrB_Descriptor desc       // to control # of threads used
@@ -45,7 +46,7 @@ GrB_Info GxB_Matrix_deserialize     // deserialize blob into a GrB_Matrix
     //--------------------------------------------------------------------------
 
     info = GB_deserialize (C, type, (const GB_void *) blob,
-        (size_t) blob_size) ;
+        (size_t) blob_size, false, true) ;
     GB_BURBLE_END ;
     return (info) ;
 }
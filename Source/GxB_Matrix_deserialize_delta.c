@@ -0,0 +1,69 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_deserialize_delta: reconstruct a matrix from a delta blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Reconstruct a matrix from a delta blob created by
+// GxB_Matrix_serialize_delta.  The base matrix supplies the chunks that the
+// delta records as unchanged: it is the matrix reconstructed from the prior
+// blob in the snapshot chain, and may be NULL only if the delta blob is full
+// (serialized with a NULL base blob).  Each chunk taken from the base is
+// verified against the checksum in the delta blob, so passing the wrong base
+// matrix is detected and reported as GrB_INVALID_OBJECT.  The base matrix is
+// not modified.
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+#define GB_FREE_ALL ;
+
+GrB_Info GxB_Matrix_deserialize_delta   // deserialize a delta blob
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the blob
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the blob holds a
+                        // matrix of user-defined type.  May be NULL if blob
+                        // holds a built-in type; otherwise must match the
+                        // type of C.
+    const void *blob,       // the delta blob
+    GrB_Index blob_size,    // size of the delta blob
+    GrB_Matrix base,        // base matrix holding the unchanged chunks, or
+                            // NULL if the delta blob is full
+    const GrB_Descriptor desc       // to control # of threads used
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_deserialize_delta (&C, type, blob, blob_size,"
+        " base, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_deserialize_delta") ;
+    GB_RETURN_IF_NULL (blob) ;
+    GB_RETURN_IF_NULL (C) ;
+    GB_RETURN_IF_FAULTY (base) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    if (base != NULL)
+    {
+        // finish any pending work on the base, so its arrays are in the same
+        // form they had when the base blob was serialized
+        GB_MATRIX_WAIT (base) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // deserialize the delta blob
+    //--------------------------------------------------------------------------
+
+    info = GB_deserialize_delta (C, type, (const GB_void *) blob,
+        (size_t) blob_size, base) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
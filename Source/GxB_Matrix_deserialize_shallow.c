@@ -0,0 +1,62 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_deserialize_shallow: create a shallow matrix from a blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Identical to GxB_Matrix_deserialize, except that any array stored
+// uncompressed in the blob (GxB_COMPRESSION_NONE) is not copied: the matrix
+// points directly into the blob itself.  If the blob was serialized with
+// GxB_COMPRESSION_NONE, no array is copied at all, so a matrix of any size is
+// created in O(1) time and memory.  This is intended for blobs held in
+// memory-mapped files: many processes can share a single read-only blob, with
+// the kernel paging it in on demand.
+
+// The caller must preserve the blob, unmodified, for the entire lifetime of
+// the matrix C, and must free the blob only after C has been freed.  The
+// matrix should be treated as read-only.  Arrays compressed in the blob are
+// decompressed into deep copies, as usual.
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+GrB_Info GxB_Matrix_deserialize_shallow  // deserialize blob into a GrB_Matrix
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the blob
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the blob holds a
+                        // matrix of user-defined type.  May be NULL if blob
+                        // holds a built-in type; if it is another built-in
+                        // type, the values are typecast to it as they are
+                        // loaded.
+    const void *blob,       // the blob
+    GrB_Index blob_size,    // size of the blob
+    const GrB_Descriptor desc       // to control # of threads used
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_deserialize_shallow (&C, type, blob, blob_size,"
+        " desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_deserialize_shallow") ;
+    GB_RETURN_IF_NULL (blob) ;
+    GB_RETURN_IF_NULL (C) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // deserialize the blob into a shallow matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_deserialize (C, type, (const GB_void *) blob,
+        (size_t) blob_size, true, true) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -0,0 +1,208 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_dup_format: C = A, with a target sparsity format and type
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Makes a deep copy of A, conformed to a requested sparsity format and
+// (optionally) typecast to a requested type, in one step.  Creating a bitmap
+// copy of a sparse matrix with GrB_Matrix_dup followed by
+// GxB_Matrix_Option_set takes two full passes over the entries and
+// transiently holds both the sparse duplicate and the bitmap it is being
+// converted to.  Here the headline case — a sparse or hypersparse A copied
+// into a bitmap C — is a single parallel scatter pass that writes the
+// pattern and the (possibly typecast) values of A directly into the bitmap
+// of C, leaving A untouched.  The other format combinations duplicate and
+// conform as before, but still without a user-visible intermediate.
+
+// The requested sparsity is any legal GxB_SPARSITY_CONTROL value; C is
+// conformed to it and keeps it as its sparsity control.  ctype may be NULL
+// to keep the type of A, or any type compatible with it.
+
+#include "GB_ek_slice.h"
+#include "GB_dup.h"
+#include "GB_convert.h"
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_WERK_POP (A_ek_slicing, int64_t) ;   \
+    GB_Matrix_free (&T) ;                   \
+}
+
+GrB_Info GxB_Matrix_dup_format  // C = A, conformed to a sparsity and type
+(
+    // output:
+    GrB_Matrix *C,              // handle of output matrix to create
+    // input:
+    GrB_Type ctype,             // type of C, or NULL to keep the type of A
+    int sparsity,               // target sparsity: GxB_HYPERSPARSE,
+                                // GxB_SPARSE, GxB_BITMAP, GxB_FULL, or any
+                                // combination (see GxB_SPARSITY_CONTROL)
+    const GrB_Matrix A          // input matrix to copy
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (A, "GxB_Matrix_dup_format (&C, ctype, sparsity, A)") ;
+    GB_BURBLE_START ("GxB_Matrix_dup_format") ;
+    GB_RETURN_IF_NULL (C) ;
+    (*C) = NULL ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_FAULTY (ctype) ;
+
+    GrB_Info info ;
+    GrB_Matrix T = NULL ;
+    GB_WERK_DECLARE (A_ek_slicing, int64_t) ;
+
+    GrB_Type ct = (ctype == NULL) ? A->type : ctype ;
+    if (!GB_Type_compatible (ct, A->type))
+    {
+        GB_ERROR (GrB_DOMAIN_MISMATCH,
+            "Input of type [%s] cannot be typecast to [%s]",
+            A->type->name, ct->name) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finish any pending work on A, so its pattern can be copied directly
+    //--------------------------------------------------------------------------
+
+    GB_MATRIX_WAIT (A) ;
+
+    int sparsity_control =
+        GB_sparsity_control (sparsity, (int64_t) A->vdim) ;
+
+    //--------------------------------------------------------------------------
+    // C = A, fused copy+convert+cast for the sparse-to-bitmap case
+    //--------------------------------------------------------------------------
+
+    if (sparsity_control == GxB_BITMAP &&
+        (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)))
+    {
+
+        //----------------------------------------------------------------------
+        // allocate C as a bitmap matrix of type ct
+        //----------------------------------------------------------------------
+
+        const int64_t avlen = A->vlen ;
+        const int64_t avdim = A->vdim ;
+        int64_t cnzmax ;
+        if (!GB_int64_multiply ((GrB_Index *) (&cnzmax), avdim, avlen))
+        {
+            // problem too large
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        cnzmax = GB_IMAX (cnzmax, 1) ;
+        bool C_iso = A->iso ;
+
+        GB_OK (GB_new_bix (&T, // bitmap, new dynamic header
+            ct, avlen, avdim, GB_Ap_null, A->is_csc,
+            GxB_BITMAP, true, A->hyper_switch, -1, cnzmax, true, C_iso)) ;
+
+        const size_t csize = ct->size ;
+        const size_t asize = A->type->size ;
+        GB_cast_function cast_A_to_C =
+            GB_cast_factory (ct->code, A->type->code) ;
+
+        int nthreads_max = GB_Context_nthreads_max ( ) ;
+        double chunk = GB_Context_chunk ( ) ;
+
+        if (C_iso)
+        {
+            // cast the single iso value of A into C
+            cast_A_to_C (T->x, A->x, asize) ;
+        }
+        else
+        {
+            // clear C->x, so the gaps in the bitmap hold no uninitialized
+            // values (as GB_convert_s2b does)
+            GB_memset (T->x, 0, cnzmax * csize, nthreads_max) ;
+        }
+
+        //----------------------------------------------------------------------
+        // scatter the pattern and values of A into the bitmap of C
+        //----------------------------------------------------------------------
+
+        int A_nthreads, A_ntasks ;
+        GB_SLICE_MATRIX (A, 8) ;
+
+        int8_t *restrict Ab = T->b ;    // the bitmap of C, filled below
+        GB_void *restrict Cx_bytes = (GB_void *) T->x ;
+        const GB_void *restrict Ax_bytes = (const GB_void *) A->x ;
+        int64_t nzombies = 0 ;          // A has been finished above
+
+        if (C_iso)
+        {
+            // pattern only; the single iso value is already in place
+            #undef  GB_COPY
+            #define GB_COPY(Axnew,pnew,Ax,p) ;
+            #include "GB_convert_s2b_template.c"
+        }
+        else if (ct == A->type)
+        {
+            // no typecast: move each value as an opaque block of bytes
+            #undef  GB_COPY
+            #define GB_COPY(Axnew,pnew,Ax,p)                            \
+                memcpy (Cx_bytes + (pnew) * csize,                      \
+                        Ax_bytes + (p) * asize, asize) ;
+            #include "GB_convert_s2b_template.c"
+        }
+        else
+        {
+            // typecast each value of A into C
+            #undef  GB_COPY
+            #define GB_COPY(Axnew,pnew,Ax,p)                            \
+                cast_A_to_C (Cx_bytes + (pnew) * csize,                 \
+                             Ax_bytes + (p) * asize, asize) ;
+            #include "GB_convert_s2b_template.c"
+        }
+
+        T->nvals = GB_nnz (A) ;
+        T->magic = GB_MAGIC ;
+        GB_WERK_POP (A_ek_slicing, int64_t) ;
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // all other cases: duplicate (with typecast), then conform
+        //----------------------------------------------------------------------
+
+        if (ct == A->type)
+        {
+            // T = A, an exact copy
+            GB_OK (GB_dup_worker (&T, A->iso, A, true, NULL)) ;
+        }
+        else
+        {
+            // T = A, with the pattern copied and the values typecast
+            GB_OK (GB_dup_worker (&T, A->iso, A, false, ct)) ;
+            GB_OK (GB_cast_matrix (T, A)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // conform C to the target sparsity, and keep it as its sparsity control
+    //--------------------------------------------------------------------------
+
+    T->sparsity_control = sparsity_control ;
+    GB_OK (GB_conform (T, Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // return the result
+    //--------------------------------------------------------------------------
+
+    (*C) = T ;
+    T = NULL ;
+    ASSERT_MATRIX_OK (*C, "C result of GxB_Matrix_dup_format", GB0) ;
+
+    GB_BURBLE_END ;
+    #pragma omp flush
+    return (GrB_SUCCESS) ;
+}
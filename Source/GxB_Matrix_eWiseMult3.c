@@ -0,0 +1,75 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_eWiseMult3: fused chained element-wise multiplication
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<M> = accum (C, (A.*B).*D): chained element-wise multiply, with op1
+// defining the first '.*' and op2 the second.  When A, B, and D are all full,
+// with no transpose, no typecasting, and no positional operators, the chain
+// is evaluated in a single pass over the common pattern, with no intermediate
+// matrix (see GB_emult3); otherwise it falls back to two ordinary emults.
+// The descriptor settings GrB_INP0 and GrB_INP1 apply to A and B; D is never
+// transposed.
+
+#include "GB_ewise.h"
+#include "GB_get_mask.h"
+
+GrB_Info GxB_Matrix_eWiseMult3       // C<M> = accum (C, (A.*B).*D)
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_Matrix M_in,          // optional mask for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_BinaryOp op1,         // defines '.*' for T1=A.*B
+    const GrB_BinaryOp op2,         // defines '.*' for T=T1.*D
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Matrix D,             // third input:  matrix D
+    const GrB_Descriptor desc       // descriptor for C, M, A, and B
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (C, "GxB_Matrix_eWiseMult3 "
+        "(C, M, accum, op1, op2, A, B, D, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_eWiseMult3") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (B) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (D) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (op1) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (op2) ;
+    GB_RETURN_IF_FAULTY (M_in) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        A_tran, B_tran, xx, xx7) ;
+
+    // get the mask
+    GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
+
+    //--------------------------------------------------------------------------
+    // C<M> = accum (C, (A.*B).*D)
+    //--------------------------------------------------------------------------
+
+    info = GB_emult3 (
+        C,              C_replace,  // C and its descriptor
+        M, Mask_comp, Mask_struct,  // mask and its descriptor
+        accum,                      // accumulate operator
+        op1,                        // operator for the first '.*'
+        op2,                        // operator for the second '.*'
+        A,              A_tran,     // A matrix and its descriptor
+        B,              B_tran,     // B matrix and its descriptor
+        D,                          // D matrix, never transposed
+        Werk) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -0,0 +1,80 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_extract_IndexList: C<M> = accum (C, A(I,J)) with cached lists
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Identical to GrB_Matrix_extract, except that the row and column index
+// lists are GxB_IndexList objects, pre-analyzed by GxB_IndexList_new.  When
+// the same index lists are used for many extractions (sampling the same
+// set of rows and columns from different matrices, or from the same matrix
+// as it evolves), the per-call analysis of the lists is done just once, at
+// GxB_IndexList_new: in particular, the sequential construction of the
+// I-inverse buckets, which takes time proportional to the dimension of the
+// indexed axis.  A NULL index list means GrB_ALL (all rows or all columns).
+
+#include "GB_extract.h"
+#include "GB_get_mask.h"
+#include "GB_ij.h"
+
+GrB_Info GxB_Matrix_extract_IndexList   // C<M> = accum (C, A(I,J))
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_Matrix M_in,          // optional mask for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Matrix A,             // first input:  matrix A
+    const GxB_IndexList I_list,     // row indices; NULL means all rows
+    const GxB_IndexList J_list,     // column indices; NULL means all columns
+    const GrB_Descriptor desc       // descriptor for C, M, and A
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (C, "GxB_Matrix_extract_IndexList (C, M, accum, A, I, J, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_extract_IndexList") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_FAULTY (M_in) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    if ((I_list != NULL && I_list->magic != GB_MAGIC) ||
+        (J_list != NULL && J_list->magic != GB_MAGIC))
+    {
+        return (GrB_UNINITIALIZED_OBJECT) ;
+    }
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        A_transpose, xx1, xx2, xx7) ;
+
+    // get the mask
+    GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
+
+    // get the index lists; a NULL list is GrB_ALL
+    const GrB_Index *I = (I_list == NULL) ? GrB_ALL : I_list->I ;
+    GrB_Index ni = (I_list == NULL) ? 0 : I_list->ni ;
+    const GrB_Index *J = (J_list == NULL) ? GrB_ALL : J_list->I ;
+    GrB_Index nj = (J_list == NULL) ? 0 : J_list->ni ;
+
+    //--------------------------------------------------------------------------
+    // do the work in GB_extract
+    //--------------------------------------------------------------------------
+
+    info = GB_extract (
+        C,      C_replace,          // output matrix C and its descriptor
+        M, Mask_comp, Mask_struct,  // mask and its descriptor
+        accum,                      // optional accum for Z=accum(C,T)
+        A,      A_transpose,        // A and its descriptor
+        I, ni,                      // row indices
+        J, nj,                      // column indices
+        I_list, J_list,             // cached analysis of the index lists
+        Werk) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
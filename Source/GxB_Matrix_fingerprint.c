@@ -0,0 +1,55 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_fingerprint: fingerprint of the content of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Returns a 64-bit XXH3 hash of the content of the matrix, for fast change
+// detection: two queries of a matrix that was not modified in between return
+// the same fingerprint, and any modification changes it (up to hash
+// collisions, which have probability about 2^-64 per pair of states).
+
+// Pending work on the matrix is finished first, so that matrices with equal
+// content in the same sparsity format have equal fingerprints regardless of
+// how they were constructed.  The hash is computed in parallel and cached on
+// the matrix; it is invalidated by any modification, so querying an
+// unchanged matrix is O(1).  The method may be called on a GrB_Vector,
+// typecast to a GrB_Matrix.
+
+#include "GB.h"
+
+#define GB_FREE_ALL ;
+
+GrB_Info GxB_Matrix_fingerprint // fingerprint of the content of A
+(
+    uint64_t *fingerprint,      // fingerprint of A
+    GrB_Matrix A                // matrix to query
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_WHERE (A, "GxB_Matrix_fingerprint (&fingerprint, A)") ;
+    GB_BURBLE_START ("GxB_Matrix_fingerprint") ;
+    GB_RETURN_IF_NULL (fingerprint) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    //--------------------------------------------------------------------------
+    // finish pending work and compute the fingerprint
+    //--------------------------------------------------------------------------
+
+    GB_MATRIX_WAIT (A) ;
+    info = GB_fingerprint (A, Werk) ;
+    if (info == GrB_SUCCESS)
+    {
+        (*fingerprint) = A->fingerprint ;
+    }
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -0,0 +1,296 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_isStoredElements: batched membership query
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The batch form of GxB_Matrix_isStoredElement: determines, for each of the
+// nvals probes (I [k], J [k]), whether A(I[k],J[k]) is present in the
+// structure of A, and sets found [k] accordingly.  The values of A are not
+// returned, and A is not modified (beyond finishing any pending work).
+
+// If the probes are sorted by (vector, index) in the storage orientation of
+// A (by column for a CSC matrix, by row for CSR), each touched vector is
+// answered with a single merged sweep: a cursor moves forward through the
+// vector and each probe gallops ahead from it, so a batch of b probes into a
+// vector with d entries costs O(b log(d/b)) instead of b independent
+// O(log(d)) searches, and the sweep walks each vector once in order instead
+// of thrashing the cache with random bisections.  This is the access pattern
+// of an edge-existence join, whose probe list arrives sorted for free.
+
+// Unsorted probes are answered independently in parallel, each by the same
+// O(1) point-lookup index probe or O(log(d)) binary search as a single
+// GxB_Matrix_isStoredElement call (see GxB_Matrix_lookup_build).
+
+#include "GB.h"
+
+#define GB_FREE_ALL ;
+
+GrB_Info GxB_Matrix_isStoredElements    // batched membership query on A
+(
+    bool *found,                // size nvals; found [k] = (A(I[k],J[k]) found)
+    GrB_Matrix A,               // matrix to check
+    const GrB_Index *Ilist,     // row indices of the probes, size nvals
+    const GrB_Index *J,         // column indices of the probes, size nvals
+    GrB_Index nvals,            // number of probes
+    const GrB_Descriptor desc   // unused, except threading control
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (A, "GxB_Matrix_isStoredElements (found, A, I, J, nvals, desc)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL (found) ;
+    GB_RETURN_IF_NULL (Ilist) ;
+    GB_RETURN_IF_NULL (J) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    if (nvals == 0)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+    if (nvals > GB_NMAX)
+    {
+        // problem too large
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    // delete any lingering zombies, assemble any pending tuples, and unjumble
+    if (GB_ANY_PENDING_WORK (A))
+    {
+        GB_BURBLE_START ("GxB_Matrix_isStoredElements") ;
+        GB_OK (GB_wait (A, "A", Werk)) ;
+        GB_BURBLE_END ;
+    }
+
+    //--------------------------------------------------------------------------
+    // map the probes to the storage orientation of A
+    //--------------------------------------------------------------------------
+
+    // probe k looks for index Ri [k] in vector Rj [k], as in extractElement
+
+    const int64_t n = (int64_t) nvals ;
+    const int64_t vlen = A->vlen ;
+    const int64_t vdim = A->vdim ;
+    const int64_t *restrict Ri = (int64_t *) (A->is_csc ? Ilist : J) ;
+    const int64_t *restrict Rj = (int64_t *) (A->is_csc ? J : Ilist) ;
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // check the probe indices, and determine if the probes are sorted
+    //--------------------------------------------------------------------------
+
+    bool ok = true ;
+    bool sorted = true ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(&&:ok,sorted)
+    for (k = 0 ; k < n ; k++)
+    {
+        const int64_t i = Ri [k] ;
+        const int64_t j = Rj [k] ;
+        ok = ok && (i >= 0 && i < vlen) && (j >= 0 && j < vdim) ;
+        if (k > 0)
+        {
+            const int64_t jlast = Rj [k-1] ;
+            sorted = sorted &&
+                ((jlast < j) || (jlast == j && Ri [k-1] <= i)) ;
+        }
+    }
+    if (!ok)
+    {
+        // at least one probe is out of bounds
+        return (GrB_INVALID_INDEX) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // answer the probes
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int64_t *restrict Ai = A->i ;
+    const int8_t  *restrict Ab = A->b ;
+
+    if (Ap == NULL)
+    {
+
+        //----------------------------------------------------------------------
+        // A is bitmap or full: each probe is O(1)
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < n ; k++)
+        {
+            const int64_t p = Ri [k] + Rj [k] * vlen ;
+            found [k] = (Ab == NULL) || (Ab [p] == 1) ;
+        }
+
+    }
+    else if (sorted)
+    {
+
+        //----------------------------------------------------------------------
+        // sorted probes: one merged galloping sweep over each touched vector
+        //----------------------------------------------------------------------
+
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t kfirst, klast ;
+            GB_PARTITION (kfirst, klast, n, tid, nthreads) ;
+            int64_t jrun = -1 ;         // vector of the current run of probes
+            bool jfound = false ;       // true if vector jrun is nonempty
+            int64_t pA = 0, pA_end = 0 ;    // cursor and end within jrun
+            for (int64_t kk = kfirst ; kk < klast ; kk++)
+            {
+                const int64_t i = Ri [kk] ;
+                const int64_t j = Rj [kk] ;
+                if (j != jrun)
+                {
+                    // the probes have moved on to a new vector j
+                    jrun = j ;
+                    int64_t pA_start = 0 ;
+                    pA_end = 0 ;
+                    if (Ah != NULL)
+                    {
+                        // A is hypersparse: find vector j in A->h
+                        int64_t kA ;
+                        if (A->Y == NULL)
+                        {
+                            kA = 0 ;
+                            jfound = GB_lookup (true, Ah, Ap, vlen, &kA,
+                                A->nvec-1, j, &pA_start, &pA_end) ;
+                        }
+                        else
+                        {
+                            kA = GB_hyper_hash_lookup (Ap, A->Y->p, A->Y->i,
+                                A->Y->x, A->Y->vdim-1, j, &pA_start, &pA_end) ;
+                            jfound = (kA >= 0) ;
+                        }
+                    }
+                    else
+                    {
+                        // A is sparse
+                        pA_start = Ap [j] ;
+                        pA_end   = Ap [j+1] ;
+                        jfound = (pA_start < pA_end) ;
+                    }
+                    pA = pA_start ;
+                }
+                if (!jfound)
+                {
+                    // vector j is empty
+                    found [kk] = false ;
+                    continue ;
+                }
+                // gallop ahead from the cursor to bracket index i
+                int64_t pleft = pA ;
+                int64_t pright = pA + 1 ;
+                int64_t step = 1 ;
+                while (pright < pA_end && Ai [pright] < i)
+                {
+                    pleft = pright ;
+                    pright += step ;
+                    step <<= 1 ;
+                }
+                pright = GB_IMIN (pright, pA_end - 1) ;
+                // binary search for i in Ai [pleft ... pright]
+                bool f ;
+                if (pleft > pright)
+                {
+                    // the cursor has passed the end of the vector
+                    f = false ;
+                }
+                else
+                {
+                    GB_BINARY_SEARCH (i, Ai, pleft, pright, f) ;
+                    // all entries before pleft are smaller than the probes
+                    // still to come, so the cursor never moves backwards
+                    pA = pleft ;
+                }
+                found [kk] = f ;
+            }
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // unsorted probes: answer each one independently, in parallel
+        //----------------------------------------------------------------------
+
+        GBURBLE ("(unsorted probes) ") ;
+        const int64_t *restrict Bp = A->lookup_p ;
+        const int64_t *restrict Be = A->lookup_e ;
+        const int64_t hash_bits = A->lookup_nbuckets - 1 ;
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < n ; k++)
+        {
+            const int64_t i = Ri [k] ;
+            const int64_t j = Rj [k] ;
+            // find vector j
+            int64_t pA_start, pA_end ;
+            bool f = false ;
+            if (Ah != NULL)
+            {
+                int64_t kA ;
+                if (A->Y == NULL)
+                {
+                    kA = 0 ;
+                    f = GB_lookup (true, Ah, Ap, vlen, &kA,
+                        A->nvec-1, j, &pA_start, &pA_end) ;
+                }
+                else
+                {
+                    kA = GB_hyper_hash_lookup (Ap, A->Y->p, A->Y->i,
+                        A->Y->x, A->Y->vdim-1, j, &pA_start, &pA_end) ;
+                    f = (kA >= 0) ;
+                }
+            }
+            else
+            {
+                pA_start = Ap [j] ;
+                pA_end   = Ap [j+1] ;
+                f = (pA_start < pA_end) ;
+            }
+            if (f)
+            {
+                if (Bp != NULL)
+                {
+                    // probe the point-lookup index (see GB_lookup_cache.c)
+                    f = false ;
+                    const int64_t b = GB_HASHF_POINT (i, j, hash_bits) ;
+                    for (int64_t s = Bp [b] ; s < Bp [b+1] && !f ; s++)
+                    {
+                        const int64_t p = Be [s] ;
+                        f = (p >= pA_start && p < pA_end && Ai [p] == i) ;
+                    }
+                }
+                else
+                {
+                    // binary search of vector j for index i
+                    int64_t pleft = pA_start ;
+                    int64_t pright = pA_end - 1 ;
+                    GB_BINARY_SEARCH (i, Ai, pleft, pright, f) ;
+                }
+            }
+            found [k] = f ;
+        }
+    }
+
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,63 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_iteratorSlice: partition a matrix for parallel iteration
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Split the vectors of A (rows if A is held by row, columns if held by
+// column) into nranges contiguous ranges holding roughly equal numbers of
+// entries.  On output, range t consists of vectors Slice [t] to Slice
+// [t+1]-1, in the sense of GxB_rowIterator_kseek or GxB_colIterator_kseek.
+// Each range can then be given to its own iterator via
+// GxB_rowIterator_attachRange or GxB_colIterator_attachRange, so that
+// multiple user threads can consume the matrix in parallel with balanced
+// work, including for hypersparse matrices.
+
+#include "GB.h"
+#define GB_FREE_ALL ;
+
+GrB_Info GxB_Matrix_iteratorSlice   // partition a matrix for parallel iteration
+(
+    // output:
+    GrB_Index *Slice,       // array of size nranges+1
+    // input:
+    int nranges,            // # of ranges to create
+    GrB_Matrix A            // matrix to slice
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_RETURN_IF_NULL (Slice) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    if (nranges < 1)
+    {
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finish any pending work on the matrix
+    //--------------------------------------------------------------------------
+
+    if (GB_ANY_PENDING_WORK (A))
+    {
+        GrB_Info info ;
+        GB_WERK ("GxB_Matrix_iteratorSlice") ;
+        GB_OK (GB_wait (A, "A", Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // slice the vectors of A, balanced by the # of entries in each vector
+    //--------------------------------------------------------------------------
+
+    // if A is bitmap or full, A->p is NULL and the split is uniform
+    GB_pslice ((int64_t *) Slice, A->p, A->nvec, nranges, false) ;
+    return (GrB_SUCCESS) ;
+}
+
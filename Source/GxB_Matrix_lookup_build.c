@@ -0,0 +1,53 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_lookup_build: build the point-lookup index of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Builds a hash index over the entries of a sparse or hypersparse matrix,
+// after which GrB_Matrix_extractElement and GxB_Matrix_isStoredElement find
+// any entry (or determine its absence) in O(1) expected time, instead of the
+// O(log(d)) binary search of its vector.  The index is intended for serving
+// workloads that make many random point reads of a matrix that is not being
+// modified; a single lookup does not repay the cost of building the index,
+// which is a parallel counting sort of all the entries (see
+// GB_lookup_cache.c).
+
+// The index travels with the matrix and is discarded whenever its pattern
+// changes (like the A->Y hyper_hash); point reads then fall back to the
+// binary search until the index is built again.  Any pending work on the
+// matrix is finished first.  For a bitmap or full matrix, point reads are
+// already O(1) and this method does nothing.  The method may be called on a
+// GrB_Vector, typecast to a GrB_Matrix.
+
+#include "GB.h"
+
+GrB_Info GxB_Matrix_lookup_build    // build the point-lookup index of A
+(
+    GrB_Matrix A,               // matrix to index
+    const GrB_Descriptor desc   // unused, except threading control
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (A, "GxB_Matrix_lookup_build (A, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_lookup_build") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // build the point-lookup index
+    //--------------------------------------------------------------------------
+
+    info = GB_lookup_cache_build (A, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
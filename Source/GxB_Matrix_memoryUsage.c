@@ -30,7 +30,7 @@ GrB_Info GxB_Matrix_memoryUsage  // return # of bytes used for a matrix
 
     int64_t nallocs ;
     size_t mem_shallow ;
-    GB_memoryUsage (&nallocs, size, &mem_shallow, A, true) ;
+    GB_memoryUsage (&nallocs, size, &mem_shallow, NULL, A, true) ;
     return (GrB_SUCCESS) ;
 }
 
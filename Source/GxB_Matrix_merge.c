@@ -0,0 +1,133 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_merge: merge-add many matrices into one in a single pass
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C = Tiles [0] + Tiles [1] + ... + Tiles [ntiles-1], where entries that
+// appear in more than one input matrix are assembled with the dup operator.
+// The prior content of C is discarded; its type and dimensions are not
+// changed, and all the Tiles must have the same dimensions as C.  The inputs
+// may overlap arbitrarily, unlike GxB_Matrix_concat, whose tiles must be
+// disjoint.
+
+// Repeated GrB_eWiseAdd folds n matrices in n-1 passes, writing and rereading
+// the growing result each time.  This method instead gathers the tuples of
+// all the inputs and assembles them with a single parallel sort (the same
+// engine as GrB_Matrix_build), so each entry is read once and written once no
+// matter how many inputs there are.  This is the merge step of an
+// owner-computes distributed algorithm: each rank deserializes the partial
+// results received from its peers and combines them with its own in one call.
+
+#include "GB_build.h"
+#include "GB_extractTuples.h"
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE (&Ti, Ti_size) ;                \
+    GB_FREE (&Tj, Tj_size) ;                \
+    GB_FREE (&Tx, Tx_size) ;                \
+}
+
+GrB_Info GxB_Matrix_merge       // C = sum of all Tiles, in one pass
+(
+    GrB_Matrix C,               // output; prior content is discarded
+    const GrB_BinaryOp dup,     // operator to assemble duplicate entries
+    const GrB_Matrix *Tiles,    // array of size ntiles
+    GrB_Index ntiles,           // number of input matrices
+    const GrB_Descriptor desc   // unused, except threading control
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Index *Ti = NULL ; size_t Ti_size = 0 ;
+    GrB_Index *Tj = NULL ; size_t Tj_size = 0 ;
+    GB_void   *Tx = NULL ; size_t Tx_size = 0 ;
+
+    GB_WHERE (C, "GxB_Matrix_merge (C, dup, Tiles, ntiles, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_merge") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (dup) ;
+    GB_RETURN_IF_NULL (Tiles) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    const int64_t cvlen = C->vlen ;
+    const int64_t cvdim = C->vdim ;
+    int64_t nvals = 0 ;
+    for (int64_t t = 0 ; t < (int64_t) ntiles ; t++)
+    {
+        GrB_Matrix A = Tiles [t] ;
+        GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+        if (A->vlen != cvlen || A->vdim != cvdim || A->is_csc != C->is_csc)
+        {
+            GB_ERROR (GrB_DIMENSION_MISMATCH, "Tiles [" GBd "] is " GBd
+                "-by-" GBd "; its dimensions and format must match C\n",
+                t, GB_NROWS (A), GB_NCOLS (A)) ;
+        }
+        if (!GB_Type_compatible (C->type, A->type))
+        {
+            GB_ERROR (GrB_DOMAIN_MISMATCH, "Tiles [" GBd "] of type [%s] "
+                "cannot be typecast to C of type [%s]\n",
+                t, A->type->name, C->type->name) ;
+        }
+        GB_MATRIX_WAIT (A) ;
+        nvals += GB_nnz (A) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // quick return if all inputs are empty
+    //--------------------------------------------------------------------------
+
+    if (nvals == 0)
+    {
+        info = GB_clear (C, Werk) ;
+        GB_BURBLE_END ;
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // gather the tuples of all the inputs into a single list
+    //--------------------------------------------------------------------------
+
+    const size_t csize = C->type->size ;
+    const GB_Type_code ccode = C->type->code ;
+    Ti = GB_MALLOC (nvals, GrB_Index, &Ti_size) ;
+    Tj = GB_MALLOC (nvals, GrB_Index, &Tj_size) ;
+    Tx = GB_MALLOC (nvals * csize, GB_void, &Tx_size) ;
+    if (Ti == NULL || Tj == NULL || Tx == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    int64_t k = 0 ;
+    for (int64_t t = 0 ; t < (int64_t) ntiles ; t++)
+    {
+        GrB_Matrix A = Tiles [t] ;
+        GrB_Index anvals = (GrB_Index) GB_nnz (A) ;
+        if (anvals == 0) continue ;
+        // extract the tuples of this input, typecast to the type of C
+        GB_OK (GB_extractTuples (Ti + k, Tj + k, Tx + k * csize, &anvals,
+            ccode, A, Werk)) ;
+        k += (int64_t) anvals ;
+    }
+    ASSERT (k == nvals) ;
+
+    //--------------------------------------------------------------------------
+    // C = assembled tuples: one parallel sort handles all the inputs
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_clear (C, Werk)) ;
+    GB_OK (GB_build (C, Ti, Tj, Tx, nvals, dup, C->type, true, false, Werk)) ;
+
+    GB_FREE_ALL ;
+    GB_BURBLE_END ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,192 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_new_from_pattern: create a matrix sharing the pattern of another
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Creates a matrix C with the same pattern as A and the given type: C shares
+// the pattern arrays of A (A->p, A->h, A->b, and A->i) through the share
+// registry (see GB_share.c), exactly as GxB_Matrix_snapshot does, but is
+// given its own newly allocated value array, with every entry present and
+// initialized to zero (all bits zero, for a user-defined type).  Only the
+// values are allocated, so a family of matrices over one immutable pattern
+// -- the Jacobi-style iteration that rewrites A's values every step while
+// the pattern never changes -- costs one pattern plus one value array per
+// member, rather than a full dup per value-set that copies three arrays to
+// change one.
+
+// C and A remain independent: each can be used, modified, and freed in any
+// order, and a method that would modify a shared pattern array in place
+// gives its caller a private copy first (GB_unshare).  Any pending work on
+// A is finished before the pattern is captured.  If the share registry is
+// full, the pattern arrays are deep-copied instead, which has the same
+// result, just not in O(pattern) memory savings.
+
+#include "GB.h"
+#include "GB_share.h"
+
+#define GB_FREE_ALL GB_Matrix_free (C) ;
+
+GrB_Info GxB_Matrix_new_from_pattern    // C = pattern of A, new values
+(
+    GrB_Matrix *C,              // handle of matrix to create
+    GrB_Matrix A,               // matrix whose pattern C shares
+    GrB_Type type               // type of the values of C
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (A, "GxB_Matrix_new_from_pattern (&C, A, type)") ;
+    GB_BURBLE_START ("GxB_Matrix_new_from_pattern") ;
+    GB_RETURN_IF_NULL (C) ;
+    (*C) = NULL ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (type) ;
+
+    //--------------------------------------------------------------------------
+    // finish any pending work, so the pattern is fully materialized
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_MATRIX_WAIT (A) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the header of C
+    //--------------------------------------------------------------------------
+
+    info = GB_new (C, // new dynamic header
+        type, A->vlen, A->vdim, GB_Ap_null, A->is_csc,
+        GB_sparsity (A), A->hyper_switch, 0) ;
+    if (info != GrB_SUCCESS)
+    {
+        return (info) ;
+    }
+    GrB_Matrix B = (*C) ;
+
+    //--------------------------------------------------------------------------
+    // B co-owns the pattern of A, or deep-copies it if sharing fails
+    //--------------------------------------------------------------------------
+
+    void *arrays [4] = { A->p, A->h, A->b, A->i } ;
+    int k = 0 ;
+    // a shallow or header-resident pattern array is not owned by A and cannot
+    // outlive it through the share registry; deep-copy the pattern instead
+    bool shared = !(A->p_shallow || A->h_shallow || A->b_shallow
+        || A->i_shallow || A->p == A->p_static) ;
+    for (k = 0 ; k < 4 && shared ; k++)
+    {
+        shared = (arrays [k] == NULL) || GB_share_add (arrays [k]) ;
+    }
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+
+    if (shared)
+    {
+        // as in GB_dup_shared, the arrays are not flagged as shallow:
+        // freeing B drops one owner of each via the share registry
+        B->p = A->p ; B->p_size = A->p_size ; B->p_shallow = false ;
+        B->h = A->h ; B->h_size = A->h_size ; B->h_shallow = false ;
+        B->b = A->b ; B->b_size = A->b_size ; B->b_shallow = false ;
+        B->i = A->i ; B->i_size = A->i_size ; B->i_shallow = false ;
+    }
+    else
+    {
+        // the share registry is full; release what was registered and give
+        // B a deep copy of the pattern instead
+        for (k = k-2 ; k >= 0 ; k--)
+        {
+            if (arrays [k] != NULL)
+            {
+                GB_share_release (arrays [k]) ;
+            }
+        }
+        GBURBLE ("(deep pattern copy) ") ;
+        bool ok = true ;
+        if (A->p != NULL)
+        {
+            B->p = GB_MALLOC (A->p_size / sizeof (int64_t), int64_t,
+                &(B->p_size)) ;
+            ok = ok && (B->p != NULL) ;
+        }
+        if (A->h != NULL)
+        {
+            B->h = GB_MALLOC (A->h_size / sizeof (int64_t), int64_t,
+                &(B->h_size)) ;
+            ok = ok && (B->h != NULL) ;
+        }
+        if (A->b != NULL)
+        {
+            B->b = GB_MALLOC (A->b_size, int8_t, &(B->b_size)) ;
+            ok = ok && (B->b != NULL) ;
+        }
+        if (A->i != NULL)
+        {
+            B->i = GB_MALLOC (A->i_size / sizeof (int64_t), int64_t,
+                &(B->i_size)) ;
+            ok = ok && (B->i != NULL) ;
+        }
+        if (!ok)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        if (A->p != NULL)
+        {
+            GB_memcpy (B->p, A->p, A->p_size, nthreads_max) ;
+        }
+        if (A->h != NULL)
+        {
+            GB_memcpy (B->h, A->h, A->h_size, nthreads_max) ;
+        }
+        if (A->b != NULL)
+        {
+            GB_memcpy (B->b, A->b, A->b_size, nthreads_max) ;
+        }
+        if (A->i != NULL)
+        {
+            GB_memcpy (B->i, A->i, A->i_size, nthreads_max) ;
+        }
+    }
+
+    B->plen = A->plen ;
+    B->nvec = A->nvec ;
+    B->nvec_nonempty = A->nvec_nonempty ;
+    B->nvals = A->nvals ;
+    B->jumbled = A->jumbled ;
+    B->iso = false ;
+    B->bitmap_switch = A->bitmap_switch ;
+    B->sparsity_control = A->sparsity_control ;
+
+    // the hyper_hash is not shared; B builds its own if it is needed
+    B->Y = NULL ;
+    B->Y_shallow = false ;
+
+    //--------------------------------------------------------------------------
+    // allocate the values of B, all zero
+    //--------------------------------------------------------------------------
+
+    // B->x spans the same entry capacity as the pattern it shares
+    int64_t xnvals = (B->i != NULL)
+        ? (int64_t) (B->i_size / sizeof (int64_t))
+        : GB_nnz_held (A) ;
+    xnvals = GB_IMAX (xnvals, 1) ;
+    B->x = GB_CALLOC (xnvals * type->size, GB_void, &(B->x_size)) ;     // x:OK
+    if (B->x == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    B->magic = GB_MAGIC ;
+    ASSERT_MATRIX_OK (B, "B = new matrix from pattern of A", GB0) ;
+    GB_BURBLE_END ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,50 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_nvals_estimate: bounds on nvals without finishing pending work
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GrB_Matrix_nvals must assemble any pending tuples before it can report an
+// exact count, since the pending list may contain duplicates; on a matrix
+// under heavy update that assembly can dwarf the query itself.  This method
+// instead returns bounds [lower,upper] on the count in O(1) time, from the
+// counts the matrix already maintains (live entries, zombies, and pending
+// tuples), without touching the pending work at all.  The bounds are exact
+// (lower == upper) when no pending tuples exist.  A monitoring probe can
+// thus poll a matrix without perturbing the updates it is observing.
+
+#include "GB.h"
+
+GrB_Info GxB_Matrix_nvals_estimate  // get bounds on the # of entries
+(
+    GrB_Index *lower,       // lower bound on the # of entries in A
+    GrB_Index *upper,       // upper bound on the # of entries in A
+    const GrB_Matrix A      // matrix to query
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_nvals_estimate (&lower, &upper, A)") ;
+    GB_RETURN_IF_NULL (lower) ;
+    GB_RETURN_IF_NULL (upper) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    //--------------------------------------------------------------------------
+    // get the bounds on the number of entries
+    //--------------------------------------------------------------------------
+
+    // The live entries number GB_nnz (A) minus the zombies.  Each pending
+    // tuple adds at most one more entry; it may add none, if it duplicates
+    // another pending tuple or updates an existing entry.
+
+    int64_t alive = GB_nnz (A) - A->nzombies ;
+    (*lower) = (GrB_Index) alive ;
+    (*upper) = (GrB_Index) (alive + GB_Pending_n (A)) ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,169 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_pack_COO: pack a matrix from (I,J,X) tuples, deferring the build
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Unlike GrB_Matrix_build and the COO variant of GrB_Matrix_import, which
+// sort and assemble the tuples immediately, this method moves the three
+// user arrays directly into the matrix as its list of pending tuples, in
+// O(1) time and memory.  The expensive sort and assembly is deferred until
+// the matrix is first finished (GrB_wait, or any operation that needs the
+// finished matrix), following the usual nonblocking rules.  This lets an
+// application overlap loading of further data with the lazy assembly, and
+// a matrix that is cleared or freed before it is ever used skips the build
+// entirely.
+
+// The tuples may be in any order and may contain duplicates, which are
+// assembled with the dup operator; if dup is NULL, the last duplicate in
+// the list takes precedence.  No typecasting is done: X must have the same
+// type as A.  The indices are checked here only for a secure import (see
+// GxB_SECURE_IMPORT); with a fast import, out-of-bound indices are detected
+// when the tuples are assembled, and reported by GrB_wait.
+
+#include "GB_export.h"
+#include "GB_Pending.h"
+
+#define GB_FREE_ALL ;
+
+GrB_Info GxB_Matrix_pack_COO    // pack a matrix from (I,J,X) tuples
+(
+    GrB_Matrix A,       // matrix to create (type, nrows, ncols unchanged)
+    GrB_Index **Ilist,  // row indices, I_size >= nvals*sizeof(GrB_Index)
+    GrB_Index **J,      // col indices, J_size >= nvals*sizeof(GrB_Index)
+    void **X,           // values, X_size >= nvals * (type size)
+    GrB_Index I_size,   // size of Ilist in bytes
+    GrB_Index J_size,   // size of J in bytes
+    GrB_Index X_size,   // size of X in bytes
+    const GrB_BinaryOp dup,     // operator to assemble duplicates, or NULL
+    GrB_Index nvals,    // number of tuples
+    const GrB_Descriptor desc
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs and get the descriptor
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (A, "GxB_Matrix_pack_COO (A, "
+        "&I, &J, &X, I_size, J_size, X_size, dup, nvals, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_pack_COO") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL (Ilist) ; GB_RETURN_IF_NULL (*Ilist) ;
+    GB_RETURN_IF_NULL (J) ;     GB_RETURN_IF_NULL (*J) ;
+    GB_RETURN_IF_NULL (X) ;     GB_RETURN_IF_NULL (*X) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    GB_GET_DESCRIPTOR_IMPORT (desc, fast_import) ;
+
+    if (dup != NULL)
+    {
+        GB_RETURN_IF_FAULTY_OR_POSITIONAL (dup) ;
+        if (dup->ztype != A->type || dup->xtype != A->type
+            || dup->ytype != A->type)
+        {
+            GB_ERROR (GrB_DOMAIN_MISMATCH, "The dup operator z=%s(x,y) must "
+                "match the matrix type [%s]\n", dup->name, A->type->name) ;
+        }
+    }
+
+    if (nvals > GB_NMAX
+        || I_size < nvals * sizeof (GrB_Index)
+        || J_size < nvals * sizeof (GrB_Index)
+        || X_size < nvals * A->type->size)
+    {
+        // the arrays are too small for nvals tuples
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // orient the tuples to match the internal format of A
+    //--------------------------------------------------------------------------
+
+    // pending tuples hold (index within vector, vector index), so for a
+    // matrix held by row the roles of I and J are exchanged
+
+    int64_t *Ti = (int64_t *) ((A->is_csc) ? (*Ilist) : (*J)) ;
+    int64_t *Tj = (int64_t *) ((A->is_csc) ? (*J) : (*Ilist)) ;
+    size_t Ti_size = (A->is_csc) ? I_size : J_size ;
+    size_t Tj_size = (A->is_csc) ? J_size : I_size ;
+    int64_t n = (int64_t) nvals ;
+
+    //--------------------------------------------------------------------------
+    // check the indices for a secure import
+    //--------------------------------------------------------------------------
+
+    if (!fast_import)
+    {
+        // a parallel bounds check of the tuples; the sortedness of pending
+        // tuples is never assumed, so bounds are all that must be checked
+        GBURBLE ("(secure import) ") ;
+        const int64_t avlen = A->vlen ;
+        const int64_t avdim = A->vdim ;
+        int nthreads_max = GB_Context_nthreads_max ( ) ;
+        double chunk = GB_Context_chunk ( ) ;
+        int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+        bool ok = true ;
+        int64_t k ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(&&:ok)
+        for (k = 0 ; k < n ; k++)
+        {
+            ok = ok && (Ti [k] >= 0 && Ti [k] < avlen)
+                    && (Tj [k] >= 0 && Tj [k] < avdim) ;
+        }
+        if (!ok)
+        {
+            return (GrB_INDEX_OUT_OF_BOUNDS) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // clear the matrix and move the tuples in as its pending work
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_clear (A, Werk)) ;
+    GB_ENSURE_SPARSE (A) ;      // pending tuples require sparse/hypersparse
+
+    // a matrix with a single vector holds no Pending->j array
+    bool is_matrix = (A->vdim > 1) ;
+
+    if (!GB_Pending_pack (&(A->Pending), A->type, dup,
+        Ti, Ti_size, is_matrix ? Tj : NULL, is_matrix ? Tj_size : 0,
+        (GB_void *) (*X), X_size, n))
+    {
+        // out of memory; the user arrays are untouched
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    #ifdef GB_MEMDUMP
+    printf ("pack COO tuples to memtable: %p %p %p\n",  // MEMDUMP
+        Ti, Tj, *X) ;
+    #endif
+    GB_Global_memtable_add (Ti, Ti_size) ;
+    GB_Global_memtable_add (Tj, Tj_size) ;
+    GB_Global_memtable_add (*X, X_size) ;
+
+    if (!is_matrix)
+    { 
+        // the vector indices are implicit; the array is consumed and freed
+        GB_FREE (&Tj, Tj_size) ;
+    }
+
+    (*Ilist) = NULL ;
+    (*J) = NULL ;
+    (*X) = NULL ;
+
+    GBURBLE ("(" GBd " pending tuples) ", n) ;
+    ASSERT_MATRIX_OK (A, "A packed from COO tuples", GB0) ;
+
+    //--------------------------------------------------------------------------
+    // finish the matrix in blocking mode
+    //--------------------------------------------------------------------------
+
+    info = GB_block (A, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -0,0 +1,150 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_pack_CSR_int32: pack a matrix in CSR format with int32 indices
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Identical to GxB_Matrix_pack_CSR, except that Ap and Aj are arrays of
+// int32_t, the layout used by Arrow sparse tensors and by most external CSR
+// data sets.  GraphBLAS stores its indices as int64_t, so the arrays are
+// widened here, in a single parallel pass, instead of by the caller on every
+// load.  The values Ax are taken as-is, with no copy, just as for
+// GxB_Matrix_pack_CSR.
+
+// On success the int32 arrays are freed (with the free function given to
+// GxB_init) and (*Ap) and (*Aj) are set to NULL, following the usual pack
+// ownership rules; on failure the caller retains ownership of all arrays.
+
+#include "GB_export.h"
+
+#define GB_FREE_ALL                     \
+{                                       \
+    GB_FREE (&Ap64, Ap64_size) ;        \
+    GB_FREE (&Aj64, Aj64_size) ;        \
+}
+
+GrB_Info GxB_Matrix_pack_CSR_int32      // pack a CSR matrix, int32 indices
+(
+    GrB_Matrix A,       // matrix to create (type, nrows, ncols unchanged)
+    int32_t **Ap,       // row "pointers", Ap_size >= (nrows+1)*sizeof(int32_t)
+    int32_t **Aj,       // column indices, Aj_size >= nvals(A)*sizeof(int32_t)
+    void **Ax,          // values, Ax_size >= nvals(A) * (type size)
+                        // or Ax_size >= (type size), if iso is true
+    GrB_Index Ap_size,  // size of Ap in bytes
+    GrB_Index Aj_size,  // size of Aj in bytes
+    GrB_Index Ax_size,  // size of Ax in bytes
+    bool iso,           // if true, A is iso
+    bool jumbled,       // if true, indices in each row may be unsorted
+    const GrB_Descriptor desc
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs and get the descriptor
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_pack_CSR_int32 (A, "
+        "&Ap, &Aj, &Ax, Ap_size, Aj_size, Ax_size, iso, "
+        "jumbled, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_pack_CSR_int32") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL (Ap) ;
+    GB_RETURN_IF_NULL (*Ap) ;
+    GB_RETURN_IF_NULL (Aj) ;
+    GB_RETURN_IF_NULL (*Aj) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    GB_GET_DESCRIPTOR_IMPORT (desc, fast_import) ;
+
+    int64_t *Ap64 = NULL ; size_t Ap64_size = 0 ;
+    int64_t *Aj64 = NULL ; size_t Aj64_size = 0 ;
+
+    //--------------------------------------------------------------------------
+    // check the sizes of the int32 arrays
+    //--------------------------------------------------------------------------
+
+    const int64_t nrows = (int64_t) GB_NROWS (A) ;
+    if (Ap_size < (((GrB_Index) nrows) + 1) * sizeof (int32_t))
+    {
+        // Ap is too small
+        return (GrB_INVALID_VALUE) ;
+    }
+    const int64_t anz = (int64_t) ((*Ap) [nrows]) ;
+    if (anz < 0 || Aj_size < ((GrB_Index) anz) * sizeof (int32_t))
+    {
+        // Ap [nrows] is invalid, or Aj is too small
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // widen the int32 arrays to int64, in a single parallel pass
+    //--------------------------------------------------------------------------
+
+    Ap64 = GB_MALLOC (nrows + 1, int64_t, &Ap64_size) ;
+    Aj64 = GB_MALLOC (GB_IMAX (anz, 1), int64_t, &Aj64_size) ;
+    if (Ap64 == NULL || Aj64 == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+
+    const int32_t *restrict Ap32 = (*Ap) ;
+    const int32_t *restrict Aj32 = (*Aj) ;
+
+    int64_t k ;
+    int nth = GB_nthreads (nrows + 1, chunk, nthreads_max) ;
+    #pragma omp parallel for num_threads(nth) schedule(static)
+    for (k = 0 ; k <= nrows ; k++)
+    {
+        Ap64 [k] = (int64_t) Ap32 [k] ;
+    }
+
+    int64_t p ;
+    nth = GB_nthreads (anz, chunk, nthreads_max) ;
+    #pragma omp parallel for num_threads(nth) schedule(static)
+    for (p = 0 ; p < anz ; p++)
+    {
+        Aj64 [p] = (int64_t) Aj32 [p] ;
+    }
+
+    //--------------------------------------------------------------------------
+    // pack the matrix with the widened arrays
+    //--------------------------------------------------------------------------
+
+    // the widened arrays were allocated here, so they are already in the
+    // debug memtable (add_to_memtable is false)
+    info = GB_import (true, &A, A->type, GB_NCOLS (A), GB_NROWS (A), false,
+        (GrB_Index **) &Ap64, Ap64_size,    // Ap
+        NULL, 0,        // Ah
+        NULL, 0,        // Ab
+        (GrB_Index **) &Aj64, Aj64_size,    // Ai
+        Ax,   Ax_size,  // Ax
+        0, jumbled, 0,                      // jumbled or not
+        GxB_SPARSE, false,                  // sparse by row
+        iso, fast_import, false, Werk) ;
+
+    if (info != GrB_SUCCESS)
+    {
+        // free the widened arrays, unless GB_import has already taken them
+        GB_FREE_ALL ;
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free the int32 arrays and return the result
+    //--------------------------------------------------------------------------
+
+    GB_Global_free_function (*Ap) ;
+    GB_Global_free_function (*Aj) ;
+    (*Ap) = NULL ;
+    (*Aj) = NULL ;
+
+    GB_BURBLE_END ;
+    return (GrB_SUCCESS) ;
+}
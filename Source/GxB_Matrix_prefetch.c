@@ -0,0 +1,47 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_prefetch: asynchronously prefetch a matrix to a GPU or the CPU
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Migrate the unified-memory arrays of a matrix to a given GPU, or back to
+// the CPU if device is negative.  The prefetch is ordered on the given CUDA
+// stream (cast to void *; NULL uses the default stream) and this function
+// does not synchronize, so the migration of one matrix can be overlapped
+// with kernels running on another stream, or with computation on the CPU.
+
+// Pending work on the matrix is intentionally not finished, since doing so
+// would synchronize: the arrays the matrix currently holds are migrated
+// as-is.
+
+#include "GB.h"
+
+GrB_Info GxB_Matrix_prefetch    // prefetch a matrix to a GPU or the CPU
+(
+    GrB_Matrix A,               // matrix to prefetch
+    int device,                 // GPU id to prefetch to, or < 0 for the CPU
+    void *stream                // cudaStream_t, or NULL for default stream
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_prefetch (A, device, stream)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    //--------------------------------------------------------------------------
+    // prefetch the matrix
+    //--------------------------------------------------------------------------
+
+    #if defined ( GRAPHBLAS_HAS_CUDA )
+    return (GB_cuda_matrix_prefetch_all (A, device, stream)) ;
+    #else
+    // GraphBLAS is compiled without CUDA; nothing to prefetch
+    return (GrB_NOT_IMPLEMENTED) ;
+    #endif
+}
@@ -0,0 +1,47 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_random: create a random matrix with reproducible streams
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The matrix is generated from counter-based per-tuple RNG streams, so the
+// result is a pure function of the arguments, identical for any number of
+// threads.  See GB_random.c for the details of the two models.
+
+#include "GB_build.h"
+
+GrB_Info GxB_Matrix_random      // create a random matrix
+(
+    GrB_Matrix *A,              // handle of matrix to create
+    GrB_Type type,              // type of matrix to create
+    GrB_Index nrows,            // number of rows
+    GrB_Index ncols,            // number of columns
+    GrB_Index nvals,            // # of tuples to generate, before duplicates
+    int method,                 // GxB_RANDOM_UNIFORM or GxB_RANDOM_RMAT
+    uint64_t seed               // RNG seed
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_random (&A, type, nrows, ncols, nvals, method,"
+        " seed)") ;
+    GB_BURBLE_START ("GxB_Matrix_random") ;
+    GB_RETURN_IF_NULL (A) ;
+    (*A) = NULL ;
+    GB_RETURN_IF_NULL_OR_FAULTY (type) ;
+
+    //--------------------------------------------------------------------------
+    // create the random matrix
+    //--------------------------------------------------------------------------
+
+    GrB_Info info = GB_random (A, type, nrows, ncols, nvals, method, seed,
+        true, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -0,0 +1,245 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_reduce_multi: reduce a matrix to several scalars in one pass
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Reduces a matrix to nmonoids scalars, c [k] = reduce (monoids [k], A), in a
+// single streaming pass over the entries of A.  Computing several aggregates
+// of the same large matrix (say its min, max, and sum) with one GrB_reduce
+// call per monoid reads all of A->x once per call; here each entry is read
+// once and fed to every monoid, so the pass is bandwidth-bound on one read of
+// A regardless of how many aggregates are computed.
+
+// Each result c [k] must point to a scalar of the ztype of monoids [k]; the
+// type of A must be compatible with every ztype.  If A has no entries, each
+// c [k] is the identity value of its monoid.  No accum or mask is used, and
+// the monoids need not be related to each other in any way.  Terminal
+// monoids do not exit the pass early, since all of the other monoids still
+// need the remaining entries.
+
+#include "GB_reduce.h"
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_WERK_POP (F, bool) ;                 \
+    GB_WERK_POP (W, GB_void) ;              \
+    GB_FREE (&zoff, zoff_size) ;            \
+    GB_FREE (&freduce, freduce_size) ;      \
+    GB_FREE (&cast_A_to_Z, cast_size) ;     \
+}
+
+GrB_Info GxB_Matrix_reduce_multi    // c [k] = reduce (monoids [k], A)
+(
+    void *c [ ],                    // array of nmonoids result scalars; each
+                                    // c [k] has the ztype of monoids [k]
+    const GrB_Monoid monoids [ ],   // monoids for the reductions
+    GrB_Index nmonoids,             // # of monoids and result scalars
+    const GrB_Matrix A,             // matrix to reduce
+    const GrB_Descriptor desc       // currently unused
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_reduce_multi (c, monoids, nmonoids, A, desc)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    if (nmonoids == 0)
+    {
+        // nothing to compute
+        return (GrB_SUCCESS) ;
+    }
+    GB_RETURN_IF_NULL (c) ;
+    GB_RETURN_IF_NULL (monoids) ;
+
+    GrB_Info info ;
+    const int64_t nm = (int64_t) nmonoids ;
+    GB_WERK_DECLARE (W, GB_void) ;
+    GB_WERK_DECLARE (F, bool) ;
+    int64_t *restrict zoff = NULL ; size_t zoff_size = 0 ;
+    GxB_binary_function *restrict freduce = NULL ; size_t freduce_size = 0 ;
+    GB_cast_function *restrict cast_A_to_Z = NULL ; size_t cast_size = 0 ;
+
+    for (int64_t k = 0 ; k < nm ; k++)
+    {
+        GB_RETURN_IF_NULL_OR_FAULTY (monoids [k]) ;
+        GB_RETURN_IF_NULL (c [k]) ;
+        if (!GB_Type_compatible (A->type, monoids [k]->op->ztype))
+        {
+            return (GrB_DOMAIN_MISMATCH) ;
+        }
+    }
+
+    GB_BURBLE_START ("GxB_Matrix_reduce_multi") ;
+
+    //--------------------------------------------------------------------------
+    // assemble any pending tuples; zombies are OK
+    //--------------------------------------------------------------------------
+
+    GB_MATRIX_WAIT_IF_PENDING (A) ;
+    GB_BURBLE_DENSE (A, "(A %s) ") ;
+
+    ASSERT (GB_ZOMBIES_OK (A)) ;
+    ASSERT (GB_JUMBLED_OK (A)) ;
+    ASSERT (!GB_PENDING (A)) ;
+
+    //--------------------------------------------------------------------------
+    // trivial and iso cases: reduce one monoid at a time
+    //--------------------------------------------------------------------------
+
+    int64_t anz = GB_nnz_held (A) ;
+
+    if (anz == A->nzombies || A->iso)
+    {
+        // If A has no live entries each result is just the identity value of
+        // its monoid; if A is iso each reduction takes O(log(nvals(A))) time
+        // for any monoid.  Neither case streams over A->x, so there is
+        // nothing to fuse.
+        for (int64_t k = 0 ; k < nm ; k++)
+        {
+            GB_OK (GB_reduce_to_scalar (c [k], monoids [k]->op->ztype, NULL,
+                monoids [k], A, Werk)) ;
+        }
+        GB_BURBLE_END ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // gather the per-monoid reduce and typecast functions
+    //--------------------------------------------------------------------------
+
+    zoff = GB_MALLOC (nm + 1, int64_t, &zoff_size) ;
+    freduce = GB_MALLOC (nm, GxB_binary_function, &freduce_size) ;
+    cast_A_to_Z = GB_MALLOC (nm, GB_cast_function, &cast_size) ;
+    if (zoff == NULL || freduce == NULL || cast_A_to_Z == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    // zoff [k] is the offset of the kth accumulator in a block holding one
+    // accumulator of each monoid, of ztotal bytes in all
+    int64_t ztotal = 0 ;
+    size_t zmax = 1 ;       // size of the largest ztype, for the cast scratch
+    for (int64_t k = 0 ; k < nm ; k++)
+    {
+        GrB_Type ztype = monoids [k]->op->ztype ;
+        zoff [k] = ztotal ;
+        ztotal += (int64_t) ztype->size ;
+        zmax = GB_IMAX (zmax, ztype->size) ;
+        freduce [k] = monoids [k]->op->binop_function ;
+        cast_A_to_Z [k] = (ztype == A->type) ? NULL :
+            GB_cast_factory (ztype->code, A->type->code) ;
+    }
+    zoff [nm] = ztotal ;
+
+    //--------------------------------------------------------------------------
+    // determine the # of threads and tasks, and allocate their workspace
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
+    int ntasks = (nthreads == 1) ? 1 : (64 * nthreads) ;
+    ntasks = GB_IMIN (ntasks, anz) ;
+    ntasks = GB_IMAX (ntasks, 1) ;
+
+    // W holds one block of nm accumulators per task
+    GB_WERK_PUSH (W, ntasks * ztotal, GB_void) ;
+    GB_WERK_PUSH (F, ntasks, bool) ;
+    if (W == NULL || F == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // each task reduces its own slice of A to one accumulator per monoid
+    //--------------------------------------------------------------------------
+
+    const int8_t  *restrict Ab = A->b ;
+    const int64_t *restrict Ai = A->i ;
+    const GB_void *restrict Ax = (const GB_void *) A->x ;
+    const bool A_has_zombies = (A->nzombies > 0) ;
+    const size_t asize = A->type->size ;
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+        int64_t pstart, pend ;
+        GB_PARTITION (pstart, pend, anz, tid, ntasks) ;
+        GB_void *restrict t = W + tid * ztotal ;
+        // t [k] = identity of monoids [k]
+        for (int64_t k = 0 ; k < nm ; k++)
+        {
+            memcpy (t + zoff [k], monoids [k]->identity,
+                (size_t) (zoff [k+1] - zoff [k])) ;
+        }
+        // scratch for one typecast entry, of the largest ztype
+        GB_void zwork [GB_VLA(zmax)] ;
+        bool found = false ;
+        for (int64_t p = pstart ; p < pend ; p++)
+        {
+            // skip if the entry is a zombie or if not in the bitmap
+            if (A_has_zombies && GB_IS_ZOMBIE (Ai [p])) continue ;
+            if (!GBB (Ab, p)) continue ;
+            found = true ;
+            // t [k] += (ztype) Ax [p], for each monoid
+            const GB_void *restrict ax = Ax + p * asize ;
+            for (int64_t k = 0 ; k < nm ; k++)
+            {
+                GB_void *restrict z = t + zoff [k] ;
+                if (cast_A_to_Z [k] == NULL)
+                {
+                    freduce [k] (z, z, ax) ;
+                }
+                else
+                {
+                    cast_A_to_Z [k] (zwork, ax, asize) ;
+                    freduce [k] (z, z, zwork) ;
+                }
+            }
+        }
+        F [tid] = found ;
+    }
+
+    //--------------------------------------------------------------------------
+    // sum up the results of each task using a single thread
+    //--------------------------------------------------------------------------
+
+    for (int64_t k = 0 ; k < nm ; k++)
+    {
+        // c [k] = identity of monoids [k]
+        memcpy (c [k], monoids [k]->identity,
+            (size_t) (zoff [k+1] - zoff [k])) ;
+    }
+
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+        if (F [tid])
+        {
+            const GB_void *restrict t = W + tid * ztotal ;
+            for (int64_t k = 0 ; k < nm ; k++)
+            {
+                // c [k] += W [tid][k], no typecast
+                freduce [k] (c [k], c [k], t + zoff [k]) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    GB_BURBLE_END ;
+    return (GrB_SUCCESS) ;
+}
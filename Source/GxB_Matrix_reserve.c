@@ -0,0 +1,80 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_reserve: pre-allocate space for future entries
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Grows A->i and A->x so the matrix can hold at least nvals_hint entries
+// without any further reallocation.  The entries, pattern, and pending work
+// of A are not changed, and the reservation is invisible to all other
+// methods: it only provides the headroom that GB_wait and the assign and
+// setElement kernels already use when it is present (GB_nnz_max).  An
+// append-heavy workload that knows its eventual size can thus reserve it
+// once, and grow to it through any number of batches without the repeated
+// realloc-and-copy of a doubling schedule; at tens of gigabytes per array, a
+// single avoided copy is significant.
+
+// The space is never shrunk: a hint smaller than the current capacity does
+// nothing, so the method is idempotent and can be called with a running
+// high-water estimate.  A bitmap or full matrix has no index arrays to
+// grow, and a matrix with shallow content does not own its arrays; both are
+// left unchanged.  This method may be called on a GrB_Vector, typecast to a
+// GrB_Matrix.
+
+#include "GB.h"
+
+GrB_Info GxB_Matrix_reserve     // pre-allocate space in A
+(
+    GrB_Matrix A,               // matrix to reserve space in
+    GrB_Index nvals_hint        // # of entries A should be able to hold
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (A, "GxB_Matrix_reserve (A, nvals_hint)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    if (nvals_hint > GB_NMAX)
+    {
+        // problem too large
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // quick return if no headroom is needed or none can be provided
+    //--------------------------------------------------------------------------
+
+    if (GB_IS_FULL (A) || GB_IS_BITMAP (A))
+    {
+        // a full or bitmap matrix always holds exactly vlen*vdim entries
+        return (GrB_SUCCESS) ;
+    }
+
+    if (A->i_shallow || A->x_shallow)
+    {
+        // A does not own its arrays, so no headroom can be reserved; the
+        // hint is ignored, as for a full or bitmap matrix
+        return (GrB_SUCCESS) ;
+    }
+
+    if ((int64_t) nvals_hint <= GB_nnz_max (A))
+    {
+        // A can already hold nvals_hint entries; never shrink
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // grow A->i and A->x to hold nvals_hint entries
+    //--------------------------------------------------------------------------
+
+    GB_BURBLE_START ("GxB_Matrix_reserve") ;
+    GrB_Info info = GB_ix_realloc (A, (int64_t) nvals_hint) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -0,0 +1,61 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_select_topk: keep the k best entries in each vector of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C is A with all but the k best entries of each row removed (each column,
+// with the GrB_INP0 transpose descriptor), where "best" means first in the
+// sort order of the comparator op, as in GxB_Matrix_sort.  Unlike
+// GxB_Matrix_sort_limit, the surviving entries keep their original indices,
+// so C has the same dimensions and type as A and its pattern is a subset of
+// the pattern of A.  The k best entries of each vector are found with a
+// selection method (no vector is fully sorted), so for small k this is much
+// faster than sorting.  Ties are broken by smallest index.
+
+#include "GB.h"
+#include "GB_sort.h"
+
+GrB_Info GxB_Matrix_select_topk
+(
+    // output:
+    GrB_Matrix C,           // matrix with at most k entries per vector
+    // input
+    GrB_BinaryOp op,        // comparator op
+    GrB_Matrix A,           // matrix to select from
+    GrB_Index k,            // max # of entries to keep per vector
+    const GrB_Descriptor desc
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_select_topk (C, op, A, k, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_select_topk") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (op) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    if (k == 0)
+    { 
+        // at least one entry must be kept in each vector
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, xx0, xx1, xx2, A_transpose, xx3, xx4, xx5) ;
+
+    //--------------------------------------------------------------------------
+    // select the k best entries in each vector of the matrix
+    //--------------------------------------------------------------------------
+
+    int64_t klimit = (k > (GrB_Index) INT64_MAX) ? INT64_MAX : (int64_t) k ;
+    info = GB_sort (C, NULL, op, A, A_transpose, klimit, true, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -0,0 +1,84 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_serialize_delta: serialize a matrix against a prior blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Serialize a matrix as a delta against a prior delta blob, for periodic
+// checkpoints of a slowly-changing matrix.  Each array of the matrix is split
+// into fixed-size chunks, and only the chunks that differ from the base blob
+// are compressed and written; unchanged chunks are recorded by checksum
+// alone.  With base_blob of NULL, all chunks are written, producing a
+// self-contained "full" delta blob that starts a snapshot chain.  Each delta
+// blob carries the full checksum table of the matrix, so it serves as the
+// base for the next delta in turn.  Example usage:
+
+/*
+    void *full = NULL, *delta = NULL ;
+    GrB_Index full_size = 0, delta_size = 0 ;
+    // first checkpoint: all chunks written
+    GxB_Matrix_serialize_delta (&full, &full_size, A, NULL, 0, NULL) ;
+    // ... A is modified ...
+    // second checkpoint: only the changed chunks are written
+    GxB_Matrix_serialize_delta (&delta, &delta_size, A, full, full_size,
+        NULL) ;
+    // reconstruct: the full blob first, then apply the delta to it
+    GrB_Matrix B = NULL, B2 = NULL ;
+    GxB_Matrix_deserialize_delta (&B, atype, full, full_size, NULL, NULL) ;
+    GxB_Matrix_deserialize_delta (&B2, atype, delta, delta_size, B, NULL) ;
+    free (full) ; free (delta) ;    // user frees the blobs
+*/
+
+// The blob must be freed by the same free function passed in to GxB_init, or
+// by the ANSI C11 free() if GrB_init was used.
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+GrB_Info GxB_Matrix_serialize_delta     // delta-serialize a GrB_Matrix
+(
+    // output:
+    void **blob_handle,             // the delta blob, allocated on output
+    GrB_Index *blob_size_handle,    // size of the delta blob on output
+    // input:
+    GrB_Matrix A,                   // matrix to serialize
+    const void *base_blob,          // prior delta blob, or NULL to write a
+                                    // full delta blob with all chunks present
+    GrB_Index base_blob_size,       // size of the prior delta blob
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_serialize_delta (&blob, &blob_size, A, base_blob,"
+        " base_blob_size, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_serialize_delta") ;
+    GB_RETURN_IF_NULL (blob_handle) ;
+    GB_RETURN_IF_NULL (blob_size_handle) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    // get the compression method from the descriptor
+    int method = (desc == NULL) ? GxB_DEFAULT : desc->compression ;
+
+    //--------------------------------------------------------------------------
+    // serialize the matrix
+    //--------------------------------------------------------------------------
+
+    (*blob_handle) = NULL ;
+    size_t blob_size = 0 ;
+    info = GB_serialize_delta ((GB_void **) blob_handle, &blob_size, A,
+        (const GB_void *) base_blob, (size_t) base_blob_size, method, Werk) ;
+    (*blob_size_handle) = (GrB_Index) blob_size ;
+    GB_BURBLE_END ;
+    #pragma omp flush
+    return (info) ;
+}
+
@@ -0,0 +1,81 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_serialize_range: serialize a range of vectors into a blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Serialize a contiguous range of whole vectors of A, as stored: columns
+// begin:end-1 if A is held by column, or rows begin:end-1 if A is held by
+// row.  The blob holds the range as a matrix of its own, reduced dimension
+// (nrows(A)-by-(end-begin) for a matrix held by column), which any of the
+// deserialize methods can reconstruct.  The range is serialized through a
+// shallow window view (see GxB_Matrix_window), so nothing is copied except
+// the compressed blob itself; in particular a process that owns one slab of
+// a distributed matrix can ship any sub-range of it without first extracting
+// a submatrix.  Like GxB_Matrix_window, a hypersparse A is not supported.
+
+// The descriptor selects the compression method, as GxB_Matrix_serialize.
+// The blob is allocated by this method and must be freed by the same free
+// function passed to GxB_init, or the ANSI C11 free() if GrB_init was used.
+
+#include "GB.h"
+#include "GB_split.h"
+#include "GB_serialize.h"
+
+#define GB_FREE_ALL GB_Matrix_free (&V) ;
+
+GrB_Info GxB_Matrix_serialize_range // serialize a range of vectors of A
+(
+    // output:
+    void **blob_handle,             // the blob, allocated on output
+    GrB_Index *blob_size_handle,    // size of the blob on output
+    // input:
+    GrB_Matrix A,                   // matrix to serialize a range of
+    GrB_Index begin,                // first vector of the range
+    GrB_Index end,                  // last vector of the range, plus one
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix V = NULL ;
+    GB_WHERE1 ("GxB_Matrix_serialize_range (&blob, &blob_size, A, begin, "
+        "end, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_serialize_range") ;
+    GB_RETURN_IF_NULL (blob_handle) ;
+    GB_RETURN_IF_NULL (blob_size_handle) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    // get the compression method from the descriptor
+    int method = (desc == NULL) ? GxB_DEFAULT : desc->compression ;
+
+    // the range must span whole vectors of A, as stored
+    GrB_Index nvec = (GrB_Index) A->vdim ;
+    if (begin > end || end > nvec)
+    {
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // serialize the range through a shallow window view
+    //--------------------------------------------------------------------------
+
+    (*blob_handle) = NULL ;
+    size_t blob_size = 0 ;
+    GB_OK (GB_window (&V, A, (int64_t) begin, (int64_t) end, Werk)) ;
+    GB_OK (GB_serialize ((GB_void **) blob_handle, &blob_size, V, method,
+        Werk)) ;
+    GB_Matrix_free (&V) ;
+    (*blob_size_handle) = (GrB_Index) blob_size ;
+    GB_BURBLE_END ;
+    #pragma omp flush
+    return (GrB_SUCCESS) ;
+}
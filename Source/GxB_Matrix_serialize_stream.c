@@ -0,0 +1,76 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_serialize_stream: serialize a matrix through a write callback
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Identical in effect to GxB_Matrix_serialize, except that the blob is never
+// held in memory as a single allocation.  The pieces of the blob are passed,
+// in order, to a user-provided write callback, and each piece is freed as soon
+// as it has been written.  Concatenating all the pieces gives the same blob
+// that GxB_Matrix_serialize constructs, so a file written this way can be read
+// back with GxB_Matrix_deserialize.  This avoids doubling the peak memory
+// usage when serializing a very large matrix directly to a file or socket.
+
+// The callback returns true if the write succeeded, and false on failure, in
+// which case GxB_Matrix_serialize_stream returns GrB_INVALID_VALUE and the
+// contents of the stream are undefined.  Example usage:
+
+/*
+    bool file_writer (void *stream, const void *data, size_t size)
+    {
+        return (fwrite (data, 1, size, (FILE *) stream) == size) ;
+    }
+    ...
+    FILE *f = fopen ("A.blob", "wb") ;
+    GrB_Index blob_size = 0 ;
+    GxB_Matrix_serialize_stream (&blob_size, file_writer, f, A, NULL) ;
+    fclose (f) ;
+*/
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+GrB_Info GxB_Matrix_serialize_stream    // serialize a GrB_Matrix to a stream
+(
+    // output:
+    GrB_Index *blob_size_handle,    // # of bytes written to the stream
+    // input:
+    GxB_serialize_callback write,   // user write callback
+    void *stream,                   // opaque stream handle passed to write
+    GrB_Matrix A,                   // matrix to serialize
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_serialize_stream (&blob_size, write, stream, A,"
+        " desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_serialize_stream") ;
+    GB_RETURN_IF_NULL (blob_size_handle) ;
+    GB_RETURN_IF_NULL (write) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    // get the compression method from the descriptor
+    int method = (desc == NULL) ? GxB_DEFAULT : desc->compression ;
+
+    //--------------------------------------------------------------------------
+    // serialize the matrix
+    //--------------------------------------------------------------------------
+
+    size_t blob_size = 0 ;
+    info = GB_serialize_stream (&blob_size, write, stream, A, method, Werk) ;
+    (*blob_size_handle) = (GrB_Index) blob_size ;
+    GB_BURBLE_END ;
+    #pragma omp flush
+    return (info) ;
+}
+
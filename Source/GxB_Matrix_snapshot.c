@@ -0,0 +1,39 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_snapshot: O(1) copy-on-write snapshot of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Create a snapshot S of a matrix A, in O(1) time and memory: S shares the
+// arrays of A via the share registry (see GB_share.c and GB_dup_shared.c),
+// so A and S can be used, modified, and freed independently, from different
+// user threads.  Readers of S need no locks while writers update A.
+
+#include "GB.h"
+
+GrB_Info GxB_Matrix_snapshot    // create an O(1) snapshot of a matrix
+(
+    GrB_Matrix *S,              // handle of the snapshot to create
+    GrB_Matrix A                // matrix to snapshot
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (A, "GxB_Matrix_snapshot (&S, A)") ;
+    GB_RETURN_IF_NULL (S) ;
+    (*S) = NULL ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    //--------------------------------------------------------------------------
+    // S = A, sharing the arrays of A
+    //--------------------------------------------------------------------------
+
+    return (GB_dup_shared (S, A, Werk)) ;
+}
+
@@ -38,7 +38,7 @@ GrB_Info GxB_Matrix_sort
     // sort the matrix
     //--------------------------------------------------------------------------
 
-    info = GB_sort (C, P, op, A, A_transpose, Werk) ;
+    info = GB_sort (C, P, op, A, A_transpose, INT64_MAX, false, Werk) ;
     GB_BURBLE_END ;
     return (info) ;
 }
@@ -0,0 +1,58 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_sort_limit: sort and keep the k best values in each vector
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Identical to GxB_Matrix_sort, except that at most k entries are kept in
+// each row of C and P (each column, with the GrB_INP0 transpose descriptor):
+// the first k entries of each sorted vector.  For small k this is much faster
+// than a full sort followed by pruning, since the k best entries of each long
+// vector are selected first and only those entries are sorted.
+
+#include "GB.h"
+#include "GB_sort.h"
+
+GrB_Info GxB_Matrix_sort_limit
+(
+    // output:
+    GrB_Matrix C,           // matrix of sorted values
+    GrB_Matrix P,           // matrix containing the permutations
+    // input
+    GrB_BinaryOp op,        // comparator op
+    GrB_Matrix A,           // matrix to sort
+    GrB_Index k,            // max # of sorted entries to keep per vector
+    const GrB_Descriptor desc
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_sort_limit (C, P, op, A, k, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_sort_limit") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (op) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    if (k == 0)
+    { 
+        // at least one entry must be kept in each vector
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, xx0, xx1, xx2, A_transpose, xx3, xx4, xx5) ;
+
+    //--------------------------------------------------------------------------
+    // sort the matrix, keeping at most k entries per vector
+    //--------------------------------------------------------------------------
+
+    int64_t klimit = (k > (GrB_Index) INT64_MAX) ? INT64_MAX : (int64_t) k ;
+    info = GB_sort (C, P, op, A, A_transpose, klimit, false, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -0,0 +1,128 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_split_iso: split a matrix into an iso part and its exceptions
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// B is an iso matrix with the pattern of A and the single value alpha; E
+// holds the entries of A whose value differs from alpha.  Since the pattern
+// of E is a subset of the pattern of B, A is recovered as
+// A = eWiseAdd (B, E, GrB_SECOND_T).  When nearly all entries of A share one
+// value, keeping B and E instead of A shrinks the value storage to the
+// exception list, and operations on B use the iso kernels, which read no
+// value array at all.
+
+#include "GB_select.h"
+#include "GB_dup.h"
+
+#define GB_FREE_ALL             \
+{                               \
+    GB_Matrix_free (&Bz) ;      \
+    GB_Matrix_free (&Ez) ;      \
+}
+
+GrB_Info GxB_Matrix_split_iso   // split A into an iso part and exceptions
+(
+    GrB_Matrix *B,              // output iso matrix: pattern of A, value alpha
+    GrB_Matrix *E,              // output matrix of exceptions
+    const GrB_Scalar alpha,     // the dominant value of A
+    const GrB_Matrix A,         // input matrix to split
+    const GrB_Descriptor desc   // unused, except threading control
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix Bz = NULL, Ez = NULL ;
+    GB_WHERE1 ("GxB_Matrix_split_iso (&B, &E, alpha, A, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_split_iso") ;
+    GB_RETURN_IF_NULL (B) ;
+    (*B) = NULL ;
+    GB_RETURN_IF_NULL (E) ;
+    (*E) = NULL ;
+    GB_RETURN_IF_NULL_OR_FAULTY (alpha) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    if (!GB_Type_compatible (A->type, alpha->type))
+    { 
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // select the value-inequality operator for the type of A
+    //--------------------------------------------------------------------------
+
+    GrB_IndexUnaryOp op ;
+    switch (A->type->code)
+    {
+        case GB_BOOL_code   : op = GrB_VALUENE_BOOL   ; break ;
+        case GB_INT8_code   : op = GrB_VALUENE_INT8   ; break ;
+        case GB_INT16_code  : op = GrB_VALUENE_INT16  ; break ;
+        case GB_INT32_code  : op = GrB_VALUENE_INT32  ; break ;
+        case GB_INT64_code  : op = GrB_VALUENE_INT64  ; break ;
+        case GB_UINT8_code  : op = GrB_VALUENE_UINT8  ; break ;
+        case GB_UINT16_code : op = GrB_VALUENE_UINT16 ; break ;
+        case GB_UINT32_code : op = GrB_VALUENE_UINT32 ; break ;
+        case GB_UINT64_code : op = GrB_VALUENE_UINT64 ; break ;
+        case GB_FP32_code   : op = GrB_VALUENE_FP32   ; break ;
+        case GB_FP64_code   : op = GrB_VALUENE_FP64   ; break ;
+        case GB_FC32_code   : op = GxB_VALUENE_FC32   ; break ;
+        case GB_FC64_code   : op = GxB_VALUENE_FC64   ; break ;
+        default : 
+            // no value-inequality operator exists for user-defined types
+            return (GrB_NOT_IMPLEMENTED) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finish any pending work in A and alpha, and get the value of alpha
+    //--------------------------------------------------------------------------
+
+    GB_MATRIX_WAIT (A) ;
+    GB_MATRIX_WAIT ((GrB_Matrix) alpha) ;
+    if (GB_nnz ((GrB_Matrix) alpha) == 0)
+    { 
+        // alpha must have an entry
+        return (GrB_EMPTY_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // B = iso matrix with the pattern of A and the value alpha
+    //--------------------------------------------------------------------------
+
+    // copy the pattern of A but not its values
+    GB_OK (GB_dup_worker (&Bz, true, A, false, A->type)) ;
+
+    // Bz->x [0] = (A->type) alpha
+    GB_cast_scalar (Bz->x, A->type->code, alpha->x, alpha->type->code,
+        A->type->size) ;
+
+    //--------------------------------------------------------------------------
+    // E = select (A, value != alpha)
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_new (&Ez, // auto sparsity, new header
+        A->type, A->vlen, A->vdim, GB_Ap_calloc, A->is_csc,
+        GxB_AUTO_SPARSITY, GB_Context_hyper_switch ( ), 1)) ;
+    GB_OK (GB_select (Ez, false, NULL, false, false, NULL, op, A, alpha,
+        false, Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (Bz, "B iso part from split_iso", GB0) ;
+    ASSERT_MATRIX_OK (Ez, "E exceptions from split_iso", GB0) ;
+    (*B) = Bz ;
+    (*E) = Ez ;
+    GB_BURBLE_END ;
+    return (GrB_SUCCESS) ;
+}
+
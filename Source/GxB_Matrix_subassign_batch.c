@@ -0,0 +1,105 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_subassign_batch: C(R_k,C_k) = accum (C(R_k,C_k),A_k) for each k
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Applies ngroups submatrix assignments to C in a single call:
+//
+//      C (Rows_groups [k], Cols_groups [k]) += A [k],  for k = 0 to ngroups-1
+//
+// with a single accum operator and descriptor shared by all groups, and no
+// mask.  The result is as if GxB_Matrix_subassign were called once per group,
+// in order, followed by GrB_Matrix_wait; if the (Rows,Cols) regions of the
+// groups are disjoint the order has no effect on the result.  The point of
+// the batched form is to amortize the per-call overhead across the whole
+// batch: each group appends its updates as pending tuples where possible,
+// and all pending work is assembled by one wait at the end, instead of a
+// wait being triggered piecemeal as successive calls interleave updates
+// with reads of C.
+//
+// If any group fails (invalid index, wrong dimensions, ...), the error is
+// returned and C is left in a valid state, but updates from prior groups in
+// the batch may have already been applied.
+
+#include "GB_subassign.h"
+
+GrB_Info GxB_Matrix_subassign_batch // C(R_k,C_k) += A_k, for each group k
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_BinaryOp accum,       // accum for Z=accum(C(R_k,C_k),T)
+    const GrB_Matrix *A,            // array of ngroups input matrices
+    const GrB_Index *const *Rows_groups,    // Rows_groups [k]: row indices
+    const GrB_Index *nRows_groups,  // nRows_groups [k]: # of row indices
+    const GrB_Index *const *Cols_groups,    // Cols_groups [k]: column indices
+    const GrB_Index *nCols_groups,  // nCols_groups [k]: # of column indices
+    GrB_Index ngroups,              // number of assignment groups
+    const GrB_Descriptor desc       // descriptor for C and all A [k]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (C, "GxB_Matrix_subassign_batch"
+        " (C, accum, A, Rows_groups, nRows_groups, Cols_groups, nCols_groups,"
+        " ngroups, desc)") ;
+    GB_BURBLE_START ("GxB_subassign_batch") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    if (ngroups == 0)
+    {
+        // nothing to do
+        GB_BURBLE_END ;
+        return (GrB_SUCCESS) ;
+    }
+    GB_RETURN_IF_NULL (A) ;
+    GB_RETURN_IF_NULL (Rows_groups) ;
+    GB_RETURN_IF_NULL (nRows_groups) ;
+    GB_RETURN_IF_NULL (Cols_groups) ;
+    GB_RETURN_IF_NULL (nCols_groups) ;
+    for (GrB_Index k = 0 ; k < ngroups ; k++)
+    {
+        GB_RETURN_IF_NULL_OR_FAULTY (A [k]) ;
+    }
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        A_transpose, xx1, xx2, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // C(R_k,C_k) = accum (C(R_k,C_k), A [k]), for each group
+    //--------------------------------------------------------------------------
+
+    for (GrB_Index k = 0 ; k < ngroups ; k++)
+    {
+        info = GB_subassign (
+            C, C_replace,                   // C matrix and its descriptor
+            NULL, false, false,             // no mask
+            false,                          // do not transpose the mask
+            accum,                          // for accum (C(R_k,C_k),A [k])
+            A [k], A_transpose,             // A [k] and its descriptor
+            Rows_groups [k], nRows_groups [k],  // row indices of group k
+            Cols_groups [k], nCols_groups [k],  // column indices of group k
+            false, NULL, GB_ignore_code,    // no scalar expansion
+            Werk) ;
+        if (info != GrB_SUCCESS)
+        {
+            GB_BURBLE_END ;
+            return (info) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // assemble all pending work from the whole batch at once
+    //--------------------------------------------------------------------------
+
+    info = GB_wait (C, "C", Werk) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
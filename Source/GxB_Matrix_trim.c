@@ -0,0 +1,91 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_trim: release the slack space in an oversized matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Reallocates all arrays of A to their exact required size, releasing the
+// headroom that accumulates from growth doubling, from heavy deletion, or
+// from an earlier GxB_Matrix_reserve.  A matrix that grew to a historical
+// peak and then shrank retains allocations sized for the peak with no way to
+// reclaim them short of dup-and-free; this method reclaims the slack in
+// place.  Any pending work is finished first, so the matrix is trimmed at
+// its settled size.  The entries, type, dimensions, and format of A are
+// unchanged.
+
+// The index and value arrays are trimmed to nnz(A); for a hypersparse
+// matrix the hyperlist A->p and A->h are trimmed to the number of non-empty
+// vectors, and the A->Y hyper_hash, whose own entry arrays can carry slack
+// from incremental updates (GB_hyper_hash_update), is trimmed the same way.
+// Bitmap and full matrices are always exact and are left unchanged, as are
+// any shallow arrays, which are not owned by A.
+
+// Trimming is the inverse of GxB_Matrix_reserve: an append-heavy phase can
+// reserve its peak up front, and trim once when the matrix reaches its
+// final form.
+
+#include "GB.h"
+
+#define GB_FREE_ALL ;
+
+GrB_Info GxB_Matrix_trim        // release the slack space in A
+(
+    GrB_Matrix A                // matrix to trim
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs and finish any pending work
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_WHERE (A, "GxB_Matrix_trim (A)") ;
+    GB_BURBLE_START ("GxB_Matrix_trim") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_MATRIX_WAIT (A) ;
+
+    //--------------------------------------------------------------------------
+    // trim the index and value arrays to nnz(A)
+    //--------------------------------------------------------------------------
+
+    if ((GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A))
+        && !A->i_shallow && !A->x_shallow)
+    {
+        const int64_t anz = GB_nnz (A) ;
+        if (anz < GB_nnz_max (A))
+        {
+            GB_OK (GB_ix_realloc (A, anz)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // trim the hyperlist to the number of non-empty vectors
+    //--------------------------------------------------------------------------
+
+    if (GB_IS_HYPERSPARSE (A) && !A->p_shallow && !A->h_shallow
+        && A->nvec < A->plen)
+    {
+        GB_OK (GB_hyper_realloc (A, A->nvec, Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // trim the hyper_hash the same way
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix Y = A->Y ;
+    if (Y != NULL && !A->Y_shallow && !Y->i_shallow && !Y->x_shallow)
+    {
+        const int64_t ynz = GB_nnz (Y) ;
+        if (ynz < GB_nnz_max (Y))
+        {
+            GB_OK (GB_ix_realloc (Y, ynz)) ;
+        }
+    }
+
+    ASSERT_MATRIX_OK (A, "A trimmed", GB0) ;
+    GB_BURBLE_END ;
+    return (GrB_SUCCESS) ;
+}
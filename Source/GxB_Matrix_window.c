@@ -0,0 +1,84 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_window: construct a shallow window view of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// V is a read-only view of a contiguous window of A; no entries are copied.
+// The window must span whole vectors of A as it is stored (whole rows if A is
+// held by row, whole columns if held by column).  See GB_window for details.
+
+#include "GB_split.h"
+
+GrB_Info GxB_Matrix_window      // construct a shallow window view of a matrix
+(
+    GrB_Matrix *V,              // handle of output matrix to create
+    const GrB_Matrix A,         // input matrix to view
+    GrB_Index row_begin,        // first row of the window
+    GrB_Index row_end,          // last row of the window, plus one
+    GrB_Index col_begin,        // first column of the window
+    GrB_Index col_end,          // last column of the window, plus one
+    const GrB_Descriptor desc   // unused, except threading control
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_window (&V, A, row_begin, row_end, col_begin, "
+        "col_end, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_window") ;
+    GB_RETURN_IF_NULL (V) ;
+    (*V) = NULL ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // determine the vectors of A spanned by the window
+    //--------------------------------------------------------------------------
+
+    GrB_Index nrows = GB_NROWS (A) ;
+    GrB_Index ncols = GB_NCOLS (A) ;
+    if (row_begin > row_end || row_end > nrows ||
+        col_begin > col_end || col_end > ncols)
+    { 
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    int64_t kbegin, kend ;
+    if (A->is_csc)
+    {
+        // A is held by column: the window selects whole columns
+        if (! (row_begin == 0 && row_end == nrows))
+        { 
+            return (GrB_INVALID_VALUE) ;
+        }
+        kbegin = (int64_t) col_begin ;
+        kend   = (int64_t) col_end ;
+    }
+    else
+    {
+        // A is held by row: the window selects whole rows
+        if (! (col_begin == 0 && col_end == ncols))
+        { 
+            return (GrB_INVALID_VALUE) ;
+        }
+        kbegin = (int64_t) row_begin ;
+        kend   = (int64_t) row_end ;
+    }
+
+    //--------------------------------------------------------------------------
+    // V = shallow view of the window of A
+    //--------------------------------------------------------------------------
+
+    info = GB_window (V, A, kbegin, kend, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
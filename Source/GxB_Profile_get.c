@@ -0,0 +1,41 @@
+//------------------------------------------------------------------------------
+// GxB_Profile_get: drain records from the profile ring buffer
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Returns the oldest profile records captured since the last call, in FIFO
+// order.  On input, (*nrecords) is the size of the records array; on output
+// it is the number of records returned, which is zero when the ring buffer
+// is empty.  Records are captured only when profiling is enabled, via
+// GxB_Global_Option_set (GxB_PROFILING, true).
+
+#include "GB.h"
+
+GrB_Info GxB_Profile_get        // drain profile records (FIFO)
+(
+    GxB_Profile *records,       // array of size (*nrecords) on input
+    GrB_Index *nrecords         // input: size of records array;
+                                // output: # of records returned
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Profile_get (records, &nrecords)") ;
+    GB_RETURN_IF_NULL (records) ;
+    GB_RETURN_IF_NULL (nrecords) ;
+
+    //--------------------------------------------------------------------------
+    // drain the ring buffer
+    //--------------------------------------------------------------------------
+
+    (*nrecords) = (GrB_Index) GB_prof_drain (records, (int64_t) (*nrecords)) ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -0,0 +1,45 @@
+//------------------------------------------------------------------------------
+// GxB_Vector_append: append a batch of tuples to a vector
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The vector analog of GxB_Matrix_append: appends a batch of (i,x) tuples to
+// the vector w as pending tuples, in time O(batch size), deferring the single
+// sort and assembly of all batches until the vector is finalized by
+// GrB_Vector_wait or by any operation that requires the completed vector.
+// This replaces a loop of GrB_Vector_setElement calls, each of which must
+// search the vector for its entry; the batch skips the searches entirely.
+
+// Duplicate tuples, within a batch, across batches, or with entries already
+// in w, are assembled with the dup operator when the vector is finalized
+// (dup == NULL acts as the implied SECOND operator: the newest value wins,
+// as with GrB_Vector_setElement).  The xtype and dup operator should be the
+// same for all batches; a batch with a different xtype or dup forces the
+// prior pending tuples to be assembled first.
+
+#include "GB_build.h"
+
+GrB_Info GxB_Vector_append      // append a batch of tuples to a vector
+(
+    GrB_Vector w,                   // vector to append to
+    const GrB_Index *I,             // array of indices of tuples
+    const void *X,                  // array of values of tuples
+    GrB_Index nvals,                // number of tuples
+    const GrB_BinaryOp dup,         // op to assemble duplicates, or NULL
+    GrB_Type xtype                  // type of the X array
+)
+{
+    GB_WHERE (w, "GxB_Vector_append (w, I, X, nvals, dup, xtype)") ;
+    GB_BURBLE_START ("GxB_Vector_append") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (w) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (xtype) ;
+    ASSERT (GB_VECTOR_OK (w)) ;
+    GrB_Info info = GB_append ((GrB_Matrix) w, I, NULL, X, nvals, dup, xtype,
+        false, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
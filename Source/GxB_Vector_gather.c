@@ -0,0 +1,199 @@
+//------------------------------------------------------------------------------
+// GxB_Vector_gather: y (k) = x (I (k)) for a dense vector x
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Gathers ni entries of a dense vector x into y, where y (k) = x (I (k)).
+// This is the same computation as y = x (I) via GrB_extract, restricted to
+// the case where x is dense and the types of x and y match: the generality
+// of GB_subref (sorting, duplicate analysis, hyperhash lookups) is skipped
+// and the gather is a single parallel indexed load per entry.  y is rebuilt
+// as a full vector of its own length, which must equal ni.
+
+#include "GB.h"
+
+#define GB_FREE_ALL GB_Matrix_free (&T) ;
+
+GrB_Info GxB_Vector_gather      // y (k) = x (I (k))
+(
+    GrB_Vector y,               // output vector, rebuilt as full
+    const GrB_Vector x,         // input vector; must be dense
+    const GrB_Index *I,         // index list of length ni
+    const GrB_Index ni,         // number of indices to gather
+    const GrB_Descriptor desc   // unused, except threading control
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix T = NULL ;
+    GB_WHERE (y, "GxB_Vector_gather (y, x, I, ni, desc)") ;
+    GB_BURBLE_START ("GxB_Vector_gather") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (y) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (x) ;
+    GB_RETURN_IF_NULL (I) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    if (y->type != x->type)
+    { 
+        GB_ERROR (GrB_DOMAIN_MISMATCH, "%s",
+            "y and x must have the same type") ;
+    }
+    if (y->vlen != (int64_t) ni)
+    { 
+        GB_ERROR (GrB_DIMENSION_MISMATCH,
+            "y has length " GBd " but " GBu " indices are gathered",
+            y->vlen, ni) ;
+    }
+
+    GB_MATRIX_WAIT ((GrB_Matrix) x) ;
+    if (!GB_as_if_full ((GrB_Matrix) x))
+    { 
+        GB_ERROR (GrB_INVALID_VALUE, "%s",
+            "x must be dense; use GrB_extract for a sparse x") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check the indices
+    //--------------------------------------------------------------------------
+
+    const int64_t n = (int64_t) ni ;
+    const GrB_Index xn = (GrB_Index) x->vlen ;
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+
+    bool ok = true ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(&&:ok)
+    for (k = 0 ; k < n ; k++)
+    { 
+        ok = ok && (I [k] < xn) ;
+    }
+    if (!ok)
+    { 
+        GB_ERROR (GrB_INDEX_OUT_OF_BOUNDS, "%s",
+            "index out of bounds for the gather") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // T = x (I), a new full vector
+    //--------------------------------------------------------------------------
+
+    const bool x_iso = x->iso ;
+    const size_t xsize = x->type->size ;
+    GB_OK (GB_new_bix (&T, // full, new header
+        x->type, n, 1, GB_Ap_null, true, GxB_FULL, false,
+        GB_Context_hyper_switch ( ), 1, n, true, x_iso)) ;
+    T->magic = GB_MAGIC ;
+
+    const GB_void *restrict Xx = (GB_void *) x->x ;
+    GB_void *restrict Tx = (GB_void *) T->x ;
+
+    if (x_iso)
+    { 
+        // T is iso; gather the single value of x
+        memcpy (Tx, Xx, xsize) ;
+    }
+    else
+    {
+        switch (xsize)
+        {
+            case GB_1BYTE : // uint8, int8, bool
+            { 
+                const uint8_t *restrict X = (uint8_t *) Xx ;
+                uint8_t *restrict Y = (uint8_t *) Tx ;
+                #pragma omp parallel for num_threads(nthreads) \
+                    schedule(static)
+                for (k = 0 ; k < n ; k++)
+                { 
+                    Y [k] = X [I [k]] ;
+                }
+            }
+            break ;
+
+            case GB_2BYTE : // uint16, int16
+            { 
+                const uint16_t *restrict X = (uint16_t *) Xx ;
+                uint16_t *restrict Y = (uint16_t *) Tx ;
+                #pragma omp parallel for num_threads(nthreads) \
+                    schedule(static)
+                for (k = 0 ; k < n ; k++)
+                { 
+                    Y [k] = X [I [k]] ;
+                }
+            }
+            break ;
+
+            case GB_4BYTE : // uint32, int32, float
+            { 
+                const uint32_t *restrict X = (uint32_t *) Xx ;
+                uint32_t *restrict Y = (uint32_t *) Tx ;
+                #pragma omp parallel for num_threads(nthreads) \
+                    schedule(static)
+                for (k = 0 ; k < n ; k++)
+                { 
+                    Y [k] = X [I [k]] ;
+                }
+            }
+            break ;
+
+            case GB_8BYTE : // uint64, int64, double, float complex
+            { 
+                const uint64_t *restrict X = (uint64_t *) Xx ;
+                uint64_t *restrict Y = (uint64_t *) Tx ;
+                #pragma omp parallel for num_threads(nthreads) \
+                    schedule(static)
+                for (k = 0 ; k < n ; k++)
+                { 
+                    Y [k] = X [I [k]] ;
+                }
+            }
+            break ;
+
+            case GB_16BYTE : // double complex
+            { 
+                const uint64_t *restrict X = (uint64_t *) Xx ;
+                uint64_t *restrict Y = (uint64_t *) Tx ;
+                #pragma omp parallel for num_threads(nthreads) \
+                    schedule(static)
+                for (k = 0 ; k < n ; k++)
+                { 
+                    Y [2*k  ] = X [2*I [k]  ] ;
+                    Y [2*k+1] = X [2*I [k]+1] ;
+                }
+            }
+            break ;
+
+            default : // user-defined types
+            { 
+                #pragma omp parallel for num_threads(nthreads) \
+                    schedule(static)
+                for (k = 0 ; k < n ; k++)
+                { 
+                    memcpy (Tx + k*xsize, Xx + I [k]*xsize, xsize) ;
+                }
+            }
+            break ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // transplant T into y and return result
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_transplant ((GrB_Matrix) y, y->type, &T, Werk)) ;
+    ASSERT_VECTOR_OK (y, "y gathered from x", GB0) ;
+    GB_BURBLE_END ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -31,7 +31,8 @@ GrB_Info GxB_Vector_memoryUsage  // return # of bytes used for a vector
 
     int64_t nallocs ;
     size_t mem_shallow ;
-    GB_memoryUsage (&nallocs, size, &mem_shallow, (GrB_Matrix) v, false) ;
+    GB_memoryUsage (&nallocs, size, &mem_shallow, NULL, (GrB_Matrix) v,
+        false) ;
     return (GrB_SUCCESS) ;
 }
 
@@ -0,0 +1,44 @@
+//------------------------------------------------------------------------------
+// GxB_Vector_random: create a random vector with reproducible streams
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The vector is generated from counter-based per-tuple RNG streams, so the
+// result is a pure function of the arguments, identical for any number of
+// threads.  Only the uniform model applies to a vector; see GB_random.c.
+
+#include "GB_build.h"
+
+GrB_Info GxB_Vector_random      // create a random vector
+(
+    GrB_Vector *w,              // handle of vector to create
+    GrB_Type type,              // type of vector to create
+    GrB_Index n,                // vector length
+    GrB_Index nvals,            // # of tuples to generate, before duplicates
+    uint64_t seed               // RNG seed
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Vector_random (&w, type, n, nvals, seed)") ;
+    GB_BURBLE_START ("GxB_Vector_random") ;
+    GB_RETURN_IF_NULL (w) ;
+    (*w) = NULL ;
+    GB_RETURN_IF_NULL_OR_FAULTY (type) ;
+
+    //--------------------------------------------------------------------------
+    // create the random vector
+    //--------------------------------------------------------------------------
+
+    GrB_Info info = GB_random ((GrB_Matrix *) w, type, n, 1, nvals,
+        GxB_RANDOM_UNIFORM, seed, false, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -0,0 +1,216 @@
+//------------------------------------------------------------------------------
+// GxB_Vector_scatter: y (I (k)) = accum (y (I (k)), x (k)) for dense vectors
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Scatters the ni entries of a dense vector x into a dense vector y, at the
+// positions given by the index list I.  With no accum, y (I (k)) = x (k) and
+// duplicate indices must not appear in I (as with GrB_assign, the result is
+// undefined if they do).  With accum, y (I (k)) = accum (y (I (k)), x (k)),
+// and duplicates are accumulated atomically in arbitrary order: for accum
+// ztypes of 1, 2, 4, or 8 bytes each update is a compare-exchange loop, and
+// larger ztypes fall back to a single thread.  This is the same computation
+// as y (I) = x or y (I) += x via GrB_assign, without the general subassign
+// machinery.  No typecasting is performed.
+
+#include "GB.h"
+
+#define GB_FREE_ALL ;
+
+GrB_Info GxB_Vector_scatter     // y (I (k)) = accum (y (I (k)), x (k))
+(
+    GrB_Vector y,               // input/output vector; must be dense
+    const GrB_BinaryOp accum,   // optional accum op, or NULL for y(I(k))=x(k)
+    const GrB_Vector x,         // input vector of length ni; must be dense
+    const GrB_Index *I,         // index list of length ni
+    const GrB_Index ni,         // number of indices to scatter
+    const GrB_Descriptor desc   // unused, except threading control
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (y, "GxB_Vector_scatter (y, accum, x, I, ni, desc)") ;
+    GB_BURBLE_START ("GxB_Vector_scatter") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (y) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (x) ;
+    GB_RETURN_IF_FAULTY (accum) ;
+    GB_RETURN_IF_NULL (I) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    if (GB_any_aliased ((GrB_Matrix) y, (GrB_Matrix) x))
+    { 
+        GB_ERROR (GrB_INVALID_VALUE, "%s", "y and x cannot be aliased") ;
+    }
+    if (accum == NULL)
+    {
+        if (y->type != x->type)
+        { 
+            GB_ERROR (GrB_DOMAIN_MISMATCH, "%s",
+                "y and x must have the same type") ;
+        }
+    }
+    else
+    {
+        GB_RETURN_IF_FAULTY_OR_POSITIONAL (accum) ;
+        if (y->type != accum->ztype || y->type != accum->xtype ||
+            x->type != accum->ytype)
+        { 
+            GB_ERROR (GrB_DOMAIN_MISMATCH, "%s",
+                "y and x must match the accum types (no typecasting)") ;
+        }
+    }
+    if (x->vlen != (int64_t) ni)
+    { 
+        GB_ERROR (GrB_DIMENSION_MISMATCH,
+            "x has length " GBd " but " GBu " indices are scattered",
+            x->vlen, ni) ;
+    }
+
+    GB_MATRIX_WAIT ((GrB_Matrix) y) ;
+    GB_MATRIX_WAIT ((GrB_Matrix) x) ;
+    if (!GB_as_if_full ((GrB_Matrix) y) || !GB_as_if_full ((GrB_Matrix) x))
+    { 
+        GB_ERROR (GrB_INVALID_VALUE, "%s",
+            "y and x must be dense; use GrB_assign otherwise") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check the indices
+    //--------------------------------------------------------------------------
+
+    const int64_t n = (int64_t) ni ;
+    const GrB_Index yn = (GrB_Index) y->vlen ;
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+
+    bool ok = true ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(&&:ok)
+    for (k = 0 ; k < n ; k++)
+    { 
+        ok = ok && (I [k] < yn) ;
+    }
+    if (!ok)
+    { 
+        GB_ERROR (GrB_INDEX_OUT_OF_BOUNDS, "%s",
+            "index out of bounds for the scatter") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // expand y to non-iso
+    //--------------------------------------------------------------------------
+
+    if (y->iso)
+    { 
+        // the scattered result is not iso in general
+        GB_OK (GB_convert_any_to_non_iso ((GrB_Matrix) y, true)) ;
+    }
+
+    // y->x is written in place below; get an exclusive copy if a snapshot or
+    // sharing duplicate co-owns it
+    GB_OK (GB_unshare ((GrB_Matrix) y)) ;
+
+    //--------------------------------------------------------------------------
+    // scatter x into y
+    //--------------------------------------------------------------------------
+
+    GB_void *restrict Yx = (GB_void *) y->x ;
+    const GB_void *restrict Xx = (GB_void *) x->x ;
+    const bool x_iso = x->iso ;
+    const size_t xsize = x->type->size ;
+    const size_t ysize = y->type->size ;
+
+    if (accum == NULL)
+    {
+
+        //----------------------------------------------------------------------
+        // y (I (k)) = x (k); I has no duplicates
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < n ; k++)
+        { 
+            memcpy (Yx + I [k]*ysize, Xx + (x_iso ? 0 : k)*xsize, ysize) ;
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // y (I (k)) = accum (y (I (k)), x (k)); duplicates via atomics
+        //----------------------------------------------------------------------
+
+        GxB_binary_function faccum = accum->binop_function ;
+
+        // each update is a compare-exchange loop on the zsize-byte value,
+        // following the atomic-monoid idiom of the saxpy kernels
+        #define GB_SCATTER_ACCUM(ztype, GB_CAS)                             \
+        {                                                                   \
+            ztype *restrict Zx = (ztype *) Yx ;                             \
+            GB_PRAGMA (omp parallel for num_threads(nthreads)               \
+                schedule(static))                                           \
+            for (k = 0 ; k < n ; k++)                                       \
+            {                                                               \
+                const GB_void *xk = Xx + (x_iso ? 0 : k)*xsize ;            \
+                ztype *pz = Zx + I [k] ;                                    \
+                ztype zold, znew ;                                          \
+                do                                                          \
+                {                                                           \
+                    /* zold = y (I (k)) via atomic read */                  \
+                    GB_ATOMIC_READ                                          \
+                    zold = (*pz) ;                                          \
+                    /* znew = accum (zold, x (k)) */                        \
+                    faccum (&znew, &zold, xk) ;                             \
+                }                                                           \
+                while (!GB_CAS (pz, zold, znew)) ;                          \
+            }                                                               \
+        }
+
+        switch (ysize)
+        {
+            case GB_1BYTE : 
+                GB_SCATTER_ACCUM (uint8_t , GB_ATOMIC_COMPARE_EXCHANGE_8) ;
+                break ;
+            case GB_2BYTE : 
+                GB_SCATTER_ACCUM (uint16_t, GB_ATOMIC_COMPARE_EXCHANGE_16) ;
+                break ;
+            case GB_4BYTE : 
+                GB_SCATTER_ACCUM (uint32_t, GB_ATOMIC_COMPARE_EXCHANGE_32) ;
+                break ;
+            case GB_8BYTE : 
+                GB_SCATTER_ACCUM (uint64_t, GB_ATOMIC_COMPARE_EXCHANGE_64) ;
+                break ;
+            default : 
+            { 
+                // ztypes larger than 8 bytes: a single thread
+                for (k = 0 ; k < n ; k++)
+                {
+                    GB_void *pz = Yx + I [k]*ysize ;
+                    faccum (pz, pz, Xx + (x_iso ? 0 : k)*xsize) ;
+                }
+            }
+            break ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_VECTOR_OK (y, "y after scatter", GB0) ;
+    GB_BURBLE_END ;
+    return (GrB_SUCCESS) ;
+}
+
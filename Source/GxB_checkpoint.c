@@ -0,0 +1,252 @@
+//------------------------------------------------------------------------------
+// GxB_checkpoint: serialize a set of matrices into a single stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Serializes an array of matrices through a single write callback, as one
+// checkpoint blob: a manifest (magic number, version, matrix count, and the
+// blob size of each matrix), followed by the per-matrix blobs, each identical
+// to what GxB_Matrix_serialize would produce.  The checkpoint is read back
+// with GxB_restore.
+
+// Serializing the matrices one public call at a time leaves most cores idle
+// whenever a small matrix is being compressed, which dominates the wall time
+// when a service checkpoints hundreds of matrices.  Here the matrices whose
+// entry count is large enough for the intra-matrix compression to use more
+// than one thread are serialized one at a time with all threads, and all the
+// remaining small matrices are serialized concurrently in a single
+// dynamically-scheduled pass, one thread per matrix, so the cores stay busy
+// through the long tail.
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+//------------------------------------------------------------------------------
+// GB_checkpoint_one: serialize one matrix into a freshly allocated blob
+//------------------------------------------------------------------------------
+
+// GB_serialize does not report the allocated size of the blob it creates, so
+// the blob is allocated here, from the dryrun upper bound, and filled with
+// the preallocated-blob variant of GB_serialize, keeping the exact allocated
+// size for the later GB_FREE.
+
+static GrB_Info GB_checkpoint_one
+(
+    GB_void **blob_handle,      // newly-allocated blob holding A
+    uint64_t *blob_bytes,       // # of bytes of the blob that were written
+    size_t *blob_allocated,     // allocated size of the blob
+    GrB_Matrix A,               // matrix to serialize
+    int32_t method,             // compression method
+    GB_Werk Werk
+)
+{
+    // dryrun: get an upper bound on the blob size
+    size_t bound = 0 ;
+    GrB_Info info = GB_serialize (NULL, &bound, A, method, Werk) ;
+    if (info != GrB_SUCCESS)
+    {
+        return (info) ;
+    }
+    // allocate the blob and fill it
+    size_t allocated = 0 ;
+    GB_void *blob = GB_MALLOC (bound, GB_void, &allocated) ;
+    if (blob == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    size_t blob_size = allocated ;
+    info = GB_serialize (&blob, &blob_size, A, method, Werk) ;
+    if (info != GrB_SUCCESS)
+    {
+        GB_FREE (&blob, allocated) ;
+        return (info) ;
+    }
+    (*blob_handle) = blob ;
+    (*blob_bytes) = (uint64_t) blob_size ;
+    (*blob_allocated) = allocated ;
+    return (GrB_SUCCESS) ;
+}
+
+#define GB_FREE_ALL                                             \
+{                                                               \
+    if (Blobs != NULL && Blob_alloc != NULL)                    \
+    {                                                           \
+        for (int64_t i = 0 ; i < (int64_t) nmatrices ; i++)     \
+        {                                                       \
+            GB_FREE (&(Blobs [i]), Blob_alloc [i]) ;            \
+        }                                                       \
+    }                                                           \
+    GB_FREE (&Blobs, Blobs_size) ;                              \
+    GB_FREE (&Blob_bytes, Blob_bytes_size) ;                    \
+    GB_FREE (&Blob_alloc, Blob_alloc_size) ;                    \
+}
+
+GrB_Info GxB_checkpoint         // serialize a set of matrices to a stream
+(
+    // output:
+    GrB_Index *blob_size_handle,    // total # of bytes written to the stream
+    // input:
+    GxB_serialize_callback write,   // user write callback
+    void *stream,                   // opaque stream handle passed to write
+    GrB_Matrix *As,                 // array of matrices to serialize
+    GrB_Index nmatrices,            // # of matrices
+    const GrB_Descriptor desc       // descriptor to select compression method
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_checkpoint (&blob_size, write, stream, As, nmatrices,"
+        " desc)") ;
+    GB_BURBLE_START ("GxB_checkpoint") ;
+    GB_RETURN_IF_NULL (blob_size_handle) ;
+    (*blob_size_handle) = 0 ;
+    GB_RETURN_IF_NULL (write) ;
+    GB_RETURN_IF_NULL (As) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    GB_void **Blobs = NULL ;     size_t Blobs_size = 0 ;
+    uint64_t *Blob_bytes = NULL ; size_t Blob_bytes_size = 0 ;
+    size_t   *Blob_alloc = NULL ; size_t Blob_alloc_size = 0 ;
+
+    for (int64_t i = 0 ; i < (int64_t) nmatrices ; i++)
+    {
+        GB_RETURN_IF_NULL_OR_FAULTY (As [i]) ;
+    }
+
+    // get the compression method from the descriptor
+    int method = (desc == NULL) ? GxB_DEFAULT : desc->compression ;
+
+    //--------------------------------------------------------------------------
+    // finish any pending work on all matrices
+    //--------------------------------------------------------------------------
+
+    for (int64_t i = 0 ; i < (int64_t) nmatrices ; i++)
+    {
+        GB_OK (GB_wait (As [i], "A for checkpoint", Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the per-matrix blob table
+    //--------------------------------------------------------------------------
+
+    if (nmatrices > 0)
+    {
+        Blobs      = GB_CALLOC (nmatrices, GB_void *, &Blobs_size) ;
+        Blob_bytes = GB_CALLOC (nmatrices, uint64_t, &Blob_bytes_size) ;
+        Blob_alloc = GB_CALLOC (nmatrices, size_t, &Blob_alloc_size) ;
+        if (Blobs == NULL || Blob_bytes == NULL || Blob_alloc == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // serialize the large matrices, one at a time, with all threads
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+
+    // a matrix is "large" if its intra-matrix compression would use more
+    // than one thread on its own
+    #define GB_CHECKPOINT_LARGE(A) \
+        (GB_nthreads (GB_nnz_held (A), chunk, nthreads_max) > 1)
+
+    for (int64_t i = 0 ; i < (int64_t) nmatrices ; i++)
+    {
+        if (GB_CHECKPOINT_LARGE (As [i]))
+        {
+            GB_OK (GB_checkpoint_one (&(Blobs [i]), &(Blob_bytes [i]),
+                &(Blob_alloc [i]), As [i], method, Werk)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // serialize the small matrices concurrently, one thread per matrix
+    //--------------------------------------------------------------------------
+
+    bool failed = false ;
+    int nthreads = GB_nthreads (nmatrices, 1, nthreads_max) ;
+
+    int64_t i ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+    for (i = 0 ; i < (int64_t) nmatrices ; i++)
+    {
+        if (Blobs [i] == NULL && !GB_CHECKPOINT_LARGE (As [i]))
+        {
+            // each task uses its own Werk stack
+            GB_Werk_struct PWerk_struct ;
+            GB_Werk PWerk = &PWerk_struct ;
+            PWerk->where = "GxB_checkpoint" ;
+            PWerk->logger_handle = NULL ;
+            PWerk->logger_size_handle = NULL ;
+            PWerk->pwerk = 0 ;
+            GrB_Info info2 = GB_checkpoint_one (&(Blobs [i]),
+                &(Blob_bytes [i]), &(Blob_alloc [i]), As [i], method, PWerk) ;
+            if (info2 != GrB_SUCCESS)
+            {
+                GB_ATOMIC_WRITE
+                failed = true ;
+            }
+        }
+    }
+
+    if (failed)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // write the manifest: magic, version, count, and the per-matrix sizes
+    //--------------------------------------------------------------------------
+
+    uint64_t header [3] ;
+    header [0] = GB_CHECKPOINT_MAGIC ;
+    header [1] = GB_CHECKPOINT_VERSION ;
+    header [2] = (uint64_t) nmatrices ;
+
+    size_t total = 0 ;
+    bool ok = write (stream, header, sizeof (header)) ;
+    total += sizeof (header) ;
+    if (ok && nmatrices > 0)
+    {
+        ok = write (stream, Blob_bytes, nmatrices * sizeof (uint64_t)) ;
+        total += nmatrices * sizeof (uint64_t) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // write the blobs in order, freeing each as soon as it is written
+    //--------------------------------------------------------------------------
+
+    for (int64_t k = 0 ; ok && k < (int64_t) nmatrices ; k++)
+    {
+        ok = write (stream, Blobs [k], (size_t) Blob_bytes [k]) ;
+        total += (size_t) Blob_bytes [k] ;
+        GB_FREE (&(Blobs [k]), Blob_alloc [k]) ;
+    }
+
+    GB_FREE_ALL ;
+
+    if (!ok)
+    {
+        // the write callback failed; the stream contents are undefined
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    (*blob_size_handle) = (GrB_Index) total ;
+    GB_BURBLE_END ;
+    #pragma omp flush
+    return (GrB_SUCCESS) ;
+}
@@ -10,6 +10,7 @@
 #include "GB.h"
 
 #undef GxB_colIterator_attach
+#undef GxB_colIterator_attachRange
 #undef GxB_colIterator_kount
 #undef GxB_colIterator_seekCol
 #undef GxB_colIterator_kseek
@@ -33,6 +34,20 @@ GrB_Info GxB_colIterator_attach
     return (GB_Iterator_attach (iterator, A, GxB_BY_COL, desc)) ;
 }
 
+GrB_Info GxB_colIterator_attachRange
+(
+    GxB_Iterator iterator,
+    GrB_Matrix A,
+    GrB_Index k0,
+    GrB_Index k1,
+    GrB_Descriptor desc
+)
+{ 
+    // attach a column iterator to columns k0 to k1-1 of a matrix
+    return (GB_Iterator_attach_range (iterator, A, GxB_BY_COL, k0, k1,
+        desc)) ;
+}
+
 GrB_Index GxB_colIterator_kount (GxB_Iterator iterator)
 { 
     // return # of nonempty columns of the matrix
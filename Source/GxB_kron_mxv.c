@@ -0,0 +1,62 @@
+//------------------------------------------------------------------------------
+// GxB_kron_mxv: Kronecker-product matrix-vector multiply
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// w<M> = accum (w, kron(A,B)*u), without materializing kron(A,B).
+// See GB_kron_mxv for a description of the method.
+
+#include "GB_kron.h"
+#include "GB_get_mask.h"
+
+GrB_Info GxB_kron_mxv               // w<M> = accum (w, kron(A,B)*u)
+(
+    GrB_Vector w,                   // input/output vector for results
+    const GrB_Vector M_in,          // optional mask for w, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_Semiring semiring,    // defines '+' and '*' for kron(A,B)*u
+    const GrB_Matrix A,             // first input:  matrix A of kron(A,B)
+    const GrB_Matrix B,             // second input: matrix B of kron(A,B)
+    const GrB_Vector u,             // third input:  vector u
+    const GrB_Descriptor desc       // descriptor for w, M, A, and B
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (w, "GxB_kron_mxv (w, M, accum, semiring, A, B, u, desc)") ;
+    GB_BURBLE_START ("GxB_kron_mxv") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (w) ;
+    GB_RETURN_IF_FAULTY (M_in) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (B) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (u) ;
+    ASSERT (GB_VECTOR_OK (w)) ;
+    ASSERT (M_in == NULL || GB_VECTOR_OK (M_in)) ;
+    ASSERT (GB_VECTOR_OK (u)) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        A_transpose, B_transpose, xx1, xx2) ;
+
+    // get the mask
+    GrB_Matrix M = GB_get_mask ((GrB_Matrix) M_in, &Mask_comp, &Mask_struct) ;
+
+    //--------------------------------------------------------------------------
+    // w<M> = accum (w, kron(A,B)*u)
+    //--------------------------------------------------------------------------
+
+    info = GB_kron_mxv ((GrB_Matrix) w, C_replace, M, Mask_comp, Mask_struct,
+        accum, semiring, A, A_transpose, B, B_transpose, (GrB_Matrix) u,
+        Werk) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -0,0 +1,278 @@
+//------------------------------------------------------------------------------
+// GxB_mxm_estimate: predict the cost of GrB_mxm without executing it
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Takes the same inputs as GrB_mxm and returns the method GrB_mxm would
+// select, a flop count estimate, and an upper bound on the memory the
+// multiply would need (workspace plus the output), without computing C.  A
+// scheduler can use the estimates to route oversized jobs elsewhere, instead
+// of discovering the problem via a malloc failure in the middle of a kernel.
+
+// The method is chosen with the same GB_AxB_meta_adotb_control heuristic that
+// GB_AxB_meta uses, after normalizing the CSR/CSC formats and the descriptor
+// transposes the same way.  For the saxpy method with no transpose left to
+// apply, the flop count is exact, from GB_AxB_saxpy3_flopcount (the same
+// count the multiply itself would compute to slice its work).  For the other
+// cases the flop count is a density-based estimate, since computing the exact
+// count would require materializing a transpose — most of the work being
+// estimated.  The memory bound assumes every flop can produce an entry of C,
+// so it is safe for admission control but can be well above the actual usage
+// for multiplies with heavy collisions.
+
+// Any pending work on M, A, and B is finished here, just as GrB_mxm would;
+// C is not modified.
+
+#include "GB_mxm.h"
+#include "GB_get_mask.h"
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE (&Bflops, Bflops_size) ;        \
+}
+
+GrB_Info GxB_mxm_estimate           // estimate the cost of C<Mask>=A*B
+(
+    // output:
+    double *flops,                  // estimated # of multiply-add pairs
+    GrB_Index *peak_bytes,          // upper bound on workspace + output bytes
+    int *method,                    // method GrB_mxm would use: GxB_MXM_*
+    // input: the same arguments as GrB_mxm
+    const GrB_Matrix C,             // output matrix (not modified)
+    const GrB_Matrix Mask,          // optional mask for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Semiring semiring,    // defines '+' and '*' for A*B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Descriptor desc       // descriptor for C, Mask, A, and B
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_mxm_estimate (&flops, &peak_bytes, &method, C, Mask,"
+        " accum, semiring, A, B, desc)") ;
+    GB_BURBLE_START ("GxB_mxm_estimate") ;
+    GB_RETURN_IF_NULL (flops) ;
+    GB_RETURN_IF_NULL (peak_bytes) ;
+    GB_RETURN_IF_NULL (method) ;
+    (*flops) = 0 ;
+    (*peak_bytes) = 0 ;
+    (*method) = GxB_MXM_SAXPY ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_FAULTY (Mask) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (semiring) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (B) ;
+
+    int64_t *Bflops = NULL ; size_t Bflops_size = 0 ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        A_transpose, B_transpose, AxB_method, do_sort) ;
+
+    // get the mask
+    GrB_Matrix M = GB_get_mask (Mask, &Mask_comp, &Mask_struct) ;
+
+    // check the dimensions, as GrB_mxm would
+    GrB_Index anrows = (A_transpose) ? GB_NCOLS (A) : GB_NROWS (A) ;
+    GrB_Index ancols = (A_transpose) ? GB_NROWS (A) : GB_NCOLS (A) ;
+    GrB_Index bnrows = (B_transpose) ? GB_NCOLS (B) : GB_NROWS (B) ;
+    GrB_Index bncols = (B_transpose) ? GB_NROWS (B) : GB_NCOLS (B) ;
+    if (ancols != bnrows || GB_NROWS (C) != anrows || GB_NCOLS (C) != bncols)
+    {
+        return (GrB_DIMENSION_MISMATCH) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finish any pending work, so the patterns can be examined
+    //--------------------------------------------------------------------------
+
+    GB_MATRIX_WAIT (M) ;
+    GB_MATRIX_WAIT (A) ;
+    GB_MATRIX_WAIT (B) ;
+
+    //--------------------------------------------------------------------------
+    // normalize the CSR/CSC formats and the transposes, as GB_AxB_meta does
+    //--------------------------------------------------------------------------
+
+    // a transposed CSR matrix is the same as a non-transposed CSC matrix
+    bool atrans = A_transpose ;
+    bool btrans = B_transpose ;
+    if (!A->is_csc) atrans = !atrans ;
+    if (!B->is_csc) btrans = !btrans ;
+
+    GrB_Matrix A1 = A ;
+    GrB_Matrix B1 = B ;
+    if (atrans && btrans)
+    {
+        // C=A'*B' is computed as (B*A)' ; swap the operands
+        A1 = B ;
+        B1 = A ;
+        atrans = false ;
+        btrans = false ;
+    }
+
+    //--------------------------------------------------------------------------
+    // choose the method, with the same heuristic as GB_AxB_meta
+    //--------------------------------------------------------------------------
+
+    GB_Opcode opcode = semiring->multiply->opcode ;
+    bool op_is_first  = (opcode == GB_FIRST_binop_code) ;
+    bool op_is_second = (opcode == GB_SECOND_binop_code) ;
+    bool allow_scale = true ;
+    if (semiring->multiply->binop_function == NULL &&
+        (op_is_first || op_is_second))
+    {
+        // see GB_AxB_meta: rowscale/colscale do not handle the implicit
+        // FIRST and SECOND operators of GB_reduce_to_vector
+        allow_scale = false ;
+    }
+
+    // see if GrB_mxm could compute C in-place (for dot4 control only)
+    bool can_do_in_place = false ;
+    if (accum != NULL)
+    {
+        bool accum_is_monoid = (accum == semiring->add->op)
+            && (C->type == accum->ztype) ;
+        can_do_in_place = GB_IS_FULL (C) && accum_is_monoid
+            && ((M == NULL) || !C_replace) ;
+    }
+
+    int axb_method = GB_USE_SAXPY ;
+
+    if (atrans)
+    {
+        // C=A1'*B1: the dot product can consume A1' directly
+        GB_AxB_meta_adotb_control (&axb_method, can_do_in_place ? C : NULL,
+            M, Mask_comp, A1, B1, accum, semiring, false, can_do_in_place,
+            allow_scale, GB_is_diagonal (B1), AxB_method) ;
+    }
+    else
+    {
+        // C=A1*B1 or C=A1*B1': scale if one operand is diagonal, dot only on
+        // user request (it would require a transpose), else saxpy
+        if (allow_scale && M == NULL && !btrans && GB_is_diagonal (A1))
+        {
+            axb_method = GB_USE_ROWSCALE ;
+        }
+        else if (allow_scale && M == NULL && !btrans && GB_is_diagonal (B1))
+        {
+            axb_method = GB_USE_COLSCALE ;
+        }
+        else if (AxB_method == GxB_AxB_DOT)
+        {
+            axb_method = GB_USE_DOT ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // estimate the flop count for the chosen method
+    //--------------------------------------------------------------------------
+
+    double anz = (double) GB_nnz_held (A1) ;
+    double bnz = (double) GB_nnz_held (B1) ;
+    double anvec = (double) GB_IMAX (A1->nvec, 1) ;
+    double bnvec = (double) GB_IMAX (B1->nvec, 1) ;
+    double cm = (double) GB_NROWS (C) ;
+    double cn = (double) GB_NCOLS (C) ;
+    double mnz = (M == NULL) ? 0 : (double) GB_nnz_held (M) ;
+
+    double fl = 0 ;
+
+    switch (axb_method)
+    {
+
+        case GB_USE_ROWSCALE :
+            // C=D*B scales each entry of B once
+            fl = bnz ;
+            break ;
+
+        case GB_USE_COLSCALE :
+            // C=A*D scales each entry of A once
+            fl = anz ;
+            break ;
+
+        case GB_USE_DOT :
+        {
+            // each dot product C(i,j)=A1(:,i)'*B1(:,j) costs about the
+            // smaller of the two average vector lengths; with a
+            // non-complemented mask (dot3) only the entries in M are computed
+            double dot_work = fmin (anz / anvec, bnz / bnvec) ;
+            double ndots = (M != NULL && !Mask_comp) ? mnz : (cm * cn) ;
+            fl = ndots * dot_work ;
+        }
+        break ;
+
+        default : // GB_USE_SAXPY
+        {
+            if (!atrans && !btrans && A1->vdim == B1->vlen)
+            {
+                // no transpose left to apply: use the exact flop count that
+                // the saxpy3 multiply itself would compute to slice its work
+                int64_t bnvec1 = B1->nvec ;
+                Bflops = GB_MALLOC (bnvec1 + 1, int64_t, &Bflops_size) ;
+                if (Bflops == NULL)
+                {
+                    // out of memory
+                    return (GrB_OUT_OF_MEMORY) ;
+                }
+                // the mask can be used only if its stored orientation
+                // matches C=A1*B1; otherwise the unmasked count is an
+                // upper bound
+                GrB_Matrix M1 = (M != NULL && M->vlen == A1->vlen
+                    && M->vdim == B1->vdim) ? M : NULL ;
+                int64_t Mwork = 0 ;
+                GB_OK (GB_AxB_saxpy3_flopcount (&Mwork, Bflops, M1,
+                    (M1 == NULL) ? false : Mask_comp, A1, B1, Werk)) ;
+                fl = (double) Bflops [bnvec1] ;
+                GB_FREE (&Bflops, Bflops_size) ;
+            }
+            else
+            {
+                // a transpose would be materialized first; estimate from the
+                // densities: each entry of B1 touches an average vector of A1
+                fl = bnz * (anz / (double) GB_IMAX (A1->vdim, 1)) ;
+            }
+        }
+        break ;
+    }
+
+    //--------------------------------------------------------------------------
+    // bound the peak memory for the chosen method
+    //--------------------------------------------------------------------------
+
+    // every flop can produce at most one entry of C, and C can have no more
+    // entries than its dimensions allow; each entry of C needs its value and
+    // a row index, plus comparable per-entry workspace (the saxpy3 hash
+    // tables, or the dot3 task lists)
+    double csize = (double) semiring->add->op->ztype->size ;
+    double cnz_bound = fmin (fl, cm * cn) ;
+    double bytes ;
+    if (axb_method == GB_USE_DOT && !(M != NULL && !Mask_comp))
+    {
+        // unmasked dot (dot2) builds C as a bitmap
+        bytes = cm * cn * (csize + 1) ;
+    }
+    else
+    {
+        bytes = cnz_bound * (csize + 2 * sizeof (int64_t)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return the result
+    //--------------------------------------------------------------------------
+
+    (*flops) = fl ;
+    (*peak_bytes) = (GrB_Index) bytes ;
+    (*method) = axb_method ;
+    GB_BURBLE_END ;
+    #pragma omp flush
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,91 @@
+//------------------------------------------------------------------------------
+// GxB_mxm_reduce: s = accum (s, reduce (A*B))
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Reduce the matrix product A*B (optionally masked) to a scalar, without
+// constructing a user-visible matrix for the product.  This is the common
+// pipeline of algorithms such as triangle counting, which compute
+// s = reduce (C<M> = A*B) and then discard C.  The product is held in an
+// internal transient matrix that is freed before this method returns, so no
+// completed user matrix (with pending work, hyper-hash, or user header) is
+// ever built.  Fusing the reduction into the multiply kernels themselves,
+// so the product entries are never stored at all, can be layered under this
+// same user API later.
+
+// The monoid reduces the product; the optional accum combines the reduced
+// value with an existing value of s, as in GrB_Matrix_reduce_Monoid_Scalar.
+
+#include "GB_mxm.h"
+#include "GB_get_mask.h"
+#include "GB_reduce.h"
+
+#define GB_FREE_ALL GB_Matrix_free (&T) ;
+
+GrB_Info GxB_mxm_reduce             // s = accum (s, reduce (A*B))
+(
+    GrB_Scalar s,                   // result scalar
+    const GrB_BinaryOp accum,       // optional accum for s = accum(s,t)
+    const GrB_Monoid monoid,        // monoid for the reduction
+    const GrB_Semiring semiring,    // defines '+' and '*' for T=A*B
+    const GrB_Matrix M_in,          // optional mask for T=A*B, unused if NULL
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Descriptor desc       // descriptor for M, A, and B,
+                                    // and method used for T=A*B
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix T = NULL ;
+    GB_WHERE (s, "GxB_mxm_reduce (s, accum, monoid, semiring, M, A, B, desc)") ;
+    GB_BURBLE_START ("GxB_mxm_reduce") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (s) ;
+    GB_RETURN_IF_FAULTY (M_in) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (semiring) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (B) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        A_transpose, B_transpose, AxB_method, do_sort) ;
+
+    // get the mask
+    GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
+
+    //--------------------------------------------------------------------------
+    // T<M> = A*B, A'*B, A*B', or A'*B', into a transient internal matrix
+    //--------------------------------------------------------------------------
+
+    GrB_Index tnrows = (A_transpose) ? GB_NCOLS (A) : GB_NROWS (A) ;
+    GrB_Index tncols = (B_transpose) ? GB_NROWS (B) : GB_NCOLS (B) ;
+    GrB_Type ztype = semiring->add->op->ztype ;
+    GB_OK (GB_Matrix_new (&T, ztype, tnrows, tncols)) ;
+
+    GB_OK (GB_mxm (
+        T,          false,          // T = A*B, no C_replace
+        M, Mask_comp, Mask_struct,  // mask matrix and its descriptor
+        NULL,                       // no accum into T
+        semiring,                   // semiring that defines T=A*B
+        A,          A_transpose,    // A matrix and its descriptor
+        B,          B_transpose,    // B matrix and its descriptor
+        false,                      // use fmult(x,y), flipxy = false
+        AxB_method, do_sort,        // algorithm selector
+        Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // s = accum (s, reduce (T)), and free T
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_Scalar_reduce (s, accum, monoid, T, Werk)) ;
+    GB_FREE_ALL ;
+    GB_BURBLE_END ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,103 @@
+//------------------------------------------------------------------------------
+// GxB_mxm_select: C<M> = accum (C, select (A*B, Thunk))
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Multiply A*B and keep only the entries of the product that satisfy the
+// given GrB_IndexUnaryOp (GrB_VALUEGT_FP64 with a threshold, for example, to
+// keep only large similarities in a k-NN graph construction).  The product is
+// held in a transient internal matrix and filtered by GB_select before the
+// user-visible C is touched, so C never holds the unfiltered product and no
+// user matrix is completed just to be pruned.  The mask, accum, and
+// descriptor behave as they do for GrB_select applied to a materialized
+// product: C<M> = accum (C, select (A*B)).
+
+// The mask is also applied when computing the product itself, which is
+// valid since the select operator and the mask both filter the pattern
+// entry-by-entry, so the two filters commute.
+
+#include "GB_mxm.h"
+#include "GB_get_mask.h"
+#include "GB_select.h"
+
+#define GB_FREE_ALL GB_Matrix_free (&W) ;
+
+GrB_Info GxB_mxm_select             // C<M> = accum (C, select (A*B, Thunk))
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_Matrix M_in,          // optional mask for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Semiring semiring,    // defines '+' and '*' for A*B
+    const GrB_IndexUnaryOp op,      // operator to select the entries to keep
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Scalar Thunk,         // scalar input for the select operator
+    const GrB_Descriptor desc       // descriptor for C, M, A, and B
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix W = NULL ;
+    GB_WHERE (C, "GxB_mxm_select (C, M, accum, semiring, op, A, B, Thunk,"
+        " desc)") ;
+    GB_BURBLE_START ("GxB_mxm_select") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_FAULTY (M_in) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (semiring) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (op) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (B) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (Thunk) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        A_transpose, B_transpose, AxB_method, do_sort) ;
+
+    // get the mask
+    GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
+
+    //--------------------------------------------------------------------------
+    // W<M> = A*B, A'*B, A*B', or A'*B', into a transient internal matrix
+    //--------------------------------------------------------------------------
+
+    GrB_Index wnrows = (A_transpose) ? GB_NCOLS (A) : GB_NROWS (A) ;
+    GrB_Index wncols = (B_transpose) ? GB_NROWS (B) : GB_NCOLS (B) ;
+    GrB_Type ztype = semiring->add->op->ztype ;
+    GB_OK (GB_Matrix_new (&W, ztype, wnrows, wncols)) ;
+
+    GB_OK (GB_mxm (
+        W,          false,          // W = A*B, no C_replace
+        M, Mask_comp, Mask_struct,  // mask matrix and its descriptor
+        NULL,                       // no accum into W
+        semiring,                   // semiring that defines W=A*B
+        A,          A_transpose,    // A matrix and its descriptor
+        B,          B_transpose,    // B matrix and its descriptor
+        false,                      // use fmult(x,y), flipxy = false
+        AxB_method, do_sort,        // algorithm selector
+        Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // C<M> = accum (C, select (W, Thunk)), and free W
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_select (
+        C,          C_replace,      // C matrix and its descriptor
+        M, Mask_comp, Mask_struct,  // mask matrix and its descriptor
+        accum,                      // optional accum for Z=accum(C,T)
+        op,                         // operator to select the entries
+        W,                          // input matrix: the transient product
+        Thunk,                      // optional input for the select operator
+        false,                      // W is never transposed
+        Werk)) ;
+
+    GB_FREE_ALL ;
+    GB_BURBLE_END ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,117 @@
+//------------------------------------------------------------------------------
+// GxB_mxv_axpby: y = alpha*(A*x) + beta*y in one fused operation
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The axpby update of iterative solvers (CG, PageRank): y is scaled by beta
+// in place, and A*x, scaled by alpha, is accumulated into it with the monoid
+// of the semiring.  Issued as separate GrB_mxv, GrB_apply, and GrB_eWiseAdd
+// calls this takes three full passes and two temporaries; here the scaling
+// passes touch only the vectors, and the accumulation into y uses the
+// in-place dense-accumulate multiply kernels (GB_AxB_dot4 / GB_AxB_saxpy4)
+// whenever y is full, so the matrix A is read exactly once and no
+// matrix-sized temporary is created.
+
+// alpha is folded into x before the multiply, so what is computed is
+// A*(alpha*x), where '*' within the fold is the multiplicative operator of
+// the semiring; for the conventional arithmetic semirings this is the same
+// as alpha*(A*x).  beta*y uses the same operator.  In terms of the semiring
+// (add,mult), entries of y with no corresponding entry of A*x keep the value
+// beta*y(i), as the axpby of a dense solver would.
+
+// alpha and beta must both have an entry; GrB_Scalars with no entry are
+// rejected, since "missing" has no meaning for a scale factor.
+
+#include "GB_mxm.h"
+#include "GB_apply.h"
+#include "GB_new.h"
+
+#define GB_FREE_ALL                     \
+{                                       \
+    GB_Matrix_free (&x2) ;              \
+}
+
+GrB_Info GxB_mxv_axpby          // y = alpha*(A*x) + beta*y
+(
+    GrB_Vector y,               // input/output vector
+    const GrB_Semiring semiring,// defines '+' and '*' for A*x
+    const GrB_Scalar alpha,     // scale factor for A*x
+    const GrB_Matrix A,         // input matrix
+    const GrB_Vector x,         // input vector
+    const GrB_Scalar beta,      // scale factor for the input y
+    const GrB_Descriptor desc   // descriptor for A (to use A' for example)
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (y, "GxB_mxv_axpby (y, semiring, alpha, A, x, beta, desc)") ;
+    GB_BURBLE_START ("GxB_mxv_axpby") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (y) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (semiring) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (alpha) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (x) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (beta) ;
+    ASSERT (GB_VECTOR_OK (y)) ;
+    ASSERT (GB_VECTOR_OK (x)) ;
+
+    GrB_Matrix x2 = NULL ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, xx0, xx1, xx2,
+        A_transpose, xx3, AxB_method, do_sort) ;
+
+    GrB_BinaryOp mult = semiring->multiply ;
+    GrB_BinaryOp add = semiring->add->op ;
+
+    if (GB_OPCODE_IS_POSITIONAL (mult->opcode))
+    { 
+        GB_ERROR (GrB_DOMAIN_MISMATCH, "Semiring multiply operator %s is"
+            " positional; alpha and beta cannot be folded into it",
+            mult->name) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // x2 = alpha * x, folding alpha into the multiply input
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_Matrix_new (&x2, mult->ztype, x->vlen, 1)) ;
+    GB_OK (GB_apply ((GrB_Matrix) x2, false, NULL, false, false, NULL,
+        (GB_Operator) mult, alpha, true, (GrB_Matrix) x, false, Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // y = beta * y, in place
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_apply ((GrB_Matrix) y, false, NULL, false, false, NULL,
+        (GB_Operator) mult, beta, true, (GrB_Matrix) y, false, Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // y += A*x2, accumulating with the monoid of the semiring
+    //--------------------------------------------------------------------------
+
+    // with y full and the accum equal to the monoid, this takes the in-place
+    // dense-accumulate kernels (dot4 for y+=A'*x2, saxpy4 for y+=A*x2)
+
+    GB_OK (GB_mxm (
+        (GrB_Matrix) y,     false,          // y, no C_replace
+        NULL, false, false,                 // no mask
+        add,                                // accum: the monoid of semiring
+        semiring,                           // definition of matrix multiply
+        A,                  A_transpose,    // allow A to be transposed
+        x2,                 false,          // x2 is never transposed
+        false,                              // fmult(x,y), flipxy = false
+        AxB_method, do_sort,                // algorithm selector
+        Werk)) ;
+
+    GB_FREE_ALL ;
+    GB_BURBLE_END ;
+    return (GrB_SUCCESS) ;
+}
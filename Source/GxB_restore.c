@@ -0,0 +1,140 @@
+//------------------------------------------------------------------------------
+// GxB_restore: deserialize a set of matrices from a checkpoint blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Reads back a checkpoint written by GxB_checkpoint.  The manifest gives the
+// size of each per-matrix blob, so the blob offsets are known up front and
+// the matrices are deserialized concurrently, one thread per matrix, with a
+// dynamic schedule so a few large matrices do not serialize the whole
+// restore behind them.
+
+// The caller must know how many matrices the checkpoint holds; nmatrices
+// must match the count in the manifest.  Types is optional: if non-NULL, it
+// gives the expected type of each matrix, which is required when a matrix
+// has a user-defined type (just as for GxB_Matrix_deserialize).
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+#define GB_FREE_ALL                                             \
+{                                                               \
+    if (As != NULL)                                             \
+    {                                                           \
+        for (int64_t i = 0 ; i < (int64_t) nmatrices ; i++)     \
+        {                                                       \
+            GB_Matrix_free (&(As [i])) ;                        \
+        }                                                       \
+    }                                                           \
+}
+
+GrB_Info GxB_restore            // deserialize a set of matrices from a blob
+(
+    // output:
+    GrB_Matrix *As,                 // array of nmatrices matrices, created
+    // input:
+    const GrB_Type *Types,          // expected type of each matrix, or NULL
+    GrB_Index nmatrices,            // # of matrices in the checkpoint
+    const void *blob,               // the checkpoint blob
+    GrB_Index blob_size             // size of the blob
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_restore (As, Types, nmatrices, blob, blob_size)") ;
+    GB_BURBLE_START ("GxB_restore") ;
+    GB_RETURN_IF_NULL (As) ;
+    GB_RETURN_IF_NULL (blob) ;
+
+    for (int64_t i = 0 ; i < (int64_t) nmatrices ; i++)
+    {
+        As [i] = NULL ;
+    }
+
+    //--------------------------------------------------------------------------
+    // parse and validate the manifest
+    //--------------------------------------------------------------------------
+
+    size_t manifest_size = 3 * sizeof (uint64_t)
+        + ((size_t) nmatrices) * sizeof (uint64_t) ;
+    if ((size_t) blob_size < manifest_size)
+    {
+        // blob too small to hold the manifest
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    uint64_t header [3] ;
+    memcpy (header, blob, sizeof (header)) ;
+    if (header [0] != GB_CHECKPOINT_MAGIC
+        || header [1] != GB_CHECKPOINT_VERSION
+        || header [2] != (uint64_t) nmatrices)
+    {
+        // not a checkpoint blob, an unknown version, or a count mismatch
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    const uint64_t *Blob_bytes = (const uint64_t *)
+        (((const GB_void *) blob) + 3 * sizeof (uint64_t)) ;
+
+    // compute the offset of each per-matrix blob, and check the total size
+    size_t total = manifest_size ;
+    for (int64_t i = 0 ; i < (int64_t) nmatrices ; i++)
+    {
+        if (Blob_bytes [i] > ((uint64_t) blob_size) - total)
+        {
+            // the blobs extend past the end of the checkpoint
+            return (GrB_INVALID_OBJECT) ;
+        }
+        total += (size_t) Blob_bytes [i] ;
+    }
+
+    //--------------------------------------------------------------------------
+    // deserialize the matrices concurrently, one thread per matrix
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    int nthreads = GB_nthreads (nmatrices, 1, nthreads_max) ;
+
+    bool failed = false ;
+
+    int64_t i ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+    for (i = 0 ; i < (int64_t) nmatrices ; i++)
+    {
+        // the offsets are a prefix sum of the manifest sizes; recomputing
+        // the sum per task is cheap compared to a single deserialization
+        size_t offset = manifest_size ;
+        for (int64_t k = 0 ; k < i ; k++)
+        {
+            offset += (size_t) Blob_bytes [k] ;
+        }
+        GrB_Type type = (Types == NULL) ? NULL : Types [i] ;
+        GrB_Info info2 = GB_deserialize (&(As [i]), type,
+            ((const GB_void *) blob) + offset, (size_t) Blob_bytes [i],
+            false, false) ;
+        if (info2 != GrB_SUCCESS)
+        {
+            GB_ATOMIC_WRITE
+            failed = true ;
+        }
+    }
+
+    if (failed)
+    {
+        // one of the blobs is invalid, has an unexpected type, or the
+        // deserialization ran out of memory
+        GB_FREE_ALL ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    GB_BURBLE_END ;
+    #pragma omp flush
+    return (GrB_SUCCESS) ;
+}
@@ -10,6 +10,7 @@
 #include "GB.h"
 
 #undef GxB_rowIterator_attach
+#undef GxB_rowIterator_attachRange
 #undef GxB_rowIterator_kount
 #undef GxB_rowIterator_seekRow
 #undef GxB_rowIterator_kseek
@@ -48,6 +49,28 @@ GrB_Info GxB_rowIterator_attach
     return (GB_Iterator_attach (iterator, A, GxB_BY_ROW, desc)) ;
 }
 
+//------------------------------------------------------------------------------
+// GxB_rowIterator_attachRange: attach a row iterator to a range of rows
+//------------------------------------------------------------------------------
+
+// GxB_rowIterator_attachRange is identical to GxB_rowIterator_attach, except
+// that the iterator visits only rows k0 to k1-1 of A, in the sense of
+// GxB_rowIterator_kseek.  On success, the iterator is also moved to the
+// first row of its range.
+
+GrB_Info GxB_rowIterator_attachRange
+(
+    GxB_Iterator iterator,
+    GrB_Matrix A,
+    GrB_Index k0,
+    GrB_Index k1,
+    GrB_Descriptor desc
+)
+{ 
+    return (GB_Iterator_attach_range (iterator, A, GxB_BY_ROW, k0, k1,
+        desc)) ;
+}
+
 //------------------------------------------------------------------------------
 // GxB_rowIterator_kount: upper bound on the # of nonempty rows of a matrix
 //------------------------------------------------------------------------------
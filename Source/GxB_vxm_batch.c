@@ -0,0 +1,106 @@
+//------------------------------------------------------------------------------
+// GxB_vxm_batch: w(k)'<M(k)> = accum (w(k)', u(k)'*A) for a batch of vectors
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Apply GrB_vxm for a batch of frontier vectors against the same matrix A, as
+// in a multi-source BFS.  All per-call setup that depends only on A — the
+// completion of pending work and the construction of A's hyper-hash — is
+// performed once for the whole batch, and the descriptor is decoded once.
+// Each frontier then runs through the same kernels as GrB_vxm.  The batch
+// entry point also gives a single place to later process all frontiers in
+// one parallel region with a shared slicing of A; per-frontier kernel
+// launches are kept for now.
+
+// Masks is optional.  If present, Masks [k] is the mask for w [k] (each of
+// which may be NULL); if Masks itself is NULL, no masks are used.
+
+#include "GB_mxm.h"
+#include "GB_get_mask.h"
+
+#define GB_FREE_ALL ;
+
+GrB_Info GxB_vxm_batch              // w(k)'<M(k)> = accum (w(k)', u(k)'*A)
+(
+    GrB_Vector *w,                  // input/output vectors for results
+    const GrB_Vector *Masks,        // optional masks, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_Semiring semiring,    // defines '+' and '*' for matrix multiply
+    const GrB_Vector *u,            // first inputs: vectors u
+    const GrB_Matrix A,             // second input: matrix A
+    GrB_Index nbatch,               // # of vectors in the batch
+    const GrB_Descriptor desc       // descriptor for w, Masks, and A
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_vxm_batch (w, Masks, accum, semiring, u, A, nbatch,"
+        " desc)") ;
+    GB_BURBLE_START ("GxB_vxm_batch") ;
+    GB_RETURN_IF_NULL (w) ;
+    GB_RETURN_IF_NULL (u) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    if (nbatch == 0)
+    {
+        // nothing to do
+        GB_BURBLE_END ;
+        return (GrB_SUCCESS) ;
+    }
+    for (GrB_Index k = 0 ; k < nbatch ; k++)
+    {
+        GB_RETURN_IF_NULL_OR_FAULTY (w [k]) ;
+        GB_RETURN_IF_NULL_OR_FAULTY (u [k]) ;
+        if (Masks != NULL)
+        {
+            GB_RETURN_IF_FAULTY (Masks [k]) ;
+        }
+    }
+
+    // get the descriptor, once for the whole batch
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp_in, Mask_struct_in,
+        xx, A_transpose, AxB_method, do_sort) ;
+
+    //--------------------------------------------------------------------------
+    // finish A and build its hyper-hash, once for the whole batch
+    //--------------------------------------------------------------------------
+
+    GB_MATRIX_WAIT (A) ;
+    GB_OK (GB_hyper_hash_build (A, Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // w(k)'<M(k)> = accum (w(k)', u(k)'*A) for each vector in the batch
+    //--------------------------------------------------------------------------
+
+    for (GrB_Index k = 0 ; k < nbatch ; k++)
+    {
+        // get the mask for this frontier
+        bool Mask_comp = Mask_comp_in ;
+        bool Mask_struct = Mask_struct_in ;
+        GrB_Matrix M = GB_get_mask (
+            (Masks == NULL) ? NULL : (GrB_Matrix) Masks [k],
+            &Mask_comp, &Mask_struct) ;
+
+        // w(k)'<M(k)> = accum (w(k)', u(k)'*A), as in GrB_vxm: A and u are
+        // swapped, A_transpose is negated, and the multiplier is flipped
+        GB_OK (GB_mxm (
+            (GrB_Matrix) w [k], C_replace,      // w(k) and its descriptor
+            M, Mask_comp, Mask_struct,          // mask and its descriptor
+            accum,                              // for accum (w,t)
+            semiring,                           // defn of matrix multiply
+            A,                  !A_transpose,   // allow A to be transposed
+            (GrB_Matrix) u [k], false,          // u is never transposed
+            true,                               // fmult(y,x), flipxy = true
+            AxB_method, do_sort,                // axb method and do_sort
+            Werk)) ;
+    }
+
+    GB_BURBLE_END ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,128 @@
+//------------------------------------------------------------------------------
+// GxB_waitAll: finish all work on a set of matrices
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Finishes all pending work on an array of matrices, as GrB_Matrix_wait would
+// one matrix at a time.  Waiting on the matrices one public call at a time
+// runs one build/sort after another, each in its own parallel region, and the
+// cores sit idle whenever the matrix being finished is small.  Here the
+// matrices with enough pending work to use more than one thread on their own
+// are finished one at a time with all threads, and all the remaining small
+// matrices are finished concurrently in a single dynamically-scheduled pass,
+// one thread per matrix, so an epoch of hundreds of small updates is
+// finalized in one sweep.
+
+// The matrices in As must be distinct; a matrix listed twice would be
+// finished by two threads at once.  With GrB_COMPLETE this is just a memory
+// fence, as for GrB_Matrix_wait.
+
+#include "GB.h"
+
+#define GB_FREE_ALL ;
+
+GrB_Info GxB_waitAll        // finish all work on a set of matrices
+(
+    GrB_Matrix *As,         // array of nmatrices matrices to finish
+    GrB_Index nmatrices,    // # of matrices
+    GrB_WaitMode waitmode   // GrB_COMPLETE or GrB_MATERIALIZE
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_waitAll (As, nmatrices, waitmode)") ;
+    GB_RETURN_IF_NULL (As) ;
+
+    for (int64_t i = 0 ; i < (int64_t) nmatrices ; i++)
+    {
+        GB_RETURN_IF_NULL_OR_FAULTY (As [i]) ;
+    }
+
+    if (waitmode == GrB_COMPLETE)
+    {
+        // nothing to compute; just a memory fence
+        #pragma omp flush
+        return (GrB_SUCCESS) ;
+    }
+
+    GB_BURBLE_START ("GxB_waitAll") ;
+
+    //--------------------------------------------------------------------------
+    // finish the large matrices, one at a time, with all threads
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+
+    // a matrix needs work if GrB_Matrix_wait would do any
+    #define GB_WAITALL_WORK(A) \
+        (GB_ANY_PENDING_WORK (A) || GB_NEED_HYPER_HASH (A))
+
+    // a matrix is "large" if finishing it would use more than one thread on
+    // its own; the pending tuples dominate the work of the build and sort
+    #define GB_WAITALL_LARGE(A) \
+        (GB_nthreads (GB_nnz_held (A) + GB_Pending_n (A), chunk, \
+            nthreads_max) > 1)
+
+    for (int64_t i = 0 ; i < (int64_t) nmatrices ; i++)
+    {
+        GrB_Matrix A = As [i] ;
+        if (GB_WAITALL_WORK (A) && GB_WAITALL_LARGE (A))
+        {
+            GB_OK (GB_wait (A, "matrix", Werk)) ;
+            GB_OK (GB_hyper_hash_build (A, Werk)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // finish the small matrices concurrently, one thread per matrix
+    //--------------------------------------------------------------------------
+
+    bool failed = false ;
+    int nthreads = GB_nthreads (nmatrices, 1, nthreads_max) ;
+
+    int64_t i ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+    for (i = 0 ; i < (int64_t) nmatrices ; i++)
+    {
+        GrB_Matrix A = As [i] ;
+        if (GB_WAITALL_WORK (A) && !GB_WAITALL_LARGE (A))
+        {
+            // each task uses its own Werk stack
+            GB_Werk_struct PWerk_struct ;
+            GB_Werk PWerk = &PWerk_struct ;
+            PWerk->where = "GxB_waitAll" ;
+            PWerk->logger_handle = NULL ;
+            PWerk->logger_size_handle = NULL ;
+            PWerk->pwerk = 0 ;
+            GrB_Info info2 = GB_wait (A, "matrix", PWerk) ;
+            if (info2 == GrB_SUCCESS)
+            {
+                info2 = GB_hyper_hash_build (A, PWerk) ;
+            }
+            if (info2 != GrB_SUCCESS)
+            {
+                GB_ATOMIC_WRITE
+                failed = true ;
+            }
+        }
+    }
+
+    if (failed)
+    {
+        // out of memory; the matrices already finished remain valid
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    GB_BURBLE_END ;
+    #pragma omp flush
+    return (GrB_SUCCESS) ;
+}
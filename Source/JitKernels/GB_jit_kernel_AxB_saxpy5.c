@@ -82,6 +82,32 @@ GB_JIT_GLOBAL GB_JIT_KERNEL_AXB_SAXPY5_PROTO (GB_jit_kernel) ;
             }
 
         #endif
+
+        //----------------------------------------------------------------------
+        // saxpy5 method for ARM64 NEON, same vector shapes as AVX2
+        //----------------------------------------------------------------------
+
+        // NEON (ASIMD) is a baseline feature of ARM64, so no runtime check
+        // and no target attribute is needed.  NEON registers are 128 bits;
+        // the 256-bit vector shapes above are lowered by the compiler onto
+        // pairs of NEON registers.
+
+        #if GB_COMPILER_SUPPORTS_NEON && GB_V4_256
+
+            static inline void GB_AxB_saxpy5_unrolled_neon
+            (
+                GrB_Matrix C,
+                const GrB_Matrix A,
+                const GrB_Matrix B,
+                const int ntasks,
+                const int nthreads,
+                const int64_t *B_slice
+            )
+            {
+                #include "GB_AxB_saxpy5_unrolled.c"
+            }
+
+        #endif
     
     #endif
 
@@ -168,6 +194,15 @@ GB_JIT_GLOBAL GB_JIT_KERNEL_AXB_SAXPY5_PROTO (GB_jit_kernel)
                 return (GrB_SUCCESS) ;
             }
             #endif
+
+            #if GB_COMPILER_SUPPORTS_NEON && GB_V4_256
+            {
+                // ARM64 with NEON
+                GB_AxB_saxpy5_unrolled_neon (C, A, B, ntasks, nthreads,
+                    B_slice) ;
+                return (GrB_SUCCESS) ;
+            }
+            #endif
         }
         #endif
 
@@ -11,8 +11,18 @@ GB_JIT_GLOBAL GB_JIT_KERNEL_UNION_PROTO (GB_jit_kernel) ;
 GB_JIT_GLOBAL GB_JIT_KERNEL_UNION_PROTO (GB_jit_kernel)
 {
     #define GB_IS_EWISEUNION 1
+    #ifdef GB_ALPHA_SCALAR
+    // alpha is folded into the kernel as a compile-time constant
+    GB_X_TYPE alpha_scalar = GB_ALPHA_SCALAR ;
+    #else
     GB_X_TYPE alpha_scalar = (*((GB_X_TYPE *) alpha_scalar_in)) ;
+    #endif
+    #ifdef GB_BETA_SCALAR
+    // beta is folded into the kernel as a compile-time constant
+    GB_Y_TYPE beta_scalar  = GB_BETA_SCALAR ;
+    #else
     GB_Y_TYPE beta_scalar  = (*((GB_Y_TYPE *) beta_scalar_in )) ;
+    #endif
     #include "GB_add_template.c"
     return (GrB_SUCCESS) ;
 }
@@ -0,0 +1,46 @@
+//------------------------------------------------------------------------------
+// GB_bitmap_scan.h: scan a byte bitmap one 64-bit word at a time
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The bitmap A->b holds one byte per entry, each 0 or 1.  The helpers below
+// view 8 consecutive bytes as a single 64-bit word, so a scan over the bitmap
+// can classify 8 entries per load: a zero word is 8 absent entries and can be
+// skipped outright, a word equal to GB_BITMAP_ALL8 is 8 present entries, and
+// the byte-sum of any word is the number of present entries in the group.
+// The byte-sum is computed without a population count: since every byte is 0
+// or 1, (w * GB_BITMAP_ALL8) >> 56 accumulates all eight bytes into the top
+// byte of the product, which cannot overflow.
+
+#ifndef GB_BITMAP_SCAN_H
+#define GB_BITMAP_SCAN_H
+
+// a word of 8 bitmap bytes, all present
+#define GB_BITMAP_ALL8 0x0101010101010101ULL
+
+// load 8 bitmap bytes Ab [p:p+7] as one word; the load need not be aligned
+static inline uint64_t GB_bitmap_word
+(
+    const int8_t *restrict Ab,      // the bitmap
+    int64_t p                       // first of 8 entries to load
+)
+{
+    uint64_t w ;
+    memcpy (&w, Ab + p, sizeof (uint64_t)) ;
+    return (w) ;
+}
+
+// number of entries present in a group of 8, given its word
+static inline int64_t GB_bitmap_word_count
+(
+    uint64_t w                      // word of 8 bitmap bytes, each 0 or 1
+)
+{
+    return ((int64_t) ((w * GB_BITMAP_ALL8) >> 56)) ;
+}
+
+#endif
@@ -23,6 +23,14 @@
 // lots of intentional collisions: but blocks are scattered
 #define GB_HASHF2(i,hash_bits) ((((i) >> 2) + 17L*((i) >> 8)) & (hash_bits))
 
+// hash function for the point-lookup index of GrB_Matrix_extractElement
+// (see GB_lookup_cache.c): combines the index i and vector index j of an
+// entry into a single bucket.  Computed in uint64 so huge indices wrap
+// instead of overflowing; the mask keeps the result in range.
+#define GB_HASHF_POINT(i,j,hash_bits) \
+    ((int64_t) (((((uint64_t) (i)) + 17 * ((uint64_t) (j))) * 257) \
+        & ((uint64_t) (hash_bits))))
+
 // rehash function, for subsequent hash lookups if the initial hash function
 // refers to a hash entry that is already occupied.  Linear probing is used,
 // so the function does not currently depend on i.  On input, hash is equal
@@ -16,6 +16,22 @@
 #ifndef GB_KERNEL_SHARED_DEFINITIONS_H
 #define GB_KERNEL_SHARED_DEFINITIONS_H
 
+//------------------------------------------------------------------------------
+// GB_PREFETCH: software prefetch of a read-only address
+//------------------------------------------------------------------------------
+
+// Brings the cache line holding the address p into the cache ahead of a
+// dependent random access, with low temporal locality so it does not evict
+// hotter lines.  A no-op on compilers without __builtin_prefetch.
+
+#ifndef GB_PREFETCH
+    #if defined ( __GNUC__ ) || defined ( __clang__ )
+        #define GB_PREFETCH(p) __builtin_prefetch ((const void *) (p), 0, 1)
+    #else
+        #define GB_PREFETCH(p)
+    #endif
+#endif
+
 //------------------------------------------------------------------------------
 // atomic compare/exchange for the GB_Z_TYPE data type
 //------------------------------------------------------------------------------
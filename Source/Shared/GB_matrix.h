@@ -302,6 +302,69 @@ GrB_Matrix Y ;      // Y is a matrix that represents the inverse of A->h.
                     // hypersparse matrices need the A->Y matrix.  It is
                     // constructed whenever it is needed.
 
+//------------------------------------------------------------------------------
+// row degree cache
+//------------------------------------------------------------------------------
+
+// A->degree caches the row degrees of the matrix: degree [i] = # of entries
+// in A(i,:), held as a plain array of size nrows.  Like the A->Y hyper_hash,
+// it is built on demand (GB_degree_cache) and freed whenever the pattern of
+// the matrix changes (GB_degree_free).  It is not serialized, it is always
+// deep, and it is never shared between matrices.
+
+int64_t *degree ;       // cached row degrees, of size nrows, or NULL
+size_t degree_size ;    // exact size of A->degree allocation
+
+//------------------------------------------------------------------------------
+// point-lookup index
+//------------------------------------------------------------------------------
+
+// A->lookup_p and A->lookup_e form an opt-in hash index over the entries of
+// a sparse or hypersparse matrix, giving GrB_Matrix_extractElement O(1)
+// expected-time point lookups in place of its O(log(d)) binary search.
+// Bucket b holds the entry positions lookup_e [lookup_p [b] ...
+// lookup_p [b+1]-1].  Unlike the A->Y hyper_hash it is only built on request
+// (GxB_Matrix_lookup_build; see GB_lookup_cache.c), but it is freed whenever
+// the pattern of the matrix changes, just like the A->degree cache.  It is
+// not serialized, it is always deep, and it is never shared between matrices.
+
+int64_t *lookup_p ;     // bucket offsets, of size lookup_nbuckets+1, or NULL
+int64_t *lookup_e ;     // entry positions grouped by bucket, of size nnz(A)
+size_t lookup_p_size ;  // exact size of A->lookup_p allocation
+size_t lookup_e_size ;  // exact size of A->lookup_e allocation
+int64_t lookup_nbuckets ;   // # of buckets, always a power of 2, or 0
+
+//------------------------------------------------------------------------------
+// content fingerprint cache
+//------------------------------------------------------------------------------
+
+// A->fingerprint caches the XXH3 hash of the matrix content computed by
+// GxB_Matrix_fingerprint, valid only while A->fingerprint_ok is true.  Every
+// method that frees or rewrites the content clears the flag
+// (GB_fingerprint_clear), so a repeated query of an unchanged matrix is
+// O(1).  Like the other caches above it is not serialized and it is never
+// shared between matrices.
+
+uint64_t fingerprint ;  // XXH3 hash of the content, if fingerprint_ok
+bool fingerprint_ok ;   // true if A->fingerprint is valid
+
+//------------------------------------------------------------------------------
+// header-resident vector pointers
+//------------------------------------------------------------------------------
+
+// A sparse GrB_Vector, GrB_Scalar, or single-vector matrix needs a vector
+// pointer array A->p of length just two.  Rather than placing this tiny array
+// on the heap, GB_new and GB_clear point A->p at A->p_static, inside the
+// header itself, which drops one allocation per vector and keeps the vector
+// pointers in the same cache lines as the header that is read alongside them.
+// A->p then satisfies (A->p == A->p_static); it is not flagged shallow, but
+// it must never be freed, resized, or handed to another owner: GB_phy_free
+// skips it, GB_transplant and GB_export copy it, and GB_dup_shared does not
+// register it in the share registry.
+
+int64_t p_static [2] ;  // vector pointers of a single-vector matrix, if
+                        // (A->p == A->p_static)
+
 //------------------------------------------------------------------------------
 // pending tuples
 //------------------------------------------------------------------------------
@@ -353,6 +416,22 @@ GrB_Matrix Y ;      // Y is a matrix that represents the inverse of A->h.
 
 GB_Pending Pending ;        // list of pending tuples
 
+//-----------------------------------------------------------------------------
+// deferred unary operator
+//-----------------------------------------------------------------------------
+
+// In nonblocking mode, GrB_apply can return its output in O(1) time as a
+// duplicate sharing the arrays of its input (see GB_dup_shared), with the
+// unary operator recorded here instead of applied to the values.  Like
+// pending tuples, the operator is a third form of pending work: it is
+// applied to A->x, in place, when the matrix is next materialized (see
+// GB_materialize and GB_wait), and it is discarded if the matrix is freed
+// or overwritten first.  The operator applies only to the values already in
+// A->x, never to pending tuples, which can only be added after the apply
+// was deferred.
+
+GrB_UnaryOp deferred_unop ; // unary op not yet applied to A->x, or NULL
+
 //-----------------------------------------------------------------------------
 // zombies
 //-----------------------------------------------------------------------------
@@ -451,6 +530,13 @@ float bitmap_switch ;   // controls conversion sparse to/from bitmap
 int sparsity_control ;  // controls sparsity structure: hypersparse,
                         // sparse, bitmap, or full, or any combination.
 
+int gpu_device ;        // GPU on which the matrix arrays are pinned, or -1
+                        // (the default) to let unified memory migrate them
+                        // freely.  The placement advice is applied to the
+                        // arrays the matrix holds when the option is set;
+                        // arrays reallocated by later operations migrate
+                        // freely until the option is set again.
+
 //------------------------------------------------------------------------------
 // shallow matrices
 //------------------------------------------------------------------------------
@@ -506,6 +592,78 @@ bool jumbled ;          // true if the matrix may be jumbled.  bitmap and full
 
 bool iso ;              // true if all entries have the same value
 
+//------------------------------------------------------------------------------
+// adaptive A'*B method history
+//------------------------------------------------------------------------------
+
+// When this matrix appears as A in C=A'*B, the observed cost per entry of C
+// (in seconds) of the dot-product and saxpy families of methods is recorded
+// here as an exponentially-weighted average, and consulted on later calls to
+// steer the dot-vs-saxpy choice (pull vs push, in graph traversal terms).
+// Like the hyper_hash, this history travels with the matrix but is not
+// serialized.  Zero means the method has not yet been tried on this matrix.
+
+float adotb_dot_cost ;      // averaged seconds per entry of C, dot methods
+float adotb_saxpy_cost ;    // averaged seconds per entry of C, saxpy methods
+
+//------------------------------------------------------------------------------
+// select history
+//------------------------------------------------------------------------------
+
+// The most recent built-in GrB_VALUE* select applied to this matrix is
+// recorded here, along with the number of entries it kept.  When the same
+// selection is repeated (a common pattern: pruning with a fixed threshold as
+// the matrix slowly changes), GB_select_sparse consults this record to decide
+// whether a single fused scan is cheaper than its usual two-pass method.  The
+// record is a performance hint only: the fused scan sizes its workspace by
+// the current number of entries, so a stale record can only mis-predict the
+// cost of a method, never its result.  Like the method history above, this
+// record travels with the matrix but is not serialized.
+
+int32_t select_opcode ;     // opcode of the last GrB_VALUE* select, or 0
+GB_void select_ythunk [16] ;// its thunk value (all built-in types fit)
+int64_t select_anz ;        // # of entries the matrix had at that time
+int64_t select_cnz ;        // # of entries the selection kept, or -1
+
+//------------------------------------------------------------------------------
+// sparse <-> bitmap conversion history
+//------------------------------------------------------------------------------
+
+// GB_conform keeps a matrix in its current format inside a density band (see
+// GB_convert_s2b_test), so that a matrix near the bitmap_switch threshold
+// does not convert on every small change.  The fixed band is not always
+// enough: an iterative method whose working set grows and shrinks each step
+// (a BFS frontier, say) can cross the whole band every iteration and pay for
+// a conversion in both directions.  Each conversion that reverses the prior
+// one therefore bumps s2b_thrash, which doubles the width of the band, so an
+// oscillating matrix quickly settles into whichever format it currently has.
+// A conversion in the same direction as the prior one clears the counter.
+// Like the method history above, this record travels with the matrix but is
+// not serialized.
+
+int32_t s2b_last ;          // last conversion: +1 = sparse/hyper to bitmap,
+                            // -1 = bitmap to sparse, 0 = none yet
+int32_t s2b_thrash ;        // # of consecutive reversals, 0 to 3
+
+//------------------------------------------------------------------------------
+// format advisor counters
+//------------------------------------------------------------------------------
+
+// Cumulative counts of the format work this matrix has undergone over its
+// lifetime: conversions into and out of bitmap (the two directions that
+// rewrite the whole pattern), conversions between sparse and hypersparse,
+// and hyper_hash (re)builds.  Unlike s2b_thrash above these never reset;
+// they summarize the operation mix the matrix has actually seen, and
+// GxB_Matrix_advise turns them into a recommended sparsity control and
+// hyper_switch setting.  Like the method history above, the counters travel
+// with the matrix but are not serialized.
+
+int32_t conv_to_bitmap ;    // # of sparse/hyper to bitmap conversions
+int32_t conv_from_bitmap ;  // # of bitmap to sparse conversions
+int32_t conv_to_hyper ;     // # of sparse to hypersparse conversions
+int32_t conv_from_hyper ;   // # of hypersparse to sparse conversions
+int32_t yhash_builds ;      // # of times the hyper_hash has been built
+
 //------------------------------------------------------------------------------
 // iterating through a matrix
 //------------------------------------------------------------------------------
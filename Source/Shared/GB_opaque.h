@@ -446,6 +446,8 @@ struct GB_Descriptor_opaque // content of GrB_Descriptor
     int compression ;       // compression method for GxB_Matrix_serialize
     bool do_sort ;          // if nonzero, do the sort in GrB_mxm
     int import ;            // if zero (default), trust input data
+    bool mxm_pattern_reuse ;    // if true, GrB_mxm may reuse C's pattern and
+                            // redo only the numeric work (see GrB_mxm.c)
 } ;
 
 struct GB_Context_opaque    // content of GxB_Context
@@ -459,6 +461,51 @@ struct GB_Context_opaque    // content of GxB_Context
     // GPU:
     int gpu_id ;            // if negative: use the CPU only; do not use a GPU
                             // if >= 0: then use GPU gpu_id
+    // NUMA placement:
+    int numa ;              // if nonzero: first-touch large internal
+                            // workspaces in parallel, so their pages are
+                            // spread across the memory nodes of the threads
+                            // that use them
+    // work-queue mode (see GB_Context_slot_acquire):
+    int concurrency ;       // if > 0: at most this many of the user threads
+                            // sharing this Context may run a parallel kernel
+                            // at once; the other threads run their kernels
+                            // serially on the calling thread
+    #define GB_CONTEXT_SLOTS 64
+    double slot_time [GB_CONTEXT_SLOTS] ;  // claim time of each parallel
+                            // slot, or 0 if the slot is free; a stale claim
+                            // expires (see GB_CONTEXT_SLOT_EXPIRY)
+    // cooperative cancellation (see GxB_CONTEXT_CANCEL):
+    bool cancelled ;        // if true: a cancellation request is pending.
+                            // Long-running kernels poll this flag at coarse
+                            // task boundaries and return GxB_CANCELLED; the
+                            // request is consumed by the kernel that
+                            // observes it.  May be set from any user thread
+                            // while another thread is inside GraphBLAS.
+    // streaming stores (see GxB_CONTEXT_STREAM_THRESHOLD):
+    size_t stream_threshold ;   // if > 0: GB_memset and GB_memcpy writes of
+                            // at least this many bytes use non-temporal
+                            // stores that bypass the cache; 0 (the default)
+                            // disables them
+    // snapshots of hot read-mostly global settings, refreshed each time this
+    // Context is engaged (see GB_Context_engage), so that kernels running
+    // under an engaged Context read thread-private copies instead of the
+    // shared globals of GB_Global.c:
+    bool burble ;           // burble setting at engage time
+    float hyper_switch ;    // default hyper_switch at engage time
+    // werkspace arena:
+    GB_void *arena ;        // if not NULL: arena for internal werkspace
+                            // allocations that do not fit in the on-stack
+                            // Werk space, used LIFO like the Werk stack.
+                            // Only used when this Context is engaged to a
+                            // user thread, so it needs no synchronization.
+    size_t arena_size ;     // size of the arena in bytes, or 0 if none
+    size_t arena_top ;      // offset of the first free byte of the arena
+    // per-Context allocator, overriding the global malloc/free of GxB_init
+    // for allocations made while this Context is engaged:
+    GxB_alloc_function alloc_func ;     // allocation function, or NULL
+    GxB_dealloc_function dealloc_func ; // sized deallocation function
+    void *allocator_state ; // passed to alloc_func and dealloc_func
 } ;
 
 //------------------------------------------------------------------------------
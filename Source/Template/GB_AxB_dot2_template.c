@@ -55,6 +55,15 @@
 #error "mask undefined"
 #endif
 
+// # of B columns processed per panel: each task computes a panel of B
+// columns against its whole slice of A', with the loop over the slice
+// outermost, so the slice is streamed from memory once per panel instead of
+// once per column, and each A(:,i) is reused against the whole panel while
+// it is still in cache
+#ifndef GB_DOT2_BPANEL
+#define GB_DOT2_BPANEL 8
+#endif
+
 #if ( !GB_A_IS_HYPER && !GB_B_IS_HYPER )
 {
 
@@ -90,52 +99,91 @@
         // C=A'*B, C<M>=A'*B, or C<!M>=A'*B via dot products
         //----------------------------------------------------------------------
 
-        for (int64_t j = kB_start ; j < kB_end ; j++)
+        for (int64_t jB_start = kB_start ; jB_start < kB_end ;
+             jB_start += GB_DOT2_BPANEL)
         {
+            const int64_t jB_end = GB_IMIN (jB_start + GB_DOT2_BPANEL,
+                kB_end) ;
 
             //------------------------------------------------------------------
-            // get C(:,j)
-            //------------------------------------------------------------------
-
-            const int64_t pC_start = j * cvlen ;
-
-            //------------------------------------------------------------------
-            // get B(:,j)
+            // get the panel of B columns, B(:,jB_start:jB_end-1)
             //------------------------------------------------------------------
 
             #if GB_B_IS_SPARSE
-                // B is sparse (never hypersparse)
-                const int64_t pB_start = Bp [j] ;
-                const int64_t pB_end = Bp [j+1] ;
-                const int64_t bjnz = pB_end - pB_start ;
-                if (bjnz == 0)
-                { 
-                    // no work to do if B(:,j) is empty, except to clear Cb
-                    memset (&Cb [pC_start + kA_start], 0, kA_end - kA_start) ;
-                    continue ;
+                // B is sparse (never hypersparse); an empty B(:,j) needs no
+                // work except to clear its part of the C bitmap
+                int64_t Panel_pB_start [GB_DOT2_BPANEL] ;
+                int64_t Panel_pB_end   [GB_DOT2_BPANEL] ;
+                bool panel_empty = true ;
+                for (int64_t j = jB_start ; j < jB_end ; j++)
+                {
+                    const int64_t pB_start = Bp [j] ;
+                    const int64_t pB_end = Bp [j+1] ;
+                    Panel_pB_start [j - jB_start] = pB_start ;
+                    Panel_pB_end   [j - jB_start] = pB_end ;
+                    if (pB_end > pB_start)
+                    { 
+                        panel_empty = false ;
+                    }
+                    else
+                    { 
+                        memset (&Cb [j * cvlen + kA_start], 0,
+                            kA_end - kA_start) ;
+                    }
                 }
-                #if GB_A_IS_SPARSE
-                    // Both A and B are sparse; get first and last in B(:,j)
-                    const int64_t ib_first = Bi [pB_start] ;
-                    const int64_t ib_last  = Bi [pB_end-1] ;
-                #endif
-            #else
-                // B is bitmap or full
-                const int64_t pB_start = j * vlen ;
+                if (panel_empty) continue ;
             #endif
 
             //------------------------------------------------------------------
-            // C(:,j)<#M(:,j)> = A'*B(:,j), or C(:,j) = A'*B(:,j) if no mask
+            // C(:,panel)<#M(:,panel)> = A' * B(:,panel)
             //------------------------------------------------------------------
 
             for (int64_t i = kA_start ; i < kA_end ; i++)
             {
 
+                //--------------------------------------------------------------
+                // get A(:,i) or A(i,:), reused for the whole panel
+                //--------------------------------------------------------------
+
+                #if GB_A_IS_SPARSE
+                    // A is sparse
+                    const int64_t pA_first = Ap [i] ;
+                    const int64_t pA_end = Ap [i+1] ;
+                    const int64_t ainz = pA_end - pA_first ;
+                #endif
+
+                for (int64_t j = jB_start ; j < jB_end ; j++)
+                {
+
+                //--------------------------------------------------------------
+                // get B(:,j)
+                //--------------------------------------------------------------
+
+                #if GB_B_IS_SPARSE
+                    const int64_t pB_start = Panel_pB_start [j - jB_start] ;
+                    const int64_t pB_end   = Panel_pB_end   [j - jB_start] ;
+                    const int64_t bjnz = pB_end - pB_start ;
+                    if (bjnz == 0)
+                    { 
+                        // B(:,j) is empty; the C bitmap is already cleared
+                        continue ;
+                    }
+                    #if GB_A_IS_SPARSE
+                        // Both A and B are sparse; get first and last in
+                        // B(:,j)
+                        const int64_t ib_first = Bi [pB_start] ;
+                        const int64_t ib_last  = Bi [pB_end-1] ;
+                    #endif
+                #else
+                    // B is bitmap or full
+                    const int64_t pB_start = j * vlen ;
+                #endif
+
                 //--------------------------------------------------------------
                 // get C(i,j), M(i,j), and clear the C(i,j) bitmap if C bitmap
                 //--------------------------------------------------------------
 
-                int64_t pC = pC_start + i ;     // get C(i,j) position
+                int64_t pC = j * cvlen + i ;    // get C(i,j) position
 
                 #if GB_C_IS_FULL
 
@@ -188,10 +236,8 @@
                     //----------------------------------------------------------
 
                     #if GB_A_IS_SPARSE
-                        // A is sparse
-                        int64_t pA = Ap [i] ;
-                        const int64_t pA_end = Ap [i+1] ;
-                        const int64_t ainz = pA_end - pA ;
+                        // A is sparse; pA is advanced by the dot product
+                        int64_t pA = pA_first ;
                         #if (!GB_C_IS_FULL)
                         if (ainz > 0)       // skip this test if C is full
                         #endif
@@ -215,6 +261,7 @@
                         #include "GB_AxB_dot_cij.c"
                     }
                 }
+                }
             }
         }
         #if (!GB_C_IS_FULL)
@@ -234,4 +281,5 @@
 #undef GB_B_IS_FULL
 #undef GB_DOT_ALWAYS_SAVE_CIJ
 #undef GB_DOT_SAVE_CIJ
+#undef GB_DOT2_BPANEL
 
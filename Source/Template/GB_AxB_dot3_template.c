@@ -10,6 +10,19 @@
 // C and M are both sparse or both hyper, and C->h is a copy of M->h.
 // M is present, and not complemented.  It may be valued or structural.
 
+// Each dot product starts with a dependent random access into A: the row
+// pointers Ap [i] when A is sparse, or the hyper hash bucket and then the
+// vector itself when A is hypersparse, and the resulting miss stalls the
+// whole dot product behind it.  The rows i of the upcoming dot products are
+// known ahead of time from the pattern of M(:,j), so each iteration issues
+// software prefetches on behalf of the entries a fixed distance ahead: at
+// the far distance, the row pointers (or the hash bucket) of that entry's
+// A(:,i); at the near distance — by which time its row pointers are already
+// in cache — the first lines of Ai and Ax of A(:,i) itself.
+
+#define GB_DOT3_PREFETCH_FAR  16
+#define GB_DOT3_PREFETCH_NEAR 4
+
 {
 
     int tid ;
@@ -111,6 +124,43 @@
             for (int64_t pC = pC_start ; pC < pC_end ; pC++)
             {
 
+                //--------------------------------------------------------------
+                // prefetch the A(:,i) of upcoming entries of M(:,j)
+                //--------------------------------------------------------------
+
+                #if GB_A_IS_SPARSE
+                {
+                    // far: the row pointers of the entry FAR ahead
+                    int64_t pC_pf = pC + GB_DOT3_PREFETCH_FAR ;
+                    if (pC_pf < pC_end)
+                    {
+                        GB_PREFETCH (&Ap [Mi [pC_pf]]) ;
+                    }
+                    // near: the vector of the entry NEAR ahead, whose row
+                    // pointers were prefetched FAR-NEAR iterations ago
+                    pC_pf = pC + GB_DOT3_PREFETCH_NEAR ;
+                    if (pC_pf < pC_end)
+                    {
+                        const int64_t pA_pf = Ap [Mi [pC_pf]] ;
+                        GB_PREFETCH (&Ai [pA_pf]) ;
+                        #if !GB_A_IS_PATTERN
+                        GB_PREFETCH (&Ax [pA_pf]) ;
+                        #endif
+                    }
+                }
+                #elif GB_A_IS_HYPER
+                {
+                    // far: the hyper hash bucket of the entry FAR ahead; the
+                    // bucket walk itself is left to the lookup
+                    int64_t pC_pf = pC + GB_DOT3_PREFETCH_FAR ;
+                    if (pC_pf < pC_end)
+                    {
+                        GB_PREFETCH
+                            (&A_Yp [GB_HASHF2 (Mi [pC_pf], A_hash_bits)]) ;
+                    }
+                }
+                #endif
+
                 //--------------------------------------------------------------
                 // get C(i,j) and M(i,j)
                 //--------------------------------------------------------------
@@ -168,6 +218,8 @@
     }
 }
 
+#undef GB_DOT3_PREFETCH_FAR
+#undef GB_DOT3_PREFETCH_NEAR
 #undef GB_A_IS_SPARSE
 #undef GB_A_IS_HYPER
 #undef GB_A_IS_BITMAP
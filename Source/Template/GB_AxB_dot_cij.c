@@ -548,9 +548,9 @@
         //----------------------------------------------------------------------
 
         // The MIN_FIRSTJ semirings are exploited, by terminating as soon as
-        // any entry is found.  The MAX_FIRSTJ semirings are not treated
-        // specially here.  They could be done with a backwards traversal of
-        // the sparse vectors A(:,i) and B(:,j).
+        // any entry is found.  The MAX_FIRSTJ semirings traverse the sparse
+        // vectors A(:,i) and B(:,j) backwards, terminating at the last entry
+        // in the intersection.
 
         if (Ai [pA_end-1] < ib_first || ib_last < Ai [pA])
         { 
@@ -562,6 +562,42 @@
             ASSERT (!GB_CIJ_EXISTS) ;
 
         }
+        #if GB_IS_MAX_FIRSTJ_SEMIRING
+        else
+        {
+
+            //------------------------------------------------------------------
+            // MAX_FIRSTJ semiring: take the last entry in the intersection
+            //------------------------------------------------------------------
+
+            int64_t pA1 = pA_end - 1 ;
+            int64_t pB1 = pB_end - 1 ;
+            while (pA1 >= pA && pB1 >= pB)
+            {
+                int64_t ia = Ai [pA1] ;
+                int64_t ib = Bi [pB1] ;
+                if (ia > ib)
+                { 
+                    // A(ia,i) appears after B(ib,j)
+                    pA1-- ;
+                }
+                else if (ib > ia)
+                { 
+                    // B(ib,j) appears after A(ia,i)
+                    pB1-- ;
+                }
+                else // ia == ib == k
+                { 
+                    // k is the last entry in the intersection
+                    cij_exists = true ;
+                    cij = ia + GB_OFFSET ;
+                    break ;
+                }
+            }
+            GB_DOT_SAVE_CIJ ;
+
+        }
+        #else
         else if (ainz > 8 * bjnz)
         {
 
@@ -676,6 +712,7 @@
             }
             GB_DOT_SAVE_CIJ ;
         }
+        #endif
     }
     #endif
 }
@@ -267,6 +267,10 @@
                                 Cb [pC] = keep ;
                                 cb = keep ;
                                 task_cnvals++ ;
+                                #if GB_IS_ANY_MONOID
+                                // the ANY monoid takes no further updates
+                                break ;
+                                #endif
                             }
                             else
                             { 
@@ -283,7 +287,9 @@
                         // C(i,j) already exists
                         //------------------------------------------------------
 
-                        #if !GB_IS_ANY_PAIR_SEMIRING
+                        // an existing C(i,j) is never updated by the ANY
+                        // monoid; it can keep the value it already has
+                        #if !GB_IS_ANY_MONOID
                         for (int64_t k = kstart ; k < kend ; k++)
                         { 
                             int64_t pA = i + k * avlen ;    // pointer to A(i,k)
@@ -49,12 +49,38 @@
     // define the vectors
     //--------------------------------------------------------------------------
 
-    // GB_CIJ_MULTADD:  C(i,j) += A(i,k) * B(k,j)
+    // GB_CIJ_MULTADD:  C(i,j) += A(i,k) * B(k,j), on scalars
     // the semiring is not positional (or A would be pattern-only), so the
     // i, k, j values are not needed
     #define GB_CIJ_MULTADD(cij,aik,bkj) \
         GB_MULTADD (cij, aik, bkj, ignore, ignore, ignore) ;
 
+    // GB_CIJ_MULTADD_VEC: the same update, on one of the vector types below
+    #if (GB_V16 || GB_V8 || GB_V4) && (GB_IS_IMIN_MONOID || GB_IS_IMAX_MONOID)
+    // integer MIN/MAX monoids: GB_MULTADD branches on a comparison and
+    // declares a scalar temporary, neither of which compiles for vector
+    // operands.  A vector comparison yields an all-ones mask per lane, so
+    // the fold is written as a mask select instead, which the compiler
+    // lowers to a vector min/max instruction.  The floating-point MIN/MAX
+    // monoids are excluded, since their omitnan semantics do not reduce to
+    // a select.
+    #if GB_IS_IMIN_MONOID
+    #define GB_CIJ_KEEP(cij,t) ((__typeof__ (cij)) ((cij) < (t)))
+    #else
+    #define GB_CIJ_KEEP(cij,t) ((__typeof__ (cij)) ((cij) > (t)))
+    #endif
+    #define GB_CIJ_MULTADD_VEC(cij,aik,bkj)                     \
+    {                                                           \
+        __typeof__ (cij) zt ;                                   \
+        GB_MULT (zt, aik, bkj, ignore, ignore, ignore) ;        \
+        __typeof__ (cij) zkeep = GB_CIJ_KEEP (cij, zt) ;        \
+        cij = (cij & zkeep) | (zt & ~zkeep) ;                   \
+    }
+    #else
+    #define GB_CIJ_MULTADD_VEC(cij,aik,bkj) \
+        GB_CIJ_MULTADD (cij, aik, bkj)
+    #endif
+
     #if GB_V16
     typedef GB_C_TYPE __attribute__ ((vector_size (16 * sizeof (GB_C_TYPE)))) v16 ;
     typedef GB_C_TYPE __attribute__ ((vector_size (16 * sizeof (GB_C_TYPE)), aligned (sizeof (GB_C_TYPE)))) v16u ;
@@ -128,15 +154,15 @@
                     const GB_A_TYPE *restrict ax = Axi + (k * m) ;
                     // C(i:i+15,j) += A(i:i+15,k)*B(k,j)
                     #if GB_V16
-                    GB_CIJ_MULTADD (c1, (*((v16u *) (ax    ))), bkj) ;
+                    GB_CIJ_MULTADD_VEC (c1, (*((v16u *) (ax    ))), bkj) ;
                     #elif GB_V8
-                    GB_CIJ_MULTADD (c1, (*((v8u  *) (ax    ))), bkj) ;
-                    GB_CIJ_MULTADD (c2, (*((v8u  *) (ax + 8))), bkj) ;
+                    GB_CIJ_MULTADD_VEC (c1, (*((v8u  *) (ax    ))), bkj) ;
+                    GB_CIJ_MULTADD_VEC (c2, (*((v8u  *) (ax + 8))), bkj) ;
                     #elif GB_V4
-                    GB_CIJ_MULTADD (c1, (*((v4u  *) (ax    ))), bkj) ;
-                    GB_CIJ_MULTADD (c2, (*((v4u  *) (ax + 4))), bkj) ;
-                    GB_CIJ_MULTADD (c3, (*((v4u  *) (ax + 8))), bkj) ;
-                    GB_CIJ_MULTADD (c4, (*((v4u  *) (ax +12))), bkj) ;
+                    GB_CIJ_MULTADD_VEC (c1, (*((v4u  *) (ax    ))), bkj) ;
+                    GB_CIJ_MULTADD_VEC (c2, (*((v4u  *) (ax + 4))), bkj) ;
+                    GB_CIJ_MULTADD_VEC (c3, (*((v4u  *) (ax + 8))), bkj) ;
+                    GB_CIJ_MULTADD_VEC (c4, (*((v4u  *) (ax +12))), bkj) ;
                     #else
                     GB_CIJ_MULTADD (cx [ 0], ax [ 0], bkj) ;
                     GB_CIJ_MULTADD (cx [ 1], ax [ 1], bkj) ;
@@ -213,15 +239,15 @@
                             const GB_A_TYPE *restrict ax = Axm + (k * m) ;
                             // C(m-15:m-1,j) += A(m-15:m-1,k)*B(k,j)
                             #if GB_V16 || GB_V8
-                            GB_CIJ_MULTADD (c1, (*((v8u *) (ax    ))), bkj) ;
-                            GB_CIJ_MULTADD (c2, (*((v4u *) (ax + 8))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c1, (*((v8u *) (ax    ))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c2, (*((v4u *) (ax + 8))), bkj) ;
                             #elif GB_V4
-                            GB_CIJ_MULTADD (c1, (*((v4u *) (ax    ))), bkj) ;
-                            GB_CIJ_MULTADD (c2, (*((v4u *) (ax + 4))), bkj) ;
-                            GB_CIJ_MULTADD (c3, (*((v4u *) (ax + 8))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c1, (*((v4u *) (ax    ))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c2, (*((v4u *) (ax + 4))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c3, (*((v4u *) (ax + 8))), bkj) ;
                             #endif
                             #if GB_V16 || GB_V8 || GB_V4
-                            GB_CIJ_MULTADD (c4, (*((v2u *) (ax +12))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c4, (*((v2u *) (ax +12))), bkj) ;
                             GB_CIJ_MULTADD (c5, ax [14], bkj) ;
                             #else
                             GB_CIJ_MULTADD (cx [ 0], ax [ 0], bkj) ;
@@ -292,15 +318,15 @@
                             const GB_A_TYPE *restrict ax = Axm + (k * m) ;
                             // C(m-14:m-1,j) += A(m-14:m-1,k)*B(k,j)
                             #if GB_V16 || GB_V8
-                            GB_CIJ_MULTADD (c1, (*((v8u *) (ax    ))), bkj) ;
-                            GB_CIJ_MULTADD (c2, (*((v4u *) (ax + 8))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c1, (*((v8u *) (ax    ))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c2, (*((v4u *) (ax + 8))), bkj) ;
                             #elif GB_V4
-                            GB_CIJ_MULTADD (c1, (*((v4u *) (ax    ))), bkj) ;
-                            GB_CIJ_MULTADD (c2, (*((v4u *) (ax + 4))), bkj) ;
-                            GB_CIJ_MULTADD (c3, (*((v4u *) (ax + 8))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c1, (*((v4u *) (ax    ))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c2, (*((v4u *) (ax + 4))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c3, (*((v4u *) (ax + 8))), bkj) ;
                             #endif
                             #if GB_V16 || GB_V8 || GB_V4
-                            GB_CIJ_MULTADD (c4, (*((v2u *) (ax +12))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c4, (*((v2u *) (ax +12))), bkj) ;
                             #else
                             GB_CIJ_MULTADD (cx [ 0], ax [ 0], bkj) ;
                             GB_CIJ_MULTADD (cx [ 1], ax [ 1], bkj) ;
@@ -368,12 +394,12 @@
                             const GB_A_TYPE *restrict ax = Axm + (k * m) ;
                             // C(m-13:m-1,j) += A(m-13:m-1,k)*B(k,j)
                             #if GB_V16 || GB_V8
-                            GB_CIJ_MULTADD (c1, (*((v8u *) (ax    ))), bkj) ;
-                            GB_CIJ_MULTADD (c2, (*((v4u *) (ax + 8))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c1, (*((v8u *) (ax    ))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c2, (*((v4u *) (ax + 8))), bkj) ;
                             #elif GB_V4
-                            GB_CIJ_MULTADD (c1, (*((v4u *) (ax    ))), bkj) ;
-                            GB_CIJ_MULTADD (c2, (*((v4u *) (ax + 4))), bkj) ;
-                            GB_CIJ_MULTADD (c3, (*((v4u *) (ax + 8))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c1, (*((v4u *) (ax    ))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c2, (*((v4u *) (ax + 4))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c3, (*((v4u *) (ax + 8))), bkj) ;
                             #endif
                             #if GB_V16 || GB_V8 || GB_V4
                             GB_CIJ_MULTADD (c4, ax [12], bkj) ;
@@ -440,12 +466,12 @@
                             const GB_A_TYPE *restrict ax = Axm + (k * m) ;
                             // C(m-12:m-1,j) += A(m-12:m-1,k)*B(k,j)
                             #if GB_V16 || GB_V8
-                            GB_CIJ_MULTADD (c1, (*((v8u *) (ax    ))), bkj) ;
-                            GB_CIJ_MULTADD (c2, (*((v4u *) (ax + 8))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c1, (*((v8u *) (ax    ))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c2, (*((v4u *) (ax + 8))), bkj) ;
                             #elif GB_V4
-                            GB_CIJ_MULTADD (c1, (*((v4u *) (ax    ))), bkj) ;
-                            GB_CIJ_MULTADD (c2, (*((v4u *) (ax + 4))), bkj) ;
-                            GB_CIJ_MULTADD (c3, (*((v4u *) (ax + 8))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c1, (*((v4u *) (ax    ))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c2, (*((v4u *) (ax + 4))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c3, (*((v4u *) (ax + 8))), bkj) ;
                             #else
                             GB_CIJ_MULTADD (cx [ 0], ax [ 0], bkj) ;
                             GB_CIJ_MULTADD (cx [ 1], ax [ 1], bkj) ;
@@ -508,12 +534,12 @@
                             const GB_A_TYPE *restrict ax = Axm + (k * m) ;
                             // C(m-11:m-1,j) += A(m-11:m-1,k)*B(k,j)
                             #if GB_V16 || GB_V8
-                            GB_CIJ_MULTADD (c1, (*((v8u *) (ax    ))), bkj) ;
-                            GB_CIJ_MULTADD (c2, (*((v2u *) (ax + 8))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c1, (*((v8u *) (ax    ))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c2, (*((v2u *) (ax + 8))), bkj) ;
                             #elif GB_V4
-                            GB_CIJ_MULTADD (c1, (*((v4u *) (ax    ))), bkj) ;
-                            GB_CIJ_MULTADD (c2, (*((v4u *) (ax + 4))), bkj) ;
-                            GB_CIJ_MULTADD (c3, (*((v2u *) (ax + 8))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c1, (*((v4u *) (ax    ))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c2, (*((v4u *) (ax + 4))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c3, (*((v2u *) (ax + 8))), bkj) ;
                             #endif
                             #if GB_V16 || GB_V8 || GB_V4
                             GB_CIJ_MULTADD (c4, ax [10], bkj) ;
@@ -578,12 +604,12 @@
                             const GB_A_TYPE *restrict ax = Axm + (k * m) ;
                             // C(m-10:m-1,j) += A(m-10:m-1,k)*B(k,j)
                             #if GB_V16 || GB_V8
-                            GB_CIJ_MULTADD (c1, (*((v8u *) (ax    ))), bkj) ;
-                            GB_CIJ_MULTADD (c2, (*((v2u *) (ax + 8))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c1, (*((v8u *) (ax    ))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c2, (*((v2u *) (ax + 8))), bkj) ;
                             #elif GB_V4
-                            GB_CIJ_MULTADD (c1, (*((v4u *) (ax    ))), bkj) ;
-                            GB_CIJ_MULTADD (c2, (*((v4u *) (ax + 4))), bkj) ;
-                            GB_CIJ_MULTADD (c3, (*((v2u *) (ax + 8))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c1, (*((v4u *) (ax    ))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c2, (*((v4u *) (ax + 4))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c3, (*((v2u *) (ax + 8))), bkj) ;
                             #else
                             GB_CIJ_MULTADD (cx [ 0], ax [ 0], bkj) ;
                             GB_CIJ_MULTADD (cx [ 1], ax [ 1], bkj) ;
@@ -642,10 +668,10 @@
                             const GB_A_TYPE *restrict ax = Axm + (k * m) ;
                             // C(m-9:m-1,j) += A(m-9:m-1,k)*B(k,j)
                             #if GB_V16 || GB_V8
-                            GB_CIJ_MULTADD (c1, (*((v8u *) (ax    ))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c1, (*((v8u *) (ax    ))), bkj) ;
                             #elif GB_V4
-                            GB_CIJ_MULTADD (c1, (*((v4u *) (ax    ))), bkj) ;
-                            GB_CIJ_MULTADD (c2, (*((v4u *) (ax + 4))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c1, (*((v4u *) (ax    ))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c2, (*((v4u *) (ax + 4))), bkj) ;
                             #endif
                             #if GB_V16 || GB_V8 || GB_V4
                             GB_CIJ_MULTADD (c3, ax [ 8], bkj) ;
@@ -704,10 +730,10 @@
                             const GB_A_TYPE *restrict ax = Axm + (k * m) ;
                             // C(m-8:m-1,j) += A(m-8:m-1,k)*B(k,j)
                             #if GB_V16 || GB_V8
-                            GB_CIJ_MULTADD (c1, (*((v8u *) (ax    ))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c1, (*((v8u *) (ax    ))), bkj) ;
                             #elif GB_V4
-                            GB_CIJ_MULTADD (c1, (*((v4u *) (ax    ))), bkj) ;
-                            GB_CIJ_MULTADD (c2, (*((v4u *) (ax + 4))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c1, (*((v4u *) (ax    ))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c2, (*((v4u *) (ax + 4))), bkj) ;
                             #else
                             GB_CIJ_MULTADD (cx [ 0], ax [ 0], bkj) ;
                             GB_CIJ_MULTADD (cx [ 1], ax [ 1], bkj) ;
@@ -758,8 +784,8 @@
                             const GB_A_TYPE *restrict ax = Axm + (k * m) ;
                             // C(m-7:m-1,j) += A(m-7:m-1,k)*B(k,j)
                             #if GB_V16 || GB_V8 || GB_V4
-                            GB_CIJ_MULTADD (c1, (*((v4u *) (ax    ))), bkj) ;
-                            GB_CIJ_MULTADD (c2, (*((v2u *) (ax + 4))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c1, (*((v4u *) (ax    ))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c2, (*((v2u *) (ax + 4))), bkj) ;
                             GB_CIJ_MULTADD (c3, ax [ 6], bkj) ;
                             #else
                             GB_CIJ_MULTADD (cx [ 0], ax [ 0], bkj) ;
@@ -808,8 +834,8 @@
                             const GB_A_TYPE *restrict ax = Axm + (k * m) ;
                             // C(m-6:m-1,j) += A(m-6:m-1,k)*B(k,j)
                             #if GB_V16 || GB_V8 || GB_V4
-                            GB_CIJ_MULTADD (c1, (*((v4u *) (ax    ))), bkj) ;
-                            GB_CIJ_MULTADD (c2, (*((v2u *) (ax + 4))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c1, (*((v4u *) (ax    ))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c2, (*((v2u *) (ax + 4))), bkj) ;
                             #else
                             GB_CIJ_MULTADD (cx [ 0], ax [ 0], bkj) ;
                             GB_CIJ_MULTADD (cx [ 1], ax [ 1], bkj) ;
@@ -855,7 +881,7 @@
                             const GB_A_TYPE *restrict ax = Axm + (k * m) ;
                             // C(m-5:m-1,j) += A(m-5:m-1,k)*B(k,j)
                             #if GB_V16 || GB_V8 || GB_V4
-                            GB_CIJ_MULTADD (c1, (*((v4u *) (ax    ))), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c1, (*((v4u *) (ax    ))), bkj) ;
                             GB_CIJ_MULTADD (c2, ax [ 4], bkj) ;
                             #else
                             GB_CIJ_MULTADD (cx [ 0], ax [ 0], bkj) ;
@@ -900,7 +926,7 @@
                             const GB_A_TYPE *restrict ax = Axm + (k * m) ;
                             // C(m-4:m-1,j) += A(m-4:m-1,k)*B(k,j)
                             #if GB_V16 || GB_V8 || GB_V4
-                            GB_CIJ_MULTADD (c1, (*((v4u *) ax)), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c1, (*((v4u *) ax)), bkj) ;
                             #else
                             GB_CIJ_MULTADD (cx [ 0], ax [ 0], bkj) ;
                             GB_CIJ_MULTADD (cx [ 1], ax [ 1], bkj) ;
@@ -943,7 +969,7 @@
                             const GB_A_TYPE *restrict ax = Axm + (k * m) ;
                             // C(m-3:m-1,j) += A(m-3:m-1,k)*B(k,j)
                             #if GB_V16 || GB_V8 || GB_V4
-                            GB_CIJ_MULTADD (c1, (*((v2u *) ax)), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c1, (*((v2u *) ax)), bkj) ;
                             GB_CIJ_MULTADD (c2, ax [ 2], bkj) ;
                             #else
                             GB_CIJ_MULTADD (cx [ 0], ax [ 0], bkj) ;
@@ -986,7 +1012,7 @@
                             const GB_A_TYPE *restrict ax = Axm + (k * m) ;
                             // C(m-2:m-1,j) += A(m-2:m-1,k)*B(k,j)
                             #if GB_V16 || GB_V8 || GB_V4
-                            GB_CIJ_MULTADD (c1, (*((v2u *) ax)), bkj) ;
+                            GB_CIJ_MULTADD_VEC (c1, (*((v2u *) ax)), bkj) ;
                             #else
                             GB_CIJ_MULTADD (cx [ 0], ax [ 0], bkj) ;
                             GB_CIJ_MULTADD (cx [ 1], ax [ 1], bkj) ;
@@ -1039,4 +1065,6 @@
 #undef GB_V8
 #undef GB_V4
 #undef GB_CIJ_MULTADD
+#undef GB_CIJ_MULTADD_VEC
+#undef GB_CIJ_KEEP
 
@@ -0,0 +1,223 @@
+//------------------------------------------------------------------------------
+// GB_add_sparse_M_sparse_comp: C(:,j)<!M>=A(:,j)+B(:,j), C and M sparse/hyper
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C and M are sparse or hypersparse, and the mask is complemented.  A and B
+// are also both sparse or hypersparse (see GB_add_sparsity).  C(:,j) is the
+// union of A(:,j) and B(:,j), with the entries admitted by M(:,j) removed.
+
+//      ------------------------------------------
+//      C     <!M> =        A       +       B
+//      ------------------------------------------
+//      sparse  sparse      sparse          sparse
+
+// The union is walked in ascending index order, so M(:,j) is consumed by the
+// same merge: pM only ever moves forward.  The mask thus adds O(nnz(M(:,j)))
+// work to the vector, and C is built directly at its final size, rather than
+// computing an unmasked C=A+B first and deleting the M-admitted entries in a
+// separate pass over the larger intermediate (see GB_mask).
+
+{
+
+    //--------------------------------------------------------------------------
+    // get M(:,j), where M is sparse or hypersparse
+    //--------------------------------------------------------------------------
+
+    int64_t pM = -1 ;
+    int64_t pM_end = -1 ;
+
+    if (fine_task)
+    {
+        // A fine task operates on Mi,Mx [pM...pM_end-1],
+        // which is a subset of the vector M(:,j)
+        pM     = TaskList [taskid].pM ;
+        pM_end = TaskList [taskid].pM_end ;
+    }
+    else
+    {
+        // Ch is never Mh for the complemented mask (see GB_add_phase0)
+        int64_t kM = (C_to_M == NULL) ? j : C_to_M [k] ;
+        if (kM >= 0)
+        {
+            pM     = GBP_M (Mp, kM  , vlen) ;
+            pM_end = GBP_M (Mp, kM+1, vlen) ;
+        }
+    }
+
+    ASSERT (A_is_sparse || A_is_hyper) ;
+    ASSERT (B_is_sparse || B_is_hyper) ;
+
+    // mij = M(i,j), advancing pM to index i; the union below visits indices
+    // in ascending order, so pM never moves backwards
+    #define GB_COMP_MIJ(mij,i)                              \
+        bool mij = false ;                                  \
+        while (pM < pM_end && Mi [pM] < (i)) pM++ ;         \
+        if (pM < pM_end && Mi [pM] == (i))                  \
+        {                                                   \
+            mij = GB_MCAST (Mx, pM, msize) ;                \
+            pM++ ;                                          \
+        }
+
+    //--------------------------------------------------------------------------
+    // merge A(:,j), B(:,j), and M(:,j)
+    //--------------------------------------------------------------------------
+
+    while (pA < pA_end && pB < pB_end)
+    {
+        int64_t iA = Ai [pA] ;
+        int64_t iB = Bi [pB] ;
+        if (iA < iB)
+        {
+            // A(iA,j) is present but B(iA,j) is not
+            GB_COMP_MIJ (mij, iA) ;
+            if (!mij)
+            {
+                #if ( GB_ADD_PHASE == 1 )
+                cjnz++ ;
+                #else
+                Ci [pC] = iA ;
+                #ifndef GB_ISO_ADD
+                #if GB_IS_EWISEUNION
+                {
+                    // C (iA,j) = A(iA,j) + beta
+                    GB_LOAD_A (aij, Ax, pA, A_iso) ;
+                    GB_EWISEOP (Cx, pC, aij, beta_scalar, iA, j) ;
+                }
+                #else
+                {
+                    // C (iA,j) = A (iA,j)
+                    GB_COPY_A_to_C (Cx, pC, Ax, pA, A_iso) ;
+                }
+                #endif
+                #endif
+                pC++ ;
+                #endif
+            }
+            pA++ ;
+        }
+        else if (iA > iB)
+        {
+            // B(iB,j) is present but A(iB,j) is not
+            GB_COMP_MIJ (mij, iB) ;
+            if (!mij)
+            {
+                #if ( GB_ADD_PHASE == 1 )
+                cjnz++ ;
+                #else
+                Ci [pC] = iB ;
+                #ifndef GB_ISO_ADD
+                #if GB_IS_EWISEUNION
+                {
+                    // C (iB,j) = alpha + B(iB,j)
+                    GB_LOAD_B (bij, Bx, pB, B_iso) ;
+                    GB_EWISEOP (Cx, pC, alpha_scalar, bij, iB, j) ;
+                }
+                #else
+                {
+                    // C (iB,j) = B (iB,j)
+                    GB_COPY_B_to_C (Cx, pC, Bx, pB, B_iso) ;
+                }
+                #endif
+                #endif
+                pC++ ;
+                #endif
+            }
+            pB++ ;
+        }
+        else
+        {
+            // both A(i,j) and B(i,j) are present
+            GB_COMP_MIJ (mij, iA) ;
+            if (!mij)
+            {
+                #if ( GB_ADD_PHASE == 1 )
+                cjnz++ ;
+                #else
+                // C (i,j) = A (i,j) + B (i,j)
+                Ci [pC] = iA ;
+                #ifndef GB_ISO_ADD
+                GB_LOAD_A (aij, Ax, pA, A_iso) ;
+                GB_LOAD_B (bij, Bx, pB, B_iso) ;
+                GB_EWISEOP (Cx, pC, aij, bij, iA, j) ;
+                #endif
+                pC++ ;
+                #endif
+            }
+            pA++ ;
+            pB++ ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // A (:,j) or B (:,j) have entries left; not both
+    //--------------------------------------------------------------------------
+
+    for ( ; pA < pA_end ; pA++)
+    {
+        int64_t i = Ai [pA] ;
+        GB_COMP_MIJ (mij, i) ;
+        if (!mij)
+        {
+            #if ( GB_ADD_PHASE == 1 )
+            cjnz++ ;
+            #else
+            Ci [pC] = i ;
+            #ifndef GB_ISO_ADD
+            #if GB_IS_EWISEUNION
+            {
+                // C (i,j) = A(i,j) + beta
+                GB_LOAD_A (aij, Ax, pA, A_iso) ;
+                GB_EWISEOP (Cx, pC, aij, beta_scalar, i, j) ;
+            }
+            #else
+            {
+                // C (i,j) = A (i,j)
+                GB_COPY_A_to_C (Cx, pC, Ax, pA, A_iso) ;
+            }
+            #endif
+            #endif
+            pC++ ;
+            #endif
+        }
+    }
+
+    for ( ; pB < pB_end ; pB++)
+    {
+        int64_t i = Bi [pB] ;
+        GB_COMP_MIJ (mij, i) ;
+        if (!mij)
+        {
+            #if ( GB_ADD_PHASE == 1 )
+            cjnz++ ;
+            #else
+            Ci [pC] = i ;
+            #ifndef GB_ISO_ADD
+            #if GB_IS_EWISEUNION
+            {
+                // C (i,j) = alpha + B(i,j)
+                GB_LOAD_B (bij, Bx, pB, B_iso) ;
+                GB_EWISEOP (Cx, pC, alpha_scalar, bij, i, j) ;
+            }
+            #else
+            {
+                // C (i,j) = B (i,j)
+                GB_COPY_B_to_C (Cx, pC, Bx, pB, B_iso) ;
+            }
+            #endif
+            #endif
+            pC++ ;
+            #endif
+        }
+    }
+
+    #if ( GB_ADD_PHASE == 2 )
+    ASSERT (pC == pC_end) ;
+    #endif
+
+    #undef GB_COMP_MIJ
+}
@@ -18,15 +18,6 @@
     //      ------------------------------------------
     //      sparse  .           sparse          sparse
 
-    //      ------------------------------------------
-    //      C     <!M> =        A       +       B
-    //      ------------------------------------------
-    //      sparse  sparse      sparse          sparse  (mask later)
-
-    // If all four matrices are sparse or hypersparse, and Mask_comp is true,
-    // the mask M is passed in to this method as NULL.  C=A+B is computed with
-    // no mask, and !M is applied later.
-
     // A and B are both sparse or hypersparse, not bitmap or full, but
     // individual vectors of A and B might have all entries present (adense
     // and/or bdense).
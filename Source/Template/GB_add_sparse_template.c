@@ -33,22 +33,15 @@
         //      ------------------------------------------
         //      C     <!M> =        A       +       B
         //      ------------------------------------------
+        //      sparse  sparse      sparse          sparse
         //      sparse  bitmap      sparse          sparse
         //      sparse  full        sparse          sparse
 
-        // If all four matrices are sparse/hypersparse, and C<!M>=A+B is being
-        // computed, then M is passed in as NULL to GB_add_phase*.
-        // GB_add_sparsity returns apply_mask as false.  The methods below do
-        // not handle the case when C is sparse, M is sparse, and !M is used.
-        // All other uses of !M when M is sparse result in a bitmap structure
-        // for C, and this is handled by GB_add_bitmap_template.
-
-        // For this case: the mask is done later, so C=A+B is computed here:
-
-        //      ------------------------------------------
-        //      C     <!M> =        A       +       B
-        //      ------------------------------------------
-        //      sparse  sparse      sparse          sparse      (mask later)
+        // If all four matrices are sparse/hypersparse and C<!M>=A+B is being
+        // computed, GB_add_sparse_M_sparse_comp merges M(:,j) with the union
+        // of A(:,j) and B(:,j), so the mask is applied here.  All other uses
+        // of !M when M is sparse result in a bitmap structure for C, and are
+        // handled by GB_add_bitmap_template.
 
 {
 
@@ -197,7 +190,11 @@
                 }
                 #elif (GB_M_IS_SPARSE || GB_M_IS_HYPER)
                 {
+                    #if GB_MASK_COMP
+                    #include "GB_add_sparse_M_sparse_comp.c"
+                    #else
                     #include "GB_add_sparse_M_sparse.c"
+                    #endif
                 }
                 #else
                 {
@@ -213,7 +210,14 @@
                 }
                 else if (M_is_sparse_or_hyper)
                 { 
-                    #include "GB_add_sparse_M_sparse.c"
+                    if (Mask_comp)
+                    { 
+                        #include "GB_add_sparse_M_sparse_comp.c"
+                    }
+                    else
+                    { 
+                        #include "GB_add_sparse_M_sparse.c"
+                    }
                 }
                 else
                 { 
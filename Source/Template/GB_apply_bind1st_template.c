@@ -9,7 +9,12 @@
 
 {
     GB_C_TYPE *Cx = (GB_C_TYPE *) Cx_output ;
+    #ifdef GB_BIND1ST_SCALAR
+    // the scalar was folded into this kernel as a compile-time constant
+    GB_X_TYPE   x = GB_BIND1ST_SCALAR ;
+    #else
     GB_X_TYPE   x = (*((GB_X_TYPE *) x_input)) ;
+    #endif
     GB_B_TYPE *Bx = (GB_B_TYPE *) Bx_input ;
     int64_t p ;
     #pragma omp parallel for num_threads(nthreads) schedule(static)
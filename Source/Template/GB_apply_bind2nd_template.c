@@ -10,7 +10,12 @@
 {
     GB_C_TYPE *Cx = (GB_C_TYPE *) Cx_output ;
     GB_A_TYPE *Ax = (GB_A_TYPE *) Ax_input ;
+    #ifdef GB_BIND2ND_SCALAR
+    // the scalar was folded into this kernel as a compile-time constant
+    GB_Y_TYPE   y = GB_BIND2ND_SCALAR ;
+    #else
     GB_Y_TYPE   y = (*((GB_Y_TYPE *) y_input)) ;
+    #endif
     int64_t p ;
     #pragma omp parallel for num_threads(nthreads) schedule(static)
     for (p = 0 ; p < anz ; p++)
@@ -306,6 +306,27 @@
     #define GB_TARGET_AVX2
 #endif
 
+//------------------------------------------------------------------------------
+// NEON support for the ARM64 architecture
+//------------------------------------------------------------------------------
+
+#if defined ( __aarch64__ ) || defined ( _M_ARM64 )
+    // the target architecture is ARM64 (AArch64)
+    #define GBARM64 1
+#else
+    #define GBARM64 0
+#endif
+
+// NEON (ASIMD) is a baseline feature of ARM64, so the vector-unrolled kernels
+// can be called with no runtime dispatch and no target attribute.  NEON
+// registers are 128 bits; wider vector shapes are lowered by the compiler
+// onto multiple NEON registers.
+#if GBARM64 && ( GB_COMPILER_GCC || GB_COMPILER_CLANG )
+    #define GB_COMPILER_SUPPORTS_NEON 1
+#else
+    #define GB_COMPILER_SUPPORTS_NEON 0
+#endif
+
 //------------------------------------------------------------------------------
 // disable Google's cpu_featgures on some compilers
 //------------------------------------------------------------------------------
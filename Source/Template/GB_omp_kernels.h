@@ -39,9 +39,11 @@
     #include <omp.h>
     #define GB_OPENMP_MAX_THREADS       omp_get_max_threads ( )
     #define GB_OPENMP_GET_WTIME         omp_get_wtime ( )
+    #define GB_OPENMP_GET_THREAD_ID     omp_get_thread_num ( )
 #else
     #define GB_OPENMP_MAX_THREADS       (1)
     #define GB_OPENMP_GET_WTIME         (0)
+    #define GB_OPENMP_GET_THREAD_ID     (0)
 #endif
 
 #endif
@@ -231,6 +231,14 @@
                             { 
                                 break ;
                             }
+                            // check if another task has reached the
+                            // terminal value
+                            GB_ATOMIC_READ
+                            my_exit = early_exit ;
+                            if (my_exit)
+                            { 
+                                break ;
+                            }
                         }
                         #endif
                     }
@@ -89,8 +89,25 @@
             my_exit = early_exit ;
             if (!my_exit)
             {
+                #if GB_MONOID_IS_TERMINAL
+                int check_count = 4096 ;
+                #endif
                 for (int64_t p = pstart ; p < pend ; p++)
-                { 
+                {
+                    #if GB_MONOID_IS_TERMINAL
+                    if (--check_count <= 0)
+                    {
+                        // every 4096 iterations, check if another task has
+                        // reached the terminal value
+                        check_count = 4096 ;
+                        GB_ATOMIC_READ
+                        my_exit = early_exit ;
+                        if (my_exit)
+                        { 
+                            break ;
+                        }
+                    }
+                    #endif
                     // skip if the entry is a zombie or if not in the bitmap
                     if (A_has_zombies && GB_IS_ZOMBIE (Ai [p])) continue ;
                     if (!GBB_A (Ab, p)) continue ;
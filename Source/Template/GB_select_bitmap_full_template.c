@@ -16,6 +16,36 @@
     const size_t asize = A->type->size ;
     const int64_t anz = avlen * avdim ;
     int64_t p, cnvals = 0 ;
+
+    #if defined ( GB_ENTRY_SELECTOR ) && !defined ( GB_GENERIC ) && \
+        (!defined ( GB_JIT_KERNEL ) || (!GB_DEPENDS_ON_I && !GB_DEPENDS_ON_J))
+
+    //--------------------------------------------------------------------------
+    // branchless compare-and-mask sweep
+    //--------------------------------------------------------------------------
+
+    // The test depends only on the value of the entry (a VALUE* comparison,
+    // or a JIT kernel whose test uses neither i nor j), so the sweep needs no
+    // index computations or per-entry branches: each entry is compared, and
+    // its 0/1 keep byte is written to Cb.  The loop vectorizes, including
+    // the cnvals reduction.
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:cnvals)
+    for (p = 0 ; p < anz ; p++)
+    { 
+        GB_TEST_VALUE_OF_ENTRY (keep, p) ;
+        int8_t cb = (int8_t) keep ;
+        Cb [p] = cb ;
+        cnvals += cb ;
+    }
+
+    #else
+
+    //--------------------------------------------------------------------------
+    // general sweep: the test may depend on the indices of the entry
+    //--------------------------------------------------------------------------
+
     #pragma omp parallel for num_threads(nthreads) schedule(static) \
         reduction(+:cnvals)
     for (p = 0 ; p < anz ; p++)
@@ -50,6 +80,9 @@
         Cb [p] = cb ;
         cnvals += cb ;
     }
+
+    #endif
+
     (*cnvals_handle) = cnvals ;
 }
 
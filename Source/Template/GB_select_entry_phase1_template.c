@@ -45,6 +45,11 @@
     size_t  asize = A->type->size ;
     int64_t avdim = A->vdim ;
 
+    #ifdef GB_GENERIC
+    // the generic kernel tolerates zombies in A, which are never kept
+    const bool A_has_zombies = (A->nzombies > 0) ;
+    #endif
+
     ASSERT (GB_JUMBLED_OK (A)) ;
     ASSERT (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) ;
 
@@ -87,6 +92,13 @@
             for ( ; pA < pA_end ; pA++)
             { 
                 int64_t i = Ai [pA] ;
+                #ifdef GB_GENERIC
+                if (A_has_zombies && GB_IS_ZOMBIE (i))
+                { 
+                    // A(i,j) is a zombie; do not keep it
+                    continue ;
+                }
+                #endif
                 GB_TEST_VALUE_OF_ENTRY (keep, pA) ;
                 if (keep) cjnz++ ;
             }
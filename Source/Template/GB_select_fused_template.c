@@ -0,0 +1,112 @@
+//------------------------------------------------------------------------------
+// GB_select_fused_template: fused count/compact for C=select(A,thunk)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+{
+    //--------------------------------------------------------------------------
+    // get A and its slicing
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict kfirst_Aslice = A_ek_slicing ;
+    const int64_t *restrict klast_Aslice  = A_ek_slicing + A_ntasks ;
+    const int64_t *restrict pstart_Aslice = A_ek_slicing + A_ntasks * 2 ;
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int64_t *restrict Ai = A->i ;
+
+    const GB_A_TYPE *restrict Ax = (GB_A_TYPE *) A->x ;
+    size_t asize = A->type->size ;
+
+    ASSERT (GB_JUMBLED_OK (A)) ;
+    ASSERT (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) ;
+    ASSERT (A->nzombies == 0) ;
+
+    //--------------------------------------------------------------------------
+    // fused scan: count and compact each slice
+    //--------------------------------------------------------------------------
+
+    // Like GB_select_entry_phase1_template, each task counts the live entries
+    // of its vectors into Cp, Wfirst, and Wlast.  In the same scan, the live
+    // entries themselves are appended to the task's own segment of Tk, Ti,
+    // and Tx, starting at the task's first entry of A.  The segment is the
+    // task's entry range in A, an upper bound on what it can keep, so the
+    // counts are not needed to place the copies.
+
+    int tid ;
+    #pragma omp parallel for num_threads(A_nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < A_ntasks ; tid++)
+    {
+
+        // if kfirst > klast then task tid does no work at all
+        int64_t kfirst = kfirst_Aslice [tid] ;
+        int64_t klast  = klast_Aslice  [tid] ;
+        Wfirst [tid] = 0 ;
+        Wlast  [tid] = 0 ;
+        int64_t pT = pstart_Aslice [tid] ;      // base of this task's segment
+        int64_t tnz = 0 ;                       // # entries kept by this task
+
+        //----------------------------------------------------------------------
+        // scan vectors kfirst to klast
+        //----------------------------------------------------------------------
+
+        for (int64_t k = kfirst ; k <= klast ; k++)
+        {
+
+            //------------------------------------------------------------------
+            // find the part of A(:,k) to be scanned by this task
+            //------------------------------------------------------------------
+
+            int64_t j = GBH_A (Ah, k) ;
+            GB_GET_PA (pA, pA_end, tid, k, kfirst, klast, pstart_Aslice,
+                Ap [k], Ap [k+1]) ;
+
+            //------------------------------------------------------------------
+            // compact the live entries of Ax [pA ... pA_end-1]
+            //------------------------------------------------------------------
+
+            int64_t cjnz = 0 ;
+            for ( ; pA < pA_end ; pA++)
+            {
+                int64_t i = Ai [pA] ;
+                GB_TEST_VALUE_OF_ENTRY (keep, pA) ;
+                if (keep)
+                { 
+                    Tk [pT + tnz] = k ;
+                    Ti [pT + tnz] = i ;
+                    if (Tx != NULL)
+                    { 
+                        memcpy (Tx + (pT + tnz)*asize, Ax + pA*asize, asize) ;
+                    }
+                    tnz++ ;
+                    cjnz++ ;
+                }
+            }
+            if (k == kfirst)
+            { 
+                Wfirst [tid] = cjnz ;
+            }
+            else if (k == klast)
+            { 
+                Wlast [tid] = cjnz ;
+            }
+            else
+            { 
+                Cp [k] = cjnz ; 
+            }
+        }
+        Tcnt [tid] = tnz ;
+    }
+
+    //--------------------------------------------------------------------------
+    // reduce the first and last vector of each slice using a single thread
+    //--------------------------------------------------------------------------
+
+    GB_ek_slice_merge1 (Cp, Wfirst, Wlast, A_ek_slicing, A_ntasks) ;
+}
+
@@ -69,11 +69,22 @@
             #if defined ( GB_ENTRY_SELECTOR )
 
                 int64_t j = GBH_A (Ah, k) ;
+                #ifdef GB_GENERIC
+                // the generic kernel tolerates zombies in A, never kept
+                const bool A_has_zombies = (A->nzombies > 0) ;
+                #endif
                 for (int64_t pA = pA_start ; pA < pA_end ; pA++)
                 {
                     // A is sparse or hypersparse
                     ASSERT (Ai != NULL) ;
                     int64_t i = Ai [pA] ;
+                    #ifdef GB_GENERIC
+                    if (A_has_zombies && GB_IS_ZOMBIE (i))
+                    { 
+                        // A(i,j) is a zombie; do not keep it
+                        continue ;
+                    }
+                    #endif
                     GB_TEST_VALUE_OF_ENTRY (keep, pA) ;
                     if (keep)
                     { 
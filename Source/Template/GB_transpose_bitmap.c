@@ -24,33 +24,85 @@
     const int8_t *restrict Ab = A->b ;
     int8_t *restrict Cb = C->b ;
 
-    // TODO: it would be faster to do this by tiles, not rows/columns,
-    // for large matrices, but in most of the cases in GraphBLAS, A and
-    // C will be tall-and-thin or short-and-fat.
+    if (avdim > 64 && avlen > 64)
+    {
+
+        //------------------------------------------------------------------
+        // tiled transpose, for large matrices
+        //------------------------------------------------------------------
+
+        // A and C are traversed in 64-by-64 tiles, so that each tile of A
+        // is read from cache while the corresponding tile of C is written,
+        // regardless of which matrix is traversed with a large stride.
+
+        int64_t ntiles_i = (avdim + 63) / 64 ;
+        int64_t ntiles_j = (avlen + 63) / 64 ;
+        int64_t ntiles = ntiles_i * ntiles_j ;
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t tile_start, tile_end ;
+            GB_PARTITION (tile_start, tile_end, ntiles, tid, nthreads) ;
+            for (int64_t tile = tile_start ; tile < tile_end ; tile++)
+            {
+                int64_t istart = (tile % ntiles_i) * 64 ;
+                int64_t jstart = (tile / ntiles_i) * 64 ;
+                int64_t iend = GB_IMIN (istart + 64, avdim) ;
+                int64_t jend = GB_IMIN (jstart + 64, avlen) ;
+                for (int64_t j = jstart ; j < jend ; j++)
+                {
+                    for (int64_t i = istart ; i < iend ; i++)
+                    {
+                        // C(i,j) = A(j,i)
+                        int64_t pC = i + j * avdim ;
+                        int64_t pA = j + i * avlen ;
+                        int8_t cij_exists = Ab [pA] ;
+                        Cb [pC] = cij_exists ;
+                        #ifndef GB_ISO_TRANSPOSE
+                        if (cij_exists)
+                        {
+                            // Cx [pC] = op (Ax [pA])
+                            GB_APPLY_OP (pC, pA) ;
+                        }
+                        #endif
+                    }
+                }
+            }
+        }
 
-    int tid ;
-    #pragma omp parallel for num_threads(nthreads) schedule(static)
-    for (tid = 0 ; tid < nthreads ; tid++)
+    }
+    else
     {
-        int64_t pC_start, pC_end ;
-        GB_PARTITION (pC_start, pC_end, anz, tid, nthreads) ;
-        for (int64_t pC = pC_start ; pC < pC_end ; pC++)
+
+        //------------------------------------------------------------------
+        // single pass over C, for vectors and small matrices
+        //------------------------------------------------------------------
+
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < nthreads ; tid++)
         {
-            // get i and j of the entry C(i,j)
-            // i = (pC % avdim) ;
-            // j = (pC / avdim) ;
-            // find the position of the entry A(j,i) 
-            // pA = j + i * avlen
-            int64_t pA = ((pC / avdim) + (pC % avdim) * avlen) ;
-            int8_t cij_exists = Ab [pA] ;
-            Cb [pC] = cij_exists ;
-            #ifndef GB_ISO_TRANSPOSE
-            if (cij_exists)
-            { 
-                // Cx [pC] = op (Ax [pA])
-                GB_APPLY_OP (pC, pA) ;
+            int64_t pC_start, pC_end ;
+            GB_PARTITION (pC_start, pC_end, anz, tid, nthreads) ;
+            for (int64_t pC = pC_start ; pC < pC_end ; pC++)
+            {
+                // get i and j of the entry C(i,j)
+                // i = (pC % avdim) ;
+                // j = (pC / avdim) ;
+                // find the position of the entry A(j,i)
+                // pA = j + i * avlen
+                int64_t pA = ((pC / avdim) + (pC % avdim) * avlen) ;
+                int8_t cij_exists = Ab [pA] ;
+                Cb [pC] = cij_exists ;
+                #ifndef GB_ISO_TRANSPOSE
+                if (cij_exists)
+                {
+                    // Cx [pC] = op (Ax [pA])
+                    GB_APPLY_OP (pC, pA) ;
+                }
+                #endif
             }
-            #endif
         }
     }
 }
@@ -22,26 +22,74 @@
     int64_t avdim = A->vdim ;
     int64_t anz = avlen * avdim ;   // ignore integer overflow
 
-    // TODO: it would be faster to do this by tiles, not rows/columns,
-    // for large matrices, but in most of the cases in GraphBLAS, A and
-    // C will be tall-and-thin or short-and-fat.
-
     #ifndef GB_ISO_TRANSPOSE
-    int tid ;
-    #pragma omp parallel for num_threads(nthreads) schedule(static)
-    for (tid = 0 ; tid < nthreads ; tid++)
+    if (avdim > 64 && avlen > 64)
+    {
+
+        //------------------------------------------------------------------
+        // tiled transpose, for large matrices
+        //------------------------------------------------------------------
+
+        // A and C are traversed in 64-by-64 tiles, so that each tile of A
+        // is read from cache while the corresponding tile of C is written,
+        // regardless of which matrix is traversed with a large stride.
+
+        int64_t ntiles_i = (avdim + 63) / 64 ;
+        int64_t ntiles_j = (avlen + 63) / 64 ;
+        int64_t ntiles = ntiles_i * ntiles_j ;
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t tile_start, tile_end ;
+            GB_PARTITION (tile_start, tile_end, ntiles, tid, nthreads) ;
+            for (int64_t tile = tile_start ; tile < tile_end ; tile++)
+            {
+                int64_t istart = (tile % ntiles_i) * 64 ;
+                int64_t jstart = (tile / ntiles_i) * 64 ;
+                int64_t iend = GB_IMIN (istart + 64, avdim) ;
+                int64_t jend = GB_IMIN (jstart + 64, avlen) ;
+                for (int64_t j = jstart ; j < jend ; j++)
+                {
+                    // the stores to C are contiguous; the loads from A are
+                    // strided within the tile, which the compiler can turn
+                    // into vector gathers
+                    GB_PRAGMA_SIMD_VECTORIZE
+                    for (int64_t i = istart ; i < iend ; i++)
+                    {
+                        // Cx [pC] = op (Ax [pA]), with C(i,j) = A(j,i)
+                        int64_t pC = i + j * avdim ;
+                        int64_t pA = j + i * avlen ;
+                        GB_APPLY_OP (pC, pA) ;
+                    }
+                }
+            }
+        }
+
+    }
+    else
     {
-        int64_t pC_start, pC_end ;
-        GB_PARTITION (pC_start, pC_end, anz, tid, nthreads) ;
-        for (int64_t pC = pC_start ; pC < pC_end ; pC++)
-        { 
-            // get i and j of the entry C(i,j)
-            // i = (pC % avdim) ;
-            // j = (pC / avdim) ;
-            // find the position of the entry A(j,i) 
-            // pA = j + i * avlen
-            // Cx [pC] = op (Ax [pA])
-            GB_APPLY_OP (pC, ((pC/avdim) + (pC%avdim) * avlen)) ;
+
+        //------------------------------------------------------------------
+        // single pass over C, for vectors and small matrices
+        //------------------------------------------------------------------
+
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t pC_start, pC_end ;
+            GB_PARTITION (pC_start, pC_end, anz, tid, nthreads) ;
+            for (int64_t pC = pC_start ; pC < pC_end ; pC++)
+            {
+                // get i and j of the entry C(i,j)
+                // i = (pC % avdim) ;
+                // j = (pC / avdim) ;
+                // find the position of the entry A(j,i)
+                // pA = j + i * avlen
+                // Cx [pC] = op (Ax [pA])
+                GB_APPLY_OP (pC, ((pC/avdim) + (pC%avdim) * avlen)) ;
+            }
         }
     }
     #endif
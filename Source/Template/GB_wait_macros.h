@@ -31,9 +31,13 @@
 // true if a matrix is allowed to be jumbled
 #define GB_JUMBLED_OK(A) (GB_JUMBLED (A) || !GB_JUMBLED (A))
 
-// true if a matrix has pending tuples, zombies, or is jumbled
+// true if a matrix has a deferred unary op not yet applied to its values
+#define GB_DEFERRED(A) ((A) != NULL && (A)->deferred_unop != NULL)
+
+// true if a matrix has pending tuples, zombies, is jumbled, or has a
+// deferred unary op
 #define GB_ANY_PENDING_WORK(A) \
-    (GB_PENDING (A) || GB_ZOMBIES (A) || GB_JUMBLED (A))
+    (GB_PENDING (A) || GB_ZOMBIES (A) || GB_JUMBLED (A) || GB_DEFERRED (A))
 
 // true if a matrix is hypersparse but has no A->Y component
 #define GB_NEED_HYPER_HASH(A) (GB_IS_HYPERSPARSE (A) && (((A)->Y) == NULL))
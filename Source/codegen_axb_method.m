@@ -58,6 +58,8 @@ ztype_is_fp = isequal (ztype, 'float') || isequal (ztype, 'double') ;
 is_any_complex = is_any && ~ztype_is_real ;
 is_plus_pair_real = is_plus && is_pair && (is_integer || ztype_is_fp) ;
 is_plus_times_fp = is_plus && isequal (multop, 'times') && ztype_is_fp ;
+is_tropical_int = (is_min || is_max) && ...
+    (isequal (multop, 'plus') || isequal (multop, 'times')) && is_integer ;
 
 t_is_simple = is_pair || codegen_contains (multop, 'first') || codegen_contains (multop, 'second') ;
 t_is_nonnan = isequal (multop (1:2), 'is') || (multop (1) == 'l') ;
@@ -294,10 +296,11 @@ else
     fprintf (f, 'm4_define(`GB_is_any_pair_semiring'', `'')\n') ;
 end
 
-if (is_plus_times_fp)
-    % enable the avx-based methods.  only two semirings (plus_times_fp32 and
-    % plus_times_fp64) are accelerated with AVX2 or AVX512f instructions.  More
-    % semirings will be accelerated in the future.
+if (is_plus_times_fp || is_tropical_int)
+    % enable the avx-based methods: plus_times_fp32 and plus_times_fp64, and
+    % the integer tropical semirings (min/max monoid with plus or times),
+    % whose monoid folds are exact as an elementwise select.  More semirings
+    % will be accelerated in the future.
     fprintf (f, 'm4_define(`if_semiring_has_avx'', `0'')\n') ;
     fprintf (f, 'm4_define(`GB_semiring_has_avx'', `#define GB_SEMIRING_HAS_AVX_IMPLEMENTATION 1'')\n') ;
 else
@@ -0,0 +1,184 @@
+//------------------------------------------------------------------------------
+// GB_mex_test26: test GxB_Matrix_rowScale and GxB_Matrix_colScale
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test26"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    GrB_Matrix A = NULL, D = NULL, D2 = NULL, T = NULL ;
+    int m = 8, n = 5 ;
+
+    //--------------------------------------------------------------------------
+    // create A (m-by-n, double), D (m-by-m diag), and D2 (n-by-n diag)
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, m, n)) ;
+    for (int i = 0 ; i < m ; i++)
+    {
+        for (int j = 0 ; j < n ; j++)
+        {
+            if ((i + j) % 3 == 0)
+            {
+                OK (GrB_Matrix_setElement_FP64 (A, (double) (i + 10*j + 1),
+                    i, j)) ;
+            }
+        }
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+    OK (GrB_Matrix_new (&D, GrB_FP64, m, m)) ;
+    for (int i = 0 ; i < m ; i++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (D, (double) (i + 2), i, i)) ;
+    }
+
+    OK (GrB_Matrix_new (&D2, GrB_FP64, n, n)) ;
+    for (int j = 0 ; j < n ; j++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (D2, (double) (2*j + 1), j, j)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // C = D*C (row scale) and compare with every entry
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_dup (&T, A)) ;
+    OK (GxB_Matrix_rowScale (T, GrB_TIMES_FP64, D, NULL)) ;
+
+    GrB_Index nvals1, nvals2 ;
+    OK (GrB_Matrix_nvals (&nvals1, A)) ;
+    OK (GrB_Matrix_nvals (&nvals2, T)) ;
+    CHECK (nvals1 == nvals2) ;
+
+    for (int i = 0 ; i < m ; i++)
+    {
+        for (int j = 0 ; j < n ; j++)
+        {
+            double aij = 0, tij = 0 ;
+            info = GrB_Matrix_extractElement_FP64 (&aij, A, i, j) ;
+            CHECK (info == GrB_SUCCESS || info == GrB_NO_VALUE) ;
+            if (info == GrB_NO_VALUE)
+            {
+                CHECK (GrB_Matrix_extractElement_FP64 (&tij, T, i, j)
+                    == GrB_NO_VALUE) ;
+            }
+            else
+            {
+                OK (GrB_Matrix_extractElement_FP64 (&tij, T, i, j)) ;
+                CHECK (tij == ((double) (i + 2)) * aij) ;
+            }
+        }
+    }
+    OK (GrB_Matrix_free (&T)) ;
+
+    //--------------------------------------------------------------------------
+    // C = C*D (col scale) and compare with every entry
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_dup (&T, A)) ;
+    OK (GxB_Matrix_colScale (T, GrB_TIMES_FP64, D2, NULL)) ;
+
+    for (int i = 0 ; i < m ; i++)
+    {
+        for (int j = 0 ; j < n ; j++)
+        {
+            double aij = 0, tij = 0 ;
+            info = GrB_Matrix_extractElement_FP64 (&aij, A, i, j) ;
+            if (info == GrB_SUCCESS)
+            {
+                OK (GrB_Matrix_extractElement_FP64 (&tij, T, i, j)) ;
+                CHECK (tij == aij * ((double) (2*j + 1))) ;
+            }
+        }
+    }
+    OK (GrB_Matrix_free (&T)) ;
+
+    //--------------------------------------------------------------------------
+    // row scale of an iso matrix; the result is not iso in general
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&T, GrB_FP64, m, n)) ;
+    OK (GrB_Matrix_assign_FP64 (T, NULL, NULL, 3.0, GrB_ALL, m, GrB_ALL, n,
+        NULL)) ;
+    OK (GrB_Matrix_wait (T, GrB_MATERIALIZE)) ;
+    OK (GxB_Matrix_rowScale (T, GrB_TIMES_FP64, D, NULL)) ;
+    for (int i = 0 ; i < m ; i++)
+    {
+        double tij = 0 ;
+        OK (GrB_Matrix_extractElement_FP64 (&tij, T, i, 0)) ;
+        CHECK (tij == 3.0 * ((double) (i + 2))) ;
+    }
+    OK (GrB_Matrix_free (&T)) ;
+
+    //--------------------------------------------------------------------------
+    // an empty matrix is a quick no-op
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&T, GrB_FP64, m, n)) ;
+    OK (GxB_Matrix_rowScale (T, GrB_TIMES_FP64, D, NULL)) ;
+    OK (GrB_Matrix_nvals (&nvals1, T)) ;
+    CHECK (nvals1 == 0) ;
+
+    //--------------------------------------------------------------------------
+    // error conditions
+    //--------------------------------------------------------------------------
+
+    GrB_Info expected = GrB_DOMAIN_MISMATCH ;
+
+    // positional ops are not supported
+    ERR1 (T, GxB_Matrix_rowScale (T, GxB_FIRSTI_INT64, D, NULL)) ;
+
+    // the op ztype must match the type of C exactly
+    ERR1 (T, GxB_Matrix_rowScale (T, GrB_TIMES_FP32, D, NULL)) ;
+
+    // D has the wrong dimensions for a row scale
+    expected = GrB_DIMENSION_MISMATCH ;
+    ERR1 (T, GxB_Matrix_rowScale (T, GrB_TIMES_FP64, D2, NULL)) ;
+    ERR1 (T, GxB_Matrix_colScale (T, GrB_TIMES_FP64, D, NULL)) ;
+    OK (GrB_Matrix_free (&T)) ;
+
+    // D must be diagonal with all diagonal entries present
+    OK (GrB_Matrix_dup (&T, A)) ;
+    OK (GrB_Matrix_setElement_FP64 (D, 99.0, 1, 0)) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR1 (T, GxB_Matrix_rowScale (T, GrB_TIMES_FP64, D, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // free everything and finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Matrix_free (&D)) ;
+    OK (GrB_Matrix_free (&D2)) ;
+    OK (GrB_Matrix_free (&T)) ;
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test26:  all tests passed\n\n") ;
+}
@@ -0,0 +1,244 @@
+//------------------------------------------------------------------------------
+// GB_mex_test27: test GxB_Matrix_snapshot and GxB_DUP_SHARING
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A snapshot (or a sharing duplicate) co-owns the arrays of its source, so
+// every in-place mutation of one owner must leave the other holding the
+// original values.  Each section below mutates one owner through a different
+// in-place path (setElement, rowScale, scatter, in-place transpose, and the
+// bitmap-to-sparse conversion) and checks the other owner is unchanged.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test27"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    GrB_Matrix A = NULL, S = NULL, D = NULL, B = NULL ;
+    GrB_Vector y = NULL, x = NULL ;
+    int n = 6 ;
+
+    //--------------------------------------------------------------------------
+    // snapshot, then overwrite an existing entry of A
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    for (int i = 0 ; i < n ; i++)
+    {
+        for (int j = 0 ; j < n ; j++)
+        {
+            if ((i + j) % 2 == 0)
+            {
+                OK (GrB_Matrix_setElement_FP64 (A, (double) (i + 10*j + 1),
+                    i, j)) ;
+            }
+        }
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GxB_Matrix_snapshot (&S, A)) ;
+
+    // A(0,0) is an existing entry; overwriting it must not change S
+    OK (GrB_Matrix_setElement_FP64 (A, 999.0, 0, 0)) ;
+    double a00 = 0, s00 = 0 ;
+    OK (GrB_Matrix_extractElement_FP64 (&a00, A, 0, 0)) ;
+    OK (GrB_Matrix_extractElement_FP64 (&s00, S, 0, 0)) ;
+    CHECK (a00 == 999.0) ;
+    CHECK (s00 == 1.0) ;
+
+    //--------------------------------------------------------------------------
+    // an in-place row scale of A must not change S
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_free (&S)) ;
+    OK (GrB_Matrix_setElement_FP64 (A, 1.0, 0, 0)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GxB_Matrix_snapshot (&S, A)) ;
+
+    OK (GrB_Matrix_new (&D, GrB_FP64, n, n)) ;
+    for (int i = 0 ; i < n ; i++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (D, 2.0, i, i)) ;
+    }
+    OK (GxB_Matrix_rowScale (A, GrB_TIMES_FP64, D, NULL)) ;
+
+    for (int i = 0 ; i < n ; i++)
+    {
+        for (int j = 0 ; j < n ; j++)
+        {
+            double aij = 0, sij = 0 ;
+            info = GrB_Matrix_extractElement_FP64 (&sij, S, i, j) ;
+            if (info == GrB_SUCCESS)
+            {
+                OK (GrB_Matrix_extractElement_FP64 (&aij, A, i, j)) ;
+                CHECK (sij == (double) (i + 10*j + 1)) ;
+                CHECK (aij == 2.0 * sij) ;
+            }
+        }
+    }
+    OK (GrB_Matrix_free (&S)) ;
+    OK (GrB_Matrix_free (&A)) ;
+
+    //--------------------------------------------------------------------------
+    // a scatter into a snapshotted dense vector must not change the snapshot
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Vector_new (&y, GrB_FP64, n)) ;
+    for (int i = 0 ; i < n ; i++)
+    {
+        OK (GrB_Vector_setElement_FP64 (y, (double) i, i)) ;
+    }
+    OK (GrB_Vector_wait (y, GrB_MATERIALIZE)) ;
+    OK (GxB_Matrix_snapshot (&S, (GrB_Matrix) y)) ;
+
+    OK (GrB_Vector_new (&x, GrB_FP64, 2)) ;
+    OK (GrB_Vector_setElement_FP64 (x, 100.0, 0)) ;
+    OK (GrB_Vector_setElement_FP64 (x, 200.0, 1)) ;
+    OK (GrB_Vector_wait (x, GrB_MATERIALIZE)) ;
+    GrB_Index Ilist [2] = { 1, 4 } ;
+    OK (GxB_Vector_scatter (y, NULL, x, Ilist, 2, NULL)) ;
+
+    double yi = 0, si = 0 ;
+    OK (GrB_Vector_extractElement_FP64 (&yi, y, 1)) ;
+    OK (GrB_Matrix_extractElement_FP64 (&si, S, 1, 0)) ;
+    CHECK (yi == 100.0) ;
+    CHECK (si == 1.0) ;
+    OK (GrB_Vector_extractElement_FP64 (&yi, y, 4)) ;
+    OK (GrB_Matrix_extractElement_FP64 (&si, S, 4, 0)) ;
+    CHECK (yi == 200.0) ;
+    CHECK (si == 4.0) ;
+    OK (GrB_Matrix_free (&S)) ;
+    OK (GrB_Vector_free (&y)) ;
+    OK (GrB_Vector_free (&x)) ;
+
+    //--------------------------------------------------------------------------
+    // an in-place transpose of a square full matrix must not change S
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    for (int i = 0 ; i < n ; i++)
+    {
+        for (int j = 0 ; j < n ; j++)
+        {
+            OK (GrB_Matrix_setElement_FP64 (A, (double) (i + 10*j + 1),
+                i, j)) ;
+        }
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GxB_Matrix_snapshot (&S, A)) ;
+
+    OK (GrB_transpose (A, NULL, NULL, A, NULL)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+    for (int i = 0 ; i < n ; i++)
+    {
+        for (int j = 0 ; j < n ; j++)
+        {
+            double aij = 0, sij = 0 ;
+            OK (GrB_Matrix_extractElement_FP64 (&aij, A, i, j)) ;
+            OK (GrB_Matrix_extractElement_FP64 (&sij, S, i, j)) ;
+            CHECK (sij == (double) (i + 10*j + 1)) ;
+            CHECK (aij == (double) (j + 10*i + 1)) ;
+        }
+    }
+    OK (GrB_Matrix_free (&S)) ;
+    OK (GrB_Matrix_free (&A)) ;
+
+    //--------------------------------------------------------------------------
+    // converting a snapshotted bitmap matrix to sparse must not change S
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+    for (int i = 0 ; i < n ; i++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (i + 1), i, 0)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    int sparsity ;
+    OK (GxB_Matrix_Option_get (A, GxB_SPARSITY_STATUS, &sparsity)) ;
+    CHECK (sparsity == GxB_BITMAP) ;
+    OK (GxB_Matrix_snapshot (&S, A)) ;
+
+    // force the conversion of A to sparse; S remains bitmap
+    OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GxB_Matrix_Option_get (A, GxB_SPARSITY_STATUS, &sparsity)) ;
+    CHECK (sparsity == GxB_SPARSE) ;
+
+    for (int i = 0 ; i < n ; i++)
+    {
+        double aij = 0, sij = 0 ;
+        OK (GrB_Matrix_extractElement_FP64 (&aij, A, i, 0)) ;
+        OK (GrB_Matrix_extractElement_FP64 (&sij, S, i, 0)) ;
+        CHECK (aij == (double) (i + 1)) ;
+        CHECK (sij == (double) (i + 1)) ;
+    }
+    OK (GrB_Matrix_free (&A)) ;
+
+    // the snapshot outlives its source
+    double s3 = 0 ;
+    OK (GrB_Matrix_extractElement_FP64 (&s3, S, 3, 0)) ;
+    CHECK (s3 == 4.0) ;
+    OK (GrB_Matrix_free (&S)) ;
+
+    //--------------------------------------------------------------------------
+    // GxB_DUP_SHARING: an O(1) dup behaves like an independent deep copy
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_set (GxB_DUP_SHARING, true)) ;
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    for (int i = 0 ; i < n ; i++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (i + 1), i, i)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_dup (&B, A)) ;
+
+    // scale B in place; A must be unchanged
+    OK (GxB_Matrix_rowScale (B, GrB_TIMES_FP64, D, NULL)) ;
+    for (int i = 0 ; i < n ; i++)
+    {
+        double aii = 0, bii = 0 ;
+        OK (GrB_Matrix_extractElement_FP64 (&aii, A, i, i)) ;
+        OK (GrB_Matrix_extractElement_FP64 (&bii, B, i, i)) ;
+        CHECK (aii == (double) (i + 1)) ;
+        CHECK (bii == 2.0 * aii) ;
+    }
+
+    OK (GxB_Global_Option_set (GxB_DUP_SHARING, false)) ;
+
+    //--------------------------------------------------------------------------
+    // free everything and finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Matrix_free (&B)) ;
+    OK (GrB_Matrix_free (&D)) ;
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test27:  all tests passed\n\n") ;
+}
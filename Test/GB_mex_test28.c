@@ -0,0 +1,189 @@
+//------------------------------------------------------------------------------
+// GB_mex_test28: test GxB_Vector_gather and GxB_Vector_scatter
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test28"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    GrB_Vector x = NULL, y = NULL, s = NULL ;
+    int n = 16, ni = 5 ;
+
+    //--------------------------------------------------------------------------
+    // create x, a dense vector of length n
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Vector_new (&x, GrB_FP64, n)) ;
+    for (int i = 0 ; i < n ; i++)
+    {
+        OK (GrB_Vector_setElement_FP64 (x, (double) (i*i), i)) ;
+    }
+    OK (GrB_Vector_wait (x, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // y (k) = x (I (k))
+    //--------------------------------------------------------------------------
+
+    GrB_Index Ilist [5] = { 3, 0, 15, 7, 3 } ;      // duplicates are fine
+    OK (GrB_Vector_new (&y, GrB_FP64, ni)) ;
+    OK (GxB_Vector_gather (y, x, Ilist, ni, NULL)) ;
+
+    for (int k = 0 ; k < ni ; k++)
+    {
+        double yk = 0 ;
+        OK (GrB_Vector_extractElement_FP64 (&yk, y, k)) ;
+        CHECK (yk == (double) (Ilist [k] * Ilist [k])) ;
+    }
+    OK (GrB_Vector_free (&y)) ;
+
+    // gather from an iso x
+    OK (GrB_Vector_free (&x)) ;
+    OK (GrB_Vector_new (&x, GrB_FP64, n)) ;
+    OK (GrB_Vector_assign_FP64 (x, NULL, NULL, 7.0, GrB_ALL, n, NULL)) ;
+    OK (GrB_Vector_new (&y, GrB_FP64, ni)) ;
+    OK (GxB_Vector_gather (y, x, Ilist, ni, NULL)) ;
+    for (int k = 0 ; k < ni ; k++)
+    {
+        double yk = 0 ;
+        OK (GrB_Vector_extractElement_FP64 (&yk, y, k)) ;
+        CHECK (yk == 7.0) ;
+    }
+    OK (GrB_Vector_free (&x)) ;
+    OK (GrB_Vector_free (&y)) ;
+
+    //--------------------------------------------------------------------------
+    // y (I (k)) = x (k), no accum, no duplicates
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Vector_new (&y, GrB_FP64, n)) ;
+    for (int i = 0 ; i < n ; i++)
+    {
+        OK (GrB_Vector_setElement_FP64 (y, 1.0, i)) ;
+    }
+    OK (GrB_Vector_wait (y, GrB_MATERIALIZE)) ;
+
+    GrB_Index J [3] = { 2, 9, 14 } ;
+    OK (GrB_Vector_new (&s, GrB_FP64, 3)) ;
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        OK (GrB_Vector_setElement_FP64 (s, (double) (k + 50), k)) ;
+    }
+    OK (GrB_Vector_wait (s, GrB_MATERIALIZE)) ;
+    OK (GxB_Vector_scatter (y, NULL, s, J, 3, NULL)) ;
+
+    for (int i = 0 ; i < n ; i++)
+    {
+        double yi = 0 ;
+        OK (GrB_Vector_extractElement_FP64 (&yi, y, i)) ;
+        double expect = 1.0 ;
+        for (int k = 0 ; k < 3 ; k++)
+        {
+            if ((GrB_Index) i == J [k]) expect = (double) (k + 50) ;
+        }
+        CHECK (yi == expect) ;
+    }
+    OK (GrB_Vector_free (&s)) ;
+
+    //--------------------------------------------------------------------------
+    // y (I (k)) += x (k), with duplicate indices
+    //--------------------------------------------------------------------------
+
+    GrB_Index Jdup [4] = { 5, 5, 5, 8 } ;
+    OK (GrB_Vector_new (&s, GrB_FP64, 4)) ;
+    for (int k = 0 ; k < 4 ; k++)
+    {
+        OK (GrB_Vector_setElement_FP64 (s, 10.0, k)) ;
+    }
+    OK (GrB_Vector_wait (s, GrB_MATERIALIZE)) ;
+    OK (GxB_Vector_scatter (y, GrB_PLUS_FP64, s, Jdup, 4, NULL)) ;
+
+    double y5 = 0, y8 = 0 ;
+    OK (GrB_Vector_extractElement_FP64 (&y5, y, 5)) ;
+    OK (GrB_Vector_extractElement_FP64 (&y8, y, 8)) ;
+    CHECK (y5 == 1.0 + 30.0) ;      // three accumulated updates
+    CHECK (y8 == 1.0 + 10.0) ;
+    OK (GrB_Vector_free (&s)) ;
+
+    //--------------------------------------------------------------------------
+    // error conditions
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Vector_new (&s, GrB_FP64, 3)) ;
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        OK (GrB_Vector_setElement_FP64 (s, 1.0, k)) ;
+    }
+    OK (GrB_Vector_wait (s, GrB_MATERIALIZE)) ;
+
+    // y and x cannot be aliased
+    GrB_Info expected = GrB_INVALID_VALUE ;
+    ERR1 (y, GxB_Vector_scatter (y, NULL, y, J, 3, NULL)) ;
+
+    // the vectors must be dense
+    OK (GrB_Vector_free (&x)) ;
+    OK (GrB_Vector_new (&x, GrB_FP64, n)) ;
+    OK (GrB_Vector_setElement_FP64 (x, 1.0, 0)) ;
+    OK (GrB_Vector_wait (x, GrB_MATERIALIZE)) ;
+    ERR1 (x, GxB_Vector_scatter (x, NULL, s, J, 3, NULL)) ;
+
+    GrB_Vector t = NULL ;
+    OK (GrB_Vector_new (&t, GrB_FP64, 3)) ;
+    ERR1 (t, GxB_Vector_gather (t, x, J, 3, NULL)) ;
+
+    // no typecasting
+    expected = GrB_DOMAIN_MISMATCH ;
+    GrB_Vector sf = NULL ;
+    OK (GrB_Vector_new (&sf, GrB_FP32, 3)) ;
+    OK (GrB_Vector_assign_FP32 (sf, NULL, NULL, 1.0, GrB_ALL, 3, NULL)) ;
+    ERR1 (y, GxB_Vector_scatter (y, NULL, sf, J, 3, NULL)) ;
+    ERR1 (sf, GxB_Vector_gather (sf, y, J, 3, NULL)) ;
+
+    // indices must be in range
+    expected = GrB_INDEX_OUT_OF_BOUNDS ;
+    GrB_Index Jbad [3] = { 2, 100, 14 } ;
+    ERR1 (y, GxB_Vector_scatter (y, NULL, s, Jbad, 3, NULL)) ;
+    ERR1 (t, GxB_Vector_gather (t, y, Jbad, 3, NULL)) ;
+
+    // the length of y must match ni for a gather
+    expected = GrB_DIMENSION_MISMATCH ;
+    ERR1 (t, GxB_Vector_gather (t, y, J, 2, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // free everything and finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Vector_free (&x)) ;
+    OK (GrB_Vector_free (&y)) ;
+    OK (GrB_Vector_free (&s)) ;
+    OK (GrB_Vector_free (&t)) ;
+    OK (GrB_Vector_free (&sf)) ;
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test28:  all tests passed\n\n") ;
+}
@@ -0,0 +1,133 @@
+//------------------------------------------------------------------------------
+// GB_mex_test29: test GxB_Matrix_reduce_multi
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The single-pass multi-monoid reduction must agree with one
+// GrB_Matrix_reduce per monoid, for monoids of the matrix type, monoids that
+// typecast, an iso matrix, and an empty matrix (the identities).
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test29"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    GrB_Matrix A = NULL ;
+    int m = 40, n = 30 ;
+
+    //--------------------------------------------------------------------------
+    // create A with a deterministic pattern
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, m, n)) ;
+    for (int i = 0 ; i < m ; i++)
+    {
+        for (int j = 0 ; j < n ; j++)
+        {
+            if ((i*j + i + 7*j) % 5 < 2)
+            {
+                OK (GrB_Matrix_setElement_FP64 (A,
+                    (double) ((i + j) % 13) - 6.0, i, j)) ;
+            }
+        }
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // several monoids in one pass, compared with one reduce per monoid
+    //--------------------------------------------------------------------------
+
+    double sum = 0, maxval = 0, minval = 0 ;
+    int32_t isum = 0 ;
+    void *c [4] = { &sum, &maxval, &minval, &isum } ;
+    GrB_Monoid monoids [4] = { GrB_PLUS_MONOID_FP64, GrB_MAX_MONOID_FP64,
+        GrB_MIN_MONOID_FP64, GrB_PLUS_MONOID_INT32 } ;
+
+    OK (GxB_Matrix_reduce_multi (c, monoids, 4, A, NULL)) ;
+
+    double sum1 = 0, maxval1 = 0, minval1 = 0 ;
+    int32_t isum1 = 0 ;
+    OK (GrB_Matrix_reduce_FP64 (&sum1, NULL, GrB_PLUS_MONOID_FP64, A,
+        NULL)) ;
+    OK (GrB_Matrix_reduce_FP64 (&maxval1, NULL, GrB_MAX_MONOID_FP64, A,
+        NULL)) ;
+    OK (GrB_Matrix_reduce_FP64 (&minval1, NULL, GrB_MIN_MONOID_FP64, A,
+        NULL)) ;
+    OK (GrB_Matrix_reduce_INT32 (&isum1, NULL, GrB_PLUS_MONOID_INT32, A,
+        NULL)) ;
+
+    CHECK (sum == sum1) ;
+    CHECK (maxval == maxval1) ;
+    CHECK (minval == minval1) ;
+    CHECK (isum == isum1) ;
+
+    //--------------------------------------------------------------------------
+    // an iso matrix
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, m, n)) ;
+    OK (GrB_Matrix_assign_FP64 (A, NULL, NULL, 2.5, GrB_ALL, m, GrB_ALL, n,
+        NULL)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+    OK (GxB_Matrix_reduce_multi (c, monoids, 3, A, NULL)) ;
+    CHECK (sum == 2.5 * ((double) m) * ((double) n)) ;
+    CHECK (maxval == 2.5) ;
+    CHECK (minval == 2.5) ;
+
+    //--------------------------------------------------------------------------
+    // an empty matrix reduces to the identities
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, m, n)) ;
+    OK (GxB_Matrix_reduce_multi (c, monoids, 3, A, NULL)) ;
+    CHECK (sum == 0) ;
+    CHECK (maxval == (double) (-INFINITY)) ;
+    CHECK (minval == (double) INFINITY) ;
+
+    // no monoids at all is a quick success
+    OK (GxB_Matrix_reduce_multi (c, monoids, 0, A, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // error conditions
+    //--------------------------------------------------------------------------
+
+    GrB_Info expected = GrB_NULL_POINTER ;
+    ERR (GxB_Matrix_reduce_multi (NULL, monoids, 3, A, NULL)) ;
+    ERR (GxB_Matrix_reduce_multi (c, NULL, 3, A, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // free everything and finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_free (&A)) ;
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test29:  all tests passed\n\n") ;
+}
@@ -0,0 +1,142 @@
+//------------------------------------------------------------------------------
+// GB_mex_test30: test GxB_waitAll, GxB_Matrix_reserve, clear_keep, and trim
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test30"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define NMAT 8
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    GrB_Matrix As [NMAT] ;
+    GrB_Matrix A = NULL ;
+    int n = 32 ;
+
+    //--------------------------------------------------------------------------
+    // GxB_waitAll: finish pending work on many matrices in one call
+    //--------------------------------------------------------------------------
+
+    for (int k = 0 ; k < NMAT ; k++)
+    {
+        OK (GrB_Matrix_new (&(As [k]), GrB_FP64, n, n)) ;
+        // leave pending tuples: a varying number per matrix
+        for (int i = 0 ; i <= 3*k ; i++)
+        {
+            OK (GrB_Matrix_setElement_FP64 (As [k], (double) (k + i), i,
+                (i + k) % n)) ;
+        }
+    }
+
+    OK (GxB_waitAll (As, NMAT, GrB_MATERIALIZE)) ;
+
+    for (int k = 0 ; k < NMAT ; k++)
+    {
+        // all pending work must be done, and the values correct
+        CHECK (!GB_ANY_PENDING_WORK (As [k])) ;
+        GrB_Index nvals ;
+        OK (GrB_Matrix_nvals (&nvals, As [k])) ;
+        CHECK (nvals == (GrB_Index) (3*k + 1)) ;
+        double aij = 0 ;
+        OK (GrB_Matrix_extractElement_FP64 (&aij, As [k], 3*k,
+            (3*k + k) % n)) ;
+        CHECK (aij == (double) (k + 3*k)) ;
+        OK (GrB_Matrix_free (&(As [k]))) ;
+    }
+
+    // an empty list is a quick success
+    OK (GxB_waitAll (As, 0, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // GxB_Matrix_reserve, then fill without reallocation surprises
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GxB_Matrix_reserve (A, 200)) ;
+    for (int i = 0 ; i < n ; i++)
+    {
+        for (int j = 0 ; j < 6 ; j++)
+        {
+            OK (GrB_Matrix_setElement_FP64 (A, (double) (i + j), i, j)) ;
+        }
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    GrB_Index nvals ;
+    OK (GrB_Matrix_nvals (&nvals, A)) ;
+    CHECK (nvals == (GrB_Index) (6*n)) ;
+
+    //--------------------------------------------------------------------------
+    // GxB_Matrix_trim releases the slack; the matrix is unchanged
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Matrix_trim (A)) ;
+    OK (GrB_Matrix_nvals (&nvals, A)) ;
+    CHECK (nvals == (GrB_Index) (6*n)) ;
+    double aij = 0 ;
+    OK (GrB_Matrix_extractElement_FP64 (&aij, A, 4, 5)) ;
+    CHECK (aij == 9.0) ;
+
+    //--------------------------------------------------------------------------
+    // GxB_Matrix_clear_keep clears the entries but keeps the allocations
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Matrix_clear_keep (A)) ;
+    OK (GrB_Matrix_nvals (&nvals, A)) ;
+    CHECK (nvals == 0) ;
+    GrB_Index nrows, ncols ;
+    OK (GrB_Matrix_nrows (&nrows, A)) ;
+    OK (GrB_Matrix_ncols (&ncols, A)) ;
+    CHECK (nrows == (GrB_Index) n && ncols == (GrB_Index) n) ;
+
+    // the cleared matrix is immediately reusable
+    OK (GrB_Matrix_setElement_FP64 (A, 42.0, 1, 2)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_nvals (&nvals, A)) ;
+    CHECK (nvals == 1) ;
+    OK (GrB_Matrix_extractElement_FP64 (&aij, A, 1, 2)) ;
+    CHECK (aij == 42.0) ;
+
+    //--------------------------------------------------------------------------
+    // error conditions
+    //--------------------------------------------------------------------------
+
+    GrB_Info expected = GrB_NULL_POINTER ;
+    ERR (GxB_waitAll (NULL, 2, GrB_MATERIALIZE)) ;
+    ERR (GxB_Matrix_reserve (NULL, 10)) ;
+    ERR (GxB_Matrix_trim (NULL)) ;
+    ERR (GxB_Matrix_clear_keep (NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // free everything and finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_free (&A)) ;
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test30:  all tests passed\n\n") ;
+}
@@ -0,0 +1,143 @@
+//------------------------------------------------------------------------------
+// GB_mex_test31: test GxB_Matrix_pack_CSR_int32 and pack_CSC_int32
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test31"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    GrB_Matrix A = NULL ;
+    int m = 4, n = 5 ;
+
+    //--------------------------------------------------------------------------
+    // pack a known matrix as CSR with int32 indices
+    //--------------------------------------------------------------------------
+
+    // A = [ . 1 . 2 . ; . . . . . ; 3 . 4 . 5 ; . . . . 6 ]
+    int32_t *Ap = mxMalloc ((m+1) * sizeof (int32_t)) ;
+    int32_t *Aj = mxMalloc (6 * sizeof (int32_t)) ;
+    double *Ax = mxMalloc (6 * sizeof (double)) ;
+    int32_t Ap_src [5] = { 0, 2, 2, 5, 6 } ;
+    int32_t Aj_src [6] = { 1, 3, 0, 2, 4, 4 } ;
+    memcpy (Ap, Ap_src, sizeof (Ap_src)) ;
+    memcpy (Aj, Aj_src, sizeof (Aj_src)) ;
+    for (int k = 0 ; k < 6 ; k++)
+    {
+        Ax [k] = (double) (k + 1) ;
+    }
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, m, n)) ;
+    OK (GxB_Matrix_pack_CSR_int32 (A, &Ap, &Aj, (void **) &Ax,
+        (m+1) * sizeof (int32_t), 6 * sizeof (int32_t), 6 * sizeof (double),
+        false, false, NULL)) ;
+    CHECK (Ap == NULL && Aj == NULL && Ax == NULL) ;
+
+    GrB_Index nvals ;
+    OK (GrB_Matrix_nvals (&nvals, A)) ;
+    CHECK (nvals == 6) ;
+    double aij = 0 ;
+    OK (GrB_Matrix_extractElement_FP64 (&aij, A, 0, 1)) ; CHECK (aij == 1.0) ;
+    OK (GrB_Matrix_extractElement_FP64 (&aij, A, 0, 3)) ; CHECK (aij == 2.0) ;
+    OK (GrB_Matrix_extractElement_FP64 (&aij, A, 2, 0)) ; CHECK (aij == 3.0) ;
+    OK (GrB_Matrix_extractElement_FP64 (&aij, A, 2, 2)) ; CHECK (aij == 4.0) ;
+    OK (GrB_Matrix_extractElement_FP64 (&aij, A, 2, 4)) ; CHECK (aij == 5.0) ;
+    OK (GrB_Matrix_extractElement_FP64 (&aij, A, 3, 4)) ; CHECK (aij == 6.0) ;
+
+    //--------------------------------------------------------------------------
+    // unpack as int64 CSR: the widened indices must match the originals
+    //--------------------------------------------------------------------------
+
+    GrB_Index *Ap64 = NULL, *Aj64 = NULL ;
+    void *Ax64 = NULL ;
+    GrB_Index Ap_size, Aj_size, Ax_size ;
+    bool iso, jumbled ;
+    OK (GxB_Matrix_unpack_CSR (A, &Ap64, &Aj64, &Ax64, &Ap_size, &Aj_size,
+        &Ax_size, &iso, &jumbled, NULL)) ;
+    CHECK (!iso && !jumbled) ;
+    for (int k = 0 ; k <= m ; k++)
+    {
+        CHECK (Ap64 [k] == (GrB_Index) Ap_src [k]) ;
+    }
+    for (int k = 0 ; k < 6 ; k++)
+    {
+        CHECK (Aj64 [k] == (GrB_Index) Aj_src [k]) ;
+        CHECK (((double *) Ax64) [k] == (double) (k + 1)) ;
+    }
+    mxFree (Ap64) ;
+    mxFree (Aj64) ;
+    mxFree (Ax64) ;
+    OK (GrB_Matrix_free (&A)) ;
+
+    //--------------------------------------------------------------------------
+    // pack an iso diagonal as CSC with int32 indices
+    //--------------------------------------------------------------------------
+
+    int32_t *Cp = mxMalloc (4 * sizeof (int32_t)) ;
+    int32_t *Ci = mxMalloc (3 * sizeof (int32_t)) ;
+    double *Cx = mxMalloc (sizeof (double)) ;
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        Cp [k] = k ;
+        Ci [k] = k ;
+    }
+    Cp [3] = 3 ;
+    Cx [0] = 9.0 ;
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, 3, 3)) ;
+    OK (GxB_Matrix_pack_CSC_int32 (A, &Cp, &Ci, (void **) &Cx,
+        4 * sizeof (int32_t), 3 * sizeof (int32_t), sizeof (double),
+        true, false, NULL)) ;
+
+    OK (GrB_Matrix_nvals (&nvals, A)) ;
+    CHECK (nvals == 3) ;
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        OK (GrB_Matrix_extractElement_FP64 (&aij, A, k, k)) ;
+        CHECK (aij == 9.0) ;
+    }
+    OK (GrB_Matrix_free (&A)) ;
+
+    //--------------------------------------------------------------------------
+    // error conditions
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, m, n)) ;
+    GrB_Info expected = GrB_NULL_POINTER ;
+    ERR1 (A, GxB_Matrix_pack_CSR_int32 (A, NULL, NULL, NULL, 0, 0, 0,
+        false, false, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // free everything and finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_free (&A)) ;
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test31:  all tests passed\n\n") ;
+}
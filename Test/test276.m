@@ -0,0 +1,8 @@
+function test276
+%TEST276 test GxB_Matrix_reduce_multi
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test29 ;
+fprintf ('test276 all tests passed.\n') ;
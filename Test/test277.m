@@ -0,0 +1,8 @@
+function test277
+%TEST277 test GxB_waitAll, GxB_Matrix_reserve, clear_keep, and trim
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test30 ;
+fprintf ('test277 all tests passed.\n') ;
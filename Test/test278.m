@@ -0,0 +1,8 @@
+function test278
+%TEST278 test GxB_Matrix_pack_CSR_int32 and pack_CSC_int32
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test31 ;
+fprintf ('test278 all tests passed.\n') ;
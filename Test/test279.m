@@ -0,0 +1,67 @@
+function test279
+%TEST279 test the dot2 panel schedule, C=A'*B and C<M>=A'*B
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+% The dot2 method processes panels of GB_DOT2_BPANEL columns of B at a time,
+% so the column counts below straddle the panel width: a partial panel, one
+% exact panel, and many panels plus a remainder.  The ANY_PAIR semiring also
+% covers the ANY-monoid early-exit macro inside the panel loop.
+
+rng ('default') ;
+
+GB_mex_burble (1) ;
+
+for n = [3 8 100]
+
+    m = 50 ;
+    Cin = sparse (m, n) ;
+    desc = struct ('inp0', 'tran', 'axb', 'dot') ;
+
+    A.matrix = sprandn (m, m, 0.1) ;
+    A.class  = 'double' ;
+    A.sparsity = 2 ;    % A sparse
+
+    B.matrix = sprandn (m, n, 0.3) ;
+    B.class  = 'double' ;
+    B.sparsity = 2 ;    % B sparse
+
+    M.matrix = logical (sprand (m, n, 0.3)) ;
+    M.sparsity = 4 ;    % M bitmap
+
+    semiring.add = 'plus' ;
+    semiring.multiply = 'times' ;
+    semiring.class = 'double' ;
+
+    % C = A'*B, no mask: C is bitmap (dot2)
+    C1 = GB_mex_mxm  (Cin, [ ], [ ], semiring, A, B, desc) ;
+    C2 = GB_spec_mxm (Cin, [ ], [ ], semiring, A, B, desc) ;
+    GB_spec_compare (C1, C2) ;
+
+    % C<!M> = A'*B with a bitmap mask, in-kernel mask test
+    desc2 = desc ;
+    desc2.mask = 'structural complement' ;
+    C1 = GB_mex_mxm  (Cin, M, [ ], semiring, A, B, desc2) ;
+    C2 = GB_spec_mxm (Cin, M, [ ], semiring, A, B, desc2) ;
+    GB_spec_compare (C1, C2) ;
+
+    % ANY_PAIR: the ANY-monoid GB_DOT macro with its early exit
+    semiring.add = 'any' ;
+    semiring.multiply = 'pair' ;
+    C1 = GB_mex_mxm  (Cin, M, [ ], semiring, A, B, desc2) ;
+    C2 = GB_spec_mxm (Cin, M, [ ], semiring, A, B, desc2) ;
+    GB_spec_compare (C1, C2) ;
+
+    % B bitmap, A sparse: the bitmap B panel path
+    B.sparsity = 4 ;
+    semiring.add = 'plus' ;
+    semiring.multiply = 'times' ;
+    C1 = GB_mex_mxm  (Cin, [ ], [ ], semiring, A, B, desc) ;
+    C2 = GB_spec_mxm (Cin, [ ], [ ], semiring, A, B, desc) ;
+    GB_spec_compare (C1, C2) ;
+
+end
+
+GB_mex_burble (0) ;
+fprintf ('\ntest279: all tests passed\n') ;
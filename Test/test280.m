@@ -0,0 +1,41 @@
+function test280
+%TEST280 test the GB_wait splice with batched setElement updates
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+% Repeated rounds of pending tuples assembled by GB_wait, with each batch
+% landing inside the vector range already present, so the assembly takes the
+% splice path that copies only the leading and trailing regions and grows
+% the matrix in place.
+
+rng ('default') ;
+
+m = 200 ;
+n = 200 ;
+A = sprand (m, n, 0.05) ;
+C1 = A ;
+C2 = A ;
+
+for trial = 1:8
+
+    % a batch of updates confined to the middle columns, half of them
+    % overwriting existing entries and half creating new ones
+    ntuples = 500 ;
+    I = 1 + floor (m * rand (ntuples, 1)) ;
+    J = 50 + floor ((n/2) * rand (ntuples, 1)) ;
+    X = 100 * rand (ntuples, 1) ;
+    I0 = uint64 (I) - 1 ;
+    J0 = uint64 (J) - 1 ;
+
+    for k = 1:ntuples
+        C1 (I (k), J (k)) = X (k) ;
+    end
+
+    C = GB_mex_setElement (C2, I0, J0, X, true) ;
+    C2 = C.matrix ;
+    assert (GB_spok (C2) == 1) ;
+    assert (isequal (C1, C2)) ;
+end
+
+fprintf ('\ntest280: all tests passed\n') ;
@@ -0,0 +1,36 @@
+function test281
+%TEST281 test the single-pass chained scan in GB_cumsum
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+% The chained scan is only used for very large arrays (at least 256 tiles of
+% 64K entries) with more than two threads, so this test needs a 16M-entry
+% array: one size at the threshold with a partial final tile, and one just
+% below it to cover the two-pass method at the same scale.
+
+fprintf ('test281 ---------------------- test GB_cumsum chained scan\n') ;
+
+rng ('default') ;
+
+nmin = 256 * 64 * 1024 ;
+
+for n = [ nmin-1 nmin+17 ]
+
+    c = int64 (4 * rand (1, n)) ;
+    p = cumsum ([0 c]) ;
+    k = sum (c ~= 0) ;
+
+    for nthreads = [1 4 8]
+
+        [p1, k1] = GB_mex_cumsum (c, nthreads, 0) ;
+        assert (isequal (p, p1)) ;
+        assert (k == k1) ;
+
+        p1 = GB_mex_cumsum (c, nthreads, 0) ;
+        assert (isequal (p, p1)) ;
+
+    end
+end
+
+fprintf ('test281: all tests passed\n') ;
@@ -0,0 +1,60 @@
+function test282
+%TEST282 randomized and adversarial inputs for the GB_qsort family
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+% The qsort family dispatches tiny subarrays to sorting networks and bails
+% out to heapsort past a depth limit, so the cases that matter are the
+% lengths around the network sizes, inputs that defeat the pivot choice
+% (sorted, reverse, organ pipe, few distinct keys), and plain random data,
+% at sizes large enough to recurse deeply.
+
+fprintf ('test282 --------------- qsort family, randomized harness\n') ;
+rng ('default') ;
+
+% every tiny length, hitting the sorting networks and their boundaries
+for n = 0:40
+    for trial = 1:10
+        I0 = int64 (floor (8 * rand (n, 1))) ;
+        J0 = int64 (floor (8 * rand (n, 1))) ;
+        [a b] = GB_mex_qsort_2 (I0, J0) ;
+        assert (isequal (sortrows ([I0 J0]), [a b])) ;
+    end
+end
+
+% larger adversarial patterns
+for n = [1e4 1e5]
+
+    n1 = floor (n/2) ;
+    patterns = {
+        int64 (floor (n * rand (n, 1))),        % random
+        int64 ((1:n)'),                         % already sorted
+        int64 ((n:-1:1)'),                      % reverse sorted
+        int64 (42 * ones (n, 1)),               % all equal
+        int64 ([(1:n1) (n1:-1:1) zeros(1, n - 2*n1)]'), % organ pipe
+        int64 (mod ((1:n)', 3)) } ;             % few distinct keys
+
+    for k = 1:length (patterns)
+        I0 = patterns {k} ;
+        J0 = int64 ((1:n)') ;       % unique tiebreaker
+        K0 = int64 (floor (4 * rand (n, 1))) ;
+
+        [a b] = GB_mex_qsort_2 (I0, J0) ;
+        assert (isequal (sortrows ([I0 J0]), [a b])) ;
+
+        [a b c] = GB_mex_qsort_3 (I0, J0, K0) ;
+        assert (isequal (sortrows ([I0 J0 K0]), [a b c])) ;
+
+        % qsort_1b sorts I and carries J; only the keys are comparable
+        [a b] = GB_mex_qsort_1b (I0, J0) ;
+        assert (isequal (sort (I0), a)) ;
+        assert (isequal (sortrows ([I0 J0]), sortrows ([a b]))) ;
+
+        % the parallel merge sort on the same patterns
+        [a b] = GB_mex_msort_2 (I0, J0, 4) ;
+        assert (isequal (sortrows ([I0 J0]), [a b])) ;
+    end
+end
+
+fprintf ('test282 --------------- all tests passed\n') ;
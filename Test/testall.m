@@ -97,6 +97,16 @@ malloc_debugging = stat ;
 %----------------------------------------
 
 logstat ('test272'    ,t, j0  , f1  ) ; % Context
+logstat ('test273'    ,t, j0  , f1  ) ; % GxB_Matrix_rowScale/colScale
+logstat ('test274'    ,t, j0  , f1  ) ; % GxB_Matrix_snapshot, GxB_DUP_SHARING
+logstat ('test275'    ,t, j0  , f1  ) ; % GxB_Vector_gather/scatter
+logstat ('test276'    ,t, j0  , f1  ) ; % GxB_Matrix_reduce_multi
+logstat ('test277'    ,t, j0  , f1  ) ; % GxB_waitAll, reserve, clear_keep, trim
+logstat ('test278'    ,t, j0  , f1  ) ; % int32-index pack_CSR/pack_CSC
+logstat ('test279'    ,t, j4  , f1  ) ; % dot2 panel schedule
+logstat ('test280'    ,t, j4  , f1  ) ; % GB_wait splice growth
+logstat ('test281'    ,t, j4  , f1  ) ; % GB_cumsum chained scan
+logstat ('test282'    ,t, j4  , f1  ) ; % qsort family, randomized harness
 logstat ('test268'    ,t, j4  , f1  ) ; % C<M>=Z sparse masker
 jall = {4,3,2,1,4,2} ;
 fall = {1,1,1,1,0,0} ;
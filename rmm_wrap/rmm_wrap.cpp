@@ -27,6 +27,7 @@
 //      rmm_wrap_deallocate (void *p, std::size_t size)
 
 #include "rmm_wrap.hpp"
+#include <atomic>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -49,6 +50,18 @@ typedef struct
     std::shared_ptr<alloc_map>                         size_map ;
     std::shared_ptr<cuda_stream_pool>                  stream_pool;
     cudaStream_t                                       main_stream;
+    // pool telemetry (see rmm_wrap_get_stats).  The counters are atomic so
+    // that concurrent allocations from different host threads are counted
+    // correctly; the alloc_map itself is protected by the caller.
+    size_t init_pool_size ;
+    size_t max_pool_size ;
+    std::atomic<size_t> limit ;
+    std::atomic<size_t> in_use ;
+    std::atomic<size_t> high_water ;
+    std::atomic<size_t> nallocs ;
+    std::atomic<size_t> ndeallocs ;
+    std::atomic<size_t> nfailures ;
+    std::atomic<size_t> histogram [RMM_WRAP_NBUCKETS] ;
 }
 RMM_Wrap_Handle ;
 
@@ -281,6 +294,24 @@ int rmm_wrap_initialize             // returns -1 on error, 0 on success
         return (-1) ;
     }
 
+    //--------------------------------------------------------------------------
+    // initialize the pool telemetry
+    //--------------------------------------------------------------------------
+
+    RMM_Wrap_Handle *handle = rmm_wrap_context[device_id] ;
+    handle->init_pool_size = init_pool_size ;
+    handle->max_pool_size = max_pool_size ;
+    handle->limit = max_pool_size ;     // soft limit defaults to the max
+    handle->in_use = 0 ;
+    handle->high_water = 0 ;
+    handle->nallocs = 0 ;
+    handle->ndeallocs = 0 ;
+    handle->nfailures = 0 ;
+    for (int k = 0 ; k < RMM_WRAP_NBUCKETS ; k++)
+    {
+        handle->histogram [k] = 0 ;
+    }
+
     return (0) ;
 }
 
@@ -343,6 +374,97 @@ int rmm_wrap_initialize_all_same
     return 0;
 }
 
+//------------------------------------------------------------------------------
+// rmm_wrap_log2_bucket: histogram bucket for an allocation of a given size
+//------------------------------------------------------------------------------
+
+static inline int rmm_wrap_log2_bucket (std::size_t size)
+{
+    int k = 0 ;
+    while (size > 1 && k < RMM_WRAP_NBUCKETS - 1)
+    {
+        size >>= 1 ;
+        k++ ;
+    }
+    return (k) ;
+}
+
+//------------------------------------------------------------------------------
+// rmm_wrap_get_stats: return pool statistics for the current device
+//------------------------------------------------------------------------------
+
+int rmm_wrap_get_stats (RMM_WRAP_STATS *stats)  // returns -1 on error
+{
+    if (rmm_wrap_context == NULL || stats == NULL) return (-1) ;
+    RMM_Wrap_Handle *handle = rmm_wrap_context[get_current_device()] ;
+    stats->init_pool_size = handle->init_pool_size ;
+    stats->max_pool_size = handle->max_pool_size ;
+    stats->limit = handle->limit ;
+    stats->in_use = handle->in_use ;
+    stats->high_water = handle->high_water ;
+    stats->nallocs = handle->nallocs ;
+    stats->ndeallocs = handle->ndeallocs ;
+    stats->nfailures = handle->nfailures ;
+    for (int k = 0 ; k < RMM_WRAP_NBUCKETS ; k++)
+    {
+        stats->histogram [k] = handle->histogram [k] ;
+    }
+    return (0) ;
+}
+
+//------------------------------------------------------------------------------
+// rmm_wrap_reset_stats: reset the counters for the current device
+//------------------------------------------------------------------------------
+
+// The high_water mark, counters, and histogram are reset; the bytes currently
+// in use and the soft limit are left as-is.
+
+void rmm_wrap_reset_stats (void)
+{
+    if (rmm_wrap_context == NULL) return ;
+    RMM_Wrap_Handle *handle = rmm_wrap_context[get_current_device()] ;
+    handle->high_water = handle->in_use.load() ;
+    handle->nallocs = 0 ;
+    handle->ndeallocs = 0 ;
+    handle->nfailures = 0 ;
+    for (int k = 0 ; k < RMM_WRAP_NBUCKETS ; k++)
+    {
+        handle->histogram [k] = 0 ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// rmm_wrap_set_limit: set the soft allocation limit for the current device
+//------------------------------------------------------------------------------
+
+// The RMM pool grows on demand from init_pool_size towards max_pool_size, so
+// the pool no longer needs to be oversized up front to avoid mid-run failure.
+// The soft limit caps that growth at runtime: allocations that would bring
+// the bytes in use above the limit fail instead, leaving the remaining device
+// memory to other processes.  The limit may be raised or lowered at any time,
+// but not below the bytes currently in use.  Note that memory the pool has
+// already reserved from the device is only returned when rmm_wrap_finalize
+// destroys the pool; lowering the limit stops further growth.
+
+int rmm_wrap_set_limit (size_t limit)   // returns -1 on error
+{
+    if (rmm_wrap_context == NULL) return (-1) ;
+    RMM_Wrap_Handle *handle = rmm_wrap_context[get_current_device()] ;
+    if (limit < handle->in_use.load()) return (-1) ;
+    handle->limit = limit ;
+    return (0) ;
+}
+
+//------------------------------------------------------------------------------
+// rmm_wrap_get_limit: get the soft allocation limit for the current device
+//------------------------------------------------------------------------------
+
+size_t rmm_wrap_get_limit (void)
+{
+    if (rmm_wrap_context == NULL) return (0) ;
+    return (rmm_wrap_context[get_current_device()]->limit) ;
+}
+
 //------------------------------------------------------------------------------
 // rmm_wrap_get_next_stream_from_pool: return the next available stream from the pool
 // Output is cudaStream_t
@@ -501,6 +623,16 @@ void *rmm_wrap_allocate( std::size_t *size)
 
 //  printf(" rmm_wrap_alloc %ld bytes\n",*size) ;
 
+    // enforce the soft allocation limit
+    RMM_Wrap_Handle *handle = rmm_wrap_context[device_id] ;
+    if (handle->in_use.load() + (*size) > handle->limit.load())
+    {
+        // the allocation would exceed the limit; fail it so the pool stops
+        // growing, leaving the remaining device memory to other processes
+        handle->nfailures++ ;
+        *size = 0 ;
+        return (NULL) ;
+    }
 
     rmm::mr::device_memory_resource *memoryresource =
         rmm::mr::get_current_device_resource() ;
@@ -508,6 +640,7 @@ void *rmm_wrap_allocate( std::size_t *size)
     if (p == NULL)
     {
         // out of memory
+        handle->nfailures++ ;
         *size = 0 ;
         return (NULL) ;
     }
@@ -515,6 +648,14 @@ void *rmm_wrap_allocate( std::size_t *size)
     // insert p into the hashmap
     am->emplace ((std::size_t)p, (std::size_t)(*size)) ;
 
+    // record the allocation in the telemetry
+    handle->nallocs++ ;
+    handle->histogram [rmm_wrap_log2_bucket (*size)]++ ;
+    size_t in_use = (handle->in_use += (*size)) ;
+    size_t high_water = handle->high_water.load() ;
+    while (in_use > high_water &&
+        !handle->high_water.compare_exchange_weak (high_water, in_use)) { }
+
     // return the allocated block
     return (p) ;
 }
@@ -580,6 +721,11 @@ void rmm_wrap_deallocate( void *p, std::size_t size)
     // remove p from the hashmap
     am->erase ( (std::size_t)(p) ) ;
 
+    // record the deallocation in the telemetry
+    RMM_Wrap_Handle *handle = rmm_wrap_context[device_id] ;
+    handle->ndeallocs++ ;
+    handle->in_use -= actual_size ;
+
     // deallocate the block of memory
     rmm::mr::device_memory_resource *memoryresource =
         rmm::mr::get_current_device_resource() ;
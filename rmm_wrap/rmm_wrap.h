@@ -32,6 +32,25 @@ extern "C" {
 #include <stdio.h>
 
 
+// number of buckets in the allocation-size histogram: bucket k counts
+// allocations with 2^k <= size < 2^(k+1)
+#define RMM_WRAP_NBUCKETS 64
+
+// pool statistics, returned by rmm_wrap_get_stats
+typedef struct
+{
+    size_t init_pool_size ;     // initial pool size, as given at initialize
+    size_t max_pool_size ;      // maximum pool size, as given at initialize
+    size_t limit ;              // current soft allocation limit, in bytes
+    size_t in_use ;             // bytes currently allocated via rmm_wrap
+    size_t high_water ;         // max value of in_use since the last reset
+    size_t nallocs ;            // # of allocations since the last reset
+    size_t ndeallocs ;          // # of deallocations since the last reset
+    size_t nfailures ;          // # of failed allocations since the last reset
+    size_t histogram [RMM_WRAP_NBUCKETS] ;  // allocation-size histogram
+}
+RMM_WRAP_STATS ;
+
 // TODO describe the modes
 typedef enum
 {
@@ -82,6 +101,23 @@ void *rmm_wrap_calloc (size_t n, size_t size) ;
 void *rmm_wrap_realloc (void *p, size_t newsize) ;
 void  rmm_wrap_free (void *p) ;
 
+// Pool telemetry and limits (based on current device_id):
+
+// get the pool statistics; returns -1 if rmm_wrap is not initialized
+int rmm_wrap_get_stats (RMM_WRAP_STATS *stats) ;
+
+// reset high_water, the counters, and the histogram (not in_use or limit)
+void rmm_wrap_reset_stats (void) ;
+
+// set/get the soft allocation limit.  Allocations that would bring the bytes
+// in use above the limit fail, so the pool stops growing at roughly this
+// size; the limit can be raised or lowered at any time.  The initial limit is
+// the max_pool_size given at initialization.  rmm_wrap_set_limit returns -1
+// if rmm_wrap is not initialized, or if the limit is below the bytes
+// currently in use.
+int rmm_wrap_set_limit (size_t limit) ;
+size_t rmm_wrap_get_limit (void) ;
+
 // Get streams from context (based on current device_id):
 void* rmm_wrap_get_next_stream_from_pool(void);
 void* rmm_wrap_get_stream_from_pool(size_t stream_id);
@@ -27,6 +27,14 @@ int main()
     p = (void *)rmm_wrap_allocate( &buff_size );
     printf(" actually allocated  %ld\n", buff_size);
     fflush(stdout);
+
+    RMM_WRAP_STATS stats;
+    if (rmm_wrap_get_stats( &stats ) == 0)
+    {
+        printf(" in_use %ld high_water %ld nallocs %ld limit %ld\n",
+            stats.in_use, stats.high_water, stats.nallocs, stats.limit);
+    }
+
     rmm_wrap_deallocate( p, buff_size);
     rmm_wrap_finalize();
 